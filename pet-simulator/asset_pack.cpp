@@ -0,0 +1,99 @@
+/**
+ * Asset Pack Inspector
+ * Lists and checks an asset pack (sui_watch/assets.bin, built by
+ * convert_images.py pack) with the same AssetPack.h checks the firmware
+ * runs at boot, plus the full data CRC. Exit status 0 only for a valid
+ * pack that fits the assets partition.
+ */
+
+#include "AssetPack.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#define PARTITION_SIZE  0x180000    // assets in sui_watch/partitions.csv
+
+static const char* formatName(uint8_t format) {
+    switch (format) {
+        case ASSET_FORMAT_TRUE_COLOR: return "rgb565";
+        case ASSET_FORMAT_TRUE_COLOR_ALPHA: return "rgb565a8";
+        case ASSET_FORMAT_INDEXED_4BIT: return "i4";
+        case ASSET_FORMAT_INDEXED_8BIT: return "i8";
+    }
+    return "?";
+}
+
+static bool readFile(const char* path, std::vector<uint8_t>& out) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+    uint8_t chunk[4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+        out.insert(out.end(), chunk, chunk + n);
+    }
+    fclose(f);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        printf("Usage: asset_pack PACK\n");
+        return 1;
+    }
+
+    std::vector<uint8_t> pack;
+    if (!readFile(argv[1], pack)) {
+        printf("✗ Cannot read %s\n", argv[1]);
+        return 1;
+    }
+
+    AssetPackError error = assetPackCheck(pack.data(), (uint32_t)pack.size(), true);
+    if (error == ASSET_PACK_BAD_MAGIC || error == ASSET_PACK_BAD_VERSION ||
+        error == ASSET_PACK_TRUNCATED || error == ASSET_PACK_BAD_TABLE) {
+        printf("✗ %s: %s\n", argv[1], assetPackErrorName(error));
+        return 1;
+    }
+
+    // Table is sound from here on; list it even if an entry or the data is bad
+    AssetPackHeader header;
+    memcpy(&header, pack.data(), sizeof(header));
+    const AssetEntry* entries = assetPackEntries(pack.data());
+    uint32_t pixelBytes = 0;
+
+    printf("%-16s %9s %-9s %8s %8s\n", "name", "size", "format", "bytes", "offset");
+    for (uint16_t i = 0; i < header.count; i++) {
+        AssetEntry entry;
+        memcpy(&entry, &entries[i], sizeof(entry));
+        char name[ASSET_NAME_LEN + 1] = {};
+        memcpy(name, entry.name, ASSET_NAME_LEN);
+        char size[16];
+        snprintf(size, sizeof(size), "%ux%u", entry.width, entry.height);
+        // convert_images.py stores identical images once
+        const char* shared = "";
+        for (uint16_t j = 0; j < i && !*shared; j++) {
+            if (entries[j].offset == entry.offset) shared = " (shared)";
+        }
+        printf("%-16s %9s %-9s %8u %#8x%s\n", name, size, formatName(entry.format),
+               entry.size, entry.offset, shared);
+        if (!*shared) pixelBytes += entry.size;
+
+        if (i > 0 && strncmp(entries[i - 1].name, entry.name, ASSET_NAME_LEN) >= 0) {
+            printf("✗ Table not sorted at %s (the firmware binary-searches it)\n", name);
+            error = ASSET_PACK_BAD_ENTRY;
+        }
+    }
+
+    printf("\n%u images, %u pixel bytes, %u bytes total (%.0f%% of the partition)\n",
+           header.count, pixelBytes, header.size, 100.0 * header.size / PARTITION_SIZE);
+    if (header.size > PARTITION_SIZE) {
+        printf("✗ Larger than the assets partition (%u bytes)\n", PARTITION_SIZE);
+        return 1;
+    }
+    if (error != ASSET_PACK_OK) {
+        printf("✗ %s\n", assetPackErrorName(error));
+        return 1;
+    }
+    printf("✓ Pack valid\n");
+    return 0;
+}
@@ -0,0 +1,190 @@
+/**
+ * Sprite Blit Benchmark
+ * Host cost of drawing each indexed image in an asset pack against the
+ * same picture as RGB565 + alpha, on a 240x240 RGB565 framebuffer.
+ *
+ * LVGL itself is not built here; the two paths of its 8.3 software
+ * renderer (16-bit colour, no image cache) are reproduced instead:
+ * - true colour + alpha straight from flash: split each row into colour
+ *   and mask, blend with lv_color_mix
+ * - indexed: the built-in decoder converts the palette on every open,
+ *   then each row goes palette -> colour + alpha before the same blend
+ * Absolute times are for this machine; the ratio is what carries over
+ * to the ESP32-S3.
+ */
+
+#include "AssetPack.h"
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#define SCREEN_SIZE     240
+#define DRAWS           2000    // Per image and path
+#define MAX_WIDTH       SCREEN_SIZE
+
+// ============================================
+// LVGL 8 Software Renderer (16-bit)
+// ============================================
+
+// lv_color_mix with LV_COLOR_MIX_ROUND_OFS 0x80
+static inline uint16_t colorMix(uint16_t fg, uint16_t bg, uint8_t mix) {
+    uint32_t r = (((fg >> 11) * mix + (bg >> 11) * (255 - mix) + 0x80) * 0x8081) >> 23;
+    uint32_t g = ((((fg >> 5) & 0x3F) * mix + ((bg >> 5) & 0x3F) * (255 - mix) + 0x80) * 0x8081) >> 23;
+    uint32_t b = (((fg & 0x1F) * mix + (bg & 0x1F) * (255 - mix) + 0x80) * 0x8081) >> 23;
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+// lv_draw_sw_img_decoded for an alpha format: colour + mask, then blend
+static void blendRow(const uint8_t* argb, int width, uint16_t* dst) {
+    uint16_t colors[MAX_WIDTH];
+    uint8_t mask[MAX_WIDTH];
+    for (int x = 0; x < width; x++) {
+        colors[x] = (uint16_t)(argb[3 * x] | (argb[3 * x + 1] << 8));
+        mask[x] = argb[3 * x + 2];
+    }
+    for (int x = 0; x < width; x++) {
+        if (mask[x] == 0xFF) dst[x] = colors[x];
+        else if (mask[x] != 0) dst[x] = colorMix(colors[x], dst[x], mask[x]);
+    }
+}
+
+static void drawTrueColorAlpha(const uint8_t* data, int width, int height, uint16_t* fb) {
+    for (int y = 0; y < height; y++) {
+        blendRow(data + (size_t)y * width * 3, width, fb + (size_t)y * SCREEN_SIZE);
+    }
+}
+
+// lv_img_decoder_built_in_open + read_line, one row at a time
+static void drawIndexed(const uint8_t* data, int width, int height, int bits, uint16_t* fb) {
+    int colors = 1 << bits;
+    uint16_t palette[256];
+    uint8_t opa[256];
+    for (int i = 0; i < colors; i++) {
+        const uint8_t* c = data + 4 * i;    // lv_color32_t: B, G, R, A
+        palette[i] = (uint16_t)(((c[2] >> 3) << 11) | ((c[1] >> 2) << 5) | (c[0] >> 3));
+        opa[i] = c[3];
+    }
+
+    const uint8_t* indices = data + 4 * colors;
+    int stride = bits == 4 ? (width + 1) / 2 : width;
+    uint8_t line[MAX_WIDTH * 3];
+    for (int y = 0; y < height; y++) {
+        const uint8_t* row = indices + (size_t)y * stride;
+        for (int x = 0; x < width; x++) {
+            uint8_t index = bits == 4 ? (uint8_t)((row[x >> 1] >> ((x & 1) ? 0 : 4)) & 0x0F) : row[x];
+            line[3 * x] = (uint8_t)palette[index];
+            line[3 * x + 1] = (uint8_t)(palette[index] >> 8);
+            line[3 * x + 2] = opa[index];
+        }
+        blendRow(line, width, fb + (size_t)y * SCREEN_SIZE);
+    }
+}
+
+// Same picture as RGB565 + alpha, for the comparison
+static std::vector<uint8_t> expandIndexed(const uint8_t* data, int width, int height, int bits) {
+    std::vector<uint8_t> out((size_t)width * height * 3);
+    int colors = 1 << bits;
+    int stride = bits == 4 ? (width + 1) / 2 : width;
+    for (int y = 0; y < height; y++) {
+        const uint8_t* row = data + 4 * colors + (size_t)y * stride;
+        for (int x = 0; x < width; x++) {
+            uint8_t index = bits == 4 ? (uint8_t)((row[x >> 1] >> ((x & 1) ? 0 : 4)) & 0x0F) : row[x];
+            const uint8_t* c = data + 4 * index;
+            uint16_t rgb565 = (uint16_t)(((c[2] >> 3) << 11) | ((c[1] >> 2) << 5) | (c[0] >> 3));
+            uint8_t* px = &out[((size_t)y * width + x) * 3];
+            px[0] = (uint8_t)rgb565;
+            px[1] = (uint8_t)(rgb565 >> 8);
+            px[2] = c[3];
+        }
+    }
+    return out;
+}
+
+// ============================================
+// Benchmark
+// ============================================
+
+template <typename Draw>
+static double timeDraws(Draw draw, std::vector<uint16_t>& fb) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < DRAWS; i++) {
+        draw(fb.data());
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::micro>(elapsed).count() / DRAWS;
+}
+
+static bool readFile(const char* path, std::vector<uint8_t>& out) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+    uint8_t chunk[4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+        out.insert(out.end(), chunk, chunk + n);
+    }
+    fclose(f);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        printf("Usage: blit_bench PACK\n");
+        return 1;
+    }
+
+    std::vector<uint8_t> pack;
+    if (!readFile(argv[1], pack)) {
+        printf("✗ Cannot read %s\n", argv[1]);
+        return 1;
+    }
+    AssetPackError error = assetPackCheck(pack.data(), (uint32_t)pack.size(), true);
+    if (error != ASSET_PACK_OK) {
+        printf("✗ %s: %s\n", argv[1], assetPackErrorName(error));
+        return 1;
+    }
+
+    AssetPackHeader header;
+    memcpy(&header, pack.data(), sizeof(header));
+    const AssetEntry* entries = assetPackEntries(pack.data());
+    std::vector<uint16_t> fb(SCREEN_SIZE * SCREEN_SIZE, 0xFFFF);
+    uint32_t checksum = 0;
+    double trueColorTotal = 0, indexedTotal = 0;
+    int measured = 0;
+
+    printf("%-16s %-6s %10s %10s %8s\n", "name", "format", "rgb565a8", "indexed", "ratio");
+    for (uint16_t i = 0; i < header.count; i++) {
+        AssetEntry entry;
+        memcpy(&entry, &entries[i], sizeof(entry));
+        int bits = entry.format == ASSET_FORMAT_INDEXED_4BIT ? 4 :
+                   entry.format == ASSET_FORMAT_INDEXED_8BIT ? 8 : 0;
+        if (bits == 0 || entry.width > SCREEN_SIZE || entry.height > SCREEN_SIZE) continue;
+
+        const uint8_t* data = pack.data() + entry.offset;
+        std::vector<uint8_t> trueColor = expandIndexed(data, entry.width, entry.height, bits);
+        double trueColorUs = timeDraws([&](uint16_t* target) {
+            drawTrueColorAlpha(trueColor.data(), entry.width, entry.height, target);
+        }, fb);
+        double indexedUs = timeDraws([&](uint16_t* target) {
+            drawIndexed(data, entry.width, entry.height, bits, target);
+        }, fb);
+        for (uint16_t px : fb) checksum = checksum * 31 + px;
+
+        char name[ASSET_NAME_LEN + 1] = {};
+        memcpy(name, entry.name, ASSET_NAME_LEN);
+        printf("%-16s %-6s %8.1fus %8.1fus %7.2fx\n", name, bits == 4 ? "i4" : "i8",
+               trueColorUs, indexedUs, indexedUs / trueColorUs);
+        trueColorTotal += trueColorUs;
+        indexedTotal += indexedUs;
+        measured++;
+    }
+
+    if (measured == 0) {
+        printf("No indexed images in %s (give them a palette in assets/pack.txt)\n", argv[1]);
+        return 0;
+    }
+    printf("\n%d images, %d draws each: indexed costs %.2fx the rgb565a8 blit (checksum %08x)\n",
+           measured, DRAWS, indexedTotal / trueColorTotal, checksum);
+    return 0;
+}
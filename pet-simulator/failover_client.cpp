@@ -0,0 +1,135 @@
+/**
+ * Failover Client
+ * The watch's reconnect and endpoint decisions for
+ * trust-oracle-server/test-failover.mjs. OracleEndpoints (probe,
+ * selection, cooldown, failover) and LinkMonitor (reconnect backoff,
+ * outage time) are compiled from sui_watch/ unchanged; probes are real
+ * TCP connects (HOST_WIFI_SOCKETS) and appClock is the host's clock.
+ *
+ * The harness owns the WebSocket session and reports what happened to
+ * it; this program answers with what TrustOracleClient::loop() would do.
+ * One line in, one line out:
+ *
+ *   (start)          -> connect HOST PORT       probe, then the fastest
+ *   connected        -> ok                      WebSocket is open
+ *   authenticated    -> ok OUTAGE_MS            session is up again
+ *   disconnected     -> retry DELAY_MS          try the same server then
+ *   poll             -> wait                    still inside the retry window
+ *                    -> retry DELAY_MS          attempt failed, same server
+ *                    -> connect HOST PORT       attempt failed, failed over
+ *   quit
+ *
+ * Usage: failover_client HOST:PORT,HOST:PORT[,...]
+ */
+
+#include "Clock.h"
+#include "LinkMonitor.h"
+#include "OracleEndpoints.h"
+
+#include <chrono>
+#include <ctime>
+#include <iostream>
+#include <string>
+
+// ============================================
+// Host Glue
+// ============================================
+
+Print Serial;
+Clock* appClock = nullptr;
+
+long random(long max) {
+    return max > 0 ? rand() % max : 0;
+}
+
+// Real time: backoff windows and outages are measured as on the watch.
+// millis() counts from the host's boot, never from 0 (LinkMonitor reads
+// 0 as "not armed").
+class HostClock : public Clock {
+public:
+    uint32_t millis() override {
+        return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+    uint32_t epoch() override { return (uint32_t)time(nullptr); }
+};
+
+static void reply(const char* format, ...) __attribute__((format(printf, 1, 2)));
+
+static void reply(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+    putchar('\n');
+    fflush(stdout);
+}
+
+static void replyConnect(OracleEndpoints& endpoints) {
+    const OracleEndpoint& ep = endpoints.get(endpoints.current());
+    reply("connect %s %u", ep.host, ep.port);
+}
+
+// ============================================
+// Main
+// ============================================
+
+int main(int argc, char** argv) {
+    if (argc != 2 || !OracleEndpoints::store(argv[1])) {
+        fprintf(stderr, "Usage: %s HOST:PORT,HOST:PORT[,...]\n", argv[0]);
+        return 1;
+    }
+
+    HostClock clock;
+    appClock = &clock;
+    srand((unsigned)time(nullptr));
+
+    OracleEndpoints endpoints;
+    LinkMonitor link;
+    endpoints.load(nullptr, 0);
+
+    // First pass of loop(): probe everything, connect to the fastest
+    endpoints.startProbe();
+    endpoints.setCurrent(endpoints.select(clock.millis()));
+    link.onConnecting(clock.millis());
+    replyConnect(endpoints);
+
+    std::string command;
+    while (std::getline(std::cin, command)) {
+        unsigned long now = clock.millis();
+
+        if (command == "connected") {
+            link.onConnected(now);
+            reply("ok");
+        } else if (command == "authenticated") {
+            link.onAuthenticated(now);
+            endpoints.recordSession(link.stats().authMs);
+            reply("ok %lu", (unsigned long)link.stats().outageMs);
+        } else if (command == "disconnected") {
+            endpoints.recordDrop();
+            reply("retry %lu", (unsigned long)link.onDisconnected(now));
+        } else if (command == "poll") {
+            // loop() while offline: the armed retry window ran out
+            uint32_t delayMs = link.checkReconnect(now);
+            if (!delayMs) {
+                reply("wait");
+                continue;
+            }
+            endpoints.recordFailure(now);
+            if (endpoints.shouldFailover(now)) {
+                // failover(): switch, then refresh latencies for the next decision
+                endpoints.setCurrent(endpoints.select(now));
+                endpoints.countFailover();
+                replyConnect(endpoints);
+                endpoints.startProbe();
+            } else {
+                reply("retry %lu", (unsigned long)delayMs);
+            }
+        } else if (command == "quit") {
+            break;
+        } else {
+            reply("error unknown command");
+        }
+    }
+    return 0;
+}
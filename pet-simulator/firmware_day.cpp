@@ -0,0 +1,385 @@
+/**
+ * Firmware Day Harness
+ * Runs the watch's non-hardware logic - VirtualPet, AppState queues,
+ * StepBatch, StateJournal and the PetRules table, compiled from
+ * sui_watch/ unchanged - on a VirtualClock, with the three task loops
+ * replayed tick by tick. A simulated day takes well under a minute.
+ *
+ * What stands in for hardware: a synthetic walker instead of the IMU
+ * step detector, an owner who glances at the watch instead of touch
+ * input, and a server that acknowledges every pet sync and step batch
+ * at once. The task loops mirror sui_watch.ino (sensor every
+ * IMU_TICK_MS, UI and net every tick) and use its APP_* periods.
+ *
+ * --trace FILE writes the firmware's event ring (Tracer.h) at the end of
+ * the run, with each replayed loop as its own task. Durations are host
+ * time, not watch time.
+ */
+
+#include "Clock.h"
+#include "AppState.h"
+#include "PetRules.h"
+#include "StateJournal.h"
+#include "StepBatch.h"
+#include "Tracer.h"
+#include "VirtualPet.h"
+
+#include <Preferences.h>
+#include <chrono>
+#include <random>
+
+// ============================================
+// Host Glue
+// ============================================
+
+Print Serial;
+Clock* appClock = nullptr;
+
+static std::mt19937 hostRng(1);
+
+long random(long max) {
+    return max > 0 ? (long)(hostRng() % (unsigned long)max) : 0;
+}
+
+// The replayed loop plays the FreeRTOS task for the tracer; its name
+// string is the task identity
+static const char* hostTask = "main";
+
+static const void* hostCurrentTask() { return hostTask; }
+static const char* hostTaskName(const void* task) { return (const char*)task; }
+
+static void traceWriteFile(const char* text, size_t len, void* context) {
+    fwrite(text, 1, len, (FILE*)context);
+}
+
+#define IMU_TICK_MS        50          // Sensor task period on the watch
+#define SNTP_AFTER_MS      8000        // Clock set by SNTP this long after boot
+#define SIM_EPOCH          1704067200u // 2024-01-01 00:00 UTC
+
+// Owner's walking shape over the day (relative weights per hour)
+static const float HOUR_WEIGHTS[24] = {
+    0, 0, 0, 0, 0, 0, 0, 4, 8, 4, 3, 3, 7, 4, 3, 3, 4, 8, 6, 4, 3, 2, 0, 0
+};
+
+struct HarnessConfig {
+    uint32_t days = 1;
+    uint32_t dailySteps = 7000;
+    float glanceMin = 30.0f;
+    float wakeHour = 7.0f;
+    float sleepHour = 23.0f;
+    uint32_t seed = 1;
+    bool verbose = false;
+    const char* tracePath = nullptr;
+};
+
+struct Counters {
+    uint32_t steps = 0;
+    uint32_t rewardEvents = 0;
+    uint32_t windows = 0;
+    uint32_t windowsDropped = 0;
+    uint32_t batches = 0;
+    uint32_t syncs = 0;
+    uint32_t syncFields = 0;
+    uint32_t claims = 0;
+    uint32_t feeds = 0;
+    uint32_t plays = 0;
+    uint32_t glances = 0;
+};
+
+// ============================================
+// Simulated Watch
+// ============================================
+
+class SimWatch {
+public:
+    SimWatch(const HarnessConfig& config, VirtualClock& clock)
+        : _config(config), _clock(clock), _rng(config.seed), _stepCarry(0),
+          _lastSettle(0), _lastWindow(0), _lastSync(0), _lastJournal(0),
+          _syncVersion(0), _nextGlanceMs(0), _sntpDone(false) {}
+
+    void boot() {
+        appState.begin();
+        JournalRecord saved;
+        bool haveSaved = journal.begin(saved);
+        if (haveSaved) appState.setSteps(saved.steps);
+        pet.init("Tamagotchi", haveSaved ? &saved.pet : nullptr);
+    }
+
+    // One IMU period of all three tasks
+    void tick() {
+        uint32_t now = _clock.millis();
+
+        if (!_sntpDone && now >= SNTP_AFTER_MS) {
+            _clock.setEpoch(SIM_EPOCH + now / 1000);
+            _sntpDone = true;
+        }
+
+        sensorTask(now);
+        uiTask(now);
+        netTask(now);
+        owner(now);
+    }
+
+    VirtualPet pet;
+    AppState appState;
+    StateJournal journal;
+    StepBatch stepBatch;
+    Counters counters;
+
+private:
+    const HarnessConfig& _config;
+    VirtualClock& _clock;
+    std::mt19937 _rng;
+    double _stepCarry;
+    uint32_t _lastSettle;
+    uint32_t _lastWindow;
+    uint32_t _lastSync;
+    uint32_t _lastJournal;
+    uint32_t _syncVersion;
+    uint64_t _nextGlanceMs;
+    bool _sntpDone;
+
+    // Seconds into the current wall-clock day
+    uint32_t secondOfDay() { return _clock.epoch() % 86400; }
+
+    // detectSteps() + recordStepWindow()
+    void sensorTask(uint32_t now) {
+        hostTask = "sensor";
+        TRACE_SCOPE("steps");
+        float weightSum = 0;
+        for (float w : HOUR_WEIGHTS) weightSum += w;
+        float hourShare = HOUR_WEIGHTS[secondOfDay() / 3600] / weightSum;
+        _stepCarry += _config.dailySteps * hourShare * IMU_TICK_MS / 3600000.0;
+
+        while (_stepCarry >= 1.0) {
+            _stepCarry -= 1.0;
+            int stepCount = appState.addStep();
+            counters.steps++;
+            int food = petStepFood(stepCount);
+            int energy = petStepEnergy(stepCount);
+            if (food || energy) appState.postUiEvent(UI_EVENT_STEP_REWARD, food, energy);
+        }
+
+        if (now - _lastWindow < APP_STEP_WINDOW_MS) return;
+        int stepCount = appState.getSteps();
+        if (stepCount < APP_STEP_WINDOW_MIN || !appClock->isSynced()) return;
+        _lastWindow = now;
+
+        SensorWindow window;
+        memset(&window, 0, sizeof(window));
+        window.stepCount = stepCount;
+        window.timestamp = (uint64_t)appClock->epoch() * 1000;
+        window.batteryPercent = 85;
+        if (appState.postSensorWindow(window)) {
+            counters.windows++;
+        } else {
+            counters.windowsDropped++;
+        }
+    }
+
+    // handleUiEvents() + the pet settle in uiTask()
+    void uiTask(uint32_t now) {
+        hostTask = "ui";
+        TRACE_SCOPE("ui");
+        UiEvent event;
+        while (appState.takeUiEvent(event)) {
+            if (event.type != UI_EVENT_STEP_REWARD) continue;
+            counters.rewardEvents++;
+            if (event.food > 0) pet.addFood(event.food);
+            if (event.energy > 0) pet.addEnergy(event.energy);
+        }
+
+        if (now - _lastSettle > APP_PET_SETTLE_MS) {
+            _lastSettle = now;
+            pet.update(now);
+        }
+    }
+
+    // submitStepsToOracle() + syncPetPeriodically() + journalState()
+    void netTask(uint32_t now) {
+        hostTask = "net";
+        TRACE_SCOPE("net");
+        SensorWindow window;
+        while (appState.takeSensorWindow(window)) {
+            stepBatch.addWindow(window.stepCount, window.timestamp, window.batteryPercent,
+                                window.samples, APP_WINDOW_SAMPLES);
+        }
+        if (stepBatch.shouldFlush(now)) {
+            stepBatch.beginSend();
+            stepBatch.completeSend();    // Server accepts at once
+            counters.batches++;
+        }
+
+        if (now - _lastSync > APP_PET_SYNC_MS) {
+            _lastSync = now;
+            if (pet.isDirty()) {
+                uint16_t fields = pet.beginSync();
+                counters.syncs++;
+                counters.syncFields += __builtin_popcount(fields);
+                pet.completeSync(++_syncVersion);
+            }
+        }
+
+        if (now - _lastJournal >= APP_JOURNAL_CHECK_MS) {
+            _lastJournal = now;
+            int steps = appState.getSteps();
+            if (journal.isDue(now, pet.getChangeCount(), steps)) {
+                PetState state;
+                pet.snapshot(state);
+                journal.save(now, pet.getChangeCount(), state, steps);
+            }
+        }
+    }
+
+    // Glances at the watch while awake: claim, feed, play (ui_handlers)
+    void owner(uint32_t now) {
+        if (now < _nextGlanceMs) return;
+        hostTask = "ui";
+        TRACE_INSTANT("glance");
+        std::exponential_distribution<double> gap(1.0 / (_config.glanceMin * 60000.0));
+        _nextGlanceMs = now + 1 + (uint64_t)gap(_rng);
+
+        float hour = secondOfDay() / 3600.0f;
+        if (!_sntpDone || hour < _config.wakeHour || hour >= _config.sleepHour) return;
+        counters.glances++;
+
+        int steps = appState.claimSteps(PET_RULES.claimMinSteps);
+        if (steps > 0) {
+            pet.addFood(petClaimFood(steps));
+            pet.addEnergy(petClaimEnergy(steps));
+            counters.claims++;
+        }
+        if (pet.getHunger() < 75 && pet.canFeed()) {
+            pet.feed();
+            counters.feeds++;
+        }
+        if (pet.getHappiness() < 85 && pet.canPlay()) {
+            pet.play();
+            counters.plays++;
+        }
+    }
+};
+
+// ============================================
+// Main
+// ============================================
+
+static void usage() {
+    printf("Usage: firmware_day [options]\n"
+           "  --days N          simulated days (default 1)\n"
+           "  --steps N         owner's daily steps (default 7000)\n"
+           "  --glance-min M    mean minutes between watch glances (default 30)\n"
+           "  --wake H          wake-up hour (default 7)\n"
+           "  --sleep H         bedtime hour (default 23)\n"
+           "  --seed N          RNG seed (default 1)\n"
+           "  --trace FILE      write the last %u trace events as Chrome Trace JSON\n"
+           "  --verbose         echo the firmware's serial log\n", TRACER_EVENTS);
+}
+
+static bool parseArgs(int argc, char** argv, HarnessConfig& config) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (strcmp(arg, "--verbose") == 0) {
+            config.verbose = true;
+            continue;
+        }
+        if (strcmp(arg, "--help") == 0 || i + 1 >= argc) return false;
+        const char* value = argv[++i];
+
+        if (strcmp(arg, "--days") == 0) config.days = strtoul(value, nullptr, 10);
+        else if (strcmp(arg, "--steps") == 0) config.dailySteps = strtoul(value, nullptr, 10);
+        else if (strcmp(arg, "--glance-min") == 0) config.glanceMin = strtof(value, nullptr);
+        else if (strcmp(arg, "--wake") == 0) config.wakeHour = strtof(value, nullptr);
+        else if (strcmp(arg, "--sleep") == 0) config.sleepHour = strtof(value, nullptr);
+        else if (strcmp(arg, "--seed") == 0) config.seed = strtoul(value, nullptr, 10);
+        else if (strcmp(arg, "--trace") == 0) config.tracePath = value;
+        else return false;
+    }
+    return config.days > 0 && config.glanceMin > 0;
+}
+
+int main(int argc, char** argv) {
+    HarnessConfig config;
+    if (!parseArgs(argc, argv, config)) {
+        usage();
+        return 1;
+    }
+
+    // Boot-relative wall clock until the simulated SNTP sync
+    VirtualClock clock(0);
+    appClock = &clock;
+    Serial.echo = config.verbose;
+    hostRng.seed(config.seed);
+
+    static TraceEvent traceEvents[TRACER_EVENTS];
+    if (config.tracePath) {
+        tracer.setTaskHooks(hostCurrentTask, hostTaskName);
+        tracer.begin(traceEvents, TRACER_EVENTS);
+    }
+
+    SimWatch watch(config, clock);
+    watch.boot();
+
+    // One row per hour for a single day, per day for longer runs
+    bool hourly = config.days == 1;
+    uint32_t rows = hourly ? 24 : config.days;
+    uint32_t ticksPerRow = (hourly ? 3600000u : 86400000u) / IMU_TICK_MS;
+    Counters rowStart;
+    uint32_t journalStart = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    printf("%4s %6s %6s %6s %5s %6s %6s %5s %7s %7s\n", hourly ? "hour" : "day",
+           "hunger", "happy", "health", "food", "energy", "steps", "syncs", "batches", "journal");
+
+    for (uint32_t row = 0; row < rows; row++) {
+        for (uint32_t i = 0; i < ticksPerRow; i++) {
+            watch.tick();
+            clock.advance(IMU_TICK_MS);
+        }
+
+        const Counters& c = watch.counters;
+        uint32_t journalWrites = watch.journal.stats().writes;
+        printf("%4u %6d %6d %6d %5d %6d %6u %5u %7u %7u\n", row,
+               watch.pet.getHunger(), watch.pet.getHappiness(), watch.pet.getHealth(),
+               watch.pet.getFood(), watch.pet.getEnergy(),
+               c.steps - rowStart.steps, c.syncs - rowStart.syncs,
+               c.batches - rowStart.batches, journalWrites - journalStart);
+        rowStart = c;
+        journalStart = journalWrites;
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const Counters& c = watch.counters;
+    const JournalStats& j = watch.journal.stats();
+    double days = config.days;
+
+    printf("\nSimulated %u day(s) in %.2f s (%.0fx real time)\n", config.days, seconds,
+           days * 86400.0 / (seconds > 0 ? seconds : 1e-9));
+    printf("Per day: %.0f steps, %.1f reward events, %.1f step windows (%.1f dropped), "
+           "%.1f step batches\n",
+           c.steps / days, c.rewardEvents / days, c.windows / days, c.windowsDropped / days,
+           c.batches / days);
+    printf("Per day: %.1f pet syncs (%.1f fields each), %.1f journal writes (%.0f NVS bytes), "
+           "%u queue drops\n",
+           c.syncs / days, c.syncs ? (double)c.syncFields / c.syncs : 0.0, j.writes / days,
+           Preferences::stats().bytesWritten / days, (unsigned)watch.appState.getDroppedMessages());
+    printf("Per day: %.1f glances, %.1f claims, %.1f feeds, %.1f plays\n",
+           c.glances / days, c.claims / days, c.feeds / days, c.plays / days);
+    printf("End: level %d, XP %d, fed steps %lu, food %d, energy %d\n",
+           watch.pet.getLevel(), watch.pet.getExperience(), watch.pet.getTotalStepsFed(),
+           watch.pet.getFood(), watch.pet.getEnergy());
+
+    if (config.tracePath) {
+        FILE* f = fopen(config.tracePath, "w");
+        if (!f) {
+            printf("✗ Cannot write %s\n", config.tracePath);
+            return 1;
+        }
+        TracerStats t = tracer.stats();
+        uint32_t written = tracer.dump(traceWriteFile, f);
+        fclose(f);
+        printf("Trace: %u of %u events to %s (open in ui.perfetto.dev)\n",
+               written, t.recorded, config.tracePath);
+    }
+    return 0;
+}
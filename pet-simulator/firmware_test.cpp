@@ -0,0 +1,525 @@
+/**
+ * Firmware Tests
+ * Checks on the watch's non-hardware logic, compiled from sui_watch/
+ * unchanged against the host/ stand-ins (as firmware_day is). Each case
+ * builds its own VirtualClock and objects and stops at its first failed
+ * check; `make test` runs every case and fails if any did.
+ */
+
+#include "Clock.h"
+#include "LinkMonitor.h"
+#include "OracleEndpoints.h"
+#include "PetRules.h"
+#include "StateJournal.h"
+#include "StepBatch.h"
+#include "VirtualPet.h"
+
+#include <Preferences.h>
+#include <rom/crc.h>
+
+// ============================================
+// Host Glue
+// ============================================
+
+Print Serial;
+Clock* appClock = nullptr;
+
+long random(long max) {
+    return max > 0 ? rand() % max : 0;
+}
+
+// Endpoint probes take virtual time: the clock in use is always a VirtualClock
+void hostNetworkDelay(uint32_t ms) {
+    static_cast<VirtualClock*>(appClock)->advance(ms);
+}
+
+#define SIM_EPOCH 1704067200u          // 2024-01-01 00:00 UTC
+
+// Shared with the server's tests (tests/merkle.test.mjs)
+#define MERKLE_VECTOR "../trust-oracle-server/tests/step-batch-merkle.txt"
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            printf("  ✗ %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+            failures++; \
+            return; \
+        } \
+    } while (0)
+
+// A pet born on a synced clock with everything acknowledged
+static void cleanPet(VirtualPet& pet) {
+    pet.beginSync();
+    pet.completeSync(1);
+}
+
+// Nothing in flash from an earlier case
+static void clearJournal() {
+    Preferences prefs;
+    prefs.begin("journal", false);
+    prefs.remove(JOURNAL_KEY);
+    for (char slot = '0'; slot < '0' + JOURNAL_LEGACY_SLOTS; slot++) {
+        char key[3] = { 'r', slot, '\0' };
+        prefs.remove(key);
+    }
+    prefs.end();
+}
+
+// What TrustOracleClient::applyPetPush does with one field
+static bool pushField(VirtualPet& pet, uint64_t objectVersion, const char* name, long value) {
+    return pet.acceptServerPush(objectVersion) && pet.applyServerField(name, value);
+}
+
+// ============================================
+// Server Pushes
+// ============================================
+
+static void testPushAppliesToCleanField() {
+    VirtualClock clock(SIM_EPOCH);
+    appClock = &clock;
+    VirtualPet pet;
+    cleanPet(pet);
+
+    CHECK(pushField(pet, 100, "food", 42));
+    CHECK(pet.getFood() == 42);
+    CHECK(pet.getDirtyFields() == 0);
+}
+
+static void testPendingChangeSurvivesStalePush() {
+    VirtualClock clock(SIM_EPOCH);
+    appClock = &clock;
+    VirtualPet pet;
+    cleanPet(pet);
+
+    CHECK(pushField(pet, 100, "hunger", 40));
+    clock.advance((PET_RULES.levels[LEVEL_EGG].feedCooldownSec + 1) * 1000);
+    pet.feed();
+    int hunger = pet.getHunger();
+    int food = pet.getFood();
+    CHECK(pet.getDirtyFields() & PET_SYNC_HUNGER);
+
+    // Older snapshot than the one applied: dropped whole
+    CHECK(!pet.acceptServerPush(99));
+
+    // Newer snapshot: the unsynced meal keeps its fields and dirty bits
+    CHECK(pet.acceptServerPush(101));
+    CHECK(!pet.applyServerField("hunger", 10));
+    CHECK(!pet.applyServerField("food", 0));
+    CHECK(pet.getHunger() == hunger);
+    CHECK(pet.getFood() == food);
+    CHECK(pet.getDirtyFields() & PET_SYNC_HUNGER);
+    CHECK(pet.getDirtyFields() & PET_SYNC_FOOD);
+}
+
+static void testInflightChangeSurvivesPush() {
+    VirtualClock clock(SIM_EPOCH);
+    appClock = &clock;
+    VirtualPet pet;
+    cleanPet(pet);
+
+    pet.addFood(3);
+    int food = pet.getFood();
+    CHECK(pet.beginSync() & PET_SYNC_FOOD);
+
+    // Sent but not acknowledged yet
+    CHECK(!pushField(pet, 200, "food", 1));
+    CHECK(pet.getFood() == food);
+
+    // Lost with the link: resent on the next sync
+    pet.failSync();
+    CHECK(pet.getDirtyFields() & PET_SYNC_FOOD);
+}
+
+static void testUnversionedPushIsTaken() {
+    VirtualClock clock(SIM_EPOCH);
+    appClock = &clock;
+    VirtualPet pet;
+    cleanPet(pet);
+
+    CHECK(pet.acceptServerPush(300));
+    CHECK(pet.acceptServerPush(0));
+    CHECK(!pet.acceptServerPush(300));
+}
+
+// ============================================
+// Restore Before the Clock Is Set
+// ============================================
+
+// The journal holds wall-clock anchors; after a reboot the pet is restored
+// before SNTP answers, while epoch() still counts from boot
+static void testRestoreOnUnsyncedClock() {
+    uint32_t feedCooldown = PET_RULES.levels[LEVEL_EGG].feedCooldownSec;
+    uint32_t playCooldown = PET_RULES.levels[LEVEL_EGG].playCooldownSec;
+
+    VirtualClock before(SIM_EPOCH);
+    appClock = &before;
+    VirtualPet pet;
+    pet.addFood(5);
+    pet.addEnergy(5);
+    before.advance((feedCooldown > playCooldown ? feedCooldown : playCooldown) * 1000 + 1000);
+    pet.feed();
+    pet.play();
+    uint32_t actedAt = before.epoch();
+
+    // Mid-range stats, so only the time since the last play decides the mood
+    cleanPet(pet);
+    CHECK(pet.applyServerField("happiness", 50));
+    CHECK(pet.applyServerField("hunger", 60));
+
+    PetState state;
+    pet.snapshot(state);
+    clearJournal();
+    StateJournal journal;
+    CHECK(journal.save(before.millis(), pet.getChangeCount(), state, 0));
+
+    VirtualClock after(0);
+    appClock = &after;
+    after.advance(5000);
+    StateJournal rebooted;
+    JournalRecord saved;
+    CHECK(rebooted.begin(saved));
+    VirtualPet restored;
+    restored.restore(saved.pet);      // What init() does without an RTC copy
+
+    // Nothing is known to have passed since the meal and the game
+    CHECK(!appClock->isSynced());
+    CHECK(!restored.canFeed());
+    CHECK(!restored.canPlay());
+    CHECK(restored.getMood() == MOOD_NORMAL);
+    CHECK(restored.getHappiness() == 50);
+
+    // SNTP answers: the cooldowns run from the saved times
+    after.setEpoch(actedAt + feedCooldown - 1);
+    CHECK(!restored.canFeed());
+    after.setEpoch(actedAt + feedCooldown);
+    CHECK(restored.canFeed());
+    after.setEpoch(actedAt + playCooldown);
+    CHECK(restored.canPlay());
+}
+
+// ============================================
+// State Journal
+// ============================================
+
+// One key, rewritten only when the pet or the steps differ from flash
+static void testJournalSingleKey() {
+    VirtualClock clock(SIM_EPOCH);
+    appClock = &clock;
+    clearJournal();
+    VirtualPet pet;
+    PetState state;
+    pet.snapshot(state);
+
+    StateJournal journal;
+    CHECK(journal.save(clock.millis(), 1, state, 10));
+    clock.advance(JOURNAL_STEPS_INTERVAL_MS);
+    CHECK(journal.isDue(clock.millis(), 2, 10));
+    CHECK(journal.save(clock.millis(), 2, state, 10));
+    CHECK(journal.stats().writes == 1 && journal.stats().unchanged == 1);
+    CHECK(!journal.isDue(clock.millis(), 2, 10));
+
+    CHECK(journal.save(clock.millis(), 2, state, 11));
+    CHECK(journal.stats().writes == 2);
+
+    StateJournal rebooted;
+    JournalRecord saved;
+    CHECK(rebooted.begin(saved));
+    CHECK(saved.seq == 2 && saved.steps == 11);
+}
+
+// Records of the firmware that rotated over r0..r7 are read, then erased
+static void testJournalLegacySlots() {
+    VirtualClock clock(SIM_EPOCH);
+    appClock = &clock;
+    clearJournal();
+    VirtualPet pet;
+
+    Preferences prefs;
+    prefs.begin("journal", false);
+    for (uint32_t seq = 5; seq <= 7; seq++) {
+        JournalRecord record;
+        memset(&record, 0, sizeof(record));
+        record.version = JOURNAL_VERSION;
+        record.size = sizeof(record);
+        record.seq = seq;
+        pet.snapshot(record.pet);
+        record.steps = seq * 100;
+        record.crc = crc32_le(0, (const uint8_t*)&record, offsetof(JournalRecord, crc));
+        char key[3] = { 'r', (char)('0' + seq % JOURNAL_LEGACY_SLOTS), '\0' };
+        prefs.putBytes(key, &record, sizeof(record));
+    }
+    prefs.end();
+
+    StateJournal journal;
+    JournalRecord saved;
+    CHECK(journal.begin(saved));
+    CHECK(saved.seq == 7 && saved.steps == 700);
+
+    CHECK(journal.save(clock.millis(), 1, saved.pet, 701));
+    prefs.begin("journal", true);
+    JournalRecord old;
+    CHECK(prefs.getBytes("r7", &old, sizeof(old)) == 0);
+    prefs.end();
+
+    StateJournal rebooted;
+    CHECK(rebooted.begin(saved));
+    CHECK(saved.seq == 8 && saved.steps == 701);
+}
+
+// ============================================
+// Step Batch Merkle Root
+// ============================================
+
+static bool parseHex(const char* hex, uint8_t* out, size_t max, size_t& len) {
+    len = 0;
+    if (strcmp(hex, "-") == 0) return true;
+    size_t digits = strlen(hex);
+    if (digits % 2 != 0 || digits / 2 > max) return false;
+    for (size_t i = 0; i < digits; i += 2) {
+        unsigned int byte;
+        if (sscanf(hex + i, "%2x", &byte) != 1) return false;
+        out[len++] = (uint8_t)byte;
+    }
+    return true;
+}
+
+static void testMerkleVector() {
+    VirtualClock clock(SIM_EPOCH);
+    appClock = &clock;
+
+    FILE* file = fopen(MERKLE_VECTOR, "r");
+    CHECK(file != nullptr);
+
+    StepBatch batch;
+    int roots = 0;
+    char line[512];
+    while (fgets(line, sizeof(line), file)) {
+        char hex[256];
+        unsigned long stepCount;
+        unsigned long long timestamp;
+        unsigned int battery;
+        int count;
+
+        if (sscanf(line, "window %lu %llu %u %255s", &stepCount, &timestamp, &battery, hex) == 4) {
+            // Samples go in as g, the way the sensor task hands them over
+            uint8_t bytes[STEP_BATCH_SAMPLES * 6];
+            size_t len;
+            CHECK(parseHex(hex, bytes, sizeof(bytes), len) && len % 6 == 0);
+            float samples[STEP_BATCH_SAMPLES][3];
+            for (size_t i = 0; i < len / 2; i++) {
+                int16_t milli = (int16_t)(bytes[i * 2] | bytes[i * 2 + 1] << 8);
+                samples[i / 3][i % 3] = milli / 1000.0f;
+            }
+            batch.addWindow(stepCount, timestamp, battery, samples, len / 6);
+        } else if (sscanf(line, "root %d %255s", &count, hex) == 2) {
+            uint8_t expected[32];
+            size_t len;
+            CHECK(parseHex(hex, expected, sizeof(expected), len) && len == 32);
+            CHECK(count >= 1 && count <= batch.count());
+            uint8_t root[32];
+            batch.computeRoot(count, root);
+            if (memcmp(root, expected, 32) != 0) {
+                printf("  root of %d windows differs from the vector\n", count);
+            }
+            CHECK(memcmp(root, expected, 32) == 0);
+            roots++;
+        }
+    }
+    fclose(file);
+    CHECK(roots > 0 && roots == batch.count());
+}
+
+// ============================================
+// Oracle Endpoints (failover)
+// ============================================
+
+// Fresh NVS list and network; nullptr list: nothing stored
+static void endpointSetup(const char* list, std::map<std::string, HostLink> links) {
+    Preferences prefs;
+    prefs.begin("oracle", false);
+    prefs.remove("endpoints");
+    prefs.end();
+    if (list) OracleEndpoints::store(list);
+    hostLinks() = links;
+}
+
+// Cooldown after the n-th consecutive failure
+static uint32_t endpointCooldown(uint32_t failures) {
+    uint32_t cooldown = ORACLE_COOLDOWN_MIN_MS;
+    for (uint32_t i = 1; i < failures; i++) cooldown *= 2;
+    return cooldown < ORACLE_COOLDOWN_MAX_MS ? cooldown : ORACLE_COOLDOWN_MAX_MS;
+}
+
+static void testEndpointList() {
+    VirtualClock clock(SIM_EPOCH);
+    appClock = &clock;
+    OracleEndpoints endpoints;
+
+    endpointSetup(nullptr, {});
+    endpoints.load("fallback.local", 8080);
+    CHECK(endpoints.count() == 1);
+    CHECK(strcmp(endpoints.get(0).host, "fallback.local") == 0 && endpoints.get(0).port == 8080);
+
+    // Bad entries are skipped, the list stops at ORACLE_MAX_ENDPOINTS
+    CHECK(!OracleEndpoints::store("no-port,also bad"));
+    endpointSetup("a:1,bad,b:0,c:3,d:4,e:5,f:6", {});
+    endpoints.load("fallback.local", 8080);
+    CHECK(endpoints.count() == ORACLE_MAX_ENDPOINTS);
+    CHECK(strcmp(endpoints.get(0).host, "a") == 0 && endpoints.get(0).port == 1);
+    CHECK(strcmp(endpoints.get(1).host, "c") == 0);
+    CHECK(strcmp(endpoints.get(3).host, "e") == 0);
+}
+
+static void testEndpointPicksFastest() {
+    VirtualClock clock(SIM_EPOCH);
+    appClock = &clock;
+    OracleEndpoints endpoints;
+
+    endpointSetup("slow:1,down:2,fast:3", {
+        { "slow:1", { true, 180 } },
+        { "down:2", { false, 0 } },
+        { "fast:3", { true, 25 } },
+    });
+    endpoints.load("fallback.local", 8080);
+
+    // Unprobed: the first entry
+    CHECK(endpoints.select(clock.millis()) == 0);
+
+    endpoints.startProbe();
+    CHECK(!endpoints.isProbing());
+    CHECK(endpoints.get(2).reachable && endpoints.get(2).probeMs == 25);
+    CHECK(!endpoints.get(1).reachable);
+    CHECK(endpoints.select(clock.millis()) == 2);
+}
+
+// TrustOracleClient::loop() and failover() after a reconnect fails, timed
+// on the virtual clock
+static void testEndpointFailover() {
+    VirtualClock clock(SIM_EPOCH);
+    appClock = &clock;
+    OracleEndpoints endpoints;
+
+    endpointSetup("a:1,b:2", {
+        { "a:1", { true, 20 } },
+        { "b:2", { true, 60 } },
+    });
+    LinkMonitor link;
+    endpoints.load("fallback.local", 8080);
+    endpoints.startProbe();
+    endpoints.setCurrent(endpoints.select(clock.millis()));
+    CHECK(endpoints.current() == 0);
+    link.onConnected(clock.millis());
+    endpoints.recordSession(40);
+
+    // The server dies: once the first retry window runs out offline, the
+    // same loop pass moves the watch to the other
+    hostLinks()["a:1"].up = false;
+    endpoints.recordDrop();
+    uint32_t droppedAt = clock.millis();
+    clock.advance(link.onDisconnected(droppedAt) + 1);
+    uint32_t failedAt = clock.millis();
+    CHECK(link.checkReconnect(failedAt) != 0);
+    endpoints.recordFailure(failedAt);
+    CHECK(endpoints.shouldFailover(clock.millis()));
+    endpoints.setCurrent(endpoints.select(clock.millis()));
+    endpoints.countFailover();
+    uint32_t switchedAt = clock.millis();
+    endpoints.startProbe();
+    CHECK(endpoints.current() == 1);
+    CHECK(endpoints.getFailovers() == 1);
+    printf("    failover %lu ms after the failed reconnect, %lu ms after the drop (virtual)\n",
+           (unsigned long)(switchedAt - failedAt), (unsigned long)(switchedAt - droppedAt));
+    CHECK(switchedAt - failedAt == 0);
+    CHECK(switchedAt - droppedAt <= LINK_BACKOFF_MIN_MS + 1);
+
+    // Past its cooldown the dead server still ranks behind the live one
+    clock.advance(endpointCooldown(1));
+    CHECK(endpoints.select(clock.millis()) == 1);
+
+    // Back up and probed again: the faster one wins the next choice
+    hostLinks()["a:1"].up = true;
+    endpoints.startProbe();
+    CHECK(endpoints.select(clock.millis()) == 0);
+
+    // A single endpoint never fails over
+    endpointSetup("only:1", {});
+    endpoints.load("fallback.local", 8080);
+    endpoints.recordFailure(clock.millis());
+    CHECK(!endpoints.shouldFailover(clock.millis()));
+}
+
+static void testEndpointCooldown() {
+    VirtualClock clock(SIM_EPOCH);
+    appClock = &clock;
+    OracleEndpoints endpoints;
+
+    endpointSetup("fast:1,slow:2", {
+        { "fast:1", { true, 10 } },
+        { "slow:2", { true, 90 } },
+    });
+    endpoints.load("fallback.local", 8080);
+    endpoints.startProbe();
+    endpoints.setCurrent(0);
+
+    // Doubles from ORACLE_COOLDOWN_MIN_MS up to ORACLE_COOLDOWN_MAX_MS
+    for (uint32_t failures = 1; failures <= 10; failures++) {
+        uint32_t failedAt = clock.millis();
+        endpoints.recordFailure(failedAt);
+        uint32_t cooldown = endpointCooldown(failures);
+        CHECK(endpoints.select(failedAt + cooldown - 1) == 1);
+        CHECK(endpoints.select(failedAt + cooldown) == 0);
+        clock.advance(cooldown);
+    }
+    CHECK(endpointCooldown(10) == ORACLE_COOLDOWN_MAX_MS);
+
+    // A session clears the streak
+    endpoints.recordSession(30);
+    endpoints.recordFailure(clock.millis());
+    CHECK(endpoints.select(clock.millis() + ORACLE_COOLDOWN_MIN_MS) == 0);
+
+    // Everything cooling down: the one that failed longest ago
+    endpoints.setCurrent(1);
+    clock.advance(1000);
+    endpoints.recordFailure(clock.millis());
+    CHECK(endpoints.select(clock.millis()) == 0);
+}
+
+// ============================================
+// Runner
+// ============================================
+
+struct TestCase {
+    const char* name;
+    void (*run)();
+};
+
+static const TestCase TESTS[] = {
+    { "push applies to a clean field", testPushAppliesToCleanField },
+    { "pending change survives a stale push", testPendingChangeSurvivesStalePush },
+    { "in-flight change survives a push", testInflightChangeSurvivesPush },
+    { "unversioned push is taken", testUnversionedPushIsTaken },
+    { "restore before the clock is set", testRestoreOnUnsyncedClock },
+    { "journal rewrites one key, only on change", testJournalSingleKey },
+    { "journal takes over the old slot keys", testJournalLegacySlots },
+    { "step batch roots match the shared vector", testMerkleVector },
+    { "endpoint list from flash", testEndpointList },
+    { "endpoint probe picks the fastest", testEndpointPicksFastest },
+    { "endpoint failover after a failed reconnect", testEndpointFailover },
+    { "endpoint cooldown doubles up to the cap", testEndpointCooldown },
+};
+
+int main() {
+    int failed = 0;
+    for (const TestCase& test : TESTS) {
+        int before = failures;
+        test.run();
+        bool ok = failures == before;
+        printf("%s %s\n", ok ? "✓" : "✗", test.name);
+        if (!ok) failed++;
+    }
+
+    size_t count = sizeof(TESTS) / sizeof(TESTS[0]);
+    printf("\n%zu tests, %d failed\n", count, failed);
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,73 @@
+/**
+ * Host stand-in for the parts of Arduino.h the simulated firmware uses.
+ * There is deliberately no millis(): firmware logic must go through
+ * appClock (Clock.h), and a direct call fails to compile here.
+ */
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+
+#include "freertos/task.h"
+
+using std::min;
+using std::max;
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define RTC_NOINIT_ATTR
+
+// Serial output is dropped unless echo is on (--verbose)
+class Print {
+public:
+    bool echo = false;
+
+    size_t write(const char* text, size_t len) {
+        if (echo) fwrite(text, 1, len, stdout);
+        return len;
+    }
+    size_t print(const char* text) { return write(text, strlen(text)); }
+    size_t print(char c) { return write(&c, 1); }
+    size_t println(const char* text = "") { return print(text) + print('\n'); }
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+        char buf[256];
+        va_list args;
+        va_start(args, format);
+        int len = vsnprintf(buf, sizeof(buf), format, args);
+        va_end(args);
+        if (len < 0) return 0;
+        return write(buf, std::min((size_t)len, sizeof(buf) - 1));
+    }
+};
+
+extern Print Serial;
+
+// Enough of Arduino's String for the NVS getters
+class String {
+public:
+    String(const char* text = "") : _text(text ? text : "") {}
+    size_t length() const { return _text.size(); }
+    const char* c_str() const { return _text.c_str(); }
+    bool operator==(const char* text) const { return _text == text; }
+    bool operator!=(const char* text) const { return _text != text; }
+
+private:
+    std::string _text;
+};
+
+long random(long max);
+
+// FreeRTOS critical sections (single-threaded host)
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(lock) ((void)(lock))
+#define portEXIT_CRITICAL(lock) ((void)(lock))
+
+#endif
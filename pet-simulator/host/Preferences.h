@@ -0,0 +1,76 @@
+/**
+ * Host stand-in for the NVS Preferences API: an in-memory store that
+ * counts writes, so a run can report flash traffic
+ */
+
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+#include <Arduino.h>
+#include <map>
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include <string.h>
+
+struct HostNvsStats {
+    uint32_t writes;
+    uint64_t bytesWritten;
+};
+
+class Preferences {
+public:
+    bool begin(const char* name, bool readOnly = false) {
+        _namespace = name;
+        _readOnly = readOnly;
+        return true;
+    }
+    void end() {}
+
+    size_t getBytes(const char* key, void* buf, size_t maxLen) {
+        auto it = store().find(_namespace + "/" + key);
+        if (it == store().end() || it->second.size() > maxLen) return 0;
+        memcpy(buf, it->second.data(), it->second.size());
+        return it->second.size();
+    }
+
+    size_t putBytes(const char* key, const void* value, size_t len) {
+        if (_readOnly) return 0;
+        const uint8_t* bytes = (const uint8_t*)value;
+        store()[_namespace + "/" + key].assign(bytes, bytes + len);
+        stats().writes++;
+        stats().bytesWritten += len;
+        return len;
+    }
+
+    String getString(const char* key, const char* defaultValue = "") {
+        auto it = store().find(_namespace + "/" + key);
+        if (it == store().end()) return String(defaultValue);
+        return String(std::string(it->second.begin(), it->second.end()).c_str());
+    }
+
+    size_t putString(const char* key, const char* value) {
+        return putBytes(key, value, strlen(value));
+    }
+
+    bool remove(const char* key) {
+        if (_readOnly) return false;
+        return store().erase(_namespace + "/" + key) > 0;
+    }
+
+    static HostNvsStats& stats() {
+        static HostNvsStats s = {};
+        return s;
+    }
+
+private:
+    std::string _namespace;
+    bool _readOnly = true;
+
+    static std::map<std::string, std::vector<uint8_t>>& store() {
+        static std::map<std::string, std::vector<uint8_t>> s;
+        return s;
+    }
+};
+
+#endif
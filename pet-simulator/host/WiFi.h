@@ -0,0 +1,100 @@
+/**
+ * Host stand-in for WiFi.h: WiFiClient connects against a scripted
+ * network. hostLinks() maps "host:port" to whether it answers and how
+ * long the TCP handshake takes; anything not listed times out.
+ *
+ * HOST_WIFI_SOCKETS 1 (failover_client): WiFiClient makes real TCP
+ * connects instead, so the firmware probes servers on this machine.
+ */
+
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include <Arduino.h>
+
+#ifndef HOST_WIFI_SOCKETS
+#define HOST_WIFI_SOCKETS 0
+#endif
+
+#if HOST_WIFI_SOCKETS
+
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+class WiFiClient {
+public:
+    bool connect(const char* host, uint16_t port, int32_t timeoutMs) {
+        stop();
+        addrinfo hints = {};
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+        addrinfo* addr = nullptr;
+        if (getaddrinfo(host, std::to_string(port).c_str(), &hints, &addr) != 0) return false;
+
+        _fd = socket(addr->ai_family, addr->ai_socktype, addr->ai_protocol);
+        bool connected = false;
+        if (_fd >= 0) {
+            fcntl(_fd, F_SETFL, fcntl(_fd, F_GETFL) | O_NONBLOCK);
+            if (::connect(_fd, addr->ai_addr, addr->ai_addrlen) == 0) {
+                connected = true;
+            } else if (errno == EINPROGRESS) {
+                pollfd pfd = { _fd, POLLOUT, 0 };
+                int error = 0;
+                socklen_t len = sizeof(error);
+                connected = poll(&pfd, 1, timeoutMs) == 1 &&
+                            getsockopt(_fd, SOL_SOCKET, SO_ERROR, &error, &len) == 0 && error == 0;
+            }
+        }
+        freeaddrinfo(addr);
+        if (!connected) stop();
+        return connected;
+    }
+    void stop() {
+        if (_fd >= 0) close(_fd);
+        _fd = -1;
+    }
+    ~WiFiClient() { stop(); }
+
+private:
+    int _fd = -1;
+};
+
+#else
+
+#include <map>
+#include <string>
+
+struct HostLink {
+    bool up;
+    uint32_t handshakeMs;
+};
+
+inline std::map<std::string, HostLink>& hostLinks() {
+    static std::map<std::string, HostLink> links;
+    return links;
+}
+
+// Defined by the harness: a connect attempt took this long (moves its clock)
+void hostNetworkDelay(uint32_t ms);
+
+class WiFiClient {
+public:
+    bool connect(const char* host, uint16_t port, int32_t timeoutMs) {
+        auto it = hostLinks().find(std::string(host) + ":" + std::to_string(port));
+        if (it == hostLinks().end() || !it->second.up) {
+            hostNetworkDelay(timeoutMs);
+            return false;
+        }
+        hostNetworkDelay(it->second.handshakeMs);
+        return true;
+    }
+    void stop() {}
+};
+
+#endif
+
+#endif
@@ -0,0 +1,46 @@
+/**
+ * Host stand-in for FreeRTOS queues (single-threaded, copy semantics)
+ */
+
+#ifndef HOST_FREERTOS_QUEUE_H
+#define HOST_FREERTOS_QUEUE_H
+
+#include <deque>
+#include <vector>
+#include <stdint.h>
+#include <string.h>
+
+#define pdTRUE  1
+#define pdFALSE 0
+#define portMAX_DELAY 0xFFFFFFFFu
+
+typedef int BaseType_t;
+typedef uint32_t TickType_t;
+
+struct HostQueue {
+    size_t depth;
+    size_t itemSize;
+    std::deque<std::vector<uint8_t>> items;
+};
+
+typedef HostQueue* QueueHandle_t;
+
+inline QueueHandle_t xQueueCreate(size_t depth, size_t itemSize) {
+    return new HostQueue{ depth, itemSize, {} };
+}
+
+inline BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t) {
+    if (queue->items.size() >= queue->depth) return pdFALSE;
+    const uint8_t* bytes = (const uint8_t*)item;
+    queue->items.emplace_back(bytes, bytes + queue->itemSize);
+    return pdTRUE;
+}
+
+inline BaseType_t xQueueReceive(QueueHandle_t queue, void* out, TickType_t) {
+    if (queue->items.empty()) return pdFALSE;
+    memcpy(out, queue->items.front().data(), queue->itemSize);
+    queue->items.pop_front();
+    return pdTRUE;
+}
+
+#endif
@@ -0,0 +1,27 @@
+/**
+ * Host stand-in for FreeRTOS tasks: a created task runs to completion
+ * inside xTaskCreatePinnedToCore, which suits the firmware's one-shot
+ * workers (endpoint probe) and keeps host runs deterministic
+ */
+
+#ifndef HOST_FREERTOS_TASK_H
+#define HOST_FREERTOS_TASK_H
+
+#include <stdint.h>
+
+#define pdPASS 1
+
+typedef int BaseType_t;
+typedef void* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char*, uint32_t, void* arg,
+                                          unsigned, TaskHandle_t* handle, int) {
+    if (handle) *handle = nullptr;
+    task(arg);
+    return pdPASS;
+}
+
+inline void vTaskDelete(TaskHandle_t) {}
+
+#endif
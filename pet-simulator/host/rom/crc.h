@@ -0,0 +1,20 @@
+/**
+ * Host stand-in for the ESP32 ROM CRC32 (same polynomial and conventions)
+ */
+
+#ifndef HOST_ROM_CRC_H
+#define HOST_ROM_CRC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+inline uint32_t crc32_le(uint32_t crc, const uint8_t* buf, size_t len) {
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= buf[i];
+        for (int bit = 0; bit < 8; bit++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+
+#endif
@@ -0,0 +1,543 @@
+/**
+ * Pet Economy Simulator
+ * Runs simulated owners and their pets against the firmware's balancing
+ * rules (sui_watch/PetRules.h) on a virtual clock, in parallel across
+ * cores, and reports how fast pets evolve and where food, energy and the
+ * pet's stats settle. Meant for tuning the rule table before it goes
+ * near a watch.
+ *
+ * Each pet gets one owner profile (daily step target) and its own RNG,
+ * seeded from --seed and the pet's index, so results do not depend on the
+ * thread count. A day is: owner wakes, walks through the day following
+ * the profile's hourly shape, glances at the watch now and then (claim
+ * steps, feed, play when allowed), and sleeps while the pet keeps
+ * decaying. Stats are sampled every hour around the clock.
+ */
+
+#include "PetRules.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+static const char* const LEVEL_NAMES[PET_LEVEL_COUNT] = {
+    "egg", "baby", "teen", "adult", "master"
+};
+
+// ============================================
+// Owner Profiles
+// ============================================
+
+struct StepProfile {
+    const char* name;
+    uint32_t dailySteps;              // Mean; each day is drawn around it
+    float hourWeights[24];            // Shape of a day (relative)
+};
+
+static const StepProfile PROFILES[] = {
+    { "sedentary", 3000,
+      { 0,0,0,0,0,0,0, 3,5,3,2,2,5,3,2,2,3,5,4,3,2,1,0,0 } },
+    { "average", 7000,
+      { 0,0,0,0,0,0,0, 4,8,4,3,3,7,4,3,3,4,8,6,4,3,2,0,0 } },
+    { "active", 11000,
+      { 0,0,0,0,0,0,2, 8,8,4,3,3,7,4,3,3,4,8,9,6,3,2,0,0 } },
+    { "athlete", 16000,
+      { 0,0,0,0,0,0,12,10,6,3,3,3,6,3,3,3,4,6,12,8,3,2,0,0 } },
+};
+
+#define PROFILE_COUNT (sizeof(PROFILES) / sizeof(PROFILES[0]))
+
+struct SimConfig {
+    uint32_t pets = 10000;
+    uint32_t days = 365;
+    uint32_t threads = 0;             // 0 = one per core
+    uint64_t seed = 1;
+    int profile = -1;                 // -1 = spread pets over all profiles
+    float wakeHour = 7.0f;
+    float sleepHour = 23.0f;
+    float glanceMin = 30.0f;          // Mean minutes between watch glances
+    int feedBelow = 75;               // Owner feeds when hunger is below this
+    int playBelow = 85;               // ... plays when happiness is below this
+    float claimChance = 0.5f;         // Per glance, when enough steps are counted
+};
+
+// ============================================
+// Pet Model (VirtualPet's state, minus sync and UI)
+// ============================================
+
+#define SIM_EPOCH 1704067200u         // 2024-01-01 00:00 UTC, day 0
+
+struct SimPet {
+    uint8_t level;
+    int happiness, hunger, health;
+    uint32_t happinessAt, hungerAt, healthAt;
+    uint32_t lastFedAt, lastPlayAt;
+    uint32_t experience;
+    uint32_t totalStepsFed;
+    int food, energy;
+};
+
+static void petBorn(SimPet& p, uint32_t t) {
+    p.level = 0;
+    p.happiness = 50;
+    p.hunger = 50;
+    p.health = 100;
+    p.happinessAt = p.hungerAt = p.healthAt = t;
+    p.lastFedAt = p.lastPlayAt = t;
+    p.experience = 0;
+    p.totalStepsFed = 0;
+    p.food = 5;
+    p.energy = 5;
+}
+
+static int hungerNow(const SimPet& p, uint32_t t) {
+    return petHungerAt(p.hunger, p.hungerAt, t);
+}
+
+static int happinessNow(const SimPet& p, uint32_t t) {
+    return petHappinessAt(p.happiness, p.happinessAt, t);
+}
+
+static int healthNow(const SimPet& p, uint32_t t) {
+    return petHealthAt(p.health, p.healthAt, p.hunger, p.hungerAt, p.happiness, p.happinessAt, t);
+}
+
+// Settle, cooldowns and effects are PetRules.h's, as on the watch
+static bool feed(SimPet& p, uint32_t t) {
+    if (!petFeed(p, t)) return false;
+    petEvolve(p, t);
+    return true;
+}
+
+// ============================================
+// Statistics
+// ============================================
+
+struct Histogram {
+    std::vector<uint64_t> bins;       // Last bin collects everything above
+    uint64_t count = 0;
+
+    explicit Histogram(size_t size = 0) : bins(size, 0) {}
+
+    void add(uint32_t value) {
+        bins[std::min<size_t>(value, bins.size() - 1)]++;
+        count++;
+    }
+
+    void merge(const Histogram& other) {
+        for (size_t i = 0; i < bins.size(); i++) bins[i] += other.bins[i];
+        count += other.count;
+    }
+
+    uint32_t percentile(double p) const {
+        if (count == 0) return 0;
+        uint64_t target = (uint64_t)std::ceil(p * count);
+        uint64_t seen = 0;
+        for (size_t i = 0; i < bins.size(); i++) {
+            seen += bins[i];
+            if (seen >= target && seen > 0) return (uint32_t)i;
+        }
+        return (uint32_t)bins.size() - 1;
+    }
+};
+
+struct ProfileStats {
+    uint64_t pets = 0;
+    uint64_t petDays = 0;
+    uint64_t hours = 0;
+    uint64_t attentionHours = 0;
+    uint64_t zeroHealthHours = 0;
+    uint64_t steps = 0;
+    uint64_t feeds = 0;
+    uint64_t plays = 0;
+    uint64_t claims = 0;
+    uint64_t foodEarned = 0;
+    uint64_t energyEarned = 0;
+    uint64_t resourcesCapped = 0;
+    uint64_t neverReached[PET_LEVEL_COUNT] = {};
+    Histogram levelDay[PET_LEVEL_COUNT];
+    Histogram food, energy;           // At the end of each day
+    Histogram health, hunger, happiness;  // Every hour
+
+    explicit ProfileStats(uint32_t days)
+        : food(PET_RULES.resourceMax + 1), energy(PET_RULES.resourceMax + 1),
+          health(101), hunger(101), happiness(101) {
+        for (auto& h : levelDay) h = Histogram(days + 1);
+    }
+
+    void merge(const ProfileStats& o) {
+        pets += o.pets;
+        petDays += o.petDays;
+        hours += o.hours;
+        attentionHours += o.attentionHours;
+        zeroHealthHours += o.zeroHealthHours;
+        steps += o.steps;
+        feeds += o.feeds;
+        plays += o.plays;
+        claims += o.claims;
+        foodEarned += o.foodEarned;
+        energyEarned += o.energyEarned;
+        resourcesCapped += o.resourcesCapped;
+        for (int i = 0; i < PET_LEVEL_COUNT; i++) {
+            neverReached[i] += o.neverReached[i];
+            levelDay[i].merge(o.levelDay[i]);
+        }
+        food.merge(o.food);
+        energy.merge(o.energy);
+        health.merge(o.health);
+        hunger.merge(o.hunger);
+        happiness.merge(o.happiness);
+    }
+};
+
+// ============================================
+// One Pet's Life
+// ============================================
+
+class PetLife {
+public:
+    PetLife(const SimConfig& config, const StepProfile& profile, ProfileStats& stats, uint64_t seed)
+        : _config(config), _profile(profile), _stats(stats), _rng(seed) {}
+
+    void run() {
+        uint32_t reachedDay[PET_LEVEL_COUNT];
+        for (int i = 0; i < PET_LEVEL_COUNT; i++) reachedDay[i] = UINT32_MAX;
+        reachedDay[0] = 0;
+
+        petBorn(_pet, SIM_EPOCH);
+        _pending = 0;
+        _nextSample = SIM_EPOCH + 3600;
+
+        for (uint32_t day = 0; day < _config.days; day++) {
+            runDay(day);
+            for (int i = 1; i < PET_LEVEL_COUNT; i++) {
+                if (reachedDay[i] == UINT32_MAX && _pet.level >= i) reachedDay[i] = day + 1;
+            }
+        }
+
+        _stats.pets++;
+        for (int i = 1; i < PET_LEVEL_COUNT; i++) {
+            if (reachedDay[i] == UINT32_MAX) {
+                _stats.neverReached[i]++;
+            } else {
+                _stats.levelDay[i].add(reachedDay[i]);
+            }
+        }
+    }
+
+private:
+    const SimConfig& _config;
+    const StepProfile& _profile;
+    ProfileStats& _stats;
+    std::mt19937_64 _rng;
+
+    SimPet _pet;
+    int _pending;                     // Counted, not yet claimed
+    double _stepCarry;
+    float _hourSteps[24];
+    uint32_t _dayStart;
+    uint32_t _stepsUntil;             // Steps generated up to this time
+    uint32_t _nextSample;
+
+    void runDay(uint32_t day) {
+        _dayStart = SIM_EPOCH + day * 86400u;
+        planSteps();
+
+        std::exponential_distribution<double> glanceGap(1.0 / (_config.glanceMin * 60.0));
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+        uint32_t wake = _dayStart + (uint32_t)(_config.wakeHour * 3600 + unit(_rng) * 1800);
+        uint32_t sleep = _dayStart + (uint32_t)(_config.sleepHour * 3600);
+        _stepsUntil = _dayStart;
+        _stepCarry = 0;
+
+        for (uint32_t t = wake; t < sleep; t += 1 + (uint32_t)glanceGap(_rng)) {
+            advance(t);
+            glance(t, unit(_rng) < _config.claimChance);
+        }
+
+        uint32_t dayEnd = _dayStart + 86400u;
+        advance(dayEnd);
+        _stats.petDays++;
+        _stats.food.add(_pet.food);
+        _stats.energy.add(_pet.energy);
+    }
+
+    // Today's steps per hour: the daily total and each hour vary
+    void planSteps() {
+        std::lognormal_distribution<double> dayNoise(-0.5 * 0.35 * 0.35, 0.35);
+        std::lognormal_distribution<double> hourNoise(-0.5 * 0.5 * 0.5, 0.5);
+
+        float weightSum = 0;
+        for (float w : _profile.hourWeights) weightSum += w;
+
+        double total = _profile.dailySteps * dayNoise(_rng);
+        for (int h = 0; h < 24; h++) {
+            double share = _profile.hourWeights[h] / weightSum;
+            _hourSteps[h] = share > 0 ? (float)(total * share * hourNoise(_rng)) : 0.0f;
+        }
+    }
+
+    // Walk and decay up to t: step rewards as the sensor task posts them,
+    // hourly stat samples as the clock passes them
+    void advance(uint32_t t) {
+        while (_stepsUntil < t) {
+            uint32_t hour = (_stepsUntil - _dayStart) / 3600;
+            uint32_t hourEnd = _dayStart + (hour + 1) * 3600;
+            uint32_t until = std::min(t, hourEnd);
+            _stepCarry += _hourSteps[hour] * (until - _stepsUntil) / 3600.0;
+            _stepsUntil = until;
+        }
+
+        int steps = (int)_stepCarry;
+        _stepCarry -= steps;
+        if (steps > 0) walk(steps);
+
+        while (_nextSample <= t) {
+            sample(_nextSample);
+            _nextSample += 3600;
+        }
+    }
+
+    void walk(int steps) {
+        int before = _pending;
+        _pending += steps;
+        _stats.steps += steps;
+
+        int food = (_pending / PET_RULES.stepsPerFood - before / PET_RULES.stepsPerFood) * PET_RULES.foodPerReward;
+        int energy = (_pending / PET_RULES.stepsPerEnergy - before / PET_RULES.stepsPerEnergy) * PET_RULES.energyPerReward;
+        earn(food, energy);
+    }
+
+    void earn(int food, int energy) {
+        _stats.foodEarned += food;
+        _stats.energyEarned += energy;
+        _stats.resourcesCapped += petAddResource(_pet.food, food) + petAddResource(_pet.energy, energy);
+    }
+
+    void glance(uint32_t t, bool claim) {
+        if (claim && _pending >= PET_RULES.claimMinSteps) {
+            earn(petClaimFood(_pending), petClaimEnergy(_pending));
+            _pending = 0;
+            _stats.claims++;
+        }
+        if (hungerNow(_pet, t) < _config.feedBelow && feed(_pet, t)) _stats.feeds++;
+        if (happinessNow(_pet, t) < _config.playBelow && petPlay(_pet, t)) _stats.plays++;
+    }
+
+    void sample(uint32_t t) {
+        int health = healthNow(_pet, t);
+        int hunger = hungerNow(_pet, t);
+        int happiness = happinessNow(_pet, t);
+
+        _stats.hours++;
+        _stats.health.add(health);
+        _stats.hunger.add(hunger);
+        _stats.happiness.add(happiness);
+        if (health == 0) _stats.zeroHealthHours++;
+        if (happiness < PET_RULES.attentionHappiness || hunger < PET_RULES.attentionHunger ||
+            health < PET_RULES.attentionHealth) {
+            _stats.attentionHours++;
+        }
+    }
+};
+
+// ============================================
+// Runner
+// ============================================
+
+static uint64_t splitmix64(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+static size_t profileFor(const SimConfig& config, uint32_t pet) {
+    return config.profile >= 0 ? (size_t)config.profile : pet % PROFILE_COUNT;
+}
+
+static std::vector<ProfileStats> simulate(const SimConfig& config) {
+    std::atomic<uint32_t> nextPet(0);
+    const uint32_t chunk = 64;
+
+    std::vector<std::vector<ProfileStats>> perThread(
+        config.threads, std::vector<ProfileStats>(PROFILE_COUNT, ProfileStats(config.days)));
+
+    auto worker = [&](uint32_t index) {
+        std::vector<ProfileStats>& stats = perThread[index];
+        for (;;) {
+            uint32_t first = nextPet.fetch_add(chunk);
+            if (first >= config.pets) break;
+            uint32_t last = std::min(config.pets, first + chunk);
+            for (uint32_t pet = first; pet < last; pet++) {
+                size_t profile = profileFor(config, pet);
+                PetLife life(config, PROFILES[profile], stats[profile], splitmix64(config.seed ^ splitmix64(pet)));
+                life.run();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < config.threads; i++) threads.emplace_back(worker, i);
+    for (auto& thread : threads) thread.join();
+
+    std::vector<ProfileStats> total(PROFILE_COUNT, ProfileStats(config.days));
+    for (auto& stats : perThread) {
+        for (size_t p = 0; p < PROFILE_COUNT; p++) total[p].merge(stats[p]);
+    }
+    return total;
+}
+
+// ============================================
+// Report
+// ============================================
+
+static void printSpread(const char* label, const Histogram& h) {
+    printf("  %-22s p10 %4u   p50 %4u   p90 %4u\n", label,
+           h.percentile(0.10), h.percentile(0.50), h.percentile(0.90));
+}
+
+static void printRules() {
+    printf("Rules (sui_watch/PetRules.h)\n");
+    printf("  level    evolve at  feed cd  play cd\n");
+    for (int i = 0; i < PET_LEVEL_COUNT; i++) {
+        const PetLevelRule& r = PET_RULES.levels[i];
+        printf("  %-7s %10lu %7us %7us\n", LEVEL_NAMES[i],
+               (unsigned long)r.evolveAt, r.feedCooldownSec, r.playCooldownSec);
+    }
+    printf("  decay: hunger -1/%us, happiness -1/%us, health +-1/%us (starve <%u, thrive >%u)\n",
+           PET_RULES.hungerDecaySec, PET_RULES.happinessDecaySec, PET_RULES.healthStepSec,
+           PET_RULES.starveBelow, PET_RULES.thriveAbove);
+    printf("  feed: +%u hunger, +%u happiness, +%u fed steps; play: +%u happiness\n",
+           PET_RULES.feedHunger, PET_RULES.feedHappiness, PET_RULES.feedStepsCredit,
+           PET_RULES.playHappiness);
+    printf("  walking: %u food / %u steps, %u energy / %u steps (again on claim, min %u)\n\n",
+           PET_RULES.foodPerReward, PET_RULES.stepsPerFood, PET_RULES.energyPerReward,
+           PET_RULES.stepsPerEnergy, PET_RULES.claimMinSteps);
+}
+
+static void printProfile(const StepProfile& profile, const ProfileStats& s) {
+    if (s.pets == 0) return;
+    double days = (double)s.petDays;
+
+    printf("== %s (%lu steps/day) - %lu pets ==\n", profile.name,
+           (unsigned long)profile.dailySteps, (unsigned long)s.pets);
+    printf("Evolution (day reached)\n");
+    for (int i = 1; i < PET_LEVEL_COUNT; i++) {
+        const Histogram& h = s.levelDay[i];
+        double reached = 100.0 * h.count / s.pets;
+        if (h.count == 0) {
+            printf("  %-22s never (0.0%% of pets)\n", LEVEL_NAMES[i]);
+            continue;
+        }
+        printf("  %-22s p10 %4u   p50 %4u   p90 %4u   (%.1f%% of pets)\n", LEVEL_NAMES[i],
+               h.percentile(0.10), h.percentile(0.50), h.percentile(0.90), reached);
+    }
+
+    printf("Resources at end of day\n");
+    printSpread("food", s.food);
+    printSpread("energy", s.energy);
+    printf("  per day: %.0f steps, %.1f food / %.1f energy earned, %.1f feeds, %.1f plays, "
+           "%.1f claims, %.2f lost to the cap\n",
+           s.steps / days, s.foodEarned / days, s.energyEarned / days, s.feeds / days,
+           s.plays / days, s.claims / days, s.resourcesCapped / days);
+
+    printf("Stats (hourly, day and night)\n");
+    printSpread("hunger", s.hunger);
+    printSpread("happiness", s.happiness);
+    printSpread("health", s.health);
+    printf("  needs attention %.1f%% of hours, health at 0 %.1f%% of hours\n\n",
+           100.0 * s.attentionHours / s.hours, 100.0 * s.zeroHealthHours / s.hours);
+}
+
+// ============================================
+// Main
+// ============================================
+
+static void usage() {
+    printf("Usage: pet_sim [options]\n"
+           "  --pets N          pets to simulate (default 10000)\n"
+           "  --days N          days per pet (default 365)\n"
+           "  --threads N       worker threads (default: one per core)\n"
+           "  --seed N          RNG seed (default 1)\n"
+           "  --profile NAME    sedentary|average|active|athlete (default: all, round robin)\n"
+           "  --glance-min M    mean minutes between watch glances (default 30)\n"
+           "  --wake H          wake-up hour (default 7)\n"
+           "  --sleep H         bedtime hour (default 23)\n"
+           "  --feed-below N    owner feeds when hunger is below N (default 75)\n"
+           "  --play-below N    owner plays when happiness is below N (default 85)\n"
+           "  --claim-chance P  chance to claim steps per glance (default 0.5)\n");
+}
+
+static bool parseArgs(int argc, char** argv, SimConfig& config) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0) return false;
+        if (i + 1 >= argc) {
+            fprintf(stderr, "Missing value for %s\n", arg);
+            return false;
+        }
+        const char* value = argv[++i];
+
+        if (strcmp(arg, "--pets") == 0) config.pets = strtoul(value, nullptr, 10);
+        else if (strcmp(arg, "--days") == 0) config.days = strtoul(value, nullptr, 10);
+        else if (strcmp(arg, "--threads") == 0) config.threads = strtoul(value, nullptr, 10);
+        else if (strcmp(arg, "--seed") == 0) config.seed = strtoull(value, nullptr, 10);
+        else if (strcmp(arg, "--glance-min") == 0) config.glanceMin = strtof(value, nullptr);
+        else if (strcmp(arg, "--wake") == 0) config.wakeHour = strtof(value, nullptr);
+        else if (strcmp(arg, "--sleep") == 0) config.sleepHour = strtof(value, nullptr);
+        else if (strcmp(arg, "--feed-below") == 0) config.feedBelow = atoi(value);
+        else if (strcmp(arg, "--play-below") == 0) config.playBelow = atoi(value);
+        else if (strcmp(arg, "--claim-chance") == 0) config.claimChance = strtof(value, nullptr);
+        else if (strcmp(arg, "--profile") == 0) {
+            config.profile = -1;
+            for (size_t p = 0; p < PROFILE_COUNT; p++) {
+                if (strcmp(value, PROFILES[p].name) == 0) config.profile = (int)p;
+            }
+            if (config.profile < 0 && strcmp(value, "all") != 0) {
+                fprintf(stderr, "Unknown profile: %s\n", value);
+                return false;
+            }
+        } else {
+            fprintf(stderr, "Unknown option: %s\n", arg);
+            return false;
+        }
+    }
+
+    if (config.pets == 0 || config.days == 0 || config.glanceMin <= 0 ||
+        config.wakeHour < 0 || config.sleepHour > 24 || config.wakeHour >= config.sleepHour) {
+        fprintf(stderr, "Invalid configuration\n");
+        return false;
+    }
+    if (config.threads == 0) config.threads = std::max(1u, std::thread::hardware_concurrency());
+    return true;
+}
+
+int main(int argc, char** argv) {
+    SimConfig config;
+    if (!parseArgs(argc, argv, config)) {
+        usage();
+        return 1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<ProfileStats> stats = simulate(config);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    double petDays = (double)config.pets * config.days;
+    printf("Simulated %lu pets x %lu days = %.2fM pet-days on %lu threads in %.1f s (seed %llu)\n\n",
+           (unsigned long)config.pets, (unsigned long)config.days, petDays / 1e6,
+           (unsigned long)config.threads, seconds, (unsigned long long)config.seed);
+    printRules();
+    for (size_t p = 0; p < PROFILE_COUNT; p++) printProfile(PROFILES[p], stats[p]);
+    return 0;
+}
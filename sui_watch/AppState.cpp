@@ -0,0 +1,150 @@
+/**
+ * App State Implementation
+ */
+
+#include "AppState.h"
+
+AppState::AppState()
+    : _steps(0), _netCommands(nullptr), _uiEvents(nullptr), _sensorWindows(nullptr),
+      _petMutex(nullptr), _dropped(0) {
+    _lock = portMUX_INITIALIZER_UNLOCKED;
+    _petObjectId[0] = '\0';
+    strcpy(_balance, "0.00");
+    memset(&_net, 0, sizeof(_net));
+}
+
+void AppState::begin() {
+    _netCommands = xQueueCreate(APP_NET_COMMAND_DEPTH, sizeof(NetCommand));
+    _uiEvents = xQueueCreate(APP_UI_EVENT_DEPTH, sizeof(UiEvent));
+    _sensorWindows = xQueueCreate(APP_SENSOR_WINDOW_DEPTH, sizeof(SensorWindow));
+    _petMutex = xSemaphoreCreateRecursiveMutex();
+
+    if (!_netCommands || !_uiEvents || !_sensorWindows || !_petMutex) {
+        Serial.println("[APP] ✗ Failed to create task queues");
+    }
+}
+
+// ============================================
+// Shared Values
+// ============================================
+
+int AppState::getSteps() {
+    portENTER_CRITICAL(&_lock);
+    int steps = _steps;
+    portEXIT_CRITICAL(&_lock);
+    return steps;
+}
+
+int AppState::addStep() {
+    portENTER_CRITICAL(&_lock);
+    int steps = ++_steps;
+    portEXIT_CRITICAL(&_lock);
+    return steps;
+}
+
+void AppState::setSteps(int steps) {
+    portENTER_CRITICAL(&_lock);
+    _steps = steps;
+    portEXIT_CRITICAL(&_lock);
+}
+
+int AppState::claimSteps(int minimum) {
+    // Check and reset together so a step landing in between is not lost
+    portENTER_CRITICAL(&_lock);
+    int steps = _steps >= minimum ? _steps : 0;
+    _steps -= steps;
+    portEXIT_CRITICAL(&_lock);
+    return steps;
+}
+
+void AppState::setPetObjectId(const char* objectId) {
+    portENTER_CRITICAL(&_lock);
+    strncpy(_petObjectId, objectId ? objectId : "", sizeof(_petObjectId) - 1);
+    _petObjectId[sizeof(_petObjectId) - 1] = '\0';
+    portEXIT_CRITICAL(&_lock);
+}
+
+void AppState::getPetObjectId(char* out, size_t size) {
+    if (size == 0) return;
+    portENTER_CRITICAL(&_lock);
+    strncpy(out, _petObjectId, size - 1);
+    portEXIT_CRITICAL(&_lock);
+    out[size - 1] = '\0';
+}
+
+void AppState::setBalance(const char* text) {
+    portENTER_CRITICAL(&_lock);
+    strncpy(_balance, text ? text : "", sizeof(_balance) - 1);
+    _balance[sizeof(_balance) - 1] = '\0';
+    portEXIT_CRITICAL(&_lock);
+}
+
+void AppState::getBalance(char* out, size_t size) {
+    if (size == 0) return;
+    portENTER_CRITICAL(&_lock);
+    strncpy(out, _balance, size - 1);
+    portEXIT_CRITICAL(&_lock);
+    out[size - 1] = '\0';
+}
+
+void AppState::setNetStatus(const NetStatus& status) {
+    portENTER_CRITICAL(&_lock);
+    _net = status;
+    portEXIT_CRITICAL(&_lock);
+}
+
+void AppState::getNetStatus(NetStatus& out) {
+    portENTER_CRITICAL(&_lock);
+    out = _net;
+    portEXIT_CRITICAL(&_lock);
+}
+
+// ============================================
+// Queues
+// ============================================
+
+bool AppState::post(QueueHandle_t queue, const void* item) {
+    if (queue && xQueueSend(queue, item, 0) == pdTRUE) {
+        return true;
+    }
+    _dropped++;
+    return false;
+}
+
+bool AppState::postNetCommand(NetCommandType type, int32_t value) {
+    NetCommand cmd = { type, value };
+    return post(_netCommands, &cmd);
+}
+
+bool AppState::takeNetCommand(NetCommand& out) {
+    return _netCommands && xQueueReceive(_netCommands, &out, 0) == pdTRUE;
+}
+
+bool AppState::postUiEvent(UiEventType type, int16_t food, int16_t energy) {
+    UiEvent event = { type, food, energy };
+    return post(_uiEvents, &event);
+}
+
+bool AppState::takeUiEvent(UiEvent& out) {
+    return _uiEvents && xQueueReceive(_uiEvents, &out, 0) == pdTRUE;
+}
+
+bool AppState::postSensorWindow(const SensorWindow& window) {
+    return post(_sensorWindows, &window);
+}
+
+bool AppState::takeSensorWindow(SensorWindow& out) {
+    return _sensorWindows && xQueueReceive(_sensorWindows, &out, 0) == pdTRUE;
+}
+
+// ============================================
+// Pet Lock
+// ============================================
+
+void AppState::lockPet() {
+    if (_petMutex) xSemaphoreTakeRecursive(_petMutex, portMAX_DELAY);
+}
+
+void AppState::unlockPet() {
+    if (_petMutex) xSemaphoreGiveRecursive(_petMutex);
+}
@@ -0,0 +1,175 @@
+/**
+ * App State and Task Messages for ESP32
+ * The firmware runs as three pinned FreeRTOS tasks instead of one Arduino
+ * loop(): UI/LVGL on core 1, networking and crypto on core 0 next to the
+ * WiFi stack, and a high-priority sensor task sampling the IMU at a fixed
+ * rate. Values read by more than one task (step count, pet object ID, SUI
+ * balance, link status) live here behind a spinlock and are copied in and
+ * out, never referenced. Work crosses tasks as typed queue messages:
+ *
+ *   UI     -> net  NetCommand    feed, play, claim, pet sync, balance refresh
+ *   net    -> UI   UiEvent       blockchain answer arrived / action failed
+ *   sensor -> UI   UiEvent       step rewards for the pet
+ *   sensor -> net  SensorWindow  samples for the signed step batch
+ *
+ * The virtual pet is shared by the UI and net tasks. Both take PetLock
+ * around anything that reads or writes the pet, and nothing else: the UI
+ * copies a PetView under it and renders after releasing it.
+ */
+
+#ifndef APP_STATE_H
+#define APP_STATE_H
+
+#include <Arduino.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+
+// Task layout (Arduino loop() is deleted once these are running)
+#define APP_UI_CORE            1
+#define APP_UI_PRIORITY        2
+#define APP_UI_STACK           8192
+#define APP_UI_PERIOD_MS       10
+
+#define APP_NET_CORE           0       // With the WiFi/lwIP tasks and signer
+#define APP_NET_PRIORITY       3
+#define APP_NET_STACK          8192
+#define APP_NET_PERIOD_MS      5
+
+#define APP_SENSOR_CORE        1
+#define APP_SENSOR_PRIORITY    5       // Preempts LVGL: samples stay on time
+#define APP_SENSOR_STACK       3072
+
+// Periodic work (ms)
+#define APP_PET_SETTLE_MS      5000    // UI: fold pet decay in, refresh the RTC copy
+#define APP_PET_SYNC_MS        60000   // Net: send dirty pet fields
+#define APP_STEP_WINDOW_MS     60000   // Sensor: hand a window to the net task...
+#define APP_STEP_WINDOW_MIN    10      // ...once this many steps are counted
+#define APP_JOURNAL_CHECK_MS   1000    // Net: journal due? (writes are rate-limited)
+#define APP_BATCH_RETRY_MS     5000    // Net: wait after a step batch could not be submitted
+
+// Queue depths (messages)
+#define APP_NET_COMMAND_DEPTH  8
+#define APP_UI_EVENT_DEPTH     8
+#define APP_SENSOR_WINDOW_DEPTH 2
+
+#define APP_WINDOW_SAMPLES     30
+#define APP_BALANCE_LEN        32
+#define APP_PET_ID_LEN         72
+
+enum AppTaskId {
+    APP_TASK_UI,
+    APP_TASK_NET,
+    APP_TASK_SENSOR,
+    APP_TASK_COUNT
+};
+
+enum NetCommandType : uint8_t {
+    NET_CMD_FEED,
+    NET_CMD_PLAY,
+    NET_CMD_CLAIM,             // value = steps
+    NET_CMD_SYNC_PET,
+    NET_CMD_REFRESH_BALANCE
+};
+
+struct NetCommand {
+    NetCommandType type;
+    int32_t value;
+};
+
+enum UiEventType : uint8_t {
+    UI_EVENT_ACTION_DONE,      // Server confirmed feed/play/claim
+    UI_EVENT_ACTION_FAILED,    // Refused locally or by the server
+    UI_EVENT_STEP_REWARD       // food/energy earned by walking
+};
+
+struct UiEvent {
+    UiEventType type;
+    int16_t food;
+    int16_t energy;
+};
+
+struct SensorWindow {
+    uint32_t stepCount;
+    uint64_t timestamp;                // Unix epoch ms (windows wait for SNTP)
+    uint8_t batteryPercent;
+    float samples[APP_WINDOW_SAMPLES][3];
+};
+
+// Link status as the UI shows it (published by the net task)
+struct NetStatus {
+    bool clientReady;
+    bool connected;
+    bool authenticated;
+    uint32_t pongs;
+    uint32_t rttLastMs;
+    uint32_t rttP95Ms;
+    uint32_t disconnects;
+    uint32_t keepaliveMs;
+};
+
+class AppState {
+public:
+    AppState();
+
+    // Create the queues and the pet mutex (call from setup())
+    void begin();
+
+    // Steps since the last claim (sensor adds, UI claims)
+    int getSteps();
+    int addStep();                     // Returns the new total
+    void setSteps(int steps);          // Restored at boot
+    int claimSteps(int minimum);       // All steps if >= minimum, else 0
+
+    // Pet NFT object ID ("" until the server reports one)
+    void setPetObjectId(const char* objectId);
+    void getPetObjectId(char* out, size_t size);
+
+    // SUI balance as display text
+    void setBalance(const char* text);
+    void getBalance(char* out, size_t size);
+
+    void setNetStatus(const NetStatus& status);
+    void getNetStatus(NetStatus& out);
+
+    // Typed queues (never block; false = queue full or not started)
+    bool postNetCommand(NetCommandType type, int32_t value = 0);
+    bool takeNetCommand(NetCommand& out);
+    bool postUiEvent(UiEventType type, int16_t food = 0, int16_t energy = 0);
+    bool takeUiEvent(UiEvent& out);
+    bool postSensorWindow(const SensorWindow& window);
+    bool takeSensorWindow(SensorWindow& out);
+
+    // Messages refused because a queue was full
+    uint32_t getDroppedMessages() { return _dropped; }
+
+    // Recursive: a helper that locks may be called with the lock held
+    void lockPet();
+    void unlockPet();
+
+private:
+    portMUX_TYPE _lock;
+    int _steps;
+    char _petObjectId[APP_PET_ID_LEN];
+    char _balance[APP_BALANCE_LEN];
+    NetStatus _net;
+
+    QueueHandle_t _netCommands;
+    QueueHandle_t _uiEvents;
+    QueueHandle_t _sensorWindows;
+    SemaphoreHandle_t _petMutex;
+    volatile uint32_t _dropped;
+
+    bool post(QueueHandle_t queue, const void* item);
+};
+
+// Scoped pet access from any task
+class PetLock {
+public:
+    explicit PetLock(AppState& state) : _state(state) { _state.lockPet(); }
+    ~PetLock() { _state.unlockPet(); }
+
+private:
+    AppState& _state;
+};
+
+#endif
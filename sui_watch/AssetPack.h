@@ -0,0 +1,142 @@
+/**
+ * Asset Pack Format
+ * Images live in their own flash data partition instead of the app
+ * binary. convert_images.py writes the pack, AssetStore maps it, and
+ * pet-simulator/asset_pack lists and checks it on the host:
+ *
+ *   AssetPackHeader   32 bytes
+ *   AssetEntry[count] 32 bytes each, sorted by name
+ *   pixel data        each image ASSET_PACK_ALIGN-aligned, LVGL layout
+ *
+ * Pixel data is exactly what an lv_img_dsc_t points at, so the firmware
+ * hands LVGL pointers into the mapped flash and never copies an image.
+ * Little-endian throughout. Plain C++11 with no Arduino or LVGL
+ * dependency: keep it that way.
+ */
+
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define ASSET_PACK_MAGIC      0x4B504157   // "WAPK"
+#define ASSET_PACK_VERSION    1
+#define ASSET_PACK_ALIGN      16
+#define ASSET_NAME_LEN        16           // NUL included
+
+// Pixel formats (the lv_img_cf_t values of LVGL 8)
+#define ASSET_FORMAT_TRUE_COLOR        4   // RGB565
+#define ASSET_FORMAT_TRUE_COLOR_ALPHA  5   // RGB565 + 8-bit alpha per pixel
+#define ASSET_FORMAT_INDEXED_4BIT      9   // 16 x ARGB8888 palette + 4-bit indices
+#define ASSET_FORMAT_INDEXED_8BIT     10   // 256 x ARGB8888 palette + 8-bit indices
+
+struct AssetPackHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+    uint32_t size;                 // Whole pack, header included
+    uint32_t tableCrc;             // CRC32 of the entry table
+    uint32_t dataCrc;              // CRC32 of everything after the table
+    uint8_t reserved[12];
+};
+
+struct AssetEntry {
+    char name[ASSET_NAME_LEN];
+    uint32_t offset;               // From the start of the pack
+    uint32_t size;
+    uint16_t width;
+    uint16_t height;
+    uint8_t format;                // ASSET_FORMAT_*
+    uint8_t reserved[3];
+};
+
+static_assert(sizeof(AssetPackHeader) == 32, "Pack header layout");
+static_assert(sizeof(AssetEntry) == 32, "Pack entry layout");
+
+enum AssetPackError {
+    ASSET_PACK_OK,
+    ASSET_PACK_TRUNCATED,          // Shorter than its header or table says
+    ASSET_PACK_BAD_MAGIC,          // Erased or foreign partition
+    ASSET_PACK_BAD_VERSION,
+    ASSET_PACK_BAD_TABLE,          // Table CRC mismatch
+    ASSET_PACK_BAD_ENTRY,          // Name, alignment, bounds or size wrong
+    ASSET_PACK_BAD_DATA            // Data CRC mismatch
+};
+
+inline const char* assetPackErrorName(AssetPackError error) {
+    switch (error) {
+        case ASSET_PACK_OK: return "ok";
+        case ASSET_PACK_TRUNCATED: return "truncated";
+        case ASSET_PACK_BAD_MAGIC: return "no pack";
+        case ASSET_PACK_BAD_VERSION: return "unsupported version";
+        case ASSET_PACK_BAD_TABLE: return "table CRC mismatch";
+        case ASSET_PACK_BAD_ENTRY: return "bad entry";
+        case ASSET_PACK_BAD_DATA: return "data CRC mismatch";
+    }
+    return "?";
+}
+
+// CRC-32 (IEEE, as zlib.crc32 and the ROM's crc32_le): pass 0 to start
+inline uint32_t assetPackCrc32(uint32_t crc, const uint8_t* data, uint32_t length) {
+    crc = ~crc;
+    while (length--) {
+        crc ^= *data++;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+// Bytes an image of this format needs (0 = format not known here)
+inline uint32_t assetPixelBytes(uint8_t format, uint16_t width, uint16_t height) {
+    uint32_t pixels = (uint32_t)width * height;
+    switch (format) {
+        case ASSET_FORMAT_TRUE_COLOR: return pixels * 2;
+        case ASSET_FORMAT_TRUE_COLOR_ALPHA: return pixels * 3;
+        // Rows of 4-bit indices are padded to a whole byte
+        case ASSET_FORMAT_INDEXED_4BIT: return 16 * 4 + (uint32_t)((width + 1) / 2) * height;
+        case ASSET_FORMAT_INDEXED_8BIT: return 256 * 4 + pixels;
+    }
+    return 0;
+}
+
+inline const AssetEntry* assetPackEntries(const uint8_t* pack) {
+    return (const AssetEntry*)(pack + sizeof(AssetPackHeader));
+}
+
+// Structural check of a pack of `available` bytes. The data CRC covers
+// the whole pack and is optional (the table CRC is always checked).
+inline AssetPackError assetPackCheck(const uint8_t* pack, uint32_t available, bool checkData) {
+    AssetPackHeader header;
+    if (available < sizeof(header)) return ASSET_PACK_TRUNCATED;
+    memcpy(&header, pack, sizeof(header));
+    if (header.magic != ASSET_PACK_MAGIC) return ASSET_PACK_BAD_MAGIC;
+    if (header.version != ASSET_PACK_VERSION) return ASSET_PACK_BAD_VERSION;
+
+    uint32_t tableEnd = sizeof(header) + (uint32_t)header.count * sizeof(AssetEntry);
+    if (header.size > available || tableEnd > header.size) return ASSET_PACK_TRUNCATED;
+    if (assetPackCrc32(0, pack + sizeof(header), tableEnd - sizeof(header)) != header.tableCrc) {
+        return ASSET_PACK_BAD_TABLE;
+    }
+
+    for (uint16_t i = 0; i < header.count; i++) {
+        AssetEntry entry;
+        memcpy(&entry, pack + sizeof(header) + i * sizeof(AssetEntry), sizeof(entry));
+        uint32_t expected = assetPixelBytes(entry.format, entry.width, entry.height);
+        if (entry.name[0] == '\0' || entry.name[ASSET_NAME_LEN - 1] != '\0' ||
+            entry.offset % ASSET_PACK_ALIGN != 0 || entry.offset < tableEnd ||
+            entry.size == 0 || entry.size > header.size - entry.offset ||
+            (expected != 0 && entry.size != expected)) {
+            return ASSET_PACK_BAD_ENTRY;
+        }
+    }
+
+    if (checkData && assetPackCrc32(0, pack + tableEnd, header.size - tableEnd) != header.dataCrc) {
+        return ASSET_PACK_BAD_DATA;
+    }
+    return ASSET_PACK_OK;
+}
+
+#endif // ASSET_PACK_H
@@ -0,0 +1,106 @@
+/**
+ * Asset Store Implementation
+ */
+
+#include "AssetStore.h"
+#include <esp_partition.h>
+#include <esp_idf_version.h>
+#include <esp_timer.h>
+
+#if ESP_IDF_VERSION_MAJOR >= 5
+#define ASSET_MMAP_DATA ESP_PARTITION_MMAP_DATA
+#define assetUnmap esp_partition_munmap
+typedef esp_partition_mmap_handle_t AssetMapHandle;
+#else
+#define ASSET_MMAP_DATA SPI_FLASH_MMAP_DATA
+#define assetUnmap spi_flash_munmap
+typedef spi_flash_mmap_handle_t AssetMapHandle;
+#endif
+
+AssetStore assetStore;
+
+AssetStore::AssetStore() : _base(nullptr), _entries(nullptr) {
+    memset(_images, 0, sizeof(_images));
+    memset(&_stats, 0, sizeof(_stats));
+    _stats.error = ASSET_PACK_BAD_MAGIC;
+}
+
+bool AssetStore::begin() {
+    if (_base) return true;
+    int64_t start = esp_timer_get_time();
+
+    const esp_partition_t* part = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)ASSET_PARTITION_SUBTYPE, ASSET_PARTITION_LABEL);
+    if (!part) {
+        Serial.println("[ASSETS] ✗ No assets partition (flash partitions.csv)");
+        return false;
+    }
+    _stats.partitionSize = part->size;
+
+    // Read the header first so only the pack itself is mapped
+    AssetPackHeader header;
+    if (esp_partition_read(part, 0, &header, sizeof(header)) != ESP_OK ||
+        header.magic != ASSET_PACK_MAGIC) {
+        Serial.println("[ASSETS] ⚠️ Partition holds no asset pack (flash assets.bin)");
+        return false;
+    }
+    uint32_t mapSize = header.size <= part->size ? header.size : part->size;
+
+    const void* mapped = nullptr;
+    AssetMapHandle handle;
+    esp_err_t err = esp_partition_mmap(part, 0, mapSize, ASSET_MMAP_DATA, &mapped, &handle);
+    if (err != ESP_OK) {
+        Serial.printf("[ASSETS] ✗ mmap failed: %s\n", esp_err_to_name(err));
+        return false;
+    }
+
+    const uint8_t* base = (const uint8_t*)mapped;
+    _stats.error = assetPackCheck(base, mapSize, ASSET_VERIFY_DATA);
+    if (_stats.error != ASSET_PACK_OK || header.count > ASSET_MAX_IMAGES) {
+        Serial.printf("[ASSETS] ✗ Pack rejected: %s (%u images)\n",
+                      assetPackErrorName(_stats.error), header.count);
+        assetUnmap(handle);
+        return false;
+    }
+
+    // Descriptors in RAM, pixels left in flash
+    _entries = assetPackEntries(base);
+    for (uint16_t i = 0; i < header.count; i++) {
+        const AssetEntry& entry = _entries[i];
+        lv_img_dsc_t& img = _images[i];
+        img.header.cf = entry.format;
+        img.header.always_zero = 0;
+        img.header.w = entry.width;
+        img.header.h = entry.height;
+        img.data_size = entry.size;
+        img.data = base + entry.offset;
+    }
+
+    _base = base;
+    _stats.packSize = header.size;
+    _stats.images = header.count;
+    _stats.mapUs = (uint32_t)(esp_timer_get_time() - start);
+    Serial.printf("[ASSETS] ✓ %u images, %lu KB mapped at %p in %lu us\n",
+                  header.count, (unsigned long)(header.size / 1024), mapped,
+                  (unsigned long)_stats.mapUs);
+    return true;
+}
+
+const lv_img_dsc_t* AssetStore::image(const char* name) {
+    if (!_base || !name) return nullptr;
+
+    // Entries are sorted by name
+    int lo = 0;
+    int hi = (int)_stats.images - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        int cmp = strncmp(name, _entries[mid].name, ASSET_NAME_LEN);
+        if (cmp == 0) return &_images[mid];
+        if (cmp < 0) {
+            hi = mid - 1;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,55 @@
+/**
+ * Asset Store for ESP32
+ * Maps the "assets" data partition (see partitions.csv) into the address
+ * space with esp_partition_mmap and builds one lv_img_dsc_t per image,
+ * whose data pointer goes straight into flash. Art changes are flashed
+ * to the partition on their own; the app binary does not change.
+ *
+ * Without a valid pack image() returns nullptr and widgets keep the
+ * image the SquareLine export gave them. The mapping stays for the
+ * lifetime of the firmware.
+ */
+
+#ifndef ASSET_STORE_H
+#define ASSET_STORE_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "AssetPack.h"
+
+#define ASSET_PARTITION_LABEL    "assets"
+#define ASSET_PARTITION_SUBTYPE  0x40      // Custom data subtype
+#define ASSET_MAX_IMAGES         32
+#define ASSET_VERIFY_DATA        0         // CRC every pixel at boot (~25 ms per 100 KB)
+
+struct AssetStoreStats {
+    uint32_t partitionSize;
+    uint32_t packSize;
+    uint16_t images;
+    uint32_t mapUs;                        // Find + mmap + table check
+    AssetPackError error;
+};
+
+class AssetStore {
+public:
+    AssetStore();
+
+    // Map and check the pack (call once, before the UI needs images)
+    bool begin();
+    bool isMounted() { return _base != nullptr; }
+
+    // Image by pack name ("idle1", "eat2", ...), nullptr if absent
+    const lv_img_dsc_t* image(const char* name);
+
+    const AssetStoreStats& stats() const { return _stats; }
+
+private:
+    const uint8_t* _base;
+    lv_img_dsc_t _images[ASSET_MAX_IMAGES];
+    const AssetEntry* _entries;            // In flash
+    AssetStoreStats _stats;
+};
+
+extern AssetStore assetStore;
+
+#endif
@@ -0,0 +1,120 @@
+/**
+ * Boot Sequencer Implementation
+ */
+
+#include "BootSequencer.h"
+
+BootSequencer::BootSequencer()
+    : _finished(0), _registered(0), _complete(false), _totalMs(0) {
+    memset(_stages, 0, sizeof(_stages));
+}
+
+void BootSequencer::add(uint8_t id, const char* name, uint32_t deps, BootStageFn fn,
+                        BootStageMode mode, uint32_t stackSize) {
+    if (id >= BOOT_MAX_STAGES) return;
+
+    BootStage& stage = _stages[id];
+    memset(&stage, 0, sizeof(stage));
+    stage.name = name;
+    stage.deps = deps;
+    stage.fn = fn;
+    stage.mode = mode;
+    stage.stackSize = stackSize;
+    _registered |= 1UL << id;
+}
+
+void BootSequencer::start() {
+    Serial.printf("[BOOT] Sequencer start at %lu ms\n", millis());
+    runReady();
+}
+
+void BootSequencer::poll() {
+    if (_complete) return;
+    runReady();
+}
+
+void BootSequencer::finish(uint8_t id) {
+    BootStage& stage = _stages[id];
+    if (!stage.name || stage.done) return;
+    if (!stage.started) {
+        stage.started = true;
+        stage.startMs = millis();
+    }
+    stage.endMs = millis();
+    stage.done = true;
+}
+
+void BootSequencer::taskEntry(void* arg) {
+    BootStage* stage = static_cast<BootStage*>(arg);
+    stage->fn();
+    stage->endMs = millis();
+    stage->done = true;
+    vTaskDelete(NULL);
+}
+
+void BootSequencer::runReady() {
+    bool progress = true;
+
+    while (progress) {
+        progress = false;
+
+        for (uint8_t id = 0; id < BOOT_MAX_STAGES; id++) {
+            BootStage& stage = _stages[id];
+            uint32_t bit = 1UL << id;
+            if (!stage.name || (_finished & bit)) continue;
+
+            // Finished since the last pass (task, finish() or inline below)
+            if (stage.done) {
+                _finished |= bit;
+                progress = true;
+                Serial.printf("[BOOT] ✓ %s (%lu ms)\n", stage.name,
+                              (unsigned long)(stage.endMs - stage.startMs));
+                continue;
+            }
+
+            if (stage.started || (stage.deps & ~_finished) != 0) continue;
+
+            stage.started = true;
+            stage.startMs = millis();
+
+            if (stage.mode == BOOT_BACKGROUND) {
+                BaseType_t created = xTaskCreatePinnedToCore(
+                    taskEntry, stage.name, stage.stackSize, &stage,
+                    BOOT_TASK_PRIORITY, nullptr, BOOT_TASK_CORE);
+                if (created == pdPASS) continue;
+                Serial.printf("[BOOT] ✗ No task for %s, running inline\n", stage.name);
+            } else if (stage.mode == BOOT_EXTERNAL) {
+                continue;
+            }
+
+            if (stage.fn) stage.fn();
+            stage.endMs = millis();
+            stage.done = true;
+            progress = true;
+        }
+    }
+
+    if (_finished == _registered && !_complete) {
+        _complete = true;
+        for (uint8_t id = 0; id < BOOT_MAX_STAGES; id++) {
+            if (_stages[id].name && _stages[id].endMs > _totalMs) {
+                _totalMs = _stages[id].endMs;
+            }
+        }
+        printTimeline();
+    }
+}
+
+void BootSequencer::printTimeline() const {
+    Serial.println("\n[BOOT] Timeline (ms since power-on)");
+    Serial.println("[BOOT]   stage         start    end   took");
+    for (uint8_t id = 0; id < BOOT_MAX_STAGES; id++) {
+        const BootStage& stage = _stages[id];
+        if (!stage.name) continue;
+        Serial.printf("[BOOT]   %-12s %6lu %6lu %6lu%s\n", stage.name,
+                      (unsigned long)stage.startMs, (unsigned long)stage.endMs,
+                      (unsigned long)(stage.endMs - stage.startMs),
+                      stage.mode == BOOT_BACKGROUND ? "  (task)" : "");
+    }
+    Serial.printf("[BOOT] Complete at %lu ms\n\n", (unsigned long)_totalMs);
+}
@@ -0,0 +1,82 @@
+/**
+ * Boot Sequencer for ESP32
+ * Runs setup() as a set of stages with dependencies instead of one serial
+ * chain. A stage starts as soon as everything it depends on has finished:
+ * foreground stages run inline on the loop thread (anything that touches
+ * LVGL), background stages get their own short-lived FreeRTOS task, and
+ * external stages are ended by whoever owns them (e.g. the splash).
+ *
+ * start() runs what it can from setup() and returns; poll() from the UI task
+ * picks up finished background stages and starts the ones they unblock,
+ * so LVGL keeps running while slow hardware and flash work completes.
+ * Once every stage is done the per-stage timeline is printed.
+ */
+
+#ifndef BOOT_SEQUENCER_H
+#define BOOT_SEQUENCER_H
+
+#include <Arduino.h>
+
+#define BOOT_MAX_STAGES   12
+#define BOOT_TASK_CORE    0       // UI task runs on core 1
+#define BOOT_TASK_PRIORITY 1
+
+typedef void (*BootStageFn)();
+
+enum BootStageMode {
+    BOOT_FOREGROUND,   // Inline on the loop thread
+    BOOT_BACKGROUND,   // Own task, stackSize bytes
+    BOOT_EXTERNAL      // Started when ready, ended by finish()
+};
+
+struct BootStage {
+    const char* name;
+    uint32_t deps;                 // Bitmask of stage ids
+    BootStageFn fn;
+    BootStageMode mode;
+    uint32_t stackSize;
+
+    bool started;
+    volatile bool done;            // Set by the stage task
+    uint32_t startMs;              // millis() since power-on
+    uint32_t endMs;
+};
+
+class BootSequencer {
+public:
+    BootSequencer();
+
+    // Register a stage; ids are bit positions (0..BOOT_MAX_STAGES-1)
+    void add(uint8_t id, const char* name, uint32_t deps, BootStageFn fn,
+             BootStageMode mode = BOOT_FOREGROUND, uint32_t stackSize = 4096);
+
+    // Run/spawn every stage whose dependencies are met (call from setup())
+    void start();
+
+    // Pick up finished stages, start newly unblocked ones (call from the UI task)
+    void poll();
+
+    // End an external stage
+    void finish(uint8_t id);
+
+    bool isDone(uint8_t id) const { return _stages[id].name && _stages[id].done; }
+    bool isComplete() const { return _complete; }
+
+    // Time until the given stage finished (0 = not yet)
+    uint32_t finishedAt(uint8_t id) const { return isDone(id) ? _stages[id].endMs : 0; }
+    uint32_t totalMs() const { return _totalMs; }
+
+    void printTimeline() const;
+
+private:
+    BootStage _stages[BOOT_MAX_STAGES];
+    uint32_t _finished;            // Bitmask of done stages seen by poll()
+    uint32_t _registered;
+    bool _complete;
+    uint32_t _totalMs;
+
+    void runReady();
+    static void taskEntry(void* arg);
+};
+
+#endif
@@ -0,0 +1,19 @@
+/**
+ * Clock Implementation
+ */
+
+#include "Clock.h"
+#include <Arduino.h>
+#include <time.h>
+
+uint32_t SystemClock::millis() {
+    return ::millis();
+}
+
+uint32_t SystemClock::epoch() {
+    return (uint32_t)time(nullptr);
+}
+
+// Constant-initialised, so safe to use from other globals' constructors
+static SystemClock systemClock;
+Clock* appClock = &systemClock;
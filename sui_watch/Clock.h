@@ -0,0 +1,56 @@
+/**
+ * Clock for ESP32
+ * Pet logic, the oracle client, the journal and the task loops read time
+ * through appClock rather than calling millis()/time() themselves. On the
+ * watch it is a SystemClock; a host harness installs a VirtualClock and
+ * fast-forwards it, so a simulated day of firmware logic takes seconds
+ * (see pet-simulator/firmware_day.cpp).
+ *
+ * Free of Arduino includes so host builds can use VirtualClock as is.
+ * Timing measurements (esp_timer_get_time) stay on the hardware timer.
+ */
+
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include <stdint.h>
+
+#define CLOCK_EPOCH_MIN 1600000000UL   // epoch() is below this until SNTP sets it
+
+class Clock {
+public:
+    virtual ~Clock() {}
+    virtual uint32_t millis() = 0;    // Since boot, wraps like Arduino millis()
+    virtual uint32_t epoch() = 0;     // Wall-clock seconds (since boot until SNTP sets it)
+
+    bool isSynced() { return epoch() >= CLOCK_EPOCH_MIN; }
+};
+
+// millis() and time() (firmware only, Clock.cpp)
+class SystemClock : public Clock {
+public:
+    uint32_t millis() override;
+    uint32_t epoch() override;
+};
+
+// Moves only when told to
+class VirtualClock : public Clock {
+public:
+    explicit VirtualClock(uint32_t epochAtBoot = 0) : _ms(0), _epochAtBoot(epochAtBoot) {}
+
+    uint32_t millis() override { return (uint32_t)_ms; }
+    uint32_t epoch() override { return _epochAtBoot + (uint32_t)(_ms / 1000); }
+
+    void advance(uint32_t ms) { _ms += ms; }
+    void setEpoch(uint32_t epoch) { _epochAtBoot = epoch - (uint32_t)(_ms / 1000); }  // SNTP step
+    uint64_t elapsedMs() const { return _ms; }
+
+private:
+    uint64_t _ms;
+    uint32_t _epochAtBoot;
+};
+
+// The clock in use (SystemClock on the watch)
+extern Clock* appClock;
+
+#endif
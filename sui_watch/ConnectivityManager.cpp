@@ -0,0 +1,263 @@
+/**
+ * Connectivity Manager Implementation
+ */
+
+#include "ConnectivityManager.h"
+#include <Preferences.h>
+
+ConnectivityManager* ConnectivityManager::_instance = nullptr;
+
+ConnectivityManager::ConnectivityManager()
+    : _ssid(""), _password(""), _state(STATE_IDLE), _attemptAt(0), _outageAt(0),
+      _retryAt(0), _retries(0), _sntpStarted(false), _gotIp(false), _lost(false), _reason(0) {
+    _lock = portMUX_INITIALIZER_UNLOCKED;
+    memset(&_cache, 0, sizeof(_cache));
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+void ConnectivityManager::begin(const char* ssid, const char* password) {
+    _ssid = ssid;
+    _password = password;
+    _instance = this;
+
+    Serial.println("\n=== Connecting to WiFi ===");
+    Serial.print("SSID: ");
+    Serial.println(_ssid);
+
+    // We reconnect ourselves, and the SDK's own credential store would be
+    // rewritten on every begin()
+    WiFi.persistent(false);
+    WiFi.mode(WIFI_STA);
+    WiFi.setAutoReconnect(false);
+    WiFi.onEvent(onEvent);
+
+    unsigned long now = millis();
+    _outageAt = now;
+    if (loadCache()) {
+        startFast(now);
+    } else {
+        startFull(now);
+    }
+}
+
+// Runs on the WiFi event task
+void ConnectivityManager::onEvent(WiFiEvent_t event, WiFiEventInfo_t info) {
+    ConnectivityManager* self = _instance;
+    if (!self) return;
+
+    portENTER_CRITICAL(&self->_lock);
+    if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) {
+        self->_gotIp = true;
+    } else if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED) {
+        self->_lost = true;
+        self->_reason = info.wifi_sta_disconnected.reason;
+    }
+    portEXIT_CRITICAL(&self->_lock);
+}
+
+void ConnectivityManager::loop(unsigned long now) {
+    portENTER_CRITICAL(&_lock);
+    bool gotIp = _gotIp;
+    bool lost = _lost;
+    uint8_t reason = _reason;
+    _gotIp = false;
+    _lost = false;
+    portEXIT_CRITICAL(&_lock);
+
+    if (lost) {
+        _stats.lastDisconnectReason = reason;
+    }
+
+    switch (_state) {
+        case STATE_FAST:
+            if (gotIp && WiFi.status() == WL_CONNECTED) {
+                onConnected(now);
+            } else if (lost || now - _attemptAt > WIFI_FAST_TIMEOUT_MS) {
+                // Access point moved, changed channel or refused the address
+                _stats.fastFailures++;
+                Serial.printf("[WIFI] Fast connect failed (reason %u), scanning\n", reason);
+                clearCache();
+                _cache.valid = false;
+                startFull(now);
+            }
+            break;
+
+        case STATE_FULL:
+            // Disconnect events here may be our own WiFi.disconnect(); only
+            // the timeout ends a scan attempt
+            if (gotIp && WiFi.status() == WL_CONNECTED) {
+                onConnected(now);
+            } else if (now - _attemptAt > WIFI_FULL_TIMEOUT_MS) {
+                Serial.println("[WIFI] ✗ Connection failed");
+                scheduleRetry(now);
+            }
+            break;
+
+        case STATE_CONNECTED:
+            if (lost) {
+                onLost(now);
+            }
+            break;
+
+        case STATE_WAITING:
+            if ((long)(now - _retryAt) >= 0) {
+                if (_cache.valid) {
+                    startFast(now);
+                } else {
+                    startFull(now);
+                }
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+// ============================================
+// Connect Attempts
+// ============================================
+
+void ConnectivityManager::startFast(unsigned long now) {
+    Serial.printf("[WIFI] Fast connect: %02x:%02x:%02x:%02x:%02x:%02x ch %u\n",
+                  _cache.bssid[0], _cache.bssid[1], _cache.bssid[2],
+                  _cache.bssid[3], _cache.bssid[4], _cache.bssid[5], _cache.channel);
+
+#if WIFI_CACHE_STATIC_IP
+    WiFi.config(IPAddress(_cache.ip), IPAddress(_cache.gateway),
+                IPAddress(_cache.subnet), IPAddress(_cache.dns));
+#endif
+    WiFi.begin(_ssid, _password, _cache.channel, _cache.bssid);
+
+    _state = STATE_FAST;
+    _attemptAt = now;
+}
+
+void ConnectivityManager::startFull(unsigned long now) {
+    Serial.println("[WIFI] Scanning all channels...");
+
+    WiFi.disconnect();
+    // Back to DHCP, strongest access point for the SSID
+    WiFi.config(IPAddress((uint32_t)0), IPAddress((uint32_t)0), IPAddress((uint32_t)0));
+    WiFi.setScanMethod(WIFI_ALL_CHANNEL_SCAN);
+    WiFi.setSortMethod(WIFI_CONNECT_AP_BY_SIGNAL);
+    WiFi.begin(_ssid, _password);
+
+    _state = STATE_FULL;
+    _attemptAt = now;
+}
+
+void ConnectivityManager::onConnected(unsigned long now) {
+    bool fast = _state == STATE_FAST;
+    uint32_t elapsed = now - _outageAt;
+
+    _state = STATE_CONNECTED;
+    _retries = 0;
+    _stats.connects++;
+    _stats.lastTimeToIpMs = elapsed;
+    if (fast) {
+        _stats.fastConnects++;
+        _stats.fastAvgMs = _stats.fastAvgMs == 0 ? elapsed
+                         : _stats.fastAvgMs - _stats.fastAvgMs / 8 + elapsed / 8;
+    } else {
+        _stats.fullAvgMs = _stats.fullAvgMs == 0 ? elapsed
+                         : _stats.fullAvgMs - _stats.fullAvgMs / 8 + elapsed / 8;
+    }
+
+    Serial.printf("[WIFI] ✓ Connected: %s in %lu ms (%s, ch %d, RSSI %d)\n",
+                  WiFi.localIP().toString().c_str(), (unsigned long)elapsed,
+                  fast ? "cached AP" : "scan", WiFi.channel(), WiFi.RSSI());
+
+    saveCache();
+
+    // UTC; the RTC keeps it through deep sleep, SNTP corrects drift hourly
+    if (!_sntpStarted) {
+        configTime(0, 0, WIFI_NTP_SERVER);
+        _sntpStarted = true;
+    }
+}
+
+void ConnectivityManager::onLost(unsigned long now) {
+    _stats.drops++;
+    _outageAt = now;
+    _retries = 0;
+    Serial.printf("[WIFI] ✗ Link lost (reason %u), reconnecting\n", _stats.lastDisconnectReason);
+
+    if (_cache.valid) {
+        startFast(now);
+    } else {
+        startFull(now);
+    }
+}
+
+void ConnectivityManager::scheduleRetry(unsigned long now) {
+    uint32_t delayMs = WIFI_RETRY_MIN_MS;
+    for (uint32_t i = 0; i < _retries && delayMs < WIFI_RETRY_MAX_MS; i++) {
+        delayMs *= 2;
+    }
+    if (delayMs > WIFI_RETRY_MAX_MS) delayMs = WIFI_RETRY_MAX_MS;
+    _retries++;
+
+    WiFi.disconnect();
+    _state = STATE_WAITING;
+    _retryAt = now + delayMs;
+    Serial.printf("[WIFI] Retry in %lu ms\n", (unsigned long)delayMs);
+}
+
+// ============================================
+// Access Point Cache (NVS)
+// ============================================
+
+bool ConnectivityManager::loadCache() {
+    Preferences prefs;
+    prefs.begin("wifi", true);  // Read-only mode
+    String ssid = prefs.getString("ssid", "");
+    size_t len = prefs.getBytes("bssid", _cache.bssid, sizeof(_cache.bssid));
+    _cache.channel = prefs.getUChar("channel", 0);
+    _cache.ip = prefs.getUInt("ip", 0);
+    _cache.gateway = prefs.getUInt("gateway", 0);
+    _cache.subnet = prefs.getUInt("subnet", 0);
+    _cache.dns = prefs.getUInt("dns", 0);
+    prefs.end();
+
+    // Only for the SSID it was recorded on
+    _cache.valid = ssid == _ssid && len == sizeof(_cache.bssid) &&
+                   _cache.channel != 0 && _cache.ip != 0;
+    return _cache.valid;
+}
+
+void ConnectivityManager::saveCache() {
+    Cache fresh;
+    memset(&fresh, 0, sizeof(fresh));
+    memcpy(fresh.bssid, WiFi.BSSID(), sizeof(fresh.bssid));
+    fresh.channel = WiFi.channel();
+    fresh.ip = (uint32_t)WiFi.localIP();
+    fresh.gateway = (uint32_t)WiFi.gatewayIP();
+    fresh.subnet = (uint32_t)WiFi.subnetMask();
+    fresh.dns = (uint32_t)WiFi.dnsIP(0);
+    fresh.valid = true;
+
+    // Flash is only written when the access point or lease changed
+    if (_cache.valid && memcmp(&fresh, &_cache, sizeof(fresh)) == 0) return;
+    _cache = fresh;
+
+    Preferences prefs;
+    prefs.begin("wifi", false);  // Read-write mode
+    prefs.putString("ssid", _ssid);
+    prefs.putBytes("bssid", fresh.bssid, sizeof(fresh.bssid));
+    prefs.putUChar("channel", fresh.channel);
+    prefs.putUInt("ip", fresh.ip);
+    prefs.putUInt("gateway", fresh.gateway);
+    prefs.putUInt("subnet", fresh.subnet);
+    prefs.putUInt("dns", fresh.dns);
+    prefs.end();
+
+    Serial.println("[WIFI] ✓ Access point cached to flash");
+}
+
+void ConnectivityManager::clearCache() {
+    Preferences prefs;
+    prefs.begin("wifi", false);  // Read-write mode
+    prefs.clear();
+    prefs.end();
+}
@@ -0,0 +1,114 @@
+/**
+ * Connectivity Manager for ESP32
+ * Brings WiFi up without blocking setup() and keeps it up afterwards.
+ *
+ * After every successful association the BSSID, channel and DHCP lease
+ * are cached in NVS ("wifi" namespace). The next connect goes straight to
+ * that access point on that channel, which skips the channel scan. If it
+ * does not get an IP within WIFI_FAST_TIMEOUT_MS the cache is dropped and
+ * a full all-channel scan follows. Both ask DHCP for the address unless
+ * WIFI_CACHE_STATIC_IP is set.
+ *
+ * Link changes arrive as WiFi events on the event task; loop() only reads
+ * the flags they set and arms reconnects with exponential backoff.
+ * SNTP starts on the first connect and keeps the RTC on wall-clock time.
+ */
+
+#ifndef CONNECTIVITY_MANAGER_H
+#define CONNECTIVITY_MANAGER_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+#define WIFI_FAST_TIMEOUT_MS   3000    // Directed connect (cached BSSID/channel)
+#define WIFI_FULL_TIMEOUT_MS   15000   // Scan + DHCP
+#define WIFI_RETRY_MIN_MS      1000
+#define WIFI_RETRY_MAX_MS      60000
+#define WIFI_NTP_SERVER        "pool.ntp.org"   // Wall clock for the pet's decay model
+
+// Reuse the last DHCP lease as a static IP on fast connects (skips the
+// DHCP exchange). Off by default: nothing tells the watch that the lease
+// expired, and the router may hand that address to another device. Only
+// for networks with a DHCP reservation for the watch.
+#ifndef WIFI_CACHE_STATIC_IP
+#define WIFI_CACHE_STATIC_IP 0
+#endif
+
+struct WiFiStats {
+    uint32_t connects;           // Got an IP
+    uint32_t fastConnects;       // ... via the cached BSSID/channel
+    uint32_t fastFailures;       // Cached attempt timed out or was rejected
+    uint32_t drops;              // Link lost after an IP was assigned
+    uint32_t lastTimeToIpMs;     // begin() / reconnect -> IP
+    uint32_t fastAvgMs;          // Running averages (1/8 weight)
+    uint32_t fullAvgMs;
+    uint8_t lastDisconnectReason;
+};
+
+class ConnectivityManager {
+public:
+    ConnectivityManager();
+
+    // Start connecting in the background (returns immediately)
+    void begin(const char* ssid, const char* password);
+
+    // Timeouts and reconnects; call from loop()
+    void loop(unsigned long now);
+
+    bool isConnected() const { return _state == STATE_CONNECTED; }
+    const WiFiStats& stats() const { return _stats; }
+
+    // Forget the cached access point and lease
+    static void clearCache();
+
+private:
+    enum State {
+        STATE_IDLE,
+        STATE_FAST,          // Directed connect in progress
+        STATE_FULL,          // Scan + DHCP in progress
+        STATE_CONNECTED,
+        STATE_WAITING        // Backing off before the next attempt
+    };
+
+    struct Cache {
+        bool valid;
+        uint8_t bssid[6];
+        uint8_t channel;
+        uint32_t ip;
+        uint32_t gateway;
+        uint32_t subnet;
+        uint32_t dns;
+    };
+
+    const char* _ssid;
+    const char* _password;
+    State _state;
+    Cache _cache;
+    WiFiStats _stats;
+
+    unsigned long _attemptAt;    // Current connect attempt started
+    unsigned long _outageAt;     // Time-to-IP is measured from here
+    unsigned long _retryAt;
+    uint32_t _retries;
+    bool _sntpStarted;
+
+    // Written by the WiFi event task
+    portMUX_TYPE _lock;
+    volatile bool _gotIp;
+    volatile bool _lost;
+    volatile uint8_t _reason;
+
+    static ConnectivityManager* _instance;
+    static void onEvent(WiFiEvent_t event, WiFiEventInfo_t info);
+
+    void startFast(unsigned long now);
+    void startFull(unsigned long now);
+    void onConnected(unsigned long now);
+    void onLost(unsigned long now);
+    void scheduleRetry(unsigned long now);
+
+    bool loadCache();
+    void saveCache();
+};
+
+#endif
@@ -217,8 +217,7 @@ Info:
 ******************************************************************************/
 uint8_t DEV_Module_Init(void)
 {
-    Serial.begin(115200);
-    DEV_Delay_ms(100);
+    Serial.begin(115200);  // No-op when setup() already opened it
     // GPIO Config
     DEV_GPIO_Init();
     // SPI Config
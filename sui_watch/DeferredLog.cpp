@@ -0,0 +1,254 @@
+/**
+ * Deferred Log Implementation
+ */
+
+#include "DeferredLog.h"
+
+DeferredLog deferredLog;
+
+// ============================================
+// Arguments
+// ============================================
+
+void DeferredLogArgs::putRaw(char tag, const void* value, uint8_t size) {
+    if (_truncated || _len + 1 + size > _capacity) {
+        _truncated = true;
+        return;
+    }
+    _data[_len++] = (uint8_t)tag;
+    memcpy(_data + _len, value, size);
+    _len += size;
+}
+
+void DeferredLogArgs::put(const char* s) {
+    if (!s) s = "(null)";
+    if (_truncated || _len + 2 > _capacity) {
+        _truncated = true;
+        return;
+    }
+    size_t room = _capacity - _len - 2;
+    size_t n = strnlen(s, room + 1);
+    if (n > room) {
+        n = room;
+        _truncated = true;             // Keep what fits, drop the rest
+    }
+    _data[_len++] = DLOG_ARG_STRING;
+    _data[_len++] = (uint8_t)n;
+    memcpy(_data + _len, s, n);
+    _len += n;
+}
+
+struct LogArg {
+    char tag;
+    int64_t i;                         // Integer tags, pointer
+    double d;
+    const char* s;
+    uint8_t sLen;
+};
+
+static bool nextArg(const uint8_t* data, uint8_t len, uint8_t& pos, LogArg& arg) {
+    if (pos >= len) return false;
+    arg.tag = (char)data[pos++];
+    arg.i = 0;
+    arg.d = 0;
+    uint8_t size;
+    switch (arg.tag) {
+        case DLOG_ARG_INT:
+        case DLOG_ARG_UINT:
+            size = 4;
+            break;
+        case DLOG_ARG_INT64:
+        case DLOG_ARG_UINT64:
+        case DLOG_ARG_DOUBLE:
+        case DLOG_ARG_POINTER:
+            size = 8;
+            break;
+        case DLOG_ARG_STRING:
+            if (pos >= len) return false;
+            arg.sLen = data[pos++];
+            if (pos + arg.sLen > len) return false;
+            arg.s = (const char*)data + pos;
+            pos += arg.sLen;
+            return true;
+        default:
+            return false;
+    }
+    if (pos + size > len) return false;
+
+    if (arg.tag == DLOG_ARG_INT) {
+        int32_t v;
+        memcpy(&v, data + pos, 4);
+        arg.i = v;
+    } else if (arg.tag == DLOG_ARG_UINT) {
+        uint32_t v;
+        memcpy(&v, data + pos, 4);
+        arg.i = v;
+    } else if (arg.tag == DLOG_ARG_DOUBLE) {
+        memcpy(&arg.d, data + pos, 8);
+        arg.i = (int64_t)arg.d;
+    } else {
+        memcpy(&arg.i, data + pos, 8);
+    }
+    if (arg.tag != DLOG_ARG_DOUBLE) arg.d = (double)arg.i;
+    pos += size;
+    return true;
+}
+
+// printf, one conversion at a time: the argument sizes come from the
+// tags, so length modifiers in the format are dropped and re-added
+size_t DeferredLog::format(char* out, size_t size, const char* format,
+                           const uint8_t* data, uint8_t len) {
+    if (size == 0) return 0;
+    size_t n = 0;
+    uint8_t pos = 0;
+
+    while (*format && n + 1 < size) {
+        if (*format != '%') {
+            out[n++] = *format++;
+            continue;
+        }
+        if (format[1] == '%') {
+            out[n++] = '%';
+            format += 2;
+            continue;
+        }
+
+        char spec[16];
+        size_t s = 0;
+        spec[s++] = *format++;
+        while (*format && strchr("-+ #0123456789.", *format) && s < sizeof(spec) - 4) {
+            spec[s++] = *format++;
+        }
+        while (*format && strchr("hlLqjzt", *format)) format++;
+        char conv = *format;
+        if (!conv) break;
+        format++;
+
+        LogArg arg;
+        char* dst = out + n;
+        size_t room = size - n;
+        int written;
+        if (!nextArg(data, len, pos, arg)) {
+            written = snprintf(dst, room, "?");
+        } else if (conv == 'd' || conv == 'i') {
+            memcpy(spec + s, "lld", 4);
+            written = snprintf(dst, room, spec, (long long)arg.i);
+        } else if (conv == 'u' || conv == 'o' || conv == 'x' || conv == 'X') {
+            spec[s++] = 'l';
+            spec[s++] = 'l';
+            spec[s++] = conv;
+            spec[s] = '\0';
+            written = snprintf(dst, room, spec, (unsigned long long)arg.i);
+        } else if (conv == 'c') {
+            memcpy(spec + s, "c", 2);
+            written = snprintf(dst, room, spec, (int)arg.i);
+        } else if (strchr("fFeEgGaA", conv)) {
+            spec[s++] = conv;
+            spec[s] = '\0';
+            written = snprintf(dst, room, spec, arg.d);
+        } else if (conv == 's' && arg.tag == DLOG_ARG_STRING) {
+            char str[DLOG_ARG_BYTES + 1];
+            memcpy(str, arg.s, arg.sLen);
+            str[arg.sLen] = '\0';
+            memcpy(spec + s, "s", 2);
+            written = snprintf(dst, room, spec, str);
+        } else if (conv == 'p') {
+            written = snprintf(dst, room, "%p", (void*)(uintptr_t)arg.i);
+        } else {
+            written = snprintf(dst, room, "?");
+        }
+
+        if (written < 0) break;
+        n += (size_t)written < room ? (size_t)written : room - 1;
+    }
+    out[n] = '\0';
+    return n;
+}
+
+// ============================================
+// Ring
+// ============================================
+
+DeferredLog::DeferredLog() : _tail(0), _droppedReported(0) {
+    for (uint32_t i = 0; i < DLOG_SLOTS; i++) {
+        _slots[i].seq.store(i, std::memory_order_relaxed);
+    }
+    _head.store(0, std::memory_order_relaxed);
+    _records.store(0, std::memory_order_relaxed);
+    _dropped.store(0, std::memory_order_relaxed);
+    _truncated.store(0, std::memory_order_relaxed);
+}
+
+// Bounded MPMC claim: a slot is free when its seq equals the position
+bool DeferredLog::claim(uint32_t& pos) {
+    pos = _head.load(std::memory_order_relaxed);
+    for (;;) {
+        Slot& slot = _slots[pos & (DLOG_SLOTS - 1)];
+        int32_t diff = (int32_t)(slot.seq.load(std::memory_order_acquire) - pos);
+        if (diff == 0) {
+            if (_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) return true;
+        } else if (diff < 0) {
+            // Not drained since the last lap
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        } else {
+            pos = _head.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void DeferredLog::publish(uint32_t pos) {
+    _slots[pos & (DLOG_SLOTS - 1)].seq.store(pos + 1, std::memory_order_release);
+    _records.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint32_t DeferredLog::drain(DeferredLogWriter write, void* context) {
+    uint32_t count = 0;
+    char line[DLOG_LINE_MAX];
+
+    for (;;) {
+        Slot& slot = _slots[_tail & (DLOG_SLOTS - 1)];
+        if (slot.seq.load(std::memory_order_acquire) != _tail + 1) break;
+
+        // Copy out and free the slot before the (slow) write
+        uint8_t frame[DLOG_FRAME_HEADER + DLOG_ARG_BYTES];
+        const char* format = slot.format;
+        frame[0] = DLOG_FRAME_START;
+        frame[1] = slot.level;
+        memcpy(frame + 2, &slot.id, 4);
+        memcpy(frame + 6, &slot.ms, 4);
+        frame[10] = slot.len;
+        memcpy(frame + DLOG_FRAME_HEADER, slot.data, slot.len);
+        slot.seq.store(_tail + DLOG_SLOTS, std::memory_order_release);
+        _tail++;
+        count++;
+
+#if DLOG_BINARY
+        (void)format;
+        write(frame, DLOG_FRAME_HEADER + frame[10], context);
+#else
+        size_t n = DeferredLog::format(line, sizeof(line) - 1, format,
+                                       frame + DLOG_FRAME_HEADER, frame[10]);
+        line[n++] = '\n';
+        write((const uint8_t*)line, n, context);
+#endif
+    }
+
+    // Plain text in both modes: the decoder passes it through
+    uint32_t dropped = _dropped.load(std::memory_order_relaxed);
+    if (dropped != _droppedReported) {
+        int n = snprintf(line, sizeof(line), "[LOG] ⚠️ %lu records dropped (ring full)\n",
+                         (unsigned long)(dropped - _droppedReported));
+        _droppedReported = dropped;
+        write((const uint8_t*)line, n, context);
+    }
+    return count;
+}
+
+DeferredLogStats DeferredLog::stats() const {
+    DeferredLogStats s;
+    s.records = _records.load(std::memory_order_relaxed);
+    s.dropped = _dropped.load(std::memory_order_relaxed);
+    s.truncated = _truncated.load(std::memory_order_relaxed);
+    return s;
+}
@@ -0,0 +1,223 @@
+/**
+ * Deferred Log
+ * Logging for hot paths without the wait on the UART: DLOG_INFO(format,
+ * args...) stores a format ID and the raw arguments in a slot of a
+ * lock-free ring and returns; a low-priority task drains the ring to
+ * Serial later. At 115200 baud a printed line holds its caller for
+ * milliseconds, a record takes about a microsecond.
+ *
+ * Levels are compile-time: records below DLOG_LEVEL compile to nothing,
+ * arguments included (so they must not have side effects). The level is
+ * a build flag, e.g. -DDLOG_LEVEL=DLOG_LEVEL_WARN for release builds or
+ * -DDLOG_LEVEL=DLOG_LEVEL_DEBUG for per-step lines. The format ID is a
+ * hash of the format string, computed by the compiler.
+ *
+ * DLOG_BINARY 0: the drain task formats each record like printf, so the
+ * Serial Monitor reads as before. DLOG_BINARY 1 (build flag
+ * -DDLOG_BINARY=1): it sends the records as framed binary instead - a
+ * fraction of the UART time - and log_decode.py expands them on the
+ * host, matching IDs against the DLOG_ format strings in the sketch
+ * sources. Plain Serial output passes through the decoder unchanged.
+ *
+ * Arguments: integers, enums, floating point, pointers and C strings
+ * (copied, up to DLOG_ARG_BYTES per record, so a freed buffer is fine).
+ * No trailing newline: the drain adds it. Records come out after
+ * synchronous Serial output of the same moment. A full ring drops the
+ * new record and counts it.
+ */
+
+#ifndef DEFERRED_LOG_H
+#define DEFERRED_LOG_H
+
+#include <Arduino.h>
+#include <atomic>
+#include <esp_timer.h>
+#include <type_traits>
+
+#define DLOG_LEVEL_NONE     0
+#define DLOG_LEVEL_ERROR    1
+#define DLOG_LEVEL_WARN     2
+#define DLOG_LEVEL_INFO     3
+#define DLOG_LEVEL_DEBUG    4
+
+#ifndef DLOG_LEVEL
+#define DLOG_LEVEL          DLOG_LEVEL_INFO     // DLOG_LEVEL_WARN for release builds
+#endif
+#ifndef DLOG_BINARY
+#define DLOG_BINARY         0
+#endif
+#define DLOG_SLOTS          64                  // Power of two
+#define DLOG_ARG_BYTES      48
+#define DLOG_DRAIN_MS       20
+#define DLOG_LINE_MAX       256
+
+// Binary frame: DLOG_FRAME_START, level, id (4), ms (4), length, arguments
+#define DLOG_FRAME_START    0x1E
+#define DLOG_FRAME_HEADER   11
+
+// Argument tags (each followed by its bytes, little-endian)
+#define DLOG_ARG_INT        'i'     // int32
+#define DLOG_ARG_UINT       'u'     // uint32
+#define DLOG_ARG_INT64      'q'
+#define DLOG_ARG_UINT64     'Q'
+#define DLOG_ARG_DOUBLE     'd'
+#define DLOG_ARG_STRING     's'     // Length byte, then the bytes
+#define DLOG_ARG_POINTER    'p'     // uint64
+
+struct DeferredLogStats {
+    uint32_t records;
+    uint32_t dropped;                  // Ring full
+    uint32_t truncated;                // Arguments cut to DLOG_ARG_BYTES
+};
+
+// FNV-1a; constexpr so the compiler folds it for a literal
+constexpr uint32_t dlogHash(const char* s, uint32_t h = 2166136261u) {
+    return *s ? dlogHash(s + 1, (h ^ (uint8_t)*s) * 16777619u) : h;
+}
+
+// Serialises arguments as tag + bytes into a record
+class DeferredLogArgs {
+public:
+    DeferredLogArgs(uint8_t* data, uint8_t capacity)
+        : _data(data), _capacity(capacity), _len(0), _truncated(false) {}
+
+    void add() {}
+
+    template <typename T, typename... Rest>
+    void add(T value, Rest... rest) {
+        put(value);
+        add(rest...);
+    }
+
+    uint8_t length() const { return _len; }
+    bool truncated() const { return _truncated; }
+
+private:
+    uint8_t* _data;
+    uint8_t _capacity;
+    uint8_t _len;
+    bool _truncated;                   // Nothing more is added once set
+
+    void putRaw(char tag, const void* value, uint8_t size);
+    void put(const char* s);
+    void put(char* s) { put((const char*)s); }
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type
+    put(T value) {
+        if (sizeof(T) <= 4 && std::is_signed<T>::value) {
+            int32_t v = (int32_t)value;
+            putRaw(DLOG_ARG_INT, &v, 4);
+        } else if (sizeof(T) <= 4) {
+            uint32_t v = (uint32_t)value;
+            putRaw(DLOG_ARG_UINT, &v, 4);
+        } else if (std::is_signed<T>::value) {
+            int64_t v = (int64_t)value;
+            putRaw(DLOG_ARG_INT64, &v, 8);
+        } else {
+            uint64_t v = (uint64_t)value;
+            putRaw(DLOG_ARG_UINT64, &v, 8);
+        }
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_floating_point<T>::value>::type put(T value) {
+        double v = value;
+        putRaw(DLOG_ARG_DOUBLE, &v, 8);
+    }
+
+    template <typename T>
+    void put(T* pointer) {
+        uint64_t v = (uint64_t)(uintptr_t)pointer;
+        putRaw(DLOG_ARG_POINTER, &v, 8);
+    }
+};
+
+// Receives drained output (text lines or binary frames), one call each
+typedef void (*DeferredLogWriter)(const uint8_t* data, size_t len, void* context);
+
+class DeferredLog {
+public:
+    DeferredLog();
+
+    // Any task, no lock
+    template <typename... Args>
+    void record(uint8_t level, uint32_t id, const char* format, Args... args) {
+        uint32_t pos;
+        if (!claim(pos)) return;
+        Slot& slot = _slots[pos & (DLOG_SLOTS - 1)];
+        slot.level = level;
+        slot.id = id;
+        slot.format = format;
+        slot.ms = (uint32_t)(esp_timer_get_time() / 1000);
+        DeferredLogArgs packer(slot.data, DLOG_ARG_BYTES);
+        packer.add(args...);
+        slot.len = packer.length();
+        if (packer.truncated()) _truncated.fetch_add(1, std::memory_order_relaxed);
+        publish(pos);
+    }
+
+    // One consumer: writes every record published so far; returns how many
+    uint32_t drain(DeferredLogWriter write, void* context);
+
+    DeferredLogStats stats() const;
+
+    // printf of a record's arguments (text mode, and for tests)
+    static size_t format(char* out, size_t size, const char* format,
+                         const uint8_t* data, uint8_t len);
+
+private:
+    struct Slot {
+        std::atomic<uint32_t> seq;     // pos: free, pos + 1: published
+        uint32_t id;
+        const char* format;
+        uint32_t ms;
+        uint8_t level;
+        uint8_t len;
+        uint8_t data[DLOG_ARG_BYTES];
+    };
+
+    Slot _slots[DLOG_SLOTS];
+    std::atomic<uint32_t> _head;       // Next position to claim
+    uint32_t _tail;                    // Next position to drain (drain task only)
+    std::atomic<uint32_t> _records;
+    std::atomic<uint32_t> _dropped;
+    std::atomic<uint32_t> _truncated;
+    uint32_t _droppedReported;
+
+    bool claim(uint32_t& pos);
+    void publish(uint32_t pos);
+};
+
+extern DeferredLog deferredLog;
+
+#define DLOG_RECORD(level, format, ...) do { \
+        static constexpr uint32_t _dlogId = dlogHash(format); \
+        deferredLog.record(level, _dlogId, format, ##__VA_ARGS__); \
+    } while (0)
+
+#if DLOG_LEVEL >= DLOG_LEVEL_ERROR
+#define DLOG_ERROR(format, ...) DLOG_RECORD(DLOG_LEVEL_ERROR, format, ##__VA_ARGS__)
+#else
+#define DLOG_ERROR(format, ...) do {} while (0)
+#endif
+
+#if DLOG_LEVEL >= DLOG_LEVEL_WARN
+#define DLOG_WARN(format, ...) DLOG_RECORD(DLOG_LEVEL_WARN, format, ##__VA_ARGS__)
+#else
+#define DLOG_WARN(format, ...) do {} while (0)
+#endif
+
+#if DLOG_LEVEL >= DLOG_LEVEL_INFO
+#define DLOG_INFO(format, ...) DLOG_RECORD(DLOG_LEVEL_INFO, format, ##__VA_ARGS__)
+#else
+#define DLOG_INFO(format, ...) do {} while (0)
+#endif
+
+#if DLOG_LEVEL >= DLOG_LEVEL_DEBUG
+#define DLOG_DEBUG(format, ...) DLOG_RECORD(DLOG_LEVEL_DEBUG, format, ##__VA_ARGS__)
+#else
+#define DLOG_DEBUG(format, ...) do {} while (0)
+#endif
+
+#endif
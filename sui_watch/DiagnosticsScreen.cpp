@@ -0,0 +1,123 @@
+/**
+ * Diagnostics Screen Implementation
+ */
+
+#include <Arduino.h>
+#include "DiagnosticsScreen.h"
+#include "AppState.h"
+#include "Profiler.h"
+#include "TaskMonitor.h"
+
+extern TaskMonitor taskMonitor;
+
+DiagnosticsScreen diagnosticsScreen;
+
+DiagnosticsScreen::DiagnosticsScreen()
+    : _screen(nullptr), _table(nullptr), _footer(nullptr), _back(nullptr), _timer(nullptr) {
+}
+
+void DiagnosticsScreen::open(lv_obj_t* back) {
+    if (_screen) return;
+    _back = back;
+
+    _screen = lv_obj_create(nullptr);
+    lv_obj_set_style_bg_color(_screen, lv_color_hex(0x000000), 0);
+    lv_obj_add_event_cb(_screen, onTapped, LV_EVENT_SHORT_CLICKED, this);
+
+    lv_obj_t* title = lv_label_create(_screen);
+    lv_label_set_text(title, "Diagnostics (us)");
+    lv_obj_set_style_text_color(title, lv_color_hex(0x00ADB5), 0);
+    lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 24);
+
+    // span | p50 | p99 | max (+ header row); the round screen scrolls
+    _table = lv_table_create(_screen);
+    lv_table_set_col_cnt(_table, 4);
+    lv_table_set_col_width(_table, 0, 62);
+    for (uint16_t col = 1; col < 4; col++) {
+        lv_table_set_col_width(_table, col, 50);
+    }
+    lv_obj_set_style_text_font(_table, &lv_font_montserrat_14, LV_PART_ITEMS);
+    lv_obj_set_style_pad_ver(_table, 2, LV_PART_ITEMS);
+    lv_obj_set_style_pad_hor(_table, 3, LV_PART_ITEMS);
+    lv_obj_set_style_bg_opa(_table, LV_OPA_TRANSP, LV_PART_MAIN | LV_PART_ITEMS);
+    lv_obj_set_style_border_width(_table, 0, LV_PART_MAIN);
+    lv_obj_set_style_text_color(_table, lv_color_hex(0xFFFFFF), LV_PART_ITEMS);
+    lv_obj_add_flag(_table, LV_OBJ_FLAG_EVENT_BUBBLE);
+    lv_obj_align(_table, LV_ALIGN_TOP_MID, 0, 48);
+    lv_table_set_cell_value(_table, 0, 0, "span");
+    lv_table_set_cell_value(_table, 0, 1, "p50");
+    lv_table_set_cell_value(_table, 0, 2, "p99");
+    lv_table_set_cell_value(_table, 0, 3, "max");
+
+    _footer = lv_label_create(_screen);
+    lv_obj_set_style_text_color(_footer, lv_color_hex(0x808080), 0);
+    lv_obj_align_to(_footer, _table, LV_ALIGN_OUT_BOTTOM_MID, 0, 6);
+
+    refresh();
+    lv_scr_load(_screen);
+    _timer = lv_timer_create(timerCallback, DIAG_REFRESH_MS, this);
+    Serial.println("[DIAG] Diagnostics screen open");
+}
+
+void DiagnosticsScreen::close() {
+    if (!_screen) return;
+
+    lv_timer_del(_timer);
+    _timer = nullptr;
+    lv_scr_load(_back);
+    // Closed from the screen's own event: delete it once the event is done
+    lv_obj_del_async(_screen);
+    _screen = nullptr;
+    _table = nullptr;
+    _footer = nullptr;
+}
+
+void DiagnosticsScreen::refresh() {
+    char cell[12];
+    uint16_t row = 1;
+
+#if PROFILER_ENABLED
+    for (uint8_t span = 0; span < PROF_SPAN_COUNT; span++) {
+        SpanStats s;
+        if (!profiler.getStats(span, s) || s.count == 0) continue;
+        lv_table_set_cell_value(_table, row, 0, s.name);
+        snprintf(cell, sizeof(cell), "%lu", (unsigned long)s.p50Us);
+        lv_table_set_cell_value(_table, row, 1, cell);
+        snprintf(cell, sizeof(cell), "%lu", (unsigned long)s.p99Us);
+        lv_table_set_cell_value(_table, row, 2, cell);
+        snprintf(cell, sizeof(cell), "%lu", (unsigned long)s.maxUs);
+        lv_table_set_cell_value(_table, row, 3, cell);
+        row++;
+    }
+#else
+    lv_table_set_cell_value(_table, row++, 0, "profiler off");
+#endif
+    lv_table_set_row_cnt(_table, row);
+
+    // Task load under the table
+    char footer[64] = "";
+    size_t len = 0;
+    for (uint8_t id = 0; id < APP_TASK_COUNT && len < sizeof(footer); id++) {
+        TaskStats task;
+        if (!taskMonitor.getStats(id, task)) continue;
+        len += snprintf(footer + len, sizeof(footer) - len, "%s%s %u%%",
+                        len ? "  " : "", task.name, task.loopPct);
+    }
+#if PROFILER_ENABLED
+    if (len < sizeof(footer)) {
+        uint32_t ppm = profiler.overheadPpm();
+        snprintf(footer + len, sizeof(footer) - len, "%sprofiler %lu.%02lu%%", len ? "\n" : "",
+                 (unsigned long)(ppm / 10000), (unsigned long)(ppm / 100 % 100));
+    }
+#endif
+    lv_label_set_text(_footer, footer);
+    lv_obj_align_to(_footer, _table, LV_ALIGN_OUT_BOTTOM_MID, 0, 6);
+}
+
+void DiagnosticsScreen::timerCallback(lv_timer_t* timer) {
+    static_cast<DiagnosticsScreen*>(timer->user_data)->refresh();
+}
+
+void DiagnosticsScreen::onTapped(lv_event_t* e) {
+    static_cast<DiagnosticsScreen*>(lv_event_get_user_data(e))->close();
+}
@@ -0,0 +1,39 @@
+/**
+ * Diagnostics Screen
+ * Hidden screen (long-press the wallet screen) with the profiler's span
+ * table - count, p50, p99 and max per subsystem - and the loop time share
+ * of each app task. Refreshed once a second from an lv_timer while open;
+ * a tap returns to the screen it was opened from. UI task only.
+ */
+
+#ifndef DIAGNOSTICS_SCREEN_H
+#define DIAGNOSTICS_SCREEN_H
+
+#include <lvgl.h>
+
+#define DIAG_REFRESH_MS   1000
+
+class DiagnosticsScreen {
+public:
+    DiagnosticsScreen();
+
+    void open(lv_obj_t* back);
+    void close();
+    bool isOpen() { return _screen != nullptr; }
+
+private:
+    lv_obj_t* _screen;
+    lv_obj_t* _table;
+    lv_obj_t* _footer;
+    lv_obj_t* _back;
+    lv_timer_t* _timer;
+
+    void refresh();
+
+    static void timerCallback(lv_timer_t* timer);
+    static void onTapped(lv_event_t* e);
+};
+
+extern DiagnosticsScreen diagnosticsScreen;
+
+#endif
@@ -1,50 +0,0 @@
-/*****************************************************************************
-* | File        :   ImageData.h
-* | Author      :  
-* | Function    :   test Demo
-* | Info        :
-*----------------
-* |	This version:   V1.0
-* | Date        :   2021-03-16
-* | Info        :   
-#
-# Permission is hereby granted, free of charge, to any person obtaining a copy
-# of this software and associated documnetation files (the "Software"), to deal
-# in the Software without restriction, including without limitation the rights
-# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-# copies of the Software, and to permit persons to  whom the Software is
-# furished to do so, subject to the following conditions:
-#
-# The above copyright notice and this permission notice shall be included in
-# all copies or substantial portions of the Software.
-#
-# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-# THE SOFTWARE.
-******************************************************************************/
-
-#ifndef _IMAGEDATA_H_
-#define _IMAGEDATA_H_
-
-extern const unsigned char Signal816[];
-extern const unsigned char Msg816[];
-extern const unsigned char Bat816[];
-extern const unsigned char Bluetooth88[];
-extern const unsigned char GPRS88[];
-extern const unsigned char Alarm88[]; 
-
-extern const unsigned char gImage_0inch96_1[];
-extern const unsigned char gImage_1inch14_1[];
-extern const unsigned char gImage_1inch3_C_1[];
-extern const unsigned char gImage_1inch44_1[];
-extern const unsigned char gImage_1inch8_1[];
-extern const unsigned char gImage_1inch3_1[];
-extern const unsigned char gImage_2inch_1[];
-#endif
-/* FILE END */
-
-
@@ -26,13 +26,14 @@ parameter:
 ******************************************************************************/
 static void LCD_1IN28_Reset(void)
 {
+    // GC9A01: reset pulse >= 10 us, ready 120 ms after release
     DEV_Digital_Write(LCD_RST_PIN, 1);
-    DEV_Delay_ms(100);
+    DEV_Delay_ms(5);
     DEV_Digital_Write(LCD_RST_PIN, 0);
-    DEV_Delay_ms(100);
+    DEV_Delay_ms(10);
     DEV_Digital_Write(LCD_RST_PIN, 1);
 	DEV_Digital_Write(LCD_CS_PIN, 0);
-    DEV_Delay_ms(100);
+    DEV_Delay_ms(120);
 }
 
 /******************************************************************************
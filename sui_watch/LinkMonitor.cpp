@@ -0,0 +1,203 @@
+/**
+ * Link Monitor Implementation
+ */
+
+#include "LinkMonitor.h"
+
+LinkMonitor::LinkMonitor()
+    : _rttCount(0), _rttNext(0), _lastRx(0), _connectedAt(0), _lostAt(0), _lastMetrics(0),
+      _backoffArmedAt(0), _pingOutstanding(false), _pingSeq(0), _pingSentAt(0), _pingIdleMs(0),
+      _pongsStable(0), _missesInRow(0) {
+    memset(&_stats, 0, sizeof(_stats));
+    memset(_rtt, 0, sizeof(_rtt));
+    _stats.keepaliveMs = LINK_KEEPALIVE_START_MS;
+    _stats.nextBackoffMs = LINK_BACKOFF_MIN_MS;
+}
+
+// ============================================
+// Connection Lifecycle
+// ============================================
+
+uint32_t LinkMonitor::onConnecting(unsigned long now) {
+    _lostAt = now;
+    _stats.reconnectAttempt = 0;
+    return armBackoff(now);
+}
+
+void LinkMonitor::onConnected(unsigned long now) {
+    _stats.connects++;
+    _connectedAt = now;
+    _lastRx = now;
+    _pingOutstanding = false;
+    _missesInRow = 0;
+    _backoffArmedAt = 0;
+}
+
+void LinkMonitor::onAuthenticated(unsigned long now) {
+    _stats.authentications++;
+    _stats.authMs = now - _connectedAt;
+    if (_lostAt != 0) {
+        _stats.outageMs = now - _lostAt;
+        _lostAt = 0;
+    }
+    _stats.reconnectAttempt = 0;
+    _stats.nextBackoffMs = LINK_BACKOFF_MIN_MS;
+    _lastMetrics = 0;  // Report soon after every new session
+}
+
+uint32_t LinkMonitor::onDisconnected(unsigned long now) {
+    if (_connectedAt != 0) {
+        _stats.disconnects++;
+        _connectedAt = 0;
+    }
+    if (_lostAt == 0) {
+        _lostAt = now;
+    }
+    _pingOutstanding = false;
+    _pongsStable = 0;
+    return armBackoff(now);
+}
+
+uint32_t LinkMonitor::checkReconnect(unsigned long now) {
+    // The socket library retries on its own and only reports sessions that
+    // got through the handshake, so a retry window that ran out while still
+    // offline means the attempt failed
+    if (_backoffArmedAt == 0 || now - _backoffArmedAt <= _stats.nextBackoffMs) {
+        return 0;
+    }
+    _stats.reconnectAttempt++;
+    return armBackoff(now);
+}
+
+uint32_t LinkMonitor::armBackoff(unsigned long now) {
+    uint32_t ceiling = LINK_BACKOFF_MIN_MS;
+    for (uint32_t i = 0; i < _stats.reconnectAttempt && ceiling < LINK_BACKOFF_MAX_MS; i++) {
+        ceiling *= 2;
+    }
+    if (ceiling > LINK_BACKOFF_MAX_MS) ceiling = LINK_BACKOFF_MAX_MS;
+
+    // Jitter over the upper half so devices spread out but still back off
+    _stats.nextBackoffMs = ceiling / 2 + random(ceiling / 2 + 1);
+    _backoffArmedAt = now ? now : 1;
+    return _stats.nextBackoffMs;
+}
+
+void LinkMonitor::onRx(size_t bytes, unsigned long now) {
+    _stats.rxBytes += bytes;
+    _lastRx = now;
+}
+
+// ============================================
+// Adaptive Keepalive
+// ============================================
+
+bool LinkMonitor::pingDue(unsigned long now) const {
+    return !_pingOutstanding && now - _lastRx >= _stats.keepaliveMs;
+}
+
+uint32_t LinkMonitor::beginPing(unsigned long now) {
+    _pingSeq++;
+    _pingOutstanding = true;
+    _pingSentAt = now;
+    _pingIdleMs = now - _lastRx;
+    _stats.pings++;
+    return _pingSeq;
+}
+
+void LinkMonitor::onPong(uint32_t seq, unsigned long now) {
+    if (!_pingOutstanding || seq != _pingSeq) {
+        return;  // Late reply to a ping already written off
+    }
+
+    uint32_t rtt = now - _pingSentAt;
+    _rtt[_rttNext] = rtt > 0xFFFF ? 0xFFFF : (uint16_t)rtt;
+    _rttNext = (_rttNext + 1) % LINK_RTT_SAMPLES;
+    if (_rttCount < LINK_RTT_SAMPLES) _rttCount++;
+
+    _stats.rttLastMs = rtt;
+    _stats.pongs++;
+    _pingOutstanding = false;
+    _missesInRow = 0;
+
+    // The idle gap this ping tested survived
+    if (_pingIdleMs >= _stats.keepaliveMs && ++_pongsStable >= LINK_KEEPALIVE_STABLE) {
+        _pongsStable = 0;
+        growKeepalive();
+    }
+}
+
+bool LinkMonitor::checkPongTimeout(unsigned long now) {
+    if (!_pingOutstanding || now - _pingSentAt < LINK_PONG_TIMEOUT_MS) {
+        return false;
+    }
+
+    _pingOutstanding = false;
+    _pongsStable = 0;
+    _stats.pongsMissed++;
+    _missesInRow++;
+
+    // Whatever sits between us and the server forgot the flow within this gap
+    if (_stats.natTimeoutMs == 0 || _pingIdleMs < _stats.natTimeoutMs) {
+        _stats.natTimeoutMs = _pingIdleMs;
+    }
+    uint32_t halved = _stats.natTimeoutMs / 2;
+    _stats.keepaliveMs = halved < LINK_KEEPALIVE_MIN_MS ? LINK_KEEPALIVE_MIN_MS : halved;
+
+    Serial.printf("[LINK] Pong missed after %lu ms idle, keepalive now %lu ms\n",
+                  (unsigned long)_pingIdleMs, (unsigned long)_stats.keepaliveMs);
+
+    return _missesInRow >= LINK_PONG_MISSES_MAX;
+}
+
+void LinkMonitor::growKeepalive() {
+    uint32_t ceiling = LINK_KEEPALIVE_MAX_MS;
+    if (_stats.natTimeoutMs != 0) {
+        // Sitting at the cap without losses: the estimate may be from a
+        // one-off drop, so let it creep back up
+        if (_stats.keepaliveMs >= _stats.natTimeoutMs * 3 / 4) {
+            _stats.natTimeoutMs += _stats.natTimeoutMs / 4;
+        }
+        ceiling = min(ceiling, _stats.natTimeoutMs * 3 / 4);
+    }
+
+    uint32_t next = _stats.keepaliveMs + _stats.keepaliveMs / 4;
+    if (next > ceiling) next = ceiling;
+    if (next < LINK_KEEPALIVE_MIN_MS) next = LINK_KEEPALIVE_MIN_MS;
+
+    if (next != _stats.keepaliveMs) {
+        Serial.printf("[LINK] Keepalive %lu -> %lu ms\n",
+                      (unsigned long)_stats.keepaliveMs, (unsigned long)next);
+        _stats.keepaliveMs = next;
+    }
+}
+
+// ============================================
+// Metrics
+// ============================================
+
+bool LinkMonitor::metricsDue(unsigned long now) const {
+    // First report of a session goes out once the handshake has settled
+    if (_lastMetrics == 0) return now - _connectedAt >= LINK_KEEPALIVE_MIN_MS;
+    return now - _lastMetrics >= LINK_METRICS_INTERVAL_MS;
+}
+
+uint32_t LinkMonitor::rttPercentile(uint8_t percent) const {
+    if (_rttCount == 0) return 0;
+
+    uint16_t sorted[LINK_RTT_SAMPLES];
+    memcpy(sorted, _rtt, sizeof(uint16_t) * _rttCount);
+
+    // Insertion sort - 32 samples at most
+    for (uint8_t i = 1; i < _rttCount; i++) {
+        uint16_t v = sorted[i];
+        int j = i - 1;
+        while (j >= 0 && sorted[j] > v) {
+            sorted[j + 1] = sorted[j];
+            j--;
+        }
+        sorted[j + 1] = v;
+    }
+
+    uint8_t index = (uint8_t)(((uint32_t)(_rttCount - 1) * percent + 50) / 100);
+    return sorted[index];
+}
@@ -0,0 +1,103 @@
+/**
+ * Link Monitor for the Trust Oracle connection
+ * Measures round-trip time from ping/pong, adapts the keepalive interval
+ * to the idle timeout the network actually enforces (NAT/firewall), and
+ * spaces reconnects with jittered exponential backoff so a fleet does not
+ * reconnect in lockstep after a server restart.
+ *
+ * Keepalive: a ping is only sent after the link has been quiet for the
+ * current interval. Each answered ping proves that idle gap is safe; after
+ * a few in a row the interval grows by 25%. A ping that goes unanswered
+ * marks its idle gap as the NAT timeout estimate and the interval drops to
+ * half of it. Growth never goes past 3/4 of the estimate.
+ */
+
+#ifndef LINK_MONITOR_H
+#define LINK_MONITOR_H
+
+#include <Arduino.h>
+
+#define LINK_RTT_SAMPLES        32      // Ring buffer for percentiles
+#define LINK_KEEPALIVE_START_MS 30000   // First guess
+#define LINK_KEEPALIVE_MIN_MS   15000
+#define LINK_KEEPALIVE_MAX_MS   240000
+#define LINK_KEEPALIVE_STABLE   3       // Pongs in a row before growing
+#define LINK_PONG_TIMEOUT_MS    10000
+#define LINK_PONG_MISSES_MAX    2       // Missed pongs before the link is dropped
+#define LINK_BACKOFF_MIN_MS     1000
+#define LINK_BACKOFF_MAX_MS     60000
+#define LINK_METRICS_INTERVAL_MS 300000 // Metrics message to the server
+
+struct LinkStats {
+    uint32_t connects;          // WebSocket connections established
+    uint32_t disconnects;
+    uint32_t authentications;
+    uint32_t reconnectAttempt;  // Attempts since the last good session
+    uint32_t txBytes;
+    uint32_t rxBytes;
+    uint32_t pings;
+    uint32_t pongs;
+    uint32_t pongsMissed;
+    uint32_t rttLastMs;
+    uint32_t keepaliveMs;       // Current adaptive interval
+    uint32_t natTimeoutMs;      // Estimated idle timeout, 0 = none observed
+    uint32_t authMs;            // WS connected -> authenticated
+    uint32_t outageMs;          // Link lost -> authenticated again
+    uint32_t nextBackoffMs;     // Reconnect delay currently armed
+};
+
+class LinkMonitor {
+public:
+    LinkMonitor();
+
+    // Connection lifecycle. Calls returning uint32_t hand back the reconnect
+    // delay to arm (checkReconnect: 0 = leave it as is)
+    uint32_t onConnecting(unsigned long now);
+    void onConnected(unsigned long now);
+    void onAuthenticated(unsigned long now);
+    uint32_t onDisconnected(unsigned long now);
+    uint32_t checkReconnect(unsigned long now);  // Poll while offline
+
+    // Traffic accounting (any received frame counts as link activity)
+    void onTx(size_t bytes) { _stats.txBytes += bytes; }
+    void onRx(size_t bytes, unsigned long now);
+
+    // Keepalive
+    bool pingDue(unsigned long now) const;
+    uint32_t beginPing(unsigned long now);      // Returns the ping sequence number
+    void onPong(uint32_t seq, unsigned long now);
+    bool checkPongTimeout(unsigned long now);   // true = too many misses, drop the link
+
+    // Metrics message schedule
+    bool metricsDue(unsigned long now) const;
+    void metricsSent(unsigned long now) { _lastMetrics = now; }
+
+    // RTT percentile over the last LINK_RTT_SAMPLES pongs (0 = no samples)
+    uint32_t rttPercentile(uint8_t percent) const;
+    const LinkStats& stats() const { return _stats; }
+
+private:
+    LinkStats _stats;
+
+    uint16_t _rtt[LINK_RTT_SAMPLES];
+    uint8_t _rttCount;
+    uint8_t _rttNext;
+
+    unsigned long _lastRx;
+    unsigned long _connectedAt;
+    unsigned long _lostAt;          // 0 = no outage in progress
+    unsigned long _lastMetrics;
+    unsigned long _backoffArmedAt;  // 0 = online
+
+    bool _pingOutstanding;
+    uint32_t _pingSeq;
+    unsigned long _pingSentAt;
+    uint32_t _pingIdleMs;           // Quiet time the ping is testing
+    uint8_t _pongsStable;
+    uint8_t _missesInRow;
+
+    uint32_t armBackoff(unsigned long now);
+    void growKeepalive();
+};
+
+#endif
@@ -4,6 +4,7 @@
 
 #include <Arduino.h>
 #include "LoadingOverlay.h"
+#include "Tracer.h"
 
 LoadingOverlay::LoadingOverlay() {
     overlay = nullptr;
@@ -17,6 +18,8 @@ void LoadingOverlay::show(const char* message) {
         updateMessage(message);
         return;
     }
+    TRACE_BEGIN("loading");
+    TRACE_SCOPE("overlay show");
 
     // Create full-screen overlay
     overlay = lv_obj_create(lv_scr_act());
@@ -68,6 +71,7 @@ void LoadingOverlay::hide() {
     }
 
     lv_obj_del(overlay);
+    TRACE_END("loading");
     overlay = nullptr;
     spinner = nullptr;
     label = nullptr;
@@ -0,0 +1,199 @@
+/**
+ * Oracle Endpoint List Implementation
+ */
+
+#include "OracleEndpoints.h"
+#include "Clock.h"
+#include <Preferences.h>
+
+OracleEndpoints::OracleEndpoints()
+    : _count(0), _current(0), _failovers(0), _probing(false) {
+    _lock = portMUX_INITIALIZER_UNLOCKED;
+    memset(_endpoints, 0, sizeof(_endpoints));
+}
+
+void OracleEndpoints::load(const char* fallbackHost, uint16_t fallbackPort) {
+    Preferences prefs;
+    prefs.begin("oracle", true);  // Read-only mode
+    String list = prefs.getString("endpoints", "");
+    prefs.end();
+
+    _count = 0;
+    if (list.length() > 0 && parse(list.c_str())) {
+        Serial.printf("[ENDPOINT] %d endpoint(s) from flash\n", _count);
+    } else {
+        add(fallbackHost, fallbackPort);
+    }
+
+    for (int i = 0; i < _count; i++) {
+        Serial.printf("[ENDPOINT]   #%d %s:%u\n", i, _endpoints[i].host, _endpoints[i].port);
+    }
+    _current = 0;
+}
+
+bool OracleEndpoints::store(const char* list) {
+    OracleEndpoints check;
+    if (!check.parse(list)) {
+        Serial.println("[ENDPOINT] ✗ Invalid endpoint list, not saved");
+        return false;
+    }
+
+    Preferences prefs;
+    prefs.begin("oracle", false);  // Read-write mode
+    String saved = prefs.getString("endpoints", "");
+    if (saved != list) {
+        prefs.putString("endpoints", list);
+        Serial.println("[ENDPOINT] ✓ Endpoint list saved to flash");
+    }
+    prefs.end();
+    return true;
+}
+
+bool OracleEndpoints::add(const char* host, uint16_t port) {
+    if (_count >= ORACLE_MAX_ENDPOINTS || !host || strlen(host) == 0 || port == 0) {
+        return false;
+    }
+    OracleEndpoint& ep = _endpoints[_count];
+    memset(&ep, 0, sizeof(ep));
+    strncpy(ep.host, host, sizeof(ep.host) - 1);
+    ep.port = port;
+    _count++;
+    return true;
+}
+
+bool OracleEndpoints::parse(const char* list) {
+    char entry[80];
+    const char* p = list;
+
+    while (*p) {
+        const char* end = strchr(p, ',');
+        size_t len = end ? (size_t)(end - p) : strlen(p);
+        if (len > 0 && len < sizeof(entry)) {
+            memcpy(entry, p, len);
+            entry[len] = '\0';
+
+            char* colon = strrchr(entry, ':');
+            if (colon) {
+                *colon = '\0';
+                add(entry, (uint16_t)atoi(colon + 1));
+            }
+        }
+        if (!end) break;
+        p = end + 1;
+    }
+    return _count > 0;
+}
+
+// ============================================
+// Latency Probe
+// ============================================
+
+void OracleEndpoints::startProbe() {
+    if (_probing || _count == 0) return;
+
+    _probing = true;
+    BaseType_t created = xTaskCreatePinnedToCore(
+        probeTaskEntry, "ep_probe", ORACLE_PROBE_TASK_STACK, this, 1, nullptr, 0);
+    if (created != pdPASS) {
+        _probing = false;
+        Serial.println("[ENDPOINT] ✗ Failed to start probe task");
+    }
+}
+
+void OracleEndpoints::probeTaskEntry(void* arg) {
+    OracleEndpoints* self = static_cast<OracleEndpoints*>(arg);
+    self->probeAll();
+    self->_probing = false;
+    vTaskDelete(NULL);
+}
+
+void OracleEndpoints::probeAll() {
+    for (int i = 0; i < _count; i++) {
+        WiFiClient client;
+        uint32_t start = appClock->millis();
+        bool reachable = client.connect(_endpoints[i].host, _endpoints[i].port, ORACLE_PROBE_TIMEOUT_MS);
+        uint32_t elapsed = appClock->millis() - start;
+        client.stop();
+
+        portENTER_CRITICAL(&_lock);
+        _endpoints[i].probed = true;
+        _endpoints[i].reachable = reachable;
+        _endpoints[i].probeMs = elapsed;
+        portEXIT_CRITICAL(&_lock);
+
+        Serial.printf("[ENDPOINT] Probe %s:%u %s (%lu ms)\n", _endpoints[i].host, _endpoints[i].port,
+                      reachable ? "✓" : "✗ unreachable", (unsigned long)elapsed);
+    }
+}
+
+// ============================================
+// Selection & Health
+// ============================================
+
+bool OracleEndpoints::inCooldown(int index, unsigned long now) const {
+    const OracleEndpoint& ep = _endpoints[index];
+    if (ep.consecutiveFailures == 0) return false;
+
+    uint32_t cooldown = ORACLE_COOLDOWN_MIN_MS;
+    for (uint32_t i = 1; i < ep.consecutiveFailures && cooldown < ORACLE_COOLDOWN_MAX_MS; i++) {
+        cooldown *= 2;
+    }
+    if (cooldown > ORACLE_COOLDOWN_MAX_MS) cooldown = ORACLE_COOLDOWN_MAX_MS;
+    return now - ep.lastFailureAt < cooldown;
+}
+
+int OracleEndpoints::select(unsigned long now) {
+    int best = -1;
+    uint32_t bestScore = UINT32_MAX;
+
+    portENTER_CRITICAL(&_lock);
+    for (int i = 0; i < _count; i++) {
+        if (inCooldown(i, now)) continue;
+
+        const OracleEndpoint& ep = _endpoints[i];
+        // Unprobed endpoints rank behind measured ones, unreachable ones last
+        uint32_t score = !ep.probed ? ORACLE_PROBE_TIMEOUT_MS
+                       : ep.reachable ? ep.probeMs
+                       : ORACLE_PROBE_TIMEOUT_MS * 2;
+        if (score < bestScore) {
+            bestScore = score;
+            best = i;
+        }
+    }
+    portEXIT_CRITICAL(&_lock);
+
+    if (best < 0) {
+        // Everything is cooling down: take the one that failed longest ago
+        for (int i = 0; i < _count; i++) {
+            if (best < 0 || _endpoints[i].lastFailureAt < _endpoints[best].lastFailureAt) {
+                best = i;
+            }
+        }
+    }
+    return best < 0 ? 0 : best;
+}
+
+void OracleEndpoints::recordSession(uint32_t authMs) {
+    OracleEndpoint& ep = _endpoints[_current];
+    ep.sessions++;
+    ep.consecutiveFailures = 0;
+    ep.lastAuthMs = authMs;
+}
+
+void OracleEndpoints::recordDrop() {
+    _endpoints[_current].drops++;
+}
+
+void OracleEndpoints::recordFailure(unsigned long now) {
+    OracleEndpoint& ep = _endpoints[_current];
+    ep.failures++;
+    ep.consecutiveFailures++;
+    ep.lastFailureAt = now;
+}
+
+bool OracleEndpoints::shouldFailover(unsigned long now) {
+    if (_count < 2 || _endpoints[_current].consecutiveFailures < ORACLE_FAILOVER_AFTER) {
+        return false;
+    }
+    return select(now) != _current;
+}
@@ -0,0 +1,92 @@
+/**
+ * Oracle Endpoint List for ESP32
+ * Keeps the Trust Oracle servers the watch may use, picks the fastest
+ * healthy one and decides when to fail over to another.
+ *
+ * The list is stored in NVS ("oracle" namespace, key "endpoints") as
+ * "host:port,host:port". When nothing is stored the compiled-in
+ * ORACLE_HOST:ORACLE_PORT is the only entry.
+ *
+ * Handshake latency is probed with a plain TCP connect on a one-shot
+ * background task, so the loop never blocks on an unreachable server.
+ * An endpoint that fails is skipped for a cooldown that doubles with each
+ * consecutive failure.
+ */
+
+#ifndef ORACLE_ENDPOINTS_H
+#define ORACLE_ENDPOINTS_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+#define ORACLE_MAX_ENDPOINTS      4
+#define ORACLE_PROBE_TIMEOUT_MS   1500   // Per endpoint TCP connect
+#define ORACLE_PROBE_TASK_STACK   4096
+#define ORACLE_FAILOVER_AFTER     1      // Failed reconnects before switching
+#define ORACLE_COOLDOWN_MIN_MS    5000
+#define ORACLE_COOLDOWN_MAX_MS    300000
+
+struct OracleEndpoint {
+    char host[64];
+    uint16_t port;
+
+    // Health
+    bool probed;
+    bool reachable;            // Last probe connected
+    uint32_t probeMs;          // Last TCP handshake time
+    uint32_t sessions;         // Authenticated sessions
+    uint32_t drops;            // Sessions that ended
+    uint32_t failures;         // Connection attempts that never got through
+    uint32_t consecutiveFailures;
+    uint32_t lastAuthMs;       // Connect -> authenticated on the last session
+    unsigned long lastFailureAt;
+};
+
+class OracleEndpoints {
+public:
+    OracleEndpoints();
+
+    // Load the NVS list, falling back to a single compiled-in endpoint
+    void load(const char* fallbackHost, uint16_t fallbackPort);
+
+    // Persist a "host:port,host:port" list (takes effect on next load)
+    static bool store(const char* list);
+
+    // Background TCP probe of every endpoint
+    void startProbe();
+    bool isProbing() const { return _probing; }
+
+    // Best available endpoint (lowest latency outside its cooldown)
+    int select(unsigned long now);
+    int current() const { return _current; }
+    void setCurrent(int index) { _current = index; }
+    const OracleEndpoint& get(int index) const { return _endpoints[index]; }
+    int count() const { return _count; }
+
+    // Health bookkeeping for the current endpoint
+    void recordSession(uint32_t authMs);
+    void recordDrop();
+    void recordFailure(unsigned long now);
+
+    // Current endpoint has failed enough and another one is usable
+    bool shouldFailover(unsigned long now);
+    uint32_t getFailovers() const { return _failovers; }
+    void countFailover() { _failovers++; }
+
+private:
+    OracleEndpoint _endpoints[ORACLE_MAX_ENDPOINTS];
+    int _count;
+    int _current;
+    uint32_t _failovers;
+
+    volatile bool _probing;
+    portMUX_TYPE _lock;          // Probe task writes probe fields
+
+    bool add(const char* host, uint16_t port);
+    bool parse(const char* list);
+    bool inCooldown(int index, unsigned long now) const;
+    static void probeTaskEntry(void* arg);
+    void probeAll();
+};
+
+#endif
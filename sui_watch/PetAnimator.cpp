@@ -0,0 +1,190 @@
+/**
+ * Pet Animator Implementation
+ */
+
+#include "PetAnimator.h"
+#include "AssetStore.h"
+#include "Tracer.h"
+
+// ============================================
+// Clip Table
+// ============================================
+
+static const PetAnimFrame IDLE_FRAMES[] = {
+    { PET_SPRITE_IDLE1, 600 }, { PET_SPRITE_IDLE2, 200 },
+    { PET_SPRITE_IDLE3, 200 }, { PET_SPRITE_IDLE2, 200 },
+};
+
+// Idle cycle at a trot
+static const PetAnimFrame WALK_FRAMES[] = {
+    { PET_SPRITE_IDLE1, 120 }, { PET_SPRITE_IDLE2, 120 },
+    { PET_SPRITE_IDLE3, 120 }, { PET_SPRITE_IDLE2, 120 },
+};
+
+static const PetAnimFrame EAT_FRAMES[] = {
+    { PET_SPRITE_EAT1, 250 }, { PET_SPRITE_EAT2, 250 },
+    { PET_SPRITE_EAT3, 250 }, { PET_SPRITE_EAT4, 250 },
+};
+
+static const PetAnimFrame PLAY_FRAMES[] = {
+    { PET_SPRITE_PLAY1, 200 }, { PET_SPRITE_PLAY2, 200 },
+    { PET_SPRITE_PLAY3, 200 }, { PET_SPRITE_PLAY4, 200 },
+};
+
+static const PetAnimFrame SLEEP_FRAMES[] = {
+    { PET_SPRITE_IDLE1, 1500 }, { PET_SPRITE_IDLE3, 1500 },
+};
+
+// Flicker through every pose, then settle
+static const PetAnimFrame EVOLVE_FRAMES[] = {
+    { PET_SPRITE_IDLE1, 80 }, { PET_SPRITE_PLAY1, 80 }, { PET_SPRITE_EAT2, 80 },
+    { PET_SPRITE_PLAY3, 80 }, { PET_SPRITE_IDLE2, 80 }, { PET_SPRITE_PLAY2, 80 },
+    { PET_SPRITE_EAT4, 80 }, { PET_SPRITE_PLAY4, 80 }, { PET_SPRITE_PLAY1, 600 },
+};
+
+static const PetAnimFrame HAPPY_FRAMES[] = {
+    { PET_SPRITE_PLAY1, 150 }, { PET_SPRITE_PLAY2, 150 },
+    { PET_SPRITE_PLAY1, 150 }, { PET_SPRITE_PLAY2, 150 }, { PET_SPRITE_PLAY3, 400 },
+};
+
+static const PetAnimFrame SAD_FRAMES[] = {
+    { PET_SPRITE_IDLE3, 900 }, { PET_SPRITE_IDLE2, 900 }, { PET_SPRITE_IDLE3, 900 },
+};
+
+#define FRAMES(list) list, (uint8_t)(sizeof(list) / sizeof(list[0]))
+
+// Indexed by PetAnimation
+static const PetAnimClip CLIPS[ANIM_COUNT] = {
+    //  name      frames                 loop   hold   next        prio busy   tint              opa
+    { "idle",   FRAMES(IDLE_FRAMES),   true,  0,     ANIM_IDLE,  0,   false, PET_ANIM_NO_TINT, 0   },
+    { "walk",   FRAMES(WALK_FRAMES),   true,  2000,  ANIM_IDLE,  1,   false, PET_ANIM_NO_TINT, 0   },
+    { "eat",    FRAMES(EAT_FRAMES),    true,  20000, ANIM_IDLE,  2,   true,  PET_ANIM_NO_TINT, 0   },
+    { "play",   FRAMES(PLAY_FRAMES),   true,  20000, ANIM_IDLE,  2,   true,  PET_ANIM_NO_TINT, 0   },
+    { "sleep",  FRAMES(SLEEP_FRAMES),  true,  12000, ANIM_IDLE,  1,   false, 0x1A237E,         100 },
+    { "evolve", FRAMES(EVOLVE_FRAMES), false, 0,     ANIM_HAPPY, 3,   true,  0xFFD700,         120 },
+    { "happy",  FRAMES(HAPPY_FRAMES),  false, 0,     ANIM_IDLE,  1,   false, PET_ANIM_NO_TINT, 0   },
+    { "sad",    FRAMES(SAD_FRAMES),    false, 0,     ANIM_IDLE,  1,   false, 0x37474F,         80  },
+};
+
+static_assert(sizeof(CLIPS) / sizeof(CLIPS[0]) == ANIM_COUNT, "One clip per PetAnimation");
+
+const PetAnimClip& PetAnimator::clip(PetAnimation anim) {
+    return CLIPS[anim < ANIM_COUNT ? anim : ANIM_IDLE];
+}
+
+// ============================================
+// Playback
+// ============================================
+
+PetAnimator::PetAnimator()
+    : _image(nullptr), _timer(nullptr), _current(ANIM_IDLE), _queued(ANIM_COUNT),
+      _frame(0), _clipStart(0), _shown(nullptr), _frameChanges(0) {
+    memset(_sprites, 0, sizeof(_sprites));
+}
+
+void PetAnimator::begin(lv_obj_t* image) {
+    _image = image;
+
+    // Sprites missing from the pack are skipped: the widget keeps its image
+    int missing = 0;
+    for (int i = 0; i < PET_SPRITE_COUNT; i++) {
+        _sprites[i] = assetStore.image(PET_SPRITE_ASSETS[i]);
+        if (!_sprites[i]) missing++;
+    }
+    if (missing > 0) {
+        Serial.printf("[ANIM] ⚠️ %d of %d pet sprites not in the asset pack\n", missing, PET_SPRITE_COUNT);
+    }
+
+    if (!_timer) {
+        _timer = lv_timer_create(timerCallback, CLIPS[ANIM_IDLE].frames[0].durationMs, this);
+    }
+    start(ANIM_IDLE);
+    Serial.println("[ANIM] ✓ Pet animator ready");
+}
+
+void PetAnimator::play(PetAnimation anim) {
+    if (anim >= ANIM_COUNT) return;
+
+    // Outranked by the clip on screen: run it afterwards (only idle loops
+    // forever, and nothing ranks below idle)
+    if (CLIPS[anim].priority < CLIPS[_current].priority) {
+        if (_queued == ANIM_COUNT || CLIPS[anim].priority >= CLIPS[_queued].priority) {
+            _queued = anim;
+        }
+        return;
+    }
+    start(anim);
+}
+
+bool PetAnimator::isBusy() {
+    return CLIPS[_current].busy || (_queued != ANIM_COUNT && CLIPS[_queued].busy);
+}
+
+void PetAnimator::start(PetAnimation anim) {
+    const PetAnimClip& next = CLIPS[anim];
+    if (anim != _current) {
+        Serial.printf("[ANIM] %s -> %s\n", CLIPS[_current].name, next.name);
+    }
+
+    // Recolour once per clip, not per frame
+    if (_image) {
+        bool tinted = next.tint != PET_ANIM_NO_TINT;
+        if (tinted) {
+            lv_obj_set_style_img_recolor(_image, lv_color_hex(next.tint), LV_PART_MAIN);
+        }
+        lv_obj_set_style_img_recolor_opa(_image, tinted ? next.tintOpa : LV_OPA_TRANSP, LV_PART_MAIN);
+    }
+
+    _current = anim;
+    _frame = 0;
+    _clipStart = lv_tick_get();
+    show(next.frames[0]);
+    if (_timer) {
+        lv_timer_reset(_timer);
+    }
+}
+
+void PetAnimator::show(const PetAnimFrame& frame) {
+    if (_timer) {
+        lv_timer_set_period(_timer, frame.durationMs);
+    }
+
+    // Loops of one pose (and clip changes onto the same pose) cost nothing
+    const lv_img_dsc_t* sprite = _sprites[frame.sprite];
+    if (!_image || !sprite || sprite == _shown) return;
+    lv_img_set_src(_image, sprite);
+    _shown = sprite;
+    _frameChanges++;
+}
+
+void PetAnimator::finish() {
+    PetAnimation next = CLIPS[_current].next;
+    if (_queued != ANIM_COUNT) {
+        next = _queued;
+        _queued = ANIM_COUNT;
+    }
+    start(next);
+}
+
+void PetAnimator::step() {
+    TRACE_SCOPE("anim");
+    const PetAnimClip& now = CLIPS[_current];
+
+    if (_frame + 1 < now.frameCount) {
+        show(now.frames[++_frame]);
+        return;
+    }
+
+    // Clip boundary: one-shots end, timed loops end once their hold is up
+    bool holdOver = now.holdMs != 0 && lv_tick_elaps(_clipStart) >= now.holdMs;
+    if (!now.loop || holdOver) {
+        finish();
+        return;
+    }
+    _frame = 0;
+    show(now.frames[0]);
+}
+
+void PetAnimator::timerCallback(lv_timer_t* timer) {
+    static_cast<PetAnimator*>(timer->user_data)->step();
+}
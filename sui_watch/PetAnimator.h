@@ -0,0 +1,84 @@
+/**
+ * Pet Animator for LVGL
+ * Table-driven clips for the pet image: each animation is a list of
+ * frames with their own durations, plays once or loops (for a while or
+ * forever) and names the clip that follows it. One lv_timer steps the
+ * current clip, re-armed to the duration of the frame on screen, so
+ * nothing is polled and lv_img_set_src only runs when the picture
+ * actually changes. Frames name sprites (pet_sprites.h); their pixels
+ * come from the asset pack, resolved once in begin().
+ *
+ * A clip of lower priority than the one playing waits for it to end
+ * instead of cutting it short (feeding into an evolution shows the
+ * sparkle, then the meal). UI task only.
+ */
+
+#ifndef PET_ANIMATOR_H
+#define PET_ANIMATOR_H
+
+#include <lvgl.h>
+#include "VirtualPet.h"
+#include "pet_sprites.h"
+
+#define PET_ANIM_NO_TINT    0xFF000000   // PetAnimClip::tint: draw the sprite as is
+
+struct PetAnimFrame {
+    uint8_t sprite;                   // PetSprite
+    uint16_t durationMs;
+};
+
+struct PetAnimClip {
+    const char* name;
+    const PetAnimFrame* frames;
+    uint8_t frameCount;
+    bool loop;
+    uint16_t holdMs;                  // Looping clips: time before `next` (0 = forever)
+    PetAnimation next;                // Played when this clip ends
+    uint8_t priority;                 // Lower clips queue behind this one
+    bool busy;                        // Feed/play refused while it shows
+    uint32_t tint;                    // 0xRRGGBB recolour, or PET_ANIM_NO_TINT
+    uint8_t tintOpa;
+};
+
+class PetAnimator {
+public:
+    PetAnimator();
+
+    // Attach to the pet image widget and start idling
+    void begin(lv_obj_t* image);
+
+    // Start a clip now, or after the current one if it outranks it
+    void play(PetAnimation anim);
+
+    PetAnimation current() { return _current; }
+    bool isPlaying(PetAnimation anim) { return _current == anim; }
+    bool isBusy();                    // Current or queued clip blocks actions
+
+    // Frames actually pushed to the image (not timer ticks)
+    uint32_t getFrameChanges() { return _frameChanges; }
+
+    static const PetAnimClip& clip(PetAnimation anim);
+
+private:
+    lv_obj_t* _image;
+    lv_timer_t* _timer;
+    const lv_img_dsc_t* _sprites[PET_SPRITE_COUNT];   // From the asset pack
+
+    PetAnimation _current;
+    PetAnimation _queued;             // ANIM_COUNT = nothing waiting
+    uint8_t _frame;
+    uint32_t _clipStart;              // lv_tick_get() at the first frame
+    const lv_img_dsc_t* _shown;
+    uint32_t _frameChanges;
+
+    void start(PetAnimation anim);
+    void show(const PetAnimFrame& frame);
+    void finish();
+    void step();
+
+    static void timerCallback(lv_timer_t* timer);
+};
+
+extern PetAnimator petAnimator;
+
+#endif
@@ -0,0 +1,296 @@
+/**
+ * Pet Balancing Rules
+ * Every number that shapes the pet economy - cooldowns, evolution
+ * thresholds, decay periods, action effects, step rewards, mood limits -
+ * in one constexpr table, together with the closed-form stat functions
+ * that read it and the transitions (settle, feed, play, evolve) that
+ * apply it. The firmware compiles this in; the host simulator in
+ * pet-simulator/ includes the same file, so a tuning change is tested
+ * against exactly what ships.
+ *
+ * Plain C++11 with no Arduino or LVGL dependency: keep it that way.
+ * The server mirrors the evolution thresholds (petManager.mjs).
+ */
+
+#ifndef PET_RULES_H
+#define PET_RULES_H
+
+#include <stdint.h>
+
+#define PET_LEVEL_COUNT 5             // Egg, baby, teen, adult, master
+
+struct PetLevelRule {
+    uint32_t evolveAt;                // totalStepsFed needed to reach this level
+    uint16_t feedCooldownSec;
+    uint16_t playCooldownSec;
+};
+
+struct PetRules {
+    PetLevelRule levels[PET_LEVEL_COUNT];
+
+    // Decay: -1 per period since the anchor; health moves one point per
+    // step while starving (hunger or happiness below) or thriving (both above)
+    uint16_t hungerDecaySec;
+    uint16_t happinessDecaySec;
+    uint16_t healthStepSec;
+    uint8_t starveBelow;
+    uint8_t thriveAbove;
+
+    // Actions
+    uint8_t feedHunger;
+    uint8_t feedHappiness;
+    uint8_t feedExperience;
+    uint16_t feedStepsCredit;         // Counted towards evolution per meal
+    uint8_t playHappiness;
+    uint8_t playExperience;
+    uint8_t sleepHealth;
+    uint8_t evolveHappiness;          // Health is restored to full as well
+    uint16_t resourceMax;             // Food and energy cap
+
+    // Walking: a reward every N steps while counting, and the same rates
+    // again when the counted steps are claimed
+    uint16_t stepsPerFood;
+    uint8_t foodPerReward;
+    uint16_t stepsPerEnergy;
+    uint8_t energyPerReward;
+    uint16_t claimMinSteps;
+
+    // Mood and attention
+    uint8_t happyAbove;
+    uint8_t sadBelow;
+    uint8_t hungryBelow;
+    uint16_t sleepyAfterSec;          // Since last play
+    uint16_t playfulWithinSec;
+    uint8_t attentionHappiness;       // needsAttention() below any of these
+    uint8_t attentionHunger;
+    uint8_t attentionHealth;
+};
+
+constexpr PetRules PET_RULES = {
+    {
+        //  evolveAt  feed  play (cooldowns, seconds)
+        {        0,   60,   30 },     // Egg
+        {     1000,  120,   60 },     // Baby
+        {    10000,  180,   90 },     // Teen
+        {    50000,  300,  120 },     // Adult
+        {   100000,  600,  180 },     // Master
+    },
+
+    300, 600, 5,                      // Hunger, happiness decay; health step
+    20, 60,                           // Starving below, thriving above
+
+    25, 5, 10, 100,                   // Feed: hunger, happiness, XP, step credit
+    15, 5,                            // Play: happiness, XP
+    10,                               // Sleep: health
+    30,                               // Evolve: happiness
+    999,                              // Resource cap
+
+    100, 1,                           // 1 food per 100 steps
+    150, 2,                           // 2 energy per 150 steps
+    100,                              // Minimum claim
+
+    80, 30, 30,                       // Happy, sad, hungry
+    7200, 600,                        // Sleepy, playful
+    30, 30, 50,                       // Attention: happiness, hunger, health
+};
+
+static_assert(PET_RULES.levels[0].evolveAt == 0, "Level 0 is where every pet starts");
+
+// ============================================
+// Closed-Form Stats
+// ============================================
+
+// Stat after whole decay periods since its anchor: base - floor(dt / period)
+inline int petDecayed(int base, uint32_t anchor, uint32_t t, uint32_t period) {
+    if (t <= anchor) return base;
+    uint32_t drops = (t - anchor) / period;
+    return drops >= (uint32_t)base ? 0 : base - (int)drops;
+}
+
+// Cooldown since `since` is over at t; a clock behind `since` (not yet set
+// after a restore from flash) never passes it
+inline bool petCooldownOver(uint32_t since, uint32_t t, uint32_t cooldown) {
+    return t >= since && t - since >= cooldown;
+}
+
+// First time the stat is below `level`
+inline int64_t petBelowFrom(int base, uint32_t anchor, uint32_t period, int level) {
+    if (base < level) return anchor;
+    return (int64_t)anchor + (int64_t)(base - level + 1) * period;
+}
+
+// First time the stat is no longer above `level`
+inline int64_t petAboveUntil(int base, uint32_t anchor, uint32_t period, int level) {
+    if (base <= level) return anchor;
+    return (int64_t)anchor + (int64_t)(base - level) * period;
+}
+
+// Health steps falling in [from, to): steps are at anchor + k * healthStepSec, k >= 1
+inline uint32_t petHealthSteps(uint32_t anchor, int64_t from, int64_t to) {
+    int64_t lo = (from > (int64_t)anchor + 1 ? from : (int64_t)anchor + 1) - anchor;
+    int64_t hi = to - anchor;
+    if (hi <= lo) return 0;
+    const int64_t step = PET_RULES.healthStepSec;
+    return (uint32_t)((hi + step - 1) / step - (lo + step - 1) / step);
+}
+
+inline int petHungerAt(int hunger, uint32_t hungerAt, uint32_t t) {
+    return petDecayed(hunger, hungerAt, t, PET_RULES.hungerDecaySec);
+}
+
+inline int petHappinessAt(int happiness, uint32_t happinessAt, uint32_t t) {
+    return petDecayed(happiness, happinessAt, t, PET_RULES.happinessDecaySec);
+}
+
+inline int petHealthAt(int health, uint32_t healthAt,
+                       int hunger, uint32_t hungerAt,
+                       int happiness, uint32_t happinessAt, uint32_t t) {
+    if (t <= healthAt) return health;
+
+    // Hunger and happiness only fall between anchors, so the pet is first
+    // thriving, then neither, then starving
+    int64_t hungerAbove = petAboveUntil(hunger, hungerAt, PET_RULES.hungerDecaySec, PET_RULES.thriveAbove);
+    int64_t happyAbove = petAboveUntil(happiness, happinessAt, PET_RULES.happinessDecaySec, PET_RULES.thriveAbove);
+    int64_t hungerBelow = petBelowFrom(hunger, hungerAt, PET_RULES.hungerDecaySec, PET_RULES.starveBelow);
+    int64_t happyBelow = petBelowFrom(happiness, happinessAt, PET_RULES.happinessDecaySec, PET_RULES.starveBelow);
+    int64_t thriveEnd = hungerAbove < happyAbove ? hungerAbove : happyAbove;
+    int64_t starveFrom = hungerBelow < happyBelow ? hungerBelow : happyBelow;
+    int64_t end = (int64_t)t + 1;
+
+    uint32_t gained = petHealthSteps(healthAt, healthAt, thriveEnd < end ? thriveEnd : end);
+    uint32_t lost = petHealthSteps(healthAt, starveFrom, end);
+
+    uint32_t raised = (uint32_t)health + gained;
+    int capped = raised > 100 ? 100 : (int)raised;
+    return lost >= (uint32_t)capped ? 0 : capped - (int)lost;
+}
+
+// ============================================
+// Progression and Rewards
+// ============================================
+
+// Highest level the fed steps allow (never lower than the current one)
+inline uint8_t petLevelFor(uint32_t totalStepsFed, uint8_t level) {
+    while (level + 1 < PET_LEVEL_COUNT && totalStepsFed >= PET_RULES.levels[level + 1].evolveAt) {
+        level++;
+    }
+    return level;
+}
+
+// Reward earned by the step that brought the count to `stepCount`
+inline int petStepFood(int stepCount) {
+    return stepCount % PET_RULES.stepsPerFood == 0 ? PET_RULES.foodPerReward : 0;
+}
+
+inline int petStepEnergy(int stepCount) {
+    return stepCount % PET_RULES.stepsPerEnergy == 0 ? PET_RULES.energyPerReward : 0;
+}
+
+// Resources for claiming `steps` counted steps
+inline int petClaimFood(int steps) {
+    return steps / PET_RULES.stepsPerFood * PET_RULES.foodPerReward;
+}
+
+inline int petClaimEnergy(int steps) {
+    return steps / PET_RULES.stepsPerEnergy * PET_RULES.energyPerReward;
+}
+
+// ============================================
+// Transitions
+// ============================================
+// Pet: any struct with level, happiness, hunger, health, happinessAt,
+// hungerAt, healthAt, lastFedAt, lastPlayAt, experience, totalStepsFed,
+// food and energy (PetState on the watch, SimPet in the simulator).
+// Sync bookkeeping, logs and animations stay with the caller.
+
+inline int petCapped(int value, int max) {
+    return value > max ? max : value;
+}
+
+// Fold elapsed decay into the stored values. Anchors move by whole
+// periods, so settling never shifts the next drop.
+template <typename Pet>
+void petSettle(Pet& p, uint32_t t) {
+    // Before the hunger/happiness anchors move
+    int health = petHealthAt(p.health, p.healthAt, p.hunger, p.hungerAt, p.happiness, p.happinessAt, t);
+    int hunger = petHungerAt(p.hunger, p.hungerAt, t);
+    int happiness = petHappinessAt(p.happiness, p.happinessAt, t);
+
+    if (hunger != p.hunger) {
+        p.hungerAt = hunger == 0 ? t : p.hungerAt + (uint32_t)(p.hunger - hunger) * PET_RULES.hungerDecaySec;
+        p.hunger = hunger;
+    }
+    if (happiness != p.happiness) {
+        p.happinessAt = happiness == 0 ? t
+                      : p.happinessAt + (uint32_t)(p.happiness - happiness) * PET_RULES.happinessDecaySec;
+        p.happiness = happiness;
+    }
+    p.health = health;
+    if (t > p.healthAt) {
+        p.healthAt += (t - p.healthAt) / PET_RULES.healthStepSec * PET_RULES.healthStepSec;
+    }
+}
+
+template <typename Pet>
+bool petCanFeed(const Pet& p, uint32_t t) {
+    return p.food >= 1 && petCooldownOver(p.lastFedAt, t, PET_RULES.levels[p.level].feedCooldownSec);
+}
+
+template <typename Pet>
+bool petCanPlay(const Pet& p, uint32_t t) {
+    return p.energy >= 1 && petCooldownOver(p.lastPlayAt, t, PET_RULES.levels[p.level].playCooldownSec);
+}
+
+// One food for hunger, a little happiness and evolution credit; false if
+// it cannot feed or the pet is full (settled either way)
+template <typename Pet>
+bool petFeed(Pet& p, uint32_t t) {
+    if (!petCanFeed(p, t)) return false;
+    petSettle(p, t);
+    if (p.hunger >= 100) return false;
+
+    p.food--;
+    p.hunger = petCapped(p.hunger + PET_RULES.feedHunger, 100);
+    p.happiness = petCapped(p.happiness + PET_RULES.feedHappiness, 100);
+    p.experience += PET_RULES.feedExperience;
+    p.totalStepsFed += PET_RULES.feedStepsCredit;
+    p.lastFedAt = t;
+    p.hungerAt = t;                   // Hunger decay restarts at the meal
+    return true;
+}
+
+// One energy for happiness
+template <typename Pet>
+bool petPlay(Pet& p, uint32_t t) {
+    if (!petCanPlay(p, t)) return false;
+    petSettle(p, t);
+
+    p.energy--;
+    p.happiness = petCapped(p.happiness + PET_RULES.playHappiness, 100);
+    p.experience += PET_RULES.playExperience;
+    p.lastPlayAt = t;
+    p.happinessAt = t;                // Happiness decay restarts at play
+    return true;
+}
+
+// Level up if the fed steps allow it: full health and a happiness bonus
+template <typename Pet>
+bool petEvolve(Pet& p, uint32_t t) {
+    uint8_t level = petLevelFor(p.totalStepsFed, p.level);
+    if (level == p.level) return false;
+    petSettle(p, t);
+    p.level = level;
+    p.health = 100;
+    p.happiness = petCapped(p.happiness + PET_RULES.evolveHappiness, 100);
+    return true;
+}
+
+// Food or energy up to the cap; returns what the cap threw away
+template <typename T>
+int petAddResource(T& resource, int amount) {
+    int added = petCapped(amount, PET_RULES.resourceMax - (int)resource);
+    resource += added;
+    return amount - added;
+}
+
+#endif // PET_RULES_H
@@ -0,0 +1,136 @@
+/**
+ * Span Profiler Implementation
+ */
+
+#include "Profiler.h"
+
+#if PROFILER_ENABLED
+
+#include <esp_timer.h>
+
+#define CALIBRATION_SPANS   256
+
+static const char* const SPAN_NAMES[PROF_SPAN_COUNT] = {
+    "lvgl", "flush", "screen1", "screen2", "screen3", "screen4",
+    "steps", "ws", "sign", "rpc"
+};
+
+Profiler profiler;
+
+Profiler::Profiler() : _cpuMhz(240), _spanCycles(0) {
+    for (uint8_t i = 0; i < PROF_SPAN_COUNT; i++) {
+        _spans[i].count.store(0, std::memory_order_relaxed);
+        _spans[i].maxCycles.store(0, std::memory_order_relaxed);
+        for (uint32_t b = 0; b < PROFILER_BUCKETS; b++) {
+            _spans[i].buckets[b].store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+void Profiler::begin() {
+    _cpuMhz = getCpuFrequencyMhz();
+
+    // Same work as a real span, into a histogram nobody reads
+    static Histogram scratch;
+    uint32_t start = cycles();
+    for (int i = 0; i < CALIBRATION_SPANS; i++) {
+        uint32_t spanStart = cycles();
+        add(scratch, cycles() - spanStart);
+    }
+    _spanCycles = (cycles() - start) / CALIBRATION_SPANS;
+
+    Serial.printf("[PROF] ✓ %u spans, %lu cycles each at %lu MHz\n", PROF_SPAN_COUNT,
+                  (unsigned long)_spanCycles, (unsigned long)_cpuMhz);
+}
+
+// Exact below PROFILER_SUB_BUCKETS, then PROFILER_SUB_BUCKETS per power of two
+uint32_t Profiler::bucketOf(uint32_t cycles) {
+    if (cycles < PROFILER_SUB_BUCKETS) return cycles;
+    uint32_t msb = 31 - __builtin_clz(cycles);
+    return msb * PROFILER_SUB_BUCKETS + ((cycles >> (msb - PROFILER_SUB_BITS)) & (PROFILER_SUB_BUCKETS - 1));
+}
+
+uint32_t Profiler::bucketMid(uint32_t bucket) {
+    if (bucket < PROFILER_SUB_BUCKETS) return bucket;
+    uint32_t msb = bucket / PROFILER_SUB_BUCKETS;
+    uint32_t width = 1u << (msb - PROFILER_SUB_BITS);
+    uint32_t low = (PROFILER_SUB_BUCKETS + bucket % PROFILER_SUB_BUCKETS) * width;
+    return low + width / 2;
+}
+
+void Profiler::add(Histogram& histogram, uint32_t cycles) {
+    histogram.buckets[bucketOf(cycles)].fetch_add(1, std::memory_order_relaxed);
+    histogram.count.fetch_add(1, std::memory_order_relaxed);
+
+    uint32_t max = histogram.maxCycles.load(std::memory_order_relaxed);
+    while (cycles > max &&
+           !histogram.maxCycles.compare_exchange_weak(max, cycles, std::memory_order_relaxed)) {
+    }
+}
+
+void Profiler::record(ProfileSpan span, uint32_t cycles) {
+    if (span >= PROF_SPAN_COUNT) return;
+    add(_spans[span], cycles);
+}
+
+bool Profiler::getStats(uint8_t span, SpanStats& out) {
+    if (span >= PROF_SPAN_COUNT) return false;
+    Histogram& histogram = _spans[span];
+
+    // Counts are taken one by one while spans keep landing; quantiles
+    // come from this copy so they stay consistent with each other
+    uint32_t counts[PROFILER_BUCKETS];
+    uint32_t total = 0;
+    for (uint32_t b = 0; b < PROFILER_BUCKETS; b++) {
+        counts[b] = histogram.buckets[b].load(std::memory_order_relaxed);
+        total += counts[b];
+    }
+
+    uint32_t maxCycles = histogram.maxCycles.load(std::memory_order_relaxed);
+    out.name = SPAN_NAMES[span];
+    out.count = histogram.count.load(std::memory_order_relaxed);
+    out.maxUs = toUs(maxCycles);
+    out.p50Us = 0;
+    out.p99Us = 0;
+    if (total == 0) return true;
+
+    uint32_t rank50 = (total + 1) / 2;
+    uint32_t rank99 = total - total / 100;
+    uint32_t seen = 0;
+    for (uint32_t b = 0; b < PROFILER_BUCKETS; b++) {
+        if (counts[b] == 0) continue;
+        uint32_t before = seen;
+        seen += counts[b];
+        uint32_t mid = bucketMid(b) < maxCycles ? bucketMid(b) : maxCycles;
+        if (before < rank50 && seen >= rank50) out.p50Us = toUs(mid);
+        if (before < rank99 && seen >= rank99) {
+            out.p99Us = toUs(mid);
+            break;
+        }
+    }
+    return true;
+}
+
+uint32_t Profiler::overheadPpm() {
+    uint64_t spans = 0;
+    for (uint8_t i = 0; i < PROF_SPAN_COUNT; i++) {
+        spans += _spans[i].count.load(std::memory_order_relaxed);
+    }
+    uint64_t uptimeCycles = (uint64_t)esp_timer_get_time() * _cpuMhz;
+    return uptimeCycles ? (uint32_t)(spans * _spanCycles * 1000000ULL / uptimeCycles) : 0;
+}
+
+void Profiler::report() {
+    Serial.println("[PROF] span       count    p50 us    p99 us    max us");
+    for (uint8_t i = 0; i < PROF_SPAN_COUNT; i++) {
+        SpanStats s;
+        if (!getStats(i, s) || s.count == 0) continue;
+        Serial.printf("[PROF] %-8s %7lu %9lu %9lu %9lu\n", s.name, (unsigned long)s.count,
+                      (unsigned long)s.p50Us, (unsigned long)s.p99Us, (unsigned long)s.maxUs);
+    }
+    uint32_t ppm = overheadPpm();
+    Serial.printf("[PROF] Overhead %lu.%02lu%% of a core\n",
+                  (unsigned long)(ppm / 10000), (unsigned long)(ppm / 100 % 100));
+}
+
+#endif // PROFILER_ENABLED
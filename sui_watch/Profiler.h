@@ -0,0 +1,129 @@
+/**
+ * Span Profiler for ESP32
+ * Where the time goes inside each task: PROFILE_SPAN(id) times the rest
+ * of the enclosing scope in CPU cycles and adds it to that subsystem's
+ * histogram (count, p50/p99, max). Buckets are log-linear, four per
+ * power of two, so quantiles are good to about 10% from a few cycles to
+ * several seconds.
+ *
+ * Every counter is a relaxed atomic: recording takes no lock, and the
+ * net task reading the histograms for the metrics message never stalls
+ * the task being measured. The cycle counter is per core; the measured
+ * tasks are all pinned, so a span starts and ends on the same one. A
+ * span costs well under a hundred cycles (measured in begin()).
+ *
+ * Off by default: PROFILER_ENABLED 0 compiles the spans and the
+ * histograms out. Build with -DPROFILER_ENABLED=1 to turn it on.
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED        0
+#endif
+#define PROFILER_SUB_BITS       2       // 4 buckets per power of two
+#define PROFILER_SUB_BUCKETS    (1 << PROFILER_SUB_BITS)
+#define PROFILER_BUCKETS        (32 * PROFILER_SUB_BUCKETS)
+
+enum ProfileSpan {
+    PROF_LVGL,          // lv_timer_handler (UI task, flushes included)
+    PROF_FLUSH,         // my_disp_flush
+    PROF_SCREEN1,       // updateScreen1PetUI
+    PROF_SCREEN2,       // updateScreen2ResourcesUI
+    PROF_SCREEN3,       // updateScreen3StepsUI
+    PROF_SCREEN4,       // updateScreen4WalletUI
+    PROF_STEPS,         // detectSteps (sensor task)
+    PROF_WS_LOOP,       // WebSocket loop (net task)
+    PROF_SIGN,          // SHA-256 + Ed25519 of a payload (signer task)
+    PROF_RPC,           // Sui RPC balance/pet round trip (RPC worker)
+    PROF_SPAN_COUNT
+};
+
+struct SpanStats {
+    const char* name;
+    uint32_t count;
+    uint32_t p50Us;
+    uint32_t p99Us;
+    uint32_t maxUs;
+};
+
+#if PROFILER_ENABLED
+
+#include <atomic>
+#include <esp_idf_version.h>
+#if ESP_IDF_VERSION_MAJOR >= 5
+#include <esp_cpu.h>
+#else
+#include <hal/cpu_hal.h>
+#endif
+
+class Profiler {
+public:
+    Profiler();
+
+    // Read the CPU clock and measure what a span costs (call once in setup)
+    void begin();
+
+    static inline uint32_t cycles() {
+#if ESP_IDF_VERSION_MAJOR >= 5
+        return esp_cpu_get_cycle_count();
+#else
+        return cpu_hal_get_cycle_count();
+#endif
+    }
+
+    // Any task, no lock
+    void record(ProfileSpan span, uint32_t cycles);
+
+    bool getStats(uint8_t span, SpanStats& out);
+
+    // Upper bound of the time spent recording, in ppm of one core since boot
+    uint32_t overheadPpm();
+
+    // Print every span that has run
+    void report();
+
+private:
+    struct Histogram {
+        std::atomic<uint32_t> count;
+        std::atomic<uint32_t> maxCycles;
+        std::atomic<uint32_t> buckets[PROFILER_BUCKETS];
+    };
+
+    Histogram _spans[PROF_SPAN_COUNT];
+    uint32_t _cpuMhz;
+    uint32_t _spanCycles;              // Cost of one span, from begin()
+
+    static void add(Histogram& histogram, uint32_t cycles);
+    static uint32_t bucketOf(uint32_t cycles);
+    static uint32_t bucketMid(uint32_t bucket);
+    uint32_t toUs(uint32_t cycles) const { return cycles / _cpuMhz; }
+};
+
+extern Profiler profiler;
+
+// Records the time from construction to the end of the scope
+class ProfileScope {
+public:
+    explicit ProfileScope(ProfileSpan span) : _span(span), _start(Profiler::cycles()) {}
+    ~ProfileScope() { profiler.record(_span, Profiler::cycles() - _start); }
+
+private:
+    ProfileSpan _span;
+    uint32_t _start;
+};
+
+#define PROFILE_JOIN2(a, b) a##b
+#define PROFILE_JOIN(a, b) PROFILE_JOIN2(a, b)
+#define PROFILE_SPAN(span) ProfileScope PROFILE_JOIN(_profileScope, __LINE__)(span)
+
+#else
+
+#define PROFILE_SPAN(span) do {} while (0)
+
+#endif // PROFILER_ENABLED
+
+#endif
@@ -0,0 +1,230 @@
+/**
+ * Ed25519 Signing Worker Implementation
+ * Scalar arithmetic and the base-point multiplication come from the
+ * libsodium component bundled with the ESP32 core.
+ */
+
+#include "SignWorker.h"
+#include "Profiler.h"
+#include "Tracer.h"
+#include <MicroSui.h>
+#include <sodium.h>
+#include <esp_timer.h>
+#include <mbedtls/sha256.h>
+#include <mbedtls/sha512.h>
+
+SignWorker::SignWorker()
+    : _task(nullptr), _queue(nullptr), _expanded(false) {
+    _lock = portMUX_INITIALIZER_UNLOCKED;
+    memset(&_stats, 0, sizeof(_stats));
+    memset(_secretKey, 0, sizeof(_secretKey));
+    memset(_publicKey, 0, sizeof(_publicKey));
+    memset(_scalar, 0, sizeof(_scalar));
+    memset(_prefix, 0, sizeof(_prefix));
+}
+
+bool SignWorker::begin(const uint8_t secretKey[32], const uint8_t publicKey[32]) {
+    if (_task) return true;
+
+    memcpy(_secretKey, secretKey, 32);
+    memcpy(_publicKey, publicKey, 32);
+    _expanded = expandKey();
+    _stats.expandedKey = _expanded;
+
+    _queue = xQueueCreate(SIGN_QUEUE_DEPTH, sizeof(Request));
+    if (!_queue) {
+        Serial.println("[SIGN] ✗ Failed to create request queue");
+        return false;
+    }
+
+    BaseType_t created = xTaskCreatePinnedToCore(
+        taskEntry, "signer", SIGN_TASK_STACK, this, SIGN_TASK_PRIORITY, &_task, SIGN_TASK_CORE);
+
+    if (created != pdPASS) {
+        Serial.println("[SIGN] ✗ Failed to start worker task");
+        _task = nullptr;
+        return false;
+    }
+
+    Serial.printf("[SIGN] ✓ Worker task started (%s key)\n",
+                  _expanded ? "cached expanded" : "MicroSui");
+    return true;
+}
+
+bool SignWorker::submit(const uint8_t* data, size_t len, SignCallback callback, void* context) {
+    if (!_task || !callback) return false;
+
+    Request request;
+    request.data = data;
+    request.len = len;
+    request.callback = callback;
+    request.context = context;
+    request.queuedAt = esp_timer_get_time();
+
+    if (xQueueSend(_queue, &request, 0) != pdPASS) {
+        portENTER_CRITICAL(&_lock);
+        _stats.rejected++;
+        portEXIT_CRITICAL(&_lock);
+        Serial.println("[SIGN] ✗ Queue full, request refused");
+        return false;
+    }
+    return true;
+}
+
+void SignWorker::getStats(SignStats& out) {
+    portENTER_CRITICAL(&_lock);
+    out = _stats;
+    portEXIT_CRITICAL(&_lock);
+}
+
+// ============================================
+// Worker Task
+// ============================================
+
+void SignWorker::taskEntry(void* arg) {
+    static_cast<SignWorker*>(arg)->run();
+}
+
+void SignWorker::run() {
+    Request request;
+    uint8_t signature[64];
+
+    for (;;) {
+        if (xQueueReceive(_queue, &request, portMAX_DELAY) != pdPASS) {
+            continue;
+        }
+
+        int64_t start = esp_timer_get_time();
+        bool ok = sign(request.data, request.len, signature);
+        int64_t end = esp_timer_get_time();
+
+        recordLatency(ok, (uint32_t)(end - start), (uint32_t)(start - request.queuedAt));
+        request.callback(ok, signature, request.context);
+    }
+}
+
+void SignWorker::recordLatency(bool ok, uint32_t signUs, uint32_t queueUs) {
+    portENTER_CRITICAL(&_lock);
+    if (ok) {
+        _stats.signatures++;
+    } else {
+        _stats.failures++;
+    }
+    _stats.lastUs = signUs;
+    _stats.lastQueueUs = queueUs;
+    _stats.avgUs = _stats.avgUs == 0 ? signUs : _stats.avgUs - _stats.avgUs / 8 + signUs / 8;
+    if (signUs > _stats.maxUs) _stats.maxUs = signUs;
+    portEXIT_CRITICAL(&_lock);
+
+    Serial.printf("[SIGN] %s in %lu us (queued %lu us)\n", ok ? "✓ Signed" : "✗ Failed",
+                  (unsigned long)signUs, (unsigned long)queueUs);
+}
+
+// ============================================
+// Ed25519
+// ============================================
+
+static void sha512(const uint8_t* a, size_t aLen, const uint8_t* b, size_t bLen,
+                   const uint8_t* c, size_t cLen, uint8_t out[64]) {
+    mbedtls_sha512_context ctx;
+    mbedtls_sha512_init(&ctx);
+    mbedtls_sha512_starts(&ctx, 0);  // 0 = SHA-512 (not SHA-384)
+    if (aLen) mbedtls_sha512_update(&ctx, a, aLen);
+    if (bLen) mbedtls_sha512_update(&ctx, b, bLen);
+    if (cLen) mbedtls_sha512_update(&ctx, c, cLen);
+    mbedtls_sha512_finish(&ctx, out);
+    mbedtls_sha512_free(&ctx);
+}
+
+bool SignWorker::expandKey() {
+    if (sodium_init() < 0) {
+        Serial.println("[SIGN] ✗ libsodium init failed, using MicroSui");
+        return false;
+    }
+
+    // az = SHA-512(seed): clamped scalar a | nonce prefix
+    uint8_t az[64];
+    sha512(_secretKey, 32, nullptr, 0, nullptr, 0, az);
+    az[0] &= 248;
+    az[31] &= 127;
+    az[31] |= 64;
+    memcpy(_prefix, az + 32, 32);
+
+    // Reduce a mod L once so every signature uses a canonical scalar
+    uint8_t wide[64] = {0};
+    memcpy(wide, az, 32);
+    crypto_core_ed25519_scalar_reduce(_scalar, wide);
+    sodium_memzero(az, sizeof(az));
+    sodium_memzero(wide, sizeof(wide));
+
+    // Derived public key must match the keypair
+    uint8_t derived[32];
+    if (crypto_scalarmult_ed25519_base_noclamp(derived, _scalar) != 0 ||
+        memcmp(derived, _publicKey, 32) != 0) {
+        Serial.println("[SIGN] ✗ Expanded key does not match public key, using MicroSui");
+        return false;
+    }
+
+    // Both paths must produce the same signature
+    static const uint8_t probe[] = "sui-watch signer self-check";
+    uint8_t fast[64];
+    uint8_t reference[64];
+    if (!signExpanded(probe, sizeof(probe) - 1, fast) ||
+        !signMicroSui(probe, sizeof(probe) - 1, reference) ||
+        memcmp(fast, reference, 64) != 0) {
+        Serial.println("[SIGN] ✗ Self-check mismatch, using MicroSui");
+        return false;
+    }
+
+    return true;
+}
+
+bool SignWorker::sign(const uint8_t* data, size_t len, uint8_t signature[64]) {
+    PROFILE_SPAN(PROF_SIGN);
+    TRACE_SCOPE("sign");
+
+    // Oracle protocol signs SHA-256(payload)
+    uint8_t hash[32];
+    mbedtls_sha256_context ctx;
+    mbedtls_sha256_init(&ctx);
+    mbedtls_sha256_starts(&ctx, 0);  // 0 = SHA256 (not SHA224)
+    mbedtls_sha256_update(&ctx, data, len);
+    mbedtls_sha256_finish(&ctx, hash);
+    mbedtls_sha256_free(&ctx);
+
+    return _expanded ? signExpanded(hash, 32, signature)
+                     : signMicroSui(hash, 32, signature);
+}
+
+bool SignWorker::signExpanded(const uint8_t* msg, size_t len, uint8_t signature[64]) {
+    uint8_t digest[64];
+    uint8_t r[32];
+    uint8_t k[32];
+    uint8_t ka[32];
+
+    // r = SHA-512(prefix | M) mod L, R = r * B
+    sha512(_prefix, 32, msg, len, nullptr, 0, digest);
+    crypto_core_ed25519_scalar_reduce(r, digest);
+    if (crypto_scalarmult_ed25519_base_noclamp(signature, r) != 0) {
+        return false;
+    }
+
+    // k = SHA-512(R | A | M) mod L, S = r + k * a mod L
+    sha512(signature, 32, _publicKey, 32, msg, len, digest);
+    crypto_core_ed25519_scalar_reduce(k, digest);
+    crypto_core_ed25519_scalar_mul(ka, k, _scalar);
+    crypto_core_ed25519_scalar_add(signature + 32, r, ka);
+
+    sodium_memzero(r, sizeof(r));
+    sodium_memzero(ka, sizeof(ka));
+    return true;
+}
+
+bool SignWorker::signMicroSui(const uint8_t* msg, size_t len, uint8_t signature[64]) {
+    uint8_t sui_sig[97];  // 1 byte scheme + 64 bytes sig + 32 bytes pubkey
+    if (microsui_sign_ed25519(sui_sig, msg, len, _secretKey) != 0) {
+        return false;
+    }
+    memcpy(signature, sui_sig + 1, 64);
+    return true;
+}
@@ -0,0 +1,87 @@
+/**
+ * Ed25519 Signing Worker for ESP32
+ * Signs oracle payloads on a background FreeRTOS task so loop() and LVGL
+ * never wait on a scalar multiplication. Requests are queued, results come
+ * back through a callback that runs on the worker task.
+ *
+ * The seed is expanded once at key load (SHA-512 -> clamped scalar + nonce
+ * prefix) and kept in RAM, so a signature costs two SHA-512 passes and one
+ * base-point multiplication. All SHA-256/SHA-512 goes through mbedtls,
+ * which uses the ESP32-S3 SHA accelerator (CONFIG_MBEDTLS_HARDWARE_SHA).
+ *
+ * Signatures are plain RFC 8032 Ed25519 over SHA-256(payload), byte for
+ * byte what MicroSui produces. A self-check at key load compares both and
+ * falls back to MicroSui if they ever disagree.
+ */
+
+#ifndef SIGN_WORKER_H
+#define SIGN_WORKER_H
+
+#include <Arduino.h>
+
+#define SIGN_QUEUE_DEPTH   4      // Pending requests before submit() refuses
+#define SIGN_TASK_STACK    6144
+#define SIGN_TASK_CORE     0      // Arduino loop() runs on core 1
+#define SIGN_TASK_PRIORITY 2      // Above the RPC worker, below WiFi
+
+// Runs on the worker task - copy what you need and return quickly
+typedef void (*SignCallback)(bool ok, const uint8_t signature[64], void* context);
+
+struct SignStats {
+    uint32_t signatures;     // Completed OK
+    uint32_t failures;
+    uint32_t rejected;       // Queue full at submit()
+    uint32_t lastUs;         // Hash + sign time of the last request
+    uint32_t avgUs;          // Running average (1/8 weight)
+    uint32_t maxUs;
+    uint32_t lastQueueUs;    // Time the last request waited in the queue
+    bool expandedKey;        // false = fell back to MicroSui per call
+};
+
+class SignWorker {
+public:
+    SignWorker();
+
+    // Expand the key and start the task (call once, after the key is loaded)
+    bool begin(const uint8_t secretKey[32], const uint8_t publicKey[32]);
+
+    // Queue SHA-256 + Ed25519 over data. The buffer must stay untouched
+    // until the callback fires. Returns false if not started or queue full.
+    bool submit(const uint8_t* data, size_t len, SignCallback callback, void* context);
+
+    bool isRunning() const { return _task != nullptr; }
+    void getStats(SignStats& out);
+
+private:
+    struct Request {
+        const uint8_t* data;
+        size_t len;
+        SignCallback callback;
+        void* context;
+        int64_t queuedAt;    // esp_timer_get_time()
+    };
+
+    TaskHandle_t _task;
+    QueueHandle_t _queue;
+
+    // Key material (written once in begin(), read-only afterwards)
+    uint8_t _secretKey[32];
+    uint8_t _publicKey[32];
+    uint8_t _scalar[32];     // Clamped, reduced mod L
+    uint8_t _prefix[32];     // Upper half of SHA-512(seed), nonce input
+    bool _expanded;
+
+    portMUX_TYPE _lock;
+    SignStats _stats;
+
+    static void taskEntry(void* arg);
+    void run();
+
+    bool expandKey();
+    bool sign(const uint8_t* data, size_t len, uint8_t signature[64]);
+    bool signExpanded(const uint8_t* msg, size_t len, uint8_t signature[64]);
+    bool signMicroSui(const uint8_t* msg, size_t len, uint8_t signature[64]);
+    void recordLatency(bool ok, uint32_t signUs, uint32_t queueUs);
+};
+
+#endif
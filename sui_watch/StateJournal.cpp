@@ -0,0 +1,129 @@
+/**
+ * State Journal Implementation
+ */
+
+#include "StateJournal.h"
+#include "Clock.h"
+#include "Tracer.h"
+#include <esp_timer.h>
+#include <rom/crc.h>
+
+StateJournal::StateJournal()
+    : _seq(0), _petChanges(0), _steps(0), _lastWrite(0), _written(false), _legacy(false) {
+    memset(&_pet, 0, sizeof(_pet));
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+uint32_t StateJournal::checksum(const JournalRecord& record) {
+    return crc32_le(0, (const uint8_t*)&record, offsetof(JournalRecord, crc));
+}
+
+bool StateJournal::read(Preferences& prefs, const char* key, JournalRecord& out) {
+    if (prefs.getBytes(key, &out, sizeof(out)) != sizeof(out)) return false;
+    if (out.version != JOURNAL_VERSION || out.size != sizeof(out) || out.crc != checksum(out)) {
+        Serial.printf("[JOURNAL] ⚠️ Record %s invalid, skipped\n", key);
+        return false;
+    }
+    return true;
+}
+
+bool StateJournal::begin(JournalRecord& out) {
+    Preferences prefs;
+    prefs.begin("journal", true);  // Read-only mode
+
+    bool found = read(prefs, JOURNAL_KEY, out);
+    if (!found) {
+        // Older firmware rotated over slot keys: the newest valid one wins
+        for (uint8_t slot = 0; slot < JOURNAL_LEGACY_SLOTS; slot++) {
+            char key[3] = { 'r', (char)('0' + slot), '\0' };
+            JournalRecord record;
+            if (!read(prefs, key, record)) continue;
+            if (!found || record.seq > out.seq) {
+                out = record;
+                found = true;
+            }
+        }
+        _legacy = found;
+    }
+    prefs.end();
+
+    if (!found) {
+        Serial.println("[JOURNAL] No saved state");
+        return false;
+    }
+
+    // Restored state counts as written: nothing to save until it changes
+    _seq = out.seq;
+    _pet = out.pet;
+    _steps = out.steps;
+    _written = true;
+    _lastWrite = appClock->millis();
+    _stats.restoredSeq = out.seq;
+    Serial.printf("[JOURNAL] ✓ Restored #%lu (%ld steps, saved at %lu)\n",
+                  (unsigned long)out.seq, (long)out.steps, (unsigned long)out.savedAt);
+    return true;
+}
+
+bool StateJournal::isDue(unsigned long now, uint32_t petChanges, int steps) {
+    bool petChanged = !_written || petChanges != _petChanges;
+    bool stepsChanged = steps != _steps;
+    if (!petChanged && !stepsChanged) return false;
+
+    unsigned long interval = petChanged ? JOURNAL_PET_INTERVAL_MS : JOURNAL_STEPS_INTERVAL_MS;
+    return !_written || now - _lastWrite >= interval;
+}
+
+bool StateJournal::save(unsigned long now, uint32_t petChanges, const PetState& pet, int steps) {
+    // Edits that cancel out (or a sync that changed no field) leave flash as it is
+    if (_written && steps == _steps && memcmp(&pet, &_pet, sizeof(pet)) == 0) {
+        _petChanges = petChanges;
+        _stats.unchanged++;
+        return true;
+    }
+
+    // Flash writes stall the cache of both cores: a UI hitch suspect
+    TRACE_SCOPE("journal");
+    JournalRecord record;
+    memset(&record, 0, sizeof(record));
+    record.version = JOURNAL_VERSION;
+    record.size = sizeof(record);
+    record.seq = _seq + 1;
+    record.savedAt = appClock->epoch();
+    record.pet = pet;
+    record.steps = steps;
+    record.crc = checksum(record);
+
+    int64_t start = esp_timer_get_time();
+    Preferences prefs;
+    prefs.begin("journal", false);  // Read-write mode
+    size_t written = prefs.putBytes(JOURNAL_KEY, &record, sizeof(record));
+    if (written == sizeof(record) && _legacy) {
+        for (uint8_t slot = 0; slot < JOURNAL_LEGACY_SLOTS; slot++) {
+            char key[3] = { 'r', (char)('0' + slot), '\0' };
+            prefs.remove(key);
+        }
+        _legacy = false;
+    }
+    prefs.end();
+    uint32_t elapsedUs = (uint32_t)(esp_timer_get_time() - start);
+
+    // Retry after the full interval rather than on every check
+    _lastWrite = now;
+    _written = true;
+
+    if (written != sizeof(record)) {
+        _stats.failures++;
+        Serial.println("[JOURNAL] ✗ Write failed");
+        return false;
+    }
+
+    _seq = record.seq;
+    _petChanges = petChanges;
+    _pet = pet;
+    _steps = steps;
+
+    _stats.writes++;
+    _stats.lastWriteUs = elapsedUs;
+    if (elapsedUs > _stats.maxWriteUs) _stats.maxWriteUs = elapsedUs;
+    return true;
+}
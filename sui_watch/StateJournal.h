@@ -0,0 +1,79 @@
+/**
+ * State Journal for ESP32
+ * Keeps the pet, its food/energy and the step count across reboots and
+ * brownouts, without waiting for the server's getPet round trip.
+ *
+ * Each save is one fixed-layout JournalRecord (POD + CRC32) under a
+ * single NVS key ("journal" namespace). NVS already spreads rewrites of a
+ * key over its pages and keeps the old entry until the new one is
+ * complete, so a write torn by a brownout leaves the previous record.
+ *
+ * Flash endurance comes from writing less: pet edits (feed, play, claims,
+ * server updates) at most every JOURNAL_PET_INTERVAL_MS, a step count
+ * that changed on its own every JOURNAL_STEPS_INTERVAL_MS, and nothing
+ * when the pet and steps are what flash already holds. Decay needs no
+ * writes - it is recomputed from the saved anchors.
+ */
+
+#ifndef STATE_JOURNAL_H
+#define STATE_JOURNAL_H
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include "VirtualPet.h"
+
+#define JOURNAL_KEY                "state"
+#define JOURNAL_LEGACY_SLOTS       8       // r0..r7 of older firmware: read once, then erased
+#define JOURNAL_VERSION            2
+#define JOURNAL_PET_INTERVAL_MS    60000
+#define JOURNAL_STEPS_INTERVAL_MS  600000
+
+struct JournalRecord {
+    uint16_t version;
+    uint16_t size;               // sizeof(JournalRecord), layout check
+    uint32_t seq;
+    uint32_t savedAt;            // Wall-clock seconds (for the log only)
+    PetState pet;
+    int32_t steps;               // Unclaimed steps
+    uint32_t crc;                // Over everything above
+};
+
+struct JournalStats {
+    uint32_t writes;
+    uint32_t unchanged;          // Saves skipped: flash already had that state
+    uint32_t failures;
+    uint32_t lastWriteUs;
+    uint32_t maxWriteUs;
+    uint32_t restoredSeq;        // 0 = nothing restored
+};
+
+class StateJournal {
+public:
+    StateJournal();
+
+    // Load the newest valid record (call once at boot)
+    bool begin(JournalRecord& out);
+
+    // Something changed and the rate limit allows a write
+    bool isDue(unsigned long now, uint32_t petChanges, int steps);
+
+    // Write the record (false if the write failed)
+    bool save(unsigned long now, uint32_t petChanges, const PetState& pet, int steps);
+
+    const JournalStats& stats() const { return _stats; }
+
+private:
+    uint32_t _seq;               // Last written/restored
+    uint32_t _petChanges;        // As of the last write
+    int _steps;
+    PetState _pet;               // In flash (valid once _written)
+    unsigned long _lastWrite;
+    bool _written;
+    bool _legacy;                // Restored from the old slot keys
+    JournalStats _stats;
+
+    static uint32_t checksum(const JournalRecord& record);
+    static bool read(Preferences& prefs, const char* key, JournalRecord& out);
+};
+
+#endif
@@ -0,0 +1,155 @@
+/**
+ * Step Batch Implementation
+ */
+
+#include "StepBatch.h"
+#include "Clock.h"
+#include <mbedtls/sha256.h>
+
+StepBatch::StepBatch()
+    : _count(0), _sending(0), _batchesSent(0), _windowsDropped(0) {
+}
+
+void StepBatch::addWindow(uint32_t stepCount, uint64_t timestamp, uint8_t batteryPercent,
+                          float accSamples[][3], int sampleCount) {
+    if (_count >= STEP_BATCH_WINDOWS) {
+        if (_sending > 0) {
+            // Front windows are in flight - keep them, lose the new one
+            _windowsDropped++;
+            Serial.println("[BATCH] Full while sending, window dropped");
+            return;
+        }
+        // Drop the oldest window to make room
+        memmove(&_windows[0], &_windows[1], sizeof(StepWindow) * (STEP_BATCH_WINDOWS - 1));
+        memmove(&_addedAt[0], &_addedAt[1], sizeof(unsigned long) * (STEP_BATCH_WINDOWS - 1));
+        _count--;
+        _windowsDropped++;
+        Serial.println("[BATCH] Full, oldest window dropped");
+    }
+
+    StepWindow& w = _windows[_count];
+    w.stepCount = stepCount;
+    w.timestamp = timestamp;
+    w.batteryPercent = batteryPercent;
+    w.sampleCount = sampleCount < STEP_BATCH_SAMPLES ? sampleCount : STEP_BATCH_SAMPLES;
+
+    for (int i = 0; i < w.sampleCount; i++) {
+        for (int axis = 0; axis < 3; axis++) {
+            float milli = accSamples[i][axis] * 1000.0f;
+            if (milli > 32767.0f) milli = 32767.0f;
+            if (milli < -32768.0f) milli = -32768.0f;
+            w.samples[i][axis] = (int16_t)lroundf(milli);
+        }
+    }
+
+    _addedAt[_count] = appClock->millis();
+    _count++;
+
+    Serial.printf("[BATCH] Window %d/%d recorded (%lu steps)\n",
+                  _count, STEP_BATCH_WINDOWS, (unsigned long)stepCount);
+}
+
+bool StepBatch::shouldFlush(unsigned long now) {
+    if (_count == 0 || _sending > 0) return false;
+    if (_count >= STEP_BATCH_WINDOWS) return true;
+    return now - _addedAt[0] >= STEP_BATCH_MAX_AGE;
+}
+
+int StepBatch::beginSend() {
+    _sending = _count;
+    return _sending;
+}
+
+void StepBatch::completeSend() {
+    if (_sending <= 0) return;
+
+    int remaining = _count - _sending;
+    memmove(&_windows[0], &_windows[_sending], sizeof(StepWindow) * remaining);
+    memmove(&_addedAt[0], &_addedAt[_sending], sizeof(unsigned long) * remaining);
+    _count = remaining;
+    _sending = 0;
+    _batchesSent++;
+}
+
+void StepBatch::failSend() {
+    _sending = 0;
+}
+
+// ============================================
+// Merkle Commitment
+// ============================================
+
+size_t StepBatch::encodeLeaf(int index, uint8_t* out) const {
+    const StepWindow& w = _windows[index];
+    size_t n = 0;
+
+    for (int i = 0; i < 4; i++) out[n++] = (w.stepCount >> (i * 8)) & 0xFF;
+    for (int i = 0; i < 8; i++) out[n++] = (w.timestamp >> (i * 8)) & 0xFF;
+    out[n++] = w.batteryPercent;
+    out[n++] = w.sampleCount;
+
+    for (int i = 0; i < w.sampleCount; i++) {
+        for (int axis = 0; axis < 3; axis++) {
+            uint16_t v = (uint16_t)w.samples[i][axis];
+            out[n++] = v & 0xFF;
+            out[n++] = v >> 8;
+        }
+    }
+    return n;
+}
+
+void StepBatch::leafHash(int index, uint8_t out[32]) const {
+    uint8_t leaf[STEP_BATCH_LEAF_MAX];
+    size_t len = encodeLeaf(index, leaf);
+    const uint8_t prefix = 0x00;
+
+    mbedtls_sha256_context ctx;
+    mbedtls_sha256_init(&ctx);
+    mbedtls_sha256_starts(&ctx, 0);
+    mbedtls_sha256_update(&ctx, &prefix, 1);
+    mbedtls_sha256_update(&ctx, leaf, len);
+    mbedtls_sha256_finish(&ctx, out);
+    mbedtls_sha256_free(&ctx);
+}
+
+void StepBatch::nodeHash(const uint8_t left[32], const uint8_t right[32], uint8_t out[32]) {
+    const uint8_t prefix = 0x01;
+
+    mbedtls_sha256_context ctx;
+    mbedtls_sha256_init(&ctx);
+    mbedtls_sha256_starts(&ctx, 0);
+    mbedtls_sha256_update(&ctx, &prefix, 1);
+    mbedtls_sha256_update(&ctx, left, 32);
+    mbedtls_sha256_update(&ctx, right, 32);
+    mbedtls_sha256_finish(&ctx, out);
+    mbedtls_sha256_free(&ctx);
+}
+
+void StepBatch::computeRoot(int n, uint8_t root[32]) const {
+    uint8_t level[STEP_BATCH_WINDOWS][32];
+
+    if (n <= 0) {
+        memset(root, 0, 32);
+        return;
+    }
+
+    for (int i = 0; i < n; i++) {
+        leafHash(i, level[i]);
+    }
+
+    // Reduce in place; an unpaired last node is promoted unchanged
+    while (n > 1) {
+        int next = 0;
+        for (int i = 0; i < n; i += 2) {
+            if (i + 1 < n) {
+                nodeHash(level[i], level[i + 1], level[next]);
+            } else if (next != i) {
+                memcpy(level[next], level[i], 32);
+            }
+            next++;
+        }
+        n = next;
+    }
+
+    memcpy(root, level[0], 32);
+}
@@ -0,0 +1,76 @@
+/**
+ * Step Batch for Trust Oracle
+ * Accumulates per-window step records on the device and commits them with
+ * a single Merkle root, so a whole batch costs one Ed25519 signature and
+ * one radio wakeup. Every window stays individually verifiable with an
+ * inclusion proof against the signed root.
+ *
+ * Leaf bytes (little-endian):
+ *   stepCount u32 | timestamp u64 | batteryPercent u8 | sampleCount u8 |
+ *   sampleCount x [x, y, z] int16 milli-g
+ * Hashing: leaf = SHA-256(0x00 | leaf bytes), node = SHA-256(0x01 | left | right).
+ * An unpaired node is promoted to the next level unchanged.
+ * Signed commitment: root (32) | windowCount u16 | deviceId bytes.
+ */
+
+#ifndef STEP_BATCH_H
+#define STEP_BATCH_H
+
+#include <Arduino.h>
+
+#define STEP_BATCH_WINDOWS 8          // Windows per batch (one signature each batch)
+#define STEP_BATCH_SAMPLES 8          // IMU samples kept per window
+#define STEP_BATCH_MAX_AGE 600000     // Flush a partial batch after 10 minutes
+#define STEP_BATCH_LEAF_MAX (14 + STEP_BATCH_SAMPLES * 6)
+
+struct StepWindow {
+    uint32_t stepCount;
+    uint64_t timestamp;
+    uint8_t batteryPercent;
+    uint8_t sampleCount;
+    int16_t samples[STEP_BATCH_SAMPLES][3];  // milli-g
+};
+
+class StepBatch {
+public:
+    StepBatch();
+
+    // Record one window (drops the oldest unsent window when full)
+    void addWindow(uint32_t stepCount, uint64_t timestamp, uint8_t batteryPercent,
+                   float accSamples[][3], int sampleCount);
+
+    // Ready to send: full, or the oldest window is older than STEP_BATCH_MAX_AGE
+    bool shouldFlush(unsigned long now);
+
+    int count() const { return _count; }
+    bool isEmpty() const { return _count == 0; }
+    const StepWindow& window(int index) const { return _windows[index]; }
+
+    // In-flight bookkeeping (one batch in flight at a time)
+    int beginSend();              // Freezes the current windows, returns count
+    bool isSending() const { return _sending > 0; }
+    int sendingCount() const { return _sending; }
+    void completeSend();          // Server accepted: drop the sent windows
+    void failSend();              // Keep windows for the next attempt
+
+    // Merkle commitment over the first n windows
+    size_t encodeLeaf(int index, uint8_t* out) const;
+    void computeRoot(int n, uint8_t root[32]) const;
+
+    // Stats
+    uint32_t getBatchesSent() const { return _batchesSent; }
+    uint32_t getWindowsDropped() const { return _windowsDropped; }
+
+private:
+    StepWindow _windows[STEP_BATCH_WINDOWS];
+    unsigned long _addedAt[STEP_BATCH_WINDOWS];  // millis() when recorded
+    int _count;
+    int _sending;
+    uint32_t _batchesSent;
+    uint32_t _windowsDropped;
+
+    void leafHash(int index, uint8_t out[32]) const;
+    static void nodeHash(const uint8_t left[32], const uint8_t right[32], uint8_t out[32]);
+};
+
+#endif
@@ -0,0 +1,285 @@
+/**
+ * Sui RPC Worker Implementation
+ */
+
+#include "SuiRpcWorker.h"
+#include "Profiler.h"
+#include "Tracer.h"
+
+#define RPC_ID_BALANCE 1
+#define RPC_ID_PET     2
+
+// Sui JSON-RPC returns u64 values as strings, small ints as numbers
+static int64_t rpcInt(JsonVariantConst value) {
+    if (value.is<const char*>()) {
+        return strtoll(value.as<const char*>(), nullptr, 10);
+    }
+    return value.as<long long>();
+}
+
+SuiRpcWorker::SuiRpcWorker()
+    : _rpcUrl(nullptr), _walletAddress(nullptr), _task(nullptr), _pushActive(false) {
+    _lock = portMUX_INITIALIZER_UNLOCKED;
+    memset(&_cache, 0, sizeof(_cache));
+    _petObjectId[0] = '\0';
+}
+
+bool SuiRpcWorker::begin(const char* rpcUrl, const char* walletAddress) {
+    if (_task) return true;
+
+    _rpcUrl = rpcUrl;
+    _walletAddress = walletAddress;
+
+    // Testnet/mainnet fullnodes; no pinned CA on the watch
+    _tls.setInsecure();
+    _http.setReuse(true);
+
+    BaseType_t created = xTaskCreatePinnedToCore(
+        taskEntry, "sui_rpc", SUI_RPC_TASK_STACK, this, 1, &_task, SUI_RPC_TASK_CORE);
+
+    if (created != pdPASS) {
+        Serial.println("[RPC] ✗ Failed to start worker task");
+        _task = nullptr;
+        return false;
+    }
+
+    Serial.println("[RPC] ✓ Worker task started");
+    return true;
+}
+
+void SuiRpcWorker::requestRefresh() {
+    if (_task) xTaskNotifyGive(_task);
+}
+
+void SuiRpcWorker::setPetObjectId(const char* objectId) {
+    portENTER_CRITICAL(&_lock);
+    strncpy(_petObjectId, objectId ? objectId : "", sizeof(_petObjectId) - 1);
+    _petObjectId[sizeof(_petObjectId) - 1] = '\0';
+    portEXIT_CRITICAL(&_lock);
+}
+
+void SuiRpcWorker::setPushActive(bool active) {
+    if (_pushActive == active) return;
+    _pushActive = active;
+
+    Serial.printf("[RPC] Server push %s\n", active ? "active - polling relaxed" : "lost - polling resumed");
+    if (!active) {
+        requestRefresh();  // Catch up on anything missed
+    }
+}
+
+void SuiRpcWorker::publishBalance(int64_t balanceMist) {
+    portENTER_CRITICAL(&_lock);
+    _cache.balanceMist = balanceMist;
+    _cache.balanceValid = true;
+    _cache.balanceUpdatedAt = millis();
+    _cache.sequence++;
+    portEXIT_CRITICAL(&_lock);
+}
+
+void SuiRpcWorker::getSnapshot(SuiRpcSnapshot& out) {
+    portENTER_CRITICAL(&_lock);
+    out = _cache;
+    portEXIT_CRITICAL(&_lock);
+}
+
+uint32_t SuiRpcWorker::ageMs(uint32_t updatedAt) {
+    if (updatedAt == 0) return UINT32_MAX;
+    return millis() - updatedAt;
+}
+
+// ============================================
+// Worker Task
+// ============================================
+
+void SuiRpcWorker::taskEntry(void* arg) {
+    static_cast<SuiRpcWorker*>(arg)->run();
+}
+
+void SuiRpcWorker::run() {
+    uint32_t waitMs = 0;  // First fetch as soon as WiFi is up
+
+    for (;;) {
+        // Sleep until the next refresh is due or someone asks for one
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitMs));
+
+        if (WiFi.status() != WL_CONNECTED) {
+            waitMs = 1000;
+            continue;
+        }
+
+        if (refresh()) {
+            waitMs = _pushActive ? SUI_RPC_CONSISTENCY_MS : SUI_RPC_REFRESH_MS;
+        } else {
+            portENTER_CRITICAL(&_lock);
+            uint32_t failures = _cache.failures;
+            portEXIT_CRITICAL(&_lock);
+
+            waitMs = retryDelay(failures);
+            Serial.printf("[RPC] Retry in %lu ms (failure #%lu)\n",
+                          (unsigned long)waitMs, (unsigned long)failures);
+        }
+    }
+}
+
+uint32_t SuiRpcWorker::retryDelay(uint32_t failures) {
+    uint32_t delayMs = SUI_RPC_RETRY_MIN_MS;
+    for (uint32_t i = 1; i < failures && delayMs < SUI_RPC_RETRY_MAX_MS; i++) {
+        delayMs *= 2;
+    }
+    return min(delayMs, (uint32_t)SUI_RPC_RETRY_MAX_MS);
+}
+
+size_t SuiRpcWorker::buildBatch(char* out, size_t size, const char* petObjectId) {
+    bool hasWallet = _walletAddress && strlen(_walletAddress) > 0;
+    bool hasPet = petObjectId && strlen(petObjectId) > 0;
+    int len = 0;
+
+    len += snprintf(out + len, size - len, "[");
+    if (hasWallet) {
+        len += snprintf(out + len, size - len,
+            "{\"jsonrpc\":\"2.0\",\"id\":%d,\"method\":\"suix_getBalance\",\"params\":[\"%s\"]}",
+            RPC_ID_BALANCE, _walletAddress);
+    }
+    if (hasPet) {
+        len += snprintf(out + len, size - len,
+            "%s{\"jsonrpc\":\"2.0\",\"id\":%d,\"method\":\"sui_getObject\","
+            "\"params\":[\"%s\",{\"showContent\":true}]}",
+            hasWallet ? "," : "", RPC_ID_PET, petObjectId);
+    }
+    len += snprintf(out + len, size - len, "]");
+
+    if (!hasWallet && !hasPet) return 0;
+    return (len > 0 && (size_t)len < size) ? (size_t)len : 0;
+}
+
+void SuiRpcWorker::publishError(const char* error) {
+    portENTER_CRITICAL(&_lock);
+    _cache.failures++;
+    _cache.sequence++;
+    strncpy(_cache.error, error, sizeof(_cache.error) - 1);
+    _cache.error[sizeof(_cache.error) - 1] = '\0';
+    portEXIT_CRITICAL(&_lock);
+
+    Serial.printf("[RPC] ✗ %s\n", error);
+}
+
+bool SuiRpcWorker::refresh() {
+    char petObjectId[sizeof(_petObjectId)];
+    portENTER_CRITICAL(&_lock);
+    memcpy(petObjectId, _petObjectId, sizeof(petObjectId));
+    _cache.requests++;
+    portEXIT_CRITICAL(&_lock);
+
+    char body[512];
+    size_t bodyLen = buildBatch(body, sizeof(body), petObjectId);
+    if (bodyLen == 0) {
+        return true;  // Nothing configured to fetch yet
+    }
+    PROFILE_SPAN(PROF_RPC);
+    TRACE_SCOPE("rpc");
+
+    unsigned long start = millis();
+
+    // Same WiFiClientSecure every time: with reuse on, end() keeps the
+    // TLS session open and begin() picks it up again
+    _http.begin(_tls, _rpcUrl);
+    _http.addHeader("Content-Type", "application/json");
+    int httpCode = _http.POST((uint8_t*)body, bodyLen);
+
+    if (httpCode != HTTP_CODE_OK) {
+        char error[32];
+        if (httpCode > 0) {
+            snprintf(error, sizeof(error), "HTTP error %d", httpCode);
+        } else {
+            snprintf(error, sizeof(error), "No connection (%d)", httpCode);
+        }
+        _http.end();
+        _tls.stop();  // Drop the session, reconnect on retry
+        publishError(error);
+        return false;
+    }
+
+    String payload = _http.getString();
+    _http.end();
+
+    uint32_t latency = millis() - start;
+
+    // Keep only the fields we read
+    JsonDocument filter;
+    filter[0]["id"] = true;
+    filter[0]["error"]["message"] = true;
+    filter[0]["result"]["totalBalance"] = true;
+    JsonObject data = filter[0]["result"]["data"].to<JsonObject>();
+    data["version"] = true;
+    JsonObject fields = data["content"]["fields"].to<JsonObject>();
+    fields["level"] = true;
+    fields["happiness"] = true;
+    fields["hunger"] = true;
+    fields["health"] = true;
+    fields["food"] = true;
+    fields["energy"] = true;
+
+    JsonDocument response;
+    DeserializationError error = deserializeJson(response, payload,
+                                                 DeserializationOption::Filter(filter));
+    if (error) {
+        publishError("Parse error");
+        return false;
+    }
+
+    // Batch replies may come back in any order
+    SuiRpcSnapshot update;
+    portENTER_CRITICAL(&_lock);
+    update = _cache;
+    portEXIT_CRITICAL(&_lock);
+
+    uint32_t now = millis();
+    const char* rpcError = nullptr;
+
+    for (JsonObject reply : response.as<JsonArray>()) {
+        int id = reply["id"] | 0;
+
+        if (reply["error"]) {
+            rpcError = reply["error"]["message"] | "RPC error";
+            continue;
+        }
+
+        if (id == RPC_ID_BALANCE) {
+            update.balanceMist = rpcInt(reply["result"]["totalBalance"]);
+            update.balanceValid = true;
+            update.balanceUpdatedAt = now;
+        } else if (id == RPC_ID_PET) {
+            JsonObject pet = reply["result"]["data"];
+            if (!pet) continue;
+            JsonObject petFields = pet["content"]["fields"];
+            update.petVersion = rpcInt(pet["version"]);
+            update.petLevel = rpcInt(petFields["level"]);
+            update.petHappiness = rpcInt(petFields["happiness"]);
+            update.petHunger = rpcInt(petFields["hunger"]);
+            update.petHealth = rpcInt(petFields["health"]);
+            update.petFood = rpcInt(petFields["food"]);
+            update.petEnergy = rpcInt(petFields["energy"]);
+            update.petValid = true;
+            update.petUpdatedAt = now;
+        }
+    }
+
+    if (rpcError) {
+        publishError(rpcError);
+        return false;
+    }
+
+    portENTER_CRITICAL(&_lock);
+    update.requests = _cache.requests;
+    update.failures = 0;
+    update.lastLatencyMs = latency;
+    update.error[0] = '\0';
+    update.sequence = _cache.sequence + 1;
+    _cache = update;
+    portEXIT_CRITICAL(&_lock);
+
+    Serial.printf("[RPC] ✓ Batch ok in %lu ms (balance %lld MIST)\n",
+                  (unsigned long)latency, (long long)update.balanceMist);
+    return true;
+}
@@ -0,0 +1,100 @@
+/**
+ * Sui RPC Worker for ESP32
+ * Fetches wallet balance and the pet object from a Sui fullnode on a
+ * background FreeRTOS task. One TLS connection is kept alive between
+ * requests and both queries go out as a single JSON-RPC batch.
+ * Results are published to the UI through a lock-protected cache, so the
+ * loop/UI thread never blocks on network I/O.
+ */
+
+#ifndef SUI_RPC_WORKER_H
+#define SUI_RPC_WORKER_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WiFiClientSecure.h>
+#include <HTTPClient.h>
+#include <ArduinoJson.h>
+
+#define SUI_RPC_REFRESH_MS     30000   // Normal refresh interval
+#define SUI_RPC_CONSISTENCY_MS 600000  // While the oracle pushes changes
+#define SUI_RPC_RETRY_MIN_MS   2000    // First retry after a failure
+#define SUI_RPC_RETRY_MAX_MS   120000  // Backoff ceiling
+#define SUI_RPC_TASK_STACK     10240   // TLS handshake needs a deep stack
+#define SUI_RPC_TASK_CORE      0       // Arduino loop() runs on core 1
+
+// Copy of the cache handed to the UI thread
+struct SuiRpcSnapshot {
+    // Wallet balance
+    bool balanceValid;
+    int64_t balanceMist;          // 1 SUI = 1,000,000,000 MIST
+    uint32_t balanceUpdatedAt;    // millis() of last good result, 0 = never
+
+    // Pet object (on-chain VirtualPet fields)
+    bool petValid;
+    uint64_t petVersion;          // Sui object version
+    int petLevel;
+    int petHappiness;
+    int petHunger;
+    int petHealth;
+    int petFood;
+    int petEnergy;
+    uint32_t petUpdatedAt;
+
+    // Worker state
+    uint32_t sequence;            // Bumped on every publish
+    uint32_t requests;
+    uint32_t failures;            // Consecutive failures (drives backoff)
+    uint32_t lastLatencyMs;
+    char error[32];               // Last error, empty when healthy
+};
+
+class SuiRpcWorker {
+public:
+    SuiRpcWorker();
+
+    // Start the worker task (call once, after WiFi is up or not - it waits)
+    bool begin(const char* rpcUrl, const char* walletAddress);
+
+    // Non-blocking: wake the worker for an immediate refresh
+    void requestRefresh();
+
+    // Pet object to include in the batch (copied, safe from any thread)
+    void setPetObjectId(const char* objectId);
+
+    // Server push active: polling drops to a rare consistency check
+    void setPushActive(bool active);
+
+    // Balance pushed by the oracle (balance_changed / subscribed)
+    void publishBalance(int64_t balanceMist);
+
+    // Copy the latest cached results
+    void getSnapshot(SuiRpcSnapshot& out);
+
+    // Age of a cached result in ms (UINT32_MAX when never fetched)
+    static uint32_t ageMs(uint32_t updatedAt);
+
+private:
+    const char* _rpcUrl;
+    const char* _walletAddress;
+    TaskHandle_t _task;
+    volatile bool _pushActive;
+
+    // Persistent connection (worker task only)
+    WiFiClientSecure _tls;
+    HTTPClient _http;
+
+    // Shared state, guarded by _lock
+    portMUX_TYPE _lock;
+    SuiRpcSnapshot _cache;
+    char _petObjectId[72];
+
+    static void taskEntry(void* arg);
+    void run();
+    bool refresh();
+    size_t buildBatch(char* out, size_t size, const char* petObjectId);
+    void publishError(const char* error);
+    uint32_t retryDelay(uint32_t failures);
+};
+
+#endif
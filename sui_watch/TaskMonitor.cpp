@@ -0,0 +1,82 @@
+/**
+ * Task Monitor Implementation
+ */
+
+#include "TaskMonitor.h"
+#include <esp_timer.h>
+
+TaskMonitor::TaskMonitor() {
+    _lock = portMUX_INITIALIZER_UNLOCKED;
+    memset(_slots, 0, sizeof(_slots));
+}
+
+void TaskMonitor::add(uint8_t id, const char* name, uint8_t core, uint8_t priority, uint32_t stackSize) {
+    if (id >= TASK_MONITOR_MAX) return;
+
+    Slot& slot = _slots[id];
+    memset(&slot, 0, sizeof(slot));
+    slot.stats.name = name;
+    slot.stats.core = core;
+    slot.stats.priority = priority;
+    slot.stats.stackSize = stackSize;
+    slot.stats.stackFree = stackSize;
+    slot.windowStartUs = esp_timer_get_time();
+}
+
+void TaskMonitor::begin(uint8_t id) {
+    if (id >= TASK_MONITOR_MAX) return;
+    _slots[id].passStartUs = esp_timer_get_time();
+}
+
+void TaskMonitor::end(uint8_t id) {
+    if (id >= TASK_MONITOR_MAX) return;
+
+    Slot& slot = _slots[id];
+    int64_t now = esp_timer_get_time();
+    uint32_t passUs = (uint32_t)(now - slot.passStartUs);
+    slot.busyUs += passUs;
+
+    int64_t windowUs = now - slot.windowStartUs;
+    bool windowDone = windowUs >= (int64_t)TASK_MONITOR_WINDOW_MS * 1000;
+    // ESP-IDF reports the high-water mark in bytes
+    uint32_t stackFree = windowDone ? uxTaskGetStackHighWaterMark(NULL) : 0;
+
+    portENTER_CRITICAL(&_lock);
+    TaskStats& s = slot.stats;
+    s.loops++;
+    s.loopAvgUs = s.loopAvgUs == 0 ? passUs : s.loopAvgUs - s.loopAvgUs / 8 + passUs / 8;
+    if (passUs > s.loopMaxUs) s.loopMaxUs = passUs;
+
+    if (windowDone) {
+        uint32_t pct = (uint32_t)(slot.busyUs * 100 / (uint64_t)windowUs);
+        s.loopPct = pct > 100 ? 100 : pct;
+        if (s.loopPct > s.loopPeakPct) s.loopPeakPct = s.loopPct;
+        if (stackFree < s.stackFree) s.stackFree = stackFree;
+        slot.busyUs = 0;
+        slot.windowStartUs = now;
+    }
+    portEXIT_CRITICAL(&_lock);
+}
+
+bool TaskMonitor::getStats(uint8_t id, TaskStats& out) {
+    if (id >= TASK_MONITOR_MAX || !_slots[id].stats.name) return false;
+
+    portENTER_CRITICAL(&_lock);
+    out = _slots[id].stats;
+    portEXIT_CRITICAL(&_lock);
+    return true;
+}
+
+void TaskMonitor::report() {
+    Serial.println("[TASK] name     core prio loop%  peak  stack free/size  loop avg/max us");
+    for (uint8_t id = 0; id < TASK_MONITOR_MAX; id++) {
+        TaskStats s;
+        if (!getStats(id, s)) continue;
+        Serial.printf("[TASK] %-8s %4u %4u %5u %5u %10lu/%-6lu %7lu/%lu\n",
+                      s.name, s.core, s.priority, s.loopPct, s.loopPeakPct,
+                      (unsigned long)s.stackFree, (unsigned long)s.stackSize,
+                      (unsigned long)s.loopAvgUs, (unsigned long)s.loopMaxUs);
+    }
+    Serial.printf("[TASK] Free heap %lu, min %lu\n",
+                  (unsigned long)ESP.getFreeHeap(), (unsigned long)ESP.getMinFreeHeap());
+}
@@ -0,0 +1,65 @@
+/**
+ * Task Monitor for ESP32
+ * Loop time and stack headroom of the app tasks, for tuning priorities
+ * and stack sizes. Each task brackets one pass of its loop with begin()
+ * and end(); loopPct is the share of a TASK_MONITOR_WINDOW_MS window
+ * spent between them. This is wall time, not CPU time: a pass that was
+ * preempted by a higher-priority task or blocked on a lock counts the
+ * wait too. At the end of each window the task also samples its own
+ * stack high-water mark.
+ *
+ * Arduino builds do not enable FreeRTOS run-time stats, so true CPU
+ * shares (uxTaskGetSystemState() counters) are not available.
+ */
+
+#ifndef TASK_MONITOR_H
+#define TASK_MONITOR_H
+
+#include <Arduino.h>
+
+#define TASK_MONITOR_MAX        6
+#define TASK_MONITOR_WINDOW_MS  5000
+#define TASK_MONITOR_REPORT_MS  60000   // Serial table
+
+struct TaskStats {
+    const char* name;
+    uint8_t core;
+    uint8_t priority;
+    uint32_t stackSize;        // Bytes
+    uint32_t stackFree;        // Lowest free stack seen (bytes)
+    uint8_t loopPct;           // Wall time inside passes, last window
+    uint8_t loopPeakPct;
+    uint32_t loops;
+    uint32_t loopAvgUs;        // Running average (1/8 weight)
+    uint32_t loopMaxUs;
+};
+
+class TaskMonitor {
+public:
+    TaskMonitor();
+
+    // Register a task slot (ids are small app-defined integers)
+    void add(uint8_t id, const char* name, uint8_t core, uint8_t priority, uint32_t stackSize);
+
+    // Bracket one pass; both must be called from the task itself
+    void begin(uint8_t id);
+    void end(uint8_t id);
+
+    bool getStats(uint8_t id, TaskStats& out);
+
+    // Print every registered task
+    void report();
+
+private:
+    struct Slot {
+        TaskStats stats;
+        int64_t passStartUs;
+        int64_t windowStartUs;
+        uint64_t busyUs;
+    };
+
+    Slot _slots[TASK_MONITOR_MAX];
+    portMUX_TYPE _lock;
+};
+
+#endif
@@ -0,0 +1,160 @@
+/**
+ * Event Tracer Implementation
+ */
+
+#include "Tracer.h"
+
+#if TRACER_ENABLED
+
+Tracer tracer;
+
+Tracer::Tracer() : _events(nullptr), _capacity(0), _currentTask(nullptr), _taskName(nullptr) {
+    _next.store(0, std::memory_order_relaxed);
+    _paused.store(false, std::memory_order_relaxed);
+    _taskCount.store(0, std::memory_order_relaxed);
+    _lock = portMUX_INITIALIZER_UNLOCKED;
+}
+
+void Tracer::begin(TraceEvent* events, uint32_t capacity) {
+    if (!events || capacity == 0) {
+        Serial.println("[TRACE] ✗ No event buffer, tracing off");
+        return;
+    }
+    _capacity = capacity;
+    _events = events;
+    Serial.printf("[TRACE] ✓ %lu events (%lu bytes)\n", (unsigned long)capacity,
+                  (unsigned long)(capacity * sizeof(TraceEvent)));
+}
+
+void Tracer::setTaskHooks(TraceTaskHook current, TraceTaskNameHook name) {
+    _currentTask = current;
+    _taskName = name;
+}
+
+// 1-based index of the calling task, registered on first sight
+uint8_t Tracer::taskId() {
+    if (!_currentTask) return 0;
+    const void* task = _currentTask();
+
+    uint8_t count = _taskCount.load(std::memory_order_acquire);
+    for (uint8_t i = 0; i < count; i++) {
+        if (_tasks[i] == task) return i + 1;
+    }
+    if (count >= TRACER_MAX_TASKS) return 0;
+
+    uint8_t id = 0;
+    portENTER_CRITICAL(&_lock);
+    // Another task may have registered in between
+    count = _taskCount.load(std::memory_order_relaxed);
+    for (uint8_t i = 0; i < count && id == 0; i++) {
+        if (_tasks[i] == task) id = i + 1;
+    }
+    if (id == 0 && count < TRACER_MAX_TASKS) {
+        const char* name = _taskName ? _taskName(task) : nullptr;
+        _tasks[count] = task;
+        strncpy(_taskNames[count], name ? name : "?", TRACER_TASK_NAME - 1);
+        _taskNames[count][TRACER_TASK_NAME - 1] = '\0';
+        _taskCount.store(count + 1, std::memory_order_release);
+        id = count + 1;
+    }
+    portEXIT_CRITICAL(&_lock);
+    return id;
+}
+
+void Tracer::record(char phase, const char* name, uint32_t tsUs, uint32_t durUs) {
+    if (!_events || _paused.load(std::memory_order_relaxed)) return;
+
+    // A dump starting mid-write can see a mix of this event and the one it
+    // replaces; every field is a word store, so never a torn pointer
+    uint32_t index = _next.fetch_add(1, std::memory_order_relaxed);
+    TraceEvent& event = _events[index % _capacity];
+    event.name = name;
+    event.tsUs = tsUs;
+    event.durUs = durUs;
+    event.tid = taskId();
+    event.phase = phase;
+}
+
+uint32_t Tracer::dump(TraceWriter write, void* context, uint32_t maxEvents) {
+    if (!_events) return 0;
+    _paused.store(true, std::memory_order_relaxed);
+
+    uint32_t next = _next.load(std::memory_order_relaxed);
+    uint32_t count = next < _capacity ? next : _capacity;
+    if (maxEvents && maxEvents < count) count = maxEvents;
+    uint32_t first = next - count;
+
+    // Complete events are stored when they end, so the earliest start is
+    // not always the oldest slot (wrap-safe: the ring spans far less than
+    // the 71 minutes a 32-bit microsecond count covers)
+    uint32_t base = count ? _events[first % _capacity].tsUs : 0;
+    for (uint32_t i = first; i != next; i++) {
+        uint32_t ts = _events[i % _capacity].tsUs;
+        if ((int32_t)(ts - base) < 0) base = ts;
+    }
+
+    char line[160];
+    int len = snprintf(line, sizeof(line),
+                       "{\"traceEvents\":[\n"
+                       "{\"ph\":\"M\",\"name\":\"process_name\",\"pid\":1,\"tid\":0,"
+                       "\"args\":{\"name\":\"sui_watch\"}}\n");
+    write(line, len, context);
+
+    uint8_t tasks = _taskCount.load(std::memory_order_acquire);
+    for (uint8_t tid = 0; tid <= tasks; tid++) {
+        len = snprintf(line, sizeof(line),
+                       ",{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":%u,"
+                       "\"args\":{\"name\":\"%s\"}}\n",
+                       tid, tid ? _taskNames[tid - 1] : "other");
+        write(line, len, context);
+    }
+
+    for (uint32_t i = first; i != next; i++) {
+        const TraceEvent& event = _events[i % _capacity];
+        unsigned long ts = (unsigned long)(event.tsUs - base);
+        switch (event.phase) {
+            case 'X':
+                len = snprintf(line, sizeof(line),
+                               ",{\"ph\":\"X\",\"name\":\"%s\",\"pid\":1,\"tid\":%u,"
+                               "\"ts\":%lu,\"dur\":%lu}\n",
+                               event.name, event.tid, ts, (unsigned long)event.durUs);
+                break;
+            case 'i':
+                len = snprintf(line, sizeof(line),
+                               ",{\"ph\":\"i\",\"s\":\"t\",\"name\":\"%s\",\"pid\":1,\"tid\":%u,"
+                               "\"ts\":%lu}\n",
+                               event.name, event.tid, ts);
+                break;
+            default:
+                len = snprintf(line, sizeof(line),
+                               ",{\"ph\":\"%c\",\"name\":\"%s\",\"pid\":1,\"tid\":%u,\"ts\":%lu}\n",
+                               event.phase, event.name, event.tid, ts);
+                break;
+        }
+        write(line, len, context);
+    }
+
+    len = snprintf(line, sizeof(line),
+                   "],\"displayTimeUnit\":\"ms\",\"otherData\":{\"overwritten\":\"%lu\"}}\n",
+                   (unsigned long)(next > _capacity ? next - _capacity : 0));
+    write(line, len, context);
+
+    _paused.store(false, std::memory_order_relaxed);
+    return count;
+}
+
+TracerStats Tracer::stats() const {
+    TracerStats s;
+    uint32_t next = _next.load(std::memory_order_relaxed);
+    s.recorded = next;
+    s.overwritten = next > _capacity ? next - _capacity : 0;
+    s.capacity = _capacity;
+    s.tasks = _taskCount.load(std::memory_order_relaxed);
+    return s;
+}
+
+void Tracer::clear() {
+    _next.store(0, std::memory_order_relaxed);
+}
+
+#endif // TRACER_ENABLED
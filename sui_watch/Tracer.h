@@ -0,0 +1,136 @@
+/**
+ * Event Tracer
+ * Timeline of what every task was doing, for frame hitches the span
+ * histograms can only average away. TRACE_SCOPE(name) records a complete
+ * event (start + duration), TRACE_BEGIN/TRACE_END a span that starts
+ * and ends in different calls on one task, TRACE_INSTANT a point in
+ * time. Timestamps are esp_timer microseconds; each event carries the
+ * task it ran on.
+ *
+ * Events go into a fixed ring (the oldest are overwritten) with one
+ * atomic increment and no lock, from any task. dump() writes the ring as
+ * Chrome Trace Event JSON, which Perfetto (ui.perfetto.dev) and
+ * chrome://tracing open directly; recording pauses while it runs.
+ *
+ * Names must be string literals: only the pointer is stored. Tasks come
+ * from setTaskHooks() - FreeRTOS handles on the watch, whatever the
+ * harness uses on the host - and are numbered, with their name copied,
+ * the first time they record, so this file builds unchanged in the
+ * firmware_day harness.
+ *
+ * Off by default: TRACER_ENABLED 0 compiles the events out. Build with
+ * -DTRACER_ENABLED=1 to record them (firmware_day always does).
+ */
+
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <Arduino.h>
+
+#ifndef TRACER_ENABLED
+#define TRACER_ENABLED      0
+#endif
+#define TRACER_EVENTS       4096    // Ring size (16 bytes each on the watch)
+#define TRACER_MAX_TASKS    15      // Later tasks share tid 0 ("other")
+#define TRACER_TASK_NAME    16
+
+#if TRACER_ENABLED
+
+#include <atomic>
+#include <esp_timer.h>
+
+struct TraceEvent {
+    const char* name;
+    uint32_t tsUs;
+    uint32_t durUs;                    // Complete events only
+    uint8_t tid;
+    char phase;                        // Chrome phases: X, B, E, i
+};
+
+struct TracerStats {
+    uint32_t recorded;                 // Since begin() or clear()
+    uint32_t overwritten;              // Lost to the ring wrapping
+    uint32_t capacity;
+    uint8_t tasks;
+};
+
+// Identity of the running task, and its name for the dump
+typedef const void* (*TraceTaskHook)();
+typedef const char* (*TraceTaskNameHook)(const void* task);
+
+// Receives the JSON text in pieces
+typedef void (*TraceWriter)(const char* text, size_t len, void* context);
+
+class Tracer {
+public:
+    Tracer();
+
+    // Storage is the caller's (PSRAM on the watch); nothing is recorded before
+    void begin(TraceEvent* events, uint32_t capacity);
+    void setTaskHooks(TraceTaskHook current, TraceTaskNameHook name);
+
+    static inline uint32_t nowUs() { return (uint32_t)esp_timer_get_time(); }
+
+    // Any task, no lock
+    void complete(const char* name, uint32_t startUs, uint32_t durUs) {
+        record('X', name, startUs, durUs);
+    }
+    void beginSpan(const char* name) { record('B', name, nowUs(), 0); }
+    void endSpan(const char* name) { record('E', name, nowUs(), 0); }
+    void instant(const char* name) { record('i', name, nowUs(), 0); }
+
+    // The newest maxEvents (0: all) as {"traceEvents":[...]}, one event
+    // per write() call and line; returns the events written
+    uint32_t dump(TraceWriter write, void* context, uint32_t maxEvents = 0);
+
+    TracerStats stats() const;
+    void clear();
+
+private:
+    TraceEvent* _events;
+    uint32_t _capacity;
+    std::atomic<uint32_t> _next;       // Events claimed since clear()
+    std::atomic<bool> _paused;
+    TraceTaskHook _currentTask;
+    TraceTaskNameHook _taskName;
+
+    // tid - 1 indexes these; a slot is filled before _taskCount covers it
+    const void* _tasks[TRACER_MAX_TASKS];
+    char _taskNames[TRACER_MAX_TASKS][TRACER_TASK_NAME];
+    std::atomic<uint8_t> _taskCount;
+    portMUX_TYPE _lock;
+
+    void record(char phase, const char* name, uint32_t tsUs, uint32_t durUs);
+    uint8_t taskId();
+};
+
+extern Tracer tracer;
+
+// Records the time from construction to the end of the scope
+class TraceScope {
+public:
+    explicit TraceScope(const char* name) : _name(name), _start(Tracer::nowUs()) {}
+    ~TraceScope() { tracer.complete(_name, _start, Tracer::nowUs() - _start); }
+
+private:
+    const char* _name;
+    uint32_t _start;
+};
+
+#define TRACE_JOIN2(a, b) a##b
+#define TRACE_JOIN(a, b) TRACE_JOIN2(a, b)
+#define TRACE_SCOPE(name) TraceScope TRACE_JOIN(_traceScope, __LINE__)(name)
+#define TRACE_BEGIN(name) tracer.beginSpan(name)
+#define TRACE_END(name) tracer.endSpan(name)
+#define TRACE_INSTANT(name) tracer.instant(name)
+
+#else
+
+#define TRACE_SCOPE(name) do {} while (0)
+#define TRACE_BEGIN(name) do {} while (0)
+#define TRACE_END(name) do {} while (0)
+#define TRACE_INSTANT(name) do {} while (0)
+
+#endif // TRACER_ENABLED
+
+#endif
@@ -1,23 +1,44 @@
 /**
  * Trust Oracle Client Implementation
- * Uses MicroSui for Ed25519 signing
+ * Uses MicroSui keys, Ed25519 signing runs on SignWorker
+ * Sends are queued by priority and drained from loop()
  */
 
 #include "TrustOracleClient.h"
-#include "LoadingOverlay.h"
-#include <mbedtls/sha256.h>
+#include "Clock.h"
+#include "AppState.h"
+#include "TaskMonitor.h"
+#include "Profiler.h"
+#include "Tracer.h"
+#include "DeferredLog.h"
+#include "SuiRpcWorker.h"
+#include "ConnectivityManager.h"
+#include <esp_heap_caps.h>
 
 // Static instance for callback
 TrustOracleClient* TrustOracleClient::_instance = nullptr;
 
-// External loading overlay from ui_handlers.cpp
-extern LoadingOverlay loadingOverlay;
+// Shared state and UI event queue (runs on the net task, never touches LVGL)
+extern AppState appState;
+
+// Sketch globals the client reports on or feeds (sui_watch.ino)
+extern VirtualPet virtualPet;
+extern SuiRpcWorker suiRpc;
+extern ConnectivityManager connectivity;
+extern TaskMonitor taskMonitor;
+extern const char* DEVICE_WALLET_ADDRESS;
 
 TrustOracleClient::TrustOracleClient(const char* host, uint16_t port, const char* deviceId, const char* privateKeyHex)
     : _host(host), _port(port), _deviceId(deviceId), _privateKeyHex(privateKeyHex),
       _connected(false), _registered(false), _authenticated(false),
-      _lastPingTime(0) {
+      _serverOffersMsgPack(false), _binaryWire(false),
+      _txMessages(0), _txHeapAllocs(0), _heapMark(0),
+      _syncPet(nullptr), _petSyncPending(false), _stepBatch(nullptr), _pushActive(false),
+      _signPending(false), _signFinalized(false),
+      _signDone(false), _signOk(false),
+      _wsStarted(false), _probeStarted(false) {
     _instance = this;
+    _signLock = portMUX_INITIALIZER_UNLOCKED;
     _status = "Initializing";
 }
 
@@ -68,22 +89,98 @@ void TrustOracleClient::begin() {
     Serial.println("Device ID: " + _deviceId);
     Serial.println("Public Key: 0x" + _publicKeyHex);
 
-    // Connect to WebSocket
-    Serial.printf("Connecting to %s:%d\n", _host, _port);
-    _webSocket.begin(_host, _port, "/");
-    _webSocket.onEvent(webSocketEvent);
-    _webSocket.setReconnectInterval(5000);
+    // Expand the key once and move signing off the loop thread
+    _signer.begin(_keypair.secret_key, _keypair.getPublicKey(&_keypair));
+
+    // Once WiFi is up loop() measures every endpoint and connects to the fastest
+    _endpoints.load(_host, _port);
+    _status = "Waiting for WiFi";
+}
 
+void TrustOracleClient::connectEndpoint(int index) {
+    _endpoints.setCurrent(index);
+    const OracleEndpoint& ep = _endpoints.get(index);
+
+    Serial.printf("Connecting to %s:%u\n", ep.host, ep.port);
+    _webSocket.begin(ep.host, ep.port, "/");
+    _webSocket.onEvent(webSocketEvent);
+    if (!_wsStarted) {
+        _webSocket.setReconnectInterval(_link.onConnecting(appClock->millis()));
+        _wsStarted = true;
+    }
     _status = "Connecting";
 }
 
+void TrustOracleClient::failover(unsigned long now) {
+    int from = _endpoints.current();
+    int to = _endpoints.select(now);
+    _endpoints.countFailover();
+
+    Serial.printf("[ENDPOINT] ⇄ Failover %s:%u -> %s:%u\n",
+                  _endpoints.get(from).host, _endpoints.get(from).port,
+                  _endpoints.get(to).host, _endpoints.get(to).port);
+
+    // Keys, pet sync state, step batches and a held signed message all
+    // survive; the new server gets the usual register/authenticate
+    connectEndpoint(to);
+    _endpoints.startProbe();  // Refresh latencies for the next decision
+}
+
 void TrustOracleClient::loop() {
-    _webSocket.loop();
+    if (!_wsStarted) {
+        if (WiFi.status() != WL_CONNECTED || _endpoints.isProbing()) return;
+        if (!_probeStarted) {
+            _probeStarted = true;
+            _endpoints.startProbe();
+            return;
+        }
+        connectEndpoint(_endpoints.select(appClock->millis()));
+    }
+
+    {
+        PROFILE_SPAN(PROF_WS_LOOP);
+        TRACE_SCOPE("ws");
+        _webSocket.loop();
+    }
+
+    // Send a signed message once the worker is done with it
+    if (_signPending) {
+        finishSignedMessage();
+    }
+
+    unsigned long now = appClock->millis();
+
+    if (!_connected) {
+        // Still offline after the armed delay: the attempt failed
+        uint32_t delayMs = _link.checkReconnect(now);
+        if (delayMs) {
+            _endpoints.recordFailure(now);
+            if (_endpoints.shouldFailover(now)) {
+                failover(now);
+            } else {
+                _webSocket.setReconnectInterval(delayMs);
+            }
+        }
+        return;
+    }
+
+    if (!_authenticated) return;
+
+    // Queued messages, highest priority first
+    drainQueue(now);
 
-    // Send periodic ping
-    if (_connected && _authenticated && (millis() - _lastPingTime > PING_INTERVAL)) {
+    // Adaptive keepalive: ping only after the link has been quiet
+    if (_link.checkPongTimeout(now)) {
+        Serial.println("[LINK] ✗ Server not answering pings, reconnecting");
+        _webSocket.disconnect();
+        return;
+    }
+    if (_link.pingDue(now)) {
         sendPing();
-        _lastPingTime = millis();
+    }
+
+    if (_link.metricsDue(now)) {
+        sendMetrics();
     }
 }
 
@@ -124,17 +221,51 @@ void TrustOracleClient::webSocketEvent(WStype_t type, uint8_t* payload, size_t l
             _instance->_connected = false;
             _instance->_registered = false;
             _instance->_authenticated = false;
+            _instance->_serverOffersMsgPack = false;
+            // _binaryWire stays until the next welcome, so messages queued
+            // while offline use the codec the server most likely picks again
             _instance->_status = "Disconnected";
+            // Messages still in the outbox go out after reconnect; anything
+            // already sent without an answer is resent by its owner
+            if (!_instance->_txQueue.contains(TX_KIND_UPDATE_PET)) {
+                if (_instance->_petSyncPending && _instance->_syncPet) {
+                    PetLock lock(appState);
+                    _instance->_syncPet->failSync();  // Resend on next sync
+                }
+                _instance->_petSyncPending = false;
+            }
+            if (_instance->_stepBatch && !_instance->_signPending &&
+                !_instance->_txQueue.contains(TX_KIND_STEP_BATCH)) {
+                _instance->_stepBatch->failSend();  // Sent but unanswered: resend after reconnect
+                _instance->_stepBatch = nullptr;
+            }
+            if (_instance->_pushActive) {
+                suiRpc.setPushActive(false);  // Back to polling until resubscribed
+            }
+            _instance->_pushActive = false;
+            _instance->_endpoints.recordDrop();
+            {
+                uint32_t delayMs = _instance->_link.onDisconnected(appClock->millis());
+                _instance->_webSocket.setReconnectInterval(delayMs);
+                Serial.printf("[WS] Reconnect in %lu ms\n", (unsigned long)delayMs);
+            }
             break;
 
         case WStype_CONNECTED:
             Serial.println("[WS] Connected!");
             _instance->_connected = true;
             _instance->_status = "Connected";
+            _instance->_link.onConnected(appClock->millis());
             break;
 
         case WStype_TEXT:
-            _instance->handleMessage((char*)payload);
+            _instance->_link.onRx(length, appClock->millis());
+            _instance->handleMessage(payload, length, false);
+            break;
+
+        case WStype_BIN:
+            _instance->_link.onRx(length, appClock->millis());
+            _instance->handleMessage(payload, length, true);
             break;
 
         case WStype_ERROR:
@@ -147,28 +278,31 @@ void TrustOracleClient::webSocketEvent(WStype_t type, uint8_t* payload, size_t l
     }
 }
 
-void TrustOracleClient::handleMessage(const char* payload) {
-    // Debug: Print raw message
-    Serial.println("📨 Received message:");
-    Serial.println(payload);
-
+void TrustOracleClient::handleMessage(const uint8_t* payload, size_t length, bool binary) {
     StaticJsonDocument<2048> doc;
-    DeserializationError error = deserializeJson(doc, payload);
+    DeserializationError error;
+
+    // Runs for every message: deferred, and the payload only in debug builds
+    if (binary) {
+        DLOG_DEBUG("📨 Received binary message (%u bytes)", (unsigned)length);
+        error = deserializeMsgPack(doc, payload, length);
+    } else {
+        DLOG_DEBUG("📨 Received %u bytes: %s", (unsigned)length, (const char*)payload);
+        error = deserializeJson(doc, payload, length);
+    }
 
     if (error) {
-        Serial.print("JSON parse error: ");
-        Serial.println(error.c_str());
+        DLOG_WARN("%s parse error: %s", binary ? "MessagePack" : "JSON", error.c_str());
         return;
     }
 
     const char* type = doc["type"];
     if (!type) {
-        Serial.println("⚠️ Message has no 'type' field");
+        DLOG_WARN("⚠️ Message has no 'type' field");
         return;
     }
 
-    Serial.print("📋 Message type: ");
-    Serial.println(type);
+    DLOG_DEBUG("📋 Message type: %s", type);
 
     if (strcmp(type, "welcome") == 0) {
         handleWelcome(doc);
@@ -176,43 +310,62 @@ void TrustOracleClient::handleMessage(const char* payload) {
         handleRegisterResponse(doc);
     } else if (strcmp(type, "auth_response") == 0) {
         handleAuthResponse(doc);
-    } else if (strcmp(type, "step_data_response") == 0) {
-        handleStepDataResponse(doc);
+    } else if (strcmp(type, "step_batch_response") == 0) {
+        handleStepBatchResponse(doc);
     } else if (strcmp(type, "pong") == 0) {
         handlePong(doc);
     } else if (strcmp(type, "error") == 0) {
         handleError(doc);
     } else if (strcmp(type, "pet_data") == 0) {
         handlePetData(doc);
+    } else if (strcmp(type, "pet_updated") == 0) {
+        handlePetUpdated(doc);
+    } else if (strcmp(type, "subscribed") == 0) {
+        handleSubscribed(doc);
+    } else if (strcmp(type, "pet_changed") == 0) {
+        handlePetChanged(doc);
+    } else if (strcmp(type, "balance_changed") == 0) {
+        applyBalancePush(doc["balanceMist"]);
     } else if (strcmp(type, "pet_error") == 0) {
-        Serial.println("❌ Pet error received:");
         const char* error = doc["error"];
-        if (error) {
-            Serial.printf("   %s\n", error);
-        }
+        DLOG_WARN("❌ Pet error received: %s", error ? error : "");
         _lastError = doc["error"].as<String>();
+        if (_petSyncPending && _syncPet) {
+            PetLock lock(appState);
+            _syncPet->failSync();
+            _petSyncPending = false;
+        }
         // Hide loading overlay on error
-        loadingOverlay.hide();
+        appState.postUiEvent(UI_EVENT_ACTION_FAILED);
     } else if (strcmp(type, "pet_fed") == 0) {
-        Serial.println("✓ Pet fed successfully on blockchain");
+        DLOG_INFO("✓ Pet fed successfully on blockchain");
         // Hide loading overlay after successful feed
-        loadingOverlay.hide();
+        appState.postUiEvent(UI_EVENT_ACTION_DONE);
     } else if (strcmp(type, "pet_played") == 0) {
-        Serial.println("✓ Pet played successfully on blockchain");
+        DLOG_INFO("✓ Pet played successfully on blockchain");
         // Hide loading overlay after successful play
-        loadingOverlay.hide();
+        appState.postUiEvent(UI_EVENT_ACTION_DONE);
     } else if (strcmp(type, "resources_claimed") == 0) {
-        Serial.println("✓ Resources claimed successfully on blockchain");
+        DLOG_INFO("✓ Resources claimed successfully on blockchain");
         // Hide loading overlay after successful claim
-        loadingOverlay.hide();
+        appState.postUiEvent(UI_EVENT_ACTION_DONE);
     } else {
-        Serial.print("⚠️ Unknown message type: ");
-        Serial.println(type);
+        DLOG_WARN("⚠️ Unknown message type: %s", type);
     }
 }
 
 void TrustOracleClient::handleWelcome(JsonDocument& doc) {
     Serial.println("✓ Server welcome");
+
+    _serverOffersMsgPack = false;
+    _binaryWire = false;  // JSON until register_response says otherwise
+    for (JsonVariant codec : doc["codecs"].as<JsonArray>()) {
+        const char* name = codec.as<const char*>();
+        if (name && strcmp(name, "msgpack") == 0) {
+            _serverOffersMsgPack = true;
+        }
+    }
+
     _status = "Registering";
     sendRegister();
 }
@@ -229,6 +382,13 @@ void TrustOracleClient::handleRegisterResponse(JsonDocument& doc) {
         _registered = true;
         _status = "Registered";
 
+        // Server switches codec right after this response
+        const char* codec = doc["codec"];
+        _binaryWire = codec && strcmp(codec, "msgpack") == 0;
+        if (_binaryWire) {
+            Serial.println("✓ Using MessagePack binary wire format");
+        }
+
         // Auto-authenticate
         sendAuthenticate();
     } else {
@@ -244,7 +404,9 @@ void TrustOracleClient::handleAuthResponse(JsonDocument& doc) {
         Serial.println("✓ Authenticated!");
         _authenticated = true;
         _status = "Ready";
-        _lastPingTime = millis();
+        _link.onAuthenticated(appClock->millis());
+        _endpoints.recordSession(_link.stats().authMs);
+        Serial.printf("[LINK] Authenticated in %lu ms\n", (unsigned long)_link.stats().authMs);
 
         // Request pet data to get pet object ID
         Serial.println("Requesting pet data...");
@@ -256,25 +418,8 @@ void TrustOracleClient::handleAuthResponse(JsonDocument& doc) {
     }
 }
 
-void TrustOracleClient::handleStepDataResponse(JsonDocument& doc) {
-    bool success = doc["success"];
-    if (success) {
-        Serial.println("✓ Step data accepted!");
-        Serial.print("  Data ID: ");
-        Serial.println(doc["dataId"].as<int>());
-        Serial.print("  Steps: ");
-        Serial.println(doc["stepCount"].as<int>());
-        Serial.print("  Verified: ");
-        Serial.println(doc["verified"].as<bool>() ? "YES" : "NO");
-    } else {
-        Serial.print("✗ Step data rejected: ");
-        Serial.println(doc["message"].as<const char*>());
-        _lastError = doc["message"].as<String>();
-    }
-}
-
 void TrustOracleClient::handlePong(JsonDocument& doc) {
-    // Keep-alive successful
+    _link.onPong(doc["seq"].as<unsigned long>(), appClock->millis());
 }
 
 void TrustOracleClient::handleError(JsonDocument& doc) {
@@ -306,12 +451,11 @@ void TrustOracleClient::handlePetData(JsonDocument& doc) {
             Serial.printf("  pet_object_id: %s\n", petObjIdStr ? petObjIdStr : "NULL");
 
             if (petObjIdStr && strlen(petObjIdStr) > 0) {
-                // Update global petObjectId variable
-                extern String petObjectId;
-                petObjectId = String(petObjIdStr);
+                // Shared with the UI and the RPC worker
+                appState.setPetObjectId(petObjIdStr);
 
                 Serial.print("✓ Pet NFT Object ID: ");
-                Serial.println(petObjectId.c_str());
+                Serial.println(petObjIdStr);
 
                 // Check if pet is on-chain
                 bool onChain = pet["on_chain"];
@@ -323,6 +467,9 @@ void TrustOracleClient::handlePetData(JsonDocument& doc) {
             } else {
                 Serial.println("⚠️ Pet has no object ID - not on blockchain yet");
             }
+
+            // Let the server push pet/wallet changes from now on
+            subscribe(petObjIdStr);
         } else {
             Serial.println("❌ Pet object is null");
         }
@@ -335,153 +482,423 @@ void TrustOracleClient::handlePetData(JsonDocument& doc) {
     }
 }
 
-void TrustOracleClient::sendRegister() {
-    StaticJsonDocument<512> doc;
-    doc["type"] = "register";
-    doc["deviceId"] = _deviceId;
-    doc["publicKey"] = "0x" + _publicKeyHex;
+// ============================================
+// Message Encoding (TX arena)
+// ============================================
+
+// Heap blocks in use (walks the heap, about as costly as a small send)
+static size_t heapBlocks() {
+    multi_heap_info_t info;
+    heap_caps_get_info(&info, MALLOC_CAP_DEFAULT);
+    return info.allocated_blocks;
+}
+
+void TrustOracleClient::markHeap() {
+    _heapMark = heapBlocks();
+}
 
-    String json;
-    serializeJson(doc, json);
+// Blocks allocated since markHeap(). Other tasks allocate and free at the
+// same time, so a nonzero count is a lead to check, not proof on its own.
+void TrustOracleClient::countHeap() {
+    size_t blocks = heapBlocks();
+    if (blocks > _heapMark) {
+        _txHeapAllocs += blocks - _heapMark;
+    }
+}
+
+void TrustOracleClient::beginMessage(TxArena& tx, const char* type) {
+    markHeap();
+    tx.reset();
+    tx.setBinary(_binaryWire);
+    tx.beginObject();
+    if (type) {
+        tx.key("type").value(type);
+    }
+}
+
+bool TrustOracleClient::sendMessage(TxArena& tx) {
+    if (!tx.ok()) {
+        Serial.printf("✗ TX arena overflow (%u bytes)\n", (unsigned)tx.length());
+        _lastError = "Message too large";
+        return false;
+    }
+
+    // Header is written into the reserved bytes in front of the payload,
+    // so the library masks and sends in place without copying
+    bool sent = tx.isBinary()
+        ? _webSocket.sendBIN(tx.frame(), tx.length(), true)
+        : _webSocket.sendTXT(tx.frame(), tx.length(), true);
+
+    countHeap();
+    _txMessages++;
+    _link.onTx(tx.length());
+    return sent;
+}
+
+bool TrustOracleClient::queueMessage(TxArena& tx, TxPriority priority, uint8_t kind) {
+    if (!tx.ok()) {
+        Serial.printf("✗ TX arena overflow (%u bytes)\n", (unsigned)tx.length());
+        _lastError = "Message too large";
+        return false;
+    }
+
+    TxPushResult result = _txQueue.push(priority, kind, tx, appClock->millis());
+    countHeap();
+
+    if (result == TX_PUSH_FULL) {
+        Serial.printf("⚠️ TX queue full (%u bytes queued), message refused\n",
+                      (unsigned)_txQueue.stats().bytes);
+        _lastError = "TX queue full";
+        return false;
+    }
+    return true;
+}
+
+void TrustOracleClient::drainQueue(unsigned long now) {
+    size_t budget = TX_QUEUE_DRAIN_BYTES;
+    TxFrame frame;
+
+    while (_txQueue.peek(frame)) {
+        // Encoded for a session with a different codec
+        if (frame.binary != _binaryWire) {
+            Serial.println("⚠️ Queued message dropped (codec changed)");
+            _txQueue.pop(false, now);
+            onQueuedDropped(frame.kind);
+            continue;
+        }
+
+        // Nothing is masked or written until a send is attempted, so a
+        // frame stays queued for the next session only up to here
+        if (!_webSocket.isConnected()) return;
+
+        bool sent;
+        {
+            TRACE_SCOPE("ws send");
+            markHeap();
+            sent = frame.binary
+                ? _webSocket.sendBIN(frame.frame, frame.length, true)
+                : _webSocket.sendTXT(frame.frame, frame.length, true);
+            countHeap();
+        }
+
+        if (!sent) {
+            // The library masks the payload in place before writing it, so
+            // a failed send leaves a frame that can never be sent again
+            _txQueue.pop(false, now);
+            onQueuedDropped(frame.kind);
+            return;
+        }
+
+        _txQueue.pop(true, now);
+        _txMessages++;
+        _link.onTx(frame.length);
+
+        // Let the rest of loop() run between large frames
+        if (frame.length >= budget) return;
+        budget -= frame.length;
+    }
+}
+
+void TrustOracleClient::onQueuedDropped(uint8_t kind) {
+    if (kind == TX_KIND_UPDATE_PET && _petSyncPending) {
+        PetLock lock(appState);
+        if (_syncPet) _syncPet->failSync();
+        _petSyncPending = false;
+    } else if (kind == TX_KIND_STEP_BATCH && _stepBatch) {
+        _stepBatch->failSend();  // Windows stay for the next flush
+        _stepBatch = nullptr;
+    }
+}
+
+void TrustOracleClient::sendRegister() {
+    beginMessage("register");
+    _tx.key("deviceId").value(_deviceId.c_str());
+    _tx.key("publicKey").valueHex(_keypair.getPublicKey(&_keypair), 32, true);
+#if ORACLE_WIRE_MSGPACK
+    if (_serverOffersMsgPack) {
+        _tx.key("codec").value("msgpack");
+    }
+#endif
+    _tx.endObject();
 
     Serial.println("Sending registration...");
-    _webSocket.sendTXT(json);
+    sendMessage();
 }
 
 void TrustOracleClient::sendAuthenticate() {
-    StaticJsonDocument<256> doc;
-    doc["type"] = "authenticate";
-    doc["deviceId"] = _deviceId;
-
-    String json;
-    serializeJson(doc, json);
+    beginMessage("authenticate");
+    _tx.key("deviceId").value(_deviceId.c_str());
+    _tx.endObject();
 
     Serial.println("Sending authentication...");
-    _webSocket.sendTXT(json);
+    sendMessage();
 }
 
 void TrustOracleClient::sendPing() {
-    StaticJsonDocument<128> doc;
-    doc["type"] = "ping";
+    beginMessage("ping");
+    _tx.key("seq").value((unsigned long)_link.beginPing(appClock->millis()));
+    _tx.endObject();
+    sendMessage();
+}
 
-    String json;
-    serializeJson(doc, json);
-    _webSocket.sendTXT(json);
+void TrustOracleClient::sendMetrics() {
+    const WiFiStats& wifi = connectivity.stats();
+    const LinkStats& link = _link.stats();
+    SignStats sign;
+    _signer.getStats(sign);
+
+    beginMessage("metrics");
+    _tx.key("connects").value((unsigned long)link.connects);
+    _tx.key("disconnects").value((unsigned long)link.disconnects);
+    _tx.key("txBytes").value((unsigned long)link.txBytes);
+    _tx.key("rxBytes").value((unsigned long)link.rxBytes);
+    _tx.key("pings").value((unsigned long)link.pings);
+    _tx.key("pongsMissed").value((unsigned long)link.pongsMissed);
+    _tx.key("rttLastMs").value((unsigned long)link.rttLastMs);
+    _tx.key("rttP50Ms").value((unsigned long)_link.rttPercentile(50));
+    _tx.key("rttP95Ms").value((unsigned long)_link.rttPercentile(95));
+    _tx.key("keepaliveMs").value((unsigned long)link.keepaliveMs);
+    _tx.key("natTimeoutMs").value((unsigned long)link.natTimeoutMs);
+    _tx.key("authMs").value((unsigned long)link.authMs);
+    _tx.key("outageMs").value((unsigned long)link.outageMs);
+    _tx.key("signAvgUs").value((unsigned long)sign.avgUs);
+    _tx.key("signMaxUs").value((unsigned long)sign.maxUs);
+    _tx.key("endpoint").value(_endpoints.get(_endpoints.current()).host);
+    _tx.key("endpointPort").value((unsigned long)_endpoints.get(_endpoints.current()).port);
+    _tx.key("failovers").value((unsigned long)_endpoints.getFailovers());
+    const TxQueueStats& queue = _txQueue.stats();
+    _tx.key("txQueueMax").value((unsigned long)queue.maxDepth);
+    _tx.key("txQueueMaxBytes").value((unsigned long)queue.maxBytes);
+    _tx.key("txCoalesced").value((unsigned long)queue.coalesced);
+    _tx.key("txRejected").value((unsigned long)queue.rejected);
+    _tx.key("txHeapAllocs").value((unsigned long)_txHeapAllocs);
+    _tx.key("txWaitInteractiveMs").value((unsigned long)queue.waitAvgMs[TX_INTERACTIVE]);
+    _tx.key("txWaitTelemetryMs").value((unsigned long)queue.waitAvgMs[TX_TELEMETRY]);
+    _tx.key("txWaitBulkMs").value((unsigned long)queue.waitAvgMs[TX_BULK]);
+    _tx.key("txWaitMaxMs").value((unsigned long)queue.waitMaxMs[TX_INTERACTIVE]);
+    _tx.key("wifiTimeToIpMs").value((unsigned long)wifi.lastTimeToIpMs);
+    _tx.key("wifiFastConnects").value((unsigned long)wifi.fastConnects);
+    _tx.key("wifiConnects").value((unsigned long)wifi.connects);
+    _tx.key("wifiDrops").value((unsigned long)wifi.drops);
+    TaskStats ui, net, sensor;
+    if (taskMonitor.getStats(APP_TASK_UI, ui)) {
+        _tx.key("loopUiPct").value((unsigned long)ui.loopPct);
+        _tx.key("stackUiFree").value((unsigned long)ui.stackFree);
+    }
+    if (taskMonitor.getStats(APP_TASK_NET, net)) {
+        _tx.key("loopNetPct").value((unsigned long)net.loopPct);
+        _tx.key("stackNetFree").value((unsigned long)net.stackFree);
+    }
+    if (taskMonitor.getStats(APP_TASK_SENSOR, sensor)) {
+        _tx.key("loopSensorPct").value((unsigned long)sensor.loopPct);
+        _tx.key("stackSensorFree").value((unsigned long)sensor.stackFree);
+    }
+#if PROFILER_ENABLED
+    // Per subsystem since boot: [count, p50Us, p99Us, maxUs]
+    _tx.key("spans").beginObject();
+    for (uint8_t span = 0; span < PROF_SPAN_COUNT; span++) {
+        SpanStats s;
+        if (!profiler.getStats(span, s) || s.count == 0) continue;
+        _tx.key(s.name).beginArray();
+        _tx.value((unsigned long)s.count).value((unsigned long)s.p50Us);
+        _tx.value((unsigned long)s.p99Us).value((unsigned long)s.maxUs);
+        _tx.endArray();
+    }
+    _tx.endObject();
+    _tx.key("profilerPpm").value((unsigned long)profiler.overheadPpm());
+#endif
+    _tx.key("uptimeMs").value(appClock->millis());
+    _tx.endObject();
+
+    queueMessage(TX_TELEMETRY, TX_KIND_METRICS);
+    _link.metricsSent(appClock->millis());  // Next report on schedule even if this one failed
 }
 
-bool TrustOracleClient::submitStepData(int stepCount, unsigned long timestamp,
-                                       int batteryPercent, float accSamples[][3], int sampleCount) {
+bool TrustOracleClient::submitStepBatch(StepBatch& batch) {
     if (!_authenticated) {
         _lastError = "Not authenticated";
         return false;
     }
+    if (_stepBatch || _signPending || batch.isSending() || batch.isEmpty()) {
+        return false;
+    }
+    if (!hasTxRoom(TX_BULK)) {
+        _lastError = "TX queue full";  // Backpressure: windows keep accumulating
+        return false;
+    }
+
+    int n = batch.beginSend();
+    Serial.printf("\n=== Submitting step batch (%d windows) ===\n", n);
+
+    beginMessage(_signedTx, "step_batch");
+    uint8_t* root = _signedTx.scratch(32);
+    uint8_t* commitment = _signedTx.scratch(34 + _deviceId.length());
+    uint8_t* leaf = _signedTx.scratch(STEP_BATCH_LEAF_MAX);
+    if (!root || !commitment || !leaf) {
+        batch.failSend();
+        _lastError = "Message too large";
+        return false;
+    }
 
-    Serial.println("\n=== Submitting to Oracle ===");
-    Serial.printf("Submitting step data (%d steps)...\n", stepCount);
-
-    // Build payload (data to be signed)
-    StaticJsonDocument<2048> payloadDoc;
-    payloadDoc["deviceId"] = _deviceId;
-    payloadDoc["stepCount"] = stepCount;
-    payloadDoc["timestamp"] = timestamp;
-    payloadDoc["firmwareVersion"] = 100;
-    payloadDoc["batteryPercent"] = batteryPercent;
-
-    // Add accelerometer samples
-    JsonArray samples = payloadDoc.createNestedArray("rawAccSamples");
-    for (int i = 0; i < sampleCount && i < 10; i++) {
-        JsonArray sample = samples.createNestedArray();
-        sample.add(accSamples[i][0]);
-        sample.add(accSamples[i][1]);
-        sample.add(accSamples[i][2]);
-    }
-
-    // Sign the payload
-    String signature = signPayload(payloadDoc);
-
-    // Build message (includes payload + signature)
-    StaticJsonDocument<2048> messageDoc;
-    messageDoc["type"] = "step_data";
-    messageDoc["deviceId"] = _deviceId;
-    messageDoc["stepCount"] = stepCount;
-    messageDoc["timestamp"] = timestamp;
-    messageDoc["firmwareVersion"] = 100;
-    messageDoc["batteryPercent"] = batteryPercent;
-    messageDoc["rawAccSamples"] = payloadDoc["rawAccSamples"];
-    messageDoc["signature"] = signature;
-
-    String json;
-    serializeJson(messageDoc, json);
-
-    _webSocket.sendTXT(json);
+    // One signature over root | windowCount u16 LE | deviceId
+    batch.computeRoot(n, root);
+    size_t commitLen = 0;
+    memcpy(commitment, root, 32);
+    commitLen += 32;
+    commitment[commitLen++] = n & 0xFF;
+    commitment[commitLen++] = (n >> 8) & 0xFF;
+    memcpy(commitment + commitLen, _deviceId.c_str(), _deviceId.length());
+    commitLen += _deviceId.length();
+
+    // Everything but the signature is encoded while the worker signs
+    _signedTx.key("deviceId").value(_deviceId.c_str());
+    _signedTx.key("root").valueHex(root, 32);
+    _signedTx.key("windows").beginArray();
+    for (int i = 0; i < n; i++) {
+        const StepWindow& w = batch.window(i);
+        _signedTx.beginObject();
+        _signedTx.key("stepCount").value((unsigned long)w.stepCount);
+        _signedTx.key("timestamp").value((unsigned long long)w.timestamp);
+        _signedTx.key("batteryPercent").value((int)w.batteryPercent);
+        // Samples exactly as hashed into the leaf (int16 LE milli-g)
+        size_t leafLen = batch.encodeLeaf(i, leaf);
+        _signedTx.key("samples").valueHex(leaf + 14, leafLen - 14);
+        _signedTx.endObject();
+    }
+    _signedTx.endArray();
+    countHeap();
+
+    if (_signedTx.overflowed()) {
+        batch.failSend();
+        _lastError = "Message too large";
+        return false;
+    }
+
+    if (!signAsync(commitment, commitLen)) {
+        batch.failSend();
+        return false;
+    }
+
+    _stepBatch = &batch;
+    Serial.printf("📦 Step batch queued for signing: %d windows\n", n);
     return true;
 }
 
-String TrustOracleClient::signPayload(JsonDocument& payload) {
-    // 1. Build canonical JSON (sorted keys)
-    String canonicalJson = buildCanonicalJSON(payload);
+void TrustOracleClient::handleStepBatchResponse(JsonDocument& doc) {
+    StepBatch* batch = _stepBatch;
+    _stepBatch = nullptr;
+    if (!batch) return;
 
-    Serial.println("Canonical JSON:");
-    Serial.println(canonicalJson);
+    if (doc["success"].as<bool>()) {
+        Serial.printf("✓ Step batch accepted (%d windows, %lu steps)\n",
+                      doc["windows"].as<int>(), doc["totalSteps"].as<unsigned long>());
+        batch->completeSend();
+    } else {
+        Serial.printf("✗ Step batch rejected: %s\n", doc["error"].as<const char*>());
+        _lastError = doc["error"].as<String>();
+        batch->failSend();
+    }
+}
 
-    // 2. SHA256 hash using mbedtls
-    uint8_t hash[32];
-    mbedtls_sha256_context ctx;
-    mbedtls_sha256_init(&ctx);
-    mbedtls_sha256_starts(&ctx, 0);  // 0 = SHA256 (not SHA224)
-    mbedtls_sha256_update(&ctx, (const unsigned char*)canonicalJson.c_str(), canonicalJson.length());
-    mbedtls_sha256_finish(&ctx, hash);
-    mbedtls_sha256_free(&ctx);
+// ============================================
+// Asynchronous Signing
+// ============================================
 
-    Serial.print("Hash: 0x");
-    Serial.println(bytesToHex(hash, 32));
+bool TrustOracleClient::signAsync(const uint8_t* data, size_t len) {
+    Serial.printf("Signing %u bytes...\n", (unsigned)len);
 
-    // 3. Sign with Ed25519 using MicroSui
-    uint8_t sui_sig[97];  // MicroSui signature format (1 byte scheme + 64 bytes sig + 32 bytes pubkey)
-    int result = microsui_sign_ed25519(sui_sig, hash, 32, _keypair.secret_key);
+    portENTER_CRITICAL(&_signLock);
+    _signDone = false;
+    portEXIT_CRITICAL(&_signLock);
 
-    if (result != 0) {
-        Serial.println("✗ Signing failed!");
-        return "";
+    // data lives in _signedTx, which nobody touches until finishSignedMessage()
+    _signPending = true;
+    _signFinalized = false;
+    if (!_signer.submit(data, len, onSigned, this)) {
+        _signPending = false;
+        _lastError = "Signing failed";
+        return false;
     }
+    return true;
+}
 
-    // Extract just the 64-byte signature (skip scheme byte at index 0)
-    String signatureHex = bytesToHex(sui_sig + 1, 64);  // Ed25519 signature is 64 bytes
-
-    Serial.print("  Signature: 0x");
-    Serial.println(signatureHex);
+// Runs on the signing task
+void TrustOracleClient::onSigned(bool ok, const uint8_t signature[64], void* context) {
+    TrustOracleClient* client = static_cast<TrustOracleClient*>(context);
 
-    return signatureHex;
+    portENTER_CRITICAL(&client->_signLock);
+    if (ok) {
+        memcpy(client->_signature, signature, 64);
+    }
+    client->_signOk = ok;
+    client->_signDone = true;
+    portEXIT_CRITICAL(&client->_signLock);
 }
 
-String TrustOracleClient::buildCanonicalJSON(JsonDocument& obj) {
-    // Sort keys alphabetically and build JSON string
-    // ArduinoJson maintains insertion order, so we need to rebuild sorted
+void TrustOracleClient::finishSignedMessage() {
+    portENTER_CRITICAL(&_signLock);
+    bool done = _signDone;
+    bool ok = _signOk;
+    portEXIT_CRITICAL(&_signLock);
 
-    StaticJsonDocument<2048> sorted;
+    if (!done) return;
+
+    StepBatch* batch = _stepBatch;
+
+    if (!ok) {
+        Serial.println("✗ Signing failed!");
+        _lastError = "Signing failed";
+        _signPending = false;
+        if (batch) {
+            batch->failSend();
+            _stepBatch = nullptr;
+        }
+        return;
+    }
 
-    // Extract and sort keys
-    String keys[] = {"batteryPercent", "deviceId", "firmwareVersion", "rawAccSamples", "stepCount", "timestamp"};
-    int keyCount = 6;
+    if (!_signFinalized) {
+        markHeap();
+        _signedTx.key("signature").valueHex(_signature, 64);
+        _signedTx.endObject();
+        countHeap();
+        _signFinalized = true;
+    }
 
-    // Add in sorted order
-    for (int i = 0; i < keyCount; i++) {
-        if (obj.containsKey(keys[i])) {
-            sorted[keys[i]] = obj[keys[i]];
+    // Backpressure: hold the signed message here until bulk has room. Once
+    // queued it survives reconnects and failover (the signature is server
+    // independent); the drain drops it if the next session's codec differs.
+    if (_signedTx.ok() && !_txQueue.hasRoom(TX_BULK, _signedTx.length())) return;
+
+    _signPending = false;
+    markHeap();
+    if (!queueMessage(_signedTx, TX_BULK, TX_KIND_STEP_BATCH)) {
+        if (batch) {
+            batch->failSend();
+            _stepBatch = nullptr;
         }
+        return;
     }
 
-    String result;
-    serializeJson(sorted, result);
-    return result;
+    SignStats stats;
+    _signer.getStats(stats);
+    if (batch) {
+        Serial.printf("📦 Step batch queued: %d windows, %u bytes, 1 signature (%lu us)\n",
+                      batch->sendingCount(), (unsigned)_signedTx.length(),
+                      (unsigned long)stats.lastUs);
+    }
 }
 
 String TrustOracleClient::bytesToHex(const uint8_t* bytes, size_t len) {
-    String hex = "";
-    for (size_t i = 0; i < len; i++) {
-        char buf[3];
-        sprintf(buf, "%02x", bytes[i]);
+    // Setup/diagnostics only - steady-state paths use TxArena::valueHex
+    char buf[129];
+    String hex;
+    hex.reserve(len * 2);
+    while (len > 0) {
+        size_t chunk = len > 64 ? 64 : len;
+        TxArena::toHex(buf, bytes, chunk);
         hex += buf;
+        bytes += chunk;
+        len -= chunk;
     }
     return hex;
 }
@@ -537,105 +954,237 @@ void TrustOracleClient::saveKeypairToFlash() {
 // Virtual Pet Sync Functions
 // ============================================
 
-bool TrustOracleClient::syncPet(const String& petJson) {
+bool TrustOracleClient::syncPet(VirtualPet& pet) {
     if (!_connected || !_authenticated) {
         Serial.println("✗ Not connected/authenticated");
         return false;
     }
 
-    JsonDocument doc;
-    deserializeJson(doc, petJson);
+    // A delta still waiting in the outbox is rebuilt with the newer values
+    // and replaces it; once sent we wait for the ack as before
+    bool queued = _petSyncPending && _txQueue.contains(TX_KIND_UPDATE_PET);
+    if (_petSyncPending && !queued) {
+        Serial.println("⏳ Pet sync already in flight");
+        return true;
+    }
 
-    JsonDocument message;
-    message["type"] = "updatePet";
-    message["deviceId"] = _deviceId;
+    if (!pet.isDirty()) {
+        Serial.println("🐾 Pet unchanged - sync skipped");
+        return true;
+    }
 
-    // Copy pet stats (including new resources)
-    message["happiness"] = doc["happiness"];
-    message["hunger"] = doc["hunger"];
-    message["health"] = doc["health"];
-    message["experience"] = doc["experience"];
-    message["total_steps_fed"] = doc["totalStepsFed"];
-    message["level"] = doc["level"];
-    message["food"] = doc["food"];
-    message["energy"] = doc["energy"];
+    // Only fields changed since the last acknowledged version
+    // (beginSync merges new changes with those already in flight)
+    uint32_t baseVersion = pet.getSyncVersion();
+    uint16_t fields = pet.beginSync();
+
+    beginMessage("updatePet");
+    _tx.key("deviceId").value(_deviceId.c_str());
+    _tx.key("baseVersion").value((unsigned long)baseVersion);
+
+    if (fields & PET_SYNC_HAPPINESS) _tx.key("happiness").value(pet.getHappiness());
+    if (fields & PET_SYNC_HUNGER) _tx.key("hunger").value(pet.getHunger());
+    if (fields & PET_SYNC_HEALTH) _tx.key("health").value(pet.getHealth());
+    if (fields & PET_SYNC_EXPERIENCE) _tx.key("experience").value(pet.getExperience());
+    if (fields & PET_SYNC_TOTAL_STEPS_FED) _tx.key("total_steps_fed").value(pet.getTotalStepsFed());
+    if (fields & PET_SYNC_LEVEL) _tx.key("level").value((int)pet.getLevel());
+    if (fields & PET_SYNC_FOOD) _tx.key("food").value(pet.getFood());
+    if (fields & PET_SYNC_ENERGY) _tx.key("energy").value(pet.getEnergy());
+    _tx.endObject();
+
+    if (!queueMessage(TX_TELEMETRY, TX_KIND_UPDATE_PET)) {
+        // Fields go back to dirty; a refused rebuild leaves the older
+        // delta queued and still awaiting its ack
+        pet.failSync();
+        return false;
+    }
 
-    String msg;
-    serializeJson(message, msg);
-    _webSocket.sendTXT(msg);
+    _syncPet = &pet;
+    _petSyncPending = true;
 
-    Serial.println("🐾 Pet sync sent to server");
+    Serial.printf("🐾 Pet delta queued (base v%lu, fields 0x%02x, %u bytes)\n",
+                  (unsigned long)baseVersion, fields, (unsigned)_tx.length());
     return true;
 }
 
+void TrustOracleClient::handlePetUpdated(JsonDocument& doc) {
+    _petSyncPending = false;
+    if (!_syncPet) return;
+
+    PetLock lock(appState);
+
+    if (!doc["success"].as<bool>()) {
+        const char* error = doc["error"];
+        Serial.printf("✗ Pet sync rejected: %s\n", error ? error : "unknown error");
+        _syncPet->failSync();
+        return;
+    }
+
+    uint32_t version = doc["version"].as<unsigned long>();
+    _syncPet->completeSync(version);
+
+    // Conflicting fields changed on the server since our base version - take theirs
+    int conflictCount = 0;
+    for (JsonPair conflict : doc["conflicts"].as<JsonObject>()) {
+        if (_syncPet->applyServerField(conflict.key().c_str(), conflict.value().as<long>())) {
+            conflictCount++;
+        }
+    }
+
+    if (conflictCount > 0) {
+        Serial.printf("⚠️ Pet sync v%lu: %d field(s) resolved from server\n",
+                      (unsigned long)version, conflictCount);
+    } else {
+        Serial.printf("✓ Pet synced (v%lu)\n", (unsigned long)version);
+    }
+}
+
 bool TrustOracleClient::claimResources(int steps) {
-    if (!_connected || !_authenticated) {
+    // Actions queue through a reconnect once there has been a session
+    if (!_authenticated && _link.stats().authentications == 0) {
         Serial.println("✗ Not connected/authenticated");
         return false;
     }
 
-    JsonDocument message;
-    message["type"] = "claimResources";
-    message["deviceId"] = _deviceId;
-    message["steps"] = steps;
+    beginMessage("claimResources");
+    _tx.key("deviceId").value(_deviceId.c_str());
+    _tx.key("steps").value(steps);
+    _tx.endObject();
 
-    String msg;
-    serializeJson(message, msg);
-    _webSocket.sendTXT(msg);
+    if (!queueMessage(TX_INTERACTIVE, TX_KIND_NONE)) {
+        return false;
+    }
 
-    Serial.printf("💰 Claim resources request sent (%d steps)\n", steps);
+    Serial.printf("💰 Claim resources request queued (%d steps)\n", steps);
     return true;
 }
 
 bool TrustOracleClient::feedPet() {
-    if (!_connected || !_authenticated) {
+    // Actions queue through a reconnect once there has been a session
+    if (!_authenticated && _link.stats().authentications == 0) {
         Serial.println("✗ Not connected/authenticated");
         return false;
     }
 
-    JsonDocument message;
-    message["type"] = "feedPet";
-    message["deviceId"] = _deviceId;
+    beginMessage("feedPet");
+    _tx.key("deviceId").value(_deviceId.c_str());
+    _tx.endObject();
 
-    String msg;
-    serializeJson(message, msg);
-    _webSocket.sendTXT(msg);
+    if (!queueMessage(TX_INTERACTIVE, TX_KIND_NONE)) {
+        return false;
+    }
 
-    Serial.println("🍔 Feed pet request sent (uses 1 food)");
+    Serial.println("🍔 Feed pet request queued (uses 1 food)");
     return true;
 }
 
 bool TrustOracleClient::playWithPet() {
+    // Actions queue through a reconnect once there has been a session
+    if (!_authenticated && _link.stats().authentications == 0) {
+        Serial.println("✗ Not connected/authenticated");
+        return false;
+    }
+
+    beginMessage("playWithPet");
+    _tx.key("deviceId").value(_deviceId.c_str());
+    _tx.endObject();
+
+    if (!queueMessage(TX_INTERACTIVE, TX_KIND_NONE)) {
+        return false;
+    }
+
+    Serial.println("🎮 Play with pet request queued (uses 1 energy)");
+    return true;
+}
+
+bool TrustOracleClient::subscribe(const char* petObjectId) {
     if (!_connected || !_authenticated) {
         Serial.println("✗ Not connected/authenticated");
         return false;
     }
 
-    JsonDocument message;
-    message["type"] = "playWithPet";
-    message["deviceId"] = _deviceId;
+    beginMessage("subscribe");
+    _tx.key("deviceId").value(_deviceId.c_str());
+    if (petObjectId && strlen(petObjectId) > 0) {
+        _tx.key("petObjectId").value(petObjectId);
+    }
+    if (DEVICE_WALLET_ADDRESS && strlen(DEVICE_WALLET_ADDRESS) > 0) {
+        _tx.key("wallet").value(DEVICE_WALLET_ADDRESS);
+    }
+    _tx.endObject();
 
-    String msg;
-    serializeJson(message, msg);
-    _webSocket.sendTXT(msg);
+    if (!queueMessage(TX_INTERACTIVE, TX_KIND_SUBSCRIBE)) {
+        return false;
+    }
 
-    Serial.println("🎮 Play with pet request sent (uses 1 energy)");
+    Serial.println("🔔 Subscribing to pet/wallet changes");
     return true;
 }
 
+void TrustOracleClient::handleSubscribed(JsonDocument& doc) {
+    _pushActive = doc["success"].as<bool>() && doc["push"].as<bool>();
+    suiRpc.setPushActive(_pushActive);
+
+    if (!_pushActive) {
+        Serial.println("ℹ Server push unavailable - polling Sui RPC");
+        return;
+    }
+
+    Serial.println("✓ Subscribed to pet/wallet changes");
+
+    // Initial snapshot
+    JsonObject pet = doc["pet"];
+    if (pet) applyPetPush(pet);
+    if (!doc["balanceMist"].isNull()) applyBalancePush(doc["balanceMist"]);
+}
+
+void TrustOracleClient::handlePetChanged(JsonDocument& doc) {
+    Serial.printf("🔔 Pet changed on-chain (%s)\n", doc["event"] | "updated");
+    applyPetPush(doc["pet"]);
+}
+
+void TrustOracleClient::applyPetPush(JsonObject pet) {
+    PetLock lock(appState);
+
+    // The subscribe snapshot is read before later events are polled, so
+    // pushes can arrive out of order: only a newer object version counts
+    const char* objectVersion = pet["objectVersion"];
+    if (!virtualPet.acceptServerPush(objectVersion ? strtoull(objectVersion, nullptr, 10) : 0)) {
+        Serial.printf("🔔 Stale pet push ignored (object v%s)\n", objectVersion);
+        return;
+    }
+
+    // On-chain state wins, same as a sync conflict, except over local
+    // changes still waiting for their ack
+    for (JsonPair field : pet) {
+        if (!field.value().isNull()) {
+            virtualPet.applyServerField(field.key().c_str(), field.value().as<long>());
+        }
+    }
+}
+
+void TrustOracleClient::applyBalancePush(JsonVariant balanceMist) {
+    // u64 MIST arrives as a decimal string
+    const char* text = balanceMist.as<const char*>();
+    int64_t mist = text ? strtoll(text, nullptr, 10) : balanceMist.as<long long>();
+    suiRpc.publishBalance(mist);
+
+    Serial.printf("🔔 Balance pushed: %lld MIST\n", (long long)mist);
+}
+
 void TrustOracleClient::requestPetData() {
     if (!_connected || !_authenticated) {
         Serial.println("✗ Not connected/authenticated");
         return;
     }
 
-    JsonDocument message;
-    message["type"] = "getPet";
-    message["deviceId"] = _deviceId;
+    beginMessage("getPet");
+    _tx.key("deviceId").value(_deviceId.c_str());
+    _tx.endObject();
 
-    String msg;
-    serializeJson(message, msg);
-    _webSocket.sendTXT(msg);
+    if (!queueMessage(TX_INTERACTIVE, TX_KIND_GET_PET)) {
+        return;
+    }
 
     Serial.println("📡 Requesting pet data from server");
 }
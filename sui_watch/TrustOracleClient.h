@@ -1,7 +1,8 @@
 /**
  * Trust Oracle Client for ESP32
  * Handles WebSocket communication with Trust Oracle backend
- * Implements Ed25519 signing for step data using MicroSui
+ * Step data is signed off the loop thread by SignWorker (MicroSui keypair)
+ * Outgoing messages go through a prioritised TxQueue drained from loop()
  */
 
 #ifndef TRUST_ORACLE_CLIENT_H
@@ -12,6 +13,19 @@
 #include <ArduinoJson.h>
 #include <MicroSui.h>  // MicroSui library (includes Keypair and compact_ed25519)
 #include <Preferences.h>  // ESP32 NVS for persistent keypair storage
+#include "TxArena.h"
+#include "TxQueue.h"
+#include "VirtualPet.h"
+#include "StepBatch.h"
+#include "SignWorker.h"
+#include "LinkMonitor.h"
+#include "OracleEndpoints.h"
+
+// Request the MessagePack binary wire format when the server offers it.
+// Set to 0 to always stay on JSON text frames.
+#ifndef ORACLE_WIRE_MSGPACK
+#define ORACLE_WIRE_MSGPACK 1
+#endif
 
 class TrustOracleClient {
 public:
@@ -26,24 +40,50 @@ public:
     bool isConnected();
     bool isRegistered();
     bool isAuthenticated();
+    bool isBinaryWire() { return _binaryWire; }
 
-    // Step data submission
-    bool submitStepData(int stepCount, unsigned long timestamp,
-                       int batteryPercent, float accSamples[][3], int sampleCount);
+    // Step data: batched windows committed by one signed Merkle root
+    // (queued for signing, sent from loop() once signed)
+    bool submitStepBatch(StepBatch& batch);
 
-    // Virtual Pet sync
-    bool syncPet(const String& petJson);
+    // Virtual Pet sync (delta: only fields changed since the last ack)
+    bool syncPet(VirtualPet& pet);
+    bool isPetSyncPending() { return _petSyncPending; }
     bool claimResources(int steps);  // Claim food/energy from steps
     bool feedPet();                   // Feed pet (uses 1 food)
     bool playWithPet();               // Play with pet (uses 1 energy)
     void requestPetData();
 
+    // Server push of pet object / wallet changes (replaces polling)
+    bool subscribe(const char* petObjectId);
+    bool isPushActive() { return _pushActive; }
+
     // Status
     String getStatus();
     String getLastError();
 
+    // TX stats: heap blocks allocated while encoding, queueing and sending
+    // messages (expected to stay 0; reported as txHeapAllocs in metrics)
+    uint32_t getTxMessageCount() { return _txMessages; }
+    uint32_t getTxHeapAllocations() { return _txHeapAllocs; }
+    size_t getTxHighWater() { return _tx.highWater(); }
+
+    // Outbox depth, wait times and backpressure
+    const TxQueueStats& getTxQueueStats() { return _txQueue.stats(); }
+    bool hasTxRoom(TxPriority priority) { return _txQueue.hasRoom(priority, TX_ARENA_SIZE); }
+
+    // Signing latency (worker hash + sign time, queue wait)
+    void getSignStats(SignStats& out) { _signer.getStats(out); }
+    bool isSignPending() { return _signPending; }
+
+    // Link quality (RTT, keepalive, reconnects, traffic)
+    const LinkMonitor& getLink() { return _link; }
+
+    // Endpoint list and per-endpoint health
+    const OracleEndpoints& getEndpoints() { return _endpoints; }
+
 private:
-    // Configuration
+    // Configuration (host/port is the fallback when no endpoint list is stored)
     const char* _host;
     uint16_t _port;
     String _deviceId;
@@ -54,38 +94,97 @@ private:
     bool _connected;
     bool _registered;
     bool _authenticated;
+    bool _serverOffersMsgPack;  // Advertised in welcome
+    bool _binaryWire;           // Negotiated at registration
+
+    // Outgoing message arena (fixed buffer, no per-message heap use)
+    TxArena _tx;
+    uint32_t _txMessages;
+    uint32_t _txHeapAllocs;
+    size_t _heapMark;
+
+    // Outbox: interactive > telemetry > bulk, kept across reconnects
+    TxQueue _txQueue;
+
+    // Pet delta sync in flight (one at a time)
+    VirtualPet* _syncPet;
+    bool _petSyncPending;
+
+    // Step batch in flight
+    StepBatch* _stepBatch;
+
+    // Push subscription acknowledged by the server
+    bool _pushActive;
 
     // Ed25519 Keypair (MicroSui)
     MicroSuiEd25519 _keypair;
     String _publicKeyHex;
 
+    // Step batch waiting on the worker (one at a time). It is built in its
+    // own arena so pings and pet sync keep using _tx meanwhile.
+    SignWorker _signer;
+    TxArena _signedTx;
+    bool _signPending;
+    bool _signFinalized;          // Signature appended, waiting for queue room
+    portMUX_TYPE _signLock;       // Guards the three fields below
+    bool _signDone;
+    bool _signOk;
+    uint8_t _signature[64];
+
+    // Keepalive, reconnect backoff and link counters
+    LinkMonitor _link;
+
+    // Failover between oracle servers (first connect waits for WiFi and the probe)
+    OracleEndpoints _endpoints;
+    bool _wsStarted;
+    bool _probeStarted;
+
     // Status
     String _status;
     String _lastError;
-    unsigned long _lastPingTime;
-    const unsigned long PING_INTERVAL = 30000; // 30s
 
     // WebSocket event handler
     static void webSocketEvent(WStype_t type, uint8_t* payload, size_t length);
     static TrustOracleClient* _instance; // For static callback
 
-    void handleMessage(const char* payload);
+    void handleMessage(const uint8_t* payload, size_t length, bool binary);
     void handleWelcome(JsonDocument& doc);
     void handleRegisterResponse(JsonDocument& doc);
     void handleAuthResponse(JsonDocument& doc);
-    void handleStepDataResponse(JsonDocument& doc);
+    void handleStepBatchResponse(JsonDocument& doc);
     void handlePong(JsonDocument& doc);
     void handleError(JsonDocument& doc);
     void handlePetData(JsonDocument& doc);
+    void handlePetUpdated(JsonDocument& doc);
+    void handleSubscribed(JsonDocument& doc);
+    void handlePetChanged(JsonDocument& doc);
+    void applyPetPush(JsonObject pet);
+    void applyBalancePush(JsonVariant balanceMist);
+
+    // Endpoint selection
+    void connectEndpoint(int index);
+    void failover(unsigned long now);
 
     // Message sending
+    void beginMessage(const char* type) { beginMessage(_tx, type); }
+    void beginMessage(TxArena& tx, const char* type);
+    bool sendMessage() { return sendMessage(_tx); }
+    bool sendMessage(TxArena& tx);  // Direct: session handshake and pings only
+    bool queueMessage(TxPriority priority, uint8_t kind) { return queueMessage(_tx, priority, kind); }
+    bool queueMessage(TxArena& tx, TxPriority priority, uint8_t kind);
+    void markHeap();
+    void countHeap();
+    void drainQueue(unsigned long now);
+    void onQueuedDropped(uint8_t kind);
     void sendRegister();
     void sendAuthenticate();
     void sendPing();
+    void sendMetrics();
 
-    // Signing (using MicroSui)
-    String signPayload(JsonDocument& payload);
-    String buildCanonicalJSON(JsonDocument& obj);
+    // Signing (SignWorker, completion polled from loop())
+    bool signAsync(const uint8_t* data, size_t len);
+    static void onSigned(bool ok, const uint8_t signature[64], void* context);
+    void finishSignedMessage();
     String bytesToHex(const uint8_t* bytes, size_t len);
 
     // Keypair persistence
@@ -0,0 +1,411 @@
+/**
+ * TX Arena Implementation
+ */
+
+#include "TxArena.h"
+
+static const char HEX_LUT[] = "0123456789abcdef";
+
+// ============================================
+// Arena
+// ============================================
+
+TxArena::TxArena()
+    : _len(0), _scratchTop(TX_ARENA_SIZE), _highWater(0), _overflowCount(0),
+      _overflow(false), _hasMember(0), _depth(0), _afterKey(false),
+      _binary(false), _blobStart(0), _blobLen(0) {
+}
+
+void TxArena::reset() {
+    _len = 0;
+    _scratchTop = TX_ARENA_SIZE;
+    _overflow = false;
+    _hasMember = 0;
+    _depth = 0;
+    _afterKey = false;
+    _blobStart = 0;
+    _blobLen = 0;
+}
+
+void TxArena::put(char c) {
+    if (WEBSOCKETS_MAX_HEADER_SIZE + _len >= _scratchTop) {
+        if (!_overflow) _overflowCount++;
+        _overflow = true;
+        return;
+    }
+    _buf[WEBSOCKETS_MAX_HEADER_SIZE + _len++] = (uint8_t)c;
+    if (_len > _highWater) _highWater = _len;
+}
+
+void TxArena::separator() {
+    if (_afterKey) {
+        _afterKey = false;
+        return;
+    }
+    if (_depth == 0) return;
+
+    if (_binary) {
+        _count[_depth - 1]++;
+        return;
+    }
+
+    uint32_t bit = 1UL << (_depth - 1);
+    if (_hasMember & bit) put(',');
+    _hasMember |= bit;
+}
+
+// ============================================
+// MessagePack helpers
+// ============================================
+
+void TxArena::putBE(uint32_t value, uint8_t bytes) {
+    while (bytes > 0) {
+        bytes--;
+        put((char)((value >> (bytes * 8)) & 0xFF));
+    }
+}
+
+void TxArena::putBinaryUnsigned(uint64_t num) {
+    if (num < 0x80) {
+        put((char)num);
+    } else if (num <= 0xFF) {
+        put((char)0xcc);
+        putBE(num, 1);
+    } else if (num <= 0xFFFF) {
+        put((char)0xcd);
+        putBE(num, 2);
+    } else if (num <= 0xFFFFFFFF) {
+        put((char)0xce);
+        putBE(num, 4);
+    } else {
+        put((char)0xcf);
+        putBE(num >> 32, 4);
+        putBE((uint32_t)num, 4);
+    }
+}
+
+void TxArena::putBinaryStr(const char* str, size_t len) {
+    if (len < 32) {
+        put((char)(0xa0 | len));
+    } else if (len <= 0xFF) {
+        put((char)0xd9);
+        putBE(len, 1);
+    } else {
+        put((char)0xda);
+        putBE(len, 2);
+    }
+    raw(str, len);
+}
+
+void TxArena::openBinary(uint8_t type) {
+    if (_depth >= TX_ARENA_MAX_DEPTH) {
+        if (!_overflow) _overflowCount++;
+        _overflow = true;
+        return;
+    }
+    // 16-bit count/length, patched in closeBinary()
+    _header[_depth] = _len;
+    _count[_depth] = 0;
+    _depth++;
+    put((char)type);
+    put(0);
+    put(0);
+}
+
+void TxArena::closeBinary() {
+    if (_depth == 0) return;
+    _depth--;
+
+    size_t offset = _header[_depth];
+    if (_overflow || offset + 3 > _len) return;
+
+    uint8_t* header = _buf + WEBSOCKETS_MAX_HEADER_SIZE + offset;
+    uint32_t value = (header[0] == 0xc5) ? (uint32_t)(_len - offset - 3) : _count[_depth];
+    header[1] = (value >> 8) & 0xFF;
+    header[2] = value & 0xFF;
+}
+
+// ============================================
+// Writers
+// ============================================
+
+TxArena& TxArena::beginObject() {
+    separator();
+    if (_binary) {
+        openBinary(0xde);  // map16
+        return *this;
+    }
+    put('{');
+    _depth++;
+    _hasMember &= ~(1UL << (_depth - 1));
+    return *this;
+}
+
+TxArena& TxArena::endObject() {
+    if (_binary) {
+        closeBinary();
+        return *this;
+    }
+    put('}');
+    if (_depth > 0) _depth--;
+    return *this;
+}
+
+TxArena& TxArena::beginArray() {
+    separator();
+    if (_binary) {
+        openBinary(0xdc);  // array16
+        return *this;
+    }
+    put('[');
+    _depth++;
+    _hasMember &= ~(1UL << (_depth - 1));
+    return *this;
+}
+
+TxArena& TxArena::endArray() {
+    if (_binary) {
+        closeBinary();
+        return *this;
+    }
+    put(']');
+    if (_depth > 0) _depth--;
+    return *this;
+}
+
+TxArena& TxArena::beginBlob() {
+    separator();
+    if (_binary) {
+        openBinary(0xc5);  // bin16
+    }
+    return *this;
+}
+
+TxArena& TxArena::endBlob() {
+    if (!_binary || _depth == 0) return *this;
+
+    size_t offset = _header[_depth - 1];
+    closeBinary();
+    _blobStart = offset + 3;
+    _blobLen = _len > _blobStart ? _len - _blobStart : 0;
+    return *this;
+}
+
+TxArena& TxArena::key(const char* name) {
+    separator();
+    if (_binary) {
+        putBinaryStr(name, strlen(name));
+        _afterKey = true;
+        return *this;
+    }
+    put('"');
+    raw(name);
+    put('"');
+    put(':');
+    _afterKey = true;
+    return *this;
+}
+
+TxArena& TxArena::value(const char* str) {
+    separator();
+    if (_binary) {
+        putBinaryStr(str ? str : "", str ? strlen(str) : 0);
+        return *this;
+    }
+    put('"');
+    for (const char* p = str ? str : ""; *p; p++) {
+        char c = *p;
+        if (c == '"' || c == '\\') {
+            put('\\');
+            put(c);
+        } else if ((uint8_t)c < 0x20) {
+            put('\\'); put('u'); put('0'); put('0');
+            put(HEX_LUT[(c >> 4) & 0x0F]);
+            put(HEX_LUT[c & 0x0F]);
+        } else {
+            put(c);
+        }
+    }
+    put('"');
+    return *this;
+}
+
+void TxArena::putUnsigned(uint64_t num) {
+    char digits[20];
+    int n = 0;
+    do {
+        digits[n++] = '0' + (num % 10);
+        num /= 10;
+    } while (num > 0);
+    while (n > 0) put(digits[--n]);
+}
+
+TxArena& TxArena::value(long num) {
+    separator();
+    if (_binary) {
+        if (num >= 0) {
+            putBinaryUnsigned((uint32_t)num);
+        } else if (num >= -32) {
+            put((char)(int8_t)num);  // negative fixint
+        } else if (num >= -128) {
+            put((char)0xd0);
+            putBE((uint8_t)(int8_t)num, 1);
+        } else if (num >= -32768) {
+            put((char)0xd1);
+            putBE((uint16_t)(int16_t)num, 2);
+        } else {
+            put((char)0xd2);
+            putBE((uint32_t)num, 4);
+        }
+        return *this;
+    }
+    if (num < 0) {
+        put('-');
+        putUnsigned((unsigned long)(-(num + 1)) + 1);
+    } else {
+        putUnsigned((unsigned long)num);
+    }
+    return *this;
+}
+
+TxArena& TxArena::value(unsigned long num) {
+    separator();
+    if (_binary) {
+        putBinaryUnsigned(num);
+        return *this;
+    }
+    putUnsigned(num);
+    return *this;
+}
+
+TxArena& TxArena::value(unsigned long long num) {
+    separator();
+    if (_binary) {
+        putBinaryUnsigned(num);
+        return *this;
+    }
+    putUnsigned(num);
+    return *this;
+}
+
+TxArena& TxArena::value(bool flag) {
+    separator();
+    if (_binary) {
+        put((char)(flag ? 0xc3 : 0xc2));
+        return *this;
+    }
+    raw(flag ? "true" : "false");
+    return *this;
+}
+
+TxArena& TxArena::valueFixed(float num, uint8_t decimals) {
+    // Integer formatting only - newlib's float printf allocates.
+    // Output matches JavaScript's JSON.stringify for the rounded value, so
+    // the server reproduces the exact canonical string we sign.
+    separator();
+    if (_binary) {
+        uint32_t bits;
+        memcpy(&bits, &num, sizeof(bits));
+        put((char)0xca);  // float32
+        putBE(bits, 4);
+        return *this;
+    }
+    if (decimals > 6) decimals = 6;
+
+    unsigned long scale = 1;
+    for (uint8_t i = 0; i < decimals; i++) scale *= 10;
+
+    bool negative = num < 0;
+    float magnitude = negative ? -num : num;
+    unsigned long scaled = (unsigned long)(magnitude * scale + 0.5f);
+    unsigned long whole = scaled / scale;
+    unsigned long frac = scaled % scale;
+
+    if (negative && scaled != 0) put('-');  // Never emit "-0"
+    putUnsigned(whole);
+
+    if (frac != 0) {
+        char digits[6];
+        uint8_t n = decimals;
+        for (uint8_t i = decimals; i > 0; i--) {
+            digits[i - 1] = '0' + (frac % 10);
+            frac /= 10;
+        }
+        while (n > 0 && digits[n - 1] == '0') n--;
+        put('.');
+        for (uint8_t i = 0; i < n; i++) put(digits[i]);
+    }
+    return *this;
+}
+
+TxArena& TxArena::valueHex(const uint8_t* bytes, size_t len, bool prefix0x) {
+    separator();
+    if (_binary) {
+        if (len <= 0xFF) {
+            put((char)0xc4);  // bin8
+            putBE(len, 1);
+        } else {
+            put((char)0xc5);  // bin16
+            putBE(len, 2);
+        }
+        raw((const char*)bytes, len);
+        return *this;
+    }
+    put('"');
+    if (prefix0x) {
+        put('0');
+        put('x');
+    }
+    for (size_t i = 0; i < len; i++) {
+        put(HEX_LUT[bytes[i] >> 4]);
+        put(HEX_LUT[bytes[i] & 0x0F]);
+    }
+    put('"');
+    return *this;
+}
+
+TxArena& TxArena::raw(const char* str) {
+    while (str && *str) put(*str++);
+    return *this;
+}
+
+TxArena& TxArena::raw(const char* str, size_t len) {
+    for (size_t i = 0; i < len; i++) put(str[i]);
+    return *this;
+}
+
+uint8_t* TxArena::scratch(size_t len) {
+    // Keep scratch 4-byte aligned for hash contexts
+    size_t aligned = (len + 3) & ~(size_t)3;
+    if (aligned > _scratchTop || _scratchTop - aligned < WEBSOCKETS_MAX_HEADER_SIZE + _len) {
+        if (!_overflow) _overflowCount++;
+        _overflow = true;
+        return nullptr;
+    }
+    _scratchTop -= aligned;
+    return _buf + _scratchTop;
+}
+
+TxArena& TxArena::reopenObject() {
+    if (_binary) {
+        // Count stays in _count[0]; closing again re-patches the map header
+        if (_depth == 0 && _len > 0 && _buf[WEBSOCKETS_MAX_HEADER_SIZE + _header[0]] == 0xde) {
+            _depth = 1;
+        }
+        return *this;
+    }
+    if (_depth == 0 && _len > 0 && _buf[WEBSOCKETS_MAX_HEADER_SIZE + _len - 1] == '}') {
+        _len--;
+        _depth = 1;
+        _hasMember |= 1UL;
+    }
+    return *this;
+}
+
+void TxArena::toHex(char* dst, const uint8_t* bytes, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        dst[i * 2] = HEX_LUT[bytes[i] >> 4];
+        dst[i * 2 + 1] = HEX_LUT[bytes[i] & 0x0F];
+    }
+    dst[len * 2] = '\0';
+}
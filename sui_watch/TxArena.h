@@ -0,0 +1,113 @@
+/**
+ * TX Arena for Trust Oracle messages
+ * Fixed per-client buffer that outgoing WebSocket messages are encoded into.
+ * JSON is written front-to-back after a reserved WebSocket header, short-lived
+ * scratch (hashes, signatures) is bump-allocated from the back. The arena
+ * itself never calls malloc. TrustOracleClient checks the whole path, library
+ * sends included, by comparing heap block counts around each message.
+ *
+ * The same writer API can emit MessagePack instead of JSON (binary wire
+ * format). Containers then use map16/array16 headers whose counts are
+ * patched when the container is closed.
+ */
+
+#ifndef TX_ARENA_H
+#define TX_ARENA_H
+
+#include <Arduino.h>
+#include <WebSocketsClient.h>
+
+#define TX_ARENA_SIZE 2048
+#define TX_ARENA_MAX_DEPTH 8
+
+class TxArena {
+public:
+    TxArena();
+
+    // Start a new message (drops previous message and scratch)
+    void reset();
+
+    // Encoding for the next message: false = JSON text, true = MessagePack
+    void setBinary(bool binary) { _binary = binary; }
+    bool isBinary() const { return _binary; }
+
+    // JSON writers - commas between members/elements are inserted automatically
+    TxArena& beginObject();
+    TxArena& endObject();
+    TxArena& beginArray();
+    TxArena& endArray();
+    TxArena& key(const char* name);
+    TxArena& value(const char* str);
+    TxArena& value(long num);
+    TxArena& value(unsigned long num);
+    TxArena& value(unsigned long long num);  // u64 fields (epoch ms)
+    TxArena& value(int num) { return value((long)num); }
+    TxArena& value(bool flag);
+    TxArena& valueFixed(float num, uint8_t decimals);  // Canonical: no trailing zeros (float32 in MessagePack)
+    TxArena& valueHex(const uint8_t* bytes, size_t len, bool prefix0x = false);  // Raw bin in MessagePack
+
+    // MessagePack only: nest everything written until endBlob() as one bin
+    // value (e.g. a signed body). The blob bytes stay readable via blob().
+    TxArena& beginBlob();
+    TxArena& endBlob();
+    const uint8_t* blob() const { return _buf + WEBSOCKETS_MAX_HEADER_SIZE + _blobStart; }
+    size_t blobLength() const { return _blobLen; }
+
+    // Raw bytes appended verbatim (caller keeps JSON valid)
+    TxArena& raw(const char* str);
+    TxArena& raw(const char* str, size_t len);
+
+    // Scratch memory bump-allocated from the back, valid until reset()
+    uint8_t* scratch(size_t len);
+
+    // Encoded message (payload only, excludes header reserve)
+    const char* payload() const { return (const char*)(_buf + WEBSOCKETS_MAX_HEADER_SIZE); }
+    size_t length() const { return _len; }
+    bool ok() const { return !_overflow && _depth == 0; }
+    bool overflowed() const { return _overflow; }
+
+    // Reopen the just-closed top-level object so more members can be added
+    // (e.g. a signature after the signed canonical body)
+    TxArena& reopenObject();
+
+    // Buffer to hand to sendTXT(..., headerToPayload = true)
+    uint8_t* frame() { return _buf; }
+
+    // Stats
+    size_t highWater() const { return _highWater; }
+    uint32_t overflowCount() const { return _overflowCount; }
+
+    // Lowercase hex without allocation (dst must hold len * 2 + 1 bytes)
+    static void toHex(char* dst, const uint8_t* bytes, size_t len);
+
+private:
+    uint8_t _buf[TX_ARENA_SIZE];
+    size_t _len;         // Payload bytes written after header reserve
+    size_t _scratchTop;  // Scratch grows down from the end of _buf
+    size_t _highWater;
+    uint32_t _overflowCount;
+    bool _overflow;
+
+    // Comma bookkeeping: bit N set = container at depth N already has a member
+    uint32_t _hasMember;
+    uint8_t _depth;
+    bool _afterKey;
+
+    // MessagePack bookkeeping: header offset and element count per depth
+    bool _binary;
+    size_t _header[TX_ARENA_MAX_DEPTH];
+    uint16_t _count[TX_ARENA_MAX_DEPTH];
+    size_t _blobStart;
+    size_t _blobLen;
+
+    void separator();
+    void put(char c);
+    void putUnsigned(uint64_t num);
+    void putBE(uint32_t value, uint8_t bytes);
+    void putBinaryUnsigned(uint64_t num);
+    void putBinaryStr(const char* str, size_t len);
+    void openBinary(uint8_t type);
+    void closeBinary();
+};
+
+#endif
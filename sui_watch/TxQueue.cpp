@@ -0,0 +1,137 @@
+/**
+ * TX Queue Implementation
+ */
+
+#include "TxQueue.h"
+
+TxQueue::TxQueue() : _count(0), _used(0), _peeked(-1) {
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+// Share of the pool (bytes or slots) a class may fill
+size_t TxQueue::limitFor(TxPriority priority, size_t total) {
+    switch (priority) {
+        case TX_INTERACTIVE: return total;
+        case TX_TELEMETRY:   return total * 3 / 4;
+        default:             return total / 2;
+    }
+}
+
+bool TxQueue::hasRoom(TxPriority priority, size_t len) const {
+    size_t size = WEBSOCKETS_MAX_HEADER_SIZE + len;
+    return _count < limitFor(priority, TX_QUEUE_SLOTS) &&
+           _used + size <= limitFor(priority, TX_QUEUE_BYTES);
+}
+
+TxPushResult TxQueue::push(TxPriority priority, uint8_t kind, const TxArena& tx, unsigned long now) {
+    size_t size = WEBSOCKETS_MAX_HEADER_SIZE + tx.length();
+
+    // Space held by the message this one supersedes counts as free
+    int old = kind != TX_KIND_NONE ? find(kind) : -1;
+    size_t freed = old >= 0 ? _entries[old].size : 0;
+    size_t slots = _count - (old >= 0 ? 1 : 0);
+
+    if (slots >= limitFor(priority, TX_QUEUE_SLOTS) ||
+        _used - freed + size > limitFor(priority, TX_QUEUE_BYTES)) {
+        _stats.rejected++;
+        return TX_PUSH_FULL;
+    }
+
+    unsigned long queuedAt = now;
+    if (old >= 0) {
+        queuedAt = _entries[old].queuedAt;
+        erase(old);
+        _stats.coalesced++;
+    }
+
+    Entry& e = _entries[_count++];
+    e.offset = _used;
+    e.size = size;
+    e.kind = kind;
+    e.priority = priority;
+    e.binary = tx.isBinary();
+    e.queuedAt = queuedAt;
+    memcpy(_pool + _used + WEBSOCKETS_MAX_HEADER_SIZE, tx.payload(), tx.length());
+    _used += size;
+
+    _stats.queued++;
+    _stats.depth = _count;
+    _stats.bytes = _used;
+    if (_count > _stats.maxDepth) _stats.maxDepth = _count;
+    if (_used > _stats.maxBytes) _stats.maxBytes = _used;
+
+    _peeked = -1;
+    return old >= 0 ? TX_PUSH_COALESCED : TX_PUSH_QUEUED;
+}
+
+bool TxQueue::peek(TxFrame& out) {
+    _peeked = -1;
+    for (int i = 0; i < _count; i++) {
+        if (_peeked < 0 || _entries[i].priority < _entries[_peeked].priority) {
+            _peeked = i;
+        }
+    }
+    if (_peeked < 0) return false;
+
+    const Entry& e = _entries[_peeked];
+    out.frame = _pool + e.offset;
+    out.length = e.size - WEBSOCKETS_MAX_HEADER_SIZE;
+    out.binary = e.binary;
+    out.kind = e.kind;
+    out.priority = (TxPriority)e.priority;
+    return true;
+}
+
+void TxQueue::pop(bool sent, unsigned long now) {
+    if (_peeked < 0) return;
+
+    const Entry& e = _entries[_peeked];
+    if (sent) {
+        uint8_t p = e.priority;
+        uint32_t waitMs = now - e.queuedAt;
+        _stats.sent[p]++;
+        _stats.waitAvgMs[p] = _stats.waitAvgMs[p] == 0 ? waitMs
+                            : _stats.waitAvgMs[p] - _stats.waitAvgMs[p] / 8 + waitMs / 8;
+        if (waitMs > _stats.waitMaxMs[p]) _stats.waitMaxMs[p] = waitMs;
+    } else {
+        _stats.dropped++;
+    }
+    erase(_peeked);
+}
+
+bool TxQueue::contains(uint8_t kind) const {
+    return find(kind) >= 0;
+}
+
+bool TxQueue::remove(uint8_t kind) {
+    int index = find(kind);
+    if (index < 0) return false;
+    _stats.dropped++;
+    erase(index);
+    return true;
+}
+
+int TxQueue::find(uint8_t kind) const {
+    for (int i = 0; i < _count; i++) {
+        if (_entries[i].kind == kind) return i;
+    }
+    return -1;
+}
+
+void TxQueue::erase(int index) {
+    // Frames are packed in FIFO order: slide the later ones down
+    const Entry removed = _entries[index];
+    size_t tail = _used - (removed.offset + removed.size);
+    memmove(_pool + removed.offset, _pool + removed.offset + removed.size, tail);
+    _used -= removed.size;
+
+    for (int i = index; i < _count - 1; i++) {
+        _entries[i] = _entries[i + 1];
+        _entries[i].offset -= removed.size;
+    }
+    _count--;
+
+    _stats.depth = _count;
+    _stats.bytes = _used;
+    _peeked = -1;
+}
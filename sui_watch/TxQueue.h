@@ -0,0 +1,117 @@
+/**
+ * TX Queue for Trust Oracle messages
+ * Bounded outbox between message encoding (TxArena) and the WebSocket.
+ * Encoded frames are copied into a fixed byte pool and sent from loop()
+ * in priority order: interactive actions, then telemetry, then bulk
+ * evidence. Frames stay queued across reconnects and go out once the next
+ * session is authenticated.
+ *
+ * Lower classes may only fill part of the pool and slots (bulk half,
+ * telemetry three quarters), so step evidence can never crowd out a feed action. push()
+ * reports when a class is out of room; callers use hasRoom() to check
+ * before building a message.
+ *
+ * Messages with a kind replace a queued message of the same kind (a newer
+ * updatePet supersedes the older one). The replacement keeps the older
+ * enqueue time so wait statistics stay honest.
+ */
+
+#ifndef TX_QUEUE_H
+#define TX_QUEUE_H
+
+#include <Arduino.h>
+#include <WebSocketsClient.h>
+#include "TxArena.h"
+
+#define TX_QUEUE_BYTES       6144   // Pool incl. per-frame header reserve
+#define TX_QUEUE_SLOTS       12
+#define TX_QUEUE_DRAIN_BYTES 2048   // Sent per loop() before yielding
+
+enum TxPriority {
+    TX_INTERACTIVE = 0,  // User actions: feed, play, claim, pet data
+    TX_TELEMETRY,        // Pet sync, metrics
+    TX_BULK,             // Signed step evidence
+    TX_PRIORITY_COUNT
+};
+
+// Coalescing keys (TX_KIND_NONE never coalesces)
+enum TxKind {
+    TX_KIND_NONE = 0,
+    TX_KIND_GET_PET,
+    TX_KIND_SUBSCRIBE,
+    TX_KIND_UPDATE_PET,
+    TX_KIND_METRICS,
+    TX_KIND_STEP_BATCH
+};
+
+enum TxPushResult {
+    TX_PUSH_QUEUED,
+    TX_PUSH_COALESCED,   // Replaced an older message of the same kind
+    TX_PUSH_FULL         // Class byte budget or slots exhausted
+};
+
+struct TxFrame {
+    uint8_t* frame;          // Header reserve + payload, for headerToPayload sends
+    size_t length;           // Payload bytes
+    bool binary;             // Encoded as MessagePack
+    uint8_t kind;
+    TxPriority priority;
+};
+
+struct TxQueueStats {
+    uint16_t depth;
+    uint16_t maxDepth;
+    size_t bytes;
+    size_t maxBytes;
+    uint32_t queued;
+    uint32_t coalesced;
+    uint32_t rejected;       // push() refused (backpressure)
+    uint32_t dropped;        // Removed without being sent
+    uint32_t sent[TX_PRIORITY_COUNT];
+    uint32_t waitAvgMs[TX_PRIORITY_COUNT];  // Running average (1/8 weight)
+    uint32_t waitMaxMs[TX_PRIORITY_COUNT];
+};
+
+class TxQueue {
+public:
+    TxQueue();
+
+    // Copy the encoded message out of the arena
+    TxPushResult push(TxPriority priority, uint8_t kind, const TxArena& tx, unsigned long now);
+
+    // Room for a payload of len bytes within the class budget
+    bool hasRoom(TxPriority priority, size_t len) const;
+
+    // Highest-priority, oldest frame; valid until the next push/pop/remove
+    bool peek(TxFrame& out);
+    void pop(bool sent, unsigned long now);  // Removes the peeked frame
+
+    bool contains(uint8_t kind) const;
+    bool remove(uint8_t kind);              // Counted as dropped
+    bool isEmpty() const { return _count == 0; }
+
+    const TxQueueStats& stats() const { return _stats; }
+
+private:
+    struct Entry {
+        uint16_t offset;         // Into _pool
+        uint16_t size;           // Header reserve + payload
+        uint8_t kind;
+        uint8_t priority;
+        bool binary;
+        unsigned long queuedAt;
+    };
+
+    uint8_t _pool[TX_QUEUE_BYTES];
+    Entry _entries[TX_QUEUE_SLOTS];   // FIFO order, packed at the front of _pool
+    uint8_t _count;
+    size_t _used;
+    int _peeked;                      // -1 = nothing peeked
+    TxQueueStats _stats;
+
+    static size_t limitFor(TxPriority priority, size_t total);
+    int find(uint8_t kind) const;
+    void erase(int index);
+};
+
+#endif
@@ -3,8 +3,23 @@
  */
 
 #include "VirtualPet.h"
-#include "pet_sprites.h"
-#include <ArduinoJson.h>
+#include "Clock.h"
+#include <rom/crc.h>
+
+// ============================================
+// RTC Copy (survives deep sleep and soft resets)
+// ============================================
+
+#define PET_RTC_MAGIC 0x50455432  // "PET2"
+
+struct PetRtcState {
+    uint32_t magic;
+    PetState pet;
+    uint32_t crc;                 // Over everything above
+};
+
+// Not cleared by the bootloader: garbage after power-on, hence magic + CRC
+RTC_NOINIT_ATTR static PetRtcState rtcPet;
 
 // ============================================
 // Pet Sprite Definitions
@@ -80,36 +95,47 @@ const char* MASTER_IDLE[] = {
 };
 
 VirtualPet::VirtualPet() {
-    _level = LEVEL_EGG;
-    _happiness = 50;
-    _hunger = 50;
-    _health = 100;
-    _experience = 0;
-    _totalStepsFed = 0;
-    _food = 5;         // Start with 5 food
-    _energy = 5;       // Start with 5 energy
-    _birthTime = millis();
-    _lastFedTime = millis();  // Start timer from birth
-    _lastPlayTime = millis(); // Start timer from birth
-    _lastUpdateTime = millis();
-    _color = "blue";
-    _accessory = "none";
-    _petImage = nullptr;
-    _statusBar = nullptr;
-    _moodIcon = nullptr;
-    _currentImageFrames = PET_IDLE_FRAMES;  // Start with idle animation
-    _frameCount = PET_IDLE_FRAME_COUNT;
-    _currentFrame = 0;
-    _lastFrameTime = millis();
-    _isEating = false;
-    _eatAnimationStartTime = 0;
-    _isPlaying = false;
-    _playAnimationStartTime = 0;
-}
-
-void VirtualPet::init(const String& name) {
-    _name = name;
-    Serial.println("🥚 Pet born: " + _name);
+    memset(&_state, 0, sizeof(_state));
+    _state.level = LEVEL_EGG;
+    _state.color = PET_COLOR_BLUE;
+    _state.accessory = PET_ACCESSORY_NONE;
+    _state.happiness = 50;
+    _state.hunger = 50;
+    _state.health = 100;
+    _state.food = 5;         // Start with 5 food
+    _state.energy = 5;       // Start with 5 energy
+    uint32_t t = appClock->epoch();
+    _state.happinessAt = t;
+    _state.hungerAt = t;
+    _state.healthAt = t;
+    _state.lastFedAt = t;   // Start timer from birth
+    _state.lastPlayAt = t;  // Start timer from birth
+    _state.dirtyFields = PET_SYNC_ALL;  // Nothing acknowledged yet
+    _clockSeen = t;
+    _lastUpdateTime = appClock->millis();
+    _animationHook = nullptr;
+    _inflightFields = 0;
+    _changeCount = 0;
+    _pushVersion = 0;
+}
+
+void VirtualPet::init(const char* name, const PetState* saved) {
+    // RTC copy is never older than the flash journal
+    const char* source = nullptr;
+    if (restoreFromRtc()) {
+        source = "RTC memory";
+    } else if (saved) {
+        restore(*saved);
+        source = "flash";
+    }
+    if (source) {
+        Serial.printf("🐾 Pet restored from %s: %s (hunger %d, happiness %d, health %d)\n",
+                      source, _state.name, getHunger(), getHappiness(), getHealth());
+        return;
+    }
+
+    strncpy(_state.name, name, sizeof(_state.name) - 1);
+    Serial.printf("🥚 Pet born: %s\n", _state.name);
 }
 
 void VirtualPet::update(unsigned long currentTime) {
@@ -117,8 +143,12 @@ void VirtualPet::update(unsigned long currentTime) {
     if (deltaTime < 1000) return;  // Update every second
 
     _lastUpdateTime = currentTime;
-    updateStats(deltaTime);
+
+    // Stats follow from the clock alone; this only folds the decay in
+    // and refreshes the RTC copy
+    settle(now());
     updateMood();
+    saveToRtc();
 
     // Check if needs attention
     if (needsAttention()) {
@@ -132,36 +162,23 @@ void VirtualPet::feed() {
         return;
     }
 
-    if (_hunger >= 100) {
+    // Hunger (significant), happiness (small bonus), evolution credit
+    if (!petFeed(_state, now())) {
         Serial.println("Pet is full!");
         return;
     }
+    markDirty(PET_SYNC_FOOD | PET_SYNC_HUNGER | PET_SYNC_HAPPINESS |
+              PET_SYNC_EXPERIENCE | PET_SYNC_TOTAL_STEPS_FED);
 
-    // Use 1 food to feed
-    _food--;
+    Serial.printf("🍔 Fed pet! Hunger: %d (+%d), Happiness: %d (+%d), Food left: %d, XP: +%d\n",
+                  _state.hunger, PET_RULES.feedHunger, _state.happiness, PET_RULES.feedHappiness,
+                  _state.food, PET_RULES.feedExperience);
 
-    // Increase hunger (significant) and happiness (small bonus)
-    int hungerIncrease = 25;  // Each food gives 25 hunger (4 feeds to fill from 0)
-    int happinessBonus = 5;   // Small happiness bonus from eating
-
-    _hunger = min(100, _hunger + hungerIncrease);
-    _happiness = min(100, _happiness + happinessBonus);
-
-    // Add evolution points
-    _experience += 10;
-    _totalStepsFed += 100; // Track equivalent steps
-    _lastFedTime = millis();
-
-    Serial.printf("🍔 Fed pet! Hunger: %d (+%d), Happiness: %d (+%d), Food left: %d, XP: +10\n",
-                  _hunger, hungerIncrease, _happiness, happinessBonus, _food);
-
-    // Check evolution
-    if (checkEvolution()) {
-        evolve();
-    }
+    evolve();
 
     // Play feeding animation
     animate(ANIM_EAT);
+    changed();
 }
 
 void VirtualPet::play() {
@@ -170,250 +187,307 @@ void VirtualPet::play() {
         return;
     }
 
-    // Use 1 energy to play
-    _energy--;
-
-    // Increase happiness significantly from playing
-    int happinessIncrease = 15;  // Each play gives 15 happiness (7 plays to fill from 0)
-
-    _happiness = min(100, _happiness + happinessIncrease);
+    // Happiness (significant) and evolution points
+    petPlay(_state, now());
+    markDirty(PET_SYNC_ENERGY | PET_SYNC_HAPPINESS | PET_SYNC_EXPERIENCE);
 
-    // Add evolution points
-    _experience += 5;
-    _lastPlayTime = millis();
-
-    Serial.printf("🎮 Played with pet! Happiness: %d (+%d), Energy left: %d, XP: +5\n",
-                  _happiness, happinessIncrease, _energy);
+    Serial.printf("🎮 Played with pet! Happiness: %d (+%d), Energy left: %d, XP: +%d\n",
+                  _state.happiness, PET_RULES.playHappiness, _state.energy, PET_RULES.playExperience);
     animate(ANIM_PLAY);
+    changed();
 }
 
 void VirtualPet::sleep() {
-    _health = min(100, _health + 10);
+    settle(now());
+    _state.health = min(100, _state.health + PET_RULES.sleepHealth);
+    markDirty(PET_SYNC_HEALTH);
     Serial.println("😴 Pet is sleeping...");
     animate(ANIM_SLEEP);
+    changed();
 }
 
 bool VirtualPet::checkEvolution() {
-    if (_level == LEVEL_EGG && _totalStepsFed >= 1000) return true;
-    if (_level == LEVEL_BABY && _totalStepsFed >= 10000) return true;
-    if (_level == LEVEL_TEEN && _totalStepsFed >= 50000) return true;
-    if (_level == LEVEL_ADULT && _totalStepsFed >= 100000) return true;
-    return false;
+    return petLevelFor(_state.totalStepsFed, _state.level) != _state.level;
 }
 
 void VirtualPet::evolve() {
-    PetLevel oldLevel = _level;
-
-    if (_totalStepsFed >= 100000 && _level < LEVEL_MASTER) {
-        _level = LEVEL_MASTER;
-    } else if (_totalStepsFed >= 50000 && _level < LEVEL_ADULT) {
-        _level = LEVEL_ADULT;
-    } else if (_totalStepsFed >= 10000 && _level < LEVEL_TEEN) {
-        _level = LEVEL_TEEN;
-    } else if (_totalStepsFed >= 1000 && _level < LEVEL_BABY) {
-        _level = LEVEL_BABY;
-    }
+    PetLevel oldLevel = getLevel();
 
-    if (oldLevel != _level) {
-        Serial.printf("🎉 Pet evolved from level %d to %d!\n", oldLevel, _level);
+    // Health restored, happiness bonus
+    if (petEvolve(_state, now())) {
+        Serial.printf("🎉 Pet evolved from level %d to %d!\n", oldLevel, _state.level);
         animate(ANIM_EVOLVE);
-
-        // Restore health on evolution
-        _health = 100;
-        _happiness = min(100, _happiness + 30);
+        markDirty(PET_SYNC_LEVEL | PET_SYNC_HEALTH | PET_SYNC_HAPPINESS);
     }
 }
 
 PetMood VirtualPet::getMood() {
-    if (_happiness > 80) return MOOD_HAPPY;
-    if (_happiness < 30) return MOOD_SAD;
-    if (_hunger < 30) return MOOD_HUNGRY;
-
-    unsigned long timeSincePlay = millis() - _lastPlayTime;
-    if (timeSincePlay > 7200000) return MOOD_SLEEPY;  // 2 hours
-    if (timeSincePlay < 600000) return MOOD_PLAYFUL;  // 10 minutes
+    uint32_t t = now();
+    int happiness = happinessAt(t);
+    if (happiness > PET_RULES.happyAbove) return MOOD_HAPPY;
+    if (happiness < PET_RULES.sadBelow) return MOOD_SAD;
+    if (hungerAt(t) < PET_RULES.hungryBelow) return MOOD_HUNGRY;
+
+    // Clock behind the last play (unset after a restore): no idea yet
+    if (t < _state.lastPlayAt) return MOOD_NORMAL;
+    uint32_t timeSincePlay = t - _state.lastPlayAt;
+    if (timeSincePlay > PET_RULES.sleepyAfterSec) return MOOD_SLEEPY;
+    if (timeSincePlay < PET_RULES.playfulWithinSec) return MOOD_PLAYFUL;
 
     return MOOD_NORMAL;
 }
 
-bool VirtualPet::needsAttention() {
-    return _happiness < 30 || _hunger < 30 || _health < 50;
+void VirtualPet::view(PetView& out) {
+    uint32_t t = now();
+    out.level = _state.level;
+    out.happiness = happinessAt(t);
+    out.hunger = hungerAt(t);
+    out.food = _state.food;
+    out.energy = _state.energy;
+    out.canFeed = canFeed();
+    out.canPlay = canPlay();
 }
 
-String VirtualPet::getStatusText() {
-    String status = _name + " (Lv." + String(_level) + ")\n";
-    status += "😊 " + String(_happiness) + "% ";
-    status += "🍔 " + String(_hunger) + "% ";
-    status += "❤️ " + String(_health) + "%\n";
+bool VirtualPet::needsAttention() {
+    uint32_t t = now();
+    return happinessAt(t) < PET_RULES.attentionHappiness ||
+           hungerAt(t) < PET_RULES.attentionHunger ||
+           healthAt(t) < PET_RULES.attentionHealth;
+}
 
-    // Check if performing an animation action
-    if (_isEating) {
-        status += "Status: Eating... 🍽️";
-        return status;
+size_t VirtualPet::formatStatus(char* out, size_t size) {
+    const char* activity;
+    switch (getMood()) {
+        case MOOD_HAPPY: activity = "Mood: Happy 😄"; break;
+        case MOOD_SAD: activity = "Mood: Sad 😢"; break;
+        case MOOD_HUNGRY: activity = "Mood: Hungry 🍔"; break;
+        case MOOD_SLEEPY: activity = "Mood: Sleepy 😴"; break;
+        case MOOD_PLAYFUL: activity = "Mood: Playful 🎮"; break;
+        default: activity = "Mood: Normal 😊"; break;
     }
 
-    if (_isPlaying) {
-        status += "Status: Playing... 🎮";
-        return status;
-    }
+    uint32_t t = now();
+    int written = snprintf(out, size, "%s (Lv.%u)\n😊 %d%% 🍔 %d%% ❤️ %d%%\n%s",
+                           _state.name, _state.level, happinessAt(t), hungerAt(t),
+                           healthAt(t), activity);
+    return written < 0 ? 0 : (size_t)written;
+}
 
-    // Normal mood display
-    PetMood mood = getMood();
-    switch (mood) {
-        case MOOD_HAPPY: status += "Mood: Happy 😄"; break;
-        case MOOD_SAD: status += "Mood: Sad 😢"; break;
-        case MOOD_HUNGRY: status += "Mood: Hungry 🍔"; break;
-        case MOOD_SLEEPY: status += "Mood: Sleepy 😴"; break;
-        case MOOD_PLAYFUL: status += "Mood: Playful 🎮"; break;
-        default: status += "Mood: Normal 😊"; break;
+void VirtualPet::animate(PetAnimation anim) {
+    // Clips, timing and what may interrupt what are the animator's business
+    if (_animationHook) {
+        _animationHook(anim);
     }
-
-    return status;
 }
 
-void VirtualPet::draw(lv_obj_t* parent) {
-    // Create pet image if not exists
-    if (!_petImage) {
-        _petImage = lv_img_create(parent);  // Use lv_img instead of lv_label
-        lv_obj_align(_petImage, LV_ALIGN_CENTER, 0, -20);
+size_t VirtualPet::printJson(Print& out) {
+    uint32_t t = now();
+    size_t n = out.print("{\"name\":\"");
+    for (const char* c = _state.name; *c; c++) {
+        if (*c == '"' || *c == '\\') n += out.print('\\');
+        n += out.print(*c);
     }
+    n += out.printf("\",\"level\":%u,\"happiness\":%d,\"hunger\":%d,\"health\":%d,"
+                    "\"experience\":%lu,\"totalStepsFed\":%lu,\"color\":\"%s\",\"accessory\":\"%s\"}",
+                    _state.level, happinessAt(t), hungerAt(t), healthAt(t),
+                    (unsigned long)_state.experience, (unsigned long)_state.totalStepsFed,
+                    colorName(getColor()), accessoryName(getAccessory()));
+    return n;
+}
+
+// ============================================
+// Appearance Codes
+// ============================================
+
+// Wire names match the Move contract and the server's pets table
+static const char* const COLOR_NAMES[PET_COLOR_COUNT] = {
+    "blue", "green", "pink", "gold"
+};
 
-    // Update animation frame
-    updateAnimation();
+static const char* const ACCESSORY_NAMES[PET_ACCESSORY_COUNT] = {
+    "none", "hat", "bow", "crown"
+};
+
+const char* VirtualPet::colorName(PetColor color) {
+    return color < PET_COLOR_COUNT ? COLOR_NAMES[color] : COLOR_NAMES[PET_COLOR_BLUE];
+}
 
-    // Update pet image
-    const lv_img_dsc_t* currentImage = getPetImage();
-    if (currentImage) {
-        lv_img_set_src(_petImage, currentImage);
+const char* VirtualPet::accessoryName(PetAccessory accessory) {
+    return accessory < PET_ACCESSORY_COUNT ? ACCESSORY_NAMES[accessory]
+                                           : ACCESSORY_NAMES[PET_ACCESSORY_NONE];
+}
+
+PetColor VirtualPet::colorFromName(const char* name) {
+    for (uint8_t i = 0; name && i < PET_COLOR_COUNT; i++) {
+        if (strcmp(name, COLOR_NAMES[i]) == 0) return (PetColor)i;
     }
+    return PET_COLOR_BLUE;
+}
 
-    // Create status bar if not exists
-    if (!_statusBar) {
-        _statusBar = lv_label_create(parent);
-        lv_obj_set_style_text_color(_statusBar, lv_color_hex(0xCCCCCC), 0);  // Light gray
-        lv_obj_align(_statusBar, LV_ALIGN_BOTTOM_MID, 0, -10);
+PetAccessory VirtualPet::accessoryFromName(const char* name) {
+    for (uint8_t i = 0; name && i < PET_ACCESSORY_COUNT; i++) {
+        if (strcmp(name, ACCESSORY_NAMES[i]) == 0) return (PetAccessory)i;
     }
+    return PET_ACCESSORY_NONE;
+}
 
-    // Update status with resources
-    char status[80];
-    snprintf(status, sizeof(status), "H:%d F:%d HP:%d | Food:%d Nrg:%d",
-             _happiness, _hunger, _health, _food, _energy);
-    lv_label_set_text(_statusBar, status);
-
-    // Create mood icon if not exists
-    if (!_moodIcon) {
-        _moodIcon = lv_label_create(parent);
-        lv_obj_set_style_text_color(_moodIcon, lv_color_hex(0xFFFF00), 0);  // Yellow
-        lv_obj_align(_moodIcon, LV_ALIGN_TOP_RIGHT, -10, 10);
+// ============================================
+// Delta Sync
+// ============================================
+
+// Wire names match the server's pets table columns
+static const char* const SYNC_FIELD_NAMES[PET_SYNC_FIELD_COUNT] = {
+    "happiness", "hunger", "health", "experience",
+    "total_steps_fed", "level", "food", "energy"
+};
+
+const char* VirtualPet::syncFieldName(uint16_t field) {
+    for (int i = 0; i < PET_SYNC_FIELD_COUNT; i++) {
+        if (field == (1 << i)) return SYNC_FIELD_NAMES[i];
     }
+    return nullptr;
+}
 
-    // Update mood icon
-    lv_label_set_text(_moodIcon, getMoodIcon());
+uint16_t VirtualPet::beginSync() {
+    settle(now());
+    _inflightFields |= _state.dirtyFields;
+    _state.dirtyFields = 0;
+    return _inflightFields;
 }
 
-void VirtualPet::animate(PetAnimation anim) {
-    // Simple animation by changing frames
-    // In real implementation, use lv_anim for smooth animations
-
-    switch (anim) {
-        case ANIM_EAT:
-            Serial.println("🍽️ [EAT] Starting eating animation (20s)");
-            // Switch to eating animation
-            _isEating = true;
-            _eatAnimationStartTime = millis();
-            _currentImageFrames = PET_EAT_FRAMES;
-            _frameCount = PET_EAT_FRAME_COUNT;
-            _currentFrame = 0;
-            break;
-        case ANIM_PLAY:
-            Serial.println("🎮 [PLAY] Starting play animation (20s)");
-            // Switch to play animation
-            _isPlaying = true;
-            _playAnimationStartTime = millis();
-            _currentImageFrames = PET_PLAY_FRAMES;
-            _frameCount = PET_PLAY_FRAME_COUNT;
-            _currentFrame = 0;
-            break;
-        case ANIM_SLEEP:
-            Serial.println("[SLEEP] *zzz...*");
-            break;
-        case ANIM_EVOLVE:
-            Serial.println("[EVOLVE] *sparkle sparkle*");
-            break;
-        case ANIM_HAPPY:
-            Serial.println("[HAPPY] *joy joy*");
-            break;
-        case ANIM_SAD:
-            Serial.println("[SAD] *sniffle*");
-            break;
-        default:
+void VirtualPet::completeSync(uint32_t version) {
+    _inflightFields = 0;
+    _state.syncVersion = version;
+    changed();
+}
+
+void VirtualPet::failSync() {
+    _state.dirtyFields |= _inflightFields;
+    _inflightFields = 0;
+}
+
+bool VirtualPet::applyServerField(const char* name, long value) {
+    int index = -1;
+    for (int i = 0; i < PET_SYNC_FIELD_COUNT; i++) {
+        if (strcmp(name, SYNC_FIELD_NAMES[i]) == 0) {
+            index = i;
             break;
+        }
+    }
+    if (index < 0) return false;
+
+    // A local edit the server has not acknowledged is newer than anything
+    // it can send: keep it (and its dirty bit) for the next sync
+    if ((_state.dirtyFields | _inflightFields) & (1 << index)) return false;
+
+    // Server values are current: decay restarts from them
+    uint32_t t = now();
+    settle(t);
+
+    switch (1 << index) {
+        case PET_SYNC_HAPPINESS:       _state.happiness = constrain(value, 0, 100); _state.happinessAt = t; break;
+        case PET_SYNC_HUNGER:          _state.hunger = constrain(value, 0, 100); _state.hungerAt = t; break;
+        case PET_SYNC_HEALTH:          _state.health = constrain(value, 0, 100); _state.healthAt = t; break;
+        case PET_SYNC_EXPERIENCE:      _state.experience = max(value, 0L); break;
+        case PET_SYNC_TOTAL_STEPS_FED: _state.totalStepsFed = max(value, 0L); break;
+        case PET_SYNC_LEVEL:           _state.level = constrain(value, (long)LEVEL_EGG, (long)LEVEL_MASTER); break;
+        case PET_SYNC_FOOD:            _state.food = constrain(value, 0L, (long)PET_RULES.resourceMax); break;
+        case PET_SYNC_ENERGY:          _state.energy = constrain(value, 0L, (long)PET_RULES.resourceMax); break;
     }
+
+    changed();
+    return true;
 }
 
-String VirtualPet::toJSON() {
-    JsonDocument doc;
-    doc["name"] = _name;
-    doc["level"] = _level;
-    doc["happiness"] = _happiness;
-    doc["hunger"] = _hunger;
-    doc["health"] = _health;
-    doc["experience"] = _experience;
-    doc["totalStepsFed"] = _totalStepsFed;
-    doc["color"] = _color;
-    doc["accessory"] = _accessory;
+bool VirtualPet::acceptServerPush(uint64_t objectVersion) {
+    if (objectVersion == 0) return true;
+    if (objectVersion <= _pushVersion) return false;
+    _pushVersion = objectVersion;
+    return true;
+}
+
+// ============================================
+// Decay Model (closed form)
+// ============================================
 
-    String json;
-    serializeJson(doc, json);
-    return json;
+uint32_t VirtualPet::now() {
+    uint32_t t = appClock->epoch();
+
+    // SNTP stepped the clock from boot-relative to real time: move the
+    // anchors taken since boot along so the jump does not count as time
+    // passing. Anchors restored from flash are already wall-clock time;
+    // the pet stands still until the clock is set, then catches up.
+    if (_clockSeen < CLOCK_EPOCH_MIN && t >= CLOCK_EPOCH_MIN) {
+        uint32_t shift = t - _clockSeen;
+        uint32_t* anchors[] = { &_state.happinessAt, &_state.hungerAt, &_state.healthAt,
+                                &_state.lastFedAt, &_state.lastPlayAt };
+        for (uint32_t* anchor : anchors) {
+            if (*anchor < CLOCK_EPOCH_MIN) *anchor += shift;
+        }
+        Serial.println("[PET] Clock set, decay anchors moved to wall-clock time");
+    }
+
+    _clockSeen = t;
+    return t;
 }
 
-void VirtualPet::fromJSON(const String& json) {
-    JsonDocument doc;
-    deserializeJson(doc, json);
+int VirtualPet::hungerAt(uint32_t t) {
+    return petHungerAt(_state.hunger, _state.hungerAt, t);
+}
 
-    _name = doc["name"].as<String>();
-    _level = (PetLevel)doc["level"].as<int>();
-    _happiness = doc["happiness"];
-    _hunger = doc["hunger"];
-    _health = doc["health"];
-    _experience = doc["experience"];
-    _totalStepsFed = doc["totalStepsFed"];
-    _color = doc["color"].as<String>();
-    _accessory = doc["accessory"].as<String>();
+int VirtualPet::happinessAt(uint32_t t) {
+    return petHappinessAt(_state.happiness, _state.happinessAt, t);
 }
 
-// Private methods
+int VirtualPet::healthAt(uint32_t t) {
+    return petHealthAt(_state.health, _state.healthAt, _state.hunger, _state.hungerAt,
+                       _state.happiness, _state.happinessAt, t);
+}
 
-void VirtualPet::updateStats(unsigned long deltaTime) {
-    // Hunger decreases over time (faster than before)
-    // Decreases by 1 point every 5 minutes
-    unsigned long timeSinceFed = millis() - _lastFedTime;
-    if (timeSinceFed > 300000 && _hunger > 0) {  // 5 minutes
-        int hungerDecrease = (timeSinceFed / 300000);  // 1 point per 5 min
-        _hunger = max(0, _hunger - hungerDecrease);
-        _lastFedTime = millis();  // Reset timer to prevent instant decrease
-    }
+void VirtualPet::settle(uint32_t t) {
+    // Decay alone marks nothing dirty: the server derives it from the same
+    // clock (updateTimeBasedStats), so only actions and events are synced
+    petSettle(_state, t);
+}
 
-    // Happiness decreases if not played with
-    // Decreases by 1 point every 10 minutes
-    unsigned long timeSincePlay = millis() - _lastPlayTime;
-    if (timeSincePlay > 600000 && _happiness > 0) {  // 10 minutes
-        int happinessDecrease = (timeSincePlay / 600000);  // 1 point per 10 min
-        _happiness = max(0, _happiness - happinessDecrease);
-        _lastPlayTime = millis();  // Reset timer
-    }
+// ============================================
+// RTC Copy
+// ============================================
+
+void VirtualPet::snapshot(PetState& out) {
+    out = _state;
+    out.dirtyFields |= _inflightFields;  // Unacked: resend after restore
+}
+
+void VirtualPet::restore(const PetState& in) {
+    _state = in;
+    _state.name[sizeof(_state.name) - 1] = '\0';
+    if (_state.color >= PET_COLOR_COUNT) _state.color = PET_COLOR_BLUE;
+    if (_state.accessory >= PET_ACCESSORY_COUNT) _state.accessory = PET_ACCESSORY_NONE;
+    if (_state.level >= PET_LEVEL_COUNT) _state.level = LEVEL_MASTER;
+    _inflightFields = 0;
+}
+
+void VirtualPet::saveToRtc() {
+    PetRtcState state;
+    state.magic = PET_RTC_MAGIC;
+    snapshot(state.pet);
+    state.crc = crc32_le(0, (const uint8_t*)&state, offsetof(PetRtcState, crc));
+    rtcPet = state;
+}
 
-    // Health affected by hunger and happiness
-    if (_hunger < 20 || _happiness < 20) {
-        // Pet is unhappy or hungry - health decreases
-        if (_health > 0) _health = max(0, _health - 1);
-    } else if (_hunger > 60 && _happiness > 60 && _health < 100) {
-        // Pet is well fed and happy - health increases slowly
-        _health = min(100, _health + 1);
+bool VirtualPet::restoreFromRtc() {
+    PetRtcState state = rtcPet;
+    if (state.magic != PET_RTC_MAGIC ||
+        state.crc != crc32_le(0, (const uint8_t*)&state, offsetof(PetRtcState, crc))) {
+        return false;
     }
+    restore(state.pet);
+    return true;
 }
 
+// Private methods
+
 void VirtualPet::updateMood() {
     // Mood affects animation
     PetMood mood = getMood();
@@ -442,93 +516,25 @@ const char* VirtualPet::getMoodIcon() {
 // ============================================
 
 void VirtualPet::addFood(int amount) {
-    _food = min(999, _food + amount);  // Max 999 food
-    Serial.printf("🍖 +%d food! Total: %d\n", amount, _food);
+    petAddResource(_state.food, amount);
+    markDirty(PET_SYNC_FOOD);
+    Serial.printf("🍖 +%d food! Total: %d\n", amount, _state.food);
+    changed();
 }
 
 void VirtualPet::addEnergy(int amount) {
-    _energy = min(999, _energy + amount);  // Max 999 energy
-    Serial.printf("⚡ +%d energy! Total: %d\n", amount, _energy);
+    petAddResource(_state.energy, amount);
+    markDirty(PET_SYNC_ENERGY);
+    Serial.printf("⚡ +%d energy! Total: %d\n", amount, _state.energy);
+    changed();
 }
 
 bool VirtualPet::canFeed() {
-    // Need at least 1 food
-    if (_food < 1) return false;
-
-    // Check cooldown based on level (in milliseconds)
-    unsigned long cooldown;
-    switch (_level) {
-        case LEVEL_EGG:    cooldown = 60000;   break;  // 1 minute
-        case LEVEL_BABY:   cooldown = 120000;  break;  // 2 minutes
-        case LEVEL_TEEN:   cooldown = 180000;  break;  // 3 minutes
-        case LEVEL_ADULT:  cooldown = 300000;  break;  // 5 minutes
-        case LEVEL_MASTER: cooldown = 600000;  break;  // 10 minutes
-        default:           cooldown = 120000;  break;
-    }
-
-    unsigned long timeSinceLastFeed = millis() - _lastFedTime;
-    return timeSinceLastFeed >= cooldown;
+    // At least 1 food, cooldown (grows with the level) over
+    return petCanFeed(_state, now());
 }
 
 bool VirtualPet::canPlay() {
-    // Need at least 1 energy
-    if (_energy < 1) return false;
-
-    // Check cooldown based on level (in milliseconds)
-    unsigned long cooldown;
-    switch (_level) {
-        case LEVEL_EGG:    cooldown = 30000;   break;  // 30 seconds
-        case LEVEL_BABY:   cooldown = 60000;   break;  // 1 minute
-        case LEVEL_TEEN:   cooldown = 90000;   break;  // 1.5 minutes
-        case LEVEL_ADULT:  cooldown = 120000;  break;  // 2 minutes
-        case LEVEL_MASTER: cooldown = 180000;  break;  // 3 minutes
-        default:           cooldown = 60000;   break;
-    }
-
-    unsigned long timeSinceLastPlay = millis() - _lastPlayTime;
-    return timeSinceLastPlay >= cooldown;
+    // At least 1 energy, cooldown (grows with the level) over
+    return petCanPlay(_state, now());
 }
-
-// ============================================
-// Image Animation Methods
-// ============================================
-
-void VirtualPet::updateAnimation() {
-    unsigned long currentTime = millis();
-
-    // Check if eating animation should end
-    if (_isEating && (currentTime - _eatAnimationStartTime) >= EAT_ANIMATION_DURATION) {
-        // Return to idle animation
-        _isEating = false;
-        _currentImageFrames = PET_IDLE_FRAMES;
-        _frameCount = PET_IDLE_FRAME_COUNT;
-        _currentFrame = 0;
-        Serial.println("🍽️ Finished eating animation");
-    }
-
-    // Check if playing animation should end
-    if (_isPlaying && (currentTime - _playAnimationStartTime) >= PLAY_ANIMATION_DURATION) {
-        // Return to idle animation
-        _isPlaying = false;
-        _currentImageFrames = PET_IDLE_FRAMES;
-        _frameCount = PET_IDLE_FRAME_COUNT;
-        _currentFrame = 0;
-        Serial.println("🎮 Finished playing animation");
-    }
-
-    // Change frame every 200ms (5 FPS animation)
-    if (currentTime - _lastFrameTime > 200) {
-        _lastFrameTime = currentTime;
-        _currentFrame = (_currentFrame + 1) % _frameCount;
-    }
-}
-
-const lv_img_dsc_t* VirtualPet::getPetImage() {
-    // Return current animation frame
-    if (_currentImageFrames && _frameCount > 0) {
-        return _currentImageFrames[_currentFrame];
-    }
-
-    // Fallback to first frame
-    return &pet_idle_frame1;
-}
\ No newline at end of file
@@ -1,13 +1,31 @@
 /**
  * Virtual Pet for ESP32 Watch
  * Interactive pet that lives on your wrist!
+ *
+ * Hunger, happiness and health are not simulated tick by tick. Each is
+ * stored as a value at an anchor time (wall-clock seconds from the RTC,
+ * set by SNTP once WiFi is up) and read through a closed-form function
+ * of the time elapsed since then, so the result does not depend on how
+ * often update() runs. The state is mirrored to RTC memory, which
+ * survives deep sleep and soft resets: after hours asleep the pet wakes
+ * up in exactly the state it would have reached awake.
+ *
+ * Everything that persists sits in one PetState: a ~60-byte POD with the
+ * name inline and colour/accessory as enum codes, so saving is a struct
+ * copy and nothing touches the heap. Text (status line, JSON) is written
+ * into caller buffers or streamed to a Print.
+ *
+ * The pet knows nothing about the screen: actions and mood changes are
+ * reported through an animation hook, which the UI connects to the
+ * PetAnimator (PetAnimator.h).
  */
 
 #ifndef VIRTUAL_PET_H
 #define VIRTUAL_PET_H
 
 #include <Arduino.h>
-#include <lvgl.h>
+#include <type_traits>
+#include "PetRules.h"
 
 // Pet evolution levels
 enum PetLevel {
@@ -18,6 +36,8 @@ enum PetLevel {
     LEVEL_MASTER = 4
 };
 
+static_assert(PET_LEVEL_COUNT == LEVEL_MASTER + 1, "One rule per level");
+
 // Pet moods
 enum PetMood {
     MOOD_HAPPY,
@@ -37,7 +57,85 @@ enum PetAnimation {
     ANIM_SLEEP,
     ANIM_EVOLVE,
     ANIM_HAPPY,
-    ANIM_SAD
+    ANIM_SAD,
+    ANIM_COUNT
+};
+
+// Called whenever the pet wants an animation shown
+typedef void (*PetAnimationHook)(PetAnimation anim);
+
+// Synced stat fields (dirty bits for delta sync)
+enum PetSyncField {
+    PET_SYNC_HAPPINESS       = 1 << 0,
+    PET_SYNC_HUNGER          = 1 << 1,
+    PET_SYNC_HEALTH          = 1 << 2,
+    PET_SYNC_EXPERIENCE      = 1 << 3,
+    PET_SYNC_TOTAL_STEPS_FED = 1 << 4,
+    PET_SYNC_LEVEL           = 1 << 5,
+    PET_SYNC_FOOD            = 1 << 6,
+    PET_SYNC_ENERGY          = 1 << 7
+};
+
+#define PET_SYNC_FIELD_COUNT 8
+#define PET_SYNC_ALL 0xFF
+
+// Decay periods, cooldowns and thresholds are in PetRules.h
+
+// Appearance, stored as one-byte codes (names on the wire)
+enum PetColor : uint8_t {
+    PET_COLOR_BLUE,
+    PET_COLOR_GREEN,
+    PET_COLOR_PINK,
+    PET_COLOR_GOLD,
+    PET_COLOR_COUNT
+};
+
+enum PetAccessory : uint8_t {
+    PET_ACCESSORY_NONE,
+    PET_ACCESSORY_HAT,
+    PET_ACCESSORY_BOW,
+    PET_ACCESSORY_CROWN,
+    PET_ACCESSORY_COUNT
+};
+
+#define PET_NAME_LEN 16               // Including the terminator
+
+// Core pet state, fixed layout and trivially copyable: this is the pet as
+// VirtualPet holds it, and RTC memory and the flash journal copy it whole
+struct PetState {
+    char name[PET_NAME_LEN];
+    uint8_t level;                    // PetLevel
+    uint8_t color;                    // PetColor
+    uint8_t accessory;                // PetAccessory
+    uint8_t happiness;                // Stats (0-100) as of their anchor times
+    uint8_t hunger;
+    uint8_t health;
+    uint16_t food;                    // Resources earned from walking (0-999)
+    uint16_t energy;
+    uint16_t dirtyFields;             // PetSyncField bits not yet acknowledged
+    uint32_t experience;
+    uint32_t totalStepsFed;
+    uint32_t happinessAt;             // Anchors and timestamps: wall-clock seconds
+    uint32_t hungerAt;
+    uint32_t healthAt;
+    uint32_t lastFedAt;
+    uint32_t lastPlayAt;
+    uint32_t syncVersion;
+};
+
+static_assert(sizeof(PetState) <= 64, "PetState should stay within one cache line");
+static_assert(std::is_trivially_copyable<PetState>::value, "PetState is copied as bytes");
+
+// What the screens show, read in one pass under PetLock so LVGL can draw
+// without holding it
+struct PetView {
+    uint8_t level;                    // PetLevel
+    uint8_t happiness;                // As of now, decay included
+    uint8_t hunger;
+    uint16_t food;
+    uint16_t energy;
+    bool canFeed;
+    bool canPlay;
 };
 
 class VirtualPet {
@@ -45,7 +143,7 @@ public:
     VirtualPet();
 
     // Core functions
-    void init(const String& name);
+    void init(const char* name, const PetState* saved = nullptr);  // RTC copy > saved > new
     void update(unsigned long currentTime);
     void feed();  // Use food to feed pet (+10 evolution points)
     void play();  // Use energy to play with pet (+5 evolution points)
@@ -64,87 +162,84 @@ public:
     // Status
     PetMood getMood();
     bool needsAttention();
-    String getStatusText();
+    size_t formatStatus(char* out, size_t size);  // Multi-line summary, snprintf semantics
+    const char* getMoodIcon();
+    void view(PetView& out);
 
     // Getters
-    String getName() { return _name; }
-    PetLevel getLevel() { return _level; }
-    int getHappiness() { return _happiness; }
-    int getHunger() { return _hunger; }
-    int getHealth() { return _health; }
-    int getExperience() { return _experience; }
-    unsigned long getTotalStepsFed() { return _totalStepsFed; }
-    int getFood() { return _food; }
-    int getEnergy() { return _energy; }
-    bool isEating() { return _isEating; }
-    bool isPlaying() { return _isPlaying; }
-    bool isBusy() { return _isEating || _isPlaying; }
-
-    // Display
-    void draw(lv_obj_t* parent);
+    const char* getName() { return _state.name; }
+    PetLevel getLevel() { return (PetLevel)_state.level; }
+    int getHappiness() { return happinessAt(now()); }
+    int getHunger() { return hungerAt(now()); }
+    int getHealth() { return healthAt(now()); }
+    int getExperience() { return _state.experience; }
+    unsigned long getTotalStepsFed() { return _state.totalStepsFed; }
+    int getFood() { return _state.food; }
+    int getEnergy() { return _state.energy; }
+    PetColor getColor() { return (PetColor)_state.color; }
+    PetAccessory getAccessory() { return (PetAccessory)_state.accessory; }
+
+    // Display (the hook runs on whichever task calls the action)
+    void setAnimationHook(PetAnimationHook hook) { _animationHook = hook; }
     void animate(PetAnimation anim);
 
-    // Blockchain sync
-    String toJSON();
-    void fromJSON(const String& json);
+    // Deep sleep / soft reset: state kept in RTC memory
+    void saveToRtc();
+    bool restoreFromRtc();
+
+    // Persistent state; the change count moves on every edit except decay
+    void snapshot(PetState& out);
+    void restore(const PetState& in);
+    uint32_t getChangeCount() { return _changeCount; }
+
+    // Streams the pet as one JSON object (no intermediate document)
+    size_t printJson(Print& out);
 
-    // Animation control (public for UI access)
-    void updateAnimation();
-    const lv_img_dsc_t* getPetImage();
+    // Appearance codes <-> wire names ("blue", "none", ...)
+    static const char* colorName(PetColor color);
+    static const char* accessoryName(PetAccessory accessory);
+    static PetColor colorFromName(const char* name);          // Unknown -> blue
+    static PetAccessory accessoryFromName(const char* name);  // Unknown -> none
+
+    // Delta sync: fields changed since the last acknowledged sync
+    bool isDirty() { return _state.dirtyFields != 0; }
+    uint16_t getDirtyFields() { return _state.dirtyFields; }
+    uint32_t getSyncVersion() { return _state.syncVersion; }
+    void setSyncVersion(uint32_t version) { _state.syncVersion = version; }
+    uint16_t beginSync();                     // Moves dirty fields in flight
+    void completeSync(uint32_t version);      // Server acknowledged
+    void failSync();                          // Re-mark in-flight fields dirty
+
+    // Server values (sync conflicts, pushes) for fields with no local change
+    // the server has yet to acknowledge; false if unknown or kept local
+    bool applyServerField(const char* name, long value);
+    // Pushed snapshots carry the pet object's version: false for one no newer
+    // than the last applied (0: unversioned, always taken)
+    bool acceptServerPush(uint64_t objectVersion);
+    static const char* syncFieldName(uint16_t field);
 
 private:
-    // Basic info
-    String _name;
-    PetLevel _level;
-
-    // Stats (0-100)
-    int _happiness;
-    int _hunger;
-    int _health;
-
-    // Progress
-    int _experience;
-    unsigned long _totalStepsFed;
-
-    // Resources (earned from walking)
-    int _food;        // Used for feeding
-    int _energy;      // Used for playing
-
-    // Timestamps
-    unsigned long _birthTime;
-    unsigned long _lastFedTime;
-    unsigned long _lastPlayTime;
-    unsigned long _lastUpdateTime;
-
-    // Appearance
-    String _color;
-    String _accessory;
-
-    // LVGL objects
-    lv_obj_t* _petImage;
-    lv_obj_t* _statusBar;
-    lv_obj_t* _moodIcon;
-    lv_anim_t _currentAnim;
-
-    // Animation frames (for image animation)
-    const lv_img_dsc_t** _currentImageFrames;
-    int _frameCount;
-    int _currentFrame;
-    unsigned long _lastFrameTime;
-
-    // Animation states
-    bool _isEating;
-    unsigned long _eatAnimationStartTime;
-    const unsigned long EAT_ANIMATION_DURATION = 20000;  // 20 seconds
-
-    bool _isPlaying;
-    unsigned long _playAnimationStartTime;
-    const unsigned long PLAY_ANIMATION_DURATION = 20000;  // 20 seconds
+    PetState _state;
+
+    uint32_t _clockSeen;              // Last now(), to spot the SNTP step
+    unsigned long _lastUpdateTime;    // millis()
+
+    PetAnimationHook _animationHook;
+
+    // Delta sync state (dirty fields live in _state)
+    uint16_t _inflightFields;
+    uint32_t _changeCount;
+    uint64_t _pushVersion;            // Object version of the last applied push
 
     // Internal methods
-    void updateStats(unsigned long deltaTime);
+    void markDirty(uint16_t fields) { _state.dirtyFields |= fields; }
+    void changed() { _changeCount++; saveToRtc(); }
+    uint32_t now();
+    int hungerAt(uint32_t t);
+    int happinessAt(uint32_t t);
+    int healthAt(uint32_t t);
+    void settle(uint32_t t);          // Fold elapsed decay into the stored values
     void updateMood();
-    const char* getMoodIcon();
 };
 
 // ============================================
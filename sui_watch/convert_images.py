@@ -1,111 +1,512 @@
 #!/usr/bin/env python3
 """
-Convert PNG images to LVGL C format
+Convert images for the watch
+
+  convert_images.py c PNG NAME [OUT_DIR]      PNG -> LVGL C array (compiled in)
+  convert_images.py pack [MANIFEST] [OUT]     Asset pack for the assets partition
+  convert_images.py check [MANIFEST]          Duplicate/unused image check, flash report
+
+The pack is built from assets/pack.txt (one "name source [palette:colors]"
+per line) and written to assets.bin; the layout is described in
+AssetPack.h. Sources can be PNGs or LVGL C image files (SquareLine
+exports and the LVGL online converter; the 16-bit, no-swap variant is
+taken). Images naming the same palette are quantised together to one
+16- or 256-colour palette with alpha and stored indexed; the size and
+PSNR against the source are printed per image. Flash the pack with the
+command printed at the end - the firmware does not need rebuilding.
+
+Both pack and check refuse (exit 1) when an image would take flash for
+nothing: an lv_img_dsc_t compiled into the sketch that no other source
+uses, one whose pixels match another linked image or a pack asset, or a
+pack asset whose name appears nowhere in the firmware. Images are
+compared by a hash of their decoded pixels, so a re-export with other
+formatting still counts as a copy. Identical pack images are stored once.
 """
-from PIL import Image
-import sys
+import glob
+import hashlib
+import math
 import os
+import re
+import struct
+import sys
+import zlib
 
-def png_to_lvgl_c(png_path, output_name):
-    """Convert PNG to LVGL C array format (RGB565 with alpha)"""
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+
+# Must match AssetPack.h
+PACK_MAGIC = 0x4B504157   # "WAPK"
+PACK_VERSION = 1
+PACK_ALIGN = 16
+NAME_LEN = 16
+FORMAT_TRUE_COLOR = 4
+FORMAT_TRUE_COLOR_ALPHA = 5
+FORMAT_INDEXED_4BIT = 9
+FORMAT_INDEXED_8BIT = 10
+HEADER = struct.Struct('<IHHIII12x')
+ENTRY = struct.Struct(f'<{NAME_LEN}sIIHHB3x')
+
+CF_FORMATS = {
+    'LV_IMG_CF_TRUE_COLOR': FORMAT_TRUE_COLOR,
+    'LV_IMG_CF_TRUE_COLOR_ALPHA': FORMAT_TRUE_COLOR_ALPHA,
+}
+BYTES_PER_PIXEL = {FORMAT_TRUE_COLOR: 2, FORMAT_TRUE_COLOR_ALPHA: 3}
+INDEXED_FORMATS = {16: FORMAT_INDEXED_4BIT, 256: FORMAT_INDEXED_8BIT}
+FORMAT_NAMES = {FORMAT_TRUE_COLOR: 'rgb565', FORMAT_TRUE_COLOR_ALPHA: 'rgb565a8',
+                FORMAT_INDEXED_4BIT: 'i4', FORMAT_INDEXED_8BIT: 'i8'}
+QUANTISE_PASSES = 6
+SKETCH_SOURCES = ('*.c', '*.cpp', '*.h', '*.ino')   # What the Arduino build compiles
+
+
+# ============================================
+# Image Sources
+# ============================================
+
+def png_to_pixels(png_path):
+    """PNG -> (format, width, height, bytes) in LVGL 8 16-bit layout
+
+    Each pixel is RGB565 little-endian (LV_COLOR_16_SWAP 0), followed by
+    its alpha byte unless every pixel is opaque.
+    """
+    from PIL import Image
     img = Image.open(png_path).convert('RGBA')
     width, height = img.size
+    raw = img.tobytes()
+    pixels = [tuple(raw[i:i + 4]) for i in range(0, len(raw), 4)]
+    opaque = all(a == 255 for _, _, _, a in pixels)
 
-    c_code = f"""// Generated from {os.path.basename(png_path)}
-// Size: {width}x{height}
+    out = bytearray()
+    for r, g, b, a in pixels:
+        rgb565 = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+        out += struct.pack('<H', rgb565)
+        if not opaque:
+            out.append(a)
+    return (FORMAT_TRUE_COLOR if opaque else FORMAT_TRUE_COLOR_ALPHA), width, height, bytes(out)
 
-#include "lvgl.h"
 
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
+def c_image_to_pixels(c_path):
+    """LVGL C image file -> (format, width, height, bytes)"""
+    with open(c_path) as f:
+        text = f.read()
 
-// ARGB8565 format: Alpha + RGB565
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t {output_name}_data[] = {{
-"""
+    array = re.search(r'uint8_t\s+[\w-]+\s*\[\]\s*=\s*\{(.*?)\n\};', text, re.S)
+    if not array:
+        raise ValueError(f"{c_path}: no pixel array")
+    body = array.group(1)
+
+    # Converter output carries one block per colour depth
+    variant = re.search(r'#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0\n(.*?)#endif', body, re.S)
+    if variant:
+        body = variant.group(1)
+    data = bytes(int(h, 16) for h in re.findall(r'0x([0-9a-fA-F]{2})', body))
 
-    pixels = img.load()
-    byte_count = 0
+    width = int(re.search(r'\.(?:header\.)?w\s*=\s*(\d+)', text).group(1))
+    height = int(re.search(r'\.(?:header\.)?h\s*=\s*(\d+)', text).group(1))
+    cf = re.search(r'\.(?:header\.)?cf\s*=\s*(LV_IMG_CF_\w+)', text).group(1)
+    if cf not in CF_FORMATS:
+        raise ValueError(f"{c_path}: {cf} not supported")
+    fmt = CF_FORMATS[cf]
 
+    expected = width * height * BYTES_PER_PIXEL[fmt]
+    if len(data) != expected:
+        raise ValueError(f"{c_path}: {len(data)} bytes, expected {expected}")
+    return fmt, width, height, data
+
+
+def load_image(path):
+    if path.lower().endswith('.png'):
+        return png_to_pixels(path)
+    return c_image_to_pixels(path)
+
+
+def to_rgba(fmt, data):
+    """16-bit LVGL pixels -> [(r, g, b, a)], fully transparent ones as (0, 0, 0, 0)"""
+    step = BYTES_PER_PIXEL[fmt]
+    pixels = []
+    for i in range(0, len(data), step):
+        rgb565 = data[i] | (data[i + 1] << 8)
+        a = data[i + 2] if fmt == FORMAT_TRUE_COLOR_ALPHA else 255
+        if a == 0:
+            pixels.append((0, 0, 0, 0))
+            continue
+        r, g, b = rgb565 >> 11, (rgb565 >> 5) & 0x3F, rgb565 & 0x1F
+        pixels.append(((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2), a))
+    return pixels
+
+
+# ============================================
+# Palette Quantisation
+# ============================================
+
+def premultiplied(color):
+    # Colour error on a faint edge pixel matters as much as its alpha lets it
+    r, g, b, a = color
+    return (r * a / 255, g * a / 255, b * a / 255, a)
+
+
+def nearest(color, palette):
+    """Index of the palette entry closest to color (both premultiplied)"""
+    r, g, b, a = color
+    best, best_dist = 0, None
+    for i, (pr, pg, pb, pa) in enumerate(palette):
+        dist = (r - pr) ** 2 + (g - pg) ** 2 + (b - pb) ** 2 + (a - pa) ** 2
+        if best_dist is None or dist < best_dist:
+            best, best_dist = i, dist
+    return best
+
+
+def quantise(frames, colors):
+    """One palette of `colors` RGBA entries shared by every frame
+
+    Seeded from Pillow's octree, refined by k-means over the distinct
+    colours weighted by their pixel counts. Entry 0 is reserved fully
+    transparent so the background stays exact. Returns (palette,
+    {colour: index}).
+    """
+    from PIL import Image
+    counts = {}
+    for pixels in frames:
+        for color in pixels:
+            counts[color] = counts.get(color, 0) + 1
+    transparent = (0, 0, 0, 0)
+    opaque = [color for color in counts if color != transparent]
+
+    if len(opaque) < colors:
+        palette = [transparent] + opaque
+    else:
+        strip = Image.frombytes('RGBA', (len(opaque), 1), bytes(v for color in opaque for v in color))
+        seed = strip.quantize(colors - 1, method=Image.Quantize.FASTOCTREE).getpalette(rawmode='RGBA')
+        palette = [transparent] + [tuple(seed[i:i + 4]) for i in range(0, (colors - 1) * 4, 4)]
+        for _ in range(QUANTISE_PASSES):
+            targets = [premultiplied(entry) for entry in palette[1:]]
+            sums = [[0, 0, 0, 0, 0] for _ in targets]
+            for color in opaque:
+                weight = counts[color]
+                r, g, b, a = color
+                acc = sums[nearest(premultiplied(color), targets)]
+                acc[0] += r * a * weight
+                acc[1] += g * a * weight
+                acc[2] += b * a * weight
+                acc[3] += a * weight
+                acc[4] += weight
+            for i, (r, g, b, a, weight) in enumerate(sums):
+                if weight:
+                    palette[i + 1] = (round(r / a), round(g / a), round(b / a), round(a / weight))
+
+    targets = [premultiplied(entry) for entry in palette]
+    lookup = {color: nearest(premultiplied(color), targets) for color in counts}
+    lookup[transparent] = 0
+    palette += [transparent] * (colors - len(palette))
+    return palette, lookup
+
+
+def psnr(pixels, palette, indices):
+    """PSNR (dB) of the indexed image against its source, premultiplied RGBA"""
+    error = 0.0
+    for color, index in zip(pixels, indices):
+        a, b = premultiplied(color), premultiplied(palette[index])
+        error += sum((x - y) ** 2 for x, y in zip(a, b))
+    mse = error / (len(pixels) * 4)
+    return float('inf') if mse == 0 else 10 * math.log10(255 ** 2 / mse)
+
+
+def indexed_bytes(colors, width, height, palette, indices):
+    """LVGL 8 indexed layout: lv_color32_t palette (B, G, R, A), then the
+    indices row by row, 4-bit ones two per byte, high nibble first, each
+    row padded to a whole byte"""
+    out = bytearray()
+    for r, g, b, a in palette:
+        out += bytes((b, g, r, a))
+    if colors == 256:
+        out += bytes(indices)
+        return bytes(out)
     for y in range(height):
-        c_code += "    "
-        for x in range(width):
-            r, g, b, a = pixels[x, y]
+        row = indices[y * width:(y + 1) * width] + [0] * (width % 2)
+        out += bytes((row[x] << 4) | row[x + 1] for x in range(0, len(row), 2))
+    return bytes(out)
+
+
+# ============================================
+# C Array (compiled into the firmware)
+# ============================================
 
-            # Convert RGB888 to RGB565
-            r5 = (r >> 3) & 0x1F
-            g6 = (g >> 2) & 0x3F
-            b5 = (b >> 3) & 0x1F
-            rgb565 = (r5 << 11) | (g6 << 5) | b5
+def png_to_lvgl_c(png_path, output_name):
+    """Convert PNG to an LVGL C image (RGB565 with alpha)"""
+    fmt, width, height, data = png_to_pixels(png_path)
+    cf = 'LV_IMG_CF_TRUE_COLOR' if fmt == FORMAT_TRUE_COLOR else 'LV_IMG_CF_TRUE_COLOR_ALPHA'
 
-            # ARGB8565: Alpha byte + RGB565 (2 bytes)
-            c_code += f"0x{a:02X},"  # Alpha
-            c_code += f"0x{(rgb565 >> 8):02X},0x{(rgb565 & 0xFF):02X},"  # RGB565 high, low
+    rows = []
+    for i in range(0, len(data), 24):
+        rows.append("    " + ",".join(f"0x{b:02X}" for b in data[i:i + 24]) + ",")
 
-            byte_count += 3
+    return f"""// Generated from {os.path.basename(png_path)}
+// Size: {width}x{height}
 
-            if (byte_count % 12) == 0:
-                c_code += "\n    "
+#include "lvgl.h"
 
-        if y < height - 1:
-            c_code += "\n"
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
 
-    c_code += f"""
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t {output_name}_data[] = {{
+{chr(10).join(rows)}
 }};
 
 const lv_img_dsc_t {output_name} = {{
     .header = {{
-        .cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+        .cf = {cf},
         .always_zero = 0,
         .reserved = 0,
         .w = {width},
         .h = {height}
     }},
-    .data_size = {width * height * 3},
+    .data_size = {len(data)},
     .data = {output_name}_data,
 }};
 """
 
-    return c_code
 
-if __name__ == "__main__":
-    idle_dir = "/home/alvin/Esp32-s3/src/sui_watch/assets/idle"
-    output_dir = "/home/alvin/Esp32-s3/src/sui_watch"
+def convert_c(png_path, c_name, output_dir):
+    output_file = os.path.join(output_dir, f"{c_name}.c")
+    with open(output_file, 'w') as f:
+        f.write(png_to_lvgl_c(png_path, c_name))
+    print(f"✓ Generated {output_file}")
 
-    # Convert each image
-    images = [
-        ("2.png", "pet_idle_frame1"),
-        ("3.png", "pet_idle_frame2"),
-        ("4.png", "pet_idle_frame3"),
-    ]
 
-    for png_file, c_name in images:
-        png_path = os.path.join(idle_dir, png_file)
-        c_code = png_to_lvgl_c(png_path, c_name)
+# ============================================
+# Asset Pack
+# ============================================
 
-        output_file = os.path.join(output_dir, f"{c_name}.c")
-        with open(output_file, 'w') as f:
-            f.write(c_code)
+def read_manifest(manifest_path):
+    """-> [(name, path, palette or None, colors or None)]"""
+    base = os.path.dirname(os.path.abspath(manifest_path))
+    items = []
+    palettes = {}
+    with open(manifest_path) as f:
+        for line_no, line in enumerate(f, 1):
+            line = line.split('#', 1)[0].strip()
+            if not line:
+                continue
+            fields = line.split()
+            if len(fields) not in (2, 3):
+                raise ValueError(f"{manifest_path}:{line_no}: expected 'name source [palette:colors]'")
+            name, source = fields[:2]
+            if len(name.encode()) >= NAME_LEN:
+                raise ValueError(f"{manifest_path}:{line_no}: name '{name}' longer than {NAME_LEN - 1}")
+            palette = colors = None
+            if len(fields) == 3:
+                palette, _, colors = fields[2].partition(':')
+                if not colors.isdigit() or int(colors) not in INDEXED_FORMATS:
+                    raise ValueError(f"{manifest_path}:{line_no}: palette needs 16 or 256 colours")
+                colors = int(colors)
+                if palettes.setdefault(palette, colors) != colors:
+                    raise ValueError(f"{manifest_path}:{line_no}: palette '{palette}' already has {palettes[palette]} colours")
+            items.append((name, os.path.join(base, source), palette, colors))
+    names = [item[0] for item in items]
+    if len(set(names)) != len(names):
+        raise ValueError(f"{manifest_path}: duplicate names")
+    return items
 
-        print(f"✓ Generated {output_file}")
 
-    # Generate header file
-    header = """#ifndef PET_SPRITES_H
-#define PET_SPRITES_H
+def align(n):
+    return (n + PACK_ALIGN - 1) // PACK_ALIGN * PACK_ALIGN
 
-#include "lvgl.h"
 
-// Pet idle animation frames
-extern const lv_img_dsc_t pet_idle_frame1;
-extern const lv_img_dsc_t pet_idle_frame2;
-extern const lv_img_dsc_t pet_idle_frame3;
+def encode_images(items):
+    """Manifest items -> {name: (fmt, width, height, bytes, source bytes, psnr)}
+
+    Images without a palette go in as loaded (psnr None); the rest are
+    quantised per palette, all frames of a set together.
+    """
+    encoded = {}
+    sets = {}
+    for name, path, palette, colors in items:
+        fmt, width, height, data = load_image(path)
+        if palette is None:
+            encoded[name] = (fmt, width, height, data, len(data), None)
+        else:
+            sets.setdefault((palette, colors), []).append((name, width, height, len(data), to_rgba(fmt, data)))
+
+    for (palette_name, colors), frames in sorted(sets.items()):
+        palette, lookup = quantise([pixels for *_, pixels in frames], colors)
+        for name, width, height, source_size, pixels in frames:
+            indices = [lookup[color] for color in pixels]
+            data = indexed_bytes(colors, width, height, palette, indices)
+            encoded[name] = (INDEXED_FORMATS[colors], width, height, data, source_size,
+                             psnr(pixels, palette, indices))
+    return encoded
+
+
+def build_pack(items):
+    """Manifest items -> (pack bytes, [(name, fmt, w, h, offset, size, source size, psnr, shared)])
+
+    Images whose encoded bytes match an earlier one point at its data;
+    shared names that image (None for the first copy).
+    """
+    encoded = encode_images(items)
+    # Sorted by name: the firmware binary-searches the table
+    names = sorted(encoded, key=lambda name: name.encode())
+
+    table_end = HEADER.size + ENTRY.size * len(names)
+    offset = align(table_end)
+    entries = []
+    stored = {}        # sha256 of the bytes -> (name, offset)
+    data = bytearray(offset - table_end)
+    for name in names:
+        fmt, width, height, pixels, source_size, quality = encoded[name]
+        digest = hashlib.sha256(pixels).digest()
+        if digest in stored:
+            shared, shared_offset = stored[digest]
+            entries.append((name, fmt, width, height, shared_offset, len(pixels), source_size, quality, shared))
+            continue
+        stored[digest] = (name, offset)
+        entries.append((name, fmt, width, height, offset, len(pixels), source_size, quality, None))
+        data += pixels
+        data += bytes(align(len(pixels)) - len(pixels))
+        offset += align(len(pixels))
+
+    table = b''.join(ENTRY.pack(name.encode(), off, size, w, h, fmt)
+                     for name, fmt, w, h, off, size, *_ in entries)
+    size = table_end + len(data)
+    header = HEADER.pack(PACK_MAGIC, PACK_VERSION, len(entries), size,
+                         zlib.crc32(table), zlib.crc32(bytes(data)))
+    return header + table + bytes(data), entries
+
+
+# ============================================
+# Linked Image Check
+# ============================================
+
+def pixel_hash(fmt, width, height, data):
+    """Identity of a decoded image, whatever file or formatting it came from"""
+    return hashlib.sha256(struct.pack('<BHH', fmt, width, height) + data).hexdigest()
 
-#endif // PET_SPRITES_H
-"""
 
-    header_file = os.path.join(output_dir, "pet_sprites.h")
-    with open(header_file, 'w') as f:
-        f.write(header)
+def strip_comments(text):
+    # String literals are matched first so "//" inside one survives
+    return re.sub(r'("(?:\\.|[^"\\\n])*")|//[^\n]*|/\*.*?\*/',
+                  lambda m: m.group(1) or '', text, flags=re.S)
 
-    print(f"✓ Generated {header_file}")
-    print("\n✅ All files generated successfully!")
+
+def sketch_sources(sketch_dir):
+    """{path: text without comments} of what the sketch build compiles (top level only)"""
+    sources = {}
+    for pattern in SKETCH_SOURCES:
+        for path in sorted(glob.glob(os.path.join(sketch_dir, pattern))):
+            with open(path, errors='replace') as f:
+                sources[path] = strip_comments(f.read())
+    return sources
+
+
+def linked_images(sources):
+    """lv_img_dsc_t defined in the sketch -> [(symbol, path, (fmt, w, h, data))]"""
+    images = []
+    for path, text in sources.items():
+        symbols = re.findall(r'^\s*const\s+lv_img_dsc_t\s+(\w+)\s*=', text, re.M)
+        if len(symbols) > 1:
+            raise ValueError(f"{path}: one image per file expected, found {', '.join(symbols)}")
+        if symbols:
+            images.append((symbols[0], path, c_image_to_pixels(path)))
+    return images
+
+
+def is_referenced(pattern, sources, skip_path=None):
+    """pattern used in a source line other than a declaration"""
+    for path, text in sources.items():
+        if path == skip_path:
+            continue
+        for line in text.splitlines():
+            if re.search(pattern, line) and not re.search(r'LV_IMG_DECLARE|\bextern\b', line):
+                return True
+    return False
+
+
+def check_images(items, sketch_dir):
+    """Print the linked images, return the problems as messages"""
+    sources = sketch_sources(sketch_dir)
+    errors = []
+    seen = {}          # pixel hash -> where it is
+
+    for name, path, _, _ in items:
+        key = pixel_hash(*load_image(path))
+        if key in seen:
+            print(f"  note: pack '{name}' has the same pixels as {seen[key]}, stored once")
+        seen.setdefault(key, f"pack '{name}'")
+        if not is_referenced(r'"' + re.escape(name) + r'"', sources):
+            errors.append(f"pack '{name}' is not used by the firmware (no \"{name}\" in the sketch)")
+
+    images = linked_images(sources)
+    linked_total = 0
+    for symbol, path, (fmt, width, height, data) in images:
+        print(f"  {symbol:<24} {width:>4}x{height:<4} {FORMAT_NAMES[fmt]:<8} {len(data):>7} B  app, {os.path.basename(path)}")
+        linked_total += len(data)
+        key = pixel_hash(fmt, width, height, data)
+        if key in seen:
+            errors.append(f"{symbol} ({os.path.basename(path)}) duplicates {seen[key]}")
+        seen.setdefault(key, symbol)
+        if not is_referenced(r'\b' + symbol + r'\b', sources, skip_path=path):
+            errors.append(f"{symbol} ({os.path.basename(path)}) is linked but never used")
+    print(f"  {len(images)} images linked into the app, {linked_total} pixel bytes\n")
+    return errors
+
+
+def partition(csv_path, label):
+    """(offset, size) of a partition in partitions.csv, or None"""
+    with open(csv_path) as f:
+        for line in f:
+            fields = [field.strip() for field in line.split('#', 1)[0].split(',')]
+            if len(fields) >= 5 and fields[0] == label:
+                return int(fields[3], 0), int(fields[4], 0)
+    return None
+
+
+def make_pack(manifest_path, output_path=None):
+    """Check, build, report; writes the pack only if output_path is given"""
+    items = read_manifest(manifest_path)
+    errors = check_images(items, SCRIPT_DIR)
+    pack, entries = build_pack(items)
+
+    source_total = 0
+    for name, fmt, width, height, offset, size, source_size, quality, shared in entries:
+        stored = 0 if shared else align(size)
+        line = f"  {name:<{NAME_LEN}} {width:>4}x{height:<4} {FORMAT_NAMES[fmt]:<8} {stored:>7} B @ 0x{offset:06X}"
+        if shared:
+            line += f"  same data as {shared}"
+        elif quality is not None:
+            line += f"  {source_size / size:4.1f}x smaller, {quality:4.1f} dB"
+        print(line)
+        source_total += source_size
+    print(f"  {len(entries)} images in the pack, {len(pack)} bytes"
+          f" ({source_total} pixel bytes before quantisation and sharing)")
+
+    if errors:
+        for error in errors:
+            print(f"✗ {error}")
+        sys.exit(1)
+
+    part = partition(os.path.join(SCRIPT_DIR, 'partitions.csv'), 'assets')
+    if part and len(pack) > part[1]:
+        sys.exit(f"✗ Pack is {len(pack)} bytes, the assets partition only {part[1]}")
+    if output_path is None:
+        print("✓ No duplicate or unused images")
+        return
+
+    with open(output_path, 'wb') as f:
+        f.write(pack)
+    print(f"✓ Generated {output_path}")
+    if part:
+        print(f"\nFlash: esptool.py --chip esp32s3 write_flash 0x{part[0]:X} {output_path}")
+
+
+if __name__ == "__main__":
+    args = sys.argv[1:]
+    if len(args) >= 3 and args[0] == 'c':
+        convert_c(args[1], args[2], args[3] if len(args) > 3 else SCRIPT_DIR)
+    elif args and args[0] == 'pack':
+        manifest = args[1] if len(args) > 1 else os.path.join(SCRIPT_DIR, 'assets', 'pack.txt')
+        output = args[2] if len(args) > 2 else os.path.join(SCRIPT_DIR, 'assets.bin')
+        make_pack(manifest, output)
+    elif args and args[0] == 'check':
+        make_pack(args[1] if len(args) > 1 else os.path.join(SCRIPT_DIR, 'assets', 'pack.txt'))
+    else:
+        print(__doc__.strip())
+        sys.exit(1)
@@ -0,0 +1,200 @@
+#!/usr/bin/env python3
+"""
+Expand the watch's binary deferred log (DeferredLog.h, DLOG_BINARY 1)
+
+  log_decode.py CAPTURE            Raw serial capture (e.g. cat /dev/ttyACM0 > capture.bin)
+  log_decode.py --port PORT        Live from the watch (pyserial), until Ctrl-C
+  log_decode.py --formats          List the format IDs found in the sources
+
+Record frames are matched to their format string by ID: the FNV-1a hash
+of each DLOG_ERROR/WARN/INFO/DEBUG format literal in the sketch sources
+(next to this script), so the sources must match the flashed firmware.
+Everything between frames - plain Serial output - is passed through.
+Decoded records are prefixed with their timestamp (ms since boot) and
+level.
+"""
+import glob
+import os
+import re
+import struct
+import sys
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+BAUD = 115200
+
+# Must match DeferredLog.h
+FRAME_START = 0x1E
+FRAME_HEADER = 11
+ARG_BYTES = 48
+LEVELS = {1: "E", 2: "W", 3: "I", 4: "D"}
+
+CALL = re.compile(r'\bDLOG_(?:ERROR|WARN|INFO|DEBUG)\s*\(\s*((?:"(?:[^"\\\n]|\\.)*"\s*)+)')
+LITERAL = re.compile(r'"((?:[^"\\\n]|\\.)*)"')
+ESCAPES = {"n": b"\n", "t": b"\t", "r": b"\r", "0": b"\0", "\\": b"\\", '"': b'"', "'": b"'"}
+CONVERSION = re.compile(r'%([-+ #0]*)(\d*)(\.\d+)?(?:hh|h|ll|l|L|q|j|z|t)?([diouxXcsfFeEgGaAp%])')
+
+
+def unescape(text):
+    """C string literal body -> bytes (UTF-8 source)"""
+    out = bytearray()
+    i = 0
+    while i < len(text):
+        c = text[i]
+        if c != "\\":
+            out += c.encode("utf-8")
+            i += 1
+            continue
+        nxt = text[i + 1]
+        if nxt == "x":
+            digits = re.match(r"[0-9a-fA-F]+", text[i + 2:]).group(0)
+            out.append(int(digits, 16) & 0xFF)
+            i += 2 + len(digits)
+        else:
+            out += ESCAPES.get(nxt, nxt.encode("utf-8"))
+            i += 2
+    return bytes(out)
+
+
+def fnv1a(data):
+    h = 2166136261
+    for b in data:
+        h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def load_formats():
+    formats = {}
+    sources = []
+    for pattern in ("*.c", "*.cpp", "*.h", "*.ino"):
+        sources += glob.glob(os.path.join(SCRIPT_DIR, pattern))
+    for path in sorted(sources):
+        with open(path, encoding="utf-8", errors="replace") as f:
+            text = f.read()
+        for call in CALL.finditer(text):
+            raw = b"".join(unescape(m.group(1)) for m in LITERAL.finditer(call.group(1)))
+            formats[fnv1a(raw)] = raw.decode("utf-8", "replace")
+    return formats
+
+
+def read_args(data):
+    args = []
+    pos = 0
+    while pos < len(data):
+        tag = chr(data[pos])
+        pos += 1
+        if tag in "iu":
+            args.append(struct.unpack_from("<i" if tag == "i" else "<I", data, pos)[0])
+            pos += 4
+        elif tag in "qQpd":
+            fmt = {"q": "<q", "Q": "<Q", "p": "<Q", "d": "<d"}[tag]
+            args.append(struct.unpack_from(fmt, data, pos)[0])
+            pos += 8
+        elif tag == "s":
+            n = data[pos]
+            args.append(data[pos + 1:pos + 1 + n].decode("utf-8", "replace"))
+            pos += 1 + n
+        else:
+            break
+    return args
+
+
+def expand(fmt, args):
+    """printf with Python's %, one conversion at a time"""
+    queue = list(args)
+
+    def convert(match):
+        flags, width, precision, conv = match.groups()
+        if conv == "%":
+            return "%"
+        if not queue:
+            return "?"
+        value = queue.pop(0)
+        precision = precision or ""
+        try:
+            if conv == "p":
+                return "0x%x" % value
+            if conv in "aA":
+                conv = "e"
+            if conv in "diu":
+                return ("%" + flags + width + "d") % int(value)
+            if conv == "c":
+                return chr(value) if isinstance(value, int) else str(value)
+            if conv == "s" and not isinstance(value, str):
+                value = str(value)
+            return ("%" + flags + width + precision + conv) % value
+        except (TypeError, ValueError):
+            return "?"
+
+    return CONVERSION.sub(convert, fmt)
+
+
+def decode(stream, formats, out):
+    """Reads bytes from stream until it ends; writes text to out"""
+    buffer = bytearray()
+    while True:
+        chunk = stream.read(256)
+        if not chunk:
+            break
+        buffer += chunk
+        while True:
+            start = buffer.find(bytes([FRAME_START]))
+            if start < 0:
+                out.write(buffer.decode("utf-8", "replace"))
+                buffer.clear()
+                break
+            if start:
+                out.write(buffer[:start].decode("utf-8", "replace"))
+                del buffer[:start]
+            if len(buffer) < FRAME_HEADER:
+                break
+            level, fid, ms, length = struct.unpack_from("<BIIB", buffer, 1)
+            if level not in LEVELS or length > ARG_BYTES:
+                out.write("\\x1e")   # Not a frame after all
+                del buffer[:1]
+                continue
+            if len(buffer) < FRAME_HEADER + length:
+                break
+            args = read_args(bytes(buffer[FRAME_HEADER:FRAME_HEADER + length]))
+            del buffer[:FRAME_HEADER + length]
+            fmt = formats.get(fid)
+            text = expand(fmt, args) if fmt is not None else \
+                "<unknown format %08x> %s" % (fid, args)
+            out.write("[%6d.%03d] %s %s\n" % (ms // 1000, ms % 1000, LEVELS[level], text))
+        out.flush()
+    out.write(buffer.decode("utf-8", "replace"))
+
+
+def main(argv):
+    if not argv or argv[0] in ("-h", "--help"):
+        print(__doc__.strip())
+        return 1
+
+    formats = load_formats()
+    if argv[0] == "--formats":
+        for fid, fmt in sorted(formats.items(), key=lambda item: item[1]):
+            print("%08x  %s" % (fid, fmt))
+        print("%d formats" % len(formats))
+        return 0
+
+    if argv[0] == "--port":
+        if len(argv) < 2:
+            print(__doc__.strip())
+            return 1
+        try:
+            import serial
+        except ImportError:
+            sys.exit("pyserial is needed for --port (pip install pyserial)")
+        with serial.Serial(argv[1], BAUD, timeout=None) as link:
+            try:
+                decode(link, formats, sys.stdout)
+            except KeyboardInterrupt:
+                pass
+        return 0
+
+    with open(argv[0], "rb") as f:
+        decode(f, formats, sys.stdout)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -1,402 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_PET_IDLE_FRAME1
-#define LV_ATTRIBUTE_IMG_PET_IDLE_FRAME1
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_PET_IDLE_FRAME1 uint8_t pet_idle_frame1_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xff, 0x05, 0xff, 0x08, 0xff, 0x08, 0xff, 0x08, 0xff, 0x07, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x02, 0xdb, 0x12, 0xb6, 0x2d, 0x92, 0x5a, 0x8e, 0x70, 0x6d, 0x87, 0x6d, 0xab, 0x6d, 0xbb, 0x6d, 0xbf, 0x6d, 0xbe, 0x6d, 0xb6, 0x6d, 0xa7, 0x6d, 0x86, 0x6d, 0x68, 0x92, 0x49, 0xb2, 0x1f, 0xdb, 0x0b, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xdb, 0x0f, 0x92, 0x45, 0x6d, 0x93, 0x6d, 0xcf, 0x6d, 0xf0, 0x6d, 0xf8, 0x6d, 0xfc, 0x6d, 0xfe, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x52, 0xff, 0x52, 0xff, 0x4e, 0xff, 0x6e, 0xfe, 0x6d, 0xfa, 0x6d, 0xf4, 0x6d, 0xe6, 0x6d, 0xbd, 0x6d, 0x82, 0x92, 0x41, 0xd6, 0x14, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xd7, 0x18, 0x8e, 0x67, 0x6d, 0xbf, 0x49, 0xf1, 0x4d, 0xfd, 0x4d, 0xff, 0x52, 0xff, 0x76, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x52, 0xff, 0x4d, 0xff, 0x4d, 0xfc, 0x6d, 0xf2, 0x6d, 0xc8, 0x92, 0x7e, 0xb6, 0x30, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x10, 0x92, 0x61, 0x49, 0xd2, 0x6d, 0xf8, 0x4d, 0xff, 0x72, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x4e, 0xff, 0x6d, 0xfc, 0x6d, 0xe6, 0x6d, 0xa4, 0xb2, 0x3f, 0xfb, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0xb2, 0x36, 0x6d, 0xb1, 0x49, 0xf7, 0x4d, 0xff, 0x76, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x77, 0xff, 0x72, 0xff, 0x6d, 0xfe, 0x6d, 0xee, 0x8e, 0xa5, 0xb6, 0x36, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0x92, 0x5d, 0x69, 0xe0, 0x4d, 0xfe, 0x72, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x72, 0xff, 0x6d, 0xfe, 0x6d, 0xe5, 0x8e, 0x85, 0xfb, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x10, 0x8e, 0x88, 0x6d, 0xf1, 0x4d, 0xff, 0x76, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x77, 0xff, 0x6e, 0xff, 0x6d, 0xfa, 0x6d, 0xbd, 0xb2, 0x32, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x15, 0x6d, 0x9b, 0x49, 0xf9, 0x4e, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x72, 0xff, 0x6d, 0xfe, 0x6d, 0xd8, 0xb2, 0x4e, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x12, 0x69, 0xa5, 0x49, 0xfa, 0x52, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x4d, 0xff, 0x6d, 0xe9, 0x92, 0x61, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x0d, 0x6d, 0x95, 0x49, 0xfa, 0x4e, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x77, 0xff, 0x4d, 0xff, 0x6d, 0xe9, 0xb2, 0x56, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x05, 0x6d, 0x7e, 0x49, 0xf7, 0x4d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x7b, 0xff, 0x6e, 0xff, 0x6d, 0xde, 0xb2, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x92, 0x4e, 0x6d, 0xec, 0x4d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x77, 0xff, 0x6d, 0xfe, 0x6d, 0xc3, 0xd7, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x37, 0x6d, 0xdb, 0x4d, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x6d, 0xfc, 0x6d, 0x97, 0xdb, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x10, 0x6d, 0xb2, 0x4d, 0xfd, 0x77, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x4e, 0xff, 0x6d, 0xf1, 0xb2, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x6d, 0x72, 0x4d, 0xf7, 0x72, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0x6d, 0xbe, 0xfb, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x2d, 0x4d, 0xdf, 0x4e, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x6d, 0xf5, 0x8e, 0x61, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x06, 0x6d, 0x98, 0x4d, 0xfd, 0x7b, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0x6d, 0xc0, 0xb7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x47, 0x69, 0xeb, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x6d, 0xf4, 0x92, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x09, 0x69, 0xae, 0x4d, 0xfe, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x6d, 0xfe, 0x8e, 0xa3, 0xdb, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x34, 0x49, 0xeb, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x6d, 0xe4, 0xb6, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x6d, 0x8d, 0x4d, 0xfd, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x6d, 0xf9, 0x6e, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x20, 0x6d, 0xd9, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4e, 0xff, 0x6d, 0xac, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6a, 0x6d, 0xf8, 0x76, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x6d, 0xdd, 0xb6, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x09, 0x6d, 0xb5, 0x4d, 0xfe, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x76, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x72, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x76, 0xff, 0x6d, 0xf7, 0x8e, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x2a, 0x4d, 0xeb, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x4d, 0xff, 0x69, 0xff, 0x69, 0xff, 0x6d, 0xff, 0x4d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x4e, 0xff, 0x4d, 0xff, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4d, 0xfd, 0x6d, 0x96, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x71, 0x4d, 0xfc, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x49, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x6d, 0xff, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x4d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x4d, 0xff, 0x72, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0x6d, 0xc5, 0xd7, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0x6d, 0xb3, 0x4d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0x69, 0xff, 0x69, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x4e, 0xff, 0x6d, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x4d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x52, 0xff, 0x49, 0xe6, 0xb7, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x1a, 0x49, 0xe5, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x4e, 0xff, 0x6d, 0xff, 0x69, 0xff, 0x6d, 0xff, 0x4d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x77, 0xff, 0x52, 0xff, 0x52, 0xff, 0x52, 0xff, 0x52, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4e, 0xff, 0x69, 0xff, 0x89, 0xff, 0x69, 0xff, 0x69, 0xff, 0x4d, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x72, 0xff, 0x6d, 0xf7, 0x92, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xff, 0x07, 0xfb, 0x08, 0xff, 0x03, 0x00, 0x00, 0x92, 0x5e, 0x49, 0xfa, 0x76, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x7b, 0xff, 0x4e, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x76, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x72, 0xff, 0x4d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x4d, 0xff, 0x76, 0xff, 0x76, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x52, 0xff, 0x6d, 0xff, 0x69, 0xff, 0x69, 0xff, 0x6d, 0xff, 0x4e, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x76, 0xff, 0x6d, 0xfe, 0x8e, 0xa7, 0xfb, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x2a, 0x6d, 0x90, 0x6d, 0xa8, 0x8d, 0x91, 0x92, 0x5c, 0x6d, 0xbd, 0x49, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x52, 0xff, 0x49, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x49, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6d, 0xff, 0x4d, 0xff, 0x52, 0xff, 0x76, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x49, 0xff, 0x4d, 0xff, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x6d, 0xff, 0x6d, 0xf6, 0x92, 0x70, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x08, 0x92, 0x26, 0x92, 0x4c, 0x8e, 0x6a, 0x8d, 0x9a, 0x6d, 0xf8, 0x4d, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x4d, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7b, 0xff, 0x52, 0xff, 0x52, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x6e, 0xff, 0x6d, 0xff, 0x6d, 0xec, 0x92, 0x4d, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x38, 0x6d, 0xf4, 0x4d, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x92, 0xff, 0x92, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x92, 0xff, 0x4d, 0xff, 0x77, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xce, 0xb6, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xff, 0x06, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x4e, 0x6d, 0xfa, 0x76, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xff, 0x4d, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x76, 0xff, 0x56, 0xff, 0x56, 0xff, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x6d, 0xfd, 0x6d, 0xa4, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xb6, 0x22, 0x6d, 0x7c, 0x6d, 0xb0, 0x6d, 0x99, 0x92, 0x38, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x92, 0x7d, 0x6d, 0xfe, 0x76, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0x72, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x32, 0xff, 0x52, 0xff, 0x52, 0xff, 0x52, 0xff, 0x52, 0xff, 0x52, 0xff, 0x56, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x9b, 0xff, 0x72, 0xff, 0x6d, 0xf3, 0x92, 0x59, 0xff, 0x01, 0xf7, 0x03, 0x8e, 0x52, 0x6d, 0xd6, 0x6d, 0xfc, 0x6d, 0xff, 0x6d, 0xfe, 0x6d, 0xd6, 0xb2, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0xd7, 0x2a, 0x92, 0x64, 0x6d, 0xd7, 0x6d, 0xff, 0x52, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x32, 0xff, 0x52, 0xff, 0x72, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x6d, 0xff, 0x72, 0xff, 0x76, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x4d, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0x6d, 0xcc, 0xdb, 0x1f, 0x92, 0x45, 0x6d, 0xe3, 0x4d, 0xff, 0x76, 0xff, 0x9b, 0xff, 0x76, 0xff, 0x4d, 0xfd, 0x6d, 0x8f, 0xf7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x16, 0x8e, 0x88, 0x6d, 0xbe, 0x6d, 0x8f, 0x6d, 0xde, 0x4d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x97, 0xff, 0x6d, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0x6d, 0xff, 0x72, 0xff, 0x76, 0xff, 0x52, 0xff, 0x32, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x52, 0xff, 0x4e, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x6d, 0xfc, 0x8e, 0xa7, 0x6d, 0xd9, 0x4d, 0xff, 0x77, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4e, 0xff, 0x6d, 0xce, 0xdb, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x3e, 0x6d, 0x6a, 0xb2, 0x25, 0xdb, 0x12, 0x6d, 0xcf, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x77, 0xff, 0x6d, 0xff, 0xdb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x76, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x52, 0xff, 0x52, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0x69, 0xfe, 0x49, 0xff, 0x72, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x72, 0xff, 0x6d, 0xe7, 0xb6, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x1a, 0x6d, 0xe8, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x92, 0xff, 0x76, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x56, 0xff, 0x2e, 0xff, 0x52, 0xff, 0x77, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x52, 0xff, 0x52, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x6d, 0xff, 0x4d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x76, 0xff, 0x6d, 0xf0, 0xb2, 0x38, 0xff, 0x01, 0xff, 0x0b, 0xdb, 0x0d, 0xfb, 0x09, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x24, 0x4d, 0xee, 0x76, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x52, 0xff, 0x6d, 0xff, 0xb6, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0x92, 0xff, 0x4d, 0xff, 0x96, 0xff, 0xbb, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x76, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x76, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x77, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x52, 0xff, 0x56, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x72, 0xff, 0x6d, 0xfa, 0x92, 0x88, 0x92, 0x89, 0x6d, 0xc5, 0x6d, 0xd0, 0x6d, 0xbd, 0x6d, 0x85, 0x92, 0x3e, 0xd7, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x2b, 0x4d, 0xf1, 0x76, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x52, 0xff, 0x77, 0xff, 0x72, 0xff, 0x6d, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0x96, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4d, 0xff, 0x96, 0xff, 0xbb, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xb6, 0xff, 0x6d, 0xff, 0x4e, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x76, 0xff, 0x32, 0xff, 0x57, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x52, 0xff, 0x56, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x52, 0xff, 0x4d, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x72, 0xff, 0x6d, 0xff, 0x6d, 0xfd, 0x6d, 0xfe, 0x4d, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4d, 0xfd, 0x6d, 0xef, 0x6d, 0x9f, 0xd6, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x3a, 0x4d, 0xf4, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x52, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6d, 0xff, 0x4d, 0xff, 0x72, 0xff, 0x76, 0xff, 0x77, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x72, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbf, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0x6e, 0xff, 0x52, 0xff, 0x97, 0xff, 0x52, 0xff, 0x56, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x32, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x4d, 0xff, 0x76, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x4e, 0xff, 0x4d, 0xff, 0x4e, 0xff, 0x77, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x77, 0xff, 0x4e, 0xff, 0x6d, 0xf8, 0x6d, 0x6c, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x4e, 0x4d, 0xf7, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x76, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x72, 0xff, 0x6d, 0xff, 0x92, 0xff, 0xb6, 0xff, 0xb7, 0xff, 0xb6, 0xff, 0x92, 0xff, 0x6d, 0xff, 0x52, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x56, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x5b, 0xff, 0x56, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0x76, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x2d, 0xff, 0x52, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4d, 0xff, 0x6d, 0xb6, 0xdb, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x5a, 0x4d, 0xf8, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x4d, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x6e, 0xff, 0x8e, 0xff, 0x8e, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x72, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x52, 0xff, 0x4d, 0xd4, 0x92, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x55, 0x4d, 0xf7, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x52, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x52, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0xff, 0x76, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x4e, 0xff, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x72, 0xff, 0x4d, 0xd5, 0x8e, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x50, 0x4d, 0xf6, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x52, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x72, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x72, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x52, 0xff, 0x4e, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x52, 0xff, 0x6d, 0xba, 0x92, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x43, 0x6d, 0xf4, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x76, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x4e, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x52, 0xff, 0x52, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x6d, 0xfc, 0x6d, 0x88, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x2b, 0x6d, 0xef, 0x76, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4d, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x76, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0xff, 0x76, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x56, 0xff, 0x52, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x6d, 0xec, 0x92, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x1e, 0x4d, 0xe7, 0x76, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x52, 0xff, 0x92, 0xff, 0xfb, 0xff, 0x4d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x76, 0xff, 0x92, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4d, 0xfd, 0x6d, 0xb0, 0xdb, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x1a, 0x4d, 0xe0, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x72, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x76, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4e, 0xff, 0x6d, 0xdd, 0x92, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x0f, 0x4d, 0xcd, 0x4e, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x56, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x4e, 0xff, 0x6d, 0xea, 0x6e, 0x5e, 0xf2, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x03, 0x6d, 0x9d, 0x4d, 0xfe, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x52, 0xff, 0x49, 0xfe, 0x6d, 0xe6, 0x6d, 0x65, 0xdb, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x6d, 0x79, 0x4d, 0xfb, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x72, 0xff, 0x4d, 0xff, 0x49, 0xf5, 0x69, 0xbf, 0x6d, 0x4a, 0xdb, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x42, 0x49, 0xf3, 0x52, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x4e, 0xff, 0x4d, 0xff, 0x4d, 0xfd, 0x69, 0xf2, 0x69, 0xbe, 0x6e, 0x5c, 0xd7, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x21, 0x4d, 0xdb, 0x4e, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x72, 0xff, 0x4d, 0xfd, 0x49, 0xeb, 0x69, 0xc3, 0x6d, 0x8f, 0x6e, 0x4a, 0xb6, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x6d, 0xb4, 0x4d, 0xff, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0x4e, 0xff, 0x6d, 0xd8, 0x92, 0x42, 0xb6, 0x0f, 0xfe, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x4d, 0xfa, 0x72, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x6d, 0xf9, 0x8e, 0x66, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x2a, 0x49, 0xe5, 0x4e, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x72, 0xff, 0x6d, 0xdd, 0xb6, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x05, 0x6d, 0xa1, 0x4d, 0xfe, 0x76, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x6e, 0xfd, 0x6e, 0x93, 0xfb, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x4c, 0x4d, 0xf4, 0x52, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x72, 0xff, 0x6d, 0xeb, 0x92, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x13, 0x6d, 0xc6, 0x4d, 0xff, 0x76, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x6d, 0xfe, 0x6d, 0xa3, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x6e, 0x70, 0x4d, 0xf9, 0x72, 0xff, 0x77, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x4e, 0xff, 0x6d, 0xe9, 0xb2, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x1a, 0x6d, 0xd4, 0x4d, 0xff, 0x76, 0xff, 0x57, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x77, 0xff, 0x72, 0xff, 0x49, 0xfb, 0x6d, 0x97, 0xdb, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x8e, 0x75, 0x49, 0xfa, 0x52, 0xff, 0x77, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x77, 0xff, 0x76, 0xff, 0x4d, 0xff, 0x6d, 0xd1, 0xb2, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x17, 0x49, 0xd0, 0x49, 0xff, 0x76, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x72, 0xff, 0x6d, 0xee, 0x92, 0x52, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x92, 0x4f, 0x69, 0xee, 0x4d, 0xff, 0x76, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x72, 0xff, 0x6d, 0xfa, 0x6d, 0x91, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x6d, 0x80, 0x4d, 0xf8, 0x4e, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x4d, 0xfe, 0x6d, 0xc4, 0xb2, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x0c, 0x6d, 0x99, 0x4d, 0xfb, 0x72, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x72, 0xff, 0x6d, 0xf1, 0x92, 0x49, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x19, 0x6d, 0xc3, 0x4d, 0xff, 0x72, 0xff, 0x77, 0xff, 0x7b, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x57, 0xff, 0x77, 0xff, 0x6e, 0xff, 0x6d, 0xd3, 0xdb, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x8e, 0x76, 0x69, 0xfc, 0x4d, 0xff, 0x4e, 0xff, 0x77, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x77, 0xff, 0x76, 0xff, 0x6e, 0xff, 0x6d, 0xb1, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x64, 0x49, 0xfb, 0x6d, 0xff, 0x4d, 0xff, 0x4e, 0xff, 0x9b, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x57, 0xff, 0x77, 0xff, 0x77, 0xff, 0x76, 0xff, 0x4d, 0xfc, 0x6e, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x55, 0x49, 0xfb, 0x72, 0xff, 0x72, 0xff, 0x4d, 0xff, 0x4e, 0xff, 0x9b, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x57, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x56, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x77, 0xff, 0x77, 0xff, 0x72, 0xff, 0x49, 0xf2, 0x92, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x49, 0x6d, 0xf8, 0x72, 0xff, 0x96, 0xff, 0x72, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x92, 0xff, 0xbb, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0x72, 0xff, 0x56, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x52, 0xff, 0x52, 0xff, 0x77, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x76, 0xff, 0x52, 0xff, 0x52, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x77, 0xff, 0x77, 0xff, 0x4e, 0xff, 0x6d, 0xcd, 0xd7, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x3d, 0x6d, 0xf2, 0x72, 0xff, 0x77, 0xff, 0x77, 0xff, 0x72, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x6d, 0xff, 0x96, 0xff, 0xbb, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x72, 0xff, 0x52, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x52, 0xff, 0x52, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x76, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x4d, 0xff, 0x52, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x76, 0xff, 0x4d, 0xfd, 0x6e, 0x88, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x20, 0x6d, 0xdd, 0x6e, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x76, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x72, 0xff, 0xbb, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x96, 0xff, 0x4d, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x52, 0xff, 0x72, 0xff, 0x96, 0xff, 0x76, 0xff, 0x52, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x72, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x72, 0xff, 0x6d, 0xed, 0x92, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0x6d, 0xb4, 0x4d, 0xff, 0x77, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x77, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x96, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xb7, 0xff, 0x4d, 0xff, 0x76, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6d, 0xff, 0x4d, 0xff, 0x49, 0xf6, 0x69, 0xcd, 0x6d, 0xba, 0x6d, 0xfc, 0x72, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x77, 0xff, 0x76, 0xff, 0x6d, 0xfd, 0x6d, 0xa3, 0xdb, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x6b, 0x6d, 0xf9, 0x72, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x97, 0xff, 0x6e, 0xff, 0x6d, 0xf4, 0x8e, 0xa4, 0x6d, 0xb0, 0x69, 0xdc, 0x69, 0xf5, 0x6d, 0xfd, 0x6d, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x96, 0xff, 0x97, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0x6d, 0xff, 0x72, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x6e, 0xff, 0x6d, 0xfd, 0x69, 0xe2, 0x6e, 0x9f, 0x8e, 0x53, 0xd6, 0x17, 0xb6, 0x21, 0x6d, 0xd3, 0x6e, 0xff, 0x76, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x4d, 0xff, 0x6d, 0xdb, 0xb6, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x21, 0x6d, 0xda, 0x72, 0xff, 0x77, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x72, 0xff, 0x6d, 0xfe, 0x6d, 0xab, 0xd7, 0x12, 0xd7, 0x09, 0xb2, 0x19, 0x8e, 0x49, 0x6d, 0x72, 0x69, 0xa3, 0x6d, 0xbd, 0x6d, 0xd2, 0x6d, 0xe3, 0x6d, 0xed, 0x6d, 0xf3, 0x6d, 0xf6, 0x6d, 0xf9, 0x6d, 0xfb, 0x6d, 0xfc, 0x6d, 0xfc, 0x6d, 0xfd, 0x4e, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x4d, 0xff, 0x8e, 0xc1, 0xd6, 0x27, 0xdb, 0x05, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x8e, 0x61, 0x6d, 0xf2, 0x6e, 0xff, 0x92, 0xff, 0x97, 0xff, 0x76, 0xff, 0x4e, 0xff, 0x69, 0xef, 0x6e, 0x66, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x03, 0x6d, 0x78, 0x6d, 0xf8, 0x72, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x72, 0xff, 0x4d, 0xff, 0x69, 0xdc, 0x92, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xd7, 0x08, 0x92, 0x10, 0x8e, 0x27, 0x8e, 0x37, 0x8e, 0x41, 0x6d, 0x49, 0x6d, 0x50, 0x6d, 0x59, 0x6d, 0x63, 0x8e, 0x6c, 0x8e, 0x8f, 0x6e, 0xf1, 0x72, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x49, 0xfc, 0x8e, 0x7e, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x07, 0x6d, 0x77, 0x6d, 0xe8, 0x6d, 0xfd, 0x6d, 0xff, 0x4d, 0xfd, 0x6d, 0xe3, 0x6d, 0x73, 0xd7, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x14, 0x6d, 0xa9, 0x6d, 0xf9, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x4d, 0xff, 0x69, 0xdd, 0x8e, 0x4a, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xdb, 0x09, 0x6e, 0x97, 0x6e, 0xfc, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x72, 0xff, 0x49, 0xf4, 0x8e, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x05, 0x8d, 0x33, 0x6d, 0x77, 0x6d, 0x93, 0x6d, 0x78, 0x6e, 0x35, 0xd7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x16, 0x6d, 0x87, 0x6d, 0xe0, 0x6d, 0xf5, 0x6d, 0xf0, 0x6d, 0xba, 0x8e, 0x3d, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x23, 0x6d, 0xce, 0x6e, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x4d, 0xff, 0x69, 0xd3, 0xb2, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x01, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x05, 0x92, 0x26, 0x6e, 0x40, 0x6e, 0x3a, 0xb2, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x8e, 0x4c, 0x6d, 0xe4, 0x6e, 0xff, 0x76, 0xff, 0x77, 0xff, 0x77, 0xff, 0x76, 0xff, 0x4e, 0xff, 0x49, 0xf7, 0x6e, 0x70, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x02, 0x8e, 0x4e, 0x6d, 0xda, 0x6d, 0xfd, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xff, 0x6d, 0xf8, 0x6d, 0x9d, 0xdb, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x92, 0x29, 0x6d, 0x8c, 0x6d, 0xc4, 0x6d, 0xd0, 0x6d, 0xb8, 0x8e, 0x66, 0xb7, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xb6, 0x0c, 0xb6, 0x12, 0xd6, 0x08, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xff, 0xff, 0x05, 0x1c, 0xff, 0x08, 0x18, 0xe7, 0x08, 0x18, 0xe7, 0x08, 0xfb, 0xfe, 0x07, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x02, 0xd5, 0xcd, 0x12, 0xb2, 0xac, 0x2d, 0xef, 0x8b, 0x5a, 0x2c, 0x73, 0x70, 0x2c, 0x73, 0x87, 0xeb, 0x6a, 0xab, 0xaa, 0x62, 0xbb, 0xca, 0x62, 0xbf, 0xea, 0x62, 0xbe, 0x0b, 0x63, 0xb6, 0x0b, 0x6b, 0xa7, 0x0c, 0x73, 0x86, 0x2c, 0x73, 0x68, 0xae, 0x8b, 0x49, 0x71, 0xa4, 0x1f, 0xd4, 0xbd, 0x0b, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xf5, 0xbd, 0x0f, 0xed, 0x83, 0x45, 0xca, 0x62, 0x93, 0xa9, 0x62, 0xcf, 0xaa, 0x5a, 0xf0, 0xca, 0x5a, 0xf8, 0xcb, 0x5a, 0xfc, 0xeb, 0x52, 0xfe, 0x2c, 0x53, 0xff, 0x4d, 0x53, 0xff, 0x8d, 0x53, 0xff, 0xad, 0x53, 0xff, 0x8d, 0x53, 0xff, 0x6d, 0x53, 0xff, 0x2c, 0x53, 0xfe, 0xeb, 0x52, 0xfa, 0xcb, 0x5a, 0xf4, 0xaa, 0x5a, 0xe6, 0xcb, 0x62, 0xbd, 0xeb, 0x6a, 0x82, 0xad, 0x83, 0x41, 0x53, 0xb5, 0x14, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x75, 0xbd, 0x18, 0x6d, 0x83, 0x67, 0xcb, 0x62, 0xbf, 0x89, 0x52, 0xf1, 0x89, 0x4a, 0xfd, 0xaa, 0x42, 0xff, 0xae, 0x4b, 0xff, 0xd2, 0x5c, 0xff, 0xb6, 0x6d, 0xff, 0x38, 0x76, 0xff, 0x99, 0x7e, 0xff, 0xba, 0x7e, 0xff, 0xda, 0x7e, 0xff, 0xfa, 0x76, 0xff, 0xda, 0x76, 0xff, 0xb9, 0x76, 0xff, 0x78, 0x76, 0xff, 0xf6, 0x6d, 0xff, 0x13, 0x5d, 0xff, 0x0f, 0x4c, 0xff, 0xeb, 0x42, 0xff, 0xca, 0x4a, 0xfc, 0xca, 0x5a, 0xf2, 0xeb, 0x62, 0xc8, 0x8e, 0x7b, 0x7e, 0xb3, 0xa4, 0x30, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xc5, 0x10, 0xae, 0x83, 0x61, 0x48, 0x52, 0xd2, 0xca, 0x5a, 0xf8, 0x0b, 0x4b, 0xff, 0x30, 0x54, 0xff, 0xb6, 0x75, 0xff, 0x9a, 0x86, 0xff, 0x1b, 0x7f, 0xff, 0x1b, 0x6f, 0xff, 0x3b, 0x6f, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x3b, 0x6f, 0xff, 0x1b, 0x77, 0xff, 0xda, 0x7e, 0xff, 0xf7, 0x75, 0xff, 0x91, 0x5c, 0xff, 0x6d, 0x4b, 0xff, 0x2c, 0x5b, 0xfc, 0xeb, 0x5a, 0xe6, 0xeb, 0x62, 0xa4, 0x91, 0x9c, 0x3f, 0x59, 0xe6, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x91, 0xa4, 0x36, 0xeb, 0x62, 0xb1, 0x89, 0x4a, 0xf7, 0xea, 0x42, 0xff, 0xb1, 0x5c, 0xff, 0x58, 0x76, 0xff, 0xfa, 0x76, 0xff, 0x1c, 0x77, 0xff, 0x1c, 0x6f, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x1c, 0x6f, 0xff, 0x1b, 0x77, 0xff, 0xba, 0x7e, 0xff, 0x95, 0x75, 0xff, 0xef, 0x53, 0xff, 0x0b, 0x53, 0xfe, 0xca, 0x5a, 0xee, 0x8d, 0x7b, 0xa5, 0xd2, 0xa4, 0x36, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xde, 0x07, 0x0f, 0x8c, 0x5d, 0x89, 0x5a, 0xe0, 0xca, 0x4a, 0xfe, 0x2f, 0x54, 0xff, 0x58, 0x7e, 0xff, 0xfb, 0x7e, 0xff, 0x1b, 0x6f, 0xff, 0x1b, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x77, 0xff, 0x5c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x77, 0xff, 0xfb, 0x86, 0xff, 0xd7, 0x7d, 0xff, 0xef, 0x5b, 0xff, 0x2b, 0x5b, 0xfe, 0x0b, 0x63, 0xe5, 0x8d, 0x7b, 0x85, 0x37, 0xd6, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xc6, 0x10, 0x4c, 0x73, 0x88, 0xaa, 0x52, 0xf1, 0x0c, 0x4b, 0xff, 0x54, 0x6d, 0xff, 0x1b, 0x8f, 0xff, 0x1b, 0x77, 0xff, 0x3b, 0x77, 0xff, 0x5c, 0x7f, 0xff, 0x9d, 0x8f, 0xff, 0xbd, 0x8f, 0xff, 0xbd, 0x97, 0xff, 0xbd, 0x87, 0xff, 0x5c, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x6f, 0xff, 0x3c, 0x77, 0xff, 0xda, 0x86, 0xff, 0x54, 0x75, 0xff, 0x6d, 0x53, 0xff, 0xcb, 0x5a, 0xfa, 0xeb, 0x6a, 0xbd, 0x92, 0x9c, 0x32, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xc6, 0x15, 0xeb, 0x62, 0x9b, 0x89, 0x4a, 0xf9, 0x4c, 0x4b, 0xff, 0x17, 0x76, 0xff, 0x1b, 0x7f, 0xff, 0x3b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x9d, 0x87, 0xff, 0xbd, 0x97, 0xff, 0x9d, 0x9f, 0xff, 0x9c, 0x9f, 0xff, 0x9c, 0x9f, 0xff, 0xbd, 0x97, 0xff, 0x9d, 0x87, 0xff, 0x3b, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0xfb, 0x76, 0xff, 0x58, 0x7e, 0xff, 0x50, 0x5c, 0xff, 0xcb, 0x52, 0xfe, 0xaa, 0x5a, 0xd8, 0x70, 0x9c, 0x4e, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xbd, 0x12, 0x8a, 0x5a, 0xa5, 0x89, 0x4a, 0xfa, 0xae, 0x43, 0xff, 0x78, 0x7e, 0xff, 0x1b, 0x6f, 0xff, 0x3c, 0x6f, 0xff, 0x3c, 0x6f, 0xff, 0x9d, 0x7f, 0xff, 0xbd, 0x97, 0xff, 0x9c, 0xa7, 0xff, 0x9c, 0xa7, 0xff, 0x9c, 0xa7, 0xff, 0x9c, 0xa7, 0xff, 0x9d, 0x9f, 0xff, 0x9d, 0x87, 0xff, 0x3b, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x67, 0xff, 0xda, 0x7e, 0xff, 0x13, 0x65, 0xff, 0x0b, 0x4b, 0xff, 0xca, 0x5a, 0xe9, 0x0f, 0x84, 0x61, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xce, 0x0d, 0xeb, 0x6a, 0x95, 0x69, 0x4a, 0xfa, 0x8d, 0x43, 0xff, 0x99, 0x76, 0xff, 0x1b, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x6f, 0xff, 0xbd, 0x97, 0xff, 0x9d, 0x9f, 0xff, 0x7c, 0xa7, 0xff, 0x7c, 0xa7, 0xff, 0x9c, 0xa7, 0xff, 0x9c, 0x9f, 0xff, 0xbd, 0x97, 0xff, 0x5c, 0x77, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x1b, 0x7f, 0xff, 0x75, 0x65, 0xff, 0x2c, 0x4b, 0xff, 0xeb, 0x5a, 0xe9, 0x71, 0x94, 0x56, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xfe, 0x05, 0x0c, 0x6b, 0x7e, 0x69, 0x52, 0xf7, 0x4c, 0x43, 0xff, 0x78, 0x76, 0xff, 0x1b, 0x6f, 0xff, 0x3d, 0x5f, 0xff, 0x5d, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x6f, 0xff, 0xbd, 0x8f, 0xff, 0x9c, 0x9f, 0xff, 0x9c, 0xa7, 0xff, 0x9c, 0xa7, 0xff, 0x9d, 0x9f, 0xff, 0xbd, 0x97, 0xff, 0x7d, 0x87, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x1b, 0x77, 0xff, 0x95, 0x6d, 0xff, 0x4c, 0x53, 0xff, 0xeb, 0x62, 0xde, 0x71, 0x9c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0xef, 0x8b, 0x4e, 0xaa, 0x5a, 0xec, 0x0b, 0x43, 0xff, 0x57, 0x76, 0xff, 0x3b, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x3d, 0x5f, 0xff, 0x5d, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0xbd, 0x87, 0xff, 0xbd, 0x97, 0xff, 0x9d, 0x97, 0xff, 0xbd, 0x97, 0xff, 0xbd, 0x8f, 0xff, 0x7c, 0x7f, 0xff, 0x3c, 0x6f, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x1b, 0x7f, 0xff, 0x34, 0x6d, 0xff, 0x2c, 0x5b, 0xfe, 0x2c, 0x73, 0xc3, 0x75, 0xc5, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x8b, 0x37, 0xa9, 0x5a, 0xdb, 0x0b, 0x4b, 0xff, 0x37, 0x7e, 0xff, 0x3b, 0x77, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x57, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x6f, 0xff, 0x7d, 0x7f, 0xff, 0x7d, 0x7f, 0xff, 0x7c, 0x7f, 0xff, 0x5b, 0x6f, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x6f, 0xff, 0xdb, 0x86, 0xff, 0x91, 0x64, 0xff, 0xeb, 0x5a, 0xfc, 0x0b, 0x6b, 0x97, 0x59, 0xce, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xb5, 0x10, 0xa9, 0x62, 0xb2, 0xea, 0x4a, 0xfd, 0x75, 0x75, 0xff, 0x1b, 0x7f, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x57, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x57, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x6f, 0xff, 0x99, 0x86, 0xff, 0x6d, 0x53, 0xff, 0xca, 0x5a, 0xf1, 0x50, 0x94, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x0b, 0x6b, 0x72, 0xa9, 0x52, 0xf7, 0x71, 0x5c, 0xff, 0x1b, 0x87, 0xff, 0x5c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x57, 0xff, 0x7d, 0x57, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0xfb, 0x76, 0xff, 0xd7, 0x7d, 0xff, 0xeb, 0x52, 0xff, 0xeb, 0x6a, 0xbe, 0x38, 0xd6, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x83, 0x2d, 0xaa, 0x4a, 0xdf, 0x8d, 0x4b, 0xff, 0xb9, 0x86, 0xff, 0x3b, 0x77, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x57, 0xff, 0x7c, 0x57, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x57, 0xff, 0x3c, 0x67, 0xff, 0xdb, 0x7e, 0xff, 0x50, 0x5c, 0xff, 0xca, 0x5a, 0xf5, 0x8d, 0x7b, 0x61, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xdd, 0x06, 0xca, 0x5a, 0x98, 0xca, 0x42, 0xfd, 0xb6, 0x75, 0xff, 0x3b, 0x77, 0xff, 0x7c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x57, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x77, 0xff, 0x38, 0x76, 0xff, 0x0b, 0x4b, 0xff, 0x0b, 0x6b, 0xc0, 0x96, 0xb5, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x73, 0x47, 0x89, 0x52, 0xeb, 0xef, 0x53, 0xff, 0xfa, 0x7e, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x1a, 0x7f, 0xff, 0x50, 0x5c, 0xff, 0x0b, 0x63, 0xf4, 0x0f, 0x84, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xce, 0x09, 0x48, 0x5a, 0xae, 0xaa, 0x4a, 0xfe, 0xf6, 0x6d, 0xff, 0x3b, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x7c, 0x57, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1b, 0x6f, 0xff, 0x17, 0x7e, 0xff, 0x2c, 0x5b, 0xfe, 0x6c, 0x73, 0xa3, 0x7a, 0xd6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x83, 0x34, 0x69, 0x52, 0xeb, 0xae, 0x4b, 0xff, 0xfa, 0x7e, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x57, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x3c, 0x67, 0xff, 0xda, 0x86, 0xff, 0x0f, 0x5c, 0xff, 0x0b, 0x63, 0xe4, 0xb2, 0xa4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0xca, 0x62, 0x8d, 0x89, 0x42, 0xfd, 0xb6, 0x6d, 0xff, 0x1b, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1b, 0x77, 0xff, 0x54, 0x6d, 0xff, 0x2b, 0x5b, 0xf9, 0x6c, 0x73, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x94, 0x20, 0xaa, 0x5a, 0xd9, 0xae, 0x4b, 0xff, 0xda, 0x7e, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x57, 0xff, 0x7c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0x3b, 0x77, 0xff, 0x1b, 0x6f, 0xff, 0x5b, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x6f, 0xff, 0x79, 0x7e, 0xff, 0x4c, 0x53, 0xff, 0x0b, 0x63, 0xac, 0xbb, 0xfe, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x62, 0x6a, 0xeb, 0x52, 0xf8, 0x33, 0x65, 0xff, 0x3c, 0x77, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x7c, 0x57, 0xff, 0x5b, 0x5f, 0xff, 0xfa, 0x76, 0xff, 0x17, 0x76, 0xff, 0x13, 0x5d, 0xff, 0x95, 0x65, 0xff, 0xda, 0x7e, 0xff, 0x3b, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0xdb, 0x7e, 0xff, 0x0f, 0x54, 0xff, 0xea, 0x62, 0xdd, 0xd2, 0xac, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xad, 0x09, 0xca, 0x5a, 0xb5, 0xeb, 0x42, 0xfe, 0x98, 0x7e, 0xff, 0x3c, 0x6f, 0xff, 0x5d, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1b, 0x6f, 0xff, 0x54, 0x65, 0xff, 0x89, 0x3a, 0xff, 0x89, 0x4a, 0xff, 0xaa, 0x42, 0xff, 0x70, 0x5c, 0xff, 0xfa, 0x7e, 0xff, 0x3c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x1b, 0x77, 0xff, 0x99, 0x76, 0xff, 0x78, 0x76, 0xff, 0x1b, 0x77, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1b, 0x6f, 0xff, 0x34, 0x65, 0xff, 0xca, 0x52, 0xf7, 0x6d, 0x7b, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x94, 0x2a, 0xa9, 0x52, 0xeb, 0xce, 0x4b, 0xff, 0x1b, 0x7f, 0xff, 0x5c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0xba, 0x7e, 0xff, 0x0b, 0x43, 0xff, 0x89, 0x5a, 0xff, 0x68, 0x62, 0xff, 0x89, 0x5a, 0xff, 0xeb, 0x4a, 0xff, 0x58, 0x76, 0xff, 0x1b, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0xfa, 0x7e, 0xff, 0xd2, 0x54, 0xff, 0x4c, 0x43, 0xff, 0x2c, 0x4b, 0xff, 0x30, 0x54, 0xff, 0xba, 0x76, 0xff, 0x3c, 0x6f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x17, 0x76, 0xff, 0xca, 0x52, 0xfd, 0xeb, 0x6a, 0x96, 0xf5, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x7b, 0x71, 0xa9, 0x4a, 0xfc, 0x75, 0x6d, 0xff, 0x3b, 0x6f, 0xff, 0x7c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x3b, 0x6f, 0xff, 0x18, 0x76, 0xff, 0x89, 0x4a, 0xff, 0x69, 0x62, 0xff, 0x48, 0x6a, 0xff, 0x89, 0x62, 0xff, 0xaa, 0x5a, 0xff, 0x94, 0x6d, 0xff, 0x3b, 0x6f, 0xff, 0x5d, 0x5f, 0xff, 0x3d, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x7c, 0x57, 0xff, 0x9c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x3c, 0x77, 0xff, 0x33, 0x65, 0xff, 0x0b, 0x4b, 0xff, 0x89, 0x62, 0xff, 0x89, 0x62, 0xff, 0xaa, 0x4a, 0xff, 0x70, 0x54, 0xff, 0xfa, 0x7e, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x79, 0x76, 0xff, 0x2b, 0x4b, 0xff, 0xaa, 0x62, 0xc5, 0x75, 0xbd, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xde, 0x07, 0xa9, 0x5a, 0xb3, 0xaa, 0x42, 0xff, 0x38, 0x7e, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x3b, 0x6f, 0xff, 0x38, 0x76, 0xff, 0xa9, 0x42, 0xff, 0x69, 0x62, 0xff, 0x89, 0x6a, 0xff, 0xa9, 0x62, 0xff, 0xca, 0x52, 0xff, 0x95, 0x6d, 0xff, 0x3c, 0x6f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3b, 0x67, 0xff, 0x1b, 0x6f, 0xff, 0xfb, 0x76, 0xff, 0xdb, 0x76, 0xff, 0xfb, 0x7e, 0xff, 0x1b, 0x77, 0xff, 0x3b, 0x6f, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x67, 0xff, 0xfb, 0x7e, 0xff, 0x8d, 0x4b, 0xff, 0xaa, 0x62, 0xff, 0x48, 0x6a, 0xff, 0x48, 0x6a, 0xff, 0x89, 0x62, 0xff, 0x0c, 0x43, 0xff, 0x99, 0x7e, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0xda, 0x76, 0xff, 0xae, 0x53, 0xff, 0x69, 0x52, 0xe6, 0x14, 0xad, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xbd, 0x1a, 0x48, 0x4a, 0xe5, 0x8d, 0x4b, 0xff, 0xda, 0x7e, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0xba, 0x7e, 0xff, 0x6c, 0x4b, 0xff, 0xaa, 0x62, 0xff, 0x89, 0x6a, 0xff, 0xaa, 0x5a, 0xff, 0x2b, 0x4b, 0xff, 0x58, 0x7e, 0xff, 0x1b, 0x77, 0xff, 0x1c, 0x6f, 0xff, 0xfb, 0x76, 0xff, 0xda, 0x7e, 0xff, 0x54, 0x5d, 0xff, 0x10, 0x4c, 0xff, 0xce, 0x4b, 0xff, 0xef, 0x4b, 0xff, 0x50, 0x54, 0xff, 0xb6, 0x6d, 0xff, 0xda, 0x7e, 0xff, 0x1b, 0x7f, 0xff, 0x3c, 0x77, 0xff, 0x3c, 0x6f, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x7c, 0x67, 0xff, 0x5c, 0x6f, 0xff, 0x99, 0x7e, 0xff, 0x4c, 0x4b, 0xff, 0x8a, 0x62, 0xff, 0x68, 0x72, 0xff, 0x68, 0x6a, 0xff, 0x69, 0x62, 0xff, 0xeb, 0x42, 0xff, 0x58, 0x6e, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x57, 0xff, 0x5d, 0x5f, 0xff, 0xfa, 0x76, 0xff, 0x70, 0x5c, 0xff, 0xca, 0x5a, 0xf7, 0x0f, 0x8c, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xfb, 0xde, 0x07, 0x18, 0xe6, 0x08, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0xae, 0x7b, 0x5e, 0x69, 0x4a, 0xfa, 0xd3, 0x64, 0xff, 0xfb, 0x76, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x1c, 0x77, 0xff, 0xd6, 0x75, 0xff, 0x4c, 0x4b, 0xff, 0xcb, 0x52, 0xff, 0x0b, 0x4b, 0xff, 0x13, 0x75, 0xff, 0xda, 0x96, 0xff, 0x99, 0x7e, 0xff, 0xb6, 0x6d, 0xff, 0xb2, 0x5c, 0xff, 0x0f, 0x54, 0xff, 0xca, 0x42, 0xff, 0xaa, 0x52, 0xff, 0xa9, 0x5a, 0xff, 0xaa, 0x5a, 0xff, 0xca, 0x5a, 0xff, 0x0b, 0x53, 0xff, 0xd2, 0x6c, 0xff, 0x34, 0x6d, 0xff, 0x74, 0x65, 0xff, 0x37, 0x6e, 0xff, 0xba, 0x7e, 0xff, 0x1c, 0x77, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x6f, 0xff, 0xfb, 0x7e, 0xff, 0xce, 0x43, 0xff, 0xaa, 0x5a, 0xff, 0x48, 0x6a, 0xff, 0x68, 0x62, 0xff, 0xaa, 0x5a, 0xff, 0x6d, 0x43, 0xff, 0xb9, 0x6e, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0xfb, 0x6e, 0xff, 0x54, 0x6d, 0xff, 0x0b, 0x5b, 0xfe, 0x4c, 0x7b, 0xa7, 0x7a, 0xee, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x83, 0x2a, 0xa9, 0x5a, 0x90, 0xca, 0x62, 0xa8, 0x2b, 0x73, 0x91, 0xce, 0x83, 0x5c, 0xeb, 0x6a, 0xbd, 0x69, 0x4a, 0xff, 0xb6, 0x75, 0xff, 0x1b, 0x67, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x6f, 0xff, 0x3c, 0x7f, 0xff, 0x99, 0x76, 0xff, 0xd6, 0x6d, 0xff, 0x17, 0x7e, 0xff, 0xb9, 0x8e, 0xff, 0x74, 0x75, 0xff, 0xad, 0x43, 0xff, 0x89, 0x32, 0xff, 0x4c, 0x63, 0xff, 0x71, 0x8c, 0xff, 0x48, 0x52, 0xff, 0x88, 0x62, 0xff, 0x68, 0x6a, 0xff, 0x89, 0x6a, 0xff, 0xa9, 0x6a, 0xff, 0xea, 0x62, 0xff, 0x91, 0x8c, 0xff, 0x91, 0x8c, 0xff, 0x4c, 0x53, 0xff, 0x4c, 0x4b, 0xff, 0xee, 0x53, 0xff, 0x34, 0x65, 0xff, 0xda, 0x76, 0xff, 0x3b, 0x6f, 0xff, 0x3b, 0x77, 0xff, 0xd6, 0x6d, 0xff, 0xaa, 0x32, 0xff, 0x8a, 0x52, 0xff, 0x69, 0x4a, 0xff, 0x8a, 0x3a, 0xff, 0x54, 0x5d, 0xff, 0x1b, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x6f, 0xff, 0x17, 0x7e, 0xff, 0x2c, 0x5b, 0xff, 0xea, 0x72, 0xf6, 0x8d, 0x83, 0x70, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xc6, 0x08, 0x4f, 0x94, 0x26, 0xef, 0x8b, 0x4c, 0x6c, 0x7b, 0x6a, 0x4c, 0x73, 0x9a, 0x89, 0x62, 0xf8, 0xaa, 0x4a, 0xff, 0xb6, 0x6d, 0xff, 0x1b, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x6f, 0xff, 0x1a, 0x77, 0xff, 0xb9, 0x86, 0xff, 0xd2, 0x64, 0xff, 0x4c, 0x53, 0xff, 0x54, 0xa5, 0xff, 0xfa, 0xd6, 0xff, 0x7c, 0xe7, 0xff, 0x7b, 0xe7, 0xff, 0x37, 0xce, 0xff, 0xea, 0x62, 0xff, 0xa9, 0x62, 0xff, 0xa9, 0x6a, 0xff, 0xea, 0x6a, 0xff, 0x74, 0xb5, 0xff, 0x9c, 0xef, 0xff, 0x9c, 0xef, 0xff, 0x7c, 0xef, 0xff, 0xf9, 0xd6, 0xff, 0x74, 0xa5, 0xff, 0xad, 0x5b, 0xff, 0x8d, 0x43, 0xff, 0xd6, 0x6d, 0xff, 0x1b, 0x7f, 0xff, 0x1b, 0x7f, 0xff, 0x37, 0x6e, 0xff, 0x92, 0x54, 0xff, 0x51, 0x54, 0xff, 0xb6, 0x65, 0xff, 0x1b, 0x77, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0xba, 0x86, 0xff, 0x4d, 0x5b, 0xff, 0xea, 0x72, 0xff, 0xca, 0x6a, 0xec, 0x10, 0x94, 0x4d, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xb5, 0x38, 0xca, 0x62, 0xf4, 0x0b, 0x4b, 0xff, 0x95, 0x5d, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0xfb, 0x7e, 0xff, 0xd2, 0x64, 0xff, 0x6c, 0x5b, 0xff, 0x78, 0xce, 0xff, 0x7b, 0xef, 0xff, 0x5b, 0xe7, 0xff, 0x7b, 0xdf, 0xff, 0x5a, 0xd7, 0xff, 0x7b, 0xe7, 0xff, 0xd9, 0xd6, 0xff, 0x70, 0x8c, 0xff, 0x4f, 0x8c, 0xff, 0x98, 0xce, 0xff, 0x9c, 0xe7, 0xff, 0x9b, 0xdf, 0xff, 0x9b, 0xdf, 0xff, 0x9b, 0xe7, 0xff, 0x9b, 0xe7, 0xff, 0x9b, 0xe7, 0xff, 0xd8, 0xce, 0xff, 0x50, 0x84, 0xff, 0xeb, 0x42, 0xff, 0x54, 0x6d, 0xff, 0x1b, 0x77, 0xff, 0x3b, 0x6f, 0xff, 0x1c, 0x77, 0xff, 0x1c, 0x77, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0x3b, 0x6f, 0xff, 0x3b, 0x6f, 0xff, 0x3b, 0x6f, 0xff, 0x3b, 0x6f, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0xba, 0x7e, 0xff, 0xae, 0x5b, 0xff, 0xeb, 0x6a, 0xff, 0x0c, 0x73, 0xff, 0xeb, 0x6a, 0xce, 0xf3, 0xa4, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xbb, 0xde, 0x06, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x9c, 0x4e, 0xaa, 0x5a, 0xfa, 0xb2, 0x64, 0xff, 0xfb, 0x7e, 0xff, 0x3b, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x1b, 0x6f, 0xff, 0xfb, 0x7e, 0xff, 0xd7, 0x7d, 0xff, 0x0b, 0x4b, 0xff, 0x37, 0xc6, 0xff, 0x9b, 0xe7, 0xff, 0x5a, 0xdf, 0xff, 0x7b, 0xdf, 0xff, 0x7b, 0xd7, 0xff, 0x7b, 0xd7, 0xff, 0x9b, 0xdf, 0xff, 0x7b, 0xdf, 0xff, 0x9b, 0xe7, 0xff, 0x7b, 0xe7, 0xff, 0x7b, 0xe7, 0xff, 0x7b, 0xdf, 0xff, 0x7b, 0xdf, 0xff, 0x7b, 0xd7, 0xff, 0x7b, 0xd7, 0xff, 0x9b, 0xdf, 0xff, 0x9a, 0xdf, 0xff, 0x5a, 0xdf, 0xff, 0x1a, 0xdf, 0xff, 0x90, 0x84, 0xff, 0x0b, 0x43, 0xff, 0x17, 0x6e, 0xff, 0x1b, 0x77, 0xff, 0x5c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x1b, 0x67, 0xff, 0x58, 0x66, 0xff, 0xb6, 0x65, 0xff, 0x54, 0x65, 0xff, 0xf2, 0x54, 0xff, 0xb1, 0x4c, 0xff, 0xb2, 0x4c, 0xff, 0x75, 0x55, 0xff, 0x1b, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0xfa, 0x7e, 0xff, 0x10, 0x5c, 0xff, 0x0c, 0x5b, 0xff, 0x71, 0x84, 0xff, 0x2c, 0x6b, 0xfd, 0x0b, 0x73, 0xa4, 0x18, 0xe7, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xd1, 0xa4, 0x22, 0xca, 0x6a, 0x7c, 0xaa, 0x6a, 0xb0, 0xca, 0x6a, 0x99, 0x0f, 0x8c, 0x38, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0xee, 0x8b, 0x7d, 0xaa, 0x52, 0xfe, 0x34, 0x6d, 0xff, 0x1b, 0x7f, 0xff, 0x3c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1c, 0x6f, 0xff, 0xba, 0x76, 0xff, 0xd7, 0x75, 0xff, 0x34, 0x75, 0xff, 0x6d, 0x53, 0xff, 0x50, 0x84, 0xff, 0xd9, 0xd6, 0xff, 0x9b, 0xe7, 0xff, 0x9b, 0xdf, 0xff, 0x7b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x7b, 0xd7, 0xff, 0x7b, 0xd7, 0xff, 0x9b, 0xdf, 0xff, 0x7b, 0xdf, 0xff, 0x7b, 0xdf, 0xff, 0x7b, 0xdf, 0xff, 0x7b, 0xdf, 0xff, 0x7b, 0xd7, 0xff, 0x7b, 0xd7, 0xff, 0x7b, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x9a, 0xd7, 0xff, 0x7a, 0xdf, 0xff, 0x3a, 0xdf, 0xff, 0xfa, 0xde, 0xff, 0xae, 0x73, 0xff, 0x50, 0x5c, 0xff, 0xda, 0x96, 0xff, 0x1b, 0x7f, 0xff, 0x3b, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0xba, 0x66, 0xff, 0xcf, 0x2b, 0xff, 0xf0, 0x3b, 0xff, 0x30, 0x44, 0xff, 0x51, 0x4c, 0xff, 0x51, 0x4c, 0xff, 0x72, 0x4c, 0xff, 0xb2, 0x44, 0xff, 0x1b, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0xda, 0x76, 0xff, 0x30, 0x5c, 0xff, 0x4c, 0x53, 0xff, 0x95, 0x95, 0xff, 0xce, 0x63, 0xff, 0xcb, 0x62, 0xf3, 0xef, 0x8b, 0x59, 0xff, 0xff, 0x01, 0x75, 0xfd, 0x03, 0x6d, 0x83, 0x52, 0xa9, 0x5a, 0xd6, 0xca, 0x52, 0xfc, 0xeb, 0x52, 0xff, 0xeb, 0x5a, 0xfe, 0xaa, 0x62, 0xd6, 0x50, 0x9c, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x04, 0x75, 0xbd, 0x2a, 0xee, 0x8b, 0x64, 0xca, 0x6a, 0xd7, 0xab, 0x52, 0xff, 0xae, 0x3b, 0xff, 0xba, 0x66, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x18, 0x56, 0xff, 0x10, 0x2c, 0xff, 0xef, 0x4b, 0xff, 0x8e, 0x5b, 0xff, 0xaa, 0x52, 0xff, 0x2b, 0x63, 0xff, 0x8f, 0x84, 0xff, 0x9b, 0xdf, 0xff, 0x7b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x7b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x7b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x9c, 0xdf, 0xff, 0x9b, 0xdf, 0xff, 0x7b, 0xd7, 0xff, 0x7b, 0xdf, 0xff, 0x7b, 0xdf, 0xff, 0x7a, 0xd7, 0xff, 0x9a, 0xd7, 0xff, 0x9a, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x5a, 0xdf, 0xff, 0x37, 0xc6, 0xff, 0xef, 0x83, 0xff, 0x0b, 0x5b, 0xff, 0x30, 0x64, 0xff, 0xf3, 0x64, 0xff, 0xb6, 0x65, 0xff, 0xba, 0x6e, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x1c, 0x6f, 0xff, 0xfb, 0x76, 0xff, 0x1b, 0x77, 0xff, 0x1b, 0x77, 0xff, 0x1c, 0x77, 0xff, 0x3c, 0x77, 0xff, 0x5c, 0x77, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0xfa, 0x76, 0xff, 0x50, 0x54, 0xff, 0x4c, 0x43, 0xff, 0xf6, 0x85, 0xff, 0xd6, 0x85, 0xff, 0xeb, 0x52, 0xff, 0xcb, 0x62, 0xcc, 0xb6, 0xbd, 0x1f, 0xce, 0x8b, 0x45, 0xaa, 0x62, 0xe3, 0xca, 0x42, 0xff, 0x13, 0x65, 0xff, 0x17, 0x7e, 0xff, 0xf2, 0x6c, 0xff, 0xca, 0x52, 0xfd, 0xeb, 0x6a, 0x8f, 0x75, 0xfd, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xb5, 0x16, 0x6d, 0x73, 0x88, 0xca, 0x6a, 0xbe, 0x2b, 0x73, 0x8f, 0xcb, 0x6a, 0xde, 0xeb, 0x4a, 0xff, 0x58, 0x7e, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x1c, 0x67, 0xff, 0xdb, 0x6e, 0xff, 0xb9, 0x86, 0xff, 0x74, 0x85, 0xff, 0xea, 0x52, 0xff, 0x78, 0xce, 0xff, 0x3a, 0xdf, 0xff, 0x7b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x7b, 0xd7, 0xff, 0x7b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x7b, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x7a, 0xdf, 0xff, 0x32, 0x9d, 0xff, 0xd2, 0x9c, 0xff, 0xea, 0x62, 0xff, 0xce, 0x63, 0xff, 0xb2, 0x64, 0xff, 0x10, 0x3c, 0xff, 0x51, 0x34, 0xff, 0x1b, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0xda, 0x76, 0xff, 0x30, 0x4c, 0xff, 0x6d, 0x3b, 0xff, 0xf7, 0x75, 0xff, 0xd9, 0x7e, 0xff, 0xb2, 0x5c, 0xff, 0x8a, 0x52, 0xfc, 0x2c, 0x7b, 0xa7, 0x89, 0x62, 0xd9, 0xaa, 0x4a, 0xff, 0x74, 0x6d, 0xff, 0x1a, 0x7f, 0xff, 0x1b, 0x77, 0xff, 0x98, 0x7e, 0xff, 0x6d, 0x4b, 0xff, 0xaa, 0x5a, 0xce, 0xd7, 0xcd, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x6b, 0x3e, 0xeb, 0x62, 0x6a, 0x70, 0x9c, 0x25, 0x57, 0xce, 0x12, 0x0b, 0x63, 0xcf, 0x8e, 0x53, 0xff, 0xfb, 0x7e, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x5f, 0xff, 0xfa, 0x76, 0xff, 0x74, 0x75, 0xff, 0x0a, 0x53, 0xff, 0x57, 0xc6, 0xff, 0x1a, 0xd7, 0xff, 0x7b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x5b, 0xcf, 0xff, 0x3a, 0xc7, 0xff, 0xf9, 0xbe, 0xff, 0x5b, 0xcf, 0xff, 0x9b, 0xd7, 0xff, 0x9a, 0xd7, 0xff, 0x9a, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x7b, 0xdf, 0xff, 0x9b, 0xe7, 0xff, 0x7b, 0xef, 0xff, 0xce, 0x83, 0xff, 0xd2, 0x74, 0xff, 0x1b, 0x8f, 0xff, 0x3b, 0x7f, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x59, 0x66, 0xff, 0x79, 0x6e, 0xff, 0xdb, 0x76, 0xff, 0x3c, 0x77, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0xba, 0x76, 0xff, 0xef, 0x43, 0xff, 0xad, 0x3b, 0xff, 0x18, 0x66, 0xff, 0xda, 0x66, 0xff, 0x78, 0x76, 0xff, 0xeb, 0x42, 0xff, 0x69, 0x5a, 0xfe, 0x89, 0x52, 0xff, 0x30, 0x54, 0xff, 0xda, 0x7e, 0xff, 0x3c, 0x6f, 0xff, 0x3c, 0x67, 0xff, 0xda, 0x76, 0xff, 0x30, 0x5c, 0xff, 0x8a, 0x5a, 0xe7, 0x92, 0xa4, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xbd, 0x1a, 0xaa, 0x52, 0xe8, 0xef, 0x4b, 0xff, 0x1b, 0x7f, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5b, 0x5f, 0xff, 0xda, 0x6e, 0xff, 0x95, 0x7d, 0xff, 0xca, 0x52, 0xff, 0x6c, 0x6b, 0xff, 0x16, 0xae, 0xff, 0xbb, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x7c, 0xd7, 0xff, 0x5b, 0xcf, 0xff, 0xd9, 0xbe, 0xff, 0x78, 0xae, 0xff, 0x16, 0xa6, 0xff, 0xb9, 0xb6, 0xff, 0x1a, 0xc7, 0xff, 0x7b, 0xcf, 0xff, 0x9a, 0xd7, 0xff, 0x9a, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x7b, 0xdf, 0xff, 0x7b, 0xdf, 0xff, 0x7b, 0xdf, 0xff, 0x77, 0xc6, 0xff, 0x1a, 0xef, 0xff, 0xcf, 0x7b, 0xff, 0xd2, 0x64, 0xff, 0x1b, 0x7f, 0xff, 0x3b, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x6f, 0xff, 0x92, 0x3c, 0xff, 0x6e, 0x2b, 0xff, 0x10, 0x44, 0xff, 0x74, 0x5d, 0xff, 0xba, 0x76, 0xff, 0x3b, 0x77, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x1b, 0x5f, 0xff, 0x99, 0x6e, 0xff, 0xae, 0x43, 0xff, 0x0f, 0x4c, 0xff, 0x38, 0x5e, 0xff, 0xfa, 0x5e, 0xff, 0xfa, 0x76, 0xff, 0xd2, 0x64, 0xff, 0xcb, 0x52, 0xff, 0xca, 0x4a, 0xff, 0x17, 0x7e, 0xff, 0x1b, 0x6f, 0xff, 0x5d, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x1b, 0x77, 0xff, 0x91, 0x5c, 0xff, 0xeb, 0x62, 0xf0, 0x71, 0x9c, 0x38, 0xff, 0xff, 0x01, 0x9a, 0xd6, 0x0b, 0x96, 0xcd, 0x0d, 0x59, 0xe6, 0x09, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x9c, 0x24, 0xca, 0x52, 0xee, 0x91, 0x54, 0xff, 0x3b, 0x77, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5b, 0x67, 0xff, 0x1b, 0x77, 0xff, 0x38, 0x76, 0xff, 0xce, 0x53, 0xff, 0xeb, 0x5a, 0xff, 0x12, 0x9d, 0xff, 0x3b, 0xd7, 0xff, 0x5b, 0xc7, 0xff, 0x5b, 0xc7, 0xff, 0x5b, 0xc7, 0xff, 0x5a, 0xc7, 0xff, 0xf9, 0xbe, 0xff, 0x99, 0xb6, 0xff, 0x17, 0xae, 0xff, 0x50, 0x74, 0xff, 0x0b, 0x53, 0xff, 0x54, 0x95, 0xff, 0x78, 0xae, 0xff, 0xf9, 0xb6, 0xff, 0x7b, 0xc7, 0xff, 0x9b, 0xcf, 0xff, 0x7b, 0xd7, 0xff, 0x7b, 0xdf, 0xff, 0x7b, 0xdf, 0xff, 0x7b, 0xdf, 0xff, 0x2e, 0x84, 0xff, 0x4c, 0x73, 0xff, 0xcb, 0x62, 0xff, 0xd3, 0x6c, 0xff, 0xfb, 0x86, 0xff, 0x5c, 0x6f, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x77, 0xff, 0x99, 0x76, 0xff, 0xf3, 0x54, 0xff, 0x8e, 0x3b, 0xff, 0x8d, 0x3b, 0xff, 0x95, 0x65, 0xff, 0x1b, 0x7f, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x1b, 0x5f, 0xff, 0x38, 0x6e, 0xff, 0xcf, 0x43, 0xff, 0x91, 0x4c, 0xff, 0x79, 0x5e, 0xff, 0x1b, 0x5f, 0xff, 0xfb, 0x6e, 0xff, 0x37, 0x7e, 0xff, 0x2b, 0x43, 0xff, 0x0b, 0x43, 0xff, 0x78, 0x7e, 0xff, 0x3b, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x1a, 0x6f, 0xff, 0x70, 0x5c, 0xff, 0x0b, 0x63, 0xfa, 0x10, 0x94, 0x88, 0xad, 0x7b, 0x89, 0xeb, 0x62, 0xc5, 0xcb, 0x62, 0xd0, 0xeb, 0x62, 0xbd, 0x0b, 0x63, 0x85, 0xee, 0x8b, 0x3e, 0x34, 0xbd, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x83, 0x2b, 0xca, 0x52, 0xf1, 0x13, 0x65, 0xff, 0x3c, 0x77, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x6f, 0xff, 0xb6, 0x65, 0xff, 0xcf, 0x33, 0xff, 0x75, 0x75, 0xff, 0x2f, 0x64, 0xff, 0x4c, 0x5b, 0xff, 0x74, 0x9d, 0xff, 0x78, 0xb6, 0xff, 0x58, 0xb6, 0xff, 0x57, 0xae, 0xff, 0x36, 0xa6, 0xff, 0xf5, 0xa5, 0xff, 0x13, 0x95, 0xff, 0x4c, 0x5b, 0xff, 0x6c, 0x53, 0xff, 0x6d, 0x5b, 0xff, 0x0b, 0x4b, 0xff, 0xf2, 0x84, 0xff, 0x57, 0xa6, 0xff, 0x98, 0xae, 0xff, 0x1a, 0xbf, 0xff, 0x5b, 0xc7, 0xff, 0x5b, 0xc7, 0xff, 0x7b, 0xcf, 0xff, 0x3a, 0xcf, 0xff, 0xfa, 0xd6, 0xff, 0xf2, 0x9c, 0xff, 0xcb, 0x52, 0xff, 0x4c, 0x4b, 0xff, 0xb6, 0x6d, 0xff, 0x1b, 0x77, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x6f, 0xff, 0x3c, 0x7f, 0xff, 0x99, 0x7e, 0xff, 0xf3, 0x5c, 0xff, 0x8d, 0x2b, 0xff, 0x54, 0x4d, 0xff, 0x3c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x1b, 0x5f, 0xff, 0xf8, 0x65, 0xff, 0xcf, 0x3b, 0xff, 0x33, 0x55, 0xff, 0x99, 0x5e, 0xff, 0x1b, 0x5f, 0xff, 0x1b, 0x67, 0xff, 0xda, 0x7e, 0xff, 0xce, 0x4b, 0xff, 0xca, 0x3a, 0xff, 0xf6, 0x6d, 0xff, 0x3b, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x3c, 0x67, 0xff, 0xfa, 0x76, 0xff, 0x0f, 0x54, 0xff, 0xeb, 0x62, 0xff, 0xeb, 0x62, 0xfd, 0x0b, 0x53, 0xfe, 0x4c, 0x4b, 0xff, 0x6d, 0x4b, 0xff, 0x2c, 0x4b, 0xff, 0xca, 0x4a, 0xfd, 0xca, 0x5a, 0xef, 0xaa, 0x5a, 0x9f, 0x74, 0xbd, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x73, 0x3a, 0xaa, 0x4a, 0xf4, 0x54, 0x65, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x58, 0x5e, 0xff, 0x92, 0x3c, 0xff, 0xba, 0x76, 0xff, 0x1b, 0x7f, 0xff, 0x98, 0x86, 0xff, 0xee, 0x53, 0xff, 0x0b, 0x5b, 0xff, 0xad, 0x73, 0xff, 0x50, 0x84, 0xff, 0x50, 0x84, 0xff, 0xee, 0x7b, 0xff, 0x2c, 0x5b, 0xff, 0xeb, 0x4a, 0xff, 0x10, 0x5c, 0xff, 0x34, 0x6d, 0xff, 0x74, 0x6d, 0xff, 0x70, 0x54, 0xff, 0x2c, 0x43, 0xff, 0x0f, 0x74, 0xff, 0xd6, 0xa5, 0xff, 0x98, 0xae, 0xff, 0x98, 0xae, 0xff, 0x98, 0xa6, 0xff, 0x77, 0xae, 0xff, 0x57, 0xbe, 0xff, 0x95, 0xa5, 0xff, 0x8d, 0x5b, 0xff, 0xae, 0x4b, 0xff, 0x54, 0x75, 0xff, 0xae, 0x3b, 0xff, 0x13, 0x4d, 0xff, 0x1b, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x67, 0xff, 0x7c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x6f, 0xff, 0x1b, 0x77, 0xff, 0xba, 0x6e, 0xff, 0x38, 0x5e, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x1b, 0x5f, 0xff, 0xf7, 0x5d, 0xff, 0xef, 0x2b, 0xff, 0xd6, 0x55, 0xff, 0xda, 0x5e, 0xff, 0x3c, 0x57, 0xff, 0x3c, 0x5f, 0xff, 0x3b, 0x7f, 0xff, 0xf2, 0x5c, 0xff, 0x0b, 0x43, 0xff, 0x53, 0x5d, 0xff, 0x3b, 0x6f, 0xff, 0x7d, 0x67, 0xff, 0x3c, 0x67, 0xff, 0xb9, 0x76, 0xff, 0x6d, 0x43, 0xff, 0x0b, 0x53, 0xff, 0x8d, 0x4b, 0xff, 0x95, 0x6d, 0xff, 0xb9, 0x7e, 0xff, 0xba, 0x7e, 0xff, 0x59, 0x76, 0xff, 0x75, 0x6d, 0xff, 0x4d, 0x4b, 0xff, 0xca, 0x52, 0xf8, 0x0c, 0x6b, 0x6c, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x73, 0x4e, 0xca, 0x4a, 0xf7, 0x75, 0x65, 0xff, 0x3b, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x1b, 0x67, 0xff, 0x1c, 0x6f, 0xff, 0x1c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x1b, 0x6f, 0xff, 0xd6, 0x7d, 0xff, 0x4c, 0x63, 0xff, 0xae, 0x83, 0xff, 0x2c, 0x73, 0xff, 0xca, 0x62, 0xff, 0x8a, 0x62, 0xff, 0xaa, 0x52, 0xff, 0xd2, 0x6c, 0xff, 0x75, 0x65, 0xff, 0xb6, 0x5d, 0xff, 0xd6, 0x55, 0xff, 0xf6, 0x65, 0xff, 0x14, 0x6d, 0xff, 0xae, 0x53, 0xff, 0x2c, 0x53, 0xff, 0x2f, 0x7c, 0xff, 0x33, 0x95, 0xff, 0x74, 0x9d, 0xff, 0xf3, 0x94, 0xff, 0xef, 0x83, 0xff, 0x0c, 0x53, 0xff, 0xae, 0x4b, 0xff, 0x58, 0x7e, 0xff, 0xda, 0x7e, 0xff, 0xba, 0x7e, 0xff, 0xb2, 0x44, 0xff, 0xd7, 0x55, 0xff, 0x5c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3b, 0x5f, 0xff, 0xf7, 0x4d, 0xff, 0xd3, 0x34, 0xff, 0x99, 0x5e, 0xff, 0x1b, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x3c, 0x57, 0xff, 0x3b, 0x6f, 0xff, 0xf6, 0x75, 0xff, 0x2b, 0x43, 0xff, 0x91, 0x54, 0xff, 0x1b, 0x77, 0xff, 0x7c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x58, 0x66, 0xff, 0x2c, 0x2b, 0xff, 0x0f, 0x4c, 0xff, 0x99, 0x7e, 0xff, 0x3c, 0x77, 0xff, 0x3c, 0x6f, 0xff, 0x3c, 0x67, 0xff, 0x1c, 0x67, 0xff, 0xdb, 0x6e, 0xff, 0xd7, 0x75, 0xff, 0x0b, 0x4b, 0xff, 0xaa, 0x52, 0xb6, 0xd7, 0xbd, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x73, 0x5a, 0xca, 0x52, 0xf8, 0x75, 0x6d, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x67, 0xff, 0x58, 0x7e, 0xff, 0x8d, 0x5b, 0xff, 0xba, 0xe6, 0xff, 0x5c, 0xef, 0xff, 0xfa, 0xe6, 0xff, 0xd2, 0xa4, 0xff, 0x2c, 0x53, 0xff, 0xf7, 0x75, 0xff, 0x59, 0x5e, 0xff, 0x38, 0x4e, 0xff, 0x38, 0x56, 0xff, 0x17, 0x56, 0xff, 0x17, 0x66, 0xff, 0x96, 0x75, 0xff, 0x6d, 0x53, 0xff, 0x6d, 0x73, 0xff, 0x6d, 0x7b, 0xff, 0x0b, 0x6b, 0xff, 0x0b, 0x73, 0xff, 0xaa, 0x62, 0xff, 0xae, 0x53, 0xff, 0x58, 0x7e, 0xff, 0x3c, 0x77, 0xff, 0x3c, 0x6f, 0xff, 0x3b, 0x67, 0xff, 0x3b, 0x6f, 0xff, 0xdb, 0x66, 0xff, 0x3d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0xda, 0x56, 0xff, 0x9a, 0x56, 0xff, 0xfb, 0x5e, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x99, 0x7e, 0xff, 0x0b, 0x3b, 0xff, 0x0f, 0x4c, 0xff, 0xfb, 0x76, 0xff, 0x7d, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x9a, 0x66, 0xff, 0x95, 0x5d, 0xff, 0xda, 0x7e, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x9a, 0x6e, 0xff, 0xae, 0x4b, 0xff, 0xaa, 0x52, 0xd4, 0xad, 0x7b, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x7b, 0x55, 0xca, 0x52, 0xf7, 0x95, 0x6d, 0xff, 0x3c, 0x6f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0xb9, 0x76, 0xff, 0xad, 0x4b, 0xff, 0x38, 0xce, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xd2, 0x9c, 0xff, 0xae, 0x53, 0xff, 0xda, 0x7e, 0xff, 0x3c, 0x5f, 0xff, 0xfb, 0x56, 0xff, 0xfb, 0x5e, 0xff, 0xba, 0x56, 0xff, 0x99, 0x56, 0xff, 0x38, 0x6e, 0xff, 0xce, 0x53, 0xff, 0x75, 0xb5, 0xff, 0x9d, 0xff, 0xff, 0x3c, 0xf7, 0xff, 0x9a, 0xe6, 0xff, 0x0c, 0x5b, 0xff, 0x33, 0x65, 0xff, 0x1b, 0x77, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x67, 0xff, 0xda, 0x7e, 0xff, 0x2c, 0x3b, 0xff, 0x8d, 0x43, 0xff, 0xfb, 0x76, 0xff, 0x7d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0xda, 0x6e, 0xff, 0x0f, 0x54, 0xff, 0xca, 0x52, 0xd5, 0x8d, 0x7b, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x7b, 0x50, 0xca, 0x52, 0xf6, 0x75, 0x65, 0xff, 0x1c, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0xfa, 0x7e, 0xff, 0xef, 0x4b, 0xff, 0x14, 0xa5, 0xff, 0xdf, 0xff, 0xff, 0xde, 0xff, 0xff, 0x71, 0x94, 0xff, 0x50, 0x5c, 0xff, 0xfb, 0x76, 0xff, 0x7d, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x1c, 0x5f, 0xff, 0x9a, 0x76, 0xff, 0x10, 0x5c, 0xff, 0x34, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0x18, 0xce, 0xff, 0xcb, 0x42, 0xff, 0x38, 0x76, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0xfa, 0x76, 0xff, 0xae, 0x43, 0xff, 0x6c, 0x33, 0xff, 0xfa, 0x76, 0xff, 0x7c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0xba, 0x76, 0xff, 0xae, 0x53, 0xff, 0xcb, 0x5a, 0xba, 0x92, 0x94, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x73, 0x43, 0xaa, 0x52, 0xf4, 0x34, 0x65, 0xff, 0x1c, 0x6f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1b, 0x77, 0xff, 0xb2, 0x5c, 0xff, 0x8d, 0x6b, 0xff, 0x9d, 0xf7, 0xff, 0x9d, 0xff, 0xff, 0xcf, 0x7b, 0xff, 0xf3, 0x64, 0xff, 0xfb, 0x76, 0xff, 0x7d, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1b, 0x77, 0xff, 0x91, 0x5c, 0xff, 0xd3, 0x9c, 0xff, 0xfe, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xd2, 0x9c, 0xff, 0x6d, 0x43, 0xff, 0xfb, 0x76, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0xfb, 0x76, 0xff, 0x10, 0x3c, 0xff, 0xae, 0x33, 0xff, 0xfb, 0x76, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x57, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3d, 0x5f, 0xff, 0x1c, 0x77, 0xff, 0x17, 0x76, 0xff, 0x0c, 0x53, 0xfc, 0xeb, 0x62, 0x88, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x7b, 0x2b, 0xaa, 0x52, 0xef, 0x14, 0x65, 0xff, 0x1c, 0x77, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x1b, 0x6f, 0xff, 0xd7, 0x75, 0xff, 0xca, 0x4a, 0xff, 0x37, 0xce, 0xff, 0x7c, 0xf7, 0xff, 0x2c, 0x63, 0xff, 0x75, 0x75, 0xff, 0x1c, 0x77, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x1b, 0x77, 0xff, 0xf2, 0x64, 0xff, 0x91, 0x94, 0xff, 0xde, 0xff, 0xff, 0x7c, 0xf7, 0xff, 0xeb, 0x52, 0xff, 0x14, 0x65, 0xff, 0x1c, 0x77, 0xff, 0x3d, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0xfb, 0x6e, 0xff, 0xb2, 0x44, 0xff, 0x71, 0x3c, 0xff, 0x1b, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0xda, 0x7e, 0xff, 0x71, 0x5c, 0xff, 0xeb, 0x5a, 0xec, 0xcf, 0x83, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x8c, 0x1e, 0xa9, 0x52, 0xe7, 0xb2, 0x5c, 0xff, 0x1c, 0x77, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0xdb, 0x7e, 0xff, 0xae, 0x53, 0xff, 0x8e, 0x73, 0xff, 0x79, 0xde, 0xff, 0x0b, 0x53, 0xff, 0xf7, 0x75, 0xff, 0x3c, 0x6f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x1c, 0x77, 0xff, 0x34, 0x65, 0xff, 0x50, 0x8c, 0xff, 0xbe, 0xff, 0xff, 0xd7, 0xc5, 0xff, 0xec, 0x42, 0xff, 0x7a, 0x76, 0xff, 0x3c, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1b, 0x67, 0xff, 0x18, 0x56, 0xff, 0x58, 0x5e, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x1b, 0x77, 0xff, 0xb5, 0x6d, 0xff, 0x0b, 0x53, 0xfd, 0xeb, 0x5a, 0xb0, 0x59, 0xce, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0xa4, 0x1a, 0xa9, 0x4a, 0xe0, 0x0f, 0x4c, 0xff, 0xfb, 0x76, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1c, 0x77, 0xff, 0x18, 0x7e, 0xff, 0x2c, 0x43, 0xff, 0x4c, 0x5b, 0xff, 0xae, 0x4b, 0xff, 0x99, 0x7e, 0xff, 0x3c, 0x6f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0xd6, 0x6d, 0xff, 0x8d, 0x6b, 0xff, 0xba, 0xde, 0xff, 0x2d, 0x63, 0xff, 0x92, 0x5c, 0xff, 0xfc, 0x76, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x1b, 0x6f, 0xff, 0xba, 0x76, 0xff, 0xb6, 0x6d, 0xff, 0x6d, 0x4b, 0xff, 0xeb, 0x5a, 0xdd, 0xef, 0x83, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xad, 0x0f, 0x89, 0x4a, 0xcd, 0x6d, 0x43, 0xff, 0xbb, 0x7e, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3b, 0x77, 0xff, 0x38, 0x76, 0xff, 0x91, 0x54, 0xff, 0xd6, 0x6d, 0xff, 0x3b, 0x77, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3b, 0x67, 0xff, 0x98, 0x76, 0xff, 0x4c, 0x43, 0xff, 0x6d, 0x5b, 0xff, 0x6e, 0x4b, 0xff, 0x9a, 0x7e, 0xff, 0x5c, 0x6f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3d, 0x5f, 0xff, 0x3d, 0x67, 0xff, 0x3c, 0x5f, 0xff, 0x1b, 0x5f, 0xff, 0xfa, 0x56, 0xff, 0xda, 0x56, 0xff, 0x79, 0x5e, 0xff, 0xf8, 0x6d, 0xff, 0xf3, 0x64, 0xff, 0x4c, 0x4b, 0xff, 0xeb, 0x5a, 0xea, 0x2c, 0x6b, 0x5e, 0x10, 0xfc, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xad, 0x03, 0xca, 0x5a, 0x9d, 0xeb, 0x3a, 0xfe, 0x59, 0x76, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0x3c, 0x77, 0xff, 0x3c, 0x77, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1b, 0x77, 0xff, 0xd6, 0x65, 0xff, 0x14, 0x5d, 0xff, 0x79, 0x7e, 0xff, 0x5c, 0x77, 0xff, 0x7d, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0xfb, 0x5e, 0xff, 0xbb, 0x5e, 0xff, 0x79, 0x56, 0xff, 0x38, 0x56, 0xff, 0xd7, 0x5d, 0xff, 0xb5, 0x65, 0xff, 0x34, 0x65, 0xff, 0xcf, 0x53, 0xff, 0x8a, 0x42, 0xfe, 0xaa, 0x52, 0xe6, 0x2c, 0x6b, 0x65, 0x18, 0xc6, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xeb, 0x62, 0x79, 0xaa, 0x42, 0xfb, 0x96, 0x65, 0xff, 0x1c, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x57, 0xff, 0x3c, 0x67, 0xff, 0x1c, 0x6f, 0xff, 0x1c, 0x77, 0xff, 0x3c, 0x6f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0xfb, 0x5e, 0xff, 0x79, 0x5e, 0xff, 0x59, 0x66, 0xff, 0x17, 0x66, 0xff, 0x96, 0x6d, 0xff, 0xd3, 0x5c, 0xff, 0xce, 0x53, 0xff, 0xca, 0x42, 0xff, 0x69, 0x4a, 0xf5, 0x69, 0x52, 0xbf, 0x2c, 0x73, 0x4a, 0x18, 0xc6, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x73, 0x42, 0x89, 0x42, 0xf3, 0x72, 0x54, 0xff, 0xbb, 0x6e, 0xff, 0x3c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x57, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x57, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x7a, 0x5e, 0xff, 0xd7, 0x6d, 0xff, 0x91, 0x5c, 0xff, 0x4c, 0x43, 0xff, 0xcb, 0x4a, 0xff, 0x8a, 0x52, 0xfd, 0x89, 0x52, 0xf2, 0x89, 0x52, 0xbe, 0x4c, 0x73, 0x5c, 0x75, 0xbd, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x94, 0x21, 0x8a, 0x4a, 0xdb, 0x6d, 0x43, 0xff, 0x38, 0x6e, 0xff, 0x1b, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x57, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x57, 0xff, 0x5d, 0x57, 0xff, 0x5d, 0x57, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0xdb, 0x5e, 0xff, 0x18, 0x6e, 0xff, 0x72, 0x64, 0xff, 0xaa, 0x42, 0xfd, 0x89, 0x4a, 0xeb, 0x69, 0x5a, 0xc3, 0xaa, 0x62, 0x8f, 0x2c, 0x73, 0x4a, 0xd3, 0xac, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xde, 0x06, 0xaa, 0x5a, 0xb4, 0xab, 0x42, 0xff, 0x34, 0x65, 0xff, 0xba, 0x6e, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x3b, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x3b, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x57, 0xff, 0x7d, 0x57, 0xff, 0x7d, 0x57, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x59, 0x5e, 0xff, 0xd6, 0x75, 0xff, 0x2d, 0x53, 0xff, 0x8a, 0x52, 0xd8, 0xae, 0x7b, 0x42, 0xd1, 0xac, 0x0f, 0xf0, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x6b, 0x6f, 0x8a, 0x52, 0xfa, 0x30, 0x54, 0xff, 0x17, 0x66, 0xff, 0x1b, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x1b, 0x67, 0xff, 0x3b, 0x77, 0xff, 0x7c, 0x87, 0xff, 0x9c, 0x97, 0xff, 0xbd, 0x9f, 0xff, 0x9d, 0x97, 0xff, 0x7c, 0x8f, 0xff, 0x5b, 0x87, 0xff, 0x3b, 0x77, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0xba, 0x66, 0xff, 0xf7, 0x65, 0xff, 0xf3, 0x64, 0xff, 0xeb, 0x52, 0xf9, 0x8d, 0x73, 0x66, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x94, 0x2a, 0x49, 0x52, 0xe5, 0x4d, 0x4b, 0xff, 0x95, 0x65, 0xff, 0x7a, 0x66, 0xff, 0x3c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x1c, 0x6f, 0xff, 0x1b, 0x77, 0xff, 0x9d, 0x9f, 0xff, 0xfd, 0xaf, 0xff, 0xfd, 0xb7, 0xff, 0xfd, 0xbf, 0xff, 0xfd, 0xc7, 0xff, 0xfd, 0xc7, 0xff, 0xfd, 0xc7, 0xff, 0xfd, 0xbf, 0xff, 0xdd, 0xaf, 0xff, 0x7c, 0x97, 0xff, 0x1b, 0x77, 0xff, 0x3b, 0x6f, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0xfb, 0x66, 0xff, 0x38, 0x66, 0xff, 0xb6, 0x6d, 0xff, 0xef, 0x63, 0xff, 0xcb, 0x5a, 0xdd, 0x92, 0x9c, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xd6, 0x05, 0xaa, 0x62, 0xa1, 0xaa, 0x42, 0xfe, 0xd3, 0x5c, 0xff, 0x18, 0x6e, 0xff, 0x9a, 0x66, 0xff, 0x3c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x1b, 0x67, 0xff, 0x3b, 0x87, 0xff, 0xdd, 0xaf, 0xff, 0xfd, 0xbf, 0xff, 0xdc, 0xc7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xfc, 0xc7, 0xff, 0xfd, 0xbf, 0xff, 0xdd, 0xaf, 0xff, 0x5c, 0x87, 0xff, 0x3b, 0x6f, 0xff, 0x5b, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1c, 0x5f, 0xff, 0x59, 0x5e, 0xff, 0xb6, 0x65, 0xff, 0x34, 0x6d, 0xff, 0x2c, 0x5b, 0xfd, 0x0c, 0x73, 0x93, 0x7a, 0xfe, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x8b, 0x4c, 0xa9, 0x4a, 0xf4, 0x0f, 0x54, 0xff, 0xb6, 0x6d, 0xff, 0x39, 0x66, 0xff, 0xdb, 0x5e, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x1b, 0x67, 0xff, 0x3b, 0x87, 0xff, 0xfd, 0xaf, 0xff, 0xfd, 0xbf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xd7, 0xff, 0xdb, 0xd7, 0xff, 0xdb, 0xd7, 0xff, 0xdb, 0xcf, 0xff, 0xfc, 0xcf, 0xff, 0xfc, 0xc7, 0xff, 0xfe, 0xb7, 0xff, 0x7c, 0x8f, 0xff, 0x3b, 0x6f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x57, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x9a, 0x56, 0xff, 0xf7, 0x55, 0xff, 0x96, 0x6d, 0xff, 0x10, 0x5c, 0xff, 0xeb, 0x5a, 0xeb, 0xef, 0x83, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xb5, 0x13, 0xca, 0x5a, 0xc6, 0x0b, 0x4b, 0xff, 0x34, 0x6d, 0xff, 0xd6, 0x5d, 0xff, 0x59, 0x5e, 0xff, 0xfb, 0x5e, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x57, 0xff, 0x3c, 0x5f, 0xff, 0x1b, 0x77, 0xff, 0xdd, 0xaf, 0xff, 0xfc, 0xc7, 0xff, 0xfc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xfc, 0xc7, 0xff, 0xfd, 0xbf, 0xff, 0x7c, 0x97, 0xff, 0x3b, 0x67, 0xff, 0x7c, 0x57, 0xff, 0x7d, 0x57, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x57, 0xff, 0x5d, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1c, 0x5f, 0xff, 0x9a, 0x56, 0xff, 0xd7, 0x55, 0xff, 0x96, 0x5d, 0xff, 0xf3, 0x6c, 0xff, 0xec, 0x52, 0xfe, 0x0c, 0x6b, 0xa3, 0xfb, 0xfe, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x4c, 0x73, 0x70, 0xca, 0x52, 0xf9, 0x30, 0x5c, 0xff, 0x75, 0x5d, 0xff, 0xf7, 0x55, 0xff, 0x7a, 0x56, 0xff, 0xfb, 0x5e, 0xff, 0x3c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x1c, 0x67, 0xff, 0x9d, 0x97, 0xff, 0xfd, 0xbf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xc7, 0xff, 0xdd, 0xc7, 0xff, 0xfe, 0xb7, 0xff, 0x5b, 0x7f, 0xff, 0x5c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x9a, 0x56, 0xff, 0x18, 0x4e, 0xff, 0xb6, 0x55, 0xff, 0x55, 0x6d, 0xff, 0x6d, 0x53, 0xff, 0xcb, 0x5a, 0xe9, 0x71, 0x94, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xb5, 0x1a, 0xaa, 0x5a, 0xd4, 0xeb, 0x4a, 0xff, 0x13, 0x65, 0xff, 0x96, 0x55, 0xff, 0xf8, 0x55, 0xff, 0x79, 0x56, 0xff, 0xfb, 0x5e, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x7f, 0xff, 0xfe, 0xb7, 0xff, 0xfd, 0xcf, 0xff, 0xdc, 0xd7, 0xff, 0xdb, 0xd7, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xfd, 0xc7, 0xff, 0xdd, 0xa7, 0xff, 0x1b, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0xdb, 0x5e, 0xff, 0x18, 0x56, 0xff, 0xb7, 0x55, 0xff, 0x75, 0x65, 0xff, 0x51, 0x64, 0xff, 0x69, 0x4a, 0xfb, 0x0c, 0x6b, 0x97, 0x18, 0xc6, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x8d, 0x7b, 0x75, 0x89, 0x4a, 0xfa, 0xce, 0x53, 0xff, 0x54, 0x5d, 0xff, 0xb6, 0x55, 0xff, 0xf8, 0x55, 0xff, 0x79, 0x56, 0xff, 0xfb, 0x5e, 0xff, 0x1b, 0x6f, 0xff, 0x9c, 0x9f, 0xff, 0xfd, 0xc7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xfd, 0xbf, 0xff, 0x5b, 0x8f, 0xff, 0x3c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0xdb, 0x5e, 0xff, 0x39, 0x4e, 0xff, 0xd7, 0x55, 0xff, 0x95, 0x5d, 0xff, 0x13, 0x6d, 0xff, 0xca, 0x4a, 0xff, 0x89, 0x5a, 0xd1, 0x51, 0x94, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xc5, 0x17, 0x68, 0x52, 0xd0, 0x89, 0x42, 0xff, 0xb2, 0x5c, 0xff, 0x75, 0x5d, 0xff, 0xb6, 0x55, 0xff, 0xf8, 0x4d, 0xff, 0x79, 0x56, 0xff, 0x99, 0x6e, 0xff, 0xbd, 0xaf, 0xff, 0xfd, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xfc, 0xc7, 0xff, 0xdd, 0xa7, 0xff, 0x3b, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0xdb, 0x5e, 0xff, 0x59, 0x56, 0xff, 0xf7, 0x55, 0xff, 0xb6, 0x5d, 0xff, 0x34, 0x6d, 0xff, 0x8d, 0x53, 0xff, 0xaa, 0x52, 0xee, 0xce, 0x83, 0x52, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xcf, 0x8b, 0x4f, 0x69, 0x52, 0xee, 0xec, 0x42, 0xff, 0x14, 0x65, 0xff, 0x96, 0x5d, 0xff, 0xd7, 0x55, 0xff, 0xf8, 0x55, 0xff, 0x38, 0x6e, 0xff, 0x9c, 0xb7, 0xff, 0xbc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xfc, 0xcf, 0xff, 0xfc, 0xcf, 0xff, 0xfd, 0xb7, 0xff, 0x3b, 0x7f, 0xff, 0x3c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1b, 0x5f, 0xff, 0xda, 0x56, 0xff, 0x38, 0x56, 0xff, 0xf8, 0x55, 0xff, 0xd7, 0x5d, 0xff, 0xb6, 0x65, 0xff, 0x71, 0x64, 0xff, 0xcb, 0x5a, 0xfa, 0x0b, 0x6b, 0x91, 0xb5, 0xde, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xde, 0x06, 0x2c, 0x6b, 0x80, 0x8a, 0x4a, 0xf8, 0x6d, 0x4b, 0xff, 0x55, 0x6d, 0xff, 0xb6, 0x5d, 0xff, 0xd7, 0x55, 0xff, 0xf7, 0x6d, 0xff, 0x5c, 0xb7, 0xff, 0x5b, 0xbf, 0xff, 0x9b, 0xbf, 0xff, 0xbc, 0xc7, 0xff, 0xbc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xbc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xc7, 0xff, 0xfd, 0xc7, 0xff, 0x9c, 0x97, 0xff, 0x3b, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x57, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0xdb, 0x5e, 0xff, 0x59, 0x4e, 0xff, 0x18, 0x4e, 0xff, 0xf7, 0x55, 0xff, 0xd7, 0x55, 0xff, 0xb6, 0x5d, 0xff, 0xf3, 0x64, 0xff, 0x0b, 0x53, 0xfe, 0xcb, 0x62, 0xc4, 0x92, 0xa4, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x0c, 0x0c, 0x63, 0x99, 0xaa, 0x52, 0xfb, 0xaf, 0x53, 0xff, 0x76, 0x6d, 0xff, 0xd7, 0x5d, 0xff, 0xf7, 0x6d, 0xff, 0xfb, 0x9e, 0xff, 0xfa, 0xa6, 0xff, 0x3a, 0xaf, 0xff, 0x5b, 0xb7, 0xff, 0x7b, 0xbf, 0xff, 0x9c, 0xc7, 0xff, 0xbc, 0xcf, 0xff, 0xbc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xfc, 0xcf, 0xff, 0xfc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xfc, 0xcf, 0xff, 0xfd, 0xcf, 0xff, 0xdd, 0xaf, 0xff, 0x3b, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0xdb, 0x5e, 0xff, 0x59, 0x4e, 0xff, 0x18, 0x4e, 0xff, 0xf7, 0x4d, 0xff, 0xd7, 0x4d, 0xff, 0xb6, 0x55, 0xff, 0xb6, 0x55, 0xff, 0x95, 0x65, 0xff, 0xce, 0x5b, 0xff, 0xeb, 0x5a, 0xf1, 0x0f, 0x8c, 0x49, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xbd, 0x19, 0xcb, 0x62, 0xc3, 0xab, 0x52, 0xff, 0xcf, 0x53, 0xff, 0x55, 0x6d, 0xff, 0xb6, 0x6d, 0xff, 0xda, 0x96, 0xff, 0xd9, 0x9e, 0xff, 0xf9, 0xa6, 0xff, 0x1a, 0xaf, 0xff, 0x3b, 0xaf, 0xff, 0x5b, 0xb7, 0xff, 0x7c, 0xbf, 0xff, 0x9c, 0xc7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xfd, 0xcf, 0xff, 0xfe, 0xb7, 0xff, 0x3b, 0x77, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x57, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x1c, 0x67, 0xff, 0x9a, 0x56, 0xff, 0x18, 0x4e, 0xff, 0xf8, 0x4d, 0xff, 0xd7, 0x55, 0xff, 0xb7, 0x55, 0xff, 0xb7, 0x4d, 0xff, 0xb6, 0x55, 0xff, 0x96, 0x55, 0xff, 0x54, 0x65, 0xff, 0x6d, 0x53, 0xff, 0x8a, 0x5a, 0xd3, 0xf7, 0xd5, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x4c, 0x7b, 0x76, 0x69, 0x52, 0xfc, 0x8a, 0x4a, 0xff, 0x6e, 0x4b, 0xff, 0x34, 0x75, 0xff, 0x99, 0x96, 0xff, 0xfa, 0x9e, 0xff, 0xf9, 0x9e, 0xff, 0xfa, 0x9e, 0xff, 0xfa, 0xa6, 0xff, 0x1a, 0xa7, 0xff, 0x3b, 0xaf, 0xff, 0x3b, 0xb7, 0xff, 0x7b, 0xbf, 0xff, 0x7b, 0xc7, 0xff, 0x9c, 0xc7, 0xff, 0xbc, 0xc7, 0xff, 0xbc, 0xc7, 0xff, 0xdc, 0xc7, 0xff, 0xdc, 0xcf, 0xff, 0xbb, 0xcf, 0xff, 0xdb, 0xc7, 0xff, 0xdb, 0xcf, 0xff, 0xbc, 0xcf, 0xff, 0xbb, 0xcf, 0xff, 0xdc, 0xc7, 0xff, 0xfe, 0xbf, 0xff, 0x3b, 0x7f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x1c, 0x67, 0xff, 0xba, 0x5e, 0xff, 0x59, 0x56, 0xff, 0x39, 0x56, 0xff, 0x18, 0x4e, 0xff, 0xd7, 0x4d, 0xff, 0xb7, 0x55, 0xff, 0xb7, 0x55, 0xff, 0x97, 0x55, 0xff, 0x96, 0x55, 0xff, 0x96, 0x55, 0xff, 0x75, 0x55, 0xff, 0x13, 0x6d, 0xff, 0x2c, 0x53, 0xff, 0xaa, 0x5a, 0xb1, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x73, 0x64, 0x68, 0x52, 0xfb, 0xca, 0x52, 0xff, 0xcb, 0x4a, 0xff, 0x2d, 0x4b, 0xff, 0xf6, 0x95, 0xff, 0xd9, 0xa6, 0xff, 0xf9, 0x9e, 0xff, 0xd9, 0x9e, 0xff, 0xd9, 0x9e, 0xff, 0xfa, 0x9e, 0xff, 0xfa, 0x9e, 0xff, 0xfa, 0xa6, 0xff, 0x1a, 0xa7, 0xff, 0x1a, 0xaf, 0xff, 0x3a, 0xb7, 0xff, 0x5a, 0xb7, 0xff, 0x5b, 0xb7, 0xff, 0x7b, 0xbf, 0xff, 0x9b, 0xbf, 0xff, 0x9b, 0xbf, 0xff, 0xbb, 0xbf, 0xff, 0x9b, 0xc7, 0xff, 0xbc, 0xcf, 0xff, 0xbc, 0xc7, 0xff, 0xdc, 0xc7, 0xff, 0xfd, 0xc7, 0xff, 0x3b, 0x97, 0xff, 0x3b, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x5f, 0xff, 0x1c, 0x67, 0xff, 0xdb, 0x66, 0xff, 0x9a, 0x5e, 0xff, 0x59, 0x56, 0xff, 0x18, 0x4e, 0xff, 0xf8, 0x4d, 0xff, 0xf7, 0x4d, 0xff, 0xd7, 0x4d, 0xff, 0xd6, 0x4d, 0xff, 0xd6, 0x55, 0xff, 0xd7, 0x5d, 0xff, 0x96, 0x55, 0xff, 0x97, 0x55, 0xff, 0x96, 0x55, 0xff, 0x96, 0x55, 0xff, 0x55, 0x5d, 0xff, 0xb2, 0x64, 0xff, 0xca, 0x52, 0xfc, 0x0c, 0x6b, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x6b, 0x55, 0x69, 0x52, 0xfb, 0x10, 0x74, 0xff, 0xcf, 0x63, 0xff, 0xcb, 0x42, 0xff, 0x2c, 0x4b, 0xff, 0x95, 0x8d, 0xff, 0xb9, 0xae, 0xff, 0xd9, 0xa6, 0xff, 0xd9, 0xa6, 0xff, 0xfa, 0x9e, 0xff, 0xfa, 0x9e, 0xff, 0xfa, 0x9e, 0xff, 0xfa, 0x9e, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0x1a, 0xa7, 0xff, 0x1a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x3a, 0xb7, 0xff, 0x5a, 0xb7, 0xff, 0x5b, 0xb7, 0xff, 0x7b, 0xbf, 0xff, 0x9b, 0xbf, 0xff, 0x9c, 0xc7, 0xff, 0xdd, 0xc7, 0xff, 0x16, 0x86, 0xff, 0x98, 0x6e, 0xff, 0x3c, 0x6f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0xfb, 0x6e, 0xff, 0x34, 0x4d, 0xff, 0x75, 0x55, 0xff, 0xb6, 0x55, 0xff, 0xb7, 0x4d, 0xff, 0xb7, 0x4d, 0xff, 0xb7, 0x4d, 0xff, 0xb7, 0x55, 0xff, 0xb6, 0x5d, 0xff, 0xb6, 0x65, 0xff, 0x96, 0x65, 0xff, 0xb2, 0x4c, 0xff, 0x76, 0x55, 0xff, 0xb7, 0x55, 0xff, 0x96, 0x55, 0xff, 0x76, 0x5d, 0xff, 0x35, 0x65, 0xff, 0x30, 0x5c, 0xff, 0x69, 0x4a, 0xf2, 0x51, 0x94, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x73, 0x49, 0xaa, 0x52, 0xf8, 0x30, 0x6c, 0xff, 0x34, 0x75, 0xff, 0xef, 0x53, 0xff, 0xcb, 0x4a, 0xff, 0xcb, 0x4a, 0xff, 0x71, 0x74, 0xff, 0x78, 0xae, 0xff, 0xda, 0xae, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0x9e, 0xff, 0xfa, 0x9e, 0xff, 0xfa, 0x9e, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0x9e, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0x1a, 0xa7, 0xff, 0xfa, 0xa6, 0xff, 0x1a, 0xaf, 0xff, 0x1a, 0xa7, 0xff, 0x5a, 0xb7, 0xff, 0x5b, 0xbf, 0xff, 0x2f, 0x5c, 0xff, 0xf2, 0x54, 0xff, 0xba, 0x6e, 0xff, 0x5c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0xba, 0x76, 0xff, 0x31, 0x44, 0xff, 0x50, 0x4c, 0xff, 0x75, 0x5d, 0xff, 0x96, 0x55, 0xff, 0x96, 0x55, 0xff, 0x96, 0x55, 0xff, 0x96, 0x5d, 0xff, 0x55, 0x65, 0xff, 0xf3, 0x64, 0xff, 0x8e, 0x43, 0xff, 0xf0, 0x43, 0xff, 0x96, 0x65, 0xff, 0xb7, 0x5d, 0xff, 0x96, 0x55, 0xff, 0x96, 0x5d, 0xff, 0x55, 0x6d, 0xff, 0x8d, 0x53, 0xff, 0xaa, 0x5a, 0xcd, 0x96, 0xc5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x83, 0x3d, 0xaa, 0x5a, 0xf2, 0xaf, 0x5b, 0xff, 0x55, 0x75, 0xff, 0x55, 0x6d, 0xff, 0x92, 0x64, 0xff, 0x2c, 0x4b, 0xff, 0xcb, 0x52, 0xff, 0x0c, 0x53, 0xff, 0xd2, 0x84, 0xff, 0x37, 0xae, 0xff, 0xfa, 0xb6, 0xff, 0xda, 0xa6, 0xff, 0xf9, 0xa6, 0xff, 0xf9, 0x9e, 0xff, 0xf9, 0x9e, 0xff, 0xfa, 0x9e, 0xff, 0xfa, 0x9e, 0xff, 0xfa, 0x9e, 0xff, 0xfa, 0x9e, 0xff, 0xda, 0x9e, 0xff, 0xda, 0xa6, 0xff, 0xda, 0xa6, 0xff, 0xda, 0x9e, 0xff, 0xf9, 0x9e, 0xff, 0x1a, 0xa7, 0xff, 0xfa, 0xb6, 0xff, 0x0f, 0x64, 0xff, 0xce, 0x43, 0xff, 0x18, 0x6e, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x6f, 0xff, 0x79, 0x6e, 0xff, 0x51, 0x4c, 0xff, 0x10, 0x54, 0xff, 0x34, 0x65, 0xff, 0x55, 0x5d, 0xff, 0x76, 0x65, 0xff, 0x14, 0x65, 0xff, 0x0f, 0x54, 0xff, 0x4c, 0x4b, 0xff, 0x0c, 0x43, 0xff, 0xf0, 0x4b, 0xff, 0x76, 0x6d, 0xff, 0x97, 0x65, 0xff, 0x97, 0x5d, 0xff, 0xb6, 0x5d, 0xff, 0x75, 0x65, 0xff, 0x14, 0x75, 0xff, 0xca, 0x52, 0xfd, 0x4c, 0x6b, 0x88, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x8c, 0x20, 0x8a, 0x5a, 0xdd, 0x4d, 0x53, 0xff, 0x35, 0x6d, 0xff, 0x76, 0x5d, 0xff, 0x75, 0x65, 0xff, 0x34, 0x6d, 0xff, 0x50, 0x5c, 0xff, 0x4d, 0x53, 0xff, 0x0b, 0x53, 0xff, 0x0b, 0x53, 0xff, 0xef, 0x6b, 0xff, 0xd6, 0x9d, 0xff, 0xb9, 0xae, 0xff, 0xd9, 0xae, 0xff, 0xfa, 0xae, 0xff, 0xda, 0xa6, 0xff, 0xda, 0x9e, 0xff, 0xfa, 0x9e, 0xff, 0xda, 0x9e, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0xda, 0x9e, 0xff, 0xfa, 0x9e, 0xff, 0xf9, 0x96, 0xff, 0xd9, 0x9e, 0xff, 0xfa, 0xae, 0xff, 0xb1, 0x7c, 0xff, 0x0b, 0x3b, 0xff, 0xb6, 0x6d, 0xff, 0x1c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0x58, 0x6e, 0xff, 0x30, 0x54, 0xff, 0xef, 0x5b, 0xff, 0x13, 0x7d, 0xff, 0xd2, 0x64, 0xff, 0xaf, 0x53, 0xff, 0xab, 0x42, 0xff, 0xaa, 0x52, 0xff, 0xeb, 0x52, 0xff, 0x8e, 0x53, 0xff, 0x55, 0x6d, 0xff, 0xb6, 0x65, 0xff, 0xb7, 0x55, 0xff, 0xb7, 0x5d, 0xff, 0xb7, 0x5d, 0xff, 0x75, 0x6d, 0xff, 0xcf, 0x5b, 0xff, 0x8a, 0x52, 0xed, 0xef, 0x83, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xde, 0x07, 0xca, 0x62, 0xb4, 0xeb, 0x4a, 0xff, 0x14, 0x6d, 0xff, 0x96, 0x5d, 0xff, 0x96, 0x55, 0xff, 0xb6, 0x5d, 0xff, 0x96, 0x65, 0xff, 0x14, 0x6d, 0xff, 0x31, 0x6c, 0xff, 0x4c, 0x63, 0xff, 0xeb, 0x5a, 0xff, 0xcb, 0x5a, 0xff, 0x0c, 0x5b, 0xff, 0x50, 0x7c, 0xff, 0x34, 0x8d, 0xff, 0xf7, 0xa5, 0xff, 0x78, 0xae, 0xff, 0xda, 0xae, 0xff, 0xda, 0xae, 0xff, 0xda, 0xae, 0xff, 0xd9, 0xa6, 0xff, 0xd9, 0xa6, 0xff, 0xb9, 0x9e, 0xff, 0xb9, 0x9e, 0xff, 0xd9, 0xa6, 0xff, 0xd9, 0xae, 0xff, 0x94, 0x95, 0xff, 0xaa, 0x42, 0xff, 0x13, 0x65, 0xff, 0x9a, 0x66, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3d, 0x67, 0xff, 0xfb, 0x66, 0xff, 0x18, 0x6e, 0xff, 0xef, 0x5b, 0xff, 0x2c, 0x5b, 0xff, 0x2c, 0x5b, 0xff, 0x8a, 0x4a, 0xff, 0x6a, 0x52, 0xf6, 0x6a, 0x5a, 0xcd, 0x0c, 0x73, 0xba, 0x0b, 0x63, 0xfc, 0x71, 0x74, 0xff, 0x75, 0x6d, 0xff, 0xb6, 0x5d, 0xff, 0x97, 0x4d, 0xff, 0x97, 0x55, 0xff, 0x96, 0x65, 0xff, 0xd3, 0x6c, 0xff, 0xec, 0x52, 0xfd, 0xab, 0x5a, 0xa3, 0x18, 0xc6, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x73, 0x6b, 0xcb, 0x52, 0xf9, 0x92, 0x64, 0xff, 0x96, 0x6d, 0xff, 0xb7, 0x5d, 0xff, 0xb7, 0x5d, 0xff, 0x97, 0x5d, 0xff, 0x76, 0x65, 0xff, 0x55, 0x7d, 0xff, 0x6d, 0x6b, 0xff, 0xaa, 0x62, 0xf4, 0x0c, 0x73, 0xa4, 0xab, 0x6a, 0xb0, 0x6a, 0x5a, 0xdc, 0x6a, 0x52, 0xf5, 0x8a, 0x52, 0xfd, 0xeb, 0x5a, 0xff, 0x8d, 0x63, 0xff, 0x50, 0x74, 0xff, 0xd2, 0x84, 0xff, 0x74, 0x95, 0xff, 0xb5, 0x9d, 0xff, 0xd6, 0x9d, 0xff, 0x16, 0x9e, 0xff, 0x16, 0xa6, 0xff, 0xd6, 0xa5, 0xff, 0x75, 0xa5, 0xff, 0xea, 0x52, 0xff, 0x30, 0x5c, 0xff, 0x18, 0x6e, 0xff, 0xfb, 0x5e, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1c, 0x67, 0xff, 0x9a, 0x5e, 0xff, 0xb6, 0x6d, 0xff, 0x4d, 0x53, 0xff, 0xcb, 0x62, 0xfd, 0x8a, 0x5a, 0xe2, 0x0c, 0x6b, 0x9f, 0x6f, 0x83, 0x53, 0xf3, 0xb4, 0x17, 0xf3, 0xac, 0x21, 0xeb, 0x62, 0xd3, 0x8d, 0x63, 0xff, 0x14, 0x75, 0xff, 0x55, 0x6d, 0xff, 0x56, 0x5d, 0xff, 0x55, 0x5d, 0xff, 0x14, 0x6d, 0xff, 0x0c, 0x4b, 0xff, 0xaa, 0x5a, 0xdb, 0x92, 0x9c, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x9c, 0x21, 0xeb, 0x62, 0xda, 0xae, 0x5b, 0xff, 0x55, 0x75, 0xff, 0x96, 0x65, 0xff, 0x96, 0x5d, 0xff, 0x96, 0x5d, 0xff, 0x95, 0x6d, 0xff, 0x71, 0x64, 0xff, 0xeb, 0x5a, 0xfe, 0xcb, 0x6a, 0xab, 0x75, 0xbd, 0x12, 0x75, 0xcd, 0x09, 0x32, 0x9c, 0x19, 0x2d, 0x73, 0x49, 0xab, 0x62, 0x72, 0x8a, 0x5a, 0xa3, 0x8a, 0x5a, 0xbd, 0xaa, 0x62, 0xd2, 0xaa, 0x62, 0xe3, 0xaa, 0x5a, 0xed, 0x8a, 0x52, 0xf3, 0xaa, 0x52, 0xf6, 0xaa, 0x52, 0xf9, 0xca, 0x52, 0xfb, 0xca, 0x5a, 0xfc, 0xaa, 0x62, 0xfc, 0xeb, 0x62, 0xfd, 0x4c, 0x53, 0xff, 0xb6, 0x75, 0xff, 0x79, 0x66, 0xff, 0x1b, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x1b, 0x5f, 0xff, 0xba, 0x5e, 0xff, 0x38, 0x5e, 0xff, 0x55, 0x65, 0xff, 0xcb, 0x52, 0xff, 0x0c, 0x73, 0xc1, 0xf4, 0xb4, 0x27, 0x7a, 0xd6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x4d, 0x73, 0x61, 0x0b, 0x6b, 0xf2, 0x4d, 0x5b, 0xff, 0x92, 0x74, 0xff, 0x14, 0x7d, 0xff, 0xd3, 0x6c, 0xff, 0x4d, 0x53, 0xff, 0x6a, 0x52, 0xef, 0x0d, 0x73, 0x66, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xfd, 0x03, 0x0c, 0x6b, 0x78, 0xeb, 0x5a, 0xf8, 0x50, 0x64, 0xff, 0x55, 0x6d, 0xff, 0x75, 0x6d, 0xff, 0x75, 0x6d, 0xff, 0x91, 0x64, 0xff, 0x0c, 0x53, 0xff, 0x8a, 0x5a, 0xdc, 0x8f, 0x7b, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x18, 0xc5, 0x08, 0x10, 0x94, 0x10, 0x8f, 0x83, 0x27, 0x4d, 0x7b, 0x37, 0x2c, 0x73, 0x41, 0x0c, 0x73, 0x49, 0xec, 0x72, 0x50, 0x0c, 0x6b, 0x59, 0xeb, 0x6a, 0x63, 0x0c, 0x73, 0x6c, 0x4d, 0x7b, 0x8f, 0x0c, 0x63, 0xf1, 0x71, 0x64, 0xff, 0x38, 0x76, 0xff, 0x79, 0x5e, 0xff, 0xdb, 0x5e, 0xff, 0xdb, 0x5e, 0xff, 0xba, 0x56, 0xff, 0x39, 0x56, 0xff, 0xd7, 0x5d, 0xff, 0xd2, 0x64, 0xff, 0x6a, 0x4a, 0xfc, 0x2d, 0x7b, 0x7e, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xbc, 0x07, 0xcb, 0x6a, 0x77, 0xab, 0x62, 0xe8, 0xab, 0x5a, 0xfd, 0xeb, 0x5a, 0xff, 0xab, 0x4a, 0xfd, 0x8b, 0x5a, 0xe3, 0xcc, 0x6a, 0x73, 0x18, 0xc5, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x9c, 0x14, 0xca, 0x62, 0xa9, 0xeb, 0x5a, 0xf9, 0x6e, 0x5b, 0xff, 0xf0, 0x63, 0xff, 0x8e, 0x53, 0xff, 0xcb, 0x52, 0xff, 0x8a, 0x5a, 0xdd, 0x2d, 0x7b, 0x4a, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x59, 0xce, 0x09, 0x0c, 0x6b, 0x97, 0x2c, 0x53, 0xfc, 0x75, 0x6d, 0xff, 0x18, 0x66, 0xff, 0x39, 0x5e, 0xff, 0x5a, 0x5e, 0xff, 0x39, 0x56, 0xff, 0xf7, 0x55, 0xff, 0xb6, 0x65, 0xff, 0x10, 0x54, 0xff, 0x6a, 0x52, 0xf4, 0x6e, 0x83, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x05, 0x0c, 0x73, 0x33, 0xcb, 0x6a, 0x77, 0xcb, 0x6a, 0x93, 0xcb, 0x62, 0x78, 0x0d, 0x73, 0x35, 0xda, 0xd4, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x9c, 0x16, 0xcb, 0x6a, 0x87, 0xaa, 0x62, 0xe0, 0xca, 0x62, 0xf5, 0xaa, 0x62, 0xf0, 0x8a, 0x62, 0xba, 0x4e, 0x7b, 0x3d, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x8b, 0x23, 0xeb, 0x62, 0xce, 0x6d, 0x53, 0xff, 0x54, 0x6d, 0xff, 0xf8, 0x65, 0xff, 0x18, 0x56, 0xff, 0x18, 0x5e, 0xff, 0xb6, 0x65, 0xff, 0x34, 0x75, 0xff, 0xcb, 0x4a, 0xff, 0x6a, 0x5a, 0xd3, 0x73, 0x9c, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x00, 0x00, 0x01, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xd6, 0x05, 0xcf, 0x8b, 0x26, 0x0c, 0x73, 0x40, 0x2d, 0x73, 0x3a, 0x51, 0x9c, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x4d, 0x73, 0x4c, 0xaa, 0x52, 0xe4, 0x6d, 0x53, 0xff, 0xd3, 0x64, 0xff, 0x75, 0x75, 0xff, 0x75, 0x75, 0xff, 0x13, 0x6d, 0xff, 0x4c, 0x4b, 0xff, 0x6a, 0x52, 0xf7, 0x2d, 0x73, 0x70, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x02, 0x6e, 0x7b, 0x4e, 0xaa, 0x5a, 0xda, 0xeb, 0x5a, 0xfd, 0x2c, 0x5b, 0xff, 0x2c, 0x5b, 0xff, 0xeb, 0x5a, 0xff, 0xaa, 0x5a, 0xf8, 0xcc, 0x6a, 0x9d, 0x96, 0xcd, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xf0, 0x8b, 0x29, 0x0c, 0x6b, 0x8c, 0xcb, 0x62, 0xc4, 0x0c, 0x6b, 0xd0, 0x0c, 0x6b, 0xb8, 0x4d, 0x7b, 0x66, 0x75, 0xad, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0xb3, 0xac, 0x0c, 0xf4, 0xac, 0x12, 0x14, 0xc5, 0x08, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xff, 0xff, 0x05, 0xff, 0x1c, 0x08, 0xe7, 0x18, 0x08, 0xe7, 0x18, 0x08, 0xfe, 0xfb, 0x07, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x02, 0xcd, 0xd5, 0x12, 0xac, 0xb2, 0x2d, 0x8b, 0xef, 0x5a, 0x73, 0x2c, 0x70, 0x73, 0x2c, 0x87, 0x6a, 0xeb, 0xab, 0x62, 0xaa, 0xbb, 0x62, 0xca, 0xbf, 0x62, 0xea, 0xbe, 0x63, 0x0b, 0xb6, 0x6b, 0x0b, 0xa7, 0x73, 0x0c, 0x86, 0x73, 0x2c, 0x68, 0x8b, 0xae, 0x49, 0xa4, 0x71, 0x1f, 0xbd, 0xd4, 0x0b, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xbd, 0xf5, 0x0f, 0x83, 0xed, 0x45, 0x62, 0xca, 0x93, 0x62, 0xa9, 0xcf, 0x5a, 0xaa, 0xf0, 0x5a, 0xca, 0xf8, 0x5a, 0xcb, 0xfc, 0x52, 0xeb, 0xfe, 0x53, 0x2c, 0xff, 0x53, 0x4d, 0xff, 0x53, 0x8d, 0xff, 0x53, 0xad, 0xff, 0x53, 0x8d, 0xff, 0x53, 0x6d, 0xff, 0x53, 0x2c, 0xfe, 0x52, 0xeb, 0xfa, 0x5a, 0xcb, 0xf4, 0x5a, 0xaa, 0xe6, 0x62, 0xcb, 0xbd, 0x6a, 0xeb, 0x82, 0x83, 0xad, 0x41, 0xb5, 0x53, 0x14, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xbd, 0x75, 0x18, 0x83, 0x6d, 0x67, 0x62, 0xcb, 0xbf, 0x52, 0x89, 0xf1, 0x4a, 0x89, 0xfd, 0x42, 0xaa, 0xff, 0x4b, 0xae, 0xff, 0x5c, 0xd2, 0xff, 0x6d, 0xb6, 0xff, 0x76, 0x38, 0xff, 0x7e, 0x99, 0xff, 0x7e, 0xba, 0xff, 0x7e, 0xda, 0xff, 0x76, 0xfa, 0xff, 0x76, 0xda, 0xff, 0x76, 0xb9, 0xff, 0x76, 0x78, 0xff, 0x6d, 0xf6, 0xff, 0x5d, 0x13, 0xff, 0x4c, 0x0f, 0xff, 0x42, 0xeb, 0xff, 0x4a, 0xca, 0xfc, 0x5a, 0xca, 0xf2, 0x62, 0xeb, 0xc8, 0x7b, 0x8e, 0x7e, 0xa4, 0xb3, 0x30, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x96, 0x10, 0x83, 0xae, 0x61, 0x52, 0x48, 0xd2, 0x5a, 0xca, 0xf8, 0x4b, 0x0b, 0xff, 0x54, 0x30, 0xff, 0x75, 0xb6, 0xff, 0x86, 0x9a, 0xff, 0x7f, 0x1b, 0xff, 0x6f, 0x1b, 0xff, 0x6f, 0x3b, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x77, 0x1b, 0xff, 0x7e, 0xda, 0xff, 0x75, 0xf7, 0xff, 0x5c, 0x91, 0xff, 0x4b, 0x6d, 0xff, 0x5b, 0x2c, 0xfc, 0x5a, 0xeb, 0xe6, 0x62, 0xeb, 0xa4, 0x9c, 0x91, 0x3f, 0xe6, 0x59, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0xa4, 0x91, 0x36, 0x62, 0xeb, 0xb1, 0x4a, 0x89, 0xf7, 0x42, 0xea, 0xff, 0x5c, 0xb1, 0xff, 0x76, 0x58, 0xff, 0x76, 0xfa, 0xff, 0x77, 0x1c, 0xff, 0x6f, 0x1c, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x1c, 0xff, 0x77, 0x1b, 0xff, 0x7e, 0xba, 0xff, 0x75, 0x95, 0xff, 0x53, 0xef, 0xff, 0x53, 0x0b, 0xfe, 0x5a, 0xca, 0xee, 0x7b, 0x8d, 0xa5, 0xa4, 0xd2, 0x36, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xfb, 0x07, 0x8c, 0x0f, 0x5d, 0x5a, 0x89, 0xe0, 0x4a, 0xca, 0xfe, 0x54, 0x2f, 0xff, 0x7e, 0x58, 0xff, 0x7e, 0xfb, 0xff, 0x6f, 0x1b, 0xff, 0x67, 0x1b, 0xff, 0x6f, 0x3c, 0xff, 0x77, 0x5c, 0xff, 0x6f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x77, 0x3c, 0xff, 0x86, 0xfb, 0xff, 0x7d, 0xd7, 0xff, 0x5b, 0xef, 0xff, 0x5b, 0x2b, 0xfe, 0x63, 0x0b, 0xe5, 0x7b, 0x8d, 0x85, 0xd6, 0x37, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x16, 0x10, 0x73, 0x4c, 0x88, 0x52, 0xaa, 0xf1, 0x4b, 0x0c, 0xff, 0x6d, 0x54, 0xff, 0x8f, 0x1b, 0xff, 0x77, 0x1b, 0xff, 0x77, 0x3b, 0xff, 0x7f, 0x5c, 0xff, 0x8f, 0x9d, 0xff, 0x8f, 0xbd, 0xff, 0x97, 0xbd, 0xff, 0x87, 0xbd, 0xff, 0x6f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x5c, 0xff, 0x77, 0x3c, 0xff, 0x86, 0xda, 0xff, 0x75, 0x54, 0xff, 0x53, 0x6d, 0xff, 0x5a, 0xcb, 0xfa, 0x6a, 0xeb, 0xbd, 0x9c, 0x92, 0x32, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x37, 0x15, 0x62, 0xeb, 0x9b, 0x4a, 0x89, 0xf9, 0x4b, 0x4c, 0xff, 0x76, 0x17, 0xff, 0x7f, 0x1b, 0xff, 0x6f, 0x3b, 0xff, 0x6f, 0x5b, 0xff, 0x87, 0x9d, 0xff, 0x97, 0xbd, 0xff, 0x9f, 0x9d, 0xff, 0x9f, 0x9c, 0xff, 0x9f, 0x9c, 0xff, 0x97, 0xbd, 0xff, 0x87, 0x9d, 0xff, 0x5f, 0x3b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5c, 0xff, 0x76, 0xfb, 0xff, 0x7e, 0x58, 0xff, 0x5c, 0x50, 0xff, 0x52, 0xcb, 0xfe, 0x5a, 0xaa, 0xd8, 0x9c, 0x70, 0x4e, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x75, 0x12, 0x5a, 0x8a, 0xa5, 0x4a, 0x89, 0xfa, 0x43, 0xae, 0xff, 0x7e, 0x78, 0xff, 0x6f, 0x1b, 0xff, 0x6f, 0x3c, 0xff, 0x6f, 0x3c, 0xff, 0x7f, 0x9d, 0xff, 0x97, 0xbd, 0xff, 0xa7, 0x9c, 0xff, 0xa7, 0x9c, 0xff, 0xa7, 0x9c, 0xff, 0xa7, 0x9c, 0xff, 0x9f, 0x9d, 0xff, 0x87, 0x9d, 0xff, 0x5f, 0x3b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3b, 0xff, 0x7e, 0xda, 0xff, 0x65, 0x13, 0xff, 0x4b, 0x0b, 0xff, 0x5a, 0xca, 0xe9, 0x84, 0x0f, 0x61, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x39, 0x0d, 0x6a, 0xeb, 0x95, 0x4a, 0x69, 0xfa, 0x43, 0x8d, 0xff, 0x76, 0x99, 0xff, 0x67, 0x1b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x97, 0xbd, 0xff, 0x9f, 0x9d, 0xff, 0xa7, 0x7c, 0xff, 0xa7, 0x7c, 0xff, 0xa7, 0x9c, 0xff, 0x9f, 0x9c, 0xff, 0x97, 0xbd, 0xff, 0x77, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x7f, 0x1b, 0xff, 0x65, 0x75, 0xff, 0x4b, 0x2c, 0xff, 0x5a, 0xeb, 0xe9, 0x94, 0x71, 0x56, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x7a, 0x05, 0x6b, 0x0c, 0x7e, 0x52, 0x69, 0xf7, 0x43, 0x4c, 0xff, 0x76, 0x78, 0xff, 0x6f, 0x1b, 0xff, 0x5f, 0x3d, 0xff, 0x57, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x5c, 0xff, 0x8f, 0xbd, 0xff, 0x9f, 0x9c, 0xff, 0xa7, 0x9c, 0xff, 0xa7, 0x9c, 0xff, 0x9f, 0x9d, 0xff, 0x97, 0xbd, 0xff, 0x87, 0x7d, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x77, 0x1b, 0xff, 0x6d, 0x95, 0xff, 0x53, 0x4c, 0xff, 0x62, 0xeb, 0xde, 0x9c, 0x71, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x8b, 0xef, 0x4e, 0x5a, 0xaa, 0xec, 0x43, 0x0b, 0xff, 0x76, 0x57, 0xff, 0x6f, 0x3b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3d, 0xff, 0x57, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x87, 0xbd, 0xff, 0x97, 0xbd, 0xff, 0x97, 0x9d, 0xff, 0x97, 0xbd, 0xff, 0x8f, 0xbd, 0xff, 0x7f, 0x7c, 0xff, 0x6f, 0x3c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x7f, 0x1b, 0xff, 0x6d, 0x34, 0xff, 0x5b, 0x2c, 0xfe, 0x73, 0x2c, 0xc3, 0xc5, 0x75, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xee, 0x37, 0x5a, 0xa9, 0xdb, 0x4b, 0x0b, 0xff, 0x7e, 0x37, 0xff, 0x77, 0x3b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x7c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3c, 0xff, 0x7f, 0x7d, 0xff, 0x7f, 0x7d, 0xff, 0x7f, 0x7c, 0xff, 0x6f, 0x5b, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3c, 0xff, 0x86, 0xdb, 0xff, 0x64, 0x91, 0xff, 0x5a, 0xeb, 0xfc, 0x6b, 0x0b, 0x97, 0xce, 0x59, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x94, 0x10, 0x62, 0xa9, 0xb2, 0x4a, 0xea, 0xfd, 0x75, 0x75, 0xff, 0x7f, 0x1b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x86, 0x99, 0xff, 0x53, 0x6d, 0xff, 0x5a, 0xca, 0xf1, 0x94, 0x50, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x6b, 0x0b, 0x72, 0x52, 0xa9, 0xf7, 0x5c, 0x71, 0xff, 0x87, 0x1b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x57, 0x7d, 0xff, 0x57, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x76, 0xfb, 0xff, 0x7d, 0xd7, 0xff, 0x52, 0xeb, 0xff, 0x6a, 0xeb, 0xbe, 0xd6, 0x38, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x8e, 0x2d, 0x4a, 0xaa, 0xdf, 0x4b, 0x8d, 0xff, 0x86, 0xb9, 0xff, 0x77, 0x3b, 0xff, 0x5f, 0x7c, 0xff, 0x57, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x57, 0x7c, 0xff, 0x57, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x7d, 0xff, 0x67, 0x3c, 0xff, 0x7e, 0xdb, 0xff, 0x5c, 0x50, 0xff, 0x5a, 0xca, 0xf5, 0x7b, 0x8d, 0x61, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0x75, 0x06, 0x5a, 0xca, 0x98, 0x42, 0xca, 0xfd, 0x75, 0xb6, 0xff, 0x77, 0x3b, 0xff, 0x67, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x57, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x77, 0x3c, 0xff, 0x76, 0x38, 0xff, 0x4b, 0x0b, 0xff, 0x6b, 0x0b, 0xc0, 0xb5, 0x96, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x2c, 0x47, 0x52, 0x89, 0xeb, 0x53, 0xef, 0xff, 0x7e, 0xfa, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x7f, 0x1a, 0xff, 0x5c, 0x50, 0xff, 0x63, 0x0b, 0xf4, 0x84, 0x0f, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x55, 0x09, 0x5a, 0x48, 0xae, 0x4a, 0xaa, 0xfe, 0x6d, 0xf6, 0xff, 0x6f, 0x3b, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x57, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x1b, 0xff, 0x7e, 0x17, 0xff, 0x5b, 0x2c, 0xfe, 0x73, 0x6c, 0xa3, 0xd6, 0x7a, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xcd, 0x34, 0x52, 0x69, 0xeb, 0x4b, 0xae, 0xff, 0x7e, 0xfa, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x57, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x86, 0xda, 0xff, 0x5c, 0x0f, 0xff, 0x63, 0x0b, 0xe4, 0xa4, 0xb2, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x62, 0xca, 0x8d, 0x42, 0x89, 0xfd, 0x6d, 0xb6, 0xff, 0x6f, 0x1b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x77, 0x1b, 0xff, 0x6d, 0x54, 0xff, 0x5b, 0x2b, 0xf9, 0x73, 0x6c, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x50, 0x20, 0x5a, 0xaa, 0xd9, 0x4b, 0xae, 0xff, 0x7e, 0xda, 0xff, 0x67, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x57, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x3c, 0xff, 0x77, 0x3b, 0xff, 0x6f, 0x1b, 0xff, 0x67, 0x5b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x7e, 0x79, 0xff, 0x53, 0x4c, 0xff, 0x63, 0x0b, 0xac, 0xfe, 0xbb, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xca, 0x6a, 0x52, 0xeb, 0xf8, 0x65, 0x33, 0xff, 0x77, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x57, 0x7c, 0xff, 0x5f, 0x5b, 0xff, 0x76, 0xfa, 0xff, 0x76, 0x17, 0xff, 0x5d, 0x13, 0xff, 0x65, 0x95, 0xff, 0x7e, 0xda, 0xff, 0x6f, 0x3b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3d, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x7e, 0xdb, 0xff, 0x54, 0x0f, 0xff, 0x62, 0xea, 0xdd, 0xac, 0xd2, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x75, 0x09, 0x5a, 0xca, 0xb5, 0x42, 0xeb, 0xfe, 0x7e, 0x98, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x1b, 0xff, 0x65, 0x54, 0xff, 0x3a, 0x89, 0xff, 0x4a, 0x89, 0xff, 0x42, 0xaa, 0xff, 0x5c, 0x70, 0xff, 0x7e, 0xfa, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x77, 0x1b, 0xff, 0x76, 0x99, 0xff, 0x76, 0x78, 0xff, 0x77, 0x1b, 0xff, 0x6f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x1b, 0xff, 0x65, 0x34, 0xff, 0x52, 0xca, 0xf7, 0x7b, 0x6d, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x70, 0x2a, 0x52, 0xa9, 0xeb, 0x4b, 0xce, 0xff, 0x7f, 0x1b, 0xff, 0x6f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x5c, 0xff, 0x7e, 0xba, 0xff, 0x43, 0x0b, 0xff, 0x5a, 0x89, 0xff, 0x62, 0x68, 0xff, 0x5a, 0x89, 0xff, 0x4a, 0xeb, 0xff, 0x76, 0x58, 0xff, 0x6f, 0x1b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x7e, 0xfa, 0xff, 0x54, 0xd2, 0xff, 0x43, 0x4c, 0xff, 0x4b, 0x2c, 0xff, 0x54, 0x30, 0xff, 0x76, 0xba, 0xff, 0x6f, 0x3c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x76, 0x17, 0xff, 0x52, 0xca, 0xfd, 0x6a, 0xeb, 0x96, 0xff, 0xf5, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xad, 0x71, 0x4a, 0xa9, 0xfc, 0x6d, 0x75, 0xff, 0x6f, 0x3b, 0xff, 0x67, 0x7c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x6f, 0x3b, 0xff, 0x76, 0x18, 0xff, 0x4a, 0x89, 0xff, 0x62, 0x69, 0xff, 0x6a, 0x48, 0xff, 0x62, 0x89, 0xff, 0x5a, 0xaa, 0xff, 0x6d, 0x94, 0xff, 0x6f, 0x3b, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x3d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x57, 0x7c, 0xff, 0x57, 0x9c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x77, 0x3c, 0xff, 0x65, 0x33, 0xff, 0x4b, 0x0b, 0xff, 0x62, 0x89, 0xff, 0x62, 0x89, 0xff, 0x4a, 0xaa, 0xff, 0x54, 0x70, 0xff, 0x7e, 0xfa, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3d, 0xff, 0x67, 0x3c, 0xff, 0x76, 0x79, 0xff, 0x4b, 0x2b, 0xff, 0x62, 0xaa, 0xc5, 0xbd, 0x75, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xfb, 0x07, 0x5a, 0xa9, 0xb3, 0x42, 0xaa, 0xff, 0x7e, 0x38, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x6f, 0x3b, 0xff, 0x76, 0x38, 0xff, 0x42, 0xa9, 0xff, 0x62, 0x69, 0xff, 0x6a, 0x89, 0xff, 0x62, 0xa9, 0xff, 0x52, 0xca, 0xff, 0x6d, 0x95, 0xff, 0x6f, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x3b, 0xff, 0x6f, 0x1b, 0xff, 0x76, 0xfb, 0xff, 0x76, 0xdb, 0xff, 0x7e, 0xfb, 0xff, 0x77, 0x1b, 0xff, 0x6f, 0x3b, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x7c, 0xff, 0x7e, 0xfb, 0xff, 0x4b, 0x8d, 0xff, 0x62, 0xaa, 0xff, 0x6a, 0x48, 0xff, 0x6a, 0x48, 0xff, 0x62, 0x89, 0xff, 0x43, 0x0c, 0xff, 0x7e, 0x99, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3c, 0xff, 0x76, 0xda, 0xff, 0x53, 0xae, 0xff, 0x52, 0x69, 0xe6, 0xad, 0x14, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x96, 0x1a, 0x4a, 0x48, 0xe5, 0x4b, 0x8d, 0xff, 0x7e, 0xda, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x7e, 0xba, 0xff, 0x4b, 0x6c, 0xff, 0x62, 0xaa, 0xff, 0x6a, 0x89, 0xff, 0x5a, 0xaa, 0xff, 0x4b, 0x2b, 0xff, 0x7e, 0x58, 0xff, 0x77, 0x1b, 0xff, 0x6f, 0x1c, 0xff, 0x76, 0xfb, 0xff, 0x7e, 0xda, 0xff, 0x5d, 0x54, 0xff, 0x4c, 0x10, 0xff, 0x4b, 0xce, 0xff, 0x4b, 0xef, 0xff, 0x54, 0x50, 0xff, 0x6d, 0xb6, 0xff, 0x7e, 0xda, 0xff, 0x7f, 0x1b, 0xff, 0x77, 0x3c, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x7c, 0xff, 0x6f, 0x5c, 0xff, 0x7e, 0x99, 0xff, 0x4b, 0x4c, 0xff, 0x62, 0x8a, 0xff, 0x72, 0x68, 0xff, 0x6a, 0x68, 0xff, 0x62, 0x69, 0xff, 0x42, 0xeb, 0xff, 0x6e, 0x58, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x76, 0xfa, 0xff, 0x5c, 0x70, 0xff, 0x5a, 0xca, 0xf7, 0x8c, 0x0f, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xde, 0xfb, 0x07, 0xe6, 0x18, 0x08, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x7b, 0xae, 0x5e, 0x4a, 0x69, 0xfa, 0x64, 0xd3, 0xff, 0x76, 0xfb, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5d, 0xff, 0x77, 0x1c, 0xff, 0x75, 0xd6, 0xff, 0x4b, 0x4c, 0xff, 0x52, 0xcb, 0xff, 0x4b, 0x0b, 0xff, 0x75, 0x13, 0xff, 0x96, 0xda, 0xff, 0x7e, 0x99, 0xff, 0x6d, 0xb6, 0xff, 0x5c, 0xb2, 0xff, 0x54, 0x0f, 0xff, 0x42, 0xca, 0xff, 0x52, 0xaa, 0xff, 0x5a, 0xa9, 0xff, 0x5a, 0xaa, 0xff, 0x5a, 0xca, 0xff, 0x53, 0x0b, 0xff, 0x6c, 0xd2, 0xff, 0x6d, 0x34, 0xff, 0x65, 0x74, 0xff, 0x6e, 0x37, 0xff, 0x7e, 0xba, 0xff, 0x77, 0x1c, 0xff, 0x67, 0x3c, 0xff, 0x6f, 0x5c, 0xff, 0x7e, 0xfb, 0xff, 0x43, 0xce, 0xff, 0x5a, 0xaa, 0xff, 0x6a, 0x48, 0xff, 0x62, 0x68, 0xff, 0x5a, 0xaa, 0xff, 0x43, 0x6d, 0xff, 0x6e, 0xb9, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x6e, 0xfb, 0xff, 0x6d, 0x54, 0xff, 0x5b, 0x0b, 0xfe, 0x7b, 0x4c, 0xa7, 0xee, 0x7a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xce, 0x2a, 0x5a, 0xa9, 0x90, 0x62, 0xca, 0xa8, 0x73, 0x2b, 0x91, 0x83, 0xce, 0x5c, 0x6a, 0xeb, 0xbd, 0x4a, 0x69, 0xff, 0x75, 0xb6, 0xff, 0x67, 0x1b, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x6f, 0x5d, 0xff, 0x7f, 0x3c, 0xff, 0x76, 0x99, 0xff, 0x6d, 0xd6, 0xff, 0x7e, 0x17, 0xff, 0x8e, 0xb9, 0xff, 0x75, 0x74, 0xff, 0x43, 0xad, 0xff, 0x32, 0x89, 0xff, 0x63, 0x4c, 0xff, 0x8c, 0x71, 0xff, 0x52, 0x48, 0xff, 0x62, 0x88, 0xff, 0x6a, 0x68, 0xff, 0x6a, 0x89, 0xff, 0x6a, 0xa9, 0xff, 0x62, 0xea, 0xff, 0x8c, 0x91, 0xff, 0x8c, 0x91, 0xff, 0x53, 0x4c, 0xff, 0x4b, 0x4c, 0xff, 0x53, 0xee, 0xff, 0x65, 0x34, 0xff, 0x76, 0xda, 0xff, 0x6f, 0x3b, 0xff, 0x77, 0x3b, 0xff, 0x6d, 0xd6, 0xff, 0x32, 0xaa, 0xff, 0x52, 0x8a, 0xff, 0x4a, 0x69, 0xff, 0x3a, 0x8a, 0xff, 0x5d, 0x54, 0xff, 0x6f, 0x1b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x6f, 0x3c, 0xff, 0x7e, 0x17, 0xff, 0x5b, 0x2c, 0xff, 0x72, 0xea, 0xf6, 0x83, 0x8d, 0x70, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x14, 0x08, 0x94, 0x4f, 0x26, 0x8b, 0xef, 0x4c, 0x7b, 0x6c, 0x6a, 0x73, 0x4c, 0x9a, 0x62, 0x89, 0xf8, 0x4a, 0xaa, 0xff, 0x6d, 0xb6, 0xff, 0x67, 0x1b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x6f, 0x5c, 0xff, 0x77, 0x1a, 0xff, 0x86, 0xb9, 0xff, 0x64, 0xd2, 0xff, 0x53, 0x4c, 0xff, 0xa5, 0x54, 0xff, 0xd6, 0xfa, 0xff, 0xe7, 0x7c, 0xff, 0xe7, 0x7b, 0xff, 0xce, 0x37, 0xff, 0x62, 0xea, 0xff, 0x62, 0xa9, 0xff, 0x6a, 0xa9, 0xff, 0x6a, 0xea, 0xff, 0xb5, 0x74, 0xff, 0xef, 0x9c, 0xff, 0xef, 0x9c, 0xff, 0xef, 0x7c, 0xff, 0xd6, 0xf9, 0xff, 0xa5, 0x74, 0xff, 0x5b, 0xad, 0xff, 0x43, 0x8d, 0xff, 0x6d, 0xd6, 0xff, 0x7f, 0x1b, 0xff, 0x7f, 0x1b, 0xff, 0x6e, 0x37, 0xff, 0x54, 0x92, 0xff, 0x54, 0x51, 0xff, 0x65, 0xb6, 0xff, 0x77, 0x1b, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x86, 0xba, 0xff, 0x5b, 0x4d, 0xff, 0x72, 0xea, 0xff, 0x6a, 0xca, 0xec, 0x94, 0x10, 0x4d, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x33, 0x38, 0x62, 0xca, 0xf4, 0x4b, 0x0b, 0xff, 0x5d, 0x95, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x7e, 0xfb, 0xff, 0x64, 0xd2, 0xff, 0x5b, 0x6c, 0xff, 0xce, 0x78, 0xff, 0xef, 0x7b, 0xff, 0xe7, 0x5b, 0xff, 0xdf, 0x7b, 0xff, 0xd7, 0x5a, 0xff, 0xe7, 0x7b, 0xff, 0xd6, 0xd9, 0xff, 0x8c, 0x70, 0xff, 0x8c, 0x4f, 0xff, 0xce, 0x98, 0xff, 0xe7, 0x9c, 0xff, 0xdf, 0x9b, 0xff, 0xdf, 0x9b, 0xff, 0xe7, 0x9b, 0xff, 0xe7, 0x9b, 0xff, 0xe7, 0x9b, 0xff, 0xce, 0xd8, 0xff, 0x84, 0x50, 0xff, 0x42, 0xeb, 0xff, 0x6d, 0x54, 0xff, 0x77, 0x1b, 0xff, 0x6f, 0x3b, 0xff, 0x77, 0x1c, 0xff, 0x77, 0x1c, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x6f, 0x3c, 0xff, 0x6f, 0x3b, 0xff, 0x6f, 0x3b, 0xff, 0x6f, 0x3b, 0xff, 0x6f, 0x3b, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x7e, 0xba, 0xff, 0x5b, 0xae, 0xff, 0x6a, 0xeb, 0xff, 0x73, 0x0c, 0xff, 0x6a, 0xeb, 0xce, 0xa4, 0xf3, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xde, 0xbb, 0x06, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x50, 0x4e, 0x5a, 0xaa, 0xfa, 0x64, 0xb2, 0xff, 0x7e, 0xfb, 0xff, 0x5f, 0x3b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x6f, 0x1b, 0xff, 0x7e, 0xfb, 0xff, 0x7d, 0xd7, 0xff, 0x4b, 0x0b, 0xff, 0xc6, 0x37, 0xff, 0xe7, 0x9b, 0xff, 0xdf, 0x5a, 0xff, 0xdf, 0x7b, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x7b, 0xff, 0xdf, 0x9b, 0xff, 0xdf, 0x7b, 0xff, 0xe7, 0x9b, 0xff, 0xe7, 0x7b, 0xff, 0xe7, 0x7b, 0xff, 0xdf, 0x7b, 0xff, 0xdf, 0x7b, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x7b, 0xff, 0xdf, 0x9b, 0xff, 0xdf, 0x9a, 0xff, 0xdf, 0x5a, 0xff, 0xdf, 0x1a, 0xff, 0x84, 0x90, 0xff, 0x43, 0x0b, 0xff, 0x6e, 0x17, 0xff, 0x77, 0x1b, 0xff, 0x6f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x1b, 0xff, 0x66, 0x58, 0xff, 0x65, 0xb6, 0xff, 0x65, 0x54, 0xff, 0x54, 0xf2, 0xff, 0x4c, 0xb1, 0xff, 0x4c, 0xb2, 0xff, 0x55, 0x75, 0xff, 0x6f, 0x1b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x7e, 0xfa, 0xff, 0x5c, 0x10, 0xff, 0x5b, 0x0c, 0xff, 0x84, 0x71, 0xff, 0x6b, 0x2c, 0xfd, 0x73, 0x0b, 0xa4, 0xe7, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xa4, 0xd1, 0x22, 0x6a, 0xca, 0x7c, 0x6a, 0xaa, 0xb0, 0x6a, 0xca, 0x99, 0x8c, 0x0f, 0x38, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x8b, 0xee, 0x7d, 0x52, 0xaa, 0xfe, 0x6d, 0x34, 0xff, 0x7f, 0x1b, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x1c, 0xff, 0x76, 0xba, 0xff, 0x75, 0xd7, 0xff, 0x75, 0x34, 0xff, 0x53, 0x6d, 0xff, 0x84, 0x50, 0xff, 0xd6, 0xd9, 0xff, 0xe7, 0x9b, 0xff, 0xdf, 0x9b, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x7b, 0xff, 0xdf, 0x9b, 0xff, 0xdf, 0x7b, 0xff, 0xdf, 0x7b, 0xff, 0xdf, 0x7b, 0xff, 0xdf, 0x7b, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x9a, 0xff, 0xdf, 0x7a, 0xff, 0xdf, 0x3a, 0xff, 0xde, 0xfa, 0xff, 0x73, 0xae, 0xff, 0x5c, 0x50, 0xff, 0x96, 0xda, 0xff, 0x7f, 0x1b, 0xff, 0x6f, 0x3b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x66, 0xba, 0xff, 0x2b, 0xcf, 0xff, 0x3b, 0xf0, 0xff, 0x44, 0x30, 0xff, 0x4c, 0x51, 0xff, 0x4c, 0x51, 0xff, 0x4c, 0x72, 0xff, 0x44, 0xb2, 0xff, 0x67, 0x1b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x76, 0xda, 0xff, 0x5c, 0x30, 0xff, 0x53, 0x4c, 0xff, 0x95, 0x95, 0xff, 0x63, 0xce, 0xff, 0x62, 0xcb, 0xf3, 0x8b, 0xef, 0x59, 0xff, 0xff, 0x01, 0xfd, 0x75, 0x03, 0x83, 0x6d, 0x52, 0x5a, 0xa9, 0xd6, 0x52, 0xca, 0xfc, 0x52, 0xeb, 0xff, 0x5a, 0xeb, 0xfe, 0x62, 0xaa, 0xd6, 0x9c, 0x50, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x04, 0xbd, 0x75, 0x2a, 0x8b, 0xee, 0x64, 0x6a, 0xca, 0xd7, 0x52, 0xab, 0xff, 0x3b, 0xae, 0xff, 0x66, 0xba, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x56, 0x18, 0xff, 0x2c, 0x10, 0xff, 0x4b, 0xef, 0xff, 0x5b, 0x8e, 0xff, 0x52, 0xaa, 0xff, 0x63, 0x2b, 0xff, 0x84, 0x8f, 0xff, 0xdf, 0x9b, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x9b, 0xff, 0xdf, 0x9c, 0xff, 0xdf, 0x9b, 0xff, 0xd7, 0x7b, 0xff, 0xdf, 0x7b, 0xff, 0xdf, 0x7b, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x9a, 0xff, 0xd7, 0x9a, 0xff, 0xd7, 0x7a, 0xff, 0xdf, 0x5a, 0xff, 0xc6, 0x37, 0xff, 0x83, 0xef, 0xff, 0x5b, 0x0b, 0xff, 0x64, 0x30, 0xff, 0x64, 0xf3, 0xff, 0x65, 0xb6, 0xff, 0x6e, 0xba, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x3c, 0xff, 0x6f, 0x1c, 0xff, 0x76, 0xfb, 0xff, 0x77, 0x1b, 0xff, 0x77, 0x1b, 0xff, 0x77, 0x1c, 0xff, 0x77, 0x3c, 0xff, 0x77, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x76, 0xfa, 0xff, 0x54, 0x50, 0xff, 0x43, 0x4c, 0xff, 0x85, 0xf6, 0xff, 0x85, 0xd6, 0xff, 0x52, 0xeb, 0xff, 0x62, 0xcb, 0xcc, 0xbd, 0xb6, 0x1f, 0x8b, 0xce, 0x45, 0x62, 0xaa, 0xe3, 0x42, 0xca, 0xff, 0x65, 0x13, 0xff, 0x7e, 0x17, 0xff, 0x6c, 0xf2, 0xff, 0x52, 0xca, 0xfd, 0x6a, 0xeb, 0x8f, 0xfd, 0x75, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x96, 0x16, 0x73, 0x6d, 0x88, 0x6a, 0xca, 0xbe, 0x73, 0x2b, 0x8f, 0x6a, 0xcb, 0xde, 0x4a, 0xeb, 0xff, 0x7e, 0x58, 0xff, 0x6f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x1c, 0xff, 0x6e, 0xdb, 0xff, 0x86, 0xb9, 0xff, 0x85, 0x74, 0xff, 0x52, 0xea, 0xff, 0xce, 0x78, 0xff, 0xdf, 0x3a, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x7a, 0xff, 0xdf, 0x7a, 0xff, 0x9d, 0x32, 0xff, 0x9c, 0xd2, 0xff, 0x62, 0xea, 0xff, 0x63, 0xce, 0xff, 0x64, 0xb2, 0xff, 0x3c, 0x10, 0xff, 0x34, 0x51, 0xff, 0x6f, 0x1b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x76, 0xda, 0xff, 0x4c, 0x30, 0xff, 0x3b, 0x6d, 0xff, 0x75, 0xf7, 0xff, 0x7e, 0xd9, 0xff, 0x5c, 0xb2, 0xff, 0x52, 0x8a, 0xfc, 0x7b, 0x2c, 0xa7, 0x62, 0x89, 0xd9, 0x4a, 0xaa, 0xff, 0x6d, 0x74, 0xff, 0x7f, 0x1a, 0xff, 0x77, 0x1b, 0xff, 0x7e, 0x98, 0xff, 0x4b, 0x6d, 0xff, 0x5a, 0xaa, 0xce, 0xcd, 0xd7, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x4c, 0x3e, 0x62, 0xeb, 0x6a, 0x9c, 0x70, 0x25, 0xce, 0x57, 0x12, 0x63, 0x0b, 0xcf, 0x53, 0x8e, 0xff, 0x7e, 0xfb, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3b, 0xff, 0x76, 0xfa, 0xff, 0x75, 0x74, 0xff, 0x53, 0x0a, 0xff, 0xc6, 0x57, 0xff, 0xd7, 0x1a, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9b, 0xff, 0xcf, 0x5b, 0xff, 0xc7, 0x3a, 0xff, 0xbe, 0xf9, 0xff, 0xcf, 0x5b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9a, 0xff, 0xd7, 0x9a, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x9b, 0xff, 0xdf, 0x7b, 0xff, 0xe7, 0x9b, 0xff, 0xef, 0x7b, 0xff, 0x83, 0xce, 0xff, 0x74, 0xd2, 0xff, 0x8f, 0x1b, 0xff, 0x7f, 0x3b, 0xff, 0x6f, 0x3c, 0xff, 0x6f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x66, 0x59, 0xff, 0x6e, 0x79, 0xff, 0x76, 0xdb, 0xff, 0x77, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x76, 0xba, 0xff, 0x43, 0xef, 0xff, 0x3b, 0xad, 0xff, 0x66, 0x18, 0xff, 0x66, 0xda, 0xff, 0x76, 0x78, 0xff, 0x42, 0xeb, 0xff, 0x5a, 0x69, 0xfe, 0x52, 0x89, 0xff, 0x54, 0x30, 0xff, 0x7e, 0xda, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x76, 0xda, 0xff, 0x5c, 0x30, 0xff, 0x5a, 0x8a, 0xe7, 0xa4, 0x92, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x95, 0x1a, 0x52, 0xaa, 0xe8, 0x4b, 0xef, 0xff, 0x7f, 0x1b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x57, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5b, 0xff, 0x6e, 0xda, 0xff, 0x7d, 0x95, 0xff, 0x52, 0xca, 0xff, 0x6b, 0x6c, 0xff, 0xae, 0x16, 0xff, 0xd7, 0xbb, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x7c, 0xff, 0xcf, 0x5b, 0xff, 0xbe, 0xd9, 0xff, 0xae, 0x78, 0xff, 0xa6, 0x16, 0xff, 0xb6, 0xb9, 0xff, 0xc7, 0x1a, 0xff, 0xcf, 0x7b, 0xff, 0xd7, 0x9a, 0xff, 0xd7, 0x9a, 0xff, 0xd7, 0x7a, 0xff, 0xdf, 0x7b, 0xff, 0xdf, 0x7b, 0xff, 0xdf, 0x7b, 0xff, 0xc6, 0x77, 0xff, 0xef, 0x1a, 0xff, 0x7b, 0xcf, 0xff, 0x64, 0xd2, 0xff, 0x7f, 0x1b, 0xff, 0x67, 0x3b, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3c, 0xff, 0x3c, 0x92, 0xff, 0x2b, 0x6e, 0xff, 0x44, 0x10, 0xff, 0x5d, 0x74, 0xff, 0x76, 0xba, 0xff, 0x77, 0x3b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x1b, 0xff, 0x6e, 0x99, 0xff, 0x43, 0xae, 0xff, 0x4c, 0x0f, 0xff, 0x5e, 0x38, 0xff, 0x5e, 0xfa, 0xff, 0x76, 0xfa, 0xff, 0x64, 0xd2, 0xff, 0x52, 0xcb, 0xff, 0x4a, 0xca, 0xff, 0x7e, 0x17, 0xff, 0x6f, 0x1b, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x77, 0x1b, 0xff, 0x5c, 0x91, 0xff, 0x62, 0xeb, 0xf0, 0x9c, 0x71, 0x38, 0xff, 0xff, 0x01, 0xd6, 0x9a, 0x0b, 0xcd, 0x96, 0x0d, 0xe6, 0x59, 0x09, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xb1, 0x24, 0x52, 0xca, 0xee, 0x54, 0x91, 0xff, 0x77, 0x3b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5b, 0xff, 0x77, 0x1b, 0xff, 0x76, 0x38, 0xff, 0x53, 0xce, 0xff, 0x5a, 0xeb, 0xff, 0x9d, 0x12, 0xff, 0xd7, 0x3b, 0xff, 0xc7, 0x5b, 0xff, 0xc7, 0x5b, 0xff, 0xc7, 0x5b, 0xff, 0xc7, 0x5a, 0xff, 0xbe, 0xf9, 0xff, 0xb6, 0x99, 0xff, 0xae, 0x17, 0xff, 0x74, 0x50, 0xff, 0x53, 0x0b, 0xff, 0x95, 0x54, 0xff, 0xae, 0x78, 0xff, 0xb6, 0xf9, 0xff, 0xc7, 0x7b, 0xff, 0xcf, 0x9b, 0xff, 0xd7, 0x7b, 0xff, 0xdf, 0x7b, 0xff, 0xdf, 0x7b, 0xff, 0xdf, 0x7b, 0xff, 0x84, 0x2e, 0xff, 0x73, 0x4c, 0xff, 0x62, 0xcb, 0xff, 0x6c, 0xd3, 0xff, 0x86, 0xfb, 0xff, 0x6f, 0x5c, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5c, 0xff, 0x77, 0x3c, 0xff, 0x76, 0x99, 0xff, 0x54, 0xf3, 0xff, 0x3b, 0x8e, 0xff, 0x3b, 0x8d, 0xff, 0x65, 0x95, 0xff, 0x7f, 0x1b, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x1b, 0xff, 0x6e, 0x38, 0xff, 0x43, 0xcf, 0xff, 0x4c, 0x91, 0xff, 0x5e, 0x79, 0xff, 0x5f, 0x1b, 0xff, 0x6e, 0xfb, 0xff, 0x7e, 0x37, 0xff, 0x43, 0x2b, 0xff, 0x43, 0x0b, 0xff, 0x7e, 0x78, 0xff, 0x67, 0x3b, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x1a, 0xff, 0x5c, 0x70, 0xff, 0x63, 0x0b, 0xfa, 0x94, 0x10, 0x88, 0x7b, 0xad, 0x89, 0x62, 0xeb, 0xc5, 0x62, 0xcb, 0xd0, 0x62, 0xeb, 0xbd, 0x63, 0x0b, 0x85, 0x8b, 0xee, 0x3e, 0xbd, 0x34, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xee, 0x2b, 0x52, 0xca, 0xf1, 0x65, 0x13, 0xff, 0x77, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x65, 0xb6, 0xff, 0x33, 0xcf, 0xff, 0x75, 0x75, 0xff, 0x64, 0x2f, 0xff, 0x5b, 0x4c, 0xff, 0x9d, 0x74, 0xff, 0xb6, 0x78, 0xff, 0xb6, 0x58, 0xff, 0xae, 0x57, 0xff, 0xa6, 0x36, 0xff, 0xa5, 0xf5, 0xff, 0x95, 0x13, 0xff, 0x5b, 0x4c, 0xff, 0x53, 0x6c, 0xff, 0x5b, 0x6d, 0xff, 0x4b, 0x0b, 0xff, 0x84, 0xf2, 0xff, 0xa6, 0x57, 0xff, 0xae, 0x98, 0xff, 0xbf, 0x1a, 0xff, 0xc7, 0x5b, 0xff, 0xc7, 0x5b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x3a, 0xff, 0xd6, 0xfa, 0xff, 0x9c, 0xf2, 0xff, 0x52, 0xcb, 0xff, 0x4b, 0x4c, 0xff, 0x6d, 0xb6, 0xff, 0x77, 0x1b, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x7c, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x5c, 0xff, 0x7f, 0x3c, 0xff, 0x7e, 0x99, 0xff, 0x5c, 0xf3, 0xff, 0x2b, 0x8d, 0xff, 0x4d, 0x54, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x1b, 0xff, 0x65, 0xf8, 0xff, 0x3b, 0xcf, 0xff, 0x55, 0x33, 0xff, 0x5e, 0x99, 0xff, 0x5f, 0x1b, 0xff, 0x67, 0x1b, 0xff, 0x7e, 0xda, 0xff, 0x4b, 0xce, 0xff, 0x3a, 0xca, 0xff, 0x6d, 0xf6, 0xff, 0x67, 0x3b, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x76, 0xfa, 0xff, 0x54, 0x0f, 0xff, 0x62, 0xeb, 0xff, 0x62, 0xeb, 0xfd, 0x53, 0x0b, 0xfe, 0x4b, 0x4c, 0xff, 0x4b, 0x6d, 0xff, 0x4b, 0x2c, 0xff, 0x4a, 0xca, 0xfd, 0x5a, 0xca, 0xef, 0x5a, 0xaa, 0x9f, 0xbd, 0x74, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x6c, 0x3a, 0x4a, 0xaa, 0xf4, 0x65, 0x54, 0xff, 0x6f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5e, 0x58, 0xff, 0x3c, 0x92, 0xff, 0x76, 0xba, 0xff, 0x7f, 0x1b, 0xff, 0x86, 0x98, 0xff, 0x53, 0xee, 0xff, 0x5b, 0x0b, 0xff, 0x73, 0xad, 0xff, 0x84, 0x50, 0xff, 0x84, 0x50, 0xff, 0x7b, 0xee, 0xff, 0x5b, 0x2c, 0xff, 0x4a, 0xeb, 0xff, 0x5c, 0x10, 0xff, 0x6d, 0x34, 0xff, 0x6d, 0x74, 0xff, 0x54, 0x70, 0xff, 0x43, 0x2c, 0xff, 0x74, 0x0f, 0xff, 0xa5, 0xd6, 0xff, 0xae, 0x98, 0xff, 0xae, 0x98, 0xff, 0xa6, 0x98, 0xff, 0xae, 0x77, 0xff, 0xbe, 0x57, 0xff, 0xa5, 0x95, 0xff, 0x5b, 0x8d, 0xff, 0x4b, 0xae, 0xff, 0x75, 0x54, 0xff, 0x3b, 0xae, 0xff, 0x4d, 0x13, 0xff, 0x6f, 0x1b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x7d, 0xff, 0x67, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x77, 0x1b, 0xff, 0x6e, 0xba, 0xff, 0x5e, 0x38, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x1b, 0xff, 0x5d, 0xf7, 0xff, 0x2b, 0xef, 0xff, 0x55, 0xd6, 0xff, 0x5e, 0xda, 0xff, 0x57, 0x3c, 0xff, 0x5f, 0x3c, 0xff, 0x7f, 0x3b, 0xff, 0x5c, 0xf2, 0xff, 0x43, 0x0b, 0xff, 0x5d, 0x53, 0xff, 0x6f, 0x3b, 0xff, 0x67, 0x7d, 0xff, 0x67, 0x3c, 0xff, 0x76, 0xb9, 0xff, 0x43, 0x6d, 0xff, 0x53, 0x0b, 0xff, 0x4b, 0x8d, 0xff, 0x6d, 0x95, 0xff, 0x7e, 0xb9, 0xff, 0x7e, 0xba, 0xff, 0x76, 0x59, 0xff, 0x6d, 0x75, 0xff, 0x4b, 0x4d, 0xff, 0x52, 0xca, 0xf8, 0x6b, 0x0c, 0x6c, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x6d, 0x4e, 0x4a, 0xca, 0xf7, 0x65, 0x75, 0xff, 0x6f, 0x3b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x1b, 0xff, 0x6f, 0x1c, 0xff, 0x6f, 0x1c, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x1b, 0xff, 0x7d, 0xd6, 0xff, 0x63, 0x4c, 0xff, 0x83, 0xae, 0xff, 0x73, 0x2c, 0xff, 0x62, 0xca, 0xff, 0x62, 0x8a, 0xff, 0x52, 0xaa, 0xff, 0x6c, 0xd2, 0xff, 0x65, 0x75, 0xff, 0x5d, 0xb6, 0xff, 0x55, 0xd6, 0xff, 0x65, 0xf6, 0xff, 0x6d, 0x14, 0xff, 0x53, 0xae, 0xff, 0x53, 0x2c, 0xff, 0x7c, 0x2f, 0xff, 0x95, 0x33, 0xff, 0x9d, 0x74, 0xff, 0x94, 0xf3, 0xff, 0x83, 0xef, 0xff, 0x53, 0x0c, 0xff, 0x4b, 0xae, 0xff, 0x7e, 0x58, 0xff, 0x7e, 0xda, 0xff, 0x7e, 0xba, 0xff, 0x44, 0xb2, 0xff, 0x55, 0xd7, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x3b, 0xff, 0x4d, 0xf7, 0xff, 0x34, 0xd3, 0xff, 0x5e, 0x99, 0xff, 0x5f, 0x1b, 0xff, 0x57, 0x5c, 0xff, 0x57, 0x3c, 0xff, 0x6f, 0x3b, 0xff, 0x75, 0xf6, 0xff, 0x43, 0x2b, 0xff, 0x54, 0x91, 0xff, 0x77, 0x1b, 0xff, 0x67, 0x7c, 0xff, 0x67, 0x3c, 0xff, 0x66, 0x58, 0xff, 0x2b, 0x2c, 0xff, 0x4c, 0x0f, 0xff, 0x7e, 0x99, 0xff, 0x77, 0x3c, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x1c, 0xff, 0x6e, 0xdb, 0xff, 0x75, 0xd7, 0xff, 0x4b, 0x0b, 0xff, 0x52, 0xaa, 0xb6, 0xbd, 0xd7, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x4c, 0x5a, 0x52, 0xca, 0xf8, 0x6d, 0x75, 0xff, 0x6f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3b, 0xff, 0x7e, 0x58, 0xff, 0x5b, 0x8d, 0xff, 0xe6, 0xba, 0xff, 0xef, 0x5c, 0xff, 0xe6, 0xfa, 0xff, 0xa4, 0xd2, 0xff, 0x53, 0x2c, 0xff, 0x75, 0xf7, 0xff, 0x5e, 0x59, 0xff, 0x4e, 0x38, 0xff, 0x56, 0x38, 0xff, 0x56, 0x17, 0xff, 0x66, 0x17, 0xff, 0x75, 0x96, 0xff, 0x53, 0x6d, 0xff, 0x73, 0x6d, 0xff, 0x7b, 0x6d, 0xff, 0x6b, 0x0b, 0xff, 0x73, 0x0b, 0xff, 0x62, 0xaa, 0xff, 0x53, 0xae, 0xff, 0x7e, 0x58, 0xff, 0x77, 0x3c, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x3b, 0xff, 0x6f, 0x3b, 0xff, 0x66, 0xdb, 0xff, 0x67, 0x3d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x56, 0xda, 0xff, 0x56, 0x9a, 0xff, 0x5e, 0xfb, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x7e, 0x99, 0xff, 0x3b, 0x0b, 0xff, 0x4c, 0x0f, 0xff, 0x76, 0xfb, 0xff, 0x67, 0x7d, 0xff, 0x67, 0x5d, 0xff, 0x66, 0x9a, 0xff, 0x5d, 0x95, 0xff, 0x7e, 0xda, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x6e, 0x9a, 0xff, 0x4b, 0xae, 0xff, 0x52, 0xaa, 0xd4, 0x7b, 0xad, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x6d, 0x55, 0x52, 0xca, 0xf7, 0x6d, 0x95, 0xff, 0x6f, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x76, 0xb9, 0xff, 0x4b, 0xad, 0xff, 0xce, 0x38, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x9c, 0xd2, 0xff, 0x53, 0xae, 0xff, 0x7e, 0xda, 0xff, 0x5f, 0x3c, 0xff, 0x56, 0xfb, 0xff, 0x5e, 0xfb, 0xff, 0x56, 0xba, 0xff, 0x56, 0x99, 0xff, 0x6e, 0x38, 0xff, 0x53, 0xce, 0xff, 0xb5, 0x75, 0xff, 0xff, 0x9d, 0xff, 0xf7, 0x3c, 0xff, 0xe6, 0x9a, 0xff, 0x5b, 0x0c, 0xff, 0x65, 0x33, 0xff, 0x77, 0x1b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x7c, 0xff, 0x7e, 0xda, 0xff, 0x3b, 0x2c, 0xff, 0x43, 0x8d, 0xff, 0x76, 0xfb, 0xff, 0x67, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x6e, 0xda, 0xff, 0x54, 0x0f, 0xff, 0x52, 0xca, 0xd5, 0x7b, 0x8d, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x6d, 0x50, 0x52, 0xca, 0xf6, 0x65, 0x75, 0xff, 0x6f, 0x1c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x7e, 0xfa, 0xff, 0x4b, 0xef, 0xff, 0xa5, 0x14, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xde, 0xff, 0x94, 0x71, 0xff, 0x5c, 0x50, 0xff, 0x76, 0xfb, 0xff, 0x67, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x1c, 0xff, 0x76, 0x9a, 0xff, 0x5c, 0x10, 0xff, 0xa5, 0x34, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xce, 0x18, 0xff, 0x42, 0xcb, 0xff, 0x76, 0x38, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x76, 0xfa, 0xff, 0x43, 0xae, 0xff, 0x33, 0x6c, 0xff, 0x76, 0xfa, 0xff, 0x67, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x76, 0xba, 0xff, 0x53, 0xae, 0xff, 0x5a, 0xcb, 0xba, 0x94, 0x92, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x6c, 0x43, 0x52, 0xaa, 0xf4, 0x65, 0x34, 0xff, 0x6f, 0x1c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x77, 0x1b, 0xff, 0x5c, 0xb2, 0xff, 0x6b, 0x8d, 0xff, 0xf7, 0x9d, 0xff, 0xff, 0x9d, 0xff, 0x7b, 0xcf, 0xff, 0x64, 0xf3, 0xff, 0x76, 0xfb, 0xff, 0x67, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x77, 0x1b, 0xff, 0x5c, 0x91, 0xff, 0x9c, 0xd3, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xdd, 0xff, 0x9c, 0xd2, 0xff, 0x43, 0x6d, 0xff, 0x76, 0xfb, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5c, 0xff, 0x76, 0xfb, 0xff, 0x3c, 0x10, 0xff, 0x33, 0xae, 0xff, 0x76, 0xfb, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3d, 0xff, 0x77, 0x1c, 0xff, 0x76, 0x17, 0xff, 0x53, 0x0c, 0xfc, 0x62, 0xeb, 0x88, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x6d, 0x2b, 0x52, 0xaa, 0xef, 0x65, 0x14, 0xff, 0x77, 0x1c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x6f, 0x1b, 0xff, 0x75, 0xd7, 0xff, 0x4a, 0xca, 0xff, 0xce, 0x37, 0xff, 0xf7, 0x7c, 0xff, 0x63, 0x2c, 0xff, 0x75, 0x75, 0xff, 0x77, 0x1c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5d, 0xff, 0x77, 0x1b, 0xff, 0x64, 0xf2, 0xff, 0x94, 0x91, 0xff, 0xff, 0xde, 0xff, 0xf7, 0x7c, 0xff, 0x52, 0xeb, 0xff, 0x65, 0x14, 0xff, 0x77, 0x1c, 0xff, 0x67, 0x3d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x6e, 0xfb, 0xff, 0x44, 0xb2, 0xff, 0x3c, 0x71, 0xff, 0x6f, 0x1b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x3c, 0xff, 0x7e, 0xda, 0xff, 0x5c, 0x71, 0xff, 0x5a, 0xeb, 0xec, 0x83, 0xcf, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x0f, 0x1e, 0x52, 0xa9, 0xe7, 0x5c, 0xb2, 0xff, 0x77, 0x1c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x7e, 0xdb, 0xff, 0x53, 0xae, 0xff, 0x73, 0x8e, 0xff, 0xde, 0x79, 0xff, 0x53, 0x0b, 0xff, 0x75, 0xf7, 0xff, 0x6f, 0x3c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x77, 0x1c, 0xff, 0x65, 0x34, 0xff, 0x8c, 0x50, 0xff, 0xff, 0xbe, 0xff, 0xc5, 0xd7, 0xff, 0x42, 0xec, 0xff, 0x76, 0x7a, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x1b, 0xff, 0x56, 0x18, 0xff, 0x5e, 0x58, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x77, 0x1b, 0xff, 0x6d, 0xb5, 0xff, 0x53, 0x0b, 0xfd, 0x5a, 0xeb, 0xb0, 0xce, 0x59, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf2, 0x1a, 0x4a, 0xa9, 0xe0, 0x4c, 0x0f, 0xff, 0x76, 0xfb, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x77, 0x1c, 0xff, 0x7e, 0x18, 0xff, 0x43, 0x2c, 0xff, 0x5b, 0x4c, 0xff, 0x4b, 0xae, 0xff, 0x7e, 0x99, 0xff, 0x6f, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x6f, 0x3c, 0xff, 0x6d, 0xd6, 0xff, 0x6b, 0x8d, 0xff, 0xde, 0xba, 0xff, 0x63, 0x2d, 0xff, 0x5c, 0x92, 0xff, 0x76, 0xfc, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x6f, 0x1b, 0xff, 0x76, 0xba, 0xff, 0x6d, 0xb6, 0xff, 0x4b, 0x6d, 0xff, 0x5a, 0xeb, 0xdd, 0x83, 0xef, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x73, 0x0f, 0x4a, 0x89, 0xcd, 0x43, 0x6d, 0xff, 0x7e, 0xbb, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5c, 0xff, 0x77, 0x3b, 0xff, 0x76, 0x38, 0xff, 0x54, 0x91, 0xff, 0x6d, 0xd6, 0xff, 0x77, 0x3b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x3b, 0xff, 0x76, 0x98, 0xff, 0x43, 0x4c, 0xff, 0x5b, 0x6d, 0xff, 0x4b, 0x6e, 0xff, 0x7e, 0x9a, 0xff, 0x6f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3d, 0xff, 0x67, 0x3d, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x1b, 0xff, 0x56, 0xfa, 0xff, 0x56, 0xda, 0xff, 0x5e, 0x79, 0xff, 0x6d, 0xf8, 0xff, 0x64, 0xf3, 0xff, 0x4b, 0x4c, 0xff, 0x5a, 0xeb, 0xea, 0x6b, 0x2c, 0x5e, 0xfc, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x75, 0x03, 0x5a, 0xca, 0x9d, 0x3a, 0xeb, 0xfe, 0x76, 0x59, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x3c, 0xff, 0x77, 0x3c, 0xff, 0x77, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x77, 0x1b, 0xff, 0x65, 0xd6, 0xff, 0x5d, 0x14, 0xff, 0x7e, 0x79, 0xff, 0x77, 0x5c, 0xff, 0x67, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x3c, 0xff, 0x5e, 0xfb, 0xff, 0x5e, 0xbb, 0xff, 0x56, 0x79, 0xff, 0x56, 0x38, 0xff, 0x5d, 0xd7, 0xff, 0x65, 0xb5, 0xff, 0x65, 0x34, 0xff, 0x53, 0xcf, 0xff, 0x42, 0x8a, 0xfe, 0x52, 0xaa, 0xe6, 0x6b, 0x2c, 0x65, 0xc6, 0x18, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x62, 0xeb, 0x79, 0x42, 0xaa, 0xfb, 0x65, 0x96, 0xff, 0x6f, 0x1c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x6f, 0x1c, 0xff, 0x77, 0x1c, 0xff, 0x6f, 0x3c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3d, 0xff, 0x67, 0x5d, 0xff, 0x5e, 0xfb, 0xff, 0x5e, 0x79, 0xff, 0x66, 0x59, 0xff, 0x66, 0x17, 0xff, 0x6d, 0x96, 0xff, 0x5c, 0xd3, 0xff, 0x53, 0xce, 0xff, 0x42, 0xca, 0xff, 0x4a, 0x69, 0xf5, 0x52, 0x69, 0xbf, 0x73, 0x2c, 0x4a, 0xc6, 0x18, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x4d, 0x42, 0x42, 0x89, 0xf3, 0x54, 0x72, 0xff, 0x6e, 0xbb, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3c, 0xff, 0x57, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3c, 0xff, 0x5e, 0x7a, 0xff, 0x6d, 0xd7, 0xff, 0x5c, 0x91, 0xff, 0x43, 0x4c, 0xff, 0x4a, 0xcb, 0xff, 0x52, 0x8a, 0xfd, 0x52, 0x89, 0xf2, 0x52, 0x89, 0xbe, 0x73, 0x4c, 0x5c, 0xbd, 0x75, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xb1, 0x21, 0x4a, 0x8a, 0xdb, 0x43, 0x6d, 0xff, 0x6e, 0x38, 0xff, 0x67, 0x1b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x7d, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x7d, 0xff, 0x57, 0x5d, 0xff, 0x57, 0x5d, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5e, 0xdb, 0xff, 0x6e, 0x18, 0xff, 0x64, 0x72, 0xff, 0x42, 0xaa, 0xfd, 0x4a, 0x89, 0xeb, 0x5a, 0x69, 0xc3, 0x62, 0xaa, 0x8f, 0x73, 0x2c, 0x4a, 0xac, 0xd3, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xbb, 0x06, 0x5a, 0xaa, 0xb4, 0x42, 0xab, 0xff, 0x65, 0x34, 0xff, 0x6e, 0xba, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3b, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x3b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x57, 0x7d, 0xff, 0x57, 0x7d, 0xff, 0x57, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x5e, 0x59, 0xff, 0x75, 0xd6, 0xff, 0x53, 0x2d, 0xff, 0x52, 0x8a, 0xd8, 0x7b, 0xae, 0x42, 0xac, 0xd1, 0x0f, 0xff, 0xf0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x0b, 0x6f, 0x52, 0x8a, 0xfa, 0x54, 0x30, 0xff, 0x66, 0x17, 0xff, 0x67, 0x1b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x1b, 0xff, 0x77, 0x3b, 0xff, 0x87, 0x7c, 0xff, 0x97, 0x9c, 0xff, 0x9f, 0xbd, 0xff, 0x97, 0x9d, 0xff, 0x8f, 0x7c, 0xff, 0x87, 0x5b, 0xff, 0x77, 0x3b, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x66, 0xba, 0xff, 0x65, 0xf7, 0xff, 0x64, 0xf3, 0xff, 0x52, 0xeb, 0xf9, 0x73, 0x8d, 0x66, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x0f, 0x2a, 0x52, 0x49, 0xe5, 0x4b, 0x4d, 0xff, 0x65, 0x95, 0xff, 0x66, 0x7a, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x6f, 0x1c, 0xff, 0x77, 0x1b, 0xff, 0x9f, 0x9d, 0xff, 0xaf, 0xfd, 0xff, 0xb7, 0xfd, 0xff, 0xbf, 0xfd, 0xff, 0xc7, 0xfd, 0xff, 0xc7, 0xfd, 0xff, 0xc7, 0xfd, 0xff, 0xbf, 0xfd, 0xff, 0xaf, 0xdd, 0xff, 0x97, 0x7c, 0xff, 0x77, 0x1b, 0xff, 0x6f, 0x3b, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x66, 0xfb, 0xff, 0x66, 0x38, 0xff, 0x6d, 0xb6, 0xff, 0x63, 0xef, 0xff, 0x5a, 0xcb, 0xdd, 0x9c, 0x92, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x7a, 0x05, 0x62, 0xaa, 0xa1, 0x42, 0xaa, 0xfe, 0x5c, 0xd3, 0xff, 0x6e, 0x18, 0xff, 0x66, 0x9a, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x1b, 0xff, 0x87, 0x3b, 0xff, 0xaf, 0xdd, 0xff, 0xbf, 0xfd, 0xff, 0xc7, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xc7, 0xfc, 0xff, 0xbf, 0xfd, 0xff, 0xaf, 0xdd, 0xff, 0x87, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x5f, 0x5b, 0xff, 0x5f, 0x7c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x1c, 0xff, 0x5e, 0x59, 0xff, 0x65, 0xb6, 0xff, 0x6d, 0x34, 0xff, 0x5b, 0x2c, 0xfd, 0x73, 0x0c, 0x93, 0xfe, 0x7a, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xae, 0x4c, 0x4a, 0xa9, 0xf4, 0x54, 0x0f, 0xff, 0x6d, 0xb6, 0xff, 0x66, 0x39, 0xff, 0x5e, 0xdb, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x1b, 0xff, 0x87, 0x3b, 0xff, 0xaf, 0xfd, 0xff, 0xbf, 0xfd, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xd7, 0xdb, 0xff, 0xd7, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xfc, 0xff, 0xc7, 0xfc, 0xff, 0xb7, 0xfe, 0xff, 0x8f, 0x7c, 0xff, 0x6f, 0x3b, 0xff, 0x5f, 0x7c, 0xff, 0x57, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x56, 0x9a, 0xff, 0x55, 0xf7, 0xff, 0x6d, 0x96, 0xff, 0x5c, 0x10, 0xff, 0x5a, 0xeb, 0xeb, 0x83, 0xef, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x94, 0x13, 0x5a, 0xca, 0xc6, 0x4b, 0x0b, 0xff, 0x6d, 0x34, 0xff, 0x5d, 0xd6, 0xff, 0x5e, 0x59, 0xff, 0x5e, 0xfb, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x5d, 0xff, 0x5f, 0x3c, 0xff, 0x77, 0x1b, 0xff, 0xaf, 0xdd, 0xff, 0xc7, 0xfc, 0xff, 0xcf, 0xfc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xc7, 0xfc, 0xff, 0xbf, 0xfd, 0xff, 0x97, 0x7c, 0xff, 0x67, 0x3b, 0xff, 0x57, 0x7c, 0xff, 0x57, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x5d, 0xff, 0x57, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x1c, 0xff, 0x56, 0x9a, 0xff, 0x55, 0xd7, 0xff, 0x5d, 0x96, 0xff, 0x6c, 0xf3, 0xff, 0x52, 0xec, 0xfe, 0x6b, 0x0c, 0xa3, 0xfe, 0xfb, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x73, 0x4c, 0x70, 0x52, 0xca, 0xf9, 0x5c, 0x30, 0xff, 0x5d, 0x75, 0xff, 0x55, 0xf7, 0xff, 0x56, 0x7a, 0xff, 0x5e, 0xfb, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x1c, 0xff, 0x97, 0x9d, 0xff, 0xbf, 0xfd, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xc7, 0xdc, 0xff, 0xc7, 0xdd, 0xff, 0xb7, 0xfe, 0xff, 0x7f, 0x5b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x3c, 0xff, 0x56, 0x9a, 0xff, 0x4e, 0x18, 0xff, 0x55, 0xb6, 0xff, 0x6d, 0x55, 0xff, 0x53, 0x6d, 0xff, 0x5a, 0xcb, 0xe9, 0x94, 0x71, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x55, 0x1a, 0x5a, 0xaa, 0xd4, 0x4a, 0xeb, 0xff, 0x65, 0x13, 0xff, 0x55, 0x96, 0xff, 0x55, 0xf8, 0xff, 0x56, 0x79, 0xff, 0x5e, 0xfb, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x7f, 0x5c, 0xff, 0xb7, 0xfe, 0xff, 0xcf, 0xfd, 0xff, 0xd7, 0xdc, 0xff, 0xd7, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xc7, 0xfd, 0xff, 0xa7, 0xdd, 0xff, 0x6f, 0x1b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3c, 0xff, 0x5e, 0xdb, 0xff, 0x56, 0x18, 0xff, 0x55, 0xb7, 0xff, 0x65, 0x75, 0xff, 0x64, 0x51, 0xff, 0x4a, 0x69, 0xfb, 0x6b, 0x0c, 0x97, 0xc6, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x7b, 0x8d, 0x75, 0x4a, 0x89, 0xfa, 0x53, 0xce, 0xff, 0x5d, 0x54, 0xff, 0x55, 0xb6, 0xff, 0x55, 0xf8, 0xff, 0x56, 0x79, 0xff, 0x5e, 0xfb, 0xff, 0x6f, 0x1b, 0xff, 0x9f, 0x9c, 0xff, 0xc7, 0xfd, 0xff, 0xcf, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xbf, 0xfd, 0xff, 0x8f, 0x5b, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5e, 0xdb, 0xff, 0x4e, 0x39, 0xff, 0x55, 0xd7, 0xff, 0x5d, 0x95, 0xff, 0x6d, 0x13, 0xff, 0x4a, 0xca, 0xff, 0x5a, 0x89, 0xd1, 0x94, 0x51, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x96, 0x17, 0x52, 0x68, 0xd0, 0x42, 0x89, 0xff, 0x5c, 0xb2, 0xff, 0x5d, 0x75, 0xff, 0x55, 0xb6, 0xff, 0x4d, 0xf8, 0xff, 0x56, 0x79, 0xff, 0x6e, 0x99, 0xff, 0xaf, 0xbd, 0xff, 0xcf, 0xfd, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xc7, 0xfc, 0xff, 0xa7, 0xdd, 0xff, 0x6f, 0x3b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x5e, 0xdb, 0xff, 0x56, 0x59, 0xff, 0x55, 0xf7, 0xff, 0x5d, 0xb6, 0xff, 0x6d, 0x34, 0xff, 0x53, 0x8d, 0xff, 0x52, 0xaa, 0xee, 0x83, 0xce, 0x52, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x8b, 0xcf, 0x4f, 0x52, 0x69, 0xee, 0x42, 0xec, 0xff, 0x65, 0x14, 0xff, 0x5d, 0x96, 0xff, 0x55, 0xd7, 0xff, 0x55, 0xf8, 0xff, 0x6e, 0x38, 0xff, 0xb7, 0x9c, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xfc, 0xff, 0xcf, 0xfc, 0xff, 0xb7, 0xfd, 0xff, 0x7f, 0x3b, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x1b, 0xff, 0x56, 0xda, 0xff, 0x56, 0x38, 0xff, 0x55, 0xf8, 0xff, 0x5d, 0xd7, 0xff, 0x65, 0xb6, 0xff, 0x64, 0x71, 0xff, 0x5a, 0xcb, 0xfa, 0x6b, 0x0b, 0x91, 0xde, 0xb5, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xbb, 0x06, 0x6b, 0x2c, 0x80, 0x4a, 0x8a, 0xf8, 0x4b, 0x6d, 0xff, 0x6d, 0x55, 0xff, 0x5d, 0xb6, 0xff, 0x55, 0xd7, 0xff, 0x6d, 0xf7, 0xff, 0xb7, 0x5c, 0xff, 0xbf, 0x5b, 0xff, 0xbf, 0x9b, 0xff, 0xc7, 0xbc, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xc7, 0xdc, 0xff, 0xc7, 0xfd, 0xff, 0x97, 0x9c, 0xff, 0x67, 0x3b, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x57, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x5e, 0xdb, 0xff, 0x4e, 0x59, 0xff, 0x4e, 0x18, 0xff, 0x55, 0xf7, 0xff, 0x55, 0xd7, 0xff, 0x5d, 0xb6, 0xff, 0x64, 0xf3, 0xff, 0x53, 0x0b, 0xfe, 0x62, 0xcb, 0xc4, 0xa4, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x0c, 0x63, 0x0c, 0x99, 0x52, 0xaa, 0xfb, 0x53, 0xaf, 0xff, 0x6d, 0x76, 0xff, 0x5d, 0xd7, 0xff, 0x6d, 0xf7, 0xff, 0x9e, 0xfb, 0xff, 0xa6, 0xfa, 0xff, 0xaf, 0x3a, 0xff, 0xb7, 0x5b, 0xff, 0xbf, 0x7b, 0xff, 0xc7, 0x9c, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xfc, 0xff, 0xcf, 0xfc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xfc, 0xff, 0xcf, 0xfd, 0xff, 0xaf, 0xdd, 0xff, 0x6f, 0x3b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x5e, 0xdb, 0xff, 0x4e, 0x59, 0xff, 0x4e, 0x18, 0xff, 0x4d, 0xf7, 0xff, 0x4d, 0xd7, 0xff, 0x55, 0xb6, 0xff, 0x55, 0xb6, 0xff, 0x65, 0x95, 0xff, 0x5b, 0xce, 0xff, 0x5a, 0xeb, 0xf1, 0x8c, 0x0f, 0x49, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x76, 0x19, 0x62, 0xcb, 0xc3, 0x52, 0xab, 0xff, 0x53, 0xcf, 0xff, 0x6d, 0x55, 0xff, 0x6d, 0xb6, 0xff, 0x96, 0xda, 0xff, 0x9e, 0xd9, 0xff, 0xa6, 0xf9, 0xff, 0xaf, 0x1a, 0xff, 0xaf, 0x3b, 0xff, 0xb7, 0x5b, 0xff, 0xbf, 0x7c, 0xff, 0xc7, 0x9c, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xfd, 0xff, 0xb7, 0xfe, 0xff, 0x77, 0x3b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x57, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x1c, 0xff, 0x56, 0x9a, 0xff, 0x4e, 0x18, 0xff, 0x4d, 0xf8, 0xff, 0x55, 0xd7, 0xff, 0x55, 0xb7, 0xff, 0x4d, 0xb7, 0xff, 0x55, 0xb6, 0xff, 0x55, 0x96, 0xff, 0x65, 0x54, 0xff, 0x53, 0x6d, 0xff, 0x5a, 0x8a, 0xd3, 0xd5, 0xf7, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x7b, 0x4c, 0x76, 0x52, 0x69, 0xfc, 0x4a, 0x8a, 0xff, 0x4b, 0x6e, 0xff, 0x75, 0x34, 0xff, 0x96, 0x99, 0xff, 0x9e, 0xfa, 0xff, 0x9e, 0xf9, 0xff, 0x9e, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xa7, 0x1a, 0xff, 0xaf, 0x3b, 0xff, 0xb7, 0x3b, 0xff, 0xbf, 0x7b, 0xff, 0xc7, 0x7b, 0xff, 0xc7, 0x9c, 0xff, 0xc7, 0xbc, 0xff, 0xc7, 0xbc, 0xff, 0xc7, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xbb, 0xff, 0xc7, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0xbb, 0xff, 0xc7, 0xdc, 0xff, 0xbf, 0xfe, 0xff, 0x7f, 0x3b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x1c, 0xff, 0x5e, 0xba, 0xff, 0x56, 0x59, 0xff, 0x56, 0x39, 0xff, 0x4e, 0x18, 0xff, 0x4d, 0xd7, 0xff, 0x55, 0xb7, 0xff, 0x55, 0xb7, 0xff, 0x55, 0x97, 0xff, 0x55, 0x96, 0xff, 0x55, 0x96, 0xff, 0x55, 0x75, 0xff, 0x6d, 0x13, 0xff, 0x53, 0x2c, 0xff, 0x5a, 0xaa, 0xb1, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x2c, 0x64, 0x52, 0x68, 0xfb, 0x52, 0xca, 0xff, 0x4a, 0xcb, 0xff, 0x4b, 0x2d, 0xff, 0x95, 0xf6, 0xff, 0xa6, 0xd9, 0xff, 0x9e, 0xf9, 0xff, 0x9e, 0xd9, 0xff, 0x9e, 0xd9, 0xff, 0x9e, 0xfa, 0xff, 0x9e, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xa7, 0x1a, 0xff, 0xaf, 0x1a, 0xff, 0xb7, 0x3a, 0xff, 0xb7, 0x5a, 0xff, 0xb7, 0x5b, 0xff, 0xbf, 0x7b, 0xff, 0xbf, 0x9b, 0xff, 0xbf, 0x9b, 0xff, 0xbf, 0xbb, 0xff, 0xc7, 0x9b, 0xff, 0xcf, 0xbc, 0xff, 0xc7, 0xbc, 0xff, 0xc7, 0xdc, 0xff, 0xc7, 0xfd, 0xff, 0x97, 0x3b, 0xff, 0x6f, 0x3b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x1c, 0xff, 0x66, 0xdb, 0xff, 0x5e, 0x9a, 0xff, 0x56, 0x59, 0xff, 0x4e, 0x18, 0xff, 0x4d, 0xf8, 0xff, 0x4d, 0xf7, 0xff, 0x4d, 0xd7, 0xff, 0x4d, 0xd6, 0xff, 0x55, 0xd6, 0xff, 0x5d, 0xd7, 0xff, 0x55, 0x96, 0xff, 0x55, 0x97, 0xff, 0x55, 0x96, 0xff, 0x55, 0x96, 0xff, 0x5d, 0x55, 0xff, 0x64, 0xb2, 0xff, 0x52, 0xca, 0xfc, 0x6b, 0x0c, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x0b, 0x55, 0x52, 0x69, 0xfb, 0x74, 0x10, 0xff, 0x63, 0xcf, 0xff, 0x42, 0xcb, 0xff, 0x4b, 0x2c, 0xff, 0x8d, 0x95, 0xff, 0xae, 0xb9, 0xff, 0xa6, 0xd9, 0xff, 0xa6, 0xd9, 0xff, 0x9e, 0xfa, 0xff, 0x9e, 0xfa, 0xff, 0x9e, 0xfa, 0xff, 0x9e, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xa7, 0x1a, 0xff, 0xaf, 0x1a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xb7, 0x3a, 0xff, 0xb7, 0x5a, 0xff, 0xb7, 0x5b, 0xff, 0xbf, 0x7b, 0xff, 0xbf, 0x9b, 0xff, 0xc7, 0x9c, 0xff, 0xc7, 0xdd, 0xff, 0x86, 0x16, 0xff, 0x6e, 0x98, 0xff, 0x6f, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x3c, 0xff, 0x6e, 0xfb, 0xff, 0x4d, 0x34, 0xff, 0x55, 0x75, 0xff, 0x55, 0xb6, 0xff, 0x4d, 0xb7, 0xff, 0x4d, 0xb7, 0xff, 0x4d, 0xb7, 0xff, 0x55, 0xb7, 0xff, 0x5d, 0xb6, 0xff, 0x65, 0xb6, 0xff, 0x65, 0x96, 0xff, 0x4c, 0xb2, 0xff, 0x55, 0x76, 0xff, 0x55, 0xb7, 0xff, 0x55, 0x96, 0xff, 0x5d, 0x76, 0xff, 0x65, 0x35, 0xff, 0x5c, 0x30, 0xff, 0x4a, 0x69, 0xf2, 0x94, 0x51, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x2c, 0x49, 0x52, 0xaa, 0xf8, 0x6c, 0x30, 0xff, 0x75, 0x34, 0xff, 0x53, 0xef, 0xff, 0x4a, 0xcb, 0xff, 0x4a, 0xcb, 0xff, 0x74, 0x71, 0xff, 0xae, 0x78, 0xff, 0xae, 0xda, 0xff, 0xa6, 0xfa, 0xff, 0x9e, 0xfa, 0xff, 0x9e, 0xfa, 0xff, 0x9e, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0x9e, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xa7, 0x1a, 0xff, 0xa6, 0xfa, 0xff, 0xaf, 0x1a, 0xff, 0xa7, 0x1a, 0xff, 0xb7, 0x5a, 0xff, 0xbf, 0x5b, 0xff, 0x5c, 0x2f, 0xff, 0x54, 0xf2, 0xff, 0x6e, 0xba, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5c, 0xff, 0x76, 0xba, 0xff, 0x44, 0x31, 0xff, 0x4c, 0x50, 0xff, 0x5d, 0x75, 0xff, 0x55, 0x96, 0xff, 0x55, 0x96, 0xff, 0x55, 0x96, 0xff, 0x5d, 0x96, 0xff, 0x65, 0x55, 0xff, 0x64, 0xf3, 0xff, 0x43, 0x8e, 0xff, 0x43, 0xf0, 0xff, 0x65, 0x96, 0xff, 0x5d, 0xb7, 0xff, 0x55, 0x96, 0xff, 0x5d, 0x96, 0xff, 0x6d, 0x55, 0xff, 0x53, 0x8d, 0xff, 0x5a, 0xaa, 0xcd, 0xc5, 0x96, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xae, 0x3d, 0x5a, 0xaa, 0xf2, 0x5b, 0xaf, 0xff, 0x75, 0x55, 0xff, 0x6d, 0x55, 0xff, 0x64, 0x92, 0xff, 0x4b, 0x2c, 0xff, 0x52, 0xcb, 0xff, 0x53, 0x0c, 0xff, 0x84, 0xd2, 0xff, 0xae, 0x37, 0xff, 0xb6, 0xfa, 0xff, 0xa6, 0xda, 0xff, 0xa6, 0xf9, 0xff, 0x9e, 0xf9, 0xff, 0x9e, 0xf9, 0xff, 0x9e, 0xfa, 0xff, 0x9e, 0xfa, 0xff, 0x9e, 0xfa, 0xff, 0x9e, 0xfa, 0xff, 0x9e, 0xda, 0xff, 0xa6, 0xda, 0xff, 0xa6, 0xda, 0xff, 0x9e, 0xda, 0xff, 0x9e, 0xf9, 0xff, 0xa7, 0x1a, 0xff, 0xb6, 0xfa, 0xff, 0x64, 0x0f, 0xff, 0x43, 0xce, 0xff, 0x6e, 0x18, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x6f, 0x5c, 0xff, 0x6e, 0x79, 0xff, 0x4c, 0x51, 0xff, 0x54, 0x10, 0xff, 0x65, 0x34, 0xff, 0x5d, 0x55, 0xff, 0x65, 0x76, 0xff, 0x65, 0x14, 0xff, 0x54, 0x0f, 0xff, 0x4b, 0x4c, 0xff, 0x43, 0x0c, 0xff, 0x4b, 0xf0, 0xff, 0x6d, 0x76, 0xff, 0x65, 0x97, 0xff, 0x5d, 0x97, 0xff, 0x5d, 0xb6, 0xff, 0x65, 0x75, 0xff, 0x75, 0x14, 0xff, 0x52, 0xca, 0xfd, 0x6b, 0x4c, 0x88, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x0f, 0x20, 0x5a, 0x8a, 0xdd, 0x53, 0x4d, 0xff, 0x6d, 0x35, 0xff, 0x5d, 0x76, 0xff, 0x65, 0x75, 0xff, 0x6d, 0x34, 0xff, 0x5c, 0x50, 0xff, 0x53, 0x4d, 0xff, 0x53, 0x0b, 0xff, 0x53, 0x0b, 0xff, 0x6b, 0xef, 0xff, 0x9d, 0xd6, 0xff, 0xae, 0xb9, 0xff, 0xae, 0xd9, 0xff, 0xae, 0xfa, 0xff, 0xa6, 0xda, 0xff, 0x9e, 0xda, 0xff, 0x9e, 0xfa, 0xff, 0x9e, 0xda, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0x9e, 0xda, 0xff, 0x9e, 0xfa, 0xff, 0x96, 0xf9, 0xff, 0x9e, 0xd9, 0xff, 0xae, 0xfa, 0xff, 0x7c, 0xb1, 0xff, 0x3b, 0x0b, 0xff, 0x6d, 0xb6, 0xff, 0x67, 0x1c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5d, 0xff, 0x6f, 0x3c, 0xff, 0x6e, 0x58, 0xff, 0x54, 0x30, 0xff, 0x5b, 0xef, 0xff, 0x7d, 0x13, 0xff, 0x64, 0xd2, 0xff, 0x53, 0xaf, 0xff, 0x42, 0xab, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xeb, 0xff, 0x53, 0x8e, 0xff, 0x6d, 0x55, 0xff, 0x65, 0xb6, 0xff, 0x55, 0xb7, 0xff, 0x5d, 0xb7, 0xff, 0x5d, 0xb7, 0xff, 0x6d, 0x75, 0xff, 0x5b, 0xcf, 0xff, 0x52, 0x8a, 0xed, 0x83, 0xef, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xfb, 0x07, 0x62, 0xca, 0xb4, 0x4a, 0xeb, 0xff, 0x6d, 0x14, 0xff, 0x5d, 0x96, 0xff, 0x55, 0x96, 0xff, 0x5d, 0xb6, 0xff, 0x65, 0x96, 0xff, 0x6d, 0x14, 0xff, 0x6c, 0x31, 0xff, 0x63, 0x4c, 0xff, 0x5a, 0xeb, 0xff, 0x5a, 0xcb, 0xff, 0x5b, 0x0c, 0xff, 0x7c, 0x50, 0xff, 0x8d, 0x34, 0xff, 0xa5, 0xf7, 0xff, 0xae, 0x78, 0xff, 0xae, 0xda, 0xff, 0xae, 0xda, 0xff, 0xae, 0xda, 0xff, 0xa6, 0xd9, 0xff, 0xa6, 0xd9, 0xff, 0x9e, 0xb9, 0xff, 0x9e, 0xb9, 0xff, 0xa6, 0xd9, 0xff, 0xae, 0xd9, 0xff, 0x95, 0x94, 0xff, 0x42, 0xaa, 0xff, 0x65, 0x13, 0xff, 0x66, 0x9a, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3d, 0xff, 0x66, 0xfb, 0xff, 0x6e, 0x18, 0xff, 0x5b, 0xef, 0xff, 0x5b, 0x2c, 0xff, 0x5b, 0x2c, 0xff, 0x4a, 0x8a, 0xff, 0x52, 0x6a, 0xf6, 0x5a, 0x6a, 0xcd, 0x73, 0x0c, 0xba, 0x63, 0x0b, 0xfc, 0x74, 0x71, 0xff, 0x6d, 0x75, 0xff, 0x5d, 0xb6, 0xff, 0x4d, 0x97, 0xff, 0x55, 0x97, 0xff, 0x65, 0x96, 0xff, 0x6c, 0xd3, 0xff, 0x52, 0xec, 0xfd, 0x5a, 0xab, 0xa3, 0xc6, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x2c, 0x6b, 0x52, 0xcb, 0xf9, 0x64, 0x92, 0xff, 0x6d, 0x96, 0xff, 0x5d, 0xb7, 0xff, 0x5d, 0xb7, 0xff, 0x5d, 0x97, 0xff, 0x65, 0x76, 0xff, 0x7d, 0x55, 0xff, 0x6b, 0x6d, 0xff, 0x62, 0xaa, 0xf4, 0x73, 0x0c, 0xa4, 0x6a, 0xab, 0xb0, 0x5a, 0x6a, 0xdc, 0x52, 0x6a, 0xf5, 0x52, 0x8a, 0xfd, 0x5a, 0xeb, 0xff, 0x63, 0x8d, 0xff, 0x74, 0x50, 0xff, 0x84, 0xd2, 0xff, 0x95, 0x74, 0xff, 0x9d, 0xb5, 0xff, 0x9d, 0xd6, 0xff, 0x9e, 0x16, 0xff, 0xa6, 0x16, 0xff, 0xa5, 0xd6, 0xff, 0xa5, 0x75, 0xff, 0x52, 0xea, 0xff, 0x5c, 0x30, 0xff, 0x6e, 0x18, 0xff, 0x5e, 0xfb, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x1c, 0xff, 0x5e, 0x9a, 0xff, 0x6d, 0xb6, 0xff, 0x53, 0x4d, 0xff, 0x62, 0xcb, 0xfd, 0x5a, 0x8a, 0xe2, 0x6b, 0x0c, 0x9f, 0x83, 0x6f, 0x53, 0xb4, 0xf3, 0x17, 0xac, 0xf3, 0x21, 0x62, 0xeb, 0xd3, 0x63, 0x8d, 0xff, 0x75, 0x14, 0xff, 0x6d, 0x55, 0xff, 0x5d, 0x56, 0xff, 0x5d, 0x55, 0xff, 0x6d, 0x14, 0xff, 0x4b, 0x0c, 0xff, 0x5a, 0xaa, 0xdb, 0x9c, 0x92, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x71, 0x21, 0x62, 0xeb, 0xda, 0x5b, 0xae, 0xff, 0x75, 0x55, 0xff, 0x65, 0x96, 0xff, 0x5d, 0x96, 0xff, 0x5d, 0x96, 0xff, 0x6d, 0x95, 0xff, 0x64, 0x71, 0xff, 0x5a, 0xeb, 0xfe, 0x6a, 0xcb, 0xab, 0xbd, 0x75, 0x12, 0xcd, 0x75, 0x09, 0x9c, 0x32, 0x19, 0x73, 0x2d, 0x49, 0x62, 0xab, 0x72, 0x5a, 0x8a, 0xa3, 0x5a, 0x8a, 0xbd, 0x62, 0xaa, 0xd2, 0x62, 0xaa, 0xe3, 0x5a, 0xaa, 0xed, 0x52, 0x8a, 0xf3, 0x52, 0xaa, 0xf6, 0x52, 0xaa, 0xf9, 0x52, 0xca, 0xfb, 0x5a, 0xca, 0xfc, 0x62, 0xaa, 0xfc, 0x62, 0xeb, 0xfd, 0x53, 0x4c, 0xff, 0x75, 0xb6, 0xff, 0x66, 0x79, 0xff, 0x5f, 0x1b, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x1b, 0xff, 0x5e, 0xba, 0xff, 0x5e, 0x38, 0xff, 0x65, 0x55, 0xff, 0x52, 0xcb, 0xff, 0x73, 0x0c, 0xc1, 0xb4, 0xf4, 0x27, 0xd6, 0x7a, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x73, 0x4d, 0x61, 0x6b, 0x0b, 0xf2, 0x5b, 0x4d, 0xff, 0x74, 0x92, 0xff, 0x7d, 0x14, 0xff, 0x6c, 0xd3, 0xff, 0x53, 0x4d, 0xff, 0x52, 0x6a, 0xef, 0x73, 0x0d, 0x66, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x75, 0x03, 0x6b, 0x0c, 0x78, 0x5a, 0xeb, 0xf8, 0x64, 0x50, 0xff, 0x6d, 0x55, 0xff, 0x6d, 0x75, 0xff, 0x6d, 0x75, 0xff, 0x64, 0x91, 0xff, 0x53, 0x0c, 0xff, 0x5a, 0x8a, 0xdc, 0x7b, 0x8f, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0xc5, 0x18, 0x08, 0x94, 0x10, 0x10, 0x83, 0x8f, 0x27, 0x7b, 0x4d, 0x37, 0x73, 0x2c, 0x41, 0x73, 0x0c, 0x49, 0x72, 0xec, 0x50, 0x6b, 0x0c, 0x59, 0x6a, 0xeb, 0x63, 0x73, 0x0c, 0x6c, 0x7b, 0x4d, 0x8f, 0x63, 0x0c, 0xf1, 0x64, 0x71, 0xff, 0x76, 0x38, 0xff, 0x5e, 0x79, 0xff, 0x5e, 0xdb, 0xff, 0x5e, 0xdb, 0xff, 0x56, 0xba, 0xff, 0x56, 0x39, 0xff, 0x5d, 0xd7, 0xff, 0x64, 0xd2, 0xff, 0x4a, 0x6a, 0xfc, 0x7b, 0x2d, 0x7e, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xb2, 0x07, 0x6a, 0xcb, 0x77, 0x62, 0xab, 0xe8, 0x5a, 0xab, 0xfd, 0x5a, 0xeb, 0xff, 0x4a, 0xab, 0xfd, 0x5a, 0x8b, 0xe3, 0x6a, 0xcc, 0x73, 0xc5, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x72, 0x14, 0x62, 0xca, 0xa9, 0x5a, 0xeb, 0xf9, 0x5b, 0x6e, 0xff, 0x63, 0xf0, 0xff, 0x53, 0x8e, 0xff, 0x52, 0xcb, 0xff, 0x5a, 0x8a, 0xdd, 0x7b, 0x2d, 0x4a, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xce, 0x59, 0x09, 0x6b, 0x0c, 0x97, 0x53, 0x2c, 0xfc, 0x6d, 0x75, 0xff, 0x66, 0x18, 0xff, 0x5e, 0x39, 0xff, 0x5e, 0x5a, 0xff, 0x56, 0x39, 0xff, 0x55, 0xf7, 0xff, 0x65, 0xb6, 0xff, 0x54, 0x10, 0xff, 0x52, 0x6a, 0xf4, 0x83, 0x6e, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x05, 0x73, 0x0c, 0x33, 0x6a, 0xcb, 0x77, 0x6a, 0xcb, 0x93, 0x62, 0xcb, 0x78, 0x73, 0x0d, 0x35, 0xd4, 0xda, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x71, 0x16, 0x6a, 0xcb, 0x87, 0x62, 0xaa, 0xe0, 0x62, 0xca, 0xf5, 0x62, 0xaa, 0xf0, 0x62, 0x8a, 0xba, 0x7b, 0x4e, 0x3d, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xf0, 0x23, 0x62, 0xeb, 0xce, 0x53, 0x6d, 0xff, 0x6d, 0x54, 0xff, 0x65, 0xf8, 0xff, 0x56, 0x18, 0xff, 0x5e, 0x18, 0xff, 0x65, 0xb6, 0xff, 0x75, 0x34, 0xff, 0x4a, 0xcb, 0xff, 0x5a, 0x6a, 0xd3, 0x9c, 0x73, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x01, 0x00, 0x00, 0x01, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x7a, 0x05, 0x8b, 0xcf, 0x26, 0x73, 0x0c, 0x40, 0x73, 0x2d, 0x3a, 0x9c, 0x51, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x73, 0x4d, 0x4c, 0x52, 0xaa, 0xe4, 0x53, 0x6d, 0xff, 0x64, 0xd3, 0xff, 0x75, 0x75, 0xff, 0x75, 0x75, 0xff, 0x6d, 0x13, 0xff, 0x4b, 0x4c, 0xff, 0x52, 0x6a, 0xf7, 0x73, 0x2d, 0x70, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x02, 0x7b, 0x6e, 0x4e, 0x5a, 0xaa, 0xda, 0x5a, 0xeb, 0xfd, 0x5b, 0x2c, 0xff, 0x5b, 0x2c, 0xff, 0x5a, 0xeb, 0xff, 0x5a, 0xaa, 0xf8, 0x6a, 0xcc, 0x9d, 0xcd, 0x96, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x8b, 0xf0, 0x29, 0x6b, 0x0c, 0x8c, 0x62, 0xcb, 0xc4, 0x6b, 0x0c, 0xd0, 0x6b, 0x0c, 0xb8, 0x7b, 0x4d, 0x66, 0xad, 0x75, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0xac, 0xb3, 0x0c, 0xac, 0xf4, 0x12, 0xc5, 0x14, 0x08, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x05, 0xdf, 0xdf, 0xff, 0x08, 0xbf, 0xdf, 0xdf, 0x08, 0xbf, 0xdf, 0xdf, 0x08, 0xdb, 0xdb, 0xff, 0x07, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0x02, 0xaa, 0xb8, 0xc6, 0x12, 0x8e, 0x93, 0xa4, 0x2d, 0x74, 0x7d, 0x88, 0x5a, 0x62, 0x64, 0x72, 0x70, 0x5e, 0x64, 0x6e, 0x87, 0x58, 0x5c, 0x67, 0xab, 0x53, 0x55, 0x62, 0xbb, 0x51, 0x57, 0x5d, 0xbf, 0x52, 0x5a, 0x5d, 0xbe, 0x55, 0x5e, 0x61, 0xb6, 0x59, 0x5f, 0x65, 0xa7, 0x5d, 0x61, 0x6e, 0x86, 0x5d, 0x62, 0x6c, 0x68, 0x6c, 0x73, 0x85, 0x49, 0x84, 0x8c, 0x9c, 0x1f, 0xa2, 0xb9, 0xb9, 0x0b, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xaa, 0xbb, 0xbb, 0x0f, 0x6b, 0x7a, 0x7e, 0x45, 0x50, 0x58, 0x5f, 0x93, 0x4b, 0x54, 0x5c, 0xcf, 0x4c, 0x52, 0x57, 0xf0, 0x52, 0x56, 0x58, 0xf8, 0x56, 0x58, 0x55, 0xfc, 0x5b, 0x5d, 0x53, 0xfe, 0x61, 0x62, 0x4f, 0xff, 0x67, 0x69, 0x4e, 0xff, 0x6a, 0x6e, 0x4c, 0xff, 0x6b, 0x73, 0x4c, 0xff, 0x6a, 0x71, 0x4d, 0xff, 0x66, 0x6b, 0x4e, 0xff, 0x60, 0x63, 0x50, 0xfe, 0x58, 0x5c, 0x53, 0xfa, 0x55, 0x57, 0x57, 0xf4, 0x51, 0x53, 0x5b, 0xe6, 0x54, 0x56, 0x61, 0xbd, 0x54, 0x5a, 0x64, 0x82, 0x6a, 0x72, 0x7e, 0x41, 0x99, 0xa6, 0xb3, 0x14, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xaa, 0xaa, 0xb5, 0x18, 0x6a, 0x6d, 0x7c, 0x67, 0x55, 0x59, 0x61, 0xbf, 0x47, 0x4f, 0x4e, 0xf1, 0x46, 0x51, 0x46, 0xfd, 0x4c, 0x55, 0x3e, 0xff, 0x6e, 0x75, 0x49, 0xff, 0x91, 0x98, 0x5a, 0xff, 0xad, 0xb4, 0x69, 0xff, 0xbe, 0xc4, 0x72, 0xff, 0xc8, 0xcf, 0x75, 0xff, 0xcd, 0xd4, 0x76, 0xff, 0xcf, 0xd7, 0x74, 0xff, 0xd0, 0xda, 0x73, 0xff, 0xcd, 0xd6, 0x71, 0xff, 0xca, 0xd3, 0x73, 0xff, 0xc3, 0xcc, 0x71, 0xff, 0xb3, 0xbb, 0x69, 0xff, 0x99, 0xa0, 0x59, 0xff, 0x7a, 0x7e, 0x49, 0xff, 0x57, 0x5c, 0x3d, 0xff, 0x52, 0x59, 0x49, 0xfc, 0x4f, 0x57, 0x54, 0xf2, 0x55, 0x5b, 0x62, 0xc8, 0x71, 0x71, 0x7b, 0x7e, 0x95, 0x95, 0x9f, 0x30, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xaf, 0xbf, 0x10, 0x6c, 0x74, 0x7c, 0x61, 0x42, 0x49, 0x4e, 0xd2, 0x52, 0x57, 0x54, 0xf8, 0x59, 0x5f, 0x47, 0xff, 0x80, 0x85, 0x52, 0xff, 0xb1, 0xb5, 0x6f, 0xff, 0xcc, 0xd1, 0x7c, 0xff, 0xd8, 0xdf, 0x79, 0xff, 0xda, 0xe0, 0x6a, 0xff, 0xdb, 0xe2, 0x64, 0xff, 0xdc, 0xe3, 0x61, 0xff, 0xde, 0xe6, 0x5e, 0xff, 0xe0, 0xe8, 0x5b, 0xff, 0xe1, 0xe8, 0x59, 0xff, 0xe2, 0xe9, 0x5a, 0xff, 0xe1, 0xe9, 0x5b, 0xff, 0xdf, 0xe8, 0x5d, 0xff, 0xde, 0xe8, 0x60, 0xff, 0xdd, 0xe6, 0x63, 0xff, 0xdb, 0xe2, 0x67, 0xff, 0xda, 0xe1, 0x72, 0xff, 0xd0, 0xd6, 0x75, 0xff, 0xb4, 0xba, 0x6c, 0xff, 0x8b, 0x90, 0x56, 0xff, 0x6a, 0x6d, 0x49, 0xff, 0x5f, 0x62, 0x56, 0xfc, 0x5a, 0x5d, 0x59, 0xe6, 0x5a, 0x5c, 0x60, 0xa4, 0x86, 0x8e, 0x96, 0x3f, 0xc6, 0xc6, 0xe3, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0x89, 0x8e, 0x9c, 0x36, 0x54, 0x5c, 0x63, 0xb1, 0x46, 0x4e, 0x4b, 0xf7, 0x53, 0x5b, 0x43, 0xff, 0x8b, 0x93, 0x59, 0xff, 0xbc, 0xc7, 0x70, 0xff, 0xd2, 0xda, 0x72, 0xff, 0xdd, 0xe0, 0x6e, 0xff, 0xdc, 0xdf, 0x64, 0xff, 0xdf, 0xe5, 0x5d, 0xff, 0xe3, 0xe9, 0x5a, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe4, 0xe5, 0x5a, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe6, 0xea, 0x55, 0xff, 0xe8, 0xeb, 0x56, 0xff, 0xe8, 0xea, 0x56, 0xff, 0xe7, 0xea, 0x56, 0xff, 0xe5, 0xea, 0x58, 0xff, 0xe4, 0xea, 0x59, 0xff, 0xe4, 0xe8, 0x5a, 0xff, 0xe6, 0xe9, 0x5e, 0xff, 0xe2, 0xe6, 0x5c, 0xff, 0xe1, 0xe6, 0x62, 0xff, 0xdc, 0xe1, 0x67, 0xff, 0xda, 0xde, 0x73, 0xff, 0xd0, 0xd4, 0x79, 0xff, 0xa8, 0xaf, 0x6e, 0xff, 0x76, 0x7b, 0x51, 0xff, 0x5a, 0x5e, 0x52, 0xfe, 0x53, 0x57, 0x59, 0xee, 0x69, 0x6f, 0x79, 0xa5, 0x8e, 0x97, 0xa1, 0x36, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xdb, 0xdb, 0x07, 0x79, 0x81, 0x86, 0x5d, 0x49, 0x4f, 0x55, 0xe0, 0x4c, 0x56, 0x46, 0xfe, 0x7b, 0x85, 0x53, 0xff, 0xbd, 0xc8, 0x7b, 0xff, 0xd4, 0xdc, 0x78, 0xff, 0xd9, 0xe1, 0x69, 0xff, 0xda, 0xe1, 0x63, 0xff, 0xde, 0xe4, 0x6a, 0xff, 0xe0, 0xe7, 0x6e, 0xff, 0xdd, 0xe6, 0x65, 0xff, 0xdd, 0xe6, 0x5c, 0xff, 0xe4, 0xea, 0x59, 0xff, 0xe7, 0xe8, 0x55, 0xff, 0xe8, 0xe9, 0x56, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe4, 0xe9, 0x59, 0xff, 0xe4, 0xe8, 0x5b, 0xff, 0xe4, 0xe7, 0x5d, 0xff, 0xe2, 0xe6, 0x5f, 0xff, 0xde, 0xe2, 0x6c, 0xff, 0xd8, 0xdb, 0x7d, 0xff, 0xb7, 0xb9, 0x77, 0xff, 0x76, 0x7a, 0x55, 0xff, 0x5b, 0x64, 0x58, 0xfe, 0x54, 0x60, 0x62, 0xe5, 0x66, 0x6f, 0x79, 0x85, 0xb9, 0xc5, 0xd1, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xbf, 0xbf, 0x10, 0x61, 0x67, 0x70, 0x88, 0x4d, 0x53, 0x53, 0xf1, 0x5c, 0x5f, 0x44, 0xff, 0x9f, 0xa7, 0x69, 0xff, 0xd4, 0xe0, 0x84, 0xff, 0xd6, 0xe1, 0x73, 0xff, 0xda, 0xe3, 0x71, 0xff, 0xe1, 0xe9, 0x7b, 0xff, 0xe8, 0xf1, 0x85, 0xff, 0xe9, 0xf4, 0x8a, 0xff, 0xeb, 0xf5, 0x8c, 0xff, 0xea, 0xf4, 0x83, 0xff, 0xde, 0xe9, 0x6a, 0xff, 0xde, 0xe6, 0x59, 0xff, 0xe4, 0xe8, 0x54, 0xff, 0xe7, 0xe9, 0x56, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x59, 0xff, 0xe3, 0xe8, 0x58, 0xff, 0xe3, 0xe7, 0x58, 0xff, 0xe4, 0xe8, 0x5a, 0xff, 0xe4, 0xe8, 0x5b, 0xff, 0xe3, 0xe8, 0x5d, 0xff, 0xe2, 0xe6, 0x64, 0xff, 0xdf, 0xe2, 0x71, 0xff, 0xd2, 0xd8, 0x7f, 0xff, 0xa3, 0xa8, 0x6c, 0xff, 0x66, 0x6b, 0x52, 0xff, 0x56, 0x59, 0x59, 0xfa, 0x5a, 0x5d, 0x68, 0xbd, 0x8f, 0x8f, 0x99, 0x32, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xc2, 0xc2, 0x15, 0x56, 0x5a, 0x61, 0x9b, 0x48, 0x4f, 0x47, 0xf9, 0x61, 0x69, 0x44, 0xff, 0xbb, 0xc0, 0x72, 0xff, 0xd6, 0xdf, 0x79, 0xff, 0xd9, 0xe4, 0x68, 0xff, 0xdb, 0xe7, 0x67, 0xff, 0xe4, 0xee, 0x7d, 0xff, 0xe9, 0xf3, 0x93, 0xff, 0xe4, 0xf1, 0x99, 0xff, 0xe1, 0xf1, 0x9a, 0xff, 0xe3, 0xf0, 0x99, 0xff, 0xe6, 0xf2, 0x92, 0xff, 0xe5, 0xf0, 0x7d, 0xff, 0xdb, 0xe4, 0x5b, 0xff, 0xe3, 0xe9, 0x54, 0xff, 0xe7, 0xe9, 0x54, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe5, 0xe9, 0x5a, 0xff, 0xe5, 0xe8, 0x5b, 0xff, 0xe6, 0xe7, 0x5b, 0xff, 0xe8, 0xe8, 0x59, 0xff, 0xe8, 0xea, 0x59, 0xff, 0xe1, 0xe6, 0x5f, 0xff, 0xd5, 0xdb, 0x6e, 0xff, 0xc3, 0xc9, 0x74, 0xff, 0x82, 0x87, 0x56, 0xff, 0x56, 0x59, 0x51, 0xfe, 0x4f, 0x55, 0x5a, 0xd8, 0x83, 0x8d, 0x96, 0x4e, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xb8, 0x12, 0x4c, 0x4f, 0x5a, 0xa5, 0x4b, 0x4e, 0x46, 0xfa, 0x6d, 0x74, 0x42, 0xff, 0xc2, 0xcd, 0x76, 0xff, 0xd7, 0xe1, 0x69, 0xff, 0xdc, 0xe5, 0x64, 0xff, 0xdc, 0xe5, 0x64, 0xff, 0xe5, 0xee, 0x7a, 0xff, 0xe9, 0xf4, 0x92, 0xff, 0xe3, 0xf1, 0x9d, 0xff, 0xdd, 0xef, 0xa0, 0xff, 0xdd, 0xef, 0xa1, 0xff, 0xe1, 0xee, 0x9f, 0xff, 0xe6, 0xf0, 0x95, 0xff, 0xe7, 0xf1, 0x81, 0xff, 0xd9, 0xe3, 0x5b, 0xff, 0xe1, 0xe9, 0x54, 0xff, 0xe7, 0xea, 0x55, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xe9, 0x5a, 0xff, 0xe5, 0xe6, 0x5c, 0xff, 0xe7, 0xe7, 0x58, 0xff, 0xe7, 0xe8, 0x55, 0xff, 0xe5, 0xe8, 0x53, 0xff, 0xdf, 0xe6, 0x58, 0xff, 0xd8, 0xe2, 0x62, 0xff, 0xcf, 0xd8, 0x75, 0xff, 0x98, 0x9e, 0x61, 0xff, 0x58, 0x5e, 0x48, 0xff, 0x50, 0x58, 0x5b, 0xe9, 0x74, 0x7e, 0x83, 0x61, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xc4, 0xc4, 0x0d, 0x59, 0x5c, 0x68, 0x95, 0x47, 0x4b, 0x45, 0xfa, 0x69, 0x6f, 0x3d, 0xff, 0xc8, 0xd0, 0x70, 0xff, 0xd8, 0xe1, 0x63, 0xff, 0xdf, 0xe8, 0x57, 0xff, 0xdd, 0xe7, 0x5b, 0xff, 0xda, 0xe4, 0x68, 0xff, 0xea, 0xf4, 0x8c, 0xff, 0xe4, 0xf0, 0x99, 0xff, 0xde, 0xed, 0x9e, 0xff, 0xdc, 0xed, 0x9e, 0xff, 0xe0, 0xef, 0x9e, 0xff, 0xe2, 0xee, 0x98, 0xff, 0xe9, 0xf3, 0x8f, 0xff, 0xe0, 0xe9, 0x71, 0xff, 0xde, 0xe6, 0x5b, 0xff, 0xe4, 0xea, 0x55, 0xff, 0xe6, 0xe8, 0x54, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe4, 0xec, 0x55, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe5, 0xe8, 0x58, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x59, 0xff, 0xe1, 0xe5, 0x5b, 0xff, 0xdc, 0xe2, 0x62, 0xff, 0xd6, 0xdf, 0x75, 0xff, 0xa5, 0xac, 0x63, 0xff, 0x5e, 0x64, 0x49, 0xff, 0x56, 0x5b, 0x5b, 0xe9, 0x88, 0x8b, 0x91, 0x56, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xff, 0x05, 0x5d, 0x61, 0x6b, 0x7e, 0x45, 0x4b, 0x4c, 0xf7, 0x5f, 0x68, 0x3f, 0xff, 0xc2, 0xcc, 0x71, 0xff, 0xdb, 0xe1, 0x65, 0xff, 0xe5, 0xe5, 0x5b, 0xff, 0xe4, 0xe9, 0x52, 0xff, 0xdf, 0xe7, 0x57, 0xff, 0xdd, 0xe9, 0x6b, 0xff, 0xe8, 0xf4, 0x8b, 0xff, 0xe2, 0xee, 0x97, 0xff, 0xe2, 0xee, 0x9c, 0xff, 0xe3, 0xef, 0x9c, 0xff, 0xe5, 0xf0, 0x97, 0xff, 0xea, 0xf3, 0x93, 0xff, 0xe5, 0xec, 0x7c, 0xff, 0xdd, 0xe5, 0x61, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x54, 0xff, 0xe6, 0xe8, 0x55, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xeb, 0x56, 0xff, 0xe5, 0xea, 0x55, 0xff, 0xe3, 0xea, 0x57, 0xff, 0xe2, 0xea, 0x59, 0xff, 0xe2, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe7, 0xe7, 0x5c, 0xff, 0xe6, 0xe6, 0x5d, 0xff, 0xe0, 0xe5, 0x60, 0xff, 0xd8, 0xe1, 0x70, 0xff, 0xa9, 0xb0, 0x68, 0xff, 0x63, 0x66, 0x52, 0xff, 0x58, 0x5b, 0x60, 0xde, 0x89, 0x8d, 0x96, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0x76, 0x7c, 0x86, 0x4e, 0x4d, 0x55, 0x54, 0xec, 0x57, 0x60, 0x3e, 0xff, 0xba, 0xc7, 0x73, 0xff, 0xd4, 0xe2, 0x67, 0xff, 0xe0, 0xe7, 0x5b, 0xff, 0xe7, 0xe5, 0x58, 0xff, 0xe4, 0xe9, 0x51, 0xff, 0xdf, 0xe8, 0x54, 0xff, 0xdc, 0xe8, 0x61, 0xff, 0xe9, 0xf4, 0x81, 0xff, 0xe8, 0xf2, 0x8e, 0xff, 0xe6, 0xef, 0x93, 0xff, 0xe9, 0xf3, 0x92, 0xff, 0xeb, 0xf5, 0x8b, 0xff, 0xe2, 0xea, 0x79, 0xff, 0xdf, 0xe5, 0x67, 0xff, 0xdf, 0xe5, 0x5b, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe4, 0xe8, 0x56, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe2, 0xe9, 0x57, 0xff, 0xe2, 0xea, 0x56, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe7, 0xe9, 0x58, 0xff, 0xe6, 0xe6, 0x5a, 0xff, 0xe4, 0xe8, 0x5c, 0xff, 0xdd, 0xe6, 0x5d, 0xff, 0xd8, 0xdf, 0x75, 0xff, 0xa3, 0xa5, 0x68, 0xff, 0x5f, 0x62, 0x57, 0xfe, 0x5c, 0x62, 0x6d, 0xc3, 0xa5, 0xad, 0xbd, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x7d, 0x86, 0x37, 0x4b, 0x54, 0x58, 0xdb, 0x57, 0x5f, 0x44, 0xff, 0xba, 0xc2, 0x77, 0xff, 0xd8, 0xe4, 0x70, 0xff, 0xdc, 0xe8, 0x5c, 0xff, 0xe2, 0xe8, 0x56, 0xff, 0xe7, 0xe8, 0x56, 0xff, 0xe3, 0xea, 0x52, 0xff, 0xe2, 0xe9, 0x52, 0xff, 0xde, 0xe6, 0x57, 0xff, 0xde, 0xe5, 0x64, 0xff, 0xe5, 0xec, 0x77, 0xff, 0xe4, 0xec, 0x7b, 0xff, 0xe1, 0xeb, 0x76, 0xff, 0xdb, 0xe6, 0x67, 0xff, 0xdd, 0xe5, 0x62, 0xff, 0xe0, 0xe7, 0x5d, 0xff, 0xe1, 0xe8, 0x58, 0xff, 0xe3, 0xe7, 0x57, 0xff, 0xe3, 0xe7, 0x57, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x59, 0xff, 0xe2, 0xe8, 0x59, 0xff, 0xe1, 0xe9, 0x59, 0xff, 0xe0, 0xe5, 0x64, 0xff, 0xd6, 0xd9, 0x7c, 0xff, 0x8b, 0x8f, 0x60, 0xff, 0x54, 0x5d, 0x5b, 0xfc, 0x5a, 0x60, 0x6a, 0x97, 0xc6, 0xc6, 0xc6, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xaf, 0xaf, 0x10, 0x4a, 0x55, 0x5c, 0xb2, 0x52, 0x5a, 0x47, 0xfd, 0xa4, 0xaa, 0x6c, 0xff, 0xda, 0xe1, 0x78, 0xff, 0xe1, 0xe7, 0x61, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe5, 0xe9, 0x56, 0xff, 0xe7, 0xe9, 0x53, 0xff, 0xe6, 0xe8, 0x54, 0xff, 0xe6, 0xe9, 0x53, 0xff, 0xe4, 0xe9, 0x56, 0xff, 0xe2, 0xe6, 0x5a, 0xff, 0xe0, 0xe5, 0x5d, 0xff, 0xdf, 0xe5, 0x5c, 0xff, 0xde, 0xe6, 0x5c, 0xff, 0xde, 0xe7, 0x5c, 0xff, 0xe0, 0xe8, 0x5a, 0xff, 0xe1, 0xe9, 0x57, 0xff, 0xe3, 0xe9, 0x55, 0xff, 0xe3, 0xe9, 0x55, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe2, 0xe8, 0x57, 0xff, 0xe1, 0xe7, 0x59, 0xff, 0xdb, 0xe2, 0x68, 0xff, 0xca, 0xd1, 0x82, 0xff, 0x67, 0x6d, 0x4c, 0xff, 0x4f, 0x56, 0x5a, 0xf1, 0x7f, 0x86, 0x91, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0x57, 0x5e, 0x65, 0x72, 0x4b, 0x53, 0x4e, 0xf7, 0x84, 0x8c, 0x56, 0xff, 0xd7, 0xdf, 0x7f, 0xff, 0xe0, 0xe8, 0x60, 0xff, 0xe7, 0xeb, 0x56, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe4, 0xe9, 0x59, 0xff, 0xe3, 0xea, 0x54, 0xff, 0xe5, 0xea, 0x55, 0xff, 0xe5, 0xeb, 0x53, 0xff, 0xe5, 0xea, 0x53, 0xff, 0xe5, 0xe9, 0x56, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xea, 0x56, 0xff, 0xe5, 0xea, 0x55, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe4, 0xea, 0x55, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe3, 0xe8, 0x56, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x56, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe9, 0x54, 0xff, 0xe2, 0xe9, 0x59, 0xff, 0xd6, 0xdd, 0x6e, 0xff, 0xb4, 0xb7, 0x75, 0xff, 0x55, 0x5b, 0x4f, 0xff, 0x56, 0x5d, 0x65, 0xbe, 0xc3, 0xc3, 0xd2, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x71, 0x7d, 0x2d, 0x4d, 0x53, 0x4b, 0xdf, 0x69, 0x6e, 0x4b, 0xff, 0xc9, 0xd2, 0x7e, 0xff, 0xdb, 0xe5, 0x6c, 0xff, 0xe3, 0xec, 0x56, 0xff, 0xe7, 0xec, 0x53, 0xff, 0xe3, 0xe8, 0x5b, 0xff, 0xe0, 0xe7, 0x5c, 0xff, 0xdf, 0xea, 0x57, 0xff, 0xe1, 0xeb, 0x55, 0xff, 0xe2, 0xec, 0x52, 0xff, 0xe3, 0xeb, 0x53, 0xff, 0xe3, 0xea, 0x57, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe7, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x59, 0xff, 0xe4, 0xe8, 0x5a, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x58, 0xff, 0xe5, 0xe8, 0x5a, 0xff, 0xe4, 0xe7, 0x5b, 0xff, 0xe5, 0xe9, 0x54, 0xff, 0xe5, 0xea, 0x53, 0xff, 0xdf, 0xe4, 0x63, 0xff, 0xd5, 0xd7, 0x7a, 0xff, 0x81, 0x87, 0x56, 0xff, 0x51, 0x58, 0x55, 0xf5, 0x67, 0x6e, 0x79, 0x61, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xd4, 0x06, 0x4d, 0x56, 0x5b, 0x98, 0x52, 0x58, 0x3f, 0xfd, 0xac, 0xb2, 0x6c, 0xff, 0xda, 0xe3, 0x71, 0xff, 0xe1, 0xea, 0x62, 0xff, 0xe4, 0xeb, 0x55, 0xff, 0xe3, 0xeb, 0x55, 0xff, 0xe0, 0xe9, 0x5a, 0xff, 0xe0, 0xe8, 0x5c, 0xff, 0xe0, 0xe9, 0x5a, 0xff, 0xe0, 0xeb, 0x56, 0xff, 0xe0, 0xec, 0x53, 0xff, 0xe1, 0xeb, 0x55, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe4, 0xe7, 0x5c, 0xff, 0xe4, 0xe7, 0x5b, 0xff, 0xe6, 0xe8, 0x58, 0xff, 0xe7, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x5a, 0xff, 0xe3, 0xe7, 0x5a, 0xff, 0xe4, 0xe8, 0x56, 0xff, 0xe6, 0xe8, 0x56, 0xff, 0xe2, 0xe6, 0x5e, 0xff, 0xde, 0xe3, 0x6d, 0xff, 0xbc, 0xc4, 0x73, 0xff, 0x59, 0x61, 0x4a, 0xff, 0x56, 0x5e, 0x64, 0xc0, 0xaf, 0xaf, 0xaf, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x65, 0x6f, 0x47, 0x49, 0x4e, 0x51, 0xeb, 0x76, 0x7c, 0x4e, 0xff, 0xd3, 0xdb, 0x79, 0xff, 0xdf, 0xe7, 0x5f, 0xff, 0xe2, 0xe8, 0x57, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe2, 0xea, 0x57, 0xff, 0xe0, 0xea, 0x57, 0xff, 0xe2, 0xe9, 0x59, 0xff, 0xe4, 0xe8, 0x5a, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe1, 0xeb, 0x56, 0xff, 0xe2, 0xea, 0x56, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x5a, 0xff, 0xe6, 0xe9, 0x59, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe2, 0xea, 0x57, 0xff, 0xe2, 0xea, 0x57, 0xff, 0xe3, 0xea, 0x57, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe1, 0xe9, 0x58, 0xff, 0xe3, 0xe8, 0x58, 0xff, 0xe5, 0xe6, 0x5a, 0xff, 0xe1, 0xe4, 0x5b, 0xff, 0xe0, 0xe7, 0x61, 0xff, 0xd2, 0xde, 0x75, 0xff, 0x7f, 0x87, 0x58, 0xff, 0x57, 0x5f, 0x60, 0xf4, 0x77, 0x81, 0x81, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xc6, 0xc6, 0x09, 0x43, 0x49, 0x54, 0xae, 0x50, 0x53, 0x44, 0xfe, 0xb3, 0xba, 0x6a, 0xff, 0xda, 0xe2, 0x69, 0xff, 0xdf, 0xe7, 0x59, 0xff, 0xdf, 0xe9, 0x53, 0xff, 0xdf, 0xec, 0x53, 0xff, 0xdf, 0xeb, 0x54, 0xff, 0xe1, 0xea, 0x57, 0xff, 0xe5, 0xe7, 0x5a, 0xff, 0xe7, 0xe6, 0x5b, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe2, 0xea, 0x58, 0xff, 0xe6, 0xe9, 0x59, 0xff, 0xe6, 0xe8, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xea, 0x59, 0xff, 0xe5, 0xe8, 0x58, 0xff, 0xe5, 0xe7, 0x5b, 0xff, 0xe6, 0xe8, 0x5a, 0xff, 0xe5, 0xea, 0x58, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe5, 0xea, 0x58, 0xff, 0xe6, 0xe9, 0x5b, 0xff, 0xe6, 0xe8, 0x5b, 0xff, 0xe5, 0xe9, 0x5a, 0xff, 0xe5, 0xe9, 0x5a, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe6, 0xeb, 0x5a, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe5, 0xe9, 0x56, 0xff, 0xe5, 0xe7, 0x57, 0xff, 0xe4, 0xe6, 0x58, 0xff, 0xe2, 0xe6, 0x5a, 0xff, 0xda, 0xe1, 0x68, 0xff, 0xb7, 0xbf, 0x76, 0xff, 0x5d, 0x65, 0x57, 0xfe, 0x61, 0x6a, 0x71, 0xa3, 0xcc, 0xcc, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x76, 0x7f, 0x34, 0x45, 0x4b, 0x4c, 0xeb, 0x70, 0x75, 0x47, 0xff, 0xd3, 0xdc, 0x75, 0xff, 0xde, 0xe7, 0x5f, 0xff, 0xdf, 0xe8, 0x5a, 0xff, 0xdf, 0xea, 0x56, 0xff, 0xde, 0xec, 0x52, 0xff, 0xe0, 0xed, 0x54, 0xff, 0xe1, 0xea, 0x57, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe7, 0xe9, 0x58, 0xff, 0xe3, 0xea, 0x56, 0xff, 0xe5, 0xe9, 0x59, 0xff, 0xe5, 0xe7, 0x59, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe1, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe3, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe3, 0xea, 0x57, 0xff, 0xe3, 0xea, 0x58, 0xff, 0xe4, 0xea, 0x59, 0xff, 0xe5, 0xe9, 0x5a, 0xff, 0xe5, 0xe9, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe7, 0x58, 0xff, 0xe5, 0xe6, 0x5c, 0xff, 0xde, 0xe4, 0x62, 0xff, 0xd1, 0xd9, 0x7e, 0xff, 0x76, 0x7e, 0x58, 0xff, 0x56, 0x60, 0x60, 0xe4, 0x8d, 0x94, 0xa1, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x51, 0x59, 0x60, 0x8d, 0x4a, 0x50, 0x41, 0xfd, 0xac, 0xb4, 0x69, 0xff, 0xd7, 0xe0, 0x65, 0xff, 0xe0, 0xe9, 0x57, 0xff, 0xde, 0xe7, 0x57, 0xff, 0xdf, 0xe8, 0x57, 0xff, 0xdf, 0xe9, 0x56, 0xff, 0xdf, 0xe8, 0x57, 0xff, 0xe0, 0xe8, 0x59, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe1, 0xe9, 0x55, 0xff, 0xe3, 0xeb, 0x57, 0xff, 0xe4, 0xe8, 0x56, 0xff, 0xe6, 0xe8, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe3, 0xe9, 0x54, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe5, 0xe7, 0x5a, 0xff, 0xe3, 0xe7, 0x5a, 0xff, 0xe0, 0xea, 0x58, 0xff, 0xe0, 0xea, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x58, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe7, 0x57, 0xff, 0xe5, 0xe7, 0x59, 0xff, 0xe5, 0xe6, 0x5b, 0xff, 0xdf, 0xe7, 0x5a, 0xff, 0xd5, 0xdf, 0x70, 0xff, 0x9f, 0xa7, 0x6b, 0xff, 0x5b, 0x64, 0x58, 0xf9, 0x60, 0x6a, 0x6f, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x87, 0x8f, 0x20, 0x50, 0x55, 0x57, 0xd9, 0x6c, 0x72, 0x49, 0xff, 0xcf, 0xd7, 0x76, 0xff, 0xde, 0xe6, 0x5c, 0xff, 0xe3, 0xe9, 0x53, 0xff, 0xe0, 0xea, 0x53, 0xff, 0xdd, 0xe7, 0x55, 0xff, 0xdd, 0xe6, 0x5f, 0xff, 0xdc, 0xe3, 0x68, 0xff, 0xdb, 0xe2, 0x6d, 0xff, 0xd8, 0xe1, 0x67, 0xff, 0xdb, 0xe6, 0x63, 0xff, 0xde, 0xe7, 0x5a, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe7, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x58, 0xff, 0xe2, 0xe8, 0x59, 0xff, 0xe2, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe5, 0xe8, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x58, 0xff, 0xe6, 0xe7, 0x57, 0xff, 0xe7, 0xe7, 0x57, 0xff, 0xe9, 0xe8, 0x59, 0xff, 0xe7, 0xe6, 0x59, 0xff, 0xe7, 0xe7, 0x5a, 0xff, 0xe4, 0xe8, 0x5a, 0xff, 0xe3, 0xe8, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe5, 0xe7, 0x58, 0xff, 0xe5, 0xe7, 0x58, 0xff, 0xe5, 0xe6, 0x59, 0xff, 0xe5, 0xe6, 0x5a, 0xff, 0xe5, 0xe7, 0x59, 0xff, 0xe2, 0xe9, 0x56, 0xff, 0xdb, 0xe2, 0x65, 0xff, 0xc5, 0xca, 0x7b, 0xff, 0x60, 0x66, 0x4c, 0xff, 0x57, 0x5f, 0x62, 0xac, 0xd4, 0xd4, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x57, 0x5e, 0x6a, 0x55, 0x5c, 0x50, 0xf8, 0x9b, 0xa3, 0x61, 0xff, 0xdc, 0xe3, 0x72, 0xff, 0xe0, 0xe6, 0x59, 0xff, 0xe3, 0xe9, 0x53, 0xff, 0xe0, 0xeb, 0x50, 0xff, 0xd9, 0xe6, 0x5b, 0xff, 0xd0, 0xdb, 0x6e, 0xff, 0xb6, 0xbf, 0x6c, 0xff, 0x98, 0x9f, 0x57, 0xff, 0xa9, 0xb1, 0x63, 0xff, 0xcd, 0xd8, 0x7a, 0xff, 0xd9, 0xe3, 0x67, 0xff, 0xe1, 0xe6, 0x5d, 0xff, 0xe7, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe3, 0xe8, 0x59, 0xff, 0xe2, 0xea, 0x57, 0xff, 0xe3, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe3, 0xe7, 0x58, 0xff, 0xe7, 0xe7, 0x58, 0xff, 0xe5, 0xe5, 0x5a, 0xff, 0xe3, 0xe5, 0x5c, 0xff, 0xe4, 0xe8, 0x5f, 0xff, 0xe2, 0xe6, 0x5a, 0xff, 0xe6, 0xe8, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe7, 0x58, 0xff, 0xe5, 0xe7, 0x58, 0xff, 0xe5, 0xe7, 0x59, 0xff, 0xe5, 0xe7, 0x59, 0xff, 0xe5, 0xe7, 0x58, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe0, 0xe4, 0x5e, 0xff, 0xd5, 0xd9, 0x75, 0xff, 0x7b, 0x7f, 0x51, 0xff, 0x53, 0x5b, 0x5d, 0xdd, 0x8e, 0x96, 0xa5, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x09, 0x4f, 0x56, 0x57, 0xb5, 0x55, 0x5d, 0x42, 0xfe, 0xc3, 0xce, 0x75, 0xff, 0xde, 0xe5, 0x68, 0xff, 0xe4, 0xe8, 0x5e, 0xff, 0xe3, 0xea, 0x55, 0xff, 0xdf, 0xe8, 0x56, 0xff, 0xd6, 0xdf, 0x6b, 0xff, 0x9e, 0xa9, 0x60, 0xff, 0x46, 0x50, 0x3a, 0xff, 0x49, 0x51, 0x45, 0xff, 0x4d, 0x54, 0x3d, 0xff, 0x83, 0x8c, 0x54, 0xff, 0xd3, 0xdd, 0x77, 0xff, 0xdc, 0xe3, 0x63, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xeb, 0x56, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe1, 0xe8, 0x58, 0xff, 0xe2, 0xe9, 0x56, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe3, 0xe8, 0x58, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe3, 0xe9, 0x55, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe2, 0xe6, 0x59, 0xff, 0xdf, 0xe3, 0x63, 0xff, 0xda, 0xdf, 0x6e, 0xff, 0xcb, 0xd1, 0x6f, 0xff, 0xc2, 0xca, 0x6c, 0xff, 0xd6, 0xde, 0x73, 0xff, 0xdf, 0xe4, 0x64, 0xff, 0xe1, 0xe7, 0x57, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe5, 0xe7, 0x58, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe3, 0xe7, 0x57, 0xff, 0xe3, 0xe7, 0x58, 0xff, 0xdb, 0xe0, 0x69, 0xff, 0x9d, 0xa2, 0x60, 0xff, 0x4f, 0x56, 0x52, 0xf7, 0x64, 0x6c, 0x7b, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x8c, 0x92, 0x2a, 0x48, 0x52, 0x4e, 0xeb, 0x6c, 0x76, 0x44, 0xff, 0xd4, 0xe1, 0x77, 0xff, 0xe1, 0xe9, 0x64, 0xff, 0xe2, 0xe6, 0x5c, 0xff, 0xe2, 0xec, 0x57, 0xff, 0xe0, 0xe6, 0x61, 0xff, 0xce, 0xd3, 0x77, 0xff, 0x59, 0x61, 0x3e, 0xff, 0x45, 0x4e, 0x5a, 0xff, 0x43, 0x4b, 0x63, 0xff, 0x4a, 0x51, 0x59, 0xff, 0x55, 0x5c, 0x47, 0xff, 0xbd, 0xc6, 0x71, 0xff, 0xd9, 0xe1, 0x68, 0xff, 0xe3, 0xe9, 0x59, 0xff, 0xe5, 0xe9, 0x55, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe1, 0xe8, 0x57, 0xff, 0xe2, 0xe8, 0x57, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe2, 0xe8, 0x57, 0xff, 0xe2, 0xe8, 0x56, 0xff, 0xe3, 0xe8, 0x56, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe4, 0xe8, 0x5a, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe3, 0xe9, 0x55, 0xff, 0xe3, 0xe9, 0x55, 0xff, 0xe2, 0xe9, 0x56, 0xff, 0xe2, 0xe8, 0x57, 0xff, 0xe0, 0xe4, 0x5d, 0xff, 0xd2, 0xda, 0x75, 0xff, 0x91, 0x99, 0x52, 0xff, 0x62, 0x69, 0x43, 0xff, 0x5c, 0x63, 0x46, 0xff, 0x7e, 0x85, 0x4d, 0xff, 0xcd, 0xd3, 0x73, 0xff, 0xdd, 0xe4, 0x64, 0xff, 0xe3, 0xea, 0x58, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe2, 0xe7, 0x59, 0xff, 0xe4, 0xe7, 0x55, 0xff, 0xde, 0xe2, 0x5e, 0xff, 0xb7, 0xbe, 0x6e, 0xff, 0x51, 0x59, 0x4d, 0xfd, 0x55, 0x5d, 0x69, 0x96, 0xaa, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x73, 0x7a, 0x71, 0x47, 0x52, 0x48, 0xfc, 0xa4, 0xaa, 0x66, 0xff, 0xdb, 0xe4, 0x6a, 0xff, 0xe1, 0xea, 0x5e, 0xff, 0xe1, 0xe7, 0x5d, 0xff, 0xe2, 0xea, 0x55, 0xff, 0xdb, 0xe2, 0x64, 0xff, 0xbc, 0xc1, 0x72, 0xff, 0x4b, 0x4e, 0x45, 0xff, 0x46, 0x4d, 0x63, 0xff, 0x41, 0x49, 0x66, 0xff, 0x46, 0x4e, 0x63, 0xff, 0x4f, 0x54, 0x5a, 0xff, 0xa3, 0xae, 0x6b, 0xff, 0xd9, 0xe3, 0x6b, 0xff, 0xe5, 0xe6, 0x5a, 0xff, 0xe5, 0xe5, 0x5d, 0xff, 0xde, 0xe8, 0x55, 0xff, 0xdf, 0xe8, 0x55, 0xff, 0xe2, 0xe6, 0x5b, 0xff, 0xe0, 0xe7, 0x59, 0xff, 0xdf, 0xe7, 0x5b, 0xff, 0xdc, 0xe7, 0x58, 0xff, 0xde, 0xe8, 0x56, 0xff, 0xe2, 0xea, 0x55, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe4, 0xe7, 0x5c, 0xff, 0xe3, 0xec, 0x53, 0xff, 0xe2, 0xee, 0x4e, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe0, 0xeb, 0x57, 0xff, 0xde, 0xea, 0x59, 0xff, 0xdc, 0xe2, 0x71, 0xff, 0x98, 0xa4, 0x62, 0xff, 0x54, 0x5e, 0x4b, 0xff, 0x49, 0x51, 0x5c, 0xff, 0x48, 0x50, 0x5d, 0xff, 0x4c, 0x52, 0x4a, 0xff, 0x83, 0x8a, 0x50, 0xff, 0xd3, 0xdd, 0x75, 0xff, 0xde, 0xe7, 0x5a, 0xff, 0xe1, 0xe7, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe5, 0xe9, 0x59, 0xff, 0xe8, 0xe9, 0x59, 0xff, 0xe8, 0xe9, 0x59, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe6, 0xe7, 0x57, 0xff, 0xe5, 0xe7, 0x56, 0xff, 0xe2, 0xe7, 0x59, 0xff, 0xe5, 0xe5, 0x58, 0xff, 0xe2, 0xe3, 0x5e, 0xff, 0xc6, 0xcd, 0x71, 0xff, 0x59, 0x62, 0x49, 0xff, 0x4c, 0x54, 0x5e, 0xc5, 0xaa, 0xaa, 0xbb, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xdb, 0xdb, 0x07, 0x4a, 0x54, 0x58, 0xb3, 0x4e, 0x55, 0x3f, 0xff, 0xc0, 0xc5, 0x74, 0xff, 0xde, 0xe6, 0x62, 0xff, 0xe0, 0xe9, 0x59, 0xff, 0xe1, 0xe7, 0x5d, 0xff, 0xe3, 0xea, 0x58, 0xff, 0xda, 0xe2, 0x66, 0xff, 0xbd, 0xc2, 0x73, 0xff, 0x4b, 0x52, 0x42, 0xff, 0x44, 0x4d, 0x61, 0xff, 0x44, 0x4f, 0x68, 0xff, 0x49, 0x54, 0x5e, 0xff, 0x51, 0x59, 0x50, 0xff, 0xa9, 0xb0, 0x69, 0xff, 0xdd, 0xe4, 0x6b, 0xff, 0xe5, 0xe6, 0x58, 0xff, 0xde, 0xe2, 0x5b, 0xff, 0xd9, 0xe5, 0x5d, 0xff, 0xd9, 0xe1, 0x67, 0xff, 0xd8, 0xdb, 0x72, 0xff, 0xd4, 0xd9, 0x71, 0xff, 0xd5, 0xdc, 0x75, 0xff, 0xd6, 0xdf, 0x72, 0xff, 0xda, 0xe2, 0x68, 0xff, 0xdd, 0xe4, 0x5e, 0xff, 0xe1, 0xe7, 0x5a, 0xff, 0xe4, 0xe6, 0x5f, 0xff, 0xe3, 0xe8, 0x56, 0xff, 0xe5, 0xea, 0x54, 0xff, 0xe5, 0xe7, 0x5b, 0xff, 0xe1, 0xeb, 0x57, 0xff, 0xdc, 0xea, 0x5d, 0xff, 0xd6, 0xdc, 0x78, 0xff, 0x67, 0x6e, 0x48, 0xff, 0x50, 0x55, 0x60, 0xff, 0x40, 0x48, 0x6a, 0xff, 0x3d, 0x48, 0x64, 0xff, 0x49, 0x4e, 0x5c, 0xff, 0x5c, 0x5e, 0x42, 0xff, 0xc8, 0xcf, 0x77, 0xff, 0xdd, 0xe6, 0x5c, 0xff, 0xe3, 0xe9, 0x5b, 0xff, 0xe6, 0xe8, 0x58, 0xff, 0xe8, 0xe8, 0x58, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe4, 0xe9, 0x59, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe3, 0xe8, 0x58, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe2, 0xe8, 0x56, 0xff, 0xe5, 0xe7, 0x55, 0xff, 0xe3, 0xe5, 0x5b, 0xff, 0xcf, 0xd6, 0x73, 0xff, 0x6c, 0x75, 0x4d, 0xff, 0x44, 0x4d, 0x4f, 0xe6, 0xa0, 0xa0, 0xa8, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xb1, 0xba, 0x1a, 0x3f, 0x46, 0x45, 0xe5, 0x6b, 0x70, 0x48, 0xff, 0xd1, 0xd6, 0x74, 0xff, 0xde, 0xe7, 0x59, 0xff, 0xe0, 0xea, 0x56, 0xff, 0xe1, 0xe7, 0x5c, 0xff, 0xe3, 0xe7, 0x5a, 0xff, 0xdd, 0xe3, 0x63, 0xff, 0xcf, 0xd5, 0x7a, 0xff, 0x63, 0x6b, 0x45, 0xff, 0x4c, 0x54, 0x5c, 0xff, 0x48, 0x4e, 0x64, 0xff, 0x4d, 0x54, 0x59, 0xff, 0x5b, 0x62, 0x49, 0xff, 0xc3, 0xc6, 0x7b, 0xff, 0xdb, 0xe0, 0x6e, 0xff, 0xdd, 0xe0, 0x65, 0xff, 0xd5, 0xda, 0x6e, 0xff, 0xcd, 0xd8, 0x78, 0xff, 0xa0, 0xa8, 0x5a, 0xff, 0x7e, 0x81, 0x4a, 0xff, 0x70, 0x76, 0x46, 0xff, 0x75, 0x7a, 0x4a, 0xff, 0x83, 0x88, 0x4e, 0xff, 0xad, 0xb3, 0x65, 0xff, 0xd2, 0xd9, 0x7a, 0xff, 0xdb, 0xe1, 0x74, 0xff, 0xdd, 0xe3, 0x6c, 0xff, 0xde, 0xe4, 0x64, 0xff, 0xe2, 0xe4, 0x61, 0xff, 0xe1, 0xe3, 0x60, 0xff, 0xe3, 0xeb, 0x5c, 0xff, 0xdc, 0xe7, 0x64, 0xff, 0xcb, 0xcf, 0x76, 0xff, 0x60, 0x66, 0x46, 0xff, 0x4c, 0x4f, 0x62, 0xff, 0x42, 0x4a, 0x71, 0xff, 0x3e, 0x4b, 0x69, 0xff, 0x46, 0x4c, 0x5f, 0xff, 0x58, 0x5a, 0x43, 0xff, 0xbe, 0xc6, 0x6b, 0xff, 0xde, 0xe6, 0x5c, 0xff, 0xe4, 0xe9, 0x5b, 0xff, 0xe6, 0xe9, 0x59, 0xff, 0xe7, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x58, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe2, 0xe9, 0x54, 0xff, 0xe4, 0xe8, 0x52, 0xff, 0xe4, 0xe7, 0x57, 0xff, 0xd2, 0xdb, 0x6d, 0xff, 0x81, 0x8a, 0x55, 0xff, 0x4f, 0x58, 0x55, 0xf7, 0x77, 0x81, 0x88, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xdb, 0xdb, 0xdb, 0x07, 0xbf, 0xbf, 0xdf, 0x08, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x72, 0x7a, 0x5e, 0x46, 0x4b, 0x46, 0xfa, 0x94, 0x96, 0x5d, 0xff, 0xd8, 0xdd, 0x6c, 0xff, 0xe2, 0xe8, 0x54, 0xff, 0xe1, 0xea, 0x56, 0xff, 0xe1, 0xe8, 0x5a, 0xff, 0xe3, 0xe6, 0x5a, 0xff, 0xe4, 0xe7, 0x5f, 0xff, 0xdc, 0xe1, 0x71, 0xff, 0xb3, 0xb8, 0x6f, 0xff, 0x63, 0x68, 0x4a, 0xff, 0x54, 0x59, 0x4f, 0xff, 0x58, 0x5e, 0x47, 0xff, 0x95, 0x9e, 0x6e, 0xff, 0xd1, 0xd9, 0x8e, 0xff, 0xc9, 0xd0, 0x7b, 0xff, 0xb2, 0xb5, 0x67, 0xff, 0x8e, 0x92, 0x57, 0xff, 0x77, 0x7f, 0x53, 0xff, 0x50, 0x57, 0x42, 0xff, 0x4d, 0x54, 0x51, 0xff, 0x49, 0x53, 0x57, 0xff, 0x4d, 0x54, 0x5a, 0xff, 0x53, 0x59, 0x56, 0xff, 0x5b, 0x61, 0x4d, 0xff, 0x8f, 0x96, 0x67, 0xff, 0x9c, 0xa3, 0x66, 0xff, 0xa3, 0xad, 0x5f, 0xff, 0xb8, 0xc2, 0x69, 0xff, 0xce, 0xd3, 0x75, 0xff, 0xdc, 0xdf, 0x73, 0xff, 0xdd, 0xe4, 0x63, 0xff, 0xdd, 0xe6, 0x66, 0xff, 0xd6, 0xda, 0x75, 0xff, 0x70, 0x78, 0x40, 0xff, 0x50, 0x54, 0x54, 0xff, 0x43, 0x49, 0x64, 0xff, 0x42, 0x4d, 0x62, 0xff, 0x4c, 0x52, 0x56, 0xff, 0x65, 0x6a, 0x3d, 0xff, 0xcb, 0xd4, 0x68, 0xff, 0xe2, 0xe8, 0x5d, 0xff, 0xe4, 0xe9, 0x5a, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe5, 0xea, 0x56, 0xff, 0xe7, 0xe9, 0x55, 0xff, 0xe6, 0xe8, 0x55, 0xff, 0xe6, 0xe8, 0x55, 0xff, 0xe7, 0xe9, 0x55, 0xff, 0xe6, 0xe9, 0x55, 0xff, 0xe6, 0xe9, 0x55, 0xff, 0xe4, 0xe9, 0x54, 0xff, 0xe4, 0xe7, 0x54, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xd7, 0xdd, 0x68, 0xff, 0x9f, 0xa6, 0x66, 0xff, 0x5a, 0x61, 0x5b, 0xfe, 0x60, 0x69, 0x76, 0xa7, 0xcc, 0xcc, 0xe6, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x79, 0x7f, 0x2a, 0x4a, 0x53, 0x5a, 0x90, 0x4d, 0x58, 0x61, 0xa8, 0x5a, 0x62, 0x71, 0x91, 0x6f, 0x77, 0x82, 0x5c, 0x54, 0x5a, 0x65, 0xbd, 0x49, 0x4c, 0x44, 0xff, 0xb0, 0xb3, 0x6e, 0xff, 0xdb, 0xe0, 0x63, 0xff, 0xe2, 0xe7, 0x53, 0xff, 0xe3, 0xe8, 0x58, 0xff, 0xe2, 0xe8, 0x5a, 0xff, 0xe4, 0xe7, 0x58, 0xff, 0xe7, 0xe8, 0x5b, 0xff, 0xe4, 0xe6, 0x64, 0xff, 0xdd, 0xe2, 0x74, 0xff, 0xc7, 0xce, 0x72, 0xff, 0xad, 0xb8, 0x68, 0xff, 0xb4, 0xc1, 0x75, 0xff, 0xc5, 0xd4, 0x89, 0xff, 0x9f, 0xab, 0x6e, 0xff, 0x68, 0x72, 0x41, 0xff, 0x48, 0x4f, 0x31, 0xff, 0x62, 0x69, 0x5e, 0xff, 0x85, 0x8d, 0x8b, 0xff, 0x3e, 0x48, 0x4e, 0xff, 0x43, 0x4f, 0x5f, 0xff, 0x40, 0x4d, 0x64, 0xff, 0x46, 0x4f, 0x6a, 0xff, 0x4b, 0x53, 0x68, 0xff, 0x51, 0x5a, 0x61, 0xff, 0x86, 0x8f, 0x8a, 0xff, 0x86, 0x8f, 0x84, 0xff, 0x5d, 0x69, 0x53, 0xff, 0x5d, 0x68, 0x49, 0xff, 0x73, 0x7c, 0x4d, 0xff, 0x9e, 0xa5, 0x5e, 0xff, 0xcd, 0xd6, 0x73, 0xff, 0xd8, 0xe3, 0x6b, 0xff, 0xdb, 0xe3, 0x6c, 0xff, 0xb1, 0xb9, 0x67, 0xff, 0x51, 0x54, 0x31, 0xff, 0x50, 0x51, 0x4d, 0xff, 0x4b, 0x4d, 0x4b, 0xff, 0x4f, 0x51, 0x39, 0xff, 0xa3, 0xa7, 0x5a, 0xff, 0xda, 0xe1, 0x6a, 0xff, 0xe2, 0xe7, 0x59, 0xff, 0xe2, 0xe7, 0x57, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x56, 0xff, 0xe6, 0xe8, 0x54, 0xff, 0xe7, 0xe9, 0x55, 0xff, 0xe7, 0xe9, 0x55, 0xff, 0xe7, 0xe9, 0x55, 0xff, 0xe7, 0xe9, 0x55, 0xff, 0xe7, 0xe9, 0x55, 0xff, 0xe4, 0xe7, 0x54, 0xff, 0xe3, 0xe5, 0x57, 0xff, 0xe4, 0xe7, 0x5b, 0xff, 0xdd, 0xe2, 0x66, 0xff, 0xba, 0xc0, 0x75, 0xff, 0x5e, 0x63, 0x5a, 0xff, 0x53, 0x5c, 0x6c, 0xf6, 0x6b, 0x70, 0x7f, 0x70, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xbf, 0xbf, 0x08, 0x79, 0x86, 0x8d, 0x26, 0x75, 0x7c, 0x8a, 0x4c, 0x63, 0x6c, 0x78, 0x6a, 0x5e, 0x67, 0x72, 0x9a, 0x48, 0x50, 0x5d, 0xf8, 0x4f, 0x53, 0x46, 0xff, 0xae, 0xb3, 0x66, 0xff, 0xd9, 0xdf, 0x5d, 0xff, 0xe3, 0xe6, 0x56, 0xff, 0xe2, 0xe6, 0x5a, 0xff, 0xe3, 0xe9, 0x59, 0xff, 0xe5, 0xe9, 0x55, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe6, 0x5a, 0xff, 0xe3, 0xe5, 0x60, 0xff, 0xde, 0xe6, 0x65, 0xff, 0xd3, 0xdf, 0x6e, 0xff, 0xc7, 0xd5, 0x7e, 0xff, 0x8d, 0x99, 0x5c, 0xff, 0x5c, 0x67, 0x4e, 0xff, 0x9c, 0xa6, 0x9d, 0xff, 0xce, 0xdb, 0xd3, 0xff, 0xdc, 0xea, 0xe1, 0xff, 0xdb, 0xea, 0xe3, 0xff, 0xb7, 0xc4, 0xc4, 0xff, 0x4e, 0x5b, 0x63, 0xff, 0x45, 0x52, 0x60, 0xff, 0x4a, 0x55, 0x65, 0xff, 0x4f, 0x5a, 0x65, 0xff, 0xa0, 0xad, 0xac, 0xff, 0xdf, 0xef, 0xe8, 0xff, 0xe1, 0xf1, 0xe8, 0xff, 0xde, 0xed, 0xe6, 0xff, 0xca, 0xda, 0xd0, 0xff, 0x9c, 0xac, 0x9d, 0xff, 0x66, 0x72, 0x5a, 0xff, 0x67, 0x6f, 0x40, 0xff, 0xaf, 0xb7, 0x68, 0xff, 0xd5, 0xde, 0x77, 0xff, 0xd7, 0xde, 0x78, 0xff, 0xbb, 0xc2, 0x69, 0xff, 0x8c, 0x8f, 0x4c, 0xff, 0x86, 0x86, 0x4c, 0xff, 0xaf, 0xb2, 0x60, 0xff, 0xdb, 0xe0, 0x71, 0xff, 0xdf, 0xe4, 0x61, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe2, 0xe8, 0x54, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe2, 0xe8, 0x56, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe3, 0xe7, 0x59, 0xff, 0xe4, 0xe9, 0x5a, 0xff, 0xe1, 0xe5, 0x56, 0xff, 0xe3, 0xe7, 0x59, 0xff, 0xe2, 0xe6, 0x58, 0xff, 0xe3, 0xe7, 0x58, 0xff, 0xe3, 0xe7, 0x58, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe5, 0x5a, 0xff, 0xe4, 0xe7, 0x59, 0xff, 0xde, 0xe4, 0x60, 0xff, 0xcd, 0xd2, 0x7d, 0xff, 0x64, 0x69, 0x58, 0xff, 0x53, 0x5b, 0x6c, 0xff, 0x52, 0x58, 0x6a, 0xec, 0x81, 0x81, 0x8e, 0x4d, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xa4, 0xb2, 0x38, 0x4d, 0x56, 0x5f, 0xf4, 0x5a, 0x5f, 0x44, 0xff, 0xab, 0xb0, 0x5b, 0xff, 0xdc, 0xe3, 0x5f, 0xff, 0xe2, 0xe6, 0x57, 0xff, 0xe2, 0xe5, 0x5b, 0xff, 0xe3, 0xe9, 0x59, 0xff, 0xe4, 0xe9, 0x55, 0xff, 0xe1, 0xe8, 0x56, 0xff, 0xe3, 0xe9, 0x5a, 0xff, 0xe0, 0xe5, 0x5a, 0xff, 0xde, 0xe3, 0x61, 0xff, 0xd4, 0xdb, 0x74, 0xff, 0x93, 0x99, 0x5c, 0xff, 0x62, 0x6a, 0x59, 0xff, 0xbf, 0xcd, 0xc6, 0xff, 0xd9, 0xea, 0xe5, 0xff, 0xd4, 0xe7, 0xdc, 0xff, 0xd7, 0xec, 0xd6, 0xff, 0xd2, 0xe6, 0xd1, 0xff, 0xdb, 0xed, 0xde, 0xff, 0xc5, 0xd6, 0xcd, 0xff, 0x7e, 0x8b, 0x88, 0xff, 0x79, 0x87, 0x84, 0xff, 0xbf, 0xcf, 0xc7, 0xff, 0xdc, 0xef, 0xe2, 0xff, 0xd9, 0xee, 0xdb, 0xff, 0xd9, 0xef, 0xdb, 0xff, 0xd9, 0xef, 0xdc, 0xff, 0xd8, 0xef, 0xdc, 0xff, 0xd8, 0xef, 0xdf, 0xff, 0xc3, 0xd6, 0xcb, 0xff, 0x7c, 0x87, 0x7e, 0xff, 0x57, 0x5d, 0x3d, 0xff, 0xa2, 0xa8, 0x64, 0xff, 0xd7, 0xdf, 0x72, 0xff, 0xd9, 0xe2, 0x69, 0xff, 0xdc, 0xe1, 0x70, 0xff, 0xdc, 0xdf, 0x73, 0xff, 0xdf, 0xe4, 0x68, 0xff, 0xe2, 0xe7, 0x5c, 0xff, 0xe5, 0xe7, 0x5b, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe5, 0xeb, 0x57, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe0, 0xe6, 0x58, 0xff, 0xde, 0xe4, 0x5e, 0xff, 0xdc, 0xe2, 0x64, 0xff, 0xdb, 0xe3, 0x69, 0xff, 0xd9, 0xe3, 0x68, 0xff, 0xd9, 0xe3, 0x68, 0xff, 0xda, 0xe2, 0x68, 0xff, 0xdf, 0xe5, 0x67, 0xff, 0xe1, 0xe6, 0x62, 0xff, 0xe4, 0xe9, 0x5a, 0xff, 0xe5, 0xe8, 0x5a, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe1, 0xe7, 0x5d, 0xff, 0xcf, 0xd5, 0x77, 0xff, 0x6f, 0x74, 0x57, 0xff, 0x55, 0x5c, 0x64, 0xff, 0x5c, 0x60, 0x6d, 0xff, 0x59, 0x5d, 0x6a, 0xce, 0x95, 0x9c, 0xa3, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xd4, 0xd4, 0xd4, 0x06, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x86, 0x96, 0x4e, 0x4d, 0x53, 0x56, 0xfa, 0x8e, 0x94, 0x61, 0xff, 0xd6, 0xdd, 0x7b, 0xff, 0xda, 0xe3, 0x59, 0xff, 0xe2, 0xe8, 0x55, 0xff, 0xe3, 0xe8, 0x58, 0xff, 0xe2, 0xea, 0x58, 0xff, 0xdf, 0xe8, 0x58, 0xff, 0xe1, 0xe7, 0x5d, 0xff, 0xdc, 0xe4, 0x60, 0xff, 0xd8, 0xe1, 0x68, 0xff, 0xd6, 0xda, 0x79, 0xff, 0xb4, 0xb6, 0x74, 0xff, 0x58, 0x5f, 0x47, 0xff, 0xb4, 0xc4, 0xc0, 0xff, 0xd9, 0xef, 0xe3, 0xff, 0xd2, 0xe8, 0xd8, 0xff, 0xd5, 0xeb, 0xd5, 0xff, 0xd6, 0xec, 0xd1, 0xff, 0xd7, 0xed, 0xd2, 0xff, 0xd9, 0xef, 0xd6, 0xff, 0xd7, 0xed, 0xd8, 0xff, 0xdb, 0xef, 0xe1, 0xff, 0xd8, 0xed, 0xde, 0xff, 0xd7, 0xec, 0xdc, 0xff, 0xd6, 0xed, 0xd8, 0xff, 0xd5, 0xed, 0xd5, 0xff, 0xd4, 0xec, 0xd0, 0xff, 0xd5, 0xed, 0xd3, 0xff, 0xd4, 0xee, 0xd4, 0xff, 0xd1, 0xee, 0xd4, 0xff, 0xce, 0xe9, 0xd6, 0xff, 0xcf, 0xe1, 0xd5, 0xff, 0x83, 0x90, 0x81, 0xff, 0x54, 0x5e, 0x3e, 0xff, 0xb9, 0xbf, 0x6a, 0xff, 0xda, 0xde, 0x73, 0xff, 0xe2, 0xe7, 0x68, 0xff, 0xe1, 0xe7, 0x5c, 0xff, 0xe2, 0xe8, 0x5a, 0xff, 0xe2, 0xe5, 0x58, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe2, 0xea, 0x58, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe2, 0xe5, 0x56, 0xff, 0xda, 0xe1, 0x60, 0xff, 0xc1, 0xc8, 0x5f, 0xff, 0xae, 0xb3, 0x61, 0xff, 0x9f, 0xa6, 0x5c, 0xff, 0x91, 0x9d, 0x50, 0xff, 0x87, 0x93, 0x49, 0xff, 0x8c, 0x92, 0x48, 0xff, 0xa6, 0xaa, 0x50, 0xff, 0xdb, 0xdf, 0x68, 0xff, 0xe0, 0xe8, 0x5c, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe4, 0xe6, 0x59, 0xff, 0xe0, 0xe6, 0x5c, 0xff, 0xd3, 0xda, 0x76, 0xff, 0x7c, 0x7e, 0x57, 0xff, 0x5e, 0x61, 0x57, 0xff, 0x88, 0x8b, 0x7f, 0xff, 0x5f, 0x62, 0x66, 0xfd, 0x5a, 0x60, 0x6e, 0xa4, 0xbf, 0xdf, 0xdf, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x87, 0x96, 0x9d, 0x22, 0x52, 0x58, 0x65, 0x7c, 0x53, 0x53, 0x65, 0xb0, 0x53, 0x58, 0x64, 0x99, 0x7b, 0x7f, 0x89, 0x38, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0x72, 0x7a, 0x89, 0x7d, 0x4e, 0x52, 0x52, 0xfe, 0x9e, 0xa2, 0x6a, 0xff, 0xd7, 0xde, 0x75, 0xff, 0xde, 0xe5, 0x5b, 0xff, 0xe4, 0xe7, 0x56, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe1, 0xe9, 0x57, 0xff, 0xe1, 0xe8, 0x5a, 0xff, 0xe0, 0xe1, 0x69, 0xff, 0xd1, 0xd4, 0x6e, 0xff, 0xb6, 0xb9, 0x6c, 0xff, 0xa1, 0xa2, 0x6f, 0xff, 0x6a, 0x6b, 0x52, 0xff, 0x7d, 0x88, 0x81, 0xff, 0xc4, 0xd8, 0xd1, 0xff, 0xda, 0xef, 0xdc, 0xff, 0xd9, 0xef, 0xd7, 0xff, 0xd7, 0xec, 0xd0, 0xff, 0xd8, 0xee, 0xcf, 0xff, 0xd7, 0xed, 0xce, 0xff, 0xd7, 0xed, 0xd1, 0xff, 0xda, 0xef, 0xd7, 0xff, 0xd9, 0xec, 0xd7, 0xff, 0xd8, 0xeb, 0xd7, 0xff, 0xd7, 0xea, 0xd6, 0xff, 0xd9, 0xed, 0xd7, 0xff, 0xd6, 0xeb, 0xd3, 0xff, 0xd6, 0xec, 0xd2, 0xff, 0xd4, 0xed, 0xd2, 0xff, 0xd0, 0xed, 0xcf, 0xff, 0xce, 0xee, 0xd0, 0xff, 0xcd, 0xea, 0xd4, 0xff, 0xd0, 0xe4, 0xd9, 0xff, 0xd1, 0xdd, 0xd8, 0xff, 0x6d, 0x73, 0x6d, 0xff, 0x81, 0x86, 0x57, 0xff, 0xd0, 0xd6, 0x8c, 0xff, 0xd9, 0xdf, 0x77, 0xff, 0xdb, 0xe3, 0x65, 0xff, 0xde, 0xe7, 0x5e, 0xff, 0xe0, 0xe7, 0x58, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe3, 0xe8, 0x58, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe2, 0xe6, 0x55, 0xff, 0xe0, 0xe5, 0x58, 0xff, 0xd1, 0xd3, 0x5c, 0xff, 0x7a, 0x77, 0x26, 0xff, 0x7d, 0x7a, 0x35, 0xff, 0x81, 0x82, 0x3e, 0xff, 0x85, 0x86, 0x44, 0xff, 0x88, 0x87, 0x49, 0xff, 0x8e, 0x8b, 0x49, 0xff, 0x93, 0x95, 0x3d, 0xff, 0xd8, 0xe1, 0x63, 0xff, 0xe1, 0xe9, 0x5c, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xe7, 0x5a, 0xff, 0xe0, 0xe7, 0x5b, 0xff, 0xd2, 0xd9, 0x72, 0xff, 0x81, 0x84, 0x56, 0xff, 0x60, 0x66, 0x4e, 0xff, 0xaa, 0xb1, 0x8c, 0xff, 0x70, 0x76, 0x60, 0xff, 0x55, 0x58, 0x63, 0xf3, 0x75, 0x7b, 0x84, 0x59, 0xff, 0xff, 0xff, 0x01, 0xaa, 0xaa, 0xff, 0x03, 0x67, 0x6d, 0x7f, 0x52, 0x47, 0x52, 0x58, 0xd6, 0x51, 0x58, 0x52, 0xfc, 0x55, 0x5a, 0x53, 0xff, 0x54, 0x5a, 0x56, 0xfe, 0x4f, 0x55, 0x61, 0xd6, 0x82, 0x88, 0x99, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x04, 0xaa, 0xaa, 0xb6, 0x2a, 0x70, 0x7a, 0x85, 0x64, 0x51, 0x57, 0x66, 0xd7, 0x54, 0x55, 0x50, 0xff, 0x72, 0x75, 0x35, 0xff, 0xcf, 0xd4, 0x62, 0xff, 0xe0, 0xe6, 0x5a, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe2, 0xe8, 0x57, 0xff, 0xe0, 0xe9, 0x54, 0xff, 0xe2, 0xe7, 0x59, 0xff, 0xc1, 0xc1, 0x51, 0xff, 0x81, 0x81, 0x29, 0xff, 0x7a, 0x7d, 0x45, 0xff, 0x6d, 0x70, 0x58, 0xff, 0x4e, 0x53, 0x52, 0xff, 0x54, 0x63, 0x61, 0xff, 0x7a, 0x8f, 0x83, 0xff, 0xd9, 0xef, 0xd7, 0xff, 0xd5, 0xec, 0xd0, 0xff, 0xd7, 0xee, 0xcf, 0xff, 0xd7, 0xee, 0xce, 0xff, 0xd6, 0xed, 0xce, 0xff, 0xd7, 0xee, 0xd1, 0xff, 0xd7, 0xed, 0xd0, 0xff, 0xdb, 0xef, 0xd2, 0xff, 0xdc, 0xef, 0xd4, 0xff, 0xdb, 0xef, 0xd5, 0xff, 0xd7, 0xec, 0xd3, 0xff, 0xd7, 0xed, 0xd5, 0xff, 0xd4, 0xec, 0xd4, 0xff, 0xd0, 0xed, 0xd1, 0xff, 0xce, 0xee, 0xce, 0xff, 0xce, 0xef, 0xcd, 0xff, 0xcd, 0xeb, 0xd1, 0xff, 0xd0, 0xe6, 0xd8, 0xff, 0xb6, 0xc2, 0xc0, 0xff, 0x74, 0x7b, 0x7e, 0xff, 0x5a, 0x61, 0x57, 0xff, 0x82, 0x85, 0x61, 0xff, 0x99, 0x9b, 0x5c, 0xff, 0xb3, 0xb5, 0x60, 0xff, 0xd1, 0xd5, 0x6a, 0xff, 0xe0, 0xe8, 0x62, 0xff, 0xe2, 0xeb, 0x56, 0xff, 0xe5, 0xea, 0x56, 0xff, 0xe3, 0xe6, 0x57, 0xff, 0xe0, 0xe5, 0x58, 0xff, 0xde, 0xe5, 0x56, 0xff, 0xdd, 0xe4, 0x5b, 0xff, 0xdc, 0xdf, 0x65, 0xff, 0xd9, 0xdd, 0x6d, 0xff, 0xd9, 0xe0, 0x70, 0xff, 0xdb, 0xe1, 0x6f, 0xff, 0xde, 0xe1, 0x71, 0xff, 0xe0, 0xe2, 0x72, 0xff, 0xe1, 0xe6, 0x6d, 0xff, 0xde, 0xe7, 0x61, 0xff, 0xe1, 0xe8, 0x5c, 0xff, 0xe4, 0xe9, 0x59, 0xff, 0xe5, 0xe7, 0x59, 0xff, 0xdf, 0xe6, 0x5a, 0xff, 0xd2, 0xda, 0x70, 0xff, 0x81, 0x86, 0x50, 0xff, 0x5f, 0x67, 0x40, 0xff, 0xb1, 0xba, 0x7c, 0xff, 0xae, 0xb7, 0x7e, 0xff, 0x58, 0x5a, 0x4e, 0xff, 0x55, 0x57, 0x61, 0xcc, 0xad, 0xb5, 0xb5, 0x1f, 0x6f, 0x76, 0x89, 0x45, 0x4c, 0x52, 0x5c, 0xe3, 0x50, 0x58, 0x43, 0xff, 0x95, 0xa0, 0x62, 0xff, 0xb4, 0xbf, 0x7b, 0xff, 0x90, 0x9c, 0x67, 0xff, 0x4e, 0x56, 0x4c, 0xfd, 0x56, 0x5b, 0x64, 0x8f, 0xaa, 0xaa, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xae, 0xae, 0x16, 0x65, 0x6d, 0x72, 0x88, 0x52, 0x59, 0x65, 0xbe, 0x59, 0x62, 0x6f, 0x8f, 0x54, 0x57, 0x64, 0xde, 0x5a, 0x5c, 0x49, 0xff, 0xc3, 0xc6, 0x75, 0xff, 0xdd, 0xe2, 0x67, 0xff, 0xe2, 0xe8, 0x5a, 0xff, 0xe4, 0xe7, 0x58, 0xff, 0xe1, 0xe8, 0x56, 0xff, 0xe1, 0xea, 0x53, 0xff, 0xe1, 0xe6, 0x56, 0xff, 0xde, 0xde, 0x5f, 0xff, 0xd5, 0xd9, 0x67, 0xff, 0xca, 0xd3, 0x7d, 0xff, 0xa1, 0xab, 0x7f, 0xff, 0x4f, 0x5b, 0x53, 0xff, 0xbd, 0xcd, 0xc8, 0xff, 0xcf, 0xe5, 0xd4, 0xff, 0xd4, 0xed, 0xd3, 0xff, 0xd6, 0xee, 0xd2, 0xff, 0xd5, 0xef, 0xd1, 0xff, 0xd5, 0xee, 0xd0, 0xff, 0xd4, 0xec, 0xd0, 0xff, 0xd6, 0xed, 0xd1, 0xff, 0xd9, 0xf0, 0xd1, 0xff, 0xd8, 0xf0, 0xce, 0xff, 0xdb, 0xf1, 0xd0, 0xff, 0xda, 0xf0, 0xd1, 0xff, 0xd6, 0xed, 0xd0, 0xff, 0xd3, 0xed, 0xd2, 0xff, 0xcf, 0xec, 0xd2, 0xff, 0xce, 0xed, 0xd2, 0xff, 0xcf, 0xed, 0xd0, 0xff, 0xce, 0xed, 0xce, 0xff, 0xcd, 0xec, 0xcd, 0xff, 0xd3, 0xeb, 0xd5, 0xff, 0x91, 0xa3, 0x99, 0xff, 0x8c, 0x98, 0x99, 0xff, 0x53, 0x5c, 0x5f, 0xff, 0x70, 0x77, 0x5e, 0xff, 0x8e, 0x92, 0x60, 0xff, 0x7e, 0x7f, 0x37, 0xff, 0x87, 0x89, 0x2d, 0xff, 0xdb, 0xe0, 0x64, 0xff, 0xe2, 0xe9, 0x59, 0xff, 0xe5, 0xe9, 0x55, 0xff, 0xe3, 0xe5, 0x58, 0xff, 0xe2, 0xe7, 0x59, 0xff, 0xde, 0xe8, 0x54, 0xff, 0xdd, 0xe7, 0x54, 0xff, 0xdd, 0xe4, 0x5a, 0xff, 0xdc, 0xe3, 0x5e, 0xff, 0xdd, 0xe7, 0x5e, 0xff, 0xe0, 0xe7, 0x5d, 0xff, 0xe2, 0xe6, 0x5d, 0xff, 0xe3, 0xe5, 0x5d, 0xff, 0xe3, 0xe7, 0x5d, 0xff, 0xe0, 0xe7, 0x5a, 0xff, 0xe1, 0xe7, 0x5b, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe2, 0xe7, 0x56, 0xff, 0xdf, 0xe7, 0x5b, 0xff, 0xd1, 0xd9, 0x6e, 0xff, 0x80, 0x85, 0x4a, 0xff, 0x64, 0x6d, 0x3a, 0xff, 0xb5, 0xbc, 0x6c, 0xff, 0xca, 0xd6, 0x78, 0xff, 0x8d, 0x93, 0x5a, 0xff, 0x4e, 0x50, 0x50, 0xfc, 0x60, 0x62, 0x74, 0xa7, 0x49, 0x50, 0x5c, 0xd9, 0x4e, 0x55, 0x46, 0xff, 0xa3, 0xaa, 0x67, 0xff, 0xd2, 0xde, 0x74, 0xff, 0xd5, 0xe1, 0x6d, 0xff, 0xc3, 0xcf, 0x74, 0xff, 0x64, 0x6a, 0x46, 0xff, 0x4f, 0x52, 0x54, 0xce, 0xb6, 0xb6, 0xc8, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x67, 0x6b, 0x3e, 0x54, 0x5b, 0x5e, 0x6a, 0x83, 0x8a, 0x98, 0x25, 0xb8, 0xc6, 0xc6, 0x12, 0x5a, 0x5e, 0x63, 0xcf, 0x6e, 0x71, 0x4c, 0xff, 0xd5, 0xda, 0x7a, 0xff, 0xe0, 0xe6, 0x62, 0xff, 0xe3, 0xe9, 0x59, 0xff, 0xe2, 0xe7, 0x58, 0xff, 0xde, 0xe8, 0x55, 0xff, 0xe0, 0xeb, 0x53, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe0, 0xe6, 0x58, 0xff, 0xdb, 0xe5, 0x5b, 0xff, 0xd0, 0xdc, 0x6d, 0xff, 0xa0, 0xac, 0x6e, 0xff, 0x52, 0x5f, 0x51, 0xff, 0xb7, 0xc7, 0xbe, 0xff, 0xcd, 0xe1, 0xcd, 0xff, 0xd5, 0xed, 0xd1, 0xff, 0xd5, 0xef, 0xd2, 0xff, 0xd5, 0xee, 0xd1, 0xff, 0xd6, 0xef, 0xd1, 0xff, 0xd9, 0xf0, 0xd1, 0xff, 0xda, 0xef, 0xd0, 0xff, 0xd5, 0xe8, 0xc8, 0xff, 0xce, 0xe2, 0xc0, 0xff, 0xca, 0xdd, 0xba, 0xff, 0xd4, 0xe9, 0xc6, 0xff, 0xd9, 0xf0, 0xce, 0xff, 0xd3, 0xee, 0xce, 0xff, 0xd0, 0xee, 0xd0, 0xff, 0xce, 0xec, 0xd0, 0xff, 0xcf, 0xec, 0xd2, 0xff, 0xd2, 0xed, 0xd3, 0xff, 0xd4, 0xee, 0xd2, 0xff, 0xd5, 0xed, 0xd4, 0xff, 0xda, 0xef, 0xe1, 0xff, 0xdb, 0xeb, 0xe9, 0xff, 0x71, 0x78, 0x7c, 0xff, 0x90, 0x98, 0x6e, 0xff, 0xd4, 0xde, 0x89, 0xff, 0xdb, 0xe4, 0x75, 0xff, 0xdc, 0xe3, 0x6b, 0xff, 0xe1, 0xe7, 0x65, 0xff, 0xe1, 0xe7, 0x5b, 0xff, 0xe3, 0xe6, 0x5a, 0xff, 0xe3, 0xe6, 0x59, 0xff, 0xe4, 0xe9, 0x56, 0xff, 0xe1, 0xe8, 0x55, 0xff, 0xdd, 0xe3, 0x5f, 0xff, 0xc6, 0xc8, 0x5e, 0xff, 0xca, 0xcb, 0x6a, 0xff, 0xd5, 0xd9, 0x70, 0xff, 0xdd, 0xe4, 0x6e, 0xff, 0xdf, 0xe6, 0x62, 0xff, 0xe2, 0xea, 0x5a, 0xff, 0xe1, 0xe9, 0x56, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe2, 0xe7, 0x58, 0xff, 0xe2, 0xe9, 0x55, 0xff, 0xe1, 0xe7, 0x55, 0xff, 0xdc, 0xe5, 0x5a, 0xff, 0xce, 0xd5, 0x6d, 0xff, 0x79, 0x7c, 0x41, 0xff, 0x6b, 0x73, 0x39, 0xff, 0xbc, 0xc1, 0x63, 0xff, 0xcf, 0xd9, 0x62, 0xff, 0xc3, 0xcc, 0x72, 0xff, 0x58, 0x5d, 0x43, 0xff, 0x49, 0x4c, 0x57, 0xfe, 0x48, 0x4f, 0x4e, 0xff, 0x7e, 0x85, 0x53, 0xff, 0xd2, 0xd8, 0x79, 0xff, 0xde, 0xe4, 0x64, 0xff, 0xde, 0xe4, 0x60, 0xff, 0xce, 0xd6, 0x6d, 0xff, 0x80, 0x85, 0x56, 0xff, 0x4f, 0x51, 0x57, 0xe7, 0x90, 0x90, 0xa1, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xb1, 0xba, 0x1a, 0x4f, 0x54, 0x50, 0xe8, 0x79, 0x7d, 0x4a, 0xff, 0xdb, 0xe1, 0x76, 0xff, 0xe1, 0xe9, 0x5f, 0xff, 0xe3, 0xea, 0x59, 0xff, 0xe1, 0xe8, 0x5a, 0xff, 0xdd, 0xea, 0x56, 0xff, 0xdf, 0xeb, 0x51, 0xff, 0xe0, 0xe8, 0x55, 0xff, 0xdc, 0xe7, 0x58, 0xff, 0xda, 0xe6, 0x5a, 0xff, 0xcf, 0xd9, 0x6b, 0xff, 0xa8, 0xb0, 0x78, 0xff, 0x4d, 0x56, 0x50, 0xff, 0x5f, 0x6d, 0x68, 0xff, 0xad, 0xc1, 0xaa, 0xff, 0xdb, 0xf2, 0xd2, 0xff, 0xda, 0xf1, 0xd1, 0xff, 0xd9, 0xf0, 0xcf, 0xff, 0xd9, 0xee, 0xcd, 0xff, 0xdc, 0xed, 0xcc, 0xff, 0xd8, 0xe6, 0xc4, 0xff, 0xc9, 0xd6, 0xb4, 0xff, 0xbc, 0xca, 0xa8, 0xff, 0xb3, 0xc1, 0x9e, 0xff, 0xc4, 0xd3, 0xae, 0xff, 0xcf, 0xe1, 0xbc, 0xff, 0xd5, 0xec, 0xc9, 0xff, 0xd2, 0xef, 0xcc, 0xff, 0xd0, 0xef, 0xce, 0xff, 0xd2, 0xed, 0xd2, 0xff, 0xd5, 0xec, 0xd6, 0xff, 0xd8, 0xed, 0xd7, 0xff, 0xd8, 0xed, 0xd8, 0xff, 0xb6, 0xca, 0xc0, 0xff, 0xd2, 0xe1, 0xe4, 0xff, 0x74, 0x78, 0x79, 0xff, 0x91, 0x97, 0x61, 0xff, 0xd6, 0xe0, 0x77, 0xff, 0xdb, 0xe5, 0x60, 0xff, 0xe1, 0xe8, 0x60, 0xff, 0xe2, 0xe8, 0x5c, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe1, 0xe9, 0x57, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe7, 0xe9, 0x58, 0xff, 0xe3, 0xe7, 0x5a, 0xff, 0xde, 0xe2, 0x68, 0xff, 0x8e, 0x90, 0x37, 0xff, 0x6c, 0x6d, 0x24, 0xff, 0x7d, 0x80, 0x3d, 0xff, 0xa3, 0xaa, 0x59, 0xff, 0xcc, 0xd4, 0x71, 0xff, 0xd9, 0xe3, 0x6d, 0xff, 0xde, 0xe6, 0x61, 0xff, 0xe1, 0xe6, 0x5b, 0xff, 0xe3, 0xe7, 0x58, 0xff, 0xe2, 0xe8, 0x52, 0xff, 0xe1, 0xe7, 0x54, 0xff, 0xda, 0xe1, 0x58, 0xff, 0xca, 0xd0, 0x6b, 0xff, 0x72, 0x75, 0x3c, 0xff, 0x7a, 0x81, 0x44, 0xff, 0xc0, 0xc4, 0x5a, 0xff, 0xd3, 0xda, 0x5b, 0xff, 0xd3, 0xda, 0x72, 0xff, 0x90, 0x97, 0x5e, 0xff, 0x54, 0x59, 0x52, 0xff, 0x50, 0x57, 0x45, 0xff, 0xb6, 0xc1, 0x76, 0xff, 0xd4, 0xdf, 0x66, 0xff, 0xe4, 0xe9, 0x5f, 0xff, 0xe1, 0xe4, 0x5d, 0xff, 0xd7, 0xde, 0x6f, 0xff, 0x8a, 0x91, 0x5b, 0xff, 0x56, 0x5c, 0x61, 0xf0, 0x89, 0x8d, 0x9b, 0x38, 0xff, 0xff, 0xff, 0x01, 0xd1, 0xd1, 0xd1, 0x0b, 0xb1, 0xb1, 0xc4, 0x0d, 0xc6, 0xc6, 0xe3, 0x09, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x95, 0x95, 0x24, 0x53, 0x56, 0x4f, 0xee, 0x8b, 0x90, 0x53, 0xff, 0xdb, 0xe3, 0x70, 0xff, 0xe1, 0xe8, 0x5d, 0xff, 0xe3, 0xea, 0x59, 0xff, 0xe3, 0xea, 0x59, 0xff, 0xe1, 0xea, 0x56, 0xff, 0xdf, 0xeb, 0x55, 0xff, 0xde, 0xe7, 0x56, 0xff, 0xda, 0xe6, 0x61, 0xff, 0xd6, 0xde, 0x6c, 0xff, 0xbd, 0xc3, 0x6d, 0xff, 0x73, 0x77, 0x4c, 0xff, 0x54, 0x5b, 0x56, 0xff, 0x93, 0x9e, 0x9b, 0xff, 0xd4, 0xe4, 0xce, 0xff, 0xd4, 0xe8, 0xc2, 0xff, 0xd7, 0xe9, 0xc3, 0xff, 0xd6, 0xe9, 0xc1, 0xff, 0xd2, 0xe6, 0xbc, 0xff, 0xca, 0xdb, 0xb4, 0xff, 0xc4, 0xcf, 0xb1, 0xff, 0xb9, 0xc1, 0xa9, 0xff, 0x80, 0x88, 0x72, 0xff, 0x59, 0x5f, 0x4c, 0xff, 0x9e, 0xa6, 0x8d, 0xff, 0xbd, 0xcc, 0xa7, 0xff, 0xc6, 0xda, 0xaf, 0xff, 0xd5, 0xea, 0xc1, 0xff, 0xd7, 0xef, 0xcb, 0xff, 0xd6, 0xeb, 0xd0, 0xff, 0xda, 0xec, 0xd5, 0xff, 0xd9, 0xec, 0xd5, 0xff, 0xd6, 0xea, 0xd6, 0xff, 0x73, 0x84, 0x7c, 0xff, 0x5d, 0x69, 0x6f, 0xff, 0x59, 0x59, 0x60, 0xff, 0x94, 0x98, 0x6a, 0xff, 0xd7, 0xdd, 0x7c, 0xff, 0xe0, 0xe6, 0x65, 0xff, 0xe4, 0xe7, 0x5e, 0xff, 0xe8, 0xe9, 0x5b, 0xff, 0xe6, 0xe9, 0x56, 0xff, 0xe5, 0xea, 0x55, 0xff, 0xe6, 0xe9, 0x55, 0xff, 0xe7, 0xeb, 0x57, 0xff, 0xe6, 0xeb, 0x5b, 0xff, 0xdf, 0xe7, 0x63, 0xff, 0xdd, 0xe4, 0x70, 0xff, 0xca, 0xce, 0x70, 0xff, 0x98, 0x9a, 0x53, 0xff, 0x6c, 0x6e, 0x35, 0xff, 0x6b, 0x6e, 0x36, 0xff, 0xa9, 0xae, 0x62, 0xff, 0xd9, 0xdf, 0x74, 0xff, 0xdf, 0xe5, 0x5f, 0xff, 0xe2, 0xe8, 0x55, 0xff, 0xe2, 0xe8, 0x54, 0xff, 0xdf, 0xe7, 0x53, 0xff, 0xd8, 0xe0, 0x58, 0xff, 0xc1, 0xc4, 0x68, 0xff, 0x76, 0x77, 0x3f, 0xff, 0x87, 0x91, 0x4a, 0xff, 0xc4, 0xcc, 0x5b, 0xff, 0xd9, 0xde, 0x5b, 0xff, 0xd9, 0xdd, 0x6a, 0xff, 0xbb, 0xc3, 0x74, 0xff, 0x5a, 0x62, 0x43, 0xff, 0x57, 0x5f, 0x41, 0xff, 0xbc, 0xca, 0x75, 0xff, 0xd8, 0xe4, 0x5f, 0xff, 0xe5, 0xe9, 0x5e, 0xff, 0xe1, 0xe6, 0x5d, 0xff, 0xd3, 0xdf, 0x6b, 0xff, 0x83, 0x8d, 0x56, 0xff, 0x5b, 0x60, 0x63, 0xfa, 0x7c, 0x7f, 0x8d, 0x88, 0x68, 0x72, 0x75, 0x89, 0x55, 0x5c, 0x5d, 0xc5, 0x57, 0x59, 0x5d, 0xd0, 0x59, 0x5c, 0x5e, 0xbd, 0x58, 0x60, 0x62, 0x85, 0x73, 0x7b, 0x84, 0x3e, 0xa2, 0xa2, 0xb9, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x7d, 0x82, 0x2b, 0x51, 0x57, 0x4e, 0xf1, 0x99, 0x9e, 0x5c, 0xff, 0xdc, 0xe4, 0x6d, 0xff, 0xe0, 0xe8, 0x5b, 0xff, 0xe3, 0xe8, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x55, 0xff, 0xe0, 0xe9, 0x56, 0xff, 0xde, 0xe8, 0x59, 0xff, 0xd9, 0xe2, 0x6a, 0xff, 0xb2, 0xb5, 0x5c, 0xff, 0x77, 0x79, 0x31, 0xff, 0xa5, 0xad, 0x6f, 0xff, 0x79, 0x83, 0x5d, 0xff, 0x5d, 0x66, 0x59, 0xff, 0xa0, 0xab, 0x9a, 0xff, 0xbe, 0xcc, 0xb1, 0xff, 0xbd, 0xc9, 0xac, 0xff, 0xbb, 0xc8, 0xa8, 0xff, 0xb3, 0xc3, 0xa2, 0xff, 0xab, 0xba, 0x9d, 0xff, 0x97, 0xa1, 0x8d, 0xff, 0x62, 0x68, 0x56, 0xff, 0x63, 0x6a, 0x51, 0xff, 0x69, 0x6d, 0x54, 0xff, 0x59, 0x5e, 0x45, 0xff, 0x92, 0x9d, 0x7e, 0xff, 0xb7, 0xc6, 0xa0, 0xff, 0xc1, 0xd0, 0xa9, 0xff, 0xcc, 0xde, 0xb6, 0xff, 0xd5, 0xe7, 0xc0, 0xff, 0xd9, 0xe9, 0xc3, 0xff, 0xd8, 0xea, 0xc7, 0xff, 0xd0, 0xe5, 0xc9, 0xff, 0xcc, 0xdd, 0xce, 0xff, 0x8f, 0x9a, 0x95, 0xff, 0x55, 0x59, 0x53, 0xff, 0x63, 0x67, 0x45, 0xff, 0xae, 0xb3, 0x66, 0xff, 0xda, 0xdf, 0x6c, 0xff, 0xe4, 0xe7, 0x60, 0xff, 0xe6, 0xe7, 0x5a, 0xff, 0xe8, 0xe7, 0x59, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe8, 0xea, 0x55, 0xff, 0xe6, 0xec, 0x56, 0xff, 0xe4, 0xec, 0x58, 0xff, 0xe2, 0xeb, 0x5d, 0xff, 0xe1, 0xe9, 0x62, 0xff, 0xe2, 0xe8, 0x6a, 0xff, 0xde, 0xe3, 0x77, 0xff, 0xc8, 0xce, 0x77, 0xff, 0x97, 0x9c, 0x56, 0xff, 0x6b, 0x70, 0x27, 0xff, 0xa2, 0xa6, 0x47, 0xff, 0xde, 0xe2, 0x63, 0xff, 0xe2, 0xea, 0x55, 0xff, 0xe1, 0xe7, 0x56, 0xff, 0xdd, 0xe6, 0x53, 0xff, 0xd7, 0xdf, 0x58, 0xff, 0xbc, 0xbd, 0x62, 0xff, 0x78, 0x78, 0x39, 0xff, 0x97, 0xa2, 0x4d, 0xff, 0xc7, 0xd0, 0x5a, 0xff, 0xda, 0xe1, 0x57, 0xff, 0xdb, 0xe0, 0x5e, 0xff, 0xd1, 0xd9, 0x79, 0xff, 0x70, 0x78, 0x46, 0xff, 0x51, 0x58, 0x35, 0xff, 0xb0, 0xbc, 0x67, 0xff, 0xd8, 0xe2, 0x60, 0xff, 0xe6, 0xe9, 0x62, 0xff, 0xe0, 0xe5, 0x5f, 0xff, 0xcd, 0xdb, 0x6c, 0xff, 0x75, 0x7e, 0x50, 0xff, 0x59, 0x5c, 0x5e, 0xff, 0x59, 0x5d, 0x5e, 0xfd, 0x59, 0x61, 0x53, 0xfe, 0x5f, 0x69, 0x49, 0xff, 0x67, 0x6c, 0x4b, 0xff, 0x60, 0x62, 0x45, 0xff, 0x53, 0x59, 0x46, 0xfd, 0x4e, 0x56, 0x55, 0xef, 0x50, 0x53, 0x58, 0x9f, 0x9c, 0xaa, 0xb8, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x6a, 0x72, 0x3a, 0x4f, 0x54, 0x4a, 0xf4, 0xa2, 0xa7, 0x62, 0xff, 0xdc, 0xe4, 0x6b, 0xff, 0xe1, 0xe9, 0x5b, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe6, 0xeb, 0x58, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe0, 0xe9, 0x5c, 0xff, 0xc2, 0xc8, 0x59, 0xff, 0x8e, 0x8e, 0x39, 0xff, 0xd1, 0xd3, 0x71, 0xff, 0xd6, 0xe1, 0x79, 0xff, 0xc3, 0xd1, 0x7e, 0xff, 0x71, 0x7b, 0x53, 0xff, 0x59, 0x61, 0x59, 0xff, 0x6a, 0x73, 0x72, 0xff, 0x7e, 0x86, 0x7f, 0xff, 0x80, 0x88, 0x81, 0xff, 0x73, 0x7b, 0x76, 0xff, 0x5c, 0x63, 0x5b, 0xff, 0x58, 0x5d, 0x47, 0xff, 0x7c, 0x7f, 0x55, 0xff, 0x9e, 0xa2, 0x69, 0xff, 0xa3, 0xaa, 0x68, 0xff, 0x83, 0x8a, 0x50, 0xff, 0x60, 0x65, 0x43, 0xff, 0x7a, 0x81, 0x6c, 0xff, 0xae, 0xb9, 0xa2, 0xff, 0xbe, 0xce, 0xab, 0xff, 0xbf, 0xd1, 0xa4, 0xff, 0xbf, 0xcf, 0xa2, 0xff, 0xba, 0xca, 0xa7, 0xff, 0xbb, 0xc9, 0xb5, 0xff, 0xa5, 0xb0, 0x9f, 0xff, 0x64, 0x6e, 0x55, 0xff, 0x6e, 0x75, 0x49, 0xff, 0xa2, 0xa7, 0x73, 0xff, 0x71, 0x75, 0x36, 0xff, 0x9a, 0x9f, 0x46, 0xff, 0xd9, 0xdf, 0x66, 0xff, 0xe1, 0xe6, 0x5b, 0xff, 0xe5, 0xea, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x5a, 0xff, 0xe5, 0xeb, 0x5b, 0xff, 0xe4, 0xeb, 0x5c, 0xff, 0xe2, 0xea, 0x5c, 0xff, 0xe1, 0xea, 0x58, 0xff, 0xde, 0xe9, 0x5a, 0xff, 0xdb, 0xe3, 0x66, 0xff, 0xd8, 0xdf, 0x71, 0xff, 0xce, 0xd3, 0x67, 0xff, 0xc2, 0xc5, 0x54, 0xff, 0xde, 0xe2, 0x62, 0xff, 0xdf, 0xe6, 0x55, 0xff, 0xdf, 0xe6, 0x56, 0xff, 0xdd, 0xe6, 0x53, 0xff, 0xd7, 0xdf, 0x55, 0xff, 0xba, 0xbb, 0x55, 0xff, 0x7b, 0x7c, 0x2a, 0xff, 0xae, 0xb8, 0x53, 0xff, 0xcd, 0xd6, 0x56, 0xff, 0xdd, 0xe4, 0x52, 0xff, 0xde, 0xe4, 0x58, 0xff, 0xd8, 0xe4, 0x74, 0xff, 0x91, 0x9b, 0x5b, 0xff, 0x5a, 0x61, 0x3c, 0xff, 0x99, 0xa6, 0x59, 0xff, 0xd7, 0xe4, 0x67, 0xff, 0xe4, 0xec, 0x62, 0xff, 0xde, 0xe5, 0x62, 0xff, 0xc6, 0xd2, 0x6c, 0xff, 0x64, 0x6d, 0x41, 0xff, 0x57, 0x5e, 0x4f, 0xff, 0x6a, 0x6e, 0x48, 0xff, 0xaa, 0xaf, 0x69, 0xff, 0xc8, 0xd2, 0x78, 0xff, 0xcf, 0xd5, 0x77, 0xff, 0xc5, 0xc9, 0x70, 0xff, 0xa8, 0xaa, 0x66, 0xff, 0x68, 0x67, 0x47, 0xff, 0x53, 0x56, 0x50, 0xf8, 0x5e, 0x61, 0x6a, 0x6c, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x6c, 0x72, 0x4e, 0x4f, 0x56, 0x4b, 0xf7, 0xa6, 0xab, 0x63, 0xff, 0xdb, 0xe3, 0x66, 0xff, 0xe2, 0xe9, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xea, 0x58, 0xff, 0xe4, 0xe9, 0x59, 0xff, 0xe1, 0xe9, 0x5c, 0xff, 0xda, 0xe0, 0x60, 0xff, 0xdc, 0xe0, 0x6a, 0xff, 0xdd, 0xe1, 0x68, 0xff, 0xdc, 0xe6, 0x60, 0xff, 0xd4, 0xe1, 0x6b, 0xff, 0xae, 0xb9, 0x76, 0xff, 0x62, 0x69, 0x5d, 0xff, 0x6e, 0x74, 0x82, 0xff, 0x5c, 0x65, 0x6c, 0xff, 0x4f, 0x58, 0x5f, 0xff, 0x4c, 0x50, 0x5f, 0xff, 0x51, 0x55, 0x53, 0xff, 0x92, 0x97, 0x6b, 0xff, 0xa9, 0xac, 0x5f, 0xff, 0xb0, 0xb3, 0x54, 0xff, 0xb0, 0xb7, 0x53, 0xff, 0xb3, 0xbb, 0x63, 0xff, 0x9e, 0xa1, 0x65, 0xff, 0x6f, 0x72, 0x51, 0xff, 0x5d, 0x65, 0x53, 0xff, 0x7a, 0x84, 0x78, 0xff, 0x98, 0xa3, 0x90, 0xff, 0xa1, 0xab, 0x95, 0xff, 0x95, 0x9d, 0x93, 0xff, 0x77, 0x7c, 0x7d, 0xff, 0x5c, 0x5e, 0x52, 0xff, 0x6d, 0x72, 0x45, 0xff, 0xc2, 0xc8, 0x77, 0xff, 0xce, 0xd6, 0x79, 0xff, 0xcc, 0xd5, 0x74, 0xff, 0x8f, 0x95, 0x3d, 0xff, 0xb4, 0xb7, 0x51, 0xff, 0xe2, 0xe6, 0x60, 0xff, 0xe6, 0xec, 0x54, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe5, 0xe8, 0x5c, 0xff, 0xe5, 0xe8, 0x5b, 0xff, 0xe6, 0xea, 0x59, 0xff, 0xe5, 0xeb, 0x56, 0xff, 0xe4, 0xeb, 0x55, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe3, 0xe7, 0x59, 0xff, 0xe4, 0xe8, 0x5c, 0xff, 0xe2, 0xe7, 0x5c, 0xff, 0xe1, 0xe7, 0x5b, 0xff, 0xde, 0xe7, 0x58, 0xff, 0xde, 0xe8, 0x55, 0xff, 0xde, 0xe6, 0x56, 0xff, 0xde, 0xe5, 0x54, 0xff, 0xd9, 0xe2, 0x54, 0xff, 0xba, 0xbc, 0x48, 0xff, 0x97, 0x99, 0x32, 0xff, 0xc8, 0xcf, 0x5a, 0xff, 0xd8, 0xdf, 0x58, 0xff, 0xe2, 0xe7, 0x53, 0xff, 0xdf, 0xe5, 0x53, 0xff, 0xd9, 0xe5, 0x66, 0xff, 0xb2, 0xbd, 0x71, 0xff, 0x5b, 0x62, 0x3d, 0xff, 0x87, 0x90, 0x52, 0xff, 0xd5, 0xdf, 0x6c, 0xff, 0xe3, 0xeb, 0x5f, 0xff, 0xdf, 0xe5, 0x61, 0xff, 0xc1, 0xc9, 0x63, 0xff, 0x5e, 0x64, 0x2a, 0xff, 0x76, 0x7f, 0x47, 0xff, 0xca, 0xcf, 0x79, 0xff, 0xdf, 0xe2, 0x72, 0xff, 0xdd, 0xe5, 0x65, 0xff, 0xde, 0xe4, 0x5e, 0xff, 0xdd, 0xe1, 0x5e, 0xff, 0xd6, 0xd9, 0x6b, 0xff, 0xb8, 0xb8, 0x6d, 0xff, 0x59, 0x5f, 0x46, 0xff, 0x4c, 0x53, 0x53, 0xb6, 0xb6, 0xb6, 0xb6, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x69, 0x71, 0x5a, 0x51, 0x57, 0x4d, 0xf8, 0xa8, 0xad, 0x64, 0xff, 0xdd, 0xe3, 0x66, 0xff, 0xe3, 0xe9, 0x59, 0xff, 0xe6, 0xeb, 0x5a, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x5a, 0xff, 0xe5, 0xeb, 0x5b, 0xff, 0xe0, 0xea, 0x57, 0xff, 0xdf, 0xe7, 0x5b, 0xff, 0xe3, 0xe8, 0x5f, 0xff, 0xe2, 0xe8, 0x58, 0xff, 0xda, 0xe3, 0x5e, 0xff, 0xbf, 0xc9, 0x75, 0xff, 0x6a, 0x71, 0x5a, 0xff, 0xcd, 0xd4, 0xdc, 0xff, 0xdd, 0xe7, 0xea, 0xff, 0xd0, 0xdb, 0xdf, 0xff, 0x91, 0x98, 0x9f, 0xff, 0x5d, 0x62, 0x4d, 0xff, 0xb7, 0xbd, 0x72, 0xff, 0xc4, 0xc9, 0x54, 0xff, 0xc1, 0xc5, 0x49, 0xff, 0xbe, 0xc4, 0x4d, 0xff, 0xb8, 0xbf, 0x4e, 0xff, 0xb9, 0xbe, 0x5c, 0xff, 0xac, 0xb1, 0x6f, 0xff, 0x66, 0x6d, 0x52, 0xff, 0x65, 0x6a, 0x72, 0xff, 0x66, 0x6c, 0x75, 0xff, 0x5b, 0x61, 0x66, 0xff, 0x5b, 0x5f, 0x6c, 0xff, 0x53, 0x54, 0x5e, 0xff, 0x6f, 0x72, 0x53, 0xff, 0xbf, 0xc6, 0x78, 0xff, 0xde, 0xe3, 0x6c, 0xff, 0xdd, 0xe5, 0x64, 0xff, 0xdb, 0xe5, 0x63, 0xff, 0xdb, 0xe3, 0x66, 0xff, 0xd5, 0xd8, 0x5d, 0xff, 0xe4, 0xe4, 0x5f, 0xff, 0xe6, 0xe8, 0x58, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe5, 0xe9, 0x5a, 0xff, 0xe4, 0xe7, 0x5b, 0xff, 0xe5, 0xe8, 0x5a, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe6, 0xeb, 0x54, 0xff, 0xe6, 0xea, 0x55, 0xff, 0xe6, 0xe7, 0x57, 0xff, 0xe8, 0xe9, 0x56, 0xff, 0xe8, 0xe9, 0x55, 0xff, 0xe8, 0xea, 0x56, 0xff, 0xe4, 0xe8, 0x56, 0xff, 0xe2, 0xe7, 0x57, 0xff, 0xdf, 0xe7, 0x56, 0xff, 0xe0, 0xe6, 0x56, 0xff, 0xe0, 0xe7, 0x56, 0xff, 0xdf, 0xe5, 0x56, 0xff, 0xd3, 0xd6, 0x53, 0xff, 0xcc, 0xcf, 0x52, 0xff, 0xd8, 0xdc, 0x59, 0xff, 0xdd, 0xe2, 0x58, 0xff, 0xe1, 0xe6, 0x54, 0xff, 0xe2, 0xe8, 0x56, 0xff, 0xdc, 0xe8, 0x5f, 0xff, 0xc6, 0xcf, 0x77, 0xff, 0x59, 0x5e, 0x39, 0xff, 0x79, 0x7e, 0x4a, 0xff, 0xd6, 0xdb, 0x71, 0xff, 0xe6, 0xec, 0x5f, 0xff, 0xe5, 0xe8, 0x60, 0xff, 0xcd, 0xd1, 0x5d, 0xff, 0xaa, 0xb0, 0x54, 0xff, 0xd0, 0xd9, 0x74, 0xff, 0xdd, 0xe3, 0x69, 0xff, 0xe3, 0xe8, 0x60, 0xff, 0xe1, 0xe7, 0x5c, 0xff, 0xe1, 0xe5, 0x58, 0xff, 0xe2, 0xe6, 0x54, 0xff, 0xdc, 0xe3, 0x5a, 0xff, 0xcc, 0xd1, 0x68, 0xff, 0x6d, 0x74, 0x48, 0xff, 0x4c, 0x54, 0x4e, 0xd4, 0x68, 0x74, 0x74, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6c, 0x75, 0x55, 0x52, 0x57, 0x4e, 0xf7, 0xaa, 0xae, 0x65, 0xff, 0xde, 0xe3, 0x66, 0xff, 0xe5, 0xe9, 0x59, 0xff, 0xe4, 0xe9, 0x59, 0xff, 0xe4, 0xe9, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe5, 0xeb, 0x55, 0xff, 0xe1, 0xeb, 0x55, 0xff, 0xe0, 0xe8, 0x57, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xde, 0xe4, 0x5c, 0xff, 0xc9, 0xd2, 0x73, 0xff, 0x69, 0x72, 0x4a, 0xff, 0xc0, 0xc5, 0xc4, 0xff, 0xf4, 0xfc, 0xfc, 0xff, 0xf0, 0xfa, 0xfe, 0xff, 0x90, 0x98, 0x9b, 0xff, 0x70, 0x75, 0x4d, 0xff, 0xd3, 0xd7, 0x75, 0xff, 0xdf, 0xe4, 0x5a, 0xff, 0xd7, 0xdd, 0x53, 0xff, 0xd5, 0xdc, 0x5b, 0xff, 0xce, 0xd5, 0x52, 0xff, 0xc9, 0xcf, 0x4d, 0xff, 0xbf, 0xc4, 0x68, 0xff, 0x72, 0x76, 0x4f, 0xff, 0xa6, 0xab, 0xb1, 0xff, 0xe8, 0xee, 0xf5, 0xff, 0xdf, 0xe4, 0xed, 0xff, 0xcc, 0xd1, 0xdd, 0xff, 0x5c, 0x5f, 0x5b, 0xff, 0x9b, 0xa2, 0x61, 0xff, 0xd6, 0xe1, 0x6e, 0xff, 0xe2, 0xe8, 0x5b, 0xff, 0xe3, 0xe8, 0x5a, 0xff, 0xe3, 0xea, 0x5c, 0xff, 0xe2, 0xea, 0x58, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe7, 0xe8, 0x5c, 0xff, 0xe5, 0xe6, 0x5c, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x55, 0xff, 0xe6, 0xe9, 0x54, 0xff, 0xe7, 0xe9, 0x54, 0xff, 0xe6, 0xe9, 0x54, 0xff, 0xe5, 0xe9, 0x55, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe4, 0xe6, 0x58, 0xff, 0xe5, 0xe6, 0x5b, 0xff, 0xe4, 0xe7, 0x58, 0xff, 0xe2, 0xe7, 0x55, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe3, 0xe8, 0x58, 0xff, 0xe1, 0xe5, 0x59, 0xff, 0xe0, 0xe4, 0x59, 0xff, 0xe1, 0xe4, 0x58, 0xff, 0xe1, 0xe5, 0x57, 0xff, 0xe3, 0xe6, 0x58, 0xff, 0xe3, 0xe7, 0x58, 0xff, 0xdf, 0xea, 0x5c, 0xff, 0xd3, 0xd9, 0x78, 0xff, 0x61, 0x65, 0x38, 0xff, 0x6a, 0x70, 0x3d, 0xff, 0xd4, 0xdb, 0x72, 0xff, 0xe4, 0xeb, 0x5c, 0xff, 0xe7, 0xe8, 0x5b, 0xff, 0xe2, 0xe7, 0x5f, 0xff, 0xe0, 0xe7, 0x65, 0xff, 0xe0, 0xe6, 0x61, 0xff, 0xe3, 0xe9, 0x5b, 0xff, 0xe3, 0xe9, 0x5a, 0xff, 0xe1, 0xe6, 0x5a, 0xff, 0xe1, 0xe4, 0x5a, 0xff, 0xe1, 0xe6, 0x54, 0xff, 0xdd, 0xe5, 0x59, 0xff, 0xd1, 0xd7, 0x6b, 0xff, 0x7b, 0x81, 0x50, 0xff, 0x50, 0x56, 0x4f, 0xd5, 0x64, 0x6f, 0x7a, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6c, 0x76, 0x50, 0x52, 0x56, 0x4f, 0xf6, 0xa7, 0xaa, 0x63, 0xff, 0xdd, 0xe1, 0x66, 0xff, 0xe3, 0xe7, 0x59, 0xff, 0xe5, 0xe8, 0x5b, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe5, 0xea, 0x58, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe6, 0xe7, 0x59, 0xff, 0xe1, 0xeb, 0x56, 0xff, 0xde, 0xea, 0x54, 0xff, 0xe1, 0xe9, 0x57, 0xff, 0xe1, 0xe6, 0x5c, 0xff, 0xd2, 0xda, 0x74, 0xff, 0x75, 0x7d, 0x48, 0xff, 0x9e, 0xa0, 0x9c, 0xff, 0xf5, 0xf9, 0xfa, 0xff, 0xf1, 0xf8, 0xfd, 0xff, 0x84, 0x8a, 0x8c, 0xff, 0x83, 0x88, 0x57, 0xff, 0xd9, 0xda, 0x71, 0xff, 0xe8, 0xeb, 0x5d, 0xff, 0xdf, 0xe6, 0x58, 0xff, 0xde, 0xe7, 0x5f, 0xff, 0xdf, 0xe7, 0x58, 0xff, 0xdd, 0xe0, 0x54, 0xff, 0xd0, 0xd0, 0x6d, 0xff, 0x80, 0x81, 0x55, 0xff, 0xa1, 0xa5, 0xa3, 0xff, 0xf5, 0xfa, 0xfd, 0xff, 0xf3, 0xf6, 0xff, 0xff, 0xbe, 0xc0, 0xc9, 0xff, 0x54, 0x58, 0x42, 0xff, 0xbf, 0xc5, 0x71, 0xff, 0xde, 0xe6, 0x60, 0xff, 0xe3, 0xe7, 0x5d, 0xff, 0xe3, 0xe8, 0x59, 0xff, 0xe5, 0xe9, 0x56, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe5, 0xeb, 0x55, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe8, 0x58, 0xff, 0xe7, 0xe9, 0x57, 0xff, 0xe7, 0xe9, 0x55, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe2, 0xe8, 0x57, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x56, 0xff, 0xe7, 0xea, 0x56, 0xff, 0xe7, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x56, 0xff, 0xe5, 0xe9, 0x56, 0xff, 0xe4, 0xe7, 0x57, 0xff, 0xe4, 0xe7, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe3, 0xe7, 0x58, 0xff, 0xe2, 0xe6, 0x57, 0xff, 0xe0, 0xea, 0x57, 0xff, 0xd2, 0xda, 0x6e, 0xff, 0x72, 0x75, 0x3d, 0xff, 0x63, 0x6c, 0x33, 0xff, 0xcf, 0xdc, 0x6e, 0xff, 0xe1, 0xed, 0x5c, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe3, 0xea, 0x57, 0xff, 0xe1, 0xea, 0x57, 0xff, 0xe5, 0xe9, 0x59, 0xff, 0xe6, 0xea, 0x57, 0xff, 0xe3, 0xea, 0x56, 0xff, 0xe1, 0xe8, 0x58, 0xff, 0xe2, 0xe8, 0x59, 0xff, 0xe1, 0xe7, 0x55, 0xff, 0xdd, 0xe3, 0x5f, 0xff, 0xd0, 0xd3, 0x73, 0xff, 0x72, 0x75, 0x4c, 0xff, 0x54, 0x56, 0x54, 0xba, 0x8e, 0x8e, 0x8e, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6b, 0x72, 0x43, 0x50, 0x55, 0x52, 0xf4, 0xa1, 0xa5, 0x60, 0xff, 0xdf, 0xe0, 0x6a, 0xff, 0xe5, 0xe9, 0x5a, 0xff, 0xe2, 0xe9, 0x56, 0xff, 0xe3, 0xe8, 0x5b, 0xff, 0xe2, 0xe8, 0x5a, 0xff, 0xe3, 0xea, 0x56, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe7, 0xe6, 0x5b, 0xff, 0xe2, 0xea, 0x57, 0xff, 0xde, 0xeb, 0x55, 0xff, 0xe3, 0xea, 0x55, 0xff, 0xe3, 0xe7, 0x58, 0xff, 0xda, 0xe0, 0x73, 0xff, 0x8d, 0x93, 0x56, 0xff, 0x69, 0x6e, 0x64, 0xff, 0xe9, 0xf1, 0xf2, 0xff, 0xea, 0xf1, 0xf7, 0xff, 0x74, 0x78, 0x75, 0xff, 0x9a, 0x9b, 0x63, 0xff, 0xdb, 0xdd, 0x70, 0xff, 0xe6, 0xeb, 0x5c, 0xff, 0xe2, 0xeb, 0x59, 0xff, 0xe1, 0xea, 0x59, 0xff, 0xe3, 0xea, 0x54, 0xff, 0xe3, 0xe6, 0x59, 0xff, 0xd8, 0xde, 0x71, 0xff, 0x88, 0x8f, 0x58, 0xff, 0x95, 0x98, 0x99, 0xff, 0xf3, 0xfb, 0xfd, 0xff, 0xeb, 0xf6, 0xfc, 0xff, 0x91, 0x98, 0x9b, 0xff, 0x68, 0x6d, 0x3e, 0xff, 0xd5, 0xdb, 0x73, 0xff, 0xe3, 0xe7, 0x5c, 0xff, 0xe4, 0xe9, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe5, 0xea, 0x5a, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe7, 0xeb, 0x56, 0xff, 0xe7, 0xea, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe8, 0x58, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe1, 0xe9, 0x5c, 0xff, 0xd5, 0xdb, 0x6d, 0xff, 0x7d, 0x7f, 0x3b, 0xff, 0x70, 0x73, 0x30, 0xff, 0xd5, 0xdc, 0x6e, 0xff, 0xe0, 0xe8, 0x5f, 0xff, 0xe5, 0xe9, 0x54, 0xff, 0xe7, 0xea, 0x54, 0xff, 0xe7, 0xe9, 0x55, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe5, 0xea, 0x53, 0xff, 0xe4, 0xea, 0x54, 0xff, 0xe2, 0xe8, 0x56, 0xff, 0xe7, 0xe9, 0x57, 0xff, 0xe4, 0xe5, 0x57, 0xff, 0xdc, 0xdf, 0x6c, 0xff, 0xba, 0xbe, 0x6f, 0xff, 0x5d, 0x60, 0x50, 0xfc, 0x5a, 0x5c, 0x60, 0x88, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x6b, 0x77, 0x2b, 0x4d, 0x55, 0x50, 0xef, 0x9c, 0xa1, 0x5d, 0xff, 0xe0, 0xe0, 0x6c, 0xff, 0xe6, 0xe9, 0x5a, 0xff, 0xe2, 0xea, 0x55, 0xff, 0xe1, 0xe7, 0x5a, 0xff, 0xe2, 0xe8, 0x5a, 0xff, 0xe3, 0xea, 0x56, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe7, 0xe8, 0x5a, 0xff, 0xe2, 0xea, 0x57, 0xff, 0xe0, 0xea, 0x57, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe6, 0xe8, 0x57, 0xff, 0xdb, 0xdf, 0x6a, 0xff, 0xb4, 0xb9, 0x6f, 0xff, 0x52, 0x56, 0x46, 0xff, 0xbb, 0xc2, 0xc6, 0xff, 0xe3, 0xea, 0xf2, 0xff, 0x60, 0x65, 0x5e, 0xff, 0xa9, 0xac, 0x6c, 0xff, 0xdc, 0xe0, 0x6e, 0xff, 0xe3, 0xe9, 0x59, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe8, 0xeb, 0x55, 0xff, 0xe6, 0xe6, 0x5c, 0xff, 0xda, 0xdf, 0x6e, 0xff, 0x93, 0x9a, 0x5e, 0xff, 0x8b, 0x8f, 0x8f, 0xff, 0xed, 0xf7, 0xfb, 0xff, 0xe3, 0xec, 0xf0, 0xff, 0x57, 0x5c, 0x53, 0xff, 0x9e, 0xa1, 0x5e, 0xff, 0xde, 0xe1, 0x6c, 0xff, 0xe5, 0xe5, 0x5c, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x59, 0xff, 0xe4, 0xe9, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xea, 0x56, 0xff, 0xe0, 0xe7, 0x5b, 0xff, 0xd8, 0xdd, 0x67, 0xff, 0x92, 0x94, 0x41, 0xff, 0x8b, 0x8d, 0x3b, 0xff, 0xda, 0xde, 0x6b, 0xff, 0xe0, 0xe6, 0x5f, 0xff, 0xe4, 0xe8, 0x55, 0xff, 0xe7, 0xe8, 0x55, 0xff, 0xe5, 0xe7, 0x57, 0xff, 0xe2, 0xe7, 0x57, 0xff, 0xe3, 0xe8, 0x55, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe2, 0xe8, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe1, 0xe5, 0x60, 0xff, 0xd3, 0xd9, 0x79, 0xff, 0x86, 0x8d, 0x56, 0xff, 0x59, 0x5d, 0x58, 0xec, 0x75, 0x79, 0x7d, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7f, 0x88, 0x1e, 0x4a, 0x55, 0x4c, 0xe7, 0x8e, 0x94, 0x55, 0xff, 0xdd, 0xdf, 0x6e, 0xff, 0xe3, 0xe7, 0x5a, 0xff, 0xe1, 0xea, 0x55, 0xff, 0xe1, 0xe8, 0x58, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x55, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe3, 0xea, 0x58, 0xff, 0xe2, 0xe9, 0x59, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe0, 0xe3, 0x62, 0xff, 0xd4, 0xd7, 0x7b, 0xff, 0x70, 0x72, 0x4e, 0xff, 0x6e, 0x70, 0x73, 0xff, 0xc9, 0xcd, 0xd6, 0xff, 0x59, 0x60, 0x4f, 0xff, 0xb6, 0xbd, 0x71, 0xff, 0xdc, 0xe2, 0x68, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x57, 0xff, 0xe5, 0xe9, 0x56, 0xff, 0xe7, 0xe9, 0x56, 0xff, 0xe7, 0xe6, 0x5e, 0xff, 0xdc, 0xe1, 0x6e, 0xff, 0x9e, 0xa4, 0x63, 0xff, 0x81, 0x87, 0x84, 0xff, 0xed, 0xf4, 0xfa, 0xff, 0xb4, 0xb7, 0xbc, 0xff, 0x5c, 0x5b, 0x3e, 0xff, 0xcc, 0xcb, 0x72, 0xff, 0xe2, 0xe2, 0x61, 0xff, 0xe8, 0xe6, 0x5c, 0xff, 0xe5, 0xe9, 0x56, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe2, 0xe7, 0x59, 0xff, 0xdb, 0xe1, 0x5d, 0xff, 0xbc, 0xc0, 0x51, 0xff, 0xc3, 0xc9, 0x5a, 0xff, 0xdc, 0xe3, 0x62, 0xff, 0xe2, 0xe8, 0x5d, 0xff, 0xe4, 0xe7, 0x57, 0xff, 0xe5, 0xe8, 0x58, 0xff, 0xe3, 0xe7, 0x58, 0xff, 0xe0, 0xe8, 0x57, 0xff, 0xe2, 0xe7, 0x57, 0xff, 0xe3, 0xe7, 0x59, 0xff, 0xe1, 0xe9, 0x5c, 0xff, 0xdf, 0xe9, 0x60, 0xff, 0xd5, 0xe0, 0x6d, 0xff, 0xa9, 0xb2, 0x6b, 0xff, 0x5a, 0x61, 0x4d, 0xfd, 0x58, 0x5b, 0x5b, 0xb0, 0xc6, 0xc6, 0xc6, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x9d, 0x9d, 0x1a, 0x45, 0x52, 0x49, 0xe0, 0x7b, 0x81, 0x4a, 0xff, 0xdb, 0xdc, 0x73, 0xff, 0xe3, 0xe7, 0x5e, 0xff, 0xe2, 0xea, 0x56, 0xff, 0xe2, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe4, 0xeb, 0x54, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe3, 0xea, 0x57, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe7, 0xe6, 0x5b, 0xff, 0xe7, 0xe9, 0x56, 0xff, 0xe3, 0xe8, 0x5a, 0xff, 0xde, 0xe1, 0x6f, 0xff, 0xbd, 0xc0, 0x77, 0xff, 0x62, 0x65, 0x43, 0xff, 0x62, 0x67, 0x5a, 0xff, 0x6d, 0x75, 0x49, 0xff, 0xc9, 0xd1, 0x74, 0xff, 0xde, 0xe4, 0x64, 0xff, 0xe5, 0xe9, 0x59, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe1, 0xe9, 0x56, 0xff, 0xe2, 0xe9, 0x57, 0xff, 0xe3, 0xe5, 0x5e, 0xff, 0xdc, 0xe2, 0x6a, 0xff, 0xae, 0xb6, 0x69, 0xff, 0x69, 0x70, 0x64, 0xff, 0xcd, 0xd2, 0xd5, 0xff, 0x66, 0x65, 0x61, 0xff, 0x92, 0x90, 0x56, 0xff, 0xdc, 0xdd, 0x6e, 0xff, 0xe4, 0xe6, 0x59, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe8, 0x58, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe1, 0xe6, 0x57, 0xff, 0xdf, 0xe4, 0x5c, 0xff, 0xe0, 0xe5, 0x5f, 0xff, 0xe0, 0xe5, 0x5a, 0xff, 0xe5, 0xe7, 0x5a, 0xff, 0xe6, 0xe8, 0x58, 0xff, 0xe4, 0xe7, 0x56, 0xff, 0xe1, 0xe7, 0x55, 0xff, 0xde, 0xe7, 0x53, 0xff, 0xdf, 0xe7, 0x54, 0xff, 0xdf, 0xe3, 0x59, 0xff, 0xda, 0xdf, 0x64, 0xff, 0xcd, 0xd5, 0x6c, 0xff, 0xac, 0xb5, 0x68, 0xff, 0x64, 0x6c, 0x4a, 0xff, 0x55, 0x5a, 0x5b, 0xdd, 0x7b, 0x7b, 0x7f, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xaa, 0xaa, 0x0f, 0x44, 0x51, 0x4b, 0xcd, 0x68, 0x6d, 0x40, 0xff, 0xd5, 0xd5, 0x75, 0xff, 0xe2, 0xe6, 0x60, 0xff, 0xe1, 0xe8, 0x57, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe5, 0xeb, 0x54, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe3, 0xe8, 0x5a, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe7, 0xe6, 0x5c, 0xff, 0xe7, 0xe9, 0x56, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe2, 0xe6, 0x62, 0xff, 0xdb, 0xe2, 0x73, 0xff, 0xbd, 0xc4, 0x70, 0xff, 0x89, 0x90, 0x4c, 0xff, 0xb1, 0xb9, 0x64, 0xff, 0xda, 0xe2, 0x70, 0xff, 0xe1, 0xe7, 0x60, 0xff, 0xe2, 0xe8, 0x58, 0xff, 0xe1, 0xea, 0x56, 0xff, 0xdd, 0xea, 0x54, 0xff, 0xde, 0xe9, 0x55, 0xff, 0xe1, 0xe6, 0x5c, 0xff, 0xda, 0xe3, 0x60, 0xff, 0xc3, 0xcf, 0x6e, 0xff, 0x60, 0x68, 0x3d, 0xff, 0x68, 0x6d, 0x5a, 0xff, 0x6c, 0x6b, 0x46, 0xff, 0xcc, 0xce, 0x77, 0xff, 0xe2, 0xe6, 0x64, 0xff, 0xe5, 0xea, 0x56, 0xff, 0xe4, 0xea, 0x54, 0xff, 0xe6, 0xea, 0x55, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe4, 0xe7, 0x57, 0xff, 0xe3, 0xe7, 0x54, 0xff, 0xe4, 0xe8, 0x56, 0xff, 0xe3, 0xe6, 0x56, 0xff, 0xe4, 0xe6, 0x59, 0xff, 0xe5, 0xe5, 0x5b, 0xff, 0xe5, 0xe5, 0x5c, 0xff, 0xe0, 0xe2, 0x58, 0xff, 0xda, 0xe0, 0x55, 0xff, 0xd2, 0xdb, 0x52, 0xff, 0xcc, 0xd6, 0x52, 0xff, 0xc5, 0xca, 0x57, 0xff, 0xbd, 0xbd, 0x66, 0xff, 0x9b, 0x9d, 0x61, 0xff, 0x63, 0x68, 0x49, 0xff, 0x57, 0x5d, 0x54, 0xea, 0x62, 0x64, 0x6a, 0x5e, 0x7f, 0x7f, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0x4c, 0x56, 0x54, 0x9d, 0x56, 0x5c, 0x3a, 0xfe, 0xc8, 0xc8, 0x6f, 0xff, 0xde, 0xe2, 0x62, 0xff, 0xdf, 0xe6, 0x57, 0xff, 0xe3, 0xe7, 0x58, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe5, 0xe8, 0x5b, 0xff, 0xe3, 0xe8, 0x5b, 0xff, 0xe5, 0xeb, 0x57, 0xff, 0xe8, 0xe9, 0x59, 0xff, 0xe7, 0xe7, 0x5c, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe4, 0xe8, 0x5d, 0xff, 0xe0, 0xe7, 0x5f, 0xff, 0xdd, 0xe5, 0x6b, 0xff, 0xdc, 0xe5, 0x73, 0xff, 0xdd, 0xe4, 0x6c, 0xff, 0xdf, 0xe5, 0x5f, 0xff, 0xe0, 0xe8, 0x57, 0xff, 0xe1, 0xe9, 0x54, 0xff, 0xe0, 0xe9, 0x56, 0xff, 0xdc, 0xea, 0x54, 0xff, 0xdf, 0xe9, 0x54, 0xff, 0xe4, 0xe6, 0x58, 0xff, 0xe1, 0xe8, 0x5a, 0xff, 0xd6, 0xe0, 0x6c, 0xff, 0xb1, 0xb6, 0x62, 0xff, 0x9e, 0xa1, 0x57, 0xff, 0xc7, 0xcb, 0x74, 0xff, 0xe1, 0xe7, 0x6f, 0xff, 0xe6, 0xeb, 0x5d, 0xff, 0xe7, 0xeb, 0x59, 0xff, 0xe3, 0xeb, 0x55, 0xff, 0xe6, 0xea, 0x55, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe5, 0xe7, 0x5a, 0xff, 0xe5, 0xe7, 0x58, 0xff, 0xe4, 0xe7, 0x56, 0xff, 0xe4, 0xe6, 0x57, 0xff, 0xe3, 0xe4, 0x57, 0xff, 0xdf, 0xe2, 0x59, 0xff, 0xdb, 0xdc, 0x5b, 0xff, 0xd4, 0xd5, 0x5a, 0xff, 0xc8, 0xcb, 0x53, 0xff, 0xbe, 0xc2, 0x52, 0xff, 0xb6, 0xb8, 0x56, 0xff, 0xab, 0xb2, 0x5d, 0xff, 0x9d, 0xa2, 0x5f, 0xff, 0x79, 0x78, 0x4c, 0xff, 0x4f, 0x4f, 0x41, 0xfe, 0x4f, 0x54, 0x53, 0xe6, 0x5d, 0x62, 0x6a, 0x65, 0xbf, 0xbf, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x54, 0x5b, 0x5f, 0x79, 0x50, 0x53, 0x3c, 0xfb, 0xb1, 0xb0, 0x5e, 0xff, 0xde, 0xe1, 0x65, 0xff, 0xe1, 0xe7, 0x5a, 0xff, 0xe5, 0xe7, 0x58, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe6, 0xe9, 0x56, 0xff, 0xe5, 0xe7, 0x5c, 0xff, 0xe4, 0xe8, 0x5c, 0xff, 0xe7, 0xeb, 0x57, 0xff, 0xe8, 0xea, 0x57, 0xff, 0xe6, 0xe9, 0x5b, 0xff, 0xe3, 0xeb, 0x58, 0xff, 0xe3, 0xea, 0x56, 0xff, 0xe5, 0xe7, 0x5b, 0xff, 0xe4, 0xe8, 0x5b, 0xff, 0xe1, 0xe9, 0x59, 0xff, 0xe1, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe4, 0xe7, 0x55, 0xff, 0xe1, 0xe9, 0x51, 0xff, 0xe1, 0xe9, 0x51, 0xff, 0xe1, 0xe7, 0x56, 0xff, 0xdf, 0xe9, 0x54, 0xff, 0xe2, 0xe8, 0x53, 0xff, 0xe7, 0xe6, 0x56, 0xff, 0xe5, 0xe7, 0x53, 0xff, 0xdf, 0xe3, 0x60, 0xff, 0xdc, 0xdf, 0x69, 0xff, 0xdd, 0xdf, 0x6c, 0xff, 0xde, 0xe4, 0x67, 0xff, 0xe1, 0xea, 0x58, 0xff, 0xe6, 0xe8, 0x56, 0xff, 0xe6, 0xe6, 0x59, 0xff, 0xe5, 0xe9, 0x56, 0xff, 0xe7, 0xea, 0x56, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe8, 0xe8, 0x58, 0xff, 0xe8, 0xe8, 0x59, 0xff, 0xe8, 0xe8, 0x58, 0xff, 0xe8, 0xe8, 0x58, 0xff, 0xe7, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x5a, 0xff, 0xe3, 0xe6, 0x5a, 0xff, 0xe3, 0xe7, 0x58, 0xff, 0xe5, 0xe7, 0x58, 0xff, 0xe5, 0xe5, 0x5a, 0xff, 0xe5, 0xe6, 0x5e, 0xff, 0xd6, 0xdb, 0x57, 0xff, 0xc9, 0xcc, 0x58, 0xff, 0xc4, 0xc7, 0x5f, 0xff, 0xbb, 0xbf, 0x62, 0xff, 0xad, 0xb0, 0x64, 0xff, 0x96, 0x96, 0x5b, 0xff, 0x72, 0x76, 0x50, 0xff, 0x52, 0x57, 0x43, 0xff, 0x4b, 0x4c, 0x46, 0xf5, 0x49, 0x4c, 0x51, 0xbf, 0x5d, 0x64, 0x6e, 0x4a, 0xbf, 0xbf, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x68, 0x70, 0x42, 0x4b, 0x4f, 0x43, 0xf3, 0x8d, 0x8d, 0x4f, 0xff, 0xd4, 0xd5, 0x6a, 0xff, 0xe0, 0xe4, 0x5c, 0xff, 0xe6, 0xe7, 0x59, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe7, 0xea, 0x56, 0xff, 0xe8, 0xe8, 0x59, 0xff, 0xe8, 0xe8, 0x5c, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xeb, 0x57, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe6, 0xe7, 0x5a, 0xff, 0xe8, 0xe6, 0x5a, 0xff, 0xe6, 0xe7, 0x58, 0xff, 0xe6, 0xe9, 0x55, 0xff, 0xe6, 0xe9, 0x53, 0xff, 0xe4, 0xe7, 0x55, 0xff, 0xe2, 0xe5, 0x55, 0xff, 0xe1, 0xe7, 0x51, 0xff, 0xe0, 0xe8, 0x50, 0xff, 0xe2, 0xe7, 0x55, 0xff, 0xe1, 0xe7, 0x52, 0xff, 0xe2, 0xe8, 0x52, 0xff, 0xe4, 0xe7, 0x55, 0xff, 0xe6, 0xe6, 0x56, 0xff, 0xe6, 0xe6, 0x57, 0xff, 0xe7, 0xe7, 0x5b, 0xff, 0xe4, 0xe7, 0x59, 0xff, 0xe2, 0xe9, 0x56, 0xff, 0xe2, 0xeb, 0x57, 0xff, 0xe3, 0xe9, 0x59, 0xff, 0xe5, 0xe9, 0x5a, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xe9, 0x58, 0xff, 0xe7, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe5, 0xe7, 0x5a, 0xff, 0xe5, 0xe7, 0x58, 0xff, 0xe5, 0xe9, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe6, 0xe8, 0x5b, 0xff, 0xe1, 0xe3, 0x5a, 0xff, 0xcc, 0xcd, 0x56, 0xff, 0xb4, 0xb6, 0x65, 0xff, 0x8a, 0x90, 0x56, 0xff, 0x62, 0x69, 0x40, 0xff, 0x54, 0x58, 0x46, 0xff, 0x4f, 0x51, 0x4e, 0xfd, 0x49, 0x4f, 0x51, 0xf2, 0x47, 0x4e, 0x53, 0xbe, 0x61, 0x69, 0x6f, 0x5c, 0xaa, 0xaa, 0xbb, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x93, 0x93, 0x21, 0x4c, 0x50, 0x4b, 0xdb, 0x69, 0x6b, 0x40, 0xff, 0xbf, 0xc2, 0x69, 0xff, 0xda, 0xdf, 0x62, 0xff, 0xe2, 0xe6, 0x5c, 0xff, 0xe3, 0xe8, 0x5a, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe6, 0xe9, 0x5a, 0xff, 0xe8, 0xe8, 0x5a, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xea, 0x58, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe5, 0xe8, 0x58, 0xff, 0xe6, 0xe7, 0x58, 0xff, 0xe6, 0xe7, 0x57, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe4, 0xea, 0x53, 0xff, 0xe3, 0xe9, 0x50, 0xff, 0xe3, 0xe8, 0x54, 0xff, 0xe2, 0xe6, 0x55, 0xff, 0xe2, 0xe6, 0x52, 0xff, 0xe3, 0xe8, 0x52, 0xff, 0xe3, 0xe7, 0x52, 0xff, 0xe2, 0xe8, 0x50, 0xff, 0xe1, 0xe9, 0x51, 0xff, 0xe2, 0xe8, 0x54, 0xff, 0xe2, 0xe7, 0x54, 0xff, 0xe5, 0xea, 0x53, 0xff, 0xe6, 0xe9, 0x53, 0xff, 0xe5, 0xe9, 0x53, 0xff, 0xe3, 0xe9, 0x52, 0xff, 0xe1, 0xe8, 0x55, 0xff, 0xe3, 0xe8, 0x5a, 0xff, 0xe4, 0xe9, 0x5a, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xe9, 0x58, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe7, 0x57, 0xff, 0xe5, 0xe7, 0x58, 0xff, 0xe6, 0xe7, 0x56, 0xff, 0xe6, 0xe8, 0x54, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe3, 0xe6, 0x5b, 0xff, 0xd6, 0xd8, 0x5b, 0xff, 0xbd, 0xbe, 0x65, 0xff, 0x8e, 0x8d, 0x5d, 0xff, 0x4f, 0x53, 0x41, 0xfd, 0x48, 0x4f, 0x49, 0xeb, 0x48, 0x4b, 0x54, 0xc3, 0x4d, 0x52, 0x5f, 0x8f, 0x60, 0x64, 0x6e, 0x4a, 0x99, 0x99, 0xaa, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xd4, 0xd4, 0x06, 0x4f, 0x55, 0x56, 0xb4, 0x54, 0x55, 0x41, 0xff, 0xa1, 0xa4, 0x60, 0xff, 0xcc, 0xd3, 0x64, 0xff, 0xdf, 0xe5, 0x62, 0xff, 0xe0, 0xe8, 0x5b, 0xff, 0xe3, 0xec, 0x58, 0xff, 0xe4, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x55, 0xff, 0xe4, 0xe8, 0x54, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe3, 0xe9, 0x55, 0xff, 0xde, 0xe6, 0x52, 0xff, 0xdd, 0xe5, 0x57, 0xff, 0xdd, 0xe5, 0x5e, 0xff, 0xda, 0xe2, 0x5e, 0xff, 0xdd, 0xe3, 0x5f, 0xff, 0xdf, 0xe4, 0x5e, 0xff, 0xda, 0xe2, 0x58, 0xff, 0xdc, 0xe6, 0x5a, 0xff, 0xdd, 0xe7, 0x5a, 0xff, 0xe0, 0xe8, 0x57, 0xff, 0xe4, 0xec, 0x55, 0xff, 0xe5, 0xeb, 0x52, 0xff, 0xe5, 0xeb, 0x50, 0xff, 0xe5, 0xea, 0x51, 0xff, 0xe4, 0xe9, 0x56, 0xff, 0xe4, 0xe8, 0x5a, 0xff, 0xe4, 0xe8, 0x5a, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xe9, 0x58, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe6, 0xe7, 0x57, 0xff, 0xe6, 0xe8, 0x54, 0xff, 0xe8, 0xea, 0x56, 0xff, 0xe5, 0xe7, 0x59, 0xff, 0xdf, 0xe2, 0x5e, 0xff, 0xc5, 0xc9, 0x59, 0xff, 0xb1, 0xb6, 0x71, 0xff, 0x64, 0x65, 0x4d, 0xff, 0x4e, 0x51, 0x53, 0xd8, 0x70, 0x74, 0x78, 0x42, 0x88, 0x99, 0xaa, 0x0f, 0x7f, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5e, 0x65, 0x6f, 0x4f, 0x50, 0x4d, 0xfa, 0x81, 0x82, 0x51, 0xff, 0xbb, 0xc0, 0x61, 0xff, 0xda, 0xde, 0x63, 0xff, 0xe3, 0xe8, 0x5e, 0xff, 0xe3, 0xea, 0x56, 0xff, 0xe7, 0xeb, 0x58, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe6, 0xe8, 0x58, 0xff, 0xe6, 0xe7, 0x5b, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe3, 0xe9, 0x54, 0xff, 0xe1, 0xe7, 0x55, 0xff, 0xe7, 0xe6, 0x5a, 0xff, 0xe0, 0xe4, 0x5d, 0xff, 0xd9, 0xe1, 0x61, 0xff, 0xd9, 0xe5, 0x6f, 0xff, 0xdc, 0xea, 0x81, 0xff, 0xe0, 0xef, 0x8f, 0xff, 0xe5, 0xf2, 0x96, 0xff, 0xe5, 0xf1, 0x93, 0xff, 0xe0, 0xed, 0x88, 0xff, 0xda, 0xe7, 0x7c, 0xff, 0xd8, 0xe2, 0x71, 0xff, 0xdc, 0xe3, 0x65, 0xff, 0xe0, 0xe6, 0x5e, 0xff, 0xe0, 0xe8, 0x56, 0xff, 0xe2, 0xe9, 0x52, 0xff, 0xe2, 0xe9, 0x52, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe3, 0xe8, 0x58, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xe9, 0x58, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe8, 0xe8, 0x57, 0xff, 0xe7, 0xe8, 0x55, 0xff, 0xe7, 0xe9, 0x57, 0xff, 0xe2, 0xe4, 0x5d, 0xff, 0xd0, 0xd3, 0x5c, 0xff, 0xb9, 0xbc, 0x5e, 0xff, 0x94, 0x9a, 0x63, 0xff, 0x59, 0x5c, 0x50, 0xf9, 0x69, 0x6e, 0x73, 0x66, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x7f, 0x8c, 0x2a, 0x47, 0x49, 0x4f, 0xe5, 0x66, 0x68, 0x47, 0xff, 0xab, 0xae, 0x5e, 0xff, 0xcd, 0xcd, 0x60, 0xff, 0xe1, 0xe3, 0x61, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe8, 0xea, 0x57, 0xff, 0xe7, 0xeb, 0x56, 0xff, 0xe7, 0xe9, 0x5a, 0xff, 0xe7, 0xe7, 0x5c, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe3, 0xea, 0x54, 0xff, 0xe1, 0xe8, 0x57, 0xff, 0xdf, 0xe4, 0x5c, 0xff, 0xde, 0xe1, 0x65, 0xff, 0xd8, 0xde, 0x71, 0xff, 0xe6, 0xf0, 0x94, 0xff, 0xeb, 0xfb, 0xa9, 0xff, 0xe8, 0xfd, 0xb3, 0xff, 0xe6, 0xfc, 0xba, 0xff, 0xe6, 0xfb, 0xbf, 0xff, 0xe8, 0xfb, 0xbf, 0xff, 0xe9, 0xfe, 0xbc, 0xff, 0xeb, 0xfe, 0xb6, 0xff, 0xeb, 0xf8, 0xa9, 0xff, 0xe0, 0xea, 0x8d, 0xff, 0xd8, 0xdf, 0x72, 0xff, 0xdb, 0xe3, 0x64, 0xff, 0xdc, 0xe5, 0x5a, 0xff, 0xe0, 0xe9, 0x56, 0xff, 0xe2, 0xea, 0x55, 0xff, 0xe4, 0xe8, 0x56, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xe9, 0x58, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe6, 0xe8, 0x56, 0xff, 0xe7, 0xe8, 0x56, 0xff, 0xe5, 0xe7, 0x5a, 0xff, 0xd7, 0xda, 0x5d, 0xff, 0xbf, 0xc2, 0x5c, 0xff, 0xb1, 0xb2, 0x6a, 0xff, 0x79, 0x7b, 0x5d, 0xff, 0x58, 0x58, 0x5b, 0xdd, 0x91, 0x91, 0x98, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0x05, 0x51, 0x52, 0x61, 0xa1, 0x4c, 0x52, 0x42, 0xfe, 0x94, 0x97, 0x56, 0xff, 0xc2, 0xc1, 0x65, 0xff, 0xd2, 0xd1, 0x5f, 0xff, 0xe0, 0xe4, 0x5c, 0xff, 0xe5, 0xe9, 0x5a, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe7, 0xe8, 0x5b, 0xff, 0xe6, 0xe7, 0x5b, 0xff, 0xe5, 0xe9, 0x56, 0xff, 0xe1, 0xe8, 0x52, 0xff, 0xe0, 0xe7, 0x5b, 0xff, 0xd8, 0xde, 0x62, 0xff, 0xd5, 0xe4, 0x7e, 0xff, 0xea, 0xf9, 0xa8, 0xff, 0xe9, 0xfa, 0xbb, 0xff, 0xe2, 0xf9, 0xc1, 0xff, 0xdf, 0xf9, 0xc4, 0xff, 0xdf, 0xf9, 0xc6, 0xff, 0xdf, 0xf7, 0xca, 0xff, 0xdf, 0xf8, 0xcd, 0xff, 0xde, 0xf9, 0xcb, 0xff, 0xde, 0xf9, 0xc7, 0xff, 0xe3, 0xfa, 0xc3, 0xff, 0xeb, 0xfd, 0xbb, 0xff, 0xe7, 0xf6, 0xa7, 0xff, 0xdd, 0xe8, 0x81, 0xff, 0xd9, 0xe3, 0x67, 0xff, 0xdb, 0xe6, 0x5a, 0xff, 0xe1, 0xea, 0x55, 0xff, 0xe3, 0xe9, 0x53, 0xff, 0xe6, 0xea, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xe9, 0x58, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe4, 0xe7, 0x56, 0xff, 0xe3, 0xe7, 0x57, 0xff, 0xe4, 0xe7, 0x56, 0xff, 0xe3, 0xe6, 0x56, 0xff, 0xde, 0xe1, 0x5a, 0xff, 0xc5, 0xc9, 0x56, 0xff, 0xb3, 0xb4, 0x5e, 0xff, 0xa0, 0xa3, 0x6b, 0xff, 0x60, 0x62, 0x56, 0xfd, 0x61, 0x61, 0x6d, 0x93, 0xcc, 0xcc, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x75, 0x86, 0x4c, 0x48, 0x52, 0x49, 0xf4, 0x7a, 0x7f, 0x4d, 0xff, 0xb2, 0xb4, 0x66, 0xff, 0xc4, 0xc5, 0x5e, 0xff, 0xd4, 0xd8, 0x5a, 0xff, 0xe1, 0xe6, 0x5d, 0xff, 0xe4, 0xe9, 0x59, 0xff, 0xe4, 0xe7, 0x59, 0xff, 0xe5, 0xe6, 0x58, 0xff, 0xe7, 0xe9, 0x54, 0xff, 0xe4, 0xe9, 0x54, 0xff, 0xda, 0xe1, 0x5e, 0xff, 0xdb, 0xe5, 0x7c, 0xff, 0xe5, 0xfb, 0xab, 0xff, 0xe4, 0xfb, 0xbb, 0xff, 0xe0, 0xf7, 0xc6, 0xff, 0xdc, 0xf6, 0xca, 0xff, 0xdb, 0xf8, 0xc8, 0xff, 0xdd, 0xf9, 0xc8, 0xff, 0xdd, 0xf8, 0xca, 0xff, 0xdd, 0xf8, 0xcd, 0xff, 0xdb, 0xf7, 0xcc, 0xff, 0xda, 0xf8, 0xcc, 0xff, 0xdb, 0xf8, 0xcb, 0xff, 0xdf, 0xfa, 0xc6, 0xff, 0xe3, 0xfd, 0xbf, 0xff, 0xee, 0xfd, 0xad, 0xff, 0xe1, 0xed, 0x8a, 0xff, 0xd8, 0xe5, 0x67, 0xff, 0xde, 0xea, 0x59, 0xff, 0xe1, 0xea, 0x4f, 0xff, 0xe6, 0xea, 0x54, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xe9, 0x58, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe8, 0x58, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x55, 0xff, 0xe6, 0xe9, 0x56, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe3, 0xe8, 0x5a, 0xff, 0xe2, 0xe6, 0x56, 0xff, 0xe0, 0xe2, 0x56, 0xff, 0xcd, 0xd0, 0x51, 0xff, 0xb7, 0xba, 0x52, 0xff, 0xae, 0xb0, 0x69, 0xff, 0x7f, 0x80, 0x58, 0xff, 0x57, 0x5a, 0x57, 0xeb, 0x79, 0x7d, 0x82, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xae, 0xae, 0x13, 0x52, 0x59, 0x5b, 0xc6, 0x59, 0x5f, 0x45, 0xff, 0x9e, 0xa4, 0x66, 0xff, 0xb2, 0xb6, 0x59, 0xff, 0xc6, 0xc8, 0x54, 0xff, 0xd9, 0xdb, 0x59, 0xff, 0xe0, 0xe6, 0x58, 0xff, 0xdf, 0xe5, 0x55, 0xff, 0xe4, 0xe7, 0x55, 0xff, 0xe7, 0xe7, 0x52, 0xff, 0xe3, 0xe4, 0x5b, 0xff, 0xd6, 0xdf, 0x71, 0xff, 0xe8, 0xf9, 0xa8, 0xff, 0xe3, 0xfa, 0xc1, 0xff, 0xe1, 0xfa, 0xc5, 0xff, 0xde, 0xf8, 0xc7, 0xff, 0xdd, 0xf8, 0xc9, 0xff, 0xdc, 0xf9, 0xc9, 0xff, 0xdd, 0xf9, 0xc9, 0xff, 0xdd, 0xf9, 0xca, 0xff, 0xdd, 0xf9, 0xcb, 0xff, 0xdd, 0xf8, 0xcb, 0xff, 0xdc, 0xf9, 0xc8, 0xff, 0xdc, 0xf9, 0xc8, 0xff, 0xdc, 0xf9, 0xc7, 0xff, 0xdc, 0xf9, 0xc6, 0xff, 0xe1, 0xfa, 0xbf, 0xff, 0xe9, 0xfb, 0xb5, 0xff, 0xde, 0xeb, 0x90, 0xff, 0xd6, 0xe3, 0x62, 0xff, 0xde, 0xea, 0x50, 0xff, 0xe5, 0xec, 0x50, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe7, 0xe7, 0x57, 0xff, 0xe8, 0xe9, 0x54, 0xff, 0xe7, 0xe9, 0x52, 0xff, 0xe5, 0xe9, 0x52, 0xff, 0xe3, 0xe8, 0x56, 0xff, 0xe1, 0xe6, 0x5a, 0xff, 0xde, 0xe1, 0x55, 0xff, 0xd0, 0xcf, 0x50, 0xff, 0xba, 0xb9, 0x4c, 0xff, 0xae, 0xb0, 0x5a, 0xff, 0x9a, 0x9c, 0x69, 0xff, 0x5c, 0x5d, 0x52, 0xfe, 0x5f, 0x61, 0x67, 0xa3, 0xdb, 0xdb, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x62, 0x69, 0x6d, 0x70, 0x51, 0x56, 0x4d, 0xf9, 0x7f, 0x82, 0x57, 0xff, 0xa6, 0xab, 0x5b, 0xff, 0xb8, 0xba, 0x4d, 0xff, 0xcc, 0xcc, 0x52, 0xff, 0xd8, 0xdb, 0x55, 0xff, 0xe0, 0xe5, 0x58, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe2, 0xe4, 0x55, 0xff, 0xdc, 0xe1, 0x63, 0xff, 0xe4, 0xf0, 0x93, 0xff, 0xea, 0xfc, 0xb9, 0xff, 0xe0, 0xf8, 0xc7, 0xff, 0xe0, 0xf9, 0xca, 0xff, 0xdd, 0xf7, 0xca, 0xff, 0xdc, 0xf7, 0xca, 0xff, 0xdc, 0xf7, 0xca, 0xff, 0xdd, 0xf7, 0xcb, 0xff, 0xde, 0xf7, 0xca, 0xff, 0xdf, 0xf7, 0xca, 0xff, 0xdf, 0xf8, 0xca, 0xff, 0xdd, 0xf7, 0xc7, 0xff, 0xdd, 0xf9, 0xc8, 0xff, 0xdc, 0xf9, 0xc8, 0xff, 0xdb, 0xf8, 0xc6, 0xff, 0xdd, 0xf8, 0xc3, 0xff, 0xe4, 0xf9, 0xbf, 0xff, 0xed, 0xfc, 0xb1, 0xff, 0xd9, 0xe6, 0x7b, 0xff, 0xdc, 0xe6, 0x5d, 0xff, 0xe4, 0xeb, 0x57, 0xff, 0xe8, 0xe8, 0x58, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xea, 0x58, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe8, 0xe7, 0x58, 0xff, 0xe7, 0xe8, 0x55, 0xff, 0xe7, 0xe9, 0x54, 0xff, 0xe5, 0xe8, 0x55, 0xff, 0xe3, 0xe5, 0x56, 0xff, 0xe0, 0xe2, 0x5a, 0xff, 0xd1, 0xd1, 0x52, 0xff, 0xbf, 0xbe, 0x4a, 0xff, 0xb2, 0xb2, 0x52, 0xff, 0xa4, 0xa6, 0x67, 0xff, 0x6a, 0x6c, 0x4f, 0xff, 0x55, 0x56, 0x54, 0xe9, 0x88, 0x8c, 0x90, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xa7, 0xb1, 0x1a, 0x4f, 0x52, 0x59, 0xd4, 0x58, 0x5c, 0x47, 0xff, 0x98, 0x9e, 0x5e, 0xff, 0xac, 0xaf, 0x4e, 0xff, 0xbc, 0xbc, 0x4c, 0xff, 0xca, 0xca, 0x4e, 0xff, 0xd9, 0xdc, 0x55, 0xff, 0xe0, 0xe4, 0x57, 0xff, 0xdd, 0xe3, 0x5d, 0xff, 0xdc, 0xe6, 0x7b, 0xff, 0xec, 0xfc, 0xb1, 0xff, 0xe4, 0xfa, 0xc5, 0xff, 0xdd, 0xf8, 0xcc, 0xff, 0xdb, 0xf7, 0xcc, 0xff, 0xdb, 0xf7, 0xcb, 0xff, 0xda, 0xf7, 0xca, 0xff, 0xdb, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xe0, 0xf7, 0xc9, 0xff, 0xe1, 0xf7, 0xc8, 0xff, 0xe1, 0xf7, 0xc8, 0xff, 0xde, 0xf7, 0xc7, 0xff, 0xdd, 0xf7, 0xc7, 0xff, 0xdc, 0xf8, 0xc7, 0xff, 0xdb, 0xf8, 0xc7, 0xff, 0xdb, 0xf8, 0xc7, 0xff, 0xdf, 0xf8, 0xc6, 0xff, 0xe6, 0xfa, 0xbd, 0xff, 0xe7, 0xf6, 0xa1, 0xff, 0xd5, 0xe1, 0x6b, 0xff, 0xe2, 0xe8, 0x5d, 0xff, 0xe8, 0xea, 0x56, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xea, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xe9, 0x57, 0xff, 0xe7, 0xe7, 0x57, 0xff, 0xe6, 0xe6, 0x57, 0xff, 0xe5, 0xe8, 0x55, 0xff, 0xe6, 0xe9, 0x54, 0xff, 0xe6, 0xe8, 0x58, 0xff, 0xe3, 0xe4, 0x59, 0xff, 0xd6, 0xd6, 0x54, 0xff, 0xc1, 0xbe, 0x4d, 0xff, 0xb5, 0xb4, 0x4f, 0xff, 0xa9, 0xad, 0x5e, 0xff, 0x86, 0x88, 0x60, 0xff, 0x4b, 0x4d, 0x4a, 0xfb, 0x5d, 0x60, 0x65, 0x97, 0xbf, 0xbf, 0xbf, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x69, 0x6f, 0x7a, 0x75, 0x49, 0x4e, 0x4b, 0xfa, 0x73, 0x79, 0x4c, 0xff, 0xa2, 0xa6, 0x57, 0xff, 0xb3, 0xb2, 0x4f, 0xff, 0xbe, 0xbd, 0x4e, 0xff, 0xcb, 0xcd, 0x50, 0xff, 0xd7, 0xdb, 0x56, 0xff, 0xd8, 0xdf, 0x68, 0xff, 0xe1, 0xee, 0x96, 0xff, 0xe9, 0xfc, 0xbf, 0xff, 0xe1, 0xf8, 0xcb, 0xff, 0xdc, 0xf9, 0xcc, 0xff, 0xdc, 0xf9, 0xcb, 0xff, 0xdb, 0xf9, 0xc9, 0xff, 0xda, 0xf8, 0xc8, 0xff, 0xdb, 0xf8, 0xc6, 0xff, 0xdd, 0xf8, 0xc6, 0xff, 0xdf, 0xf7, 0xc6, 0xff, 0xe0, 0xf7, 0xc7, 0xff, 0xe1, 0xf7, 0xc7, 0xff, 0xdf, 0xf7, 0xc7, 0xff, 0xdd, 0xf7, 0xc7, 0xff, 0xdc, 0xf7, 0xc7, 0xff, 0xdb, 0xf8, 0xc7, 0xff, 0xda, 0xf8, 0xc7, 0xff, 0xda, 0xf8, 0xc7, 0xff, 0xdf, 0xf9, 0xc4, 0xff, 0xe9, 0xfd, 0xb6, 0xff, 0xd8, 0xe7, 0x84, 0xff, 0xdc, 0xe4, 0x61, 0xff, 0xe6, 0xeb, 0x55, 0xff, 0xe5, 0xea, 0x56, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe6, 0xe8, 0x55, 0xff, 0xe6, 0xe8, 0x56, 0xff, 0xe4, 0xe8, 0x56, 0xff, 0xe3, 0xe8, 0x54, 0xff, 0xe2, 0xe8, 0x55, 0xff, 0xe2, 0xe6, 0x59, 0xff, 0xd8, 0xd9, 0x54, 0xff, 0xc4, 0xc4, 0x49, 0xff, 0xb7, 0xb6, 0x4f, 0xff, 0xab, 0xae, 0x5a, 0xff, 0x98, 0x9e, 0x64, 0xff, 0x52, 0x56, 0x44, 0xff, 0x4a, 0x51, 0x57, 0xd1, 0x86, 0x86, 0x93, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xb1, 0xbc, 0x17, 0x41, 0x4a, 0x4d, 0xd0, 0x48, 0x4f, 0x3e, 0xff, 0x8e, 0x92, 0x5b, 0xff, 0xaa, 0xac, 0x5a, 0xff, 0xb2, 0xb2, 0x50, 0xff, 0xbd, 0xbd, 0x4b, 0xff, 0xc9, 0xcb, 0x52, 0xff, 0xca, 0xd1, 0x68, 0xff, 0xe6, 0xf2, 0xab, 0xff, 0xe6, 0xfa, 0xc6, 0xff, 0xe0, 0xf8, 0xca, 0xff, 0xde, 0xf9, 0xcb, 0xff, 0xdd, 0xf9, 0xc8, 0xff, 0xda, 0xf8, 0xc6, 0xff, 0xdb, 0xf9, 0xc5, 0xff, 0xdd, 0xf9, 0xc4, 0xff, 0xde, 0xf8, 0xc5, 0xff, 0xde, 0xf7, 0xc5, 0xff, 0xde, 0xf6, 0xc6, 0xff, 0xde, 0xf6, 0xc6, 0xff, 0xdd, 0xf7, 0xc7, 0xff, 0xdc, 0xf7, 0xc7, 0xff, 0xdb, 0xf7, 0xc9, 0xff, 0xdb, 0xf7, 0xc9, 0xff, 0xdb, 0xf9, 0xc6, 0xff, 0xdb, 0xf9, 0xc6, 0xff, 0xdc, 0xf9, 0xc7, 0xff, 0xe3, 0xfd, 0xc0, 0xff, 0xe6, 0xf6, 0xa3, 0xff, 0xd7, 0xe2, 0x6a, 0xff, 0xe2, 0xe8, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x55, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe3, 0xea, 0x58, 0xff, 0xe1, 0xe9, 0x58, 0xff, 0xdd, 0xe5, 0x57, 0xff, 0xd5, 0xd9, 0x55, 0xff, 0xc5, 0xc6, 0x4c, 0xff, 0xb9, 0xbc, 0x4d, 0xff, 0xb0, 0xb3, 0x59, 0xff, 0xa0, 0xa5, 0x67, 0xff, 0x6b, 0x71, 0x51, 0xff, 0x4e, 0x54, 0x53, 0xee, 0x6d, 0x76, 0x7f, 0x52, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x74, 0x77, 0x84, 0x4f, 0x48, 0x4d, 0x53, 0xee, 0x5c, 0x5c, 0x41, 0xff, 0x9f, 0xa0, 0x5f, 0xff, 0xae, 0xb0, 0x58, 0xff, 0xb7, 0xb7, 0x4e, 0xff, 0xbc, 0xbd, 0x4c, 0xff, 0xbd, 0xc3, 0x68, 0xff, 0xe3, 0xf0, 0xb2, 0xff, 0xe1, 0xf5, 0xc4, 0xff, 0xdf, 0xf6, 0xc4, 0xff, 0xe0, 0xf7, 0xca, 0xff, 0xde, 0xf7, 0xc7, 0xff, 0xdb, 0xf7, 0xc6, 0xff, 0xdb, 0xf7, 0xc6, 0xff, 0xdc, 0xf7, 0xc6, 0xff, 0xdf, 0xf6, 0xc7, 0xff, 0xde, 0xf7, 0xc7, 0xff, 0xdc, 0xf8, 0xc6, 0xff, 0xdc, 0xf7, 0xc6, 0xff, 0xda, 0xf7, 0xc6, 0xff, 0xdb, 0xf8, 0xc7, 0xff, 0xdb, 0xf7, 0xc9, 0xff, 0xdc, 0xf8, 0xca, 0xff, 0xdd, 0xf9, 0xc6, 0xff, 0xdd, 0xf9, 0xc7, 0xff, 0xdc, 0xfa, 0xc9, 0xff, 0xe0, 0xfc, 0xc5, 0xff, 0xea, 0xfb, 0xb2, 0xff, 0xd9, 0xe4, 0x7a, 0xff, 0xdf, 0xe5, 0x5f, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe1, 0xe6, 0x58, 0xff, 0xdf, 0xe7, 0x5b, 0xff, 0xd8, 0xe1, 0x57, 0xff, 0xcf, 0xd6, 0x52, 0xff, 0xc1, 0xc4, 0x4c, 0xff, 0xbd, 0xbc, 0x50, 0xff, 0xb4, 0xb6, 0x56, 0xff, 0xac, 0xb2, 0x62, 0xff, 0x85, 0x8a, 0x5e, 0xff, 0x54, 0x57, 0x56, 0xfa, 0x5a, 0x61, 0x68, 0x91, 0xaa, 0xd4, 0xd4, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xd4, 0xd4, 0x06, 0x5e, 0x62, 0x6a, 0x80, 0x50, 0x51, 0x48, 0xf8, 0x6b, 0x6d, 0x49, 0xff, 0xa7, 0xa8, 0x67, 0xff, 0xb2, 0xb2, 0x57, 0xff, 0xb6, 0xb6, 0x4c, 0xff, 0xbb, 0xbd, 0x65, 0xff, 0xe1, 0xe9, 0xac, 0xff, 0xd9, 0xe8, 0xb5, 0xff, 0xda, 0xf1, 0xb9, 0xff, 0xdd, 0xf2, 0xc2, 0xff, 0xde, 0xf4, 0xc4, 0xff, 0xe0, 0xf6, 0xc7, 0xff, 0xe0, 0xf6, 0xc8, 0xff, 0xdf, 0xf7, 0xc7, 0xff, 0xdd, 0xf5, 0xc6, 0xff, 0xdc, 0xf6, 0xc7, 0xff, 0xdb, 0xf8, 0xc7, 0xff, 0xdb, 0xf8, 0xc7, 0xff, 0xdb, 0xf8, 0xc7, 0xff, 0xdb, 0xf8, 0xc7, 0xff, 0xdc, 0xf8, 0xc8, 0xff, 0xdd, 0xf9, 0xc8, 0xff, 0xdf, 0xf9, 0xc8, 0xff, 0xdd, 0xf9, 0xc8, 0xff, 0xdb, 0xf8, 0xc7, 0xff, 0xdc, 0xf9, 0xc3, 0xff, 0xe8, 0xfd, 0xbe, 0xff, 0xe1, 0xee, 0x93, 0xff, 0xd9, 0xe2, 0x62, 0xff, 0xe3, 0xea, 0x5b, 0xff, 0xe4, 0xea, 0x59, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe3, 0xea, 0x56, 0xff, 0xe2, 0xea, 0x55, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe7, 0xe8, 0x59, 0xff, 0xe5, 0xe8, 0x58, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe3, 0xe9, 0x55, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe7, 0x59, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xea, 0x55, 0xff, 0xe5, 0xeb, 0x54, 0xff, 0xe4, 0xea, 0x53, 0xff, 0xe4, 0xe8, 0x55, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe2, 0xe6, 0x58, 0xff, 0xdf, 0xe2, 0x5a, 0xff, 0xd5, 0xd8, 0x56, 0xff, 0xc5, 0xc9, 0x4b, 0xff, 0xbc, 0xc0, 0x49, 0xff, 0xb9, 0xba, 0x4e, 0xff, 0xb6, 0xb6, 0x52, 0xff, 0xad, 0xb3, 0x5b, 0xff, 0x95, 0x9c, 0x61, 0xff, 0x59, 0x5e, 0x4e, 0xfe, 0x55, 0x57, 0x5e, 0xc4, 0x8e, 0x8e, 0xa1, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x0c, 0x5c, 0x5f, 0x61, 0x99, 0x50, 0x53, 0x4e, 0xfb, 0x76, 0x74, 0x51, 0xff, 0xac, 0xaa, 0x67, 0xff, 0xb6, 0xb6, 0x5a, 0xff, 0xb9, 0xbb, 0x64, 0xff, 0xd7, 0xdd, 0x9a, 0xff, 0xcf, 0xdd, 0xa3, 0xff, 0xcf, 0xe3, 0xa8, 0xff, 0xd5, 0xe8, 0xb2, 0xff, 0xd9, 0xeb, 0xb9, 0xff, 0xde, 0xf0, 0xc0, 0xff, 0xe0, 0xf2, 0xc5, 0xff, 0xe1, 0xf5, 0xc7, 0xff, 0xdf, 0xf6, 0xc6, 0xff, 0xde, 0xf7, 0xc8, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdc, 0xf8, 0xc8, 0xff, 0xdc, 0xf9, 0xc7, 0xff, 0xdc, 0xf9, 0xc6, 0xff, 0xdc, 0xf9, 0xc7, 0xff, 0xdd, 0xfa, 0xc8, 0xff, 0xdd, 0xfa, 0xc9, 0xff, 0xdd, 0xf9, 0xca, 0xff, 0xdc, 0xf8, 0xc9, 0xff, 0xdd, 0xfb, 0xc7, 0xff, 0xe7, 0xfd, 0xc4, 0xff, 0xe8, 0xf7, 0xa4, 0xff, 0xd8, 0xe4, 0x66, 0xff, 0xde, 0xe7, 0x58, 0xff, 0xe3, 0xe7, 0x59, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe3, 0xea, 0x57, 0xff, 0xe2, 0xeb, 0x56, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe8, 0xe7, 0x59, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe5, 0xe9, 0x55, 0xff, 0xe4, 0xe9, 0x54, 0xff, 0xe4, 0xe8, 0x56, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe5, 0xea, 0x55, 0xff, 0xe4, 0xeb, 0x55, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe3, 0xe7, 0x59, 0xff, 0xe2, 0xe4, 0x5b, 0xff, 0xd7, 0xd9, 0x54, 0xff, 0xc8, 0xc8, 0x4b, 0xff, 0xc1, 0xc0, 0x49, 0xff, 0xbb, 0xba, 0x48, 0xff, 0xb8, 0xb8, 0x4a, 0xff, 0xb3, 0xb3, 0x4c, 0xff, 0xb2, 0xb4, 0x52, 0xff, 0xa9, 0xb1, 0x60, 0xff, 0x73, 0x77, 0x54, 0xff, 0x58, 0x5b, 0x5b, 0xf1, 0x7a, 0x81, 0x88, 0x49, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0xad, 0xb8, 0x19, 0x56, 0x56, 0x5f, 0xc3, 0x54, 0x54, 0x4e, 0xff, 0x78, 0x76, 0x51, 0xff, 0xa9, 0xa9, 0x68, 0xff, 0xb0, 0xb4, 0x67, 0xff, 0xcf, 0xd9, 0x91, 0xff, 0xcb, 0xd9, 0x9a, 0xff, 0xca, 0xda, 0x9f, 0xff, 0xd0, 0xe0, 0xa5, 0xff, 0xd4, 0xe3, 0xab, 0xff, 0xd7, 0xe6, 0xb1, 0xff, 0xdc, 0xeb, 0xba, 0xff, 0xdf, 0xf0, 0xc1, 0xff, 0xe2, 0xf6, 0xc7, 0xff, 0xe2, 0xf7, 0xc9, 0xff, 0xe0, 0xf7, 0xc9, 0xff, 0xdf, 0xf7, 0xc8, 0xff, 0xde, 0xf9, 0xc7, 0xff, 0xdd, 0xf9, 0xc7, 0xff, 0xdc, 0xf9, 0xc7, 0xff, 0xdc, 0xf9, 0xc8, 0xff, 0xdc, 0xf9, 0xc7, 0xff, 0xdb, 0xf7, 0xca, 0xff, 0xdb, 0xf7, 0xcb, 0xff, 0xdd, 0xf8, 0xc9, 0xff, 0xe5, 0xfa, 0xc5, 0xff, 0xed, 0xfb, 0xad, 0xff, 0xd6, 0xe5, 0x6d, 0xff, 0xde, 0xe7, 0x59, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe2, 0xe8, 0x59, 0xff, 0xe3, 0xe8, 0x58, 0xff, 0xe7, 0xe7, 0x58, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe7, 0x58, 0xff, 0xe4, 0xe7, 0x55, 0xff, 0xe6, 0xeb, 0x54, 0xff, 0xe6, 0xeb, 0x52, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe6, 0xea, 0x59, 0xff, 0xe6, 0xeb, 0x5a, 0xff, 0xe4, 0xe8, 0x5b, 0xff, 0xe4, 0xe7, 0x5d, 0xff, 0xe3, 0xe3, 0x5f, 0xff, 0xdf, 0xde, 0x5e, 0xff, 0xd0, 0xce, 0x52, 0xff, 0xc1, 0xc1, 0x4b, 0xff, 0xbc, 0xba, 0x4a, 0xff, 0xba, 0xb6, 0x4d, 0xff, 0xb8, 0xb4, 0x4c, 0xff, 0xb5, 0xb3, 0x4b, 0xff, 0xb2, 0xb3, 0x4c, 0xff, 0xac, 0xaf, 0x4e, 0xff, 0xa1, 0xa8, 0x63, 0xff, 0x6a, 0x6b, 0x53, 0xff, 0x4f, 0x51, 0x57, 0xd3, 0xbb, 0xbb, 0xcc, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x63, 0x66, 0x75, 0x76, 0x47, 0x4c, 0x51, 0xfc, 0x51, 0x51, 0x47, 0xff, 0x6f, 0x6d, 0x4a, 0xff, 0xa3, 0xa5, 0x6e, 0xff, 0xc7, 0xd1, 0x92, 0xff, 0xcc, 0xda, 0x99, 0xff, 0xcb, 0xdb, 0x9b, 0xff, 0xcd, 0xdc, 0x9b, 0xff, 0xcf, 0xdc, 0x9d, 0xff, 0xd1, 0xdf, 0xa1, 0xff, 0xd5, 0xe3, 0xa9, 0xff, 0xd6, 0xe5, 0xae, 0xff, 0xda, 0xeb, 0xb8, 0xff, 0xdb, 0xed, 0xbc, 0xff, 0xdc, 0xf0, 0xc0, 0xff, 0xdd, 0xf3, 0xc2, 0xff, 0xdd, 0xf4, 0xc2, 0xff, 0xdc, 0xf6, 0xc1, 0xff, 0xdc, 0xf6, 0xc4, 0xff, 0xdb, 0xf5, 0xc5, 0xff, 0xda, 0xf7, 0xc3, 0xff, 0xdb, 0xf6, 0xc8, 0xff, 0xdc, 0xf4, 0xc9, 0xff, 0xdb, 0xf4, 0xc6, 0xff, 0xe1, 0xf6, 0xc3, 0xff, 0xed, 0xfc, 0xb4, 0xff, 0xd6, 0xe4, 0x79, 0xff, 0xdd, 0xe7, 0x5d, 0xff, 0xe2, 0xe8, 0x57, 0xff, 0xe7, 0xe8, 0x57, 0xff, 0xe7, 0xe9, 0x59, 0xff, 0xe3, 0xe8, 0x5a, 0xff, 0xe3, 0xe7, 0x58, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe7, 0xe8, 0x56, 0xff, 0xe6, 0xe6, 0x59, 0xff, 0xe4, 0xe6, 0x59, 0xff, 0xe2, 0xe7, 0x53, 0xff, 0xe1, 0xe9, 0x52, 0xff, 0xe2, 0xe7, 0x59, 0xff, 0xe2, 0xe7, 0x5e, 0xff, 0xdf, 0xe5, 0x5d, 0xff, 0xdc, 0xdf, 0x5c, 0xff, 0xd3, 0xd4, 0x56, 0xff, 0xc9, 0xc8, 0x4f, 0xff, 0xc5, 0xc4, 0x4d, 0xff, 0xbe, 0xbe, 0x49, 0xff, 0xb7, 0xb9, 0x4b, 0xff, 0xb6, 0xb5, 0x4f, 0xff, 0xb7, 0xb2, 0x50, 0xff, 0xb7, 0xb1, 0x50, 0xff, 0xb3, 0xb0, 0x4e, 0xff, 0xaf, 0xb0, 0x4e, 0xff, 0xa8, 0xaa, 0x51, 0xff, 0x99, 0x9f, 0x64, 0xff, 0x61, 0x62, 0x53, 0xff, 0x51, 0x52, 0x59, 0xb1, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x63, 0x6e, 0x64, 0x42, 0x4b, 0x4e, 0xfb, 0x53, 0x57, 0x50, 0xff, 0x5a, 0x56, 0x45, 0xff, 0x67, 0x65, 0x46, 0xff, 0xb3, 0xba, 0x8d, 0xff, 0xcb, 0xd9, 0xa0, 0xff, 0xca, 0xda, 0x9a, 0xff, 0xca, 0xd8, 0x97, 0xff, 0xca, 0xd7, 0x95, 0xff, 0xcd, 0xda, 0x97, 0xff, 0xcd, 0xdb, 0x99, 0xff, 0xcd, 0xdc, 0x9c, 0xff, 0xcf, 0xde, 0xa2, 0xff, 0xcf, 0xdf, 0xa8, 0xff, 0xd1, 0xe2, 0xad, 0xff, 0xd3, 0xe6, 0xb1, 0xff, 0xd5, 0xe9, 0xb2, 0xff, 0xd6, 0xec, 0xb4, 0xff, 0xd7, 0xee, 0xb8, 0xff, 0xd8, 0xef, 0xbb, 0xff, 0xd8, 0xf2, 0xbb, 0xff, 0xda, 0xf1, 0xc0, 0xff, 0xdc, 0xf2, 0xc5, 0xff, 0xde, 0xf4, 0xc3, 0xff, 0xe2, 0xf6, 0xc3, 0xff, 0xeb, 0xfb, 0xbc, 0xff, 0xd7, 0xe5, 0x8d, 0xff, 0xd7, 0xe2, 0x66, 0xff, 0xe1, 0xe7, 0x5c, 0xff, 0xe7, 0xea, 0x57, 0xff, 0xe7, 0xe9, 0x56, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x55, 0xff, 0xe7, 0xe8, 0x56, 0xff, 0xe5, 0xe6, 0x58, 0xff, 0xe3, 0xe6, 0x5c, 0xff, 0xdd, 0xe2, 0x5b, 0xff, 0xdc, 0xe1, 0x60, 0xff, 0xd6, 0xd9, 0x60, 0xff, 0xcc, 0xcf, 0x58, 0xff, 0xc5, 0xc8, 0x50, 0xff, 0xbf, 0xbf, 0x49, 0xff, 0xbc, 0xbc, 0x48, 0xff, 0xbb, 0xba, 0x49, 0xff, 0xb7, 0xb9, 0x4a, 0xff, 0xb3, 0xb7, 0x4a, 0xff, 0xb3, 0xb7, 0x52, 0xff, 0xb5, 0xb7, 0x56, 0xff, 0xb3, 0xb1, 0x52, 0xff, 0xb4, 0xb1, 0x4f, 0xff, 0xb2, 0xaf, 0x4f, 0xff, 0xae, 0xae, 0x53, 0xff, 0xa5, 0xa7, 0x56, 0xff, 0x8e, 0x95, 0x62, 0xff, 0x53, 0x56, 0x4e, 0xfc, 0x60, 0x60, 0x69, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x60, 0x66, 0x55, 0x45, 0x4d, 0x4c, 0xfb, 0x7d, 0x80, 0x6f, 0xff, 0x77, 0x77, 0x5c, 0xff, 0x5b, 0x59, 0x3c, 0xff, 0x62, 0x64, 0x49, 0xff, 0xa7, 0xb0, 0x8b, 0xff, 0xc8, 0xd5, 0xa5, 0xff, 0xca, 0xd8, 0xa1, 0xff, 0xca, 0xd8, 0x9d, 0xff, 0xcc, 0xda, 0x9a, 0xff, 0xcd, 0xdb, 0x97, 0xff, 0xcc, 0xdb, 0x97, 0xff, 0xcd, 0xdc, 0x9b, 0xff, 0xcc, 0xda, 0x9d, 0xff, 0xcc, 0xdb, 0xa0, 0xff, 0xce, 0xde, 0xa3, 0xff, 0xd0, 0xe0, 0xa4, 0xff, 0xd0, 0xe2, 0xa6, 0xff, 0xd1, 0xe3, 0xa9, 0xff, 0xd2, 0xe4, 0xac, 0xff, 0xd3, 0xe8, 0xac, 0xff, 0xd5, 0xe7, 0xb1, 0xff, 0xd8, 0xea, 0xb7, 0xff, 0xd9, 0xef, 0xb7, 0xff, 0xdd, 0xf1, 0xbc, 0xff, 0xe7, 0xf7, 0xc0, 0xff, 0xb0, 0xbe, 0x7d, 0xff, 0xc3, 0xce, 0x67, 0xff, 0xde, 0xe5, 0x67, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x54, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe1, 0xe8, 0x57, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe6, 0xe8, 0x56, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xde, 0xe4, 0x5c, 0xff, 0xd8, 0xdc, 0x6a, 0xff, 0xa0, 0xa2, 0x44, 0xff, 0xa6, 0xaa, 0x50, 0xff, 0xb2, 0xb4, 0x51, 0xff, 0xb4, 0xb4, 0x4a, 0xff, 0xb5, 0xb3, 0x49, 0xff, 0xb6, 0xb5, 0x4b, 0xff, 0xb4, 0xb5, 0x50, 0xff, 0xb0, 0xb2, 0x55, 0xff, 0xaf, 0xb3, 0x5c, 0xff, 0xac, 0xae, 0x5f, 0xff, 0x93, 0x93, 0x44, 0xff, 0xad, 0xab, 0x53, 0xff, 0xb4, 0xb2, 0x51, 0xff, 0xb0, 0xb0, 0x4f, 0xff, 0xad, 0xad, 0x55, 0xff, 0xa4, 0xa5, 0x5c, 0xff, 0x7d, 0x85, 0x5b, 0xff, 0x48, 0x4c, 0x49, 0xf2, 0x86, 0x86, 0x8e, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x65, 0x70, 0x49, 0x4f, 0x52, 0x51, 0xf8, 0x7e, 0x82, 0x65, 0xff, 0x9f, 0xa3, 0x73, 0xff, 0x7b, 0x7c, 0x53, 0xff, 0x59, 0x59, 0x44, 0xff, 0x55, 0x58, 0x48, 0xff, 0x84, 0x8b, 0x72, 0xff, 0xbf, 0xcb, 0xa4, 0xff, 0xcc, 0xd9, 0xaa, 0xff, 0xcc, 0xda, 0xa2, 0xff, 0xcd, 0xdb, 0x9b, 0xff, 0xcd, 0xdb, 0x99, 0xff, 0xce, 0xdd, 0x9b, 0xff, 0xce, 0xdd, 0x9d, 0xff, 0xcc, 0xdb, 0x9c, 0xff, 0xcd, 0xdb, 0x9b, 0xff, 0xce, 0xdc, 0x9c, 0xff, 0xcd, 0xdc, 0x9c, 0xff, 0xce, 0xdc, 0x9e, 0xff, 0xce, 0xdb, 0xa0, 0xff, 0xce, 0xde, 0x9f, 0xff, 0xcf, 0xdd, 0xa3, 0xff, 0xcf, 0xde, 0xa5, 0xff, 0xcd, 0xe0, 0xa1, 0xff, 0xd2, 0xe6, 0xae, 0xff, 0xd8, 0xe9, 0xb8, 0xff, 0x78, 0x84, 0x57, 0xff, 0x93, 0x9c, 0x4d, 0xff, 0xcd, 0xd4, 0x65, 0xff, 0xe1, 0xe7, 0x5c, 0xff, 0xe7, 0xea, 0x57, 0xff, 0xe3, 0xe7, 0x58, 0xff, 0xe1, 0xe7, 0x59, 0xff, 0xe3, 0xe8, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe4, 0xed, 0x55, 0xff, 0xde, 0xe7, 0x60, 0xff, 0xd0, 0xd3, 0x72, 0xff, 0x84, 0x84, 0x42, 0xff, 0x83, 0x87, 0x45, 0xff, 0xa9, 0xac, 0x57, 0xff, 0xb1, 0xb1, 0x4f, 0xff, 0xb1, 0xb0, 0x4d, 0xff, 0xb0, 0xaf, 0x50, 0xff, 0xae, 0xaf, 0x59, 0xff, 0xa7, 0xa8, 0x61, 0xff, 0x99, 0x9a, 0x5e, 0xff, 0x72, 0x70, 0x3c, 0xff, 0x7e, 0x7a, 0x40, 0xff, 0xb3, 0xae, 0x60, 0xff, 0xb5, 0xb3, 0x55, 0xff, 0xb0, 0xb1, 0x4e, 0xff, 0xae, 0xae, 0x57, 0xff, 0xa8, 0xa8, 0x64, 0xff, 0x67, 0x6f, 0x4f, 0xff, 0x4e, 0x52, 0x55, 0xcd, 0xae, 0xae, 0xbc, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x75, 0x7d, 0x3d, 0x4f, 0x53, 0x55, 0xf2, 0x75, 0x74, 0x57, 0xff, 0xab, 0xa7, 0x6d, 0xff, 0xa9, 0xa7, 0x68, 0xff, 0x8e, 0x8f, 0x61, 0xff, 0x5f, 0x62, 0x4b, 0xff, 0x56, 0x57, 0x4c, 0xff, 0x5c, 0x60, 0x50, 0xff, 0x8e, 0x97, 0x7f, 0xff, 0xba, 0xc5, 0xa4, 0xff, 0xd0, 0xdb, 0xb0, 0xff, 0xcc, 0xd9, 0xa2, 0xff, 0xcb, 0xdc, 0x9d, 0xff, 0xcb, 0xdd, 0x9b, 0xff, 0xca, 0xdc, 0x98, 0xff, 0xcd, 0xdd, 0x98, 0xff, 0xce, 0xdd, 0x96, 0xff, 0xcf, 0xdc, 0x96, 0xff, 0xd0, 0xdb, 0x9a, 0xff, 0xce, 0xd8, 0x9b, 0xff, 0xcd, 0xd8, 0x9d, 0xff, 0xcd, 0xd8, 0x9d, 0xff, 0xce, 0xd9, 0x9a, 0xff, 0xcb, 0xda, 0x97, 0xff, 0xce, 0xde, 0xa1, 0xff, 0xd1, 0xdc, 0xaf, 0xff, 0x76, 0x7e, 0x5f, 0xff, 0x72, 0x76, 0x42, 0xff, 0xbf, 0xc1, 0x64, 0xff, 0xe2, 0xe4, 0x5e, 0xff, 0xe3, 0xe8, 0x54, 0xff, 0xe1, 0xe7, 0x58, 0xff, 0xe4, 0xe7, 0x58, 0xff, 0xe8, 0xe9, 0x56, 0xff, 0xe8, 0xea, 0x58, 0xff, 0xe6, 0xea, 0x5b, 0xff, 0xe1, 0xe8, 0x64, 0xff, 0xc6, 0xcc, 0x69, 0xff, 0x84, 0x88, 0x49, 0xff, 0x7c, 0x80, 0x4d, 0xff, 0xa1, 0xa4, 0x61, 0xff, 0xaa, 0xa8, 0x59, 0xff, 0xad, 0xaa, 0x5e, 0xff, 0x9f, 0xa0, 0x62, 0xff, 0x7a, 0x7f, 0x52, 0xff, 0x61, 0x66, 0x44, 0xff, 0x5e, 0x5e, 0x3d, 0xff, 0x7c, 0x7b, 0x4a, 0xff, 0xad, 0xac, 0x68, 0xff, 0xb4, 0xb0, 0x5f, 0xff, 0xb6, 0xb0, 0x58, 0xff, 0xb3, 0xb3, 0x54, 0xff, 0xab, 0xad, 0x5c, 0xff, 0x9e, 0x9e, 0x6c, 0xff, 0x52, 0x56, 0x4f, 0xfd, 0x63, 0x67, 0x6b, 0x88, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x7f, 0x87, 0x20, 0x4c, 0x50, 0x57, 0xdd, 0x68, 0x68, 0x50, 0xff, 0xaa, 0xa5, 0x68, 0xff, 0xac, 0xab, 0x58, 0xff, 0xa9, 0xad, 0x5e, 0xff, 0x9f, 0xa5, 0x67, 0xff, 0x82, 0x86, 0x56, 0xff, 0x67, 0x66, 0x4d, 0xff, 0x5b, 0x5f, 0x4c, 0xff, 0x59, 0x60, 0x4f, 0xff, 0x75, 0x7c, 0x66, 0xff, 0xaf, 0xb6, 0x97, 0xff, 0xc7, 0xd3, 0xab, 0xff, 0xca, 0xd8, 0xab, 0xff, 0xce, 0xdb, 0xa7, 0xff, 0xcc, 0xd8, 0x9f, 0xff, 0xce, 0xd9, 0x9b, 0xff, 0xcf, 0xda, 0x9a, 0xff, 0xcf, 0xd9, 0x9a, 0xff, 0xcf, 0xda, 0x9c, 0xff, 0xcf, 0xda, 0x9c, 0xff, 0xce, 0xd7, 0x99, 0xff, 0xcf, 0xdb, 0x98, 0xff, 0xcb, 0xda, 0x93, 0xff, 0xca, 0xd8, 0x98, 0xff, 0xcf, 0xdb, 0xaa, 0xff, 0x8b, 0x94, 0x74, 0xff, 0x58, 0x5e, 0x38, 0xff, 0xb2, 0xb3, 0x64, 0xff, 0xde, 0xde, 0x60, 0xff, 0xe4, 0xe8, 0x56, 0xff, 0xe2, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x58, 0xff, 0xe9, 0xea, 0x57, 0xff, 0xe7, 0xea, 0x5a, 0xff, 0xe6, 0xe7, 0x5f, 0xff, 0xe0, 0xe4, 0x65, 0xff, 0xc2, 0xc7, 0x67, 0xff, 0x80, 0x84, 0x4e, 0xff, 0x77, 0x7b, 0x5a, 0xff, 0x99, 0x9e, 0x74, 0xff, 0x93, 0x96, 0x63, 0xff, 0x78, 0x75, 0x4c, 0xff, 0x56, 0x55, 0x42, 0xff, 0x4e, 0x53, 0x4e, 0xff, 0x54, 0x5a, 0x4e, 0xff, 0x6f, 0x71, 0x53, 0xff, 0xa8, 0xa9, 0x6b, 0xff, 0xb3, 0xb3, 0x5e, 0xff, 0xb6, 0xb2, 0x53, 0xff, 0xba, 0xb3, 0x55, 0xff, 0xb4, 0xb2, 0x57, 0xff, 0xab, 0xad, 0x69, 0xff, 0x79, 0x78, 0x58, 0xff, 0x4d, 0x50, 0x51, 0xed, 0x77, 0x7b, 0x80, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xdb, 0xdb, 0x07, 0x51, 0x56, 0x5e, 0xb4, 0x5a, 0x5a, 0x4a, 0xff, 0xa3, 0xa1, 0x68, 0xff, 0xaf, 0xae, 0x59, 0xff, 0xb0, 0xb1, 0x53, 0xff, 0xaf, 0xb2, 0x59, 0xff, 0xae, 0xaf, 0x60, 0xff, 0xa3, 0xa0, 0x6a, 0xff, 0x84, 0x85, 0x64, 0xff, 0x63, 0x67, 0x5c, 0xff, 0x56, 0x5a, 0x5b, 0xff, 0x56, 0x58, 0x5a, 0xff, 0x5e, 0x60, 0x5b, 0xff, 0x81, 0x86, 0x76, 0xff, 0x9e, 0xa4, 0x8b, 0xff, 0xb5, 0xbb, 0x9c, 0xff, 0xc3, 0xca, 0xa4, 0xff, 0xcd, 0xd6, 0xaa, 0xff, 0xcf, 0xd9, 0xa9, 0xff, 0xcd, 0xd8, 0xa5, 0xff, 0xcb, 0xd6, 0xa2, 0xff, 0xcb, 0xd6, 0xa0, 0xff, 0xc8, 0xd3, 0x9a, 0xff, 0xc7, 0xd5, 0x98, 0xff, 0xc9, 0xd7, 0x9d, 0xff, 0xc8, 0xd6, 0xa8, 0xff, 0xa3, 0xae, 0x90, 0xff, 0x4c, 0x54, 0x3d, 0xff, 0x9b, 0x9e, 0x5e, 0xff, 0xcd, 0xcf, 0x5e, 0xff, 0xe2, 0xe5, 0x58, 0xff, 0xe2, 0xe8, 0x55, 0xff, 0xe2, 0xe7, 0x55, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe0, 0xe6, 0x58, 0xff, 0xe4, 0xe5, 0x60, 0xff, 0xdb, 0xdd, 0x63, 0xff, 0xbc, 0xbf, 0x69, 0xff, 0x78, 0x7a, 0x54, 0xff, 0x60, 0x63, 0x59, 0xff, 0x5e, 0x65, 0x57, 0xff, 0x4d, 0x51, 0x46, 0xff, 0x4f, 0x4b, 0x4d, 0xf6, 0x51, 0x4d, 0x5b, 0xcd, 0x5f, 0x5f, 0x6e, 0xba, 0x59, 0x5e, 0x5c, 0xfc, 0x85, 0x8a, 0x6c, 0xff, 0xab, 0xac, 0x69, 0xff, 0xb2, 0xb2, 0x55, 0xff, 0xb6, 0xb1, 0x4b, 0xff, 0xb7, 0xb1, 0x4f, 0xff, 0xb1, 0xae, 0x5d, 0xff, 0x96, 0x97, 0x68, 0xff, 0x5c, 0x5b, 0x51, 0xfd, 0x56, 0x54, 0x5b, 0xa3, 0xbf, 0xbf, 0xbf, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x64, 0x70, 0x6b, 0x57, 0x59, 0x50, 0xf9, 0x90, 0x8f, 0x63, 0xff, 0xb1, 0xaf, 0x67, 0xff, 0xb5, 0xb3, 0x59, 0xff, 0xb7, 0xb2, 0x58, 0xff, 0xb4, 0xb0, 0x58, 0xff, 0xae, 0xad, 0x60, 0xff, 0xa4, 0xa6, 0x7b, 0xff, 0x6b, 0x6d, 0x65, 0xff, 0x53, 0x54, 0x60, 0xf4, 0x60, 0x5f, 0x72, 0xa4, 0x58, 0x54, 0x65, 0xb0, 0x4e, 0x4b, 0x57, 0xdc, 0x4d, 0x4b, 0x51, 0xf5, 0x51, 0x51, 0x52, 0xfd, 0x5a, 0x5c, 0x55, 0xff, 0x6b, 0x6f, 0x61, 0xff, 0x80, 0x86, 0x71, 0xff, 0x92, 0x99, 0x83, 0xff, 0xa2, 0xaa, 0x8f, 0xff, 0xaa, 0xb3, 0x95, 0xff, 0xb0, 0xb9, 0x99, 0xff, 0xb3, 0xbe, 0x9b, 0xff, 0xb2, 0xbf, 0x9d, 0xff, 0xad, 0xb8, 0x9f, 0xff, 0xa4, 0xad, 0xa0, 0xff, 0x52, 0x5b, 0x52, 0xff, 0x7e, 0x84, 0x54, 0xff, 0xbe, 0xc1, 0x64, 0xff, 0xd7, 0xdb, 0x58, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe2, 0xe8, 0x55, 0xff, 0xe1, 0xe7, 0x57, 0xff, 0xde, 0xe6, 0x5a, 0xff, 0xdd, 0xe0, 0x5c, 0xff, 0xce, 0xd0, 0x59, 0xff, 0xb0, 0xb2, 0x65, 0xff, 0x65, 0x66, 0x50, 0xff, 0x54, 0x56, 0x5f, 0xfd, 0x4e, 0x4f, 0x5b, 0xe2, 0x60, 0x5f, 0x68, 0x9f, 0x75, 0x6c, 0x81, 0x53, 0x9b, 0x9b, 0xb1, 0x17, 0x9b, 0x9b, 0xaa, 0x21, 0x59, 0x5d, 0x62, 0xd3, 0x68, 0x6f, 0x60, 0xff, 0x9e, 0x9f, 0x6f, 0xff, 0xab, 0xa9, 0x64, 0xff, 0xad, 0xa9, 0x57, 0xff, 0xab, 0xa8, 0x58, 0xff, 0xa1, 0x9f, 0x67, 0xff, 0x5f, 0x5f, 0x4b, 0xff, 0x52, 0x52, 0x58, 0xdb, 0x91, 0x91, 0x97, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x8b, 0x9b, 0x21, 0x5a, 0x5c, 0x5c, 0xda, 0x70, 0x72, 0x56, 0xff, 0xa7, 0xa9, 0x6f, 0xff, 0xae, 0xae, 0x5c, 0xff, 0xb1, 0xb1, 0x55, 0xff, 0xb0, 0xb1, 0x56, 0xff, 0xab, 0xae, 0x64, 0xff, 0x86, 0x8a, 0x61, 0xff, 0x58, 0x5b, 0x57, 0xfe, 0x59, 0x59, 0x67, 0xab, 0xaa, 0xaa, 0xb8, 0x12, 0xaa, 0xaa, 0xc6, 0x09, 0x8f, 0x85, 0x99, 0x19, 0x65, 0x62, 0x73, 0x49, 0x55, 0x53, 0x62, 0x72, 0x4e, 0x4e, 0x5b, 0xa3, 0x50, 0x50, 0x5a, 0xbd, 0x53, 0x53, 0x5d, 0xd2, 0x53, 0x54, 0x5e, 0xe3, 0x4f, 0x53, 0x57, 0xed, 0x4d, 0x51, 0x52, 0xf3, 0x4f, 0x52, 0x53, 0xf6, 0x51, 0x55, 0x53, 0xf9, 0x50, 0x56, 0x52, 0xfb, 0x4f, 0x56, 0x57, 0xfc, 0x4f, 0x55, 0x5d, 0xfc, 0x57, 0x5d, 0x61, 0xfd, 0x61, 0x67, 0x4e, 0xff, 0xaf, 0xb3, 0x6c, 0xff, 0xc7, 0xcd, 0x5c, 0xff, 0xd8, 0xde, 0x55, 0xff, 0xe0, 0xe4, 0x56, 0xff, 0xde, 0xe3, 0x59, 0xff, 0xd9, 0xe0, 0x58, 0xff, 0xcf, 0xd3, 0x54, 0xff, 0xc1, 0xc4, 0x55, 0xff, 0xa4, 0xa8, 0x63, 0xff, 0x57, 0x56, 0x4c, 0xff, 0x60, 0x60, 0x72, 0xc1, 0x9d, 0x9d, 0xb1, 0x27, 0xcc, 0xcc, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x69, 0x69, 0x71, 0x61, 0x5b, 0x5e, 0x65, 0xf2, 0x6a, 0x69, 0x5b, 0xff, 0x91, 0x8f, 0x72, 0xff, 0xa0, 0x9e, 0x74, 0xff, 0x98, 0x97, 0x6a, 0xff, 0x69, 0x68, 0x4f, 0xff, 0x4e, 0x4c, 0x51, 0xef, 0x64, 0x5f, 0x6e, 0x66, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xff, 0x03, 0x5d, 0x60, 0x68, 0x78, 0x59, 0x5d, 0x58, 0xf8, 0x82, 0x87, 0x62, 0xff, 0xa5, 0xa8, 0x6b, 0xff, 0xa9, 0xad, 0x64, 0xff, 0xa4, 0xab, 0x64, 0xff, 0x89, 0x8f, 0x5f, 0xff, 0x5c, 0x5e, 0x4e, 0xff, 0x4f, 0x4e, 0x55, 0xdc, 0x76, 0x71, 0x7b, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xbf, 0x9f, 0xbf, 0x08, 0x7f, 0x7f, 0x8f, 0x10, 0x76, 0x6f, 0x83, 0x27, 0x6b, 0x66, 0x74, 0x37, 0x62, 0x62, 0x72, 0x41, 0x5e, 0x5e, 0x6c, 0x49, 0x5c, 0x5c, 0x6c, 0x50, 0x5f, 0x5f, 0x67, 0x59, 0x5a, 0x5a, 0x6a, 0x63, 0x61, 0x61, 0x71, 0x6c, 0x64, 0x66, 0x74, 0x8f, 0x60, 0x61, 0x5e, 0xf1, 0x87, 0x8b, 0x5d, 0xff, 0xbf, 0xc4, 0x6d, 0xff, 0xc8, 0xcc, 0x55, 0xff, 0xd5, 0xd6, 0x57, 0xff, 0xd8, 0xd7, 0x59, 0xff, 0xcf, 0xd2, 0x53, 0xff, 0xc4, 0xc4, 0x51, 0xff, 0xb5, 0xb8, 0x56, 0xff, 0x93, 0x98, 0x5d, 0xff, 0x4e, 0x4c, 0x49, 0xfc, 0x69, 0x65, 0x79, 0x7e, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x92, 0xb6, 0x07, 0x58, 0x56, 0x67, 0x77, 0x56, 0x55, 0x5f, 0xe8, 0x55, 0x52, 0x5a, 0xfd, 0x5b, 0x5a, 0x55, 0xff, 0x55, 0x55, 0x4b, 0xfd, 0x56, 0x50, 0x56, 0xe3, 0x5f, 0x56, 0x68, 0x73, 0xbf, 0x9f, 0xbf, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x8c, 0x99, 0x14, 0x53, 0x58, 0x5f, 0xa9, 0x59, 0x5c, 0x56, 0xf9, 0x6c, 0x6c, 0x55, 0xff, 0x7c, 0x7d, 0x5d, 0xff, 0x6c, 0x70, 0x53, 0xff, 0x54, 0x58, 0x4d, 0xff, 0x4d, 0x4e, 0x57, 0xdd, 0x67, 0x64, 0x75, 0x4a, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xc6, 0xc6, 0xc6, 0x09, 0x60, 0x60, 0x69, 0x97, 0x60, 0x63, 0x51, 0xfc, 0xa6, 0xac, 0x6b, 0xff, 0xbf, 0xc0, 0x5f, 0xff, 0xc7, 0xc5, 0x54, 0xff, 0xcd, 0xc8, 0x54, 0xff, 0xc6, 0xc4, 0x4f, 0xff, 0xbb, 0xba, 0x52, 0xff, 0xaf, 0xb2, 0x60, 0xff, 0x7d, 0x81, 0x52, 0xff, 0x50, 0x4c, 0x4e, 0xf4, 0x71, 0x6a, 0x7f, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x05, 0x5f, 0x5f, 0x73, 0x33, 0x5a, 0x58, 0x6b, 0x77, 0x58, 0x58, 0x65, 0x93, 0x59, 0x59, 0x60, 0x78, 0x6a, 0x60, 0x6f, 0x35, 0xcc, 0x99, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x8b, 0x97, 0x16, 0x59, 0x59, 0x66, 0x87, 0x52, 0x53, 0x5e, 0xe0, 0x53, 0x56, 0x5f, 0xf5, 0x51, 0x55, 0x5d, 0xf0, 0x52, 0x50, 0x5f, 0xba, 0x6d, 0x69, 0x75, 0x3d, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x8a, 0x23, 0x58, 0x5c, 0x5d, 0xce, 0x66, 0x6b, 0x52, 0xff, 0xa3, 0xa6, 0x6b, 0xff, 0xbf, 0xbc, 0x62, 0xff, 0xc3, 0xbf, 0x52, 0xff, 0xbe, 0xc0, 0x56, 0xff, 0xaf, 0xb4, 0x5e, 0xff, 0x9e, 0xa3, 0x6d, 0xff, 0x57, 0x58, 0x46, 0xff, 0x51, 0x4c, 0x55, 0xd3, 0x95, 0x8d, 0x95, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0x05, 0x79, 0x79, 0x86, 0x26, 0x60, 0x60, 0x6c, 0x40, 0x65, 0x65, 0x6e, 0x3a, 0x87, 0x87, 0x96, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x68, 0x68, 0x72, 0x4c, 0x53, 0x55, 0x53, 0xe4, 0x67, 0x6a, 0x50, 0xff, 0x94, 0x97, 0x63, 0xff, 0xaa, 0xab, 0x6c, 0xff, 0xa9, 0xac, 0x6c, 0xff, 0x99, 0x9e, 0x6a, 0xff, 0x62, 0x66, 0x4b, 0xff, 0x4d, 0x4d, 0x4d, 0xf7, 0x64, 0x62, 0x6d, 0x70, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x02, 0x6c, 0x6c, 0x76, 0x4e, 0x52, 0x53, 0x57, 0xda, 0x55, 0x5a, 0x55, 0xfd, 0x60, 0x65, 0x59, 0xff, 0x62, 0x64, 0x55, 0xff, 0x5b, 0x5d, 0x55, 0xff, 0x52, 0x53, 0x56, 0xf8, 0x5d, 0x59, 0x65, 0x9d, 0xb1, 0xb1, 0xc4, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x7c, 0x7c, 0x89, 0x29, 0x5d, 0x5f, 0x6a, 0x8c, 0x55, 0x58, 0x63, 0xc4, 0x5e, 0x5e, 0x69, 0xd0, 0x5e, 0x5e, 0x69, 0xb8, 0x69, 0x69, 0x78, 0x66, 0xaa, 0xaa, 0xaa, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x95, 0x95, 0xaa, 0x0c, 0x9c, 0x9c, 0xaa, 0x12, 0x9f, 0x9f, 0xbf, 0x08, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-};
-
-const lv_img_dsc_t pet_idle_frame1 = {
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 100,
-  .header.h = 89,
-  .data_size = 8900 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .data = pet_idle_frame1_map,
-};
@@ -1,402 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_PET_IDLE_FRAME2
-#define LV_ATTRIBUTE_IMG_PET_IDLE_FRAME2
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_PET_IDLE_FRAME2 uint8_t pet_idle_frame2_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0xff, 0x04, 0xff, 0x05, 0xff, 0x05, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0xfb, 0x16, 0xb2, 0x3e, 0x92, 0x60, 0x92, 0x74, 0x92, 0x90, 0x8e, 0xa1, 0x6e, 0xa9, 0x6e, 0xa7, 0x8e, 0x94, 0x92, 0x6e, 0x92, 0x59, 0xb2, 0x39, 0xdb, 0x15, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0xdb, 0x27, 0x92, 0x75, 0x6d, 0xba, 0x49, 0xe1, 0x49, 0xf0, 0x49, 0xfb, 0x4d, 0xfd, 0x4d, 0xfe, 0x4d, 0xfe, 0x4d, 0xfe, 0x4d, 0xfe, 0x4d, 0xfe, 0x4d, 0xfc, 0x4d, 0xf8, 0x4d, 0xee, 0x49, 0xde, 0x6d, 0xba, 0x6e, 0x7a, 0xb2, 0x34, 0xdb, 0x0c, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x0e, 0xb2, 0x4d, 0x8e, 0xa8, 0x6d, 0xe8, 0x69, 0xfc, 0x4d, 0xff, 0x4e, 0xff, 0x72, 0xff, 0x76, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x52, 0xff, 0x4d, 0xff, 0x4d, 0xfc, 0x6d, 0xee, 0x6e, 0xb9, 0x92, 0x67, 0xb2, 0x1d, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x0a, 0x92, 0x50, 0x6e, 0xbc, 0x6d, 0xf5, 0x6d, 0xff, 0x72, 0xff, 0x76, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x6d, 0xf9, 0x6d, 0xd6, 0x8e, 0x77, 0xdb, 0x18, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xb2, 0x37, 0x6d, 0xad, 0x6d, 0xf3, 0x4d, 0xff, 0x72, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x4e, 0xff, 0x4d, 0xf9, 0x6d, 0xc7, 0x92, 0x4f, 0xdb, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x08, 0x92, 0x6c, 0x69, 0xe2, 0x4d, 0xfe, 0x72, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x4e, 0xff, 0x4d, 0xf0, 0x6e, 0x88, 0xb6, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x12, 0x6d, 0x90, 0x49, 0xf4, 0x4e, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x72, 0xff, 0x4d, 0xfa, 0x6d, 0xb5, 0xb6, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x16, 0x6e, 0xa3, 0x4d, 0xfa, 0x52, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x4d, 0xfe, 0x4d, 0xcf, 0x92, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x10, 0x6d, 0xa2, 0x4d, 0xfc, 0x72, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x77, 0xff, 0x4d, 0xfe, 0x6d, 0xd5, 0xb2, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x09, 0x6d, 0x8a, 0x4d, 0xf9, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x77, 0xff, 0x4d, 0xff, 0x6d, 0xcf, 0xb6, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x92, 0x6b, 0x4d, 0xf5, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x77, 0xff, 0x4d, 0xfd, 0x6d, 0xae, 0xb7, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x3d, 0x6d, 0xe5, 0x52, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x6d, 0xf8, 0x6e, 0x80, 0xdb, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x15, 0x6d, 0xc9, 0x4e, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x52, 0xff, 0x6d, 0xed, 0x92, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x05, 0x8e, 0x81, 0x6e, 0xfa, 0x77, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0x6d, 0xb9, 0xdb, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x3c, 0x4d, 0xe8, 0x72, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x49, 0xf7, 0x92, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x0a, 0x6d, 0xae, 0x4d, 0xfe, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0x6d, 0xd0, 0xb7, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x4d, 0x4d, 0xf3, 0x76, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x6d, 0xfa, 0x92, 0x6c, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x0e, 0x6d, 0xb9, 0x4d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4e, 0xff, 0x6d, 0xd3, 0xd7, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x52, 0x49, 0xf6, 0x76, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x6d, 0xfa, 0x8e, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x0c, 0x6d, 0xb9, 0x4d, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0x6d, 0xc9, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x47, 0x6d, 0xf4, 0x72, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x6d, 0xf5, 0x92, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0x6d, 0xb3, 0x4d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x76, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x4e, 0xff, 0x77, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x7b, 0xff, 0x52, 0xff, 0x4d, 0xff, 0x4e, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4d, 0xfe, 0x6e, 0xaf, 0xdb, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x41, 0x6d, 0xf1, 0x72, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x4d, 0xff, 0x72, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x4d, 0xff, 0x69, 0xff, 0x69, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x6d, 0xee, 0xb6, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x18, 0xb6, 0x51, 0xb6, 0x53, 0xb6, 0x46, 0xdb, 0x2a, 0xff, 0x09, 0xff, 0x07, 0x92, 0xa4, 0x6d, 0xfe, 0x77, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x56, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x6d, 0xff, 0x69, 0xff, 0x6d, 0xff, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x52, 0xff, 0x4d, 0xff, 0x6d, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x4e, 0xff, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x4d, 0xfe, 0x8e, 0x98, 0xb6, 0x37, 0xb6, 0x49, 0xb6, 0x3c, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x37, 0x6d, 0x9b, 0x6d, 0xb6, 0x6d, 0xd8, 0x6d, 0xda, 0x8e, 0xaa, 0x92, 0x80, 0x6d, 0xf0, 0x6e, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x4e, 0xff, 0x4d, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x72, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7b, 0xff, 0x72, 0xff, 0x69, 0xff, 0x69, 0xfb, 0x6d, 0xc8, 0x6d, 0xa1, 0x6d, 0x85, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xdb, 0x04, 0xb7, 0x09, 0xd7, 0x19, 0xb6, 0x2d, 0x92, 0x6b, 0x6d, 0xeb, 0x6d, 0xff, 0x72, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x77, 0xff, 0x52, 0xff, 0x52, 0xff, 0x52, 0xff, 0x52, 0xff, 0x76, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x77, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x77, 0xff, 0x32, 0xff, 0x52, 0xff, 0x76, 0xff, 0x72, 0xff, 0x6d, 0xfe, 0x92, 0x84, 0xff, 0x07, 0xdb, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x3e, 0x6d, 0xf2, 0x6e, 0xff, 0x76, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x72, 0xff, 0x4d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x4e, 0xff, 0x52, 0xff, 0x72, 0xff, 0x77, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x57, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0x6d, 0xd5, 0xdb, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0e, 0x6d, 0xb7, 0x4d, 0xff, 0x96, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x7b, 0xff, 0x52, 0xff, 0x4d, 0xff, 0x72, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0x6d, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x6d, 0xff, 0xb6, 0xff, 0xbb, 0xff, 0xb6, 0xff, 0x72, 0xff, 0x4d, 0xff, 0x52, 0xff, 0x77, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x6d, 0xfc, 0x92, 0x7e, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xdb, 0x05, 0xd7, 0x1c, 0x8e, 0x81, 0x69, 0xfb, 0x4d, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xdb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x4d, 0xff, 0xb6, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x4d, 0xff, 0x52, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0xbb, 0xff, 0x6d, 0xff, 0x6d, 0xec, 0xb6, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x15, 0x92, 0x5e, 0x8e, 0xa7, 0x6d, 0xde, 0x69, 0xfb, 0x4d, 0xff, 0x4e, 0xff, 0x52, 0xff, 0x5b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xdb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x6d, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x72, 0xff, 0x52, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x32, 0xff, 0x32, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x72, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xcb, 0xdb, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x6d, 0x94, 0x6d, 0xbc, 0x92, 0x9c, 0x6d, 0xf8, 0x6d, 0xff, 0x76, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x97, 0xff, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x72, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xdb, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x76, 0xff, 0x72, 0xff, 0x4d, 0xff, 0x6d, 0xfd, 0x92, 0x9d, 0xff, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x12, 0xff, 0x0c, 0x92, 0x6b, 0x6d, 0xfc, 0x72, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9b, 0xff, 0x97, 0xff, 0x76, 0xff, 0x72, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6d, 0xff, 0x76, 0xff, 0x97, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0x6d, 0xf5, 0xb2, 0x5e, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x05, 0xb2, 0x50, 0x6d, 0xe5, 0x4e, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x6d, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x4d, 0xff, 0x72, 0xff, 0x52, 0xff, 0x56, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x7b, 0xff, 0x4d, 0xff, 0x6d, 0xd4, 0xdb, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x1b, 0x6d, 0x97, 0x6d, 0xf2, 0x4d, 0xff, 0x76, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x6e, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x6d, 0xfe, 0x6d, 0xd6, 0x92, 0x4c, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xb6, 0x2f, 0x6d, 0xc4, 0x6d, 0xfd, 0x6d, 0xff, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4d, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x97, 0xff, 0x96, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xb6, 0xff, 0x4e, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x4e, 0xff, 0x6d, 0xff, 0x69, 0xec, 0x92, 0x6f, 0xdb, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xb2, 0x38, 0x6d, 0xd4, 0x6d, 0xfe, 0x6d, 0xff, 0x4d, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x77, 0xff, 0x4d, 0xff, 0x96, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbb, 0xff, 0x96, 0xff, 0x4d, 0xff, 0x6e, 0xff, 0x96, 0xff, 0xbb, 0xff, 0x9b, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9b, 0xff, 0x72, 0xff, 0x6d, 0xff, 0x4d, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x4d, 0xff, 0x69, 0xff, 0x6d, 0xf5, 0x6e, 0x86, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xb6, 0x36, 0x6d, 0xd8, 0x6d, 0xff, 0x92, 0xff, 0x49, 0xff, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x52, 0xff, 0x6e, 0xff, 0x96, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbb, 0xff, 0xbf, 0xff, 0xbb, 0xff, 0x92, 0xff, 0x4e, 0xff, 0x96, 0xff, 0x96, 0xff, 0x4e, 0xff, 0x72, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x4d, 0xff, 0x72, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x4d, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x6d, 0xf7, 0x92, 0x86, 0xd7, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x28, 0x6d, 0xce, 0x4d, 0xff, 0x96, 0xff, 0x72, 0xff, 0x4d, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x57, 0xff, 0x56, 0xff, 0x9b, 0xff, 0x97, 0xff, 0x4d, 0xff, 0x72, 0xff, 0xb7, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0x96, 0xff, 0x72, 0xff, 0x72, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x97, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbb, 0xff, 0x96, 0xff, 0x4d, 0xff, 0x97, 0xff, 0x77, 0xff, 0x52, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x76, 0xff, 0x4d, 0xff, 0x97, 0xff, 0x96, 0xff, 0x6d, 0xf7, 0x8e, 0x80, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x10, 0x6d, 0xb0, 0x4d, 0xfe, 0x76, 0xff, 0xbb, 0xff, 0x4d, 0xff, 0x4e, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x52, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6e, 0xff, 0x76, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x72, 0xff, 0x4d, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x92, 0xff, 0x96, 0xff, 0x96, 0xff, 0x72, 0xff, 0x4d, 0xff, 0x77, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x5b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4e, 0xff, 0x72, 0xff, 0xbf, 0xff, 0x72, 0xff, 0x4d, 0xf2, 0x92, 0x67, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x05, 0x8e, 0x83, 0x4d, 0xfa, 0x52, 0xff, 0x9f, 0xff, 0x97, 0xff, 0x2d, 0xff, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x76, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0x92, 0xff, 0x72, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x72, 0xff, 0x6d, 0xf9, 0x6e, 0xc8, 0x6e, 0xb7, 0x6e, 0xa3, 0x92, 0xa3, 0x4d, 0xfb, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x4d, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x4e, 0xff, 0x4d, 0xe4, 0xb6, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x44, 0x6d, 0xec, 0x52, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x2d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x77, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x76, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x97, 0xff, 0x6e, 0xe6, 0xdb, 0x20, 0xff, 0x04, 0xff, 0x03, 0x92, 0x39, 0x4d, 0xf6, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4d, 0xff, 0x76, 0xff, 0x9f, 0xff, 0x7b, 0xff, 0x4d, 0xfe, 0x6d, 0xaf, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x0c, 0x6e, 0xb8, 0x4d, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x4e, 0xff, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x72, 0xe9, 0xb7, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x50, 0x52, 0xf9, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x4d, 0xff, 0x52, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x4d, 0xf7, 0x92, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x4d, 0x6d, 0xf5, 0x72, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0x76, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4d, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xef, 0x92, 0x2b, 0x00, 0x00, 0xff, 0x01, 0x6e, 0x77, 0x72, 0xfc, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x52, 0xff, 0x4e, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0x6d, 0xc8, 0xdb, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0x6d, 0xb3, 0x4d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x4d, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xf8, 0x92, 0x4f, 0x00, 0x00, 0xff, 0x01, 0x6d, 0x8d, 0x77, 0xfe, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x76, 0xff, 0x4d, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x4d, 0xf3, 0x92, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x2c, 0x69, 0xe9, 0x72, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x4d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x4e, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x76, 0xfc, 0x92, 0x65, 0x00, 0x00, 0xdb, 0x0d, 0x4d, 0xc4, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4d, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4d, 0xfd, 0x92, 0x89, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x2e, 0xdb, 0x19, 0x00, 0x00, 
-  0x00, 0x00, 0xff, 0x01, 0xb6, 0x26, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x4e, 0x49, 0xfa, 0x76, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x52, 0xff, 0x4e, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x77, 0xff, 0x92, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x76, 0xfe, 0x92, 0x79, 0x00, 0x00, 0x92, 0x3f, 0x4e, 0xf2, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4e, 0xff, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x52, 0xff, 0x6e, 0xb7, 0xd6, 0x08, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x52, 0xb2, 0x6c, 0xff, 0x01, 
-  0x00, 0x00, 0xfb, 0x0e, 0x8e, 0x8d, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x66, 0x4d, 0xfc, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x52, 0xff, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x72, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x92, 0xa2, 0xff, 0x0d, 0x6d, 0xa7, 0x76, 0xfe, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x4e, 0xff, 0x76, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x76, 0xff, 0x6d, 0xdc, 0xb6, 0x18, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x28, 0x92, 0xa1, 0xdb, 0x0a, 
-  0x00, 0x00, 0xb2, 0x3c, 0x8e, 0xa5, 0xff, 0x03, 0x00, 0x00, 0xff, 0x01, 0x6e, 0x77, 0x4d, 0xfd, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4d, 0xff, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x72, 0xff, 0xb6, 0xff, 0x72, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x72, 0xd8, 0xb6, 0x6f, 0x4d, 0xf3, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x4e, 0xff, 0x52, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x76, 0xff, 0x6d, 0xe5, 0xb6, 0x21, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x18, 0x92, 0xbf, 0xdb, 0x22, 
-  0x00, 0x00, 0x92, 0x70, 0x92, 0xa6, 0xff, 0x01, 0x00, 0x00, 0xff, 0x01, 0x6e, 0x77, 0x4d, 0xfd, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4d, 0xff, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x4d, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4e, 0xfd, 0x6e, 0xf8, 0x76, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x4e, 0xff, 0x52, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x76, 0xff, 0x6d, 0xe7, 0xb6, 0x23, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x12, 0x8e, 0xc8, 0xb6, 0x3b, 
-  0x00, 0x00, 0x92, 0x89, 0x92, 0xa7, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x59, 0x4d, 0xfb, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4d, 0xff, 0x4e, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x77, 0xff, 0x76, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x4e, 0xff, 0x52, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x6d, 0xe1, 0xb6, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x12, 0x8e, 0xcd, 0xb6, 0x48, 
-  0x00, 0x00, 0x92, 0x85, 0x92, 0xaf, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x40, 0x6d, 0xf5, 0x76, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4e, 0xff, 0x52, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x52, 0xff, 0x6d, 0xc5, 0xb6, 0x0d, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x18, 0x8e, 0xd2, 0xb6, 0x3f, 
-  0x00, 0x00, 0xb2, 0x6d, 0x92, 0xbe, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x92, 0x1a, 0x6d, 0xdd, 0x72, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x4e, 0xff, 0x4d, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4e, 0xff, 0x76, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x4d, 0xfe, 0x6d, 0x9e, 0xf7, 0x03, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x24, 0x8e, 0xd5, 0xb7, 0x2a, 
-  0x00, 0x00, 0xb2, 0x44, 0x92, 0xcf, 0xd7, 0x15, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x6d, 0xa2, 0x6d, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x52, 0xff, 0x4d, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x77, 0xff, 0x4e, 0xff, 0x76, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x72, 0xff, 0x49, 0xf7, 0x8e, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x57, 0x92, 0xbf, 0xdb, 0x0f, 
-  0x00, 0x00, 0xd6, 0x18, 0x92, 0xcb, 0xb6, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x42, 0x6d, 0xef, 0x72, 0xff, 0x77, 0xff, 0x77, 0xff, 0x72, 0xff, 0x4d, 0xff, 0x76, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x77, 0xff, 0x9b, 0xff, 0x97, 0xff, 0x4d, 0xff, 0x6d, 0xd1, 0xb6, 0x18, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x92, 0x91, 0x92, 0x87, 0xff, 0x02, 
-  0x00, 0x00, 0xff, 0x01, 0xb2, 0x87, 0x92, 0x89, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x6d, 0x91, 0x6d, 0xfb, 0x72, 0xff, 0x97, 0xff, 0x72, 0xff, 0x4d, 0xff, 0x52, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x52, 0xff, 0x4e, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x72, 0xff, 0x4d, 0xee, 0x8e, 0x58, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x1e, 0x6d, 0xc2, 0xb6, 0x32, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xb6, 0x20, 0x92, 0xb1, 0xb6, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x13, 0x6d, 0x9b, 0x6d, 0xf6, 0x6e, 0xff, 0x92, 0xff, 0x6d, 0xff, 0x4e, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x77, 0xff, 0x4d, 0xff, 0x6e, 0xff, 0x96, 0xff, 0x6e, 0xff, 0x6d, 0xf0, 0x92, 0x67, 0xdb, 0x05, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x6e, 0x75, 0x92, 0x7f, 0xff, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x92, 0x5a, 0x92, 0x78, 0xdb, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x0b, 0x6d, 0x6c, 0x6d, 0xd4, 0x6d, 0xf9, 0x6d, 0xff, 0x4d, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x72, 0xff, 0x4d, 0xff, 0x6d, 0xff, 0x6d, 0xfb, 0x6d, 0xd9, 0x8e, 0x5f, 0xdb, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x20, 0x6e, 0x83, 0xdb, 0x17, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x06, 0x92, 0x5a, 0xb2, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x92, 0x19, 0x8e, 0x61, 0x6d, 0xb9, 0x4d, 0xfb, 0x72, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x4e, 0xff, 0x6d, 0xf8, 0x6d, 0xbc, 0x8e, 0x6b, 0xb6, 0x21, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x0e, 0xbb, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x04, 0x92, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x16, 0x49, 0xbb, 0x4d, 0xfe, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x4d, 0xfd, 0x6d, 0x9b, 0xdb, 0x0e, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x47, 0x6d, 0xed, 0x72, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x77, 0xff, 0x6e, 0xff, 0x6d, 0xdf, 0xb6, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x07, 0x6d, 0xa2, 0x6d, 0xfd, 0x76, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x72, 0xff, 0x4d, 0xfb, 0x6e, 0x81, 0xf7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x31, 0x6d, 0xe3, 0x72, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x77, 0xff, 0x76, 0xff, 0x4d, 0xff, 0x6d, 0xc9, 0xb6, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x03, 0x6e, 0x6f, 0x6d, 0xf5, 0x72, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x4e, 0xff, 0x6d, 0xeb, 0xb6, 0x47, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x0c, 0x6d, 0xa7, 0x4d, 0xfc, 0x72, 0xff, 0x77, 0xff, 0x77, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x77, 0xff, 0x77, 0xff, 0x4e, 0xff, 0x4d, 0xf7, 0x8e, 0x75, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x1d, 0x6d, 0xb5, 0x4d, 0xfc, 0x52, 0xff, 0x77, 0xff, 0x77, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x4e, 0xff, 0x6d, 0xfb, 0x6e, 0x9d, 0xff, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x1d, 0x49, 0xb9, 0x4d, 0xfa, 0x72, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x97, 0xff, 0x6e, 0xff, 0x6d, 0xfb, 0x6d, 0xab, 0xdb, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x18, 0x6d, 0x91, 0x6d, 0xf5, 0x4e, 0xff, 0x76, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x6d, 0xff, 0x6d, 0xf4, 0x8e, 0x96, 0xdb, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x07, 0x6d, 0x73, 0x6d, 0xe4, 0x4d, 0xff, 0x76, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x4d, 0xfe, 0x6d, 0xd8, 0x8e, 0x67, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x8e, 0x64, 0x6d, 0xf8, 0x72, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x4e, 0xff, 0x4d, 0xef, 0x92, 0x40, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x1d, 0x6d, 0xde, 0x72, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x4d, 0xff, 0x6d, 0xc8, 0xb7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x05, 0x6d, 0xb1, 0x6e, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x7b, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x77, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x4d, 0xfd, 0x6e, 0x8b, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x63, 0x6d, 0xf9, 0x76, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x77, 0xff, 0x52, 0xff, 0x4e, 0xff, 0x52, 0xff, 0x96, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbb, 0xff, 0x76, 0xff, 0x52, 0xff, 0x52, 0xff, 0x52, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x72, 0xff, 0x49, 0xf4, 0xb2, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x19, 0x6d, 0xda, 0x72, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x76, 0xff, 0x52, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x6d, 0xff, 0x72, 0xff, 0x92, 0xff, 0x96, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0x96, 0xff, 0x92, 0xff, 0x72, 0xff, 0x6d, 0xff, 0x4d, 0xff, 0x4e, 0xff, 0x72, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0x6d, 0xd3, 0xdb, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x03, 0x6d, 0x8b, 0x4d, 0xfd, 0x9b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x97, 0xff, 0x72, 0xff, 0x6d, 0xfe, 0x6d, 0xea, 0x6d, 0xe2, 0x69, 0xef, 0x6d, 0xf8, 0x6d, 0xfb, 0x6d, 0xfe, 0x6e, 0xff, 0x72, 0xff, 0x92, 0xff, 0x96, 0xff, 0x96, 0xff, 0x97, 0xff, 0xb7, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xfe, 0x69, 0xfa, 0x69, 0xf0, 0x6d, 0xe2, 0x6d, 0xf3, 0x6d, 0xff, 0x72, 0xff, 0x97, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x97, 0xff, 0x49, 0xfd, 0x6e, 0x80, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x33, 0x49, 0xe9, 0x72, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x5f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x97, 0xff, 0x72, 0xff, 0x6d, 0xea, 0xb2, 0x47, 0xb7, 0x19, 0xb2, 0x2e, 0x8e, 0x53, 0x6d, 0x64, 0x6d, 0x7b, 0x6d, 0xa0, 0x6d, 0xb2, 0x6d, 0xbe, 0x6d, 0xc8, 0x6d, 0xd0, 0x6d, 0xd5, 0x6d, 0xd6, 0x6d, 0xd5, 0x6d, 0xd0, 0x6d, 0xc8, 0x69, 0xc1, 0x69, 0xb7, 0x69, 0xa6, 0x69, 0x85, 0x6d, 0x6e, 0x6e, 0x59, 0x92, 0x2f, 0xd7, 0x19, 0x6d, 0x89, 0x69, 0xfd, 0x72, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x6e, 0xff, 0x6d, 0xda, 0xb7, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x03, 0x6d, 0x87, 0x4d, 0xfb, 0x77, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x6e, 0xff, 0x6e, 0xa8, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xfb, 0x05, 0xfb, 0x07, 0xd7, 0x0a, 0xb2, 0x0d, 0x92, 0x10, 0x92, 0x10, 0x92, 0x0f, 0xb6, 0x0c, 0xb7, 0x09, 0xdb, 0x07, 0xff, 0x06, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x27, 0x69, 0xe1, 0x4e, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x6d, 0xf6, 0x92, 0x64, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x15, 0x6d, 0xbe, 0x4e, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x97, 0xff, 0x72, 0xff, 0x6d, 0xe8, 0x92, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x8e, 0x74, 0x6d, 0xf9, 0x72, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x6e, 0xfc, 0x6e, 0xa0, 0xdb, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x37, 0x6d, 0xd9, 0x6e, 0xff, 0x97, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x72, 0xff, 0x6e, 0xf6, 0x8e, 0x7a, 0xdb, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x11, 0x6d, 0xae, 0x6d, 0xfd, 0x72, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x72, 0xff, 0x4d, 0xfc, 0x6d, 0xaf, 0xd7, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x92, 0x3d, 0x6d, 0xc7, 0x6d, 0xfb, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6d, 0xff, 0x6d, 0xeb, 0x8e, 0x82, 0xd7, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x21, 0x6d, 0xb4, 0x6d, 0xfa, 0x4d, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x4d, 0xff, 0x6d, 0xef, 0x6e, 0x97, 0xb2, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x17, 0x8e, 0x6b, 0x6d, 0xc1, 0x6d, 0xda, 0x6d, 0xd4, 0x6d, 0x9e, 0x92, 0x3c, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x13, 0x8e, 0x6a, 0x6d, 0xbd, 0x69, 0xd6, 0x69, 0xcf, 0x6d, 0x98, 0x92, 0x3d, 0xd7, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x08, 0xd7, 0x10, 0xdb, 0x0d, 0xfb, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0xd7, 0x0e, 0xdb, 0x0b, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0xff, 0xff, 0x04, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x04, 0xd7, 0xd5, 0x16, 0x72, 0x9c, 0x3e, 0xcf, 0x83, 0x60, 0xcf, 0x83, 0x74, 0xae, 0x7b, 0x90, 0x6d, 0x73, 0xa1, 0x6d, 0x6b, 0xa9, 0x4c, 0x73, 0xa7, 0x6d, 0x73, 0x94, 0xae, 0x7b, 0x6e, 0xaf, 0x7b, 0x59, 0x71, 0x9c, 0x39, 0xd7, 0xc5, 0x15, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xde, 0x07, 0x95, 0xbd, 0x27, 0xef, 0x8b, 0x75, 0xaa, 0x5a, 0xba, 0x48, 0x4a, 0xe1, 0x69, 0x4a, 0xf0, 0x8a, 0x4a, 0xfb, 0xaa, 0x42, 0xfd, 0xca, 0x42, 0xfe, 0x0b, 0x4b, 0xfe, 0x2b, 0x4b, 0xfe, 0x2b, 0x4b, 0xfe, 0x0b, 0x4b, 0xfe, 0xeb, 0x4a, 0xfc, 0xcb, 0x52, 0xf8, 0xaa, 0x52, 0xee, 0x69, 0x4a, 0xde, 0x89, 0x5a, 0xba, 0x4d, 0x73, 0x7a, 0x51, 0x94, 0x34, 0x18, 0xc6, 0x0c, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xde, 0x0e, 0x31, 0x94, 0x4d, 0x6d, 0x7b, 0xa8, 0xaa, 0x62, 0xe8, 0x8a, 0x52, 0xfc, 0x8a, 0x4a, 0xff, 0x4c, 0x4b, 0xff, 0x50, 0x5c, 0xff, 0x13, 0x6d, 0xff, 0xd6, 0x6d, 0xff, 0x38, 0x76, 0xff, 0x58, 0x76, 0xff, 0x99, 0x7e, 0xff, 0x99, 0x7e, 0xff, 0x99, 0x7e, 0xff, 0x38, 0x7e, 0xff, 0x95, 0x75, 0xff, 0xb2, 0x5c, 0xff, 0xce, 0x53, 0xff, 0xcb, 0x4a, 0xff, 0x8a, 0x52, 0xfc, 0xaa, 0x5a, 0xee, 0x0c, 0x6b, 0xb9, 0xaf, 0x83, 0x67, 0x72, 0xa4, 0x1d, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xd6, 0x0a, 0x30, 0x94, 0x50, 0x2c, 0x73, 0xbc, 0xeb, 0x62, 0xf5, 0x0b, 0x53, 0xff, 0xae, 0x53, 0xff, 0x14, 0x6d, 0xff, 0x38, 0x7e, 0xff, 0xba, 0x7e, 0xff, 0xfb, 0x76, 0xff, 0x1b, 0x6f, 0xff, 0x1c, 0x67, 0xff, 0x1c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x3b, 0x67, 0xff, 0x3b, 0x6f, 0xff, 0x1b, 0x77, 0xff, 0xfb, 0x86, 0xff, 0x79, 0x7e, 0xff, 0xb6, 0x75, 0xff, 0x71, 0x64, 0xff, 0x4c, 0x53, 0xff, 0xeb, 0x5a, 0xf9, 0xcb, 0x62, 0xd6, 0x4d, 0x7b, 0x77, 0xb7, 0xc5, 0x18, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x51, 0x94, 0x37, 0x0b, 0x6b, 0xad, 0xca, 0x5a, 0xf3, 0x2c, 0x4b, 0xff, 0x30, 0x54, 0xff, 0xd6, 0x75, 0xff, 0xda, 0x86, 0xff, 0x1b, 0x7f, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0x3b, 0x77, 0xff, 0x3b, 0x7f, 0xff, 0x99, 0x7e, 0xff, 0x33, 0x65, 0xff, 0x8d, 0x4b, 0xff, 0xcb, 0x4a, 0xf9, 0xcb, 0x5a, 0xc7, 0xef, 0x8b, 0x4f, 0x7a, 0xd6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x08, 0x8e, 0x7b, 0x6c, 0x89, 0x52, 0xe2, 0xa9, 0x4a, 0xfe, 0x50, 0x5c, 0xff, 0x17, 0x76, 0xff, 0xfb, 0x86, 0xff, 0x1b, 0x87, 0xff, 0x1c, 0x87, 0xff, 0x3c, 0x7f, 0xff, 0x3c, 0x77, 0xff, 0x3c, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x7c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3b, 0x6f, 0xff, 0x3b, 0x77, 0xff, 0xb9, 0x76, 0xff, 0x34, 0x65, 0xff, 0x0c, 0x4b, 0xff, 0x8a, 0x52, 0xf0, 0x4c, 0x6b, 0x88, 0x74, 0xad, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xcd, 0x12, 0xcb, 0x62, 0x90, 0x89, 0x4a, 0xf4, 0x4d, 0x4b, 0xff, 0xd7, 0x6d, 0xff, 0xfa, 0x76, 0xff, 0xfb, 0x6e, 0xff, 0x3b, 0x7f, 0xff, 0x5c, 0x8f, 0xff, 0xbd, 0x9f, 0xff, 0xde, 0xa7, 0xff, 0xbe, 0x9f, 0xff, 0x3c, 0x7f, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x57, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x3d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x1b, 0x77, 0xff, 0x58, 0x7e, 0xff, 0xf0, 0x53, 0xff, 0x8a, 0x4a, 0xfa, 0xaa, 0x5a, 0xb5, 0x14, 0xad, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xbd, 0x16, 0x0c, 0x6b, 0xa3, 0xaa, 0x4a, 0xfa, 0xcf, 0x53, 0xff, 0x59, 0x7e, 0xff, 0x1c, 0x6f, 0xff, 0x1c, 0x67, 0xff, 0x7c, 0x7f, 0xff, 0xbd, 0x97, 0xff, 0xbd, 0xa7, 0xff, 0xbd, 0xaf, 0xff, 0xbd, 0xaf, 0xff, 0xbd, 0xaf, 0xff, 0xbd, 0x97, 0xff, 0x5c, 0x77, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1c, 0x6f, 0xff, 0xba, 0x86, 0xff, 0xb2, 0x64, 0xff, 0xca, 0x42, 0xfe, 0x8a, 0x52, 0xcf, 0x31, 0x94, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xd6, 0x10, 0x0c, 0x63, 0xa2, 0xaa, 0x4a, 0xfc, 0x31, 0x54, 0xff, 0xba, 0x7e, 0xff, 0x1c, 0x6f, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x77, 0xff, 0xbd, 0x97, 0xff, 0x9c, 0x9f, 0xff, 0x9c, 0xa7, 0xff, 0x9c, 0xaf, 0xff, 0x9c, 0xa7, 0xff, 0xbd, 0xa7, 0xff, 0xbd, 0x97, 0xff, 0x7d, 0x87, 0xff, 0xdf, 0x87, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x6f, 0xff, 0xfb, 0x86, 0xff, 0x54, 0x75, 0xff, 0xeb, 0x42, 0xfe, 0xaa, 0x52, 0xd5, 0x71, 0x94, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x09, 0x0c, 0x6b, 0x8a, 0xaa, 0x4a, 0xf9, 0x30, 0x54, 0xff, 0xba, 0x7e, 0xff, 0x3c, 0x6f, 0xff, 0x3c, 0x67, 0xff, 0x1b, 0x67, 0xff, 0xbd, 0x8f, 0xff, 0x9d, 0xa7, 0xff, 0x9c, 0xa7, 0xff, 0x9c, 0xa7, 0xff, 0xbc, 0xa7, 0xff, 0xbc, 0x9f, 0xff, 0xbd, 0x8f, 0xff, 0x5b, 0x77, 0xff, 0x3c, 0x6f, 0xff, 0x7d, 0x6f, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x6f, 0xff, 0x1b, 0x87, 0xff, 0x75, 0x6d, 0xff, 0xcb, 0x4a, 0xff, 0xaa, 0x5a, 0xcf, 0xf4, 0xac, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0xcf, 0x83, 0x6b, 0xaa, 0x52, 0xf5, 0xcf, 0x53, 0xff, 0xba, 0x7e, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3b, 0x67, 0xff, 0xdd, 0x97, 0xff, 0xbd, 0x9f, 0xff, 0x9d, 0xa7, 0xff, 0xbd, 0x9f, 0xff, 0xbd, 0x97, 0xff, 0xbd, 0x8f, 0xff, 0x3c, 0x77, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x6f, 0xff, 0x1b, 0x7f, 0xff, 0x54, 0x75, 0xff, 0xcb, 0x52, 0xfd, 0xeb, 0x62, 0xae, 0x35, 0xad, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x94, 0x3d, 0xec, 0x5a, 0xe5, 0x8e, 0x53, 0xff, 0x99, 0x7e, 0xff, 0x5c, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x7c, 0x77, 0xff, 0xbd, 0x8f, 0xff, 0xbd, 0x8f, 0xff, 0xbd, 0x87, 0xff, 0x7c, 0x7f, 0xff, 0x3b, 0x6f, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x1c, 0x6f, 0xff, 0xfb, 0x86, 0xff, 0xd2, 0x64, 0xff, 0x0b, 0x53, 0xf8, 0x2c, 0x6b, 0x80, 0x18, 0xc6, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xbd, 0x15, 0xcb, 0x5a, 0xc9, 0x4d, 0x4b, 0xff, 0x17, 0x7e, 0xff, 0x3b, 0x77, 0xff, 0x7d, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x1b, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0xfa, 0x86, 0xff, 0xcf, 0x53, 0xff, 0x8a, 0x52, 0xed, 0x10, 0x8c, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xfe, 0x05, 0x8e, 0x7b, 0x81, 0x2c, 0x53, 0xfa, 0x54, 0x6d, 0xff, 0x3b, 0x7f, 0xff, 0x7c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1b, 0x6f, 0xff, 0x17, 0x7e, 0xff, 0xcb, 0x4a, 0xff, 0x8a, 0x5a, 0xb9, 0x59, 0xce, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x3c, 0xab, 0x52, 0xe8, 0x30, 0x54, 0xff, 0x1b, 0x7f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0xfa, 0x7e, 0xff, 0x50, 0x54, 0xff, 0x89, 0x4a, 0xf7, 0x8e, 0x73, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xee, 0x0a, 0xcb, 0x5a, 0xae, 0xeb, 0x42, 0xfe, 0x38, 0x7e, 0xff, 0x1b, 0x6f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x67, 0xff, 0x37, 0x76, 0xff, 0xcb, 0x42, 0xff, 0x8a, 0x5a, 0xd0, 0x34, 0xa5, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x8c, 0x4d, 0x8a, 0x52, 0xf3, 0xb2, 0x5c, 0xff, 0xfb, 0x76, 0xff, 0x3c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x57, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x57, 0xff, 0x5c, 0x57, 0xff, 0x3c, 0x5f, 0xff, 0x3b, 0x5f, 0xff, 0x1b, 0x7f, 0xff, 0x92, 0x64, 0xff, 0xaa, 0x52, 0xfa, 0xef, 0x83, 0x6c, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x0e, 0xeb, 0x62, 0xb9, 0xeb, 0x42, 0xff, 0x58, 0x76, 0xff, 0x3b, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x57, 0xff, 0x7d, 0x57, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x57, 0xff, 0x5c, 0x57, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x6f, 0xff, 0x79, 0x86, 0xff, 0x4c, 0x53, 0xff, 0x0b, 0x63, 0xd3, 0x76, 0xbd, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x8b, 0x52, 0x69, 0x42, 0xf6, 0xb2, 0x54, 0xff, 0x1c, 0x77, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x57, 0xff, 0x5d, 0x57, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x7c, 0x67, 0xff, 0x3b, 0x7f, 0xff, 0x33, 0x6d, 0xff, 0xeb, 0x52, 0xfa, 0x6e, 0x7b, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xde, 0x0c, 0xec, 0x6a, 0xb9, 0xcb, 0x42, 0xff, 0x78, 0x76, 0xff, 0x1c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x7c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x3b, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x3b, 0x6f, 0xff, 0x98, 0x7e, 0xff, 0x0b, 0x4b, 0xff, 0xcb, 0x62, 0xc9, 0xf9, 0xde, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x9c, 0x47, 0xcb, 0x5a, 0xf4, 0x51, 0x54, 0xff, 0xfb, 0x76, 0xff, 0x3d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x67, 0xff, 0x79, 0x66, 0xff, 0xb6, 0x65, 0xff, 0x58, 0x76, 0xff, 0xdb, 0x86, 0xff, 0x1b, 0x77, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x57, 0xff, 0x7c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x3b, 0x6f, 0xff, 0xfa, 0x76, 0xff, 0x99, 0x76, 0xff, 0x37, 0x66, 0xff, 0xb9, 0x66, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x67, 0xff, 0xfa, 0x76, 0xff, 0x91, 0x5c, 0xff, 0xca, 0x52, 0xf5, 0x50, 0x94, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x07, 0x0c, 0x63, 0xb3, 0xeb, 0x4a, 0xff, 0xf7, 0x75, 0xff, 0x1c, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x1b, 0x77, 0xff, 0x33, 0x65, 0xff, 0xeb, 0x42, 0xff, 0xaa, 0x42, 0xff, 0x6d, 0x4b, 0xff, 0x54, 0x6d, 0xff, 0xda, 0x7e, 0xff, 0x3b, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x3b, 0x6f, 0xff, 0xfa, 0x86, 0xff, 0xb5, 0x75, 0xff, 0x0f, 0x54, 0xff, 0xeb, 0x3a, 0xff, 0x8d, 0x4b, 0xff, 0xb5, 0x6d, 0xff, 0x1b, 0x77, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x6f, 0xff, 0x17, 0x7e, 0xff, 0x0b, 0x4b, 0xfe, 0x4c, 0x6b, 0xaf, 0x18, 0xc6, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x94, 0x41, 0xeb, 0x5a, 0xf1, 0xef, 0x53, 0xff, 0xdb, 0x86, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x7b, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x79, 0x76, 0xff, 0x91, 0x6c, 0xff, 0xeb, 0x5a, 0xff, 0xa9, 0x62, 0xff, 0xa9, 0x62, 0xff, 0xca, 0x52, 0xff, 0x30, 0x54, 0xff, 0xba, 0x86, 0xff, 0x3c, 0x6f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0xb9, 0x76, 0xff, 0x50, 0x54, 0xff, 0xca, 0x4a, 0xff, 0x89, 0x52, 0xff, 0x69, 0x5a, 0xff, 0x4d, 0x63, 0xff, 0x71, 0x5c, 0xff, 0x78, 0x6e, 0xff, 0x5c, 0x6f, 0xff, 0x7d, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0xda, 0x86, 0xff, 0x50, 0x5c, 0xff, 0xeb, 0x5a, 0xee, 0xb2, 0xa4, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xbd, 0x18, 0xf3, 0xac, 0x51, 0xd3, 0xa4, 0x53, 0xf4, 0xac, 0x46, 0x96, 0xc5, 0x2a, 0x3c, 0xe7, 0x09, 0xfb, 0xff, 0x07, 0xad, 0x7b, 0xa4, 0x0b, 0x53, 0xfe, 0x95, 0x75, 0xff, 0x3c, 0x7f, 0xff, 0x3d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1b, 0x6f, 0xff, 0x34, 0x55, 0xff, 0x0b, 0x33, 0xff, 0xeb, 0x4a, 0xff, 0xaa, 0x4a, 0xff, 0x89, 0x52, 0xff, 0x89, 0x5a, 0xff, 0xaa, 0x52, 0xff, 0x30, 0x54, 0xff, 0x1b, 0x7f, 0xff, 0x5c, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0xda, 0x76, 0xff, 0xee, 0x43, 0xff, 0xc9, 0x4a, 0xff, 0xa9, 0x52, 0xff, 0x89, 0x52, 0xff, 0xaa, 0x4a, 0xff, 0x0c, 0x4b, 0xff, 0x4d, 0x3b, 0xff, 0x34, 0x55, 0xff, 0x3c, 0x77, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0x1b, 0x7f, 0xff, 0xb6, 0x85, 0xff, 0xca, 0x52, 0xfe, 0x6d, 0x73, 0x98, 0x91, 0x9c, 0x37, 0xf2, 0xa4, 0x49, 0x14, 0xad, 0x3c, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x8b, 0x37, 0xeb, 0x6a, 0x9b, 0xcb, 0x62, 0xb6, 0xca, 0x6a, 0xd8, 0xcb, 0x6a, 0xda, 0x2d, 0x73, 0xaa, 0x30, 0x94, 0x80, 0xeb, 0x62, 0xf0, 0x4d, 0x5b, 0xff, 0xba, 0x8e, 0xff, 0x3b, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x3d, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x3b, 0x6f, 0xff, 0xda, 0x76, 0xff, 0x58, 0x7e, 0xff, 0x38, 0x7e, 0xff, 0x18, 0x7e, 0xff, 0xb6, 0x75, 0xff, 0xb2, 0x64, 0xff, 0x6d, 0x4b, 0xff, 0x2c, 0x33, 0xff, 0x17, 0x5e, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0x1b, 0x77, 0xff, 0x1b, 0x7f, 0xff, 0x1b, 0x7f, 0xff, 0x1b, 0x7f, 0xff, 0x5c, 0x77, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x6f, 0xff, 0xd7, 0x65, 0xff, 0x2c, 0x33, 0xff, 0x0b, 0x43, 0xff, 0x30, 0x5c, 0xff, 0x95, 0x75, 0xff, 0x38, 0x7e, 0xff, 0x79, 0x7e, 0xff, 0x99, 0x7e, 0xff, 0xda, 0x76, 0xff, 0x1b, 0x6f, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x6f, 0xff, 0x1b, 0x77, 0xff, 0x99, 0x76, 0xff, 0xb5, 0x6d, 0xff, 0x50, 0x64, 0xff, 0x8a, 0x52, 0xff, 0x69, 0x5a, 0xfb, 0xaa, 0x62, 0xc8, 0xca, 0x62, 0xa1, 0x2c, 0x63, 0x85, 0x9a, 0xd6, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x18, 0xc6, 0x04, 0x75, 0xad, 0x09, 0x74, 0xbd, 0x19, 0xb2, 0xac, 0x2d, 0xef, 0x93, 0x6b, 0xca, 0x6a, 0xeb, 0xcb, 0x5a, 0xff, 0xae, 0x53, 0xff, 0xba, 0x86, 0xff, 0x5c, 0x6f, 0xff, 0x5c, 0x6f, 0xff, 0x1b, 0x77, 0xff, 0x1b, 0x87, 0xff, 0x1a, 0x87, 0xff, 0x1a, 0x87, 0xff, 0x1a, 0x7f, 0xff, 0xfa, 0x7e, 0xff, 0xfa, 0x76, 0xff, 0xfb, 0x6e, 0xff, 0xfc, 0x6e, 0xff, 0x1c, 0x6f, 0xff, 0xfb, 0x76, 0xff, 0xba, 0x7e, 0xff, 0x95, 0x5d, 0xff, 0xda, 0x6e, 0xff, 0x1b, 0x6f, 0xff, 0x1b, 0x6f, 0xff, 0xfb, 0x76, 0xff, 0xba, 0x86, 0xff, 0x54, 0x65, 0xff, 0x51, 0x54, 0xff, 0xef, 0x53, 0xff, 0xee, 0x53, 0xff, 0x0f, 0x54, 0xff, 0x13, 0x65, 0xff, 0xba, 0x86, 0xff, 0x1b, 0x7f, 0xff, 0x1b, 0x77, 0xff, 0x3c, 0x6f, 0xff, 0x3c, 0x6f, 0xff, 0x3c, 0x6f, 0xff, 0xfb, 0x7e, 0xff, 0x54, 0x5d, 0xff, 0x38, 0x7e, 0xff, 0xfb, 0x86, 0xff, 0x1c, 0x7f, 0xff, 0x1c, 0x6f, 0xff, 0x1b, 0x77, 0xff, 0x1a, 0x7f, 0xff, 0xfa, 0x7e, 0xff, 0xfb, 0x86, 0xff, 0xfb, 0x86, 0xff, 0xfb, 0x7e, 0xff, 0x1b, 0x77, 0xff, 0x3b, 0x6f, 0xff, 0x5c, 0x6f, 0xff, 0x3c, 0x77, 0xff, 0x55, 0x55, 0xff, 0xae, 0x2b, 0xff, 0xce, 0x33, 0xff, 0xd2, 0x6c, 0xff, 0xef, 0x6b, 0xff, 0x8a, 0x5a, 0xfe, 0x30, 0x94, 0x84, 0xfb, 0xde, 0x07, 0x18, 0xc6, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0xac, 0x3e, 0x89, 0x5a, 0xf2, 0x4c, 0x5b, 0xff, 0xf3, 0x6c, 0xff, 0x17, 0x66, 0xff, 0x3b, 0x6f, 0xff, 0x3b, 0x7f, 0xff, 0x1a, 0x8f, 0xff, 0xfa, 0xa6, 0xff, 0xd9, 0xae, 0xff, 0xd9, 0xae, 0xff, 0xd9, 0xa6, 0xff, 0xfa, 0x9e, 0xff, 0x1a, 0x87, 0xff, 0x3c, 0x77, 0xff, 0x3d, 0x67, 0xff, 0x3d, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x1b, 0x6f, 0xff, 0x1b, 0x77, 0xff, 0xda, 0x7e, 0xff, 0x58, 0x7e, 0xff, 0xb5, 0x6d, 0xff, 0x34, 0x6d, 0xff, 0xef, 0x5b, 0xff, 0xeb, 0x52, 0xff, 0xaa, 0x5a, 0xff, 0xaa, 0x62, 0xff, 0xaa, 0x62, 0xff, 0xcb, 0x62, 0xff, 0xca, 0x52, 0xff, 0x4c, 0x4b, 0xff, 0x8d, 0x43, 0xff, 0x71, 0x5c, 0xff, 0x75, 0x6d, 0xff, 0x58, 0x76, 0xff, 0xfa, 0x7e, 0xff, 0x1b, 0x7f, 0xff, 0x3c, 0x7f, 0xff, 0x1c, 0x77, 0xff, 0x5d, 0x6f, 0xff, 0x3d, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0x1b, 0x7f, 0xff, 0x1a, 0x97, 0xff, 0xd9, 0xa6, 0xff, 0xd9, 0xae, 0xff, 0xd9, 0xa6, 0xff, 0xf9, 0xa6, 0xff, 0x1a, 0x97, 0xff, 0x1b, 0x87, 0xff, 0x3c, 0x77, 0xff, 0xfb, 0x76, 0xff, 0x75, 0x4d, 0xff, 0xf7, 0x65, 0xff, 0xba, 0x76, 0xff, 0xda, 0x86, 0xff, 0x18, 0x8e, 0xff, 0x0c, 0x53, 0xff, 0xeb, 0x6a, 0xd5, 0xb5, 0xc5, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xde, 0x0e, 0x2b, 0x6b, 0xb7, 0xca, 0x52, 0xff, 0xf3, 0x7c, 0xff, 0xba, 0x8e, 0xff, 0x1b, 0x77, 0xff, 0x1a, 0x6f, 0xff, 0xfa, 0x86, 0xff, 0xf8, 0xa6, 0xff, 0xb8, 0xc6, 0xff, 0x98, 0xce, 0xff, 0x97, 0xce, 0xff, 0x98, 0xce, 0xff, 0xb9, 0xb6, 0xff, 0xda, 0x9e, 0xff, 0x1b, 0x7f, 0xff, 0x3c, 0x67, 0xff, 0x3d, 0x5f, 0xff, 0x1c, 0x67, 0xff, 0xdb, 0x7e, 0xff, 0x96, 0x6d, 0xff, 0xcf, 0x53, 0xff, 0xca, 0x3a, 0xff, 0xad, 0x63, 0xff, 0x12, 0x95, 0xff, 0x53, 0xa5, 0xff, 0x89, 0x52, 0xff, 0x68, 0x5a, 0xff, 0x68, 0x5a, 0xff, 0x69, 0x62, 0xff, 0x89, 0x62, 0xff, 0xca, 0x62, 0xff, 0x73, 0xa5, 0xff, 0xf5, 0xb5, 0xff, 0x53, 0x9d, 0xff, 0xad, 0x63, 0xff, 0xca, 0x3a, 0xff, 0xef, 0x53, 0xff, 0x75, 0x6d, 0xff, 0xba, 0x86, 0xff, 0x1c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x77, 0xff, 0xfa, 0x8e, 0xff, 0xd9, 0xae, 0xff, 0xb8, 0xbe, 0xff, 0xb7, 0xc6, 0xff, 0xb7, 0xbe, 0xff, 0xd8, 0xbe, 0xff, 0xd9, 0xae, 0xff, 0xfb, 0x9e, 0xff, 0xfb, 0x7e, 0xff, 0x1c, 0x6f, 0xff, 0x1c, 0x6f, 0xff, 0xfc, 0x76, 0xff, 0x1c, 0x77, 0xff, 0x1b, 0x77, 0xff, 0x1b, 0x8f, 0xff, 0x91, 0x6c, 0xff, 0x0b, 0x63, 0xfc, 0xce, 0x8b, 0x7e, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x7a, 0xd6, 0x05, 0x76, 0xc5, 0x1c, 0x8d, 0x7b, 0x81, 0x69, 0x52, 0xfb, 0x2b, 0x53, 0xff, 0xb6, 0x85, 0xff, 0xba, 0x76, 0xff, 0x1b, 0x67, 0xff, 0x1a, 0x6f, 0xff, 0xd9, 0x8e, 0xff, 0xb8, 0xb6, 0xff, 0x78, 0xce, 0xff, 0x77, 0xd6, 0xff, 0x96, 0xd6, 0xff, 0x77, 0xde, 0xff, 0x98, 0xc6, 0xff, 0xda, 0xa6, 0xff, 0x1b, 0x8f, 0xff, 0x3b, 0x6f, 0xff, 0x1c, 0x6f, 0xff, 0xba, 0x7e, 0xff, 0x92, 0x5c, 0xff, 0xeb, 0x4a, 0xff, 0xd2, 0x94, 0xff, 0xd9, 0xd6, 0xff, 0x7b, 0xe7, 0xff, 0x9b, 0xe7, 0xff, 0x7b, 0xe7, 0xff, 0x19, 0xdf, 0xff, 0x90, 0x8c, 0xff, 0x0a, 0x63, 0xff, 0xa9, 0x5a, 0xff, 0x90, 0x8c, 0xff, 0x19, 0xd7, 0xff, 0x9b, 0xe7, 0xff, 0x7b, 0xdf, 0xff, 0x9c, 0xe7, 0xff, 0x9c, 0xe7, 0xff, 0xfa, 0xd6, 0xff, 0x33, 0x9d, 0xff, 0x2b, 0x53, 0xff, 0xce, 0x4b, 0xff, 0x38, 0x76, 0xff, 0x1b, 0x77, 0xff, 0x3c, 0x6f, 0xff, 0x1b, 0x7f, 0xff, 0xfa, 0x96, 0xff, 0xd9, 0xb6, 0xff, 0xb8, 0xce, 0xff, 0x97, 0xce, 0xff, 0x97, 0xce, 0xff, 0x97, 0xce, 0xff, 0xb9, 0xbe, 0xff, 0xda, 0x9e, 0xff, 0x1b, 0x87, 0xff, 0x1b, 0x6f, 0xff, 0x1b, 0x67, 0xff, 0x9a, 0x6e, 0xff, 0x7a, 0x76, 0xff, 0x79, 0x76, 0xff, 0xb9, 0x8e, 0xff, 0x17, 0x9e, 0xff, 0x2c, 0x6b, 0xff, 0x0c, 0x73, 0xec, 0x14, 0xad, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xbd, 0x15, 0x10, 0x8c, 0x5e, 0x4d, 0x7b, 0xa7, 0xca, 0x6a, 0xde, 0x89, 0x5a, 0xfb, 0xaa, 0x52, 0xff, 0x2c, 0x43, 0xff, 0xf0, 0x3b, 0xff, 0xf8, 0x55, 0xff, 0x3b, 0x5f, 0xff, 0x1a, 0x6f, 0xff, 0xd9, 0x8e, 0xff, 0xb8, 0xb6, 0xff, 0x98, 0xce, 0xff, 0x77, 0xd6, 0xff, 0x96, 0xd6, 0xff, 0x97, 0xd6, 0xff, 0xb8, 0xc6, 0xff, 0xda, 0xae, 0xff, 0x1b, 0x8f, 0xff, 0x3b, 0x7f, 0xff, 0xdb, 0x86, 0xff, 0x51, 0x5c, 0xff, 0x2b, 0x53, 0xff, 0x57, 0xc6, 0xff, 0x7b, 0xe7, 0xff, 0x7a, 0xdf, 0xff, 0x7a, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x7a, 0xdf, 0xff, 0x7b, 0xdf, 0xff, 0x7b, 0xe7, 0xff, 0x1a, 0xd7, 0xff, 0xb8, 0xce, 0xff, 0x7b, 0xdf, 0xff, 0x7b, 0xdf, 0xff, 0x7b, 0xdf, 0xff, 0x7b, 0xdf, 0xff, 0x7b, 0xdf, 0xff, 0x7a, 0xdf, 0xff, 0x7b, 0xdf, 0xff, 0x9b, 0xe7, 0xff, 0xd8, 0xce, 0xff, 0x0e, 0x74, 0xff, 0xae, 0x53, 0xff, 0x59, 0x86, 0xff, 0x1b, 0x7f, 0xff, 0x1b, 0x7f, 0xff, 0xfa, 0x96, 0xff, 0xd9, 0xb6, 0xff, 0x98, 0xce, 0xff, 0x77, 0xd6, 0xff, 0x77, 0xd6, 0xff, 0x98, 0xce, 0xff, 0xb9, 0xbe, 0xff, 0xfa, 0x9e, 0xff, 0x1b, 0x7f, 0xff, 0x3b, 0x6f, 0xff, 0xfb, 0x66, 0xff, 0x50, 0x34, 0xff, 0x8e, 0x2b, 0xff, 0x6d, 0x33, 0xff, 0x6c, 0x33, 0xff, 0x8d, 0x53, 0xff, 0xeb, 0x5a, 0xff, 0x0c, 0x6b, 0xff, 0x0c, 0x73, 0xcb, 0xb6, 0xc5, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xde, 0x06, 0xcb, 0x62, 0x94, 0xeb, 0x62, 0xbc, 0xef, 0x8b, 0x9c, 0xca, 0x6a, 0xf8, 0x0b, 0x5b, 0xff, 0x13, 0x75, 0xff, 0x9a, 0x8e, 0xff, 0xdb, 0x76, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x5f, 0xff, 0x1b, 0x67, 0xff, 0x1a, 0x7f, 0xff, 0xd9, 0x9e, 0xff, 0xb8, 0xbe, 0xff, 0x78, 0xce, 0xff, 0x97, 0xce, 0xff, 0xb8, 0xbe, 0xff, 0xd9, 0xbe, 0xff, 0xda, 0xae, 0xff, 0xfb, 0x96, 0xff, 0x1a, 0x8f, 0xff, 0x75, 0x75, 0xff, 0x2c, 0x5b, 0xff, 0x78, 0xce, 0xff, 0x9b, 0xe7, 0xff, 0x7a, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x9a, 0xd7, 0xff, 0x7a, 0xcf, 0xff, 0x9a, 0xd7, 0xff, 0x7b, 0xd7, 0xff, 0x7b, 0xd7, 0xff, 0x7b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x9a, 0xd7, 0xff, 0x9b, 0xdf, 0xff, 0x9a, 0xdf, 0xff, 0x9a, 0xdf, 0xff, 0x7a, 0xdf, 0xff, 0x9a, 0xdf, 0xff, 0x9a, 0xdf, 0xff, 0x7a, 0xe7, 0xff, 0x3a, 0xdf, 0xff, 0x0f, 0x7c, 0xff, 0xef, 0x5b, 0xff, 0x99, 0x8e, 0xff, 0xda, 0x86, 0xff, 0xda, 0x8e, 0xff, 0xb9, 0xa6, 0xff, 0x98, 0xb6, 0xff, 0x98, 0xbe, 0xff, 0x98, 0xbe, 0xff, 0xb9, 0xb6, 0xff, 0xd9, 0xa6, 0xff, 0xfa, 0x86, 0xff, 0x1b, 0x6f, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0x1b, 0x77, 0xff, 0xda, 0x7e, 0xff, 0x9a, 0x7e, 0xff, 0x38, 0x7e, 0xff, 0x54, 0x65, 0xff, 0x0f, 0x54, 0xff, 0xca, 0x4a, 0xff, 0xca, 0x62, 0xfd, 0x8d, 0x7b, 0x9d, 0x3c, 0xe7, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x94, 0x12, 0xbb, 0xde, 0x0c, 0xf0, 0x8b, 0x6b, 0x0c, 0x63, 0xfc, 0x30, 0x5c, 0xff, 0xfb, 0x86, 0xff, 0x3c, 0x77, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3b, 0x6f, 0xff, 0xfa, 0x7e, 0xff, 0xf9, 0x96, 0xff, 0xd9, 0xa6, 0xff, 0xd9, 0xa6, 0xff, 0xf9, 0xa6, 0xff, 0xb9, 0x9e, 0xff, 0xf7, 0x8d, 0xff, 0x75, 0x75, 0xff, 0x53, 0x75, 0xff, 0xad, 0x5b, 0xff, 0xee, 0x83, 0xff, 0xb9, 0xd6, 0xff, 0xbc, 0xef, 0xff, 0x9b, 0xdf, 0xff, 0x9a, 0xd7, 0xff, 0x9a, 0xd7, 0xff, 0x9a, 0xd7, 0xff, 0x9a, 0xd7, 0xff, 0x7a, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x7a, 0xcf, 0xff, 0x7b, 0xd7, 0xff, 0x9b, 0xdf, 0xff, 0x7b, 0xdf, 0xff, 0x7a, 0xdf, 0xff, 0x7a, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x7b, 0xe7, 0xff, 0x5b, 0xe7, 0xff, 0x37, 0xc6, 0xff, 0x2c, 0x5b, 0xff, 0x92, 0x6c, 0xff, 0x55, 0x7d, 0xff, 0xd7, 0x7d, 0xff, 0x79, 0x8e, 0xff, 0xb9, 0x96, 0xff, 0xda, 0x9e, 0xff, 0xda, 0x96, 0xff, 0xda, 0x96, 0xff, 0xfb, 0x86, 0xff, 0x3b, 0x77, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x3d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0x3b, 0x6f, 0xff, 0x1b, 0x77, 0xff, 0xda, 0x86, 0xff, 0x38, 0x86, 0xff, 0x2c, 0x4b, 0xff, 0xca, 0x52, 0xf5, 0x71, 0x94, 0x5e, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xfe, 0x05, 0x71, 0x94, 0x50, 0xcb, 0x62, 0xe5, 0x2d, 0x4b, 0xff, 0x59, 0x7e, 0xff, 0x3c, 0x6f, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x3b, 0x67, 0xff, 0x3b, 0x77, 0xff, 0x1a, 0x7f, 0xff, 0xfa, 0x7e, 0xff, 0xfa, 0x7e, 0xff, 0x79, 0x76, 0xff, 0x75, 0x5d, 0xff, 0x95, 0x6d, 0xff, 0xd2, 0x74, 0xff, 0xea, 0x5a, 0xff, 0xb1, 0x9c, 0xff, 0x53, 0xa5, 0xff, 0x9c, 0xe7, 0xff, 0x9b, 0xdf, 0xff, 0x9b, 0xd7, 0xff, 0x9a, 0xd7, 0xff, 0x9a, 0xd7, 0xff, 0x9a, 0xcf, 0xff, 0x9b, 0xcf, 0xff, 0x9b, 0xcf, 0xff, 0x7b, 0xc7, 0xff, 0x3a, 0xbf, 0xff, 0x5b, 0xc7, 0xff, 0x9b, 0xcf, 0xff, 0x9b, 0xd7, 0xff, 0x7b, 0xd7, 0xff, 0x7b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x7b, 0xdf, 0xff, 0x98, 0xce, 0xff, 0x2f, 0x84, 0xff, 0x6c, 0x6b, 0xff, 0x0b, 0x53, 0xff, 0x51, 0x5c, 0xff, 0x71, 0x4c, 0xff, 0x14, 0x4d, 0xff, 0xda, 0x76, 0xff, 0x1b, 0x77, 0xff, 0x1b, 0x77, 0xff, 0x1b, 0x77, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0x1b, 0x77, 0xff, 0xb5, 0x6d, 0xff, 0xca, 0x42, 0xff, 0x0b, 0x6b, 0xd4, 0xf7, 0xcd, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xad, 0x1b, 0x2c, 0x73, 0x97, 0xca, 0x62, 0xf2, 0xcb, 0x4a, 0xff, 0x14, 0x65, 0xff, 0x1c, 0x7f, 0xff, 0x5d, 0x6f, 0xff, 0x5d, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x3b, 0x67, 0xff, 0x1b, 0x67, 0xff, 0x1b, 0x67, 0xff, 0x1c, 0x6f, 0xff, 0xfb, 0x7e, 0xff, 0xd7, 0x85, 0xff, 0xeb, 0x5a, 0xff, 0x7b, 0xef, 0xff, 0xbc, 0xe7, 0xff, 0x9c, 0xe7, 0xff, 0x9b, 0xdf, 0xff, 0x9b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x9b, 0xcf, 0xff, 0xbb, 0xcf, 0xff, 0x9b, 0xc7, 0xff, 0x3a, 0xb7, 0xff, 0xd9, 0xae, 0xff, 0xb9, 0xae, 0xff, 0xb9, 0xae, 0xff, 0x1a, 0xb7, 0xff, 0x7b, 0xbf, 0xff, 0x9b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x7b, 0xdf, 0xff, 0x3a, 0xdf, 0xff, 0x1a, 0xe7, 0xff, 0x33, 0xad, 0xff, 0x8d, 0x5b, 0xff, 0xb9, 0x8e, 0xff, 0x3b, 0x77, 0xff, 0x3c, 0x6f, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x1b, 0x7f, 0xff, 0xb2, 0x64, 0xff, 0xcb, 0x5a, 0xfe, 0x0b, 0x6b, 0xd6, 0x2f, 0x8c, 0x4c, 0xf5, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xb2, 0x9c, 0x2f, 0xeb, 0x6a, 0xc4, 0xa9, 0x5a, 0xfd, 0xca, 0x5a, 0xff, 0xef, 0x4b, 0xff, 0xfb, 0x7e, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1b, 0x6f, 0xff, 0xb6, 0x75, 0xff, 0xca, 0x4a, 0xff, 0x33, 0xa5, 0xff, 0x73, 0x95, 0xff, 0xbc, 0xdf, 0xff, 0x9c, 0xdf, 0xff, 0x9c, 0xd7, 0xff, 0xbc, 0xcf, 0xff, 0x9c, 0xcf, 0xff, 0x5b, 0xbf, 0xff, 0xf9, 0xae, 0xff, 0x98, 0xa6, 0xff, 0x74, 0x8d, 0xff, 0x33, 0x85, 0xff, 0x78, 0xae, 0xff, 0x98, 0xa6, 0xff, 0xd9, 0x9e, 0xff, 0x1a, 0xaf, 0xff, 0x5b, 0xbf, 0xff, 0x7b, 0xc7, 0xff, 0x7b, 0xc7, 0xff, 0x9b, 0xcf, 0xff, 0x9b, 0xcf, 0xff, 0x57, 0xb6, 0xff, 0x57, 0xc6, 0xff, 0x53, 0xad, 0xff, 0x4c, 0x4b, 0xff, 0xda, 0x7e, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x57, 0xff, 0x7d, 0x57, 0xff, 0x5c, 0x57, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x3c, 0x6f, 0xff, 0xba, 0x86, 0xff, 0x4d, 0x4b, 0xff, 0xa9, 0x5a, 0xff, 0x69, 0x5a, 0xec, 0xae, 0x83, 0x6f, 0x59, 0xce, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x72, 0x9c, 0x38, 0xaa, 0x5a, 0xd4, 0x0b, 0x63, 0xfe, 0x89, 0x52, 0xff, 0xca, 0x4a, 0xff, 0x17, 0x76, 0xff, 0x5c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0xfa, 0x6e, 0xff, 0x75, 0x6d, 0xff, 0x8a, 0x4a, 0xff, 0xd2, 0x94, 0xff, 0xb8, 0xb6, 0xff, 0x7b, 0xcf, 0xff, 0x7c, 0xcf, 0xff, 0x7b, 0xc7, 0xff, 0x3a, 0xb7, 0xff, 0xd9, 0xae, 0xff, 0x98, 0xa6, 0xff, 0x98, 0xae, 0xff, 0xf2, 0x84, 0xff, 0x2c, 0x4b, 0xff, 0x4c, 0x53, 0xff, 0xd2, 0x7c, 0xff, 0x58, 0x9e, 0xff, 0x78, 0x96, 0xff, 0x98, 0x96, 0xff, 0xb9, 0x9e, 0xff, 0xd9, 0x9e, 0xff, 0xf8, 0xa6, 0xff, 0xf9, 0xa6, 0xff, 0xf9, 0xae, 0xff, 0x95, 0x95, 0xff, 0xad, 0x6b, 0xff, 0x2b, 0x63, 0xff, 0x4c, 0x4b, 0xff, 0xb9, 0x86, 0xff, 0x3c, 0x77, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x1c, 0x7f, 0xff, 0x13, 0x65, 0xff, 0xaa, 0x4a, 0xff, 0x69, 0x5a, 0xff, 0xab, 0x62, 0xf5, 0x4d, 0x73, 0x86, 0x9a, 0xd6, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xf3, 0xa4, 0x36, 0xaa, 0x5a, 0xd8, 0x0b, 0x5b, 0xff, 0xee, 0x73, 0xff, 0x89, 0x4a, 0xff, 0x0f, 0x4c, 0xff, 0x1b, 0x7f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x1b, 0x6f, 0xff, 0xb5, 0x5d, 0xff, 0x8e, 0x4b, 0xff, 0x0c, 0x53, 0xff, 0xf3, 0x8c, 0xff, 0x98, 0xb6, 0xff, 0xd9, 0xae, 0xff, 0xd9, 0xa6, 0xff, 0xb9, 0xa6, 0xff, 0x98, 0xa6, 0xff, 0x98, 0xae, 0xff, 0x17, 0xa6, 0xff, 0x71, 0x74, 0xff, 0x4d, 0x53, 0xff, 0xb2, 0x74, 0xff, 0xd3, 0x7c, 0xff, 0x4c, 0x4b, 0xff, 0x51, 0x6c, 0xff, 0x58, 0x9e, 0xff, 0x99, 0x9e, 0xff, 0x99, 0x96, 0xff, 0x98, 0x8e, 0xff, 0x98, 0x96, 0xff, 0x98, 0x96, 0xff, 0x98, 0x96, 0xff, 0x98, 0xae, 0xff, 0x78, 0xbe, 0xff, 0xce, 0x73, 0xff, 0x4c, 0x4b, 0xff, 0x91, 0x54, 0xff, 0x79, 0x76, 0xff, 0x3c, 0x77, 0xff, 0x7d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1c, 0x6f, 0xff, 0xb9, 0x7e, 0xff, 0x2b, 0x43, 0xff, 0xcb, 0x5a, 0xff, 0x0f, 0x7c, 0xff, 0x0b, 0x5b, 0xf7, 0xae, 0x7b, 0x86, 0x75, 0xcd, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xb5, 0x28, 0xaa, 0x5a, 0xce, 0xeb, 0x4a, 0xff, 0x13, 0x85, 0xff, 0x30, 0x74, 0xff, 0xaa, 0x3a, 0xff, 0xd6, 0x65, 0xff, 0x5c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1b, 0x6f, 0xff, 0x95, 0x4d, 0xff, 0x34, 0x4d, 0xff, 0x58, 0x7e, 0xff, 0x55, 0x75, 0xff, 0xcb, 0x42, 0xff, 0xef, 0x73, 0xff, 0x74, 0x95, 0xff, 0xd6, 0x9d, 0xff, 0xd6, 0x9d, 0xff, 0x95, 0x9d, 0xff, 0xd2, 0x84, 0xff, 0xae, 0x5b, 0xff, 0x10, 0x5c, 0xff, 0x55, 0x75, 0xff, 0xb7, 0x75, 0xff, 0xb6, 0x75, 0xff, 0x13, 0x6d, 0xff, 0x8e, 0x53, 0xff, 0x6e, 0x53, 0xff, 0x34, 0x85, 0xff, 0x37, 0x9e, 0xff, 0x98, 0xa6, 0xff, 0x78, 0xa6, 0xff, 0x99, 0xa6, 0xff, 0x99, 0xa6, 0xff, 0x77, 0xae, 0xff, 0x12, 0x8d, 0xff, 0x4c, 0x4b, 0xff, 0x95, 0x7d, 0xff, 0x95, 0x65, 0xff, 0x51, 0x34, 0xff, 0x38, 0x5e, 0xff, 0x5c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3d, 0x67, 0xff, 0x3b, 0x6f, 0xff, 0x33, 0x65, 0xff, 0xeb, 0x4a, 0xff, 0x54, 0x8d, 0xff, 0x91, 0x7c, 0xff, 0x0b, 0x5b, 0xf7, 0x6d, 0x73, 0x80, 0xfb, 0xde, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xd6, 0x10, 0xeb, 0x62, 0xb0, 0xca, 0x42, 0xfe, 0x13, 0x75, 0xff, 0x58, 0x9e, 0xff, 0xeb, 0x3a, 0xff, 0x8e, 0x43, 0xff, 0xda, 0x76, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0xfb, 0x5e, 0xff, 0x9a, 0x66, 0xff, 0x1b, 0x6f, 0xff, 0x3b, 0x67, 0xff, 0xfa, 0x76, 0xff, 0xae, 0x4b, 0xff, 0x8a, 0x5a, 0xff, 0xeb, 0x62, 0xff, 0x2c, 0x63, 0xff, 0x0c, 0x6b, 0xff, 0xeb, 0x62, 0xff, 0x6d, 0x5b, 0xff, 0x14, 0x75, 0xff, 0xb7, 0x6d, 0xff, 0xf8, 0x65, 0xff, 0x39, 0x5e, 0xff, 0x38, 0x5e, 0xff, 0xd7, 0x65, 0xff, 0x55, 0x75, 0xff, 0x31, 0x5c, 0xff, 0x2c, 0x43, 0xff, 0x4d, 0x5b, 0xff, 0x0f, 0x74, 0xff, 0x71, 0x84, 0xff, 0xd3, 0x8c, 0xff, 0x92, 0x84, 0xff, 0xad, 0x6b, 0xff, 0xea, 0x4a, 0xff, 0x74, 0x75, 0xff, 0x1b, 0x87, 0xff, 0x1b, 0x77, 0xff, 0xdb, 0x6e, 0xff, 0xd6, 0x45, 0xff, 0x3b, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x6f, 0xff, 0x99, 0x7e, 0xff, 0x6d, 0x4b, 0xff, 0xcf, 0x5b, 0xff, 0x99, 0xa6, 0xff, 0x30, 0x64, 0xff, 0xeb, 0x4a, 0xf2, 0xae, 0x7b, 0x67, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xd6, 0x05, 0x8d, 0x7b, 0x83, 0xca, 0x52, 0xfa, 0x70, 0x54, 0xff, 0xba, 0x8e, 0xff, 0x75, 0x7d, 0xff, 0xaa, 0x2a, 0xff, 0x34, 0x65, 0xff, 0x1b, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x6f, 0xff, 0x34, 0x65, 0xff, 0x6d, 0x6b, 0xff, 0xba, 0xde, 0xff, 0x79, 0xd6, 0xff, 0x99, 0xde, 0xff, 0x71, 0x94, 0xff, 0x51, 0x6c, 0xff, 0xd7, 0x75, 0xff, 0x19, 0x66, 0xff, 0x5a, 0x5e, 0xff, 0x9a, 0x66, 0xff, 0xba, 0x5e, 0xff, 0x59, 0x5e, 0xff, 0xd8, 0x65, 0xff, 0xb7, 0x65, 0xff, 0x55, 0x75, 0xff, 0x10, 0x64, 0xff, 0x0b, 0x63, 0xf9, 0x2c, 0x6b, 0xc8, 0x0c, 0x63, 0xb7, 0x4d, 0x73, 0xa3, 0xae, 0x83, 0xa3, 0x0b, 0x4b, 0xfb, 0xb9, 0x86, 0xff, 0x5c, 0x6f, 0xff, 0x7d, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3b, 0x77, 0xff, 0xd2, 0x5c, 0xff, 0x2c, 0x43, 0xff, 0x17, 0x8e, 0xff, 0x79, 0x96, 0xff, 0x4c, 0x43, 0xff, 0xaa, 0x4a, 0xe4, 0x92, 0x9c, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8c, 0x44, 0xaa, 0x5a, 0xec, 0x8d, 0x4b, 0xff, 0x78, 0x76, 0xff, 0xdb, 0x8e, 0xff, 0x10, 0x54, 0xff, 0xeb, 0x32, 0xff, 0x79, 0x76, 0xff, 0x3b, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x6f, 0xff, 0x95, 0x65, 0xff, 0x6d, 0x63, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x84, 0xff, 0xd3, 0x64, 0xff, 0x59, 0x6e, 0xff, 0xba, 0x5e, 0xff, 0xfb, 0x66, 0xff, 0x1c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x1c, 0x67, 0xff, 0xdb, 0x66, 0xff, 0x7a, 0x5e, 0xff, 0x17, 0x66, 0xff, 0x75, 0x75, 0xff, 0x4c, 0x5b, 0xe6, 0x18, 0xc6, 0x20, 0xff, 0xff, 0x04, 0xff, 0xff, 0x03, 0x30, 0x8c, 0x39, 0x4c, 0x43, 0xf6, 0xfb, 0x7e, 0xff, 0x7d, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5b, 0x6f, 0xff, 0xf6, 0x6d, 0xff, 0x0b, 0x3b, 0xff, 0x13, 0x65, 0xff, 0xda, 0x8e, 0xff, 0xd6, 0x75, 0xff, 0xcb, 0x42, 0xfe, 0x0b, 0x63, 0xaf, 0xbb, 0xde, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xde, 0x0c, 0x0c, 0x6b, 0xb8, 0xeb, 0x52, 0xff, 0xf7, 0x75, 0xff, 0xfb, 0x7e, 0xff, 0x9a, 0x86, 0xff, 0x4d, 0x43, 0xff, 0x10, 0x4c, 0xff, 0xda, 0x76, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x3c, 0x67, 0xff, 0xd7, 0x6d, 0xff, 0xec, 0x52, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x4d, 0x63, 0xff, 0x95, 0x6d, 0xff, 0x1b, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x3c, 0x67, 0xff, 0xdb, 0x6e, 0xff, 0x59, 0x86, 0xff, 0xae, 0x53, 0xe9, 0x35, 0xad, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x6b, 0x50, 0xef, 0x4b, 0xf9, 0xfb, 0x76, 0xff, 0x7d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x3b, 0x67, 0xff, 0x99, 0x76, 0xff, 0x4c, 0x3b, 0xff, 0xef, 0x4b, 0xff, 0xda, 0x86, 0xff, 0xfb, 0x7e, 0xff, 0xb2, 0x5c, 0xff, 0xca, 0x52, 0xf7, 0xce, 0x7b, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x8c, 0x4d, 0xeb, 0x5a, 0xf5, 0x71, 0x5c, 0xff, 0xdb, 0x7e, 0xff, 0xfb, 0x76, 0xff, 0xf7, 0x75, 0xff, 0x2c, 0x3b, 0xff, 0x33, 0x65, 0xff, 0x3c, 0x77, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x58, 0x76, 0xff, 0x0c, 0x4b, 0xff, 0x7d, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xff, 0x0c, 0x4b, 0xff, 0x17, 0x76, 0xff, 0x3b, 0x5f, 0xff, 0x7c, 0x57, 0xff, 0x3d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1b, 0x67, 0xff, 0xda, 0x7e, 0xff, 0x10, 0x5c, 0xef, 0x92, 0x8c, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x2c, 0x63, 0x77, 0x91, 0x5c, 0xfc, 0xfb, 0x76, 0xff, 0x7c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0xfa, 0x76, 0xff, 0x0f, 0x44, 0xff, 0x6d, 0x43, 0xff, 0x78, 0x76, 0xff, 0x1b, 0x77, 0xff, 0x79, 0x86, 0xff, 0x2c, 0x4b, 0xff, 0x0b, 0x5b, 0xc8, 0x57, 0xce, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xde, 0x07, 0xcb, 0x62, 0xb3, 0x0c, 0x53, 0xff, 0x18, 0x7e, 0xff, 0x1c, 0x6f, 0xff, 0x1c, 0x77, 0xff, 0x34, 0x65, 0xff, 0x4c, 0x3b, 0xff, 0xf7, 0x6d, 0xff, 0x5c, 0x6f, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0xba, 0x7e, 0xff, 0x8e, 0x4b, 0xff, 0xda, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xe7, 0xff, 0x0c, 0x4b, 0xff, 0x79, 0x76, 0xff, 0x3c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0xfb, 0x76, 0xff, 0x71, 0x5c, 0xf8, 0x10, 0x84, 0x4f, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x2b, 0x53, 0x8d, 0x74, 0x65, 0xfe, 0x3b, 0x6f, 0xff, 0x7d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x1b, 0x77, 0xff, 0xf2, 0x5c, 0xff, 0x0c, 0x43, 0xff, 0x17, 0x76, 0xff, 0x5c, 0x6f, 0xff, 0x3c, 0x7f, 0xff, 0xf3, 0x64, 0xff, 0xeb, 0x52, 0xf3, 0x30, 0x8c, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x8b, 0x2c, 0x8a, 0x52, 0xe9, 0xcf, 0x53, 0xff, 0xda, 0x7e, 0xff, 0x3c, 0x6f, 0xff, 0x1b, 0x77, 0xff, 0x91, 0x54, 0xff, 0x4c, 0x3b, 0xff, 0x99, 0x76, 0xff, 0x3c, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x1b, 0x7f, 0xff, 0x51, 0x5c, 0xff, 0xb6, 0xb5, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0xff, 0x6d, 0x4b, 0xff, 0xda, 0x7e, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0xfb, 0x76, 0xff, 0xd2, 0x64, 0xfc, 0xcf, 0x7b, 0x65, 0x00, 0x00, 0x00, 0x99, 0xb5, 0x0d, 0xeb, 0x4a, 0xc4, 0x17, 0x76, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x1b, 0x6f, 0xff, 0xd6, 0x75, 0xff, 0x2c, 0x3b, 0xff, 0xb6, 0x6d, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x6f, 0xff, 0x79, 0x7e, 0xff, 0x0b, 0x4b, 0xfd, 0x8e, 0x73, 0x89, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x9c, 0x2e, 0xd7, 0xc5, 0x19, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xb3, 0xac, 0x26, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x7b, 0x4e, 0x8a, 0x4a, 0xfa, 0xf3, 0x64, 0xff, 0x1b, 0x77, 0xff, 0x3c, 0x67, 0xff, 0xdb, 0x7e, 0xff, 0xef, 0x4b, 0xff, 0x8d, 0x43, 0xff, 0xfa, 0x7e, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x3c, 0x77, 0xff, 0x75, 0x65, 0xff, 0x30, 0x84, 0xff, 0xbe, 0xff, 0xff, 0x38, 0xc6, 0xff, 0xae, 0x4b, 0xff, 0xfa, 0x7e, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x1b, 0x6f, 0xff, 0x13, 0x65, 0xfe, 0xcf, 0x73, 0x79, 0x00, 0x00, 0x00, 0xf0, 0x7b, 0x3f, 0x4d, 0x4b, 0xf2, 0xba, 0x7e, 0xff, 0x3c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x57, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x6f, 0xff, 0x58, 0x76, 0xff, 0x2c, 0x3b, 0xff, 0x55, 0x65, 0xff, 0x3c, 0x77, 0xff, 0x5c, 0x6f, 0xff, 0xfb, 0x7e, 0xff, 0xce, 0x4b, 0xff, 0x2c, 0x63, 0xb7, 0x14, 0xc5, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x94, 0x52, 0x91, 0x94, 0x6c, 0xff, 0xff, 0x01, 
-  0x00, 0x00, 0x00, 0x59, 0xde, 0x0e, 0x6d, 0x7b, 0x8d, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x73, 0x66, 0xaa, 0x4a, 0xfc, 0xb6, 0x6d, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x99, 0x7e, 0xff, 0xae, 0x4b, 0xff, 0xae, 0x4b, 0xff, 0x1b, 0x7f, 0xff, 0x5d, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x99, 0x76, 0xff, 0x4d, 0x53, 0xff, 0x59, 0xd6, 0xff, 0xd6, 0xbd, 0xff, 0x0f, 0x5c, 0xff, 0x3b, 0x7f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x67, 0xff, 0x5c, 0x6f, 0xff, 0x95, 0x65, 0xff, 0xef, 0x73, 0xa2, 0xfd, 0xff, 0x0d, 0x2c, 0x53, 0xa7, 0x91, 0x5c, 0xfe, 0x3c, 0x77, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x57, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x9a, 0x7e, 0xff, 0x6d, 0x3b, 0xff, 0xf3, 0x5c, 0xff, 0x1b, 0x77, 0xff, 0x5c, 0x67, 0xff, 0x3b, 0x77, 0xff, 0x92, 0x5c, 0xff, 0xeb, 0x5a, 0xdc, 0x14, 0xa5, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x94, 0x28, 0xef, 0x83, 0xa1, 0x7a, 0xd6, 0x0a, 
-  0x00, 0x00, 0x00, 0x72, 0x9c, 0x3c, 0x8e, 0x83, 0xa5, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x4d, 0x73, 0x77, 0xaa, 0x4a, 0xfd, 0xd7, 0x6d, 0xff, 0x1b, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0xf7, 0x6d, 0xff, 0x4c, 0x43, 0xff, 0xae, 0x4b, 0xff, 0x1b, 0x7f, 0xff, 0x5d, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1b, 0x77, 0xff, 0x13, 0x65, 0xff, 0xce, 0x73, 0xff, 0xd2, 0x9c, 0xff, 0x71, 0x5c, 0xff, 0x5b, 0x7f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x67, 0xff, 0x5c, 0x6f, 0xff, 0xf7, 0x75, 0xff, 0xae, 0x6b, 0xd8, 0x14, 0xa5, 0x6f, 0xeb, 0x4a, 0xf3, 0xf7, 0x75, 0xff, 0x3b, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0xda, 0x7e, 0xff, 0x6d, 0x3b, 0xff, 0x91, 0x54, 0xff, 0xfb, 0x76, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0xf3, 0x64, 0xff, 0xcb, 0x5a, 0xe5, 0xf2, 0x9c, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xad, 0x18, 0xae, 0x7b, 0xbf, 0xb6, 0xbd, 0x22, 
-  0x00, 0x00, 0x00, 0x30, 0x94, 0x70, 0xaf, 0x83, 0xa6, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x2c, 0x73, 0x77, 0xaa, 0x4a, 0xfd, 0xf7, 0x6d, 0xff, 0x1c, 0x67, 0xff, 0xfb, 0x66, 0xff, 0xb6, 0x65, 0xff, 0x0b, 0x3b, 0xff, 0xae, 0x4b, 0xff, 0xfb, 0x7e, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0xda, 0x7e, 0xff, 0x91, 0x54, 0xff, 0x0b, 0x33, 0xff, 0xb6, 0x6d, 0xff, 0x3c, 0x77, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x79, 0x76, 0xff, 0x8d, 0x4b, 0xfd, 0x8d, 0x53, 0xf8, 0xb3, 0x64, 0xff, 0xda, 0x76, 0xff, 0x3c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0xda, 0x7e, 0xff, 0x6d, 0x3b, 0xff, 0x30, 0x4c, 0xff, 0xda, 0x6e, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x77, 0xff, 0x34, 0x65, 0xff, 0xeb, 0x5a, 0xe7, 0xb1, 0x9c, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xad, 0x12, 0x8e, 0x7b, 0xc8, 0xf3, 0xa4, 0x3b, 
-  0x00, 0x00, 0x00, 0x10, 0x94, 0x89, 0xef, 0x8b, 0xa7, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x6b, 0x59, 0xca, 0x4a, 0xfb, 0x96, 0x6d, 0xff, 0xfc, 0x6e, 0xff, 0xfb, 0x66, 0xff, 0xb6, 0x65, 0xff, 0x0b, 0x3b, 0xff, 0x6d, 0x43, 0xff, 0xfb, 0x7e, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0xfb, 0x7e, 0xff, 0x79, 0x76, 0xff, 0x1b, 0x77, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3b, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x5f, 0xff, 0x3b, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x1b, 0x77, 0xff, 0x94, 0x65, 0xff, 0x74, 0x5d, 0xff, 0xdb, 0x76, 0xff, 0x3c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0xb9, 0x76, 0xff, 0x4d, 0x3b, 0xff, 0x30, 0x4c, 0xff, 0xb9, 0x6e, 0xff, 0x3b, 0x67, 0xff, 0x1b, 0x77, 0xff, 0xb2, 0x64, 0xff, 0x0b, 0x5b, 0xe1, 0xf2, 0xac, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xad, 0x12, 0x6d, 0x7b, 0xcd, 0xb2, 0xa4, 0x48, 
-  0x00, 0x00, 0x00, 0x10, 0x94, 0x85, 0xf0, 0x93, 0xaf, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x7b, 0x40, 0xea, 0x52, 0xf5, 0xd3, 0x64, 0xff, 0xbb, 0x7e, 0xff, 0x9a, 0x6e, 0xff, 0xb6, 0x65, 0xff, 0x2b, 0x3b, 0xff, 0x2c, 0x3b, 0xff, 0xb9, 0x76, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x57, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x6f, 0xff, 0x3c, 0x6f, 0xff, 0x3b, 0x6f, 0xff, 0x3b, 0x77, 0xff, 0x3b, 0x87, 0xff, 0x5c, 0x87, 0xff, 0x5c, 0x87, 0xff, 0x7c, 0x8f, 0xff, 0x5c, 0x87, 0xff, 0x3b, 0x7f, 0xff, 0x3b, 0x6f, 0xff, 0x3b, 0x6f, 0xff, 0x1b, 0x6f, 0xff, 0x3b, 0x77, 0xff, 0x5b, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x3d, 0x5f, 0xff, 0x3d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x67, 0xff, 0x58, 0x76, 0xff, 0x2c, 0x3b, 0xff, 0x51, 0x54, 0xff, 0x59, 0x66, 0xff, 0xba, 0x5e, 0xff, 0xda, 0x76, 0xff, 0xef, 0x4b, 0xff, 0x0c, 0x63, 0xc5, 0xf4, 0xa4, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xbd, 0x18, 0x8d, 0x73, 0xd2, 0xf3, 0xa4, 0x3f, 
-  0x00, 0x00, 0x00, 0x30, 0x94, 0x6d, 0xcf, 0x8b, 0xbe, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x8c, 0x1a, 0xaa, 0x5a, 0xdd, 0xcf, 0x53, 0xff, 0x79, 0x76, 0xff, 0x79, 0x66, 0xff, 0x96, 0x5d, 0xff, 0x2c, 0x3b, 0xff, 0xeb, 0x3a, 0xff, 0x38, 0x6e, 0xff, 0x3c, 0x5f, 0xff, 0x3d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3b, 0x6f, 0xff, 0x1b, 0x77, 0xff, 0x3b, 0x87, 0xff, 0x9c, 0x97, 0xff, 0xdd, 0xa7, 0xff, 0xfd, 0xaf, 0xff, 0xfd, 0xbf, 0xff, 0xfe, 0xbf, 0xff, 0xfe, 0xbf, 0xff, 0xfe, 0xbf, 0xff, 0xfe, 0xbf, 0xff, 0xfe, 0xb7, 0xff, 0xfe, 0xb7, 0xff, 0xdd, 0xa7, 0xff, 0x9c, 0x97, 0xff, 0x5b, 0x87, 0xff, 0x1b, 0x77, 0xff, 0x3c, 0x6f, 0xff, 0x3c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0xfb, 0x6e, 0xff, 0xd7, 0x75, 0xff, 0x4d, 0x43, 0xff, 0xb2, 0x54, 0xff, 0x38, 0x66, 0xff, 0x58, 0x5e, 0xff, 0xf7, 0x6d, 0xff, 0x0b, 0x43, 0xfe, 0xeb, 0x62, 0x9e, 0x75, 0xfd, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xa4, 0x24, 0x8d, 0x73, 0xd5, 0x75, 0xad, 0x2a, 
-  0x00, 0x00, 0x00, 0x92, 0x9c, 0x44, 0xcf, 0x8b, 0xcf, 0x75, 0xbd, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x04, 0xaa, 0x62, 0xa2, 0x0b, 0x53, 0xff, 0x75, 0x6d, 0xff, 0x18, 0x66, 0xff, 0x76, 0x5d, 0xff, 0x8e, 0x43, 0xff, 0xaa, 0x32, 0xff, 0xb6, 0x65, 0xff, 0xfb, 0x5e, 0xff, 0x3d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3b, 0x6f, 0xff, 0x3b, 0x87, 0xff, 0xbd, 0xa7, 0xff, 0xfe, 0xbf, 0xff, 0xfd, 0xc7, 0xff, 0xfd, 0xc7, 0xff, 0xfc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xbc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdd, 0xc7, 0xff, 0xfd, 0xbf, 0xff, 0xfe, 0xbf, 0xff, 0xdd, 0xaf, 0xff, 0x9d, 0x97, 0xff, 0x3b, 0x77, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0xba, 0x6e, 0xff, 0x54, 0x6d, 0xff, 0x4d, 0x43, 0xff, 0x34, 0x65, 0xff, 0x38, 0x6e, 0xff, 0x38, 0x6e, 0xff, 0x92, 0x64, 0xff, 0x8a, 0x4a, 0xf7, 0x6d, 0x73, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x94, 0x57, 0xae, 0x7b, 0xbf, 0x77, 0xd6, 0x0f, 
-  0x00, 0x00, 0x00, 0x14, 0xbd, 0x18, 0x10, 0x8c, 0xcb, 0x92, 0x9c, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x83, 0x42, 0xaa, 0x5a, 0xef, 0x8e, 0x53, 0xff, 0x76, 0x6d, 0xff, 0x36, 0x65, 0xff, 0x30, 0x5c, 0xff, 0xaa, 0x32, 0xff, 0xf3, 0x5c, 0xff, 0x99, 0x5e, 0xff, 0x3c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5b, 0x67, 0xff, 0x3b, 0x7f, 0xff, 0xbc, 0x9f, 0xff, 0xfd, 0xb7, 0xff, 0xfc, 0xbf, 0xff, 0xfc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xfb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xfd, 0xc7, 0xff, 0xfd, 0xbf, 0xff, 0xfe, 0xb7, 0xff, 0x9d, 0x9f, 0xff, 0x1b, 0x77, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x1b, 0x5f, 0xff, 0x79, 0x6e, 0xff, 0x91, 0x5c, 0xff, 0x4c, 0x43, 0xff, 0x95, 0x75, 0xff, 0x17, 0x76, 0xff, 0x95, 0x75, 0xff, 0x0c, 0x4b, 0xff, 0xaa, 0x5a, 0xd1, 0xb3, 0xac, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0xcf, 0x83, 0x91, 0x0f, 0x84, 0x87, 0xff, 0xff, 0x02, 
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x51, 0x94, 0x87, 0x51, 0x94, 0x89, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xde, 0x06, 0x8a, 0x62, 0x91, 0xaa, 0x52, 0xfb, 0xd0, 0x5b, 0xff, 0xf4, 0x7c, 0xff, 0x92, 0x74, 0xff, 0xaa, 0x3a, 0xff, 0x50, 0x54, 0xff, 0x18, 0x66, 0xff, 0xfb, 0x5e, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x67, 0xff, 0x3b, 0x7f, 0xff, 0xdd, 0xaf, 0xff, 0xfd, 0xc7, 0xff, 0xfc, 0xc7, 0xff, 0xfb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xfd, 0xc7, 0xff, 0xfd, 0xc7, 0xff, 0xdd, 0xaf, 0xff, 0x1b, 0x7f, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x57, 0xff, 0x5d, 0x57, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0xfa, 0x5e, 0xff, 0x17, 0x6e, 0xff, 0x8d, 0x43, 0xff, 0x4c, 0x4b, 0xff, 0x95, 0x8d, 0xff, 0x95, 0x85, 0xff, 0xce, 0x5b, 0xff, 0xab, 0x52, 0xee, 0x6d, 0x73, 0x58, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xa5, 0x1e, 0x0c, 0x6b, 0xc2, 0xb2, 0x9c, 0x32, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xb5, 0x20, 0xae, 0x83, 0xb1, 0xb3, 0xa4, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xa4, 0x13, 0xcb, 0x62, 0x9b, 0xcb, 0x5a, 0xf6, 0x4d, 0x63, 0xff, 0x51, 0x7c, 0xff, 0x0b, 0x5b, 0xff, 0x6d, 0x4b, 0xff, 0xd7, 0x6d, 0xff, 0x9a, 0x5e, 0xff, 0x3c, 0x67, 0xff, 0x7d, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x67, 0xff, 0x3b, 0x7f, 0xff, 0xdd, 0xb7, 0xff, 0xfd, 0xcf, 0xff, 0xfc, 0xd7, 0xff, 0xdb, 0xcf, 0xff, 0xfc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xfc, 0xcf, 0xff, 0xfc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdd, 0xc7, 0xff, 0xdd, 0xb7, 0xff, 0x1b, 0x7f, 0xff, 0x3c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x1c, 0x67, 0xff, 0x3c, 0x5f, 0xff, 0x99, 0x5e, 0xff, 0x75, 0x65, 0xff, 0xcb, 0x42, 0xff, 0x8d, 0x6b, 0xff, 0xd2, 0x8c, 0xff, 0x2c, 0x5b, 0xff, 0xcb, 0x52, 0xf0, 0xae, 0x73, 0x67, 0x7a, 0xd6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x6d, 0x73, 0x75, 0xae, 0x7b, 0x7f, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xcf, 0x8b, 0x5a, 0xaf, 0x83, 0x78, 0x7a, 0xd6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xbd, 0x0b, 0xeb, 0x62, 0x6c, 0xcb, 0x5a, 0xd4, 0xcb, 0x62, 0xf9, 0xaa, 0x5a, 0xff, 0xcb, 0x4a, 0xff, 0x55, 0x6d, 0xff, 0x18, 0x5e, 0xff, 0xda, 0x5e, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x1a, 0x77, 0xff, 0xdd, 0xaf, 0xff, 0xfd, 0xc7, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xd7, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xfd, 0xc7, 0xff, 0xdd, 0xaf, 0xff, 0x1a, 0x77, 0xff, 0x3c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0xfb, 0x5e, 0xff, 0xba, 0x5e, 0xff, 0x38, 0x5e, 0xff, 0x72, 0x5c, 0xff, 0x8a, 0x52, 0xff, 0xaa, 0x5a, 0xff, 0x8a, 0x5a, 0xfb, 0xcb, 0x62, 0xd9, 0x6d, 0x73, 0x5f, 0x7a, 0xd6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x9c, 0x20, 0x6d, 0x73, 0x83, 0xf8, 0xc5, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xad, 0x06, 0x8f, 0x83, 0x5a, 0x31, 0x94, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xef, 0x8b, 0x19, 0x2d, 0x73, 0x61, 0xaa, 0x62, 0xb9, 0x8a, 0x52, 0xfb, 0x30, 0x5c, 0xff, 0xd7, 0x6d, 0xff, 0x38, 0x5e, 0xff, 0xbb, 0x5e, 0xff, 0x5d, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1b, 0x6f, 0xff, 0x7c, 0x9f, 0xff, 0xfd, 0xc7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xfd, 0xcf, 0xff, 0xfc, 0xbf, 0xff, 0x9c, 0x97, 0xff, 0x3b, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1b, 0x5f, 0xff, 0xba, 0x56, 0xff, 0x38, 0x5e, 0xff, 0x96, 0x6d, 0xff, 0x6d, 0x4b, 0xff, 0xaa, 0x5a, 0xf8, 0x8a, 0x62, 0xbc, 0x4d, 0x7b, 0x6b, 0xb2, 0x9c, 0x21, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x94, 0x0e, 0xb5, 0xad, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x04, 0x92, 0x94, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x16, 0x89, 0x52, 0xbb, 0xec, 0x4a, 0xfe, 0x55, 0x75, 0xff, 0xd7, 0x5d, 0xff, 0x59, 0x56, 0xff, 0xdb, 0x5e, 0xff, 0x7d, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x3b, 0x7f, 0xff, 0xfd, 0xb7, 0xff, 0xdc, 0xc7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xc7, 0xff, 0xfd, 0xb7, 0xff, 0x5b, 0x7f, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x1c, 0x5f, 0xff, 0xda, 0x56, 0xff, 0x58, 0x56, 0xff, 0xd6, 0x5d, 0xff, 0xd3, 0x64, 0xff, 0xeb, 0x52, 0xfd, 0x2c, 0x6b, 0x9b, 0x59, 0xce, 0x0e, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x7b, 0x47, 0xaa, 0x52, 0xed, 0x10, 0x64, 0xff, 0x96, 0x6d, 0xff, 0xd7, 0x55, 0xff, 0x38, 0x56, 0xff, 0xfb, 0x5e, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x6f, 0xff, 0x9c, 0x97, 0xff, 0xfd, 0xbf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xfc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xfd, 0xc7, 0xff, 0xbd, 0x9f, 0xff, 0x3b, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0xfb, 0x5e, 0xff, 0x9a, 0x56, 0xff, 0x38, 0x4e, 0xff, 0xd6, 0x55, 0xff, 0x74, 0x6d, 0xff, 0x8d, 0x53, 0xff, 0xcb, 0x5a, 0xdf, 0xb2, 0x9c, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x07, 0xeb, 0x62, 0xa2, 0x0c, 0x53, 0xfd, 0xf3, 0x6c, 0xff, 0x96, 0x5d, 0xff, 0xd7, 0x55, 0xff, 0x38, 0x4e, 0xff, 0xdb, 0x5e, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x57, 0xff, 0x5c, 0x57, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5b, 0x67, 0xff, 0x3b, 0x7f, 0xff, 0xfd, 0xb7, 0xff, 0xfd, 0xc7, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xcf, 0xff, 0xfe, 0xb7, 0xff, 0x3b, 0x7f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x57, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0xfb, 0x5e, 0xff, 0x9a, 0x56, 0xff, 0x18, 0x4e, 0xff, 0xb7, 0x4d, 0xff, 0x95, 0x5d, 0xff, 0x70, 0x5c, 0xff, 0xcb, 0x52, 0xfb, 0x0c, 0x6b, 0x81, 0x75, 0xfd, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x7b, 0x31, 0x0b, 0x5b, 0xe3, 0x8e, 0x5b, 0xff, 0x55, 0x6d, 0xff, 0x96, 0x5d, 0xff, 0xf7, 0x55, 0xff, 0x18, 0x4e, 0xff, 0x9a, 0x56, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5b, 0x67, 0xff, 0x5b, 0x87, 0xff, 0xfe, 0xbf, 0xff, 0xfd, 0xcf, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xfd, 0xbf, 0xff, 0x7c, 0x8f, 0xff, 0x3c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x1c, 0x5f, 0xff, 0xdb, 0x5e, 0xff, 0x79, 0x56, 0xff, 0x18, 0x4e, 0xff, 0xb7, 0x55, 0xff, 0x76, 0x5d, 0xff, 0xf3, 0x64, 0xff, 0xeb, 0x4a, 0xff, 0xca, 0x5a, 0xc9, 0x14, 0xa5, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xad, 0x03, 0x2c, 0x6b, 0x6f, 0xeb, 0x5a, 0xf5, 0xf0, 0x5b, 0xff, 0x75, 0x6d, 0xff, 0x96, 0x55, 0xff, 0xb7, 0x55, 0xff, 0xf8, 0x4d, 0xff, 0x9a, 0x56, 0xff, 0x1c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x57, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5b, 0x6f, 0xff, 0x7c, 0x8f, 0xff, 0xfe, 0xc7, 0xff, 0xfd, 0xcf, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xfc, 0xbf, 0xff, 0xbc, 0x97, 0xff, 0x3b, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0xfb, 0x5e, 0xff, 0x9a, 0x5e, 0xff, 0x59, 0x56, 0xff, 0xf7, 0x4d, 0xff, 0xb7, 0x4d, 0xff, 0x96, 0x5d, 0xff, 0x34, 0x65, 0xff, 0x0c, 0x4b, 0xff, 0x8a, 0x52, 0xeb, 0x91, 0x94, 0x47, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xc6, 0x0c, 0xab, 0x62, 0xa7, 0xcb, 0x52, 0xfc, 0x10, 0x5c, 0xff, 0x55, 0x65, 0xff, 0x75, 0x5d, 0xff, 0xd7, 0x55, 0xff, 0xf8, 0x4d, 0xff, 0x59, 0x56, 0xff, 0xdb, 0x5e, 0xff, 0x1b, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x6f, 0xff, 0x7c, 0x97, 0xff, 0xfd, 0xcf, 0xff, 0xfc, 0xd7, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xfc, 0xc7, 0xff, 0xbc, 0x9f, 0xff, 0x1b, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x1b, 0x5f, 0xff, 0xda, 0x5e, 0xff, 0x59, 0x56, 0xff, 0x18, 0x56, 0xff, 0xf8, 0x55, 0xff, 0xd7, 0x55, 0xff, 0x96, 0x5d, 0xff, 0x35, 0x6d, 0xff, 0x6d, 0x53, 0xff, 0xaa, 0x52, 0xf7, 0x6d, 0x73, 0x75, 0xf5, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x94, 0x1d, 0xab, 0x5a, 0xb5, 0x8a, 0x4a, 0xfc, 0xcf, 0x53, 0xff, 0x55, 0x6d, 0xff, 0x75, 0x55, 0xff, 0xd7, 0x4d, 0xff, 0xf8, 0x4d, 0xff, 0x18, 0x4e, 0xff, 0x79, 0x56, 0xff, 0xdb, 0x5e, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x6f, 0xff, 0x9c, 0x9f, 0xff, 0xfd, 0xcf, 0xff, 0xfc, 0xd7, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xd7, 0xff, 0xfc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xfd, 0xc7, 0xff, 0xdd, 0xa7, 0xff, 0x1b, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x1b, 0x67, 0xff, 0xdb, 0x5e, 0xff, 0x99, 0x56, 0xff, 0x38, 0x4e, 0xff, 0xf8, 0x55, 0xff, 0xf8, 0x5d, 0xff, 0xd7, 0x55, 0xff, 0xb6, 0x5d, 0xff, 0x35, 0x6d, 0xff, 0x4d, 0x4b, 0xff, 0xca, 0x5a, 0xfb, 0x6d, 0x73, 0x9d, 0xd9, 0xde, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x94, 0x1d, 0x8a, 0x52, 0xb9, 0x8a, 0x4a, 0xfa, 0x8e, 0x53, 0xff, 0x34, 0x6d, 0xff, 0x96, 0x5d, 0xff, 0xd7, 0x4d, 0xff, 0xf8, 0x4d, 0xff, 0x18, 0x56, 0xff, 0x38, 0x4e, 0xff, 0x99, 0x56, 0xff, 0x1b, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3b, 0x6f, 0xff, 0x9c, 0x9f, 0xff, 0xfd, 0xc7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xbb, 0xcf, 0xff, 0xdc, 0xc7, 0xff, 0xdd, 0xa7, 0xff, 0xfa, 0x6e, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x1c, 0x5f, 0xff, 0xdb, 0x5e, 0xff, 0x79, 0x56, 0xff, 0x59, 0x56, 0xff, 0x18, 0x56, 0xff, 0xf8, 0x55, 0xff, 0xd8, 0x55, 0xff, 0xd7, 0x5d, 0xff, 0xd6, 0x6d, 0xff, 0x54, 0x75, 0xff, 0x6d, 0x5b, 0xff, 0xca, 0x5a, 0xfb, 0xeb, 0x62, 0xab, 0x18, 0xc6, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xa4, 0x18, 0xcb, 0x62, 0x91, 0xab, 0x5a, 0xf5, 0x2c, 0x53, 0xff, 0xd2, 0x5c, 0xff, 0xd6, 0x5d, 0xff, 0xf8, 0x55, 0xff, 0xf8, 0x55, 0xff, 0x18, 0x56, 0xff, 0x18, 0x4e, 0xff, 0x59, 0x56, 0xff, 0x9a, 0x56, 0xff, 0xfb, 0x5e, 0xff, 0x1b, 0x6f, 0xff, 0x5c, 0x97, 0xff, 0xfe, 0xc7, 0xff, 0xfd, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xc7, 0xff, 0xdd, 0xaf, 0xff, 0xda, 0x6e, 0xff, 0xfb, 0x66, 0xff, 0xdb, 0x5e, 0xff, 0x9a, 0x5e, 0xff, 0x39, 0x56, 0xff, 0xf8, 0x55, 0xff, 0xd7, 0x55, 0xff, 0xd7, 0x55, 0xff, 0xd8, 0x55, 0xff, 0xd7, 0x5d, 0xff, 0xd7, 0x6d, 0xff, 0x13, 0x6d, 0xff, 0x2c, 0x53, 0xff, 0xaa, 0x5a, 0xf4, 0x6d, 0x7b, 0x96, 0xd7, 0xcd, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x07, 0xeb, 0x6a, 0x73, 0xab, 0x5a, 0xe4, 0xec, 0x4a, 0xff, 0xf3, 0x5c, 0xff, 0xf7, 0x5d, 0xff, 0xf8, 0x55, 0xff, 0xf8, 0x55, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x55, 0xff, 0x18, 0x4e, 0xff, 0x59, 0x56, 0xff, 0x79, 0x66, 0xff, 0xba, 0x86, 0xff, 0xbd, 0xbf, 0xff, 0xbc, 0xc7, 0xff, 0xbc, 0xcf, 0xff, 0xbc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xbc, 0xcf, 0xff, 0xbc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xbc, 0xcf, 0xff, 0xbc, 0xcf, 0xff, 0xbc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xbc, 0xcf, 0xff, 0xbc, 0xc7, 0xff, 0xbc, 0xbf, 0xff, 0x9c, 0xa7, 0xff, 0x58, 0x66, 0xff, 0x38, 0x5e, 0xff, 0x18, 0x56, 0xff, 0xf7, 0x55, 0xff, 0xd7, 0x55, 0xff, 0xb7, 0x55, 0xff, 0xb6, 0x55, 0xff, 0xb7, 0x55, 0xff, 0xd7, 0x55, 0xff, 0xd6, 0x65, 0xff, 0xb2, 0x64, 0xff, 0xeb, 0x4a, 0xfe, 0xab, 0x5a, 0xd8, 0x6d, 0x7b, 0x67, 0x5a, 0xef, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x6d, 0x7b, 0x64, 0xab, 0x52, 0xf8, 0x51, 0x64, 0xff, 0xd7, 0x6d, 0xff, 0x18, 0x56, 0xff, 0xf8, 0x55, 0xff, 0xf7, 0x55, 0xff, 0xd7, 0x55, 0xff, 0xf8, 0x55, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x65, 0xff, 0x1a, 0x9f, 0xff, 0x3b, 0xaf, 0xff, 0x5b, 0xb7, 0xff, 0x7b, 0xbf, 0xff, 0x9b, 0xbf, 0xff, 0xbc, 0xc7, 0xff, 0xbb, 0xcf, 0xff, 0xbc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xbc, 0xcf, 0xff, 0xbc, 0xcf, 0xff, 0x9c, 0xcf, 0xff, 0xbc, 0xc7, 0xff, 0x9c, 0xc7, 0xff, 0x9b, 0xbf, 0xff, 0x5b, 0xb7, 0xff, 0x5b, 0xaf, 0xff, 0xfa, 0x96, 0xff, 0xf7, 0x5d, 0xff, 0xd7, 0x55, 0xff, 0xb7, 0x55, 0xff, 0xb7, 0x55, 0xff, 0xd7, 0x55, 0xff, 0xb7, 0x55, 0xff, 0xb6, 0x55, 0xff, 0xb6, 0x55, 0xff, 0xd6, 0x55, 0xff, 0x95, 0x6d, 0xff, 0x4d, 0x4b, 0xff, 0x8a, 0x52, 0xef, 0x71, 0x94, 0x40, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x94, 0x1d, 0xcb, 0x5a, 0xde, 0xef, 0x5b, 0xff, 0xb7, 0x75, 0xff, 0xf8, 0x5d, 0xff, 0xf8, 0x55, 0xff, 0xd7, 0x55, 0xff, 0xd7, 0x5d, 0xff, 0xd7, 0x55, 0xff, 0xd7, 0x55, 0xff, 0xb6, 0x55, 0xff, 0xb6, 0x5d, 0xff, 0x58, 0x7e, 0xff, 0xd9, 0x96, 0xff, 0xd9, 0x9e, 0xff, 0xfa, 0xa6, 0xff, 0x1a, 0xaf, 0xff, 0x3a, 0xaf, 0xff, 0x5a, 0xb7, 0xff, 0x5a, 0xb7, 0xff, 0x7b, 0xbf, 0xff, 0x7b, 0xbf, 0xff, 0x7b, 0xbf, 0xff, 0x7b, 0xc7, 0xff, 0x9b, 0xc7, 0xff, 0x9b, 0xc7, 0xff, 0xbb, 0xc7, 0xff, 0xbb, 0xc7, 0xff, 0xbb, 0xc7, 0xff, 0xbb, 0xc7, 0xff, 0x9b, 0xc7, 0xff, 0x9b, 0xc7, 0xff, 0x9b, 0xbf, 0xff, 0x9b, 0xbf, 0xff, 0x7b, 0xbf, 0xff, 0x7b, 0xbf, 0xff, 0x5a, 0xb7, 0xff, 0x3a, 0xb7, 0xff, 0x3a, 0xb7, 0xff, 0x1a, 0xaf, 0xff, 0x1a, 0xa7, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0x58, 0x86, 0xff, 0xd7, 0x5d, 0xff, 0xd7, 0x5d, 0xff, 0xb6, 0x55, 0xff, 0xb7, 0x55, 0xff, 0xb6, 0x55, 0xff, 0xb6, 0x55, 0xff, 0xd7, 0x55, 0xff, 0xd6, 0x55, 0xff, 0xb6, 0x55, 0xff, 0x34, 0x6d, 0xff, 0xeb, 0x4a, 0xff, 0xca, 0x5a, 0xc8, 0x96, 0xb5, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x05, 0xcb, 0x5a, 0xb1, 0x4d, 0x53, 0xff, 0x96, 0x75, 0xff, 0xd7, 0x5d, 0xff, 0xf8, 0x55, 0xff, 0xf8, 0x55, 0xff, 0xd7, 0x55, 0xff, 0xb7, 0x55, 0xff, 0x76, 0x55, 0xff, 0x35, 0x5d, 0xff, 0x55, 0x65, 0xff, 0x96, 0x6d, 0xff, 0x99, 0x96, 0xff, 0xb9, 0x9e, 0xff, 0xd9, 0xa6, 0xff, 0xd9, 0xa6, 0xff, 0xf9, 0xa6, 0xff, 0x1a, 0xaf, 0xff, 0x1a, 0xaf, 0xff, 0x1a, 0xaf, 0xff, 0x1a, 0xaf, 0xff, 0x1a, 0xaf, 0xff, 0x1a, 0xaf, 0xff, 0x1b, 0xb7, 0xff, 0x3a, 0xb7, 0xff, 0x3b, 0xb7, 0xff, 0x3b, 0xb7, 0xff, 0x5b, 0xb7, 0xff, 0x3b, 0xb7, 0xff, 0x3a, 0xb7, 0xff, 0x3a, 0xb7, 0xff, 0x1a, 0xaf, 0xff, 0x1a, 0xaf, 0xff, 0x1a, 0xaf, 0xff, 0x1a, 0xaf, 0xff, 0x1a, 0xaf, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0xda, 0x9e, 0xff, 0xd9, 0x9e, 0xff, 0xf9, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0xf7, 0x7d, 0xff, 0xd7, 0x75, 0xff, 0x96, 0x75, 0xff, 0x14, 0x55, 0xff, 0xb6, 0x5d, 0xff, 0xb7, 0x5d, 0xff, 0xd7, 0x55, 0xff, 0xd7, 0x55, 0xff, 0xd7, 0x55, 0xff, 0xd6, 0x5d, 0xff, 0xd3, 0x6c, 0xff, 0x8a, 0x4a, 0xfd, 0x6d, 0x73, 0x8b, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x73, 0x63, 0xeb, 0x52, 0xf9, 0x14, 0x6d, 0xff, 0xf7, 0x65, 0xff, 0xf8, 0x5d, 0xff, 0xd7, 0x55, 0xff, 0xd7, 0x55, 0xff, 0xb6, 0x55, 0xff, 0x96, 0x5d, 0xff, 0x51, 0x44, 0xff, 0x8e, 0x33, 0xff, 0xcf, 0x4b, 0xff, 0x34, 0x7d, 0xff, 0x17, 0xa6, 0xff, 0x98, 0xae, 0xff, 0xd9, 0xb6, 0xff, 0xda, 0xb6, 0xff, 0xfa, 0xae, 0xff, 0xfa, 0xae, 0xff, 0xfa, 0xae, 0xff, 0xfa, 0xae, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0xae, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0x1a, 0xa7, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0xda, 0xa6, 0xff, 0xda, 0xa6, 0xff, 0xda, 0xa6, 0xff, 0xda, 0xae, 0xff, 0xda, 0xae, 0xff, 0xd9, 0xb6, 0xff, 0xb8, 0xae, 0xff, 0x17, 0x9e, 0xff, 0x92, 0x6c, 0xff, 0xef, 0x4b, 0xff, 0x8e, 0x3b, 0xff, 0x31, 0x44, 0xff, 0xd7, 0x65, 0xff, 0xd7, 0x5d, 0xff, 0xd7, 0x55, 0xff, 0xf7, 0x55, 0xff, 0xd7, 0x55, 0xff, 0xd6, 0x65, 0xff, 0x30, 0x5c, 0xff, 0x89, 0x52, 0xf4, 0x71, 0x94, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x9c, 0x19, 0xcb, 0x5a, 0xda, 0x30, 0x64, 0xff, 0x38, 0x76, 0xff, 0xf8, 0x5d, 0xff, 0xd7, 0x55, 0xff, 0xd7, 0x4d, 0xff, 0xd6, 0x55, 0xff, 0xb6, 0x55, 0xff, 0x96, 0x5d, 0xff, 0xf4, 0x5c, 0xff, 0xf0, 0x53, 0xff, 0xeb, 0x42, 0xff, 0xaa, 0x4a, 0xff, 0x0b, 0x5b, 0xff, 0xce, 0x6b, 0xff, 0x71, 0x84, 0xff, 0x34, 0x95, 0xff, 0x95, 0x9d, 0xff, 0x17, 0xa6, 0xff, 0x78, 0xae, 0xff, 0xb9, 0xae, 0xff, 0xd9, 0xae, 0xff, 0xda, 0xae, 0xff, 0xfa, 0xae, 0xff, 0xda, 0xae, 0xff, 0xda, 0xae, 0xff, 0xd9, 0xae, 0xff, 0xda, 0xae, 0xff, 0xd9, 0xa6, 0xff, 0xd9, 0xae, 0xff, 0xd9, 0xae, 0xff, 0xb9, 0xae, 0xff, 0x98, 0xa6, 0xff, 0x58, 0xa6, 0xff, 0xf7, 0xa5, 0xff, 0x75, 0x95, 0xff, 0x14, 0x8d, 0xff, 0x70, 0x7c, 0xff, 0xad, 0x6b, 0xff, 0x0b, 0x5b, 0xff, 0xca, 0x42, 0xff, 0x2d, 0x43, 0xff, 0xf0, 0x53, 0xff, 0x14, 0x65, 0xff, 0xd7, 0x6d, 0xff, 0xf7, 0x65, 0xff, 0xf8, 0x5d, 0xff, 0x18, 0x56, 0xff, 0x38, 0x56, 0xff, 0x18, 0x66, 0xff, 0x17, 0x7e, 0xff, 0x0c, 0x4b, 0xff, 0xaa, 0x5a, 0xd3, 0x59, 0xce, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xad, 0x03, 0x0c, 0x6b, 0x8b, 0xcb, 0x4a, 0xfd, 0xf6, 0x75, 0xff, 0x79, 0x66, 0xff, 0x38, 0x56, 0xff, 0x37, 0x4e, 0xff, 0xf7, 0x4d, 0xff, 0xd7, 0x55, 0xff, 0xb6, 0x55, 0xff, 0x96, 0x5d, 0xff, 0x76, 0x6d, 0xff, 0x14, 0x7d, 0xff, 0xf0, 0x73, 0xff, 0xcb, 0x5a, 0xfe, 0xcb, 0x62, 0xea, 0x8a, 0x5a, 0xe2, 0x6a, 0x5a, 0xef, 0xaa, 0x5a, 0xf8, 0xcb, 0x62, 0xfb, 0xeb, 0x62, 0xfe, 0x4c, 0x63, 0xff, 0xae, 0x6b, 0xff, 0x30, 0x74, 0xff, 0xb1, 0x7c, 0xff, 0xf3, 0x8c, 0xff, 0x54, 0x95, 0xff, 0x75, 0x95, 0xff, 0x54, 0x8d, 0xff, 0x13, 0x85, 0xff, 0x91, 0x7c, 0xff, 0x2f, 0x74, 0xff, 0xad, 0x6b, 0xff, 0x4c, 0x5b, 0xff, 0xca, 0x52, 0xff, 0x8a, 0x52, 0xfe, 0x69, 0x52, 0xfa, 0x69, 0x52, 0xf0, 0x8a, 0x5a, 0xe2, 0xaa, 0x5a, 0xf3, 0xaa, 0x52, 0xff, 0x30, 0x6c, 0xff, 0x55, 0x7d, 0xff, 0xd7, 0x75, 0xff, 0xf8, 0x6d, 0xff, 0xf8, 0x5d, 0xff, 0x18, 0x5e, 0xff, 0x19, 0x56, 0xff, 0x79, 0x56, 0xff, 0x9a, 0x66, 0xff, 0xba, 0x7e, 0xff, 0x54, 0x7d, 0xff, 0x8a, 0x4a, 0xfd, 0x2c, 0x6b, 0x80, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x73, 0x33, 0x6a, 0x4a, 0xe9, 0x30, 0x54, 0xff, 0xba, 0x7e, 0xff, 0xda, 0x66, 0xff, 0x99, 0x56, 0xff, 0x38, 0x46, 0xff, 0xf8, 0x4d, 0xff, 0xd7, 0x4d, 0xff, 0xd7, 0x55, 0xff, 0xb7, 0x55, 0xff, 0x76, 0x75, 0xff, 0xf0, 0x6b, 0xff, 0xec, 0x62, 0xea, 0x31, 0x94, 0x47, 0x34, 0xb5, 0x19, 0x31, 0x9c, 0x2e, 0x6e, 0x7b, 0x53, 0x0c, 0x6b, 0x64, 0xcb, 0x6a, 0x7b, 0x8b, 0x62, 0xa0, 0xaa, 0x62, 0xb2, 0xab, 0x62, 0xbe, 0xab, 0x5a, 0xc8, 0xab, 0x5a, 0xd0, 0xab, 0x5a, 0xd5, 0xab, 0x5a, 0xd6, 0xcb, 0x5a, 0xd5, 0xcb, 0x5a, 0xd0, 0xaa, 0x5a, 0xc8, 0x8a, 0x5a, 0xc1, 0x8a, 0x5a, 0xb7, 0x8a, 0x5a, 0xa6, 0x8a, 0x5a, 0x85, 0x8b, 0x62, 0x6e, 0xed, 0x72, 0x59, 0xd0, 0x8b, 0x2f, 0x36, 0xbd, 0x19, 0xab, 0x62, 0x89, 0x8a, 0x52, 0xfd, 0x71, 0x74, 0xff, 0xb6, 0x75, 0xff, 0x18, 0x5e, 0xff, 0x18, 0x56, 0xff, 0x38, 0x56, 0xff, 0x39, 0x56, 0xff, 0x7a, 0x56, 0xff, 0xdb, 0x66, 0xff, 0xda, 0x76, 0xff, 0x9a, 0x8e, 0xff, 0x6d, 0x53, 0xff, 0xab, 0x5a, 0xda, 0x35, 0xb5, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xfd, 0x03, 0xcb, 0x62, 0x87, 0xcb, 0x4a, 0xfb, 0x95, 0x75, 0xff, 0xda, 0x7e, 0xff, 0xfb, 0x66, 0xff, 0xfc, 0x5e, 0xff, 0x7a, 0x56, 0xff, 0x38, 0x56, 0xff, 0x18, 0x56, 0xff, 0xd7, 0x65, 0xff, 0x14, 0x75, 0xff, 0x0d, 0x5b, 0xff, 0x0d, 0x6b, 0xa8, 0xfb, 0xde, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x7f, 0xfe, 0x05, 0xd7, 0xdd, 0x07, 0xd6, 0xb4, 0x0a, 0x51, 0xa4, 0x0d, 0x90, 0x93, 0x10, 0x90, 0x83, 0x10, 0xd1, 0x8b, 0x0f, 0xb3, 0x9c, 0x0c, 0x75, 0xad, 0x09, 0xdb, 0xbd, 0x07, 0xbb, 0xde, 0x06, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x8b, 0x27, 0x6a, 0x52, 0xe1, 0x2d, 0x53, 0xff, 0x75, 0x6d, 0xff, 0x18, 0x5e, 0xff, 0x59, 0x5e, 0xff, 0x79, 0x56, 0xff, 0xbb, 0x5e, 0xff, 0xdb, 0x66, 0xff, 0xfb, 0x6e, 0xff, 0xfb, 0x8e, 0xff, 0xb2, 0x6c, 0xff, 0x0c, 0x5b, 0xf6, 0xf0, 0x83, 0x64, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xa4, 0x15, 0xab, 0x5a, 0xbe, 0x4d, 0x4b, 0xff, 0x18, 0x7e, 0xff, 0xfb, 0x76, 0xff, 0x1c, 0x6f, 0xff, 0x1c, 0x6f, 0xff, 0x99, 0x66, 0xff, 0x17, 0x66, 0xff, 0x75, 0x75, 0xff, 0x8e, 0x5b, 0xff, 0xcc, 0x62, 0xe8, 0xcf, 0x8b, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x0d, 0x73, 0x74, 0xab, 0x52, 0xf9, 0x31, 0x5c, 0xff, 0xd7, 0x75, 0xff, 0x59, 0x66, 0xff, 0xdb, 0x66, 0xff, 0xfb, 0x66, 0xff, 0xfb, 0x76, 0xff, 0xda, 0x7e, 0xff, 0x34, 0x6d, 0xff, 0x2c, 0x5b, 0xfc, 0xec, 0x62, 0xa0, 0x99, 0xcd, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x8b, 0x37, 0xcb, 0x5a, 0xd9, 0x6d, 0x53, 0xff, 0x75, 0x7d, 0xff, 0x9a, 0x86, 0xff, 0xdb, 0x86, 0xff, 0x9a, 0x86, 0xff, 0x96, 0x75, 0xff, 0x8e, 0x5b, 0xff, 0xec, 0x5a, 0xf6, 0x2e, 0x73, 0x7a, 0x18, 0xc6, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xac, 0x11, 0xac, 0x62, 0xae, 0xec, 0x52, 0xfd, 0x71, 0x6c, 0xff, 0xd6, 0x75, 0xff, 0x79, 0x7e, 0xff, 0x79, 0x7e, 0xff, 0x18, 0x7e, 0xff, 0x71, 0x64, 0xff, 0xeb, 0x52, 0xfc, 0x0b, 0x63, 0xaf, 0x56, 0xb5, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xaf, 0x83, 0x3d, 0xcb, 0x62, 0xc7, 0xeb, 0x52, 0xfb, 0x6d, 0x53, 0xff, 0x10, 0x64, 0xff, 0x0f, 0x64, 0xff, 0x2c, 0x53, 0xff, 0xeb, 0x5a, 0xeb, 0x4e, 0x73, 0x82, 0x37, 0xbd, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x94, 0x21, 0xec, 0x62, 0xb4, 0xca, 0x52, 0xfa, 0x2c, 0x53, 0xff, 0xce, 0x5b, 0xff, 0x6d, 0x53, 0xff, 0xec, 0x4a, 0xff, 0xab, 0x52, 0xef, 0xec, 0x6a, 0x97, 0x93, 0xa4, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xac, 0x17, 0x6e, 0x7b, 0x6b, 0xcb, 0x5a, 0xc1, 0xaa, 0x5a, 0xda, 0xaa, 0x5a, 0xd4, 0x0c, 0x6b, 0x9e, 0xef, 0x8b, 0x3c, 0xbb, 0xde, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xa4, 0x13, 0x2d, 0x73, 0x6a, 0x8a, 0x62, 0xbd, 0x69, 0x52, 0xd6, 0x89, 0x52, 0xcf, 0xcb, 0x62, 0x98, 0x8f, 0x83, 0x3d, 0x18, 0xc5, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xe7, 0x08, 0x98, 0xc5, 0x10, 0x99, 0xcd, 0x0d, 0x1f, 0xfe, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xde, 0x07, 0x37, 0xcd, 0x0e, 0xd7, 0xbd, 0x0b, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0xff, 0xff, 0x04, 0xff, 0xff, 0x05, 0xff, 0xff, 0x05, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x04, 0xd5, 0xd7, 0x16, 0x9c, 0x72, 0x3e, 0x83, 0xcf, 0x60, 0x83, 0xcf, 0x74, 0x7b, 0xae, 0x90, 0x73, 0x6d, 0xa1, 0x6b, 0x6d, 0xa9, 0x73, 0x4c, 0xa7, 0x73, 0x6d, 0x94, 0x7b, 0xae, 0x6e, 0x7b, 0xaf, 0x59, 0x9c, 0x71, 0x39, 0xc5, 0xd7, 0x15, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xfb, 0x07, 0xbd, 0x95, 0x27, 0x8b, 0xef, 0x75, 0x5a, 0xaa, 0xba, 0x4a, 0x48, 0xe1, 0x4a, 0x69, 0xf0, 0x4a, 0x8a, 0xfb, 0x42, 0xaa, 0xfd, 0x42, 0xca, 0xfe, 0x4b, 0x0b, 0xfe, 0x4b, 0x2b, 0xfe, 0x4b, 0x2b, 0xfe, 0x4b, 0x0b, 0xfe, 0x4a, 0xeb, 0xfc, 0x52, 0xcb, 0xf8, 0x52, 0xaa, 0xee, 0x4a, 0x69, 0xde, 0x5a, 0x89, 0xba, 0x73, 0x4d, 0x7a, 0x94, 0x51, 0x34, 0xc6, 0x18, 0x0c, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0x59, 0x0e, 0x94, 0x31, 0x4d, 0x7b, 0x6d, 0xa8, 0x62, 0xaa, 0xe8, 0x52, 0x8a, 0xfc, 0x4a, 0x8a, 0xff, 0x4b, 0x4c, 0xff, 0x5c, 0x50, 0xff, 0x6d, 0x13, 0xff, 0x6d, 0xd6, 0xff, 0x76, 0x38, 0xff, 0x76, 0x58, 0xff, 0x7e, 0x99, 0xff, 0x7e, 0x99, 0xff, 0x7e, 0x99, 0xff, 0x7e, 0x38, 0xff, 0x75, 0x95, 0xff, 0x5c, 0xb2, 0xff, 0x53, 0xce, 0xff, 0x4a, 0xcb, 0xff, 0x52, 0x8a, 0xfc, 0x5a, 0xaa, 0xee, 0x6b, 0x0c, 0xb9, 0x83, 0xaf, 0x67, 0xa4, 0x72, 0x1d, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x7a, 0x0a, 0x94, 0x30, 0x50, 0x73, 0x2c, 0xbc, 0x62, 0xeb, 0xf5, 0x53, 0x0b, 0xff, 0x53, 0xae, 0xff, 0x6d, 0x14, 0xff, 0x7e, 0x38, 0xff, 0x7e, 0xba, 0xff, 0x76, 0xfb, 0xff, 0x6f, 0x1b, 0xff, 0x67, 0x1c, 0xff, 0x67, 0x1c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3b, 0xff, 0x6f, 0x3b, 0xff, 0x77, 0x1b, 0xff, 0x86, 0xfb, 0xff, 0x7e, 0x79, 0xff, 0x75, 0xb6, 0xff, 0x64, 0x71, 0xff, 0x53, 0x4c, 0xff, 0x5a, 0xeb, 0xf9, 0x62, 0xcb, 0xd6, 0x7b, 0x4d, 0x77, 0xc5, 0xb7, 0x18, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x94, 0x51, 0x37, 0x6b, 0x0b, 0xad, 0x5a, 0xca, 0xf3, 0x4b, 0x2c, 0xff, 0x54, 0x30, 0xff, 0x75, 0xd6, 0xff, 0x86, 0xda, 0xff, 0x7f, 0x1b, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x7c, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x3c, 0xff, 0x77, 0x3b, 0xff, 0x7f, 0x3b, 0xff, 0x7e, 0x99, 0xff, 0x65, 0x33, 0xff, 0x4b, 0x8d, 0xff, 0x4a, 0xcb, 0xf9, 0x5a, 0xcb, 0xc7, 0x8b, 0xef, 0x4f, 0xd6, 0x7a, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x08, 0x7b, 0x8e, 0x6c, 0x52, 0x89, 0xe2, 0x4a, 0xa9, 0xfe, 0x5c, 0x50, 0xff, 0x76, 0x17, 0xff, 0x86, 0xfb, 0xff, 0x87, 0x1b, 0xff, 0x87, 0x1c, 0xff, 0x7f, 0x3c, 0xff, 0x77, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x57, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x77, 0x3b, 0xff, 0x76, 0xb9, 0xff, 0x65, 0x34, 0xff, 0x4b, 0x0c, 0xff, 0x52, 0x8a, 0xf0, 0x6b, 0x4c, 0x88, 0xad, 0x74, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xd7, 0x12, 0x62, 0xcb, 0x90, 0x4a, 0x89, 0xf4, 0x4b, 0x4d, 0xff, 0x6d, 0xd7, 0xff, 0x76, 0xfa, 0xff, 0x6e, 0xfb, 0xff, 0x7f, 0x3b, 0xff, 0x8f, 0x5c, 0xff, 0x9f, 0xbd, 0xff, 0xa7, 0xde, 0xff, 0x9f, 0xbe, 0xff, 0x7f, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x3d, 0xff, 0x67, 0x3c, 0xff, 0x77, 0x1b, 0xff, 0x7e, 0x58, 0xff, 0x53, 0xf0, 0xff, 0x4a, 0x8a, 0xfa, 0x5a, 0xaa, 0xb5, 0xad, 0x14, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x97, 0x16, 0x6b, 0x0c, 0xa3, 0x4a, 0xaa, 0xfa, 0x53, 0xcf, 0xff, 0x7e, 0x59, 0xff, 0x6f, 0x1c, 0xff, 0x67, 0x1c, 0xff, 0x7f, 0x7c, 0xff, 0x97, 0xbd, 0xff, 0xa7, 0xbd, 0xff, 0xaf, 0xbd, 0xff, 0xaf, 0xbd, 0xff, 0xaf, 0xbd, 0xff, 0x97, 0xbd, 0xff, 0x77, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x1c, 0xff, 0x86, 0xba, 0xff, 0x64, 0xb2, 0xff, 0x42, 0xca, 0xfe, 0x52, 0x8a, 0xcf, 0x94, 0x31, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x18, 0x10, 0x63, 0x0c, 0xa2, 0x4a, 0xaa, 0xfc, 0x54, 0x31, 0xff, 0x7e, 0xba, 0xff, 0x6f, 0x1c, 0xff, 0x67, 0x3c, 0xff, 0x77, 0x3c, 0xff, 0x97, 0xbd, 0xff, 0x9f, 0x9c, 0xff, 0xa7, 0x9c, 0xff, 0xaf, 0x9c, 0xff, 0xa7, 0x9c, 0xff, 0xa7, 0xbd, 0xff, 0x97, 0xbd, 0xff, 0x87, 0x7d, 0xff, 0x87, 0xdf, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3c, 0xff, 0x86, 0xfb, 0xff, 0x75, 0x54, 0xff, 0x42, 0xeb, 0xfe, 0x52, 0xaa, 0xd5, 0x94, 0x71, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x59, 0x09, 0x6b, 0x0c, 0x8a, 0x4a, 0xaa, 0xf9, 0x54, 0x30, 0xff, 0x7e, 0xba, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x1b, 0xff, 0x8f, 0xbd, 0xff, 0xa7, 0x9d, 0xff, 0xa7, 0x9c, 0xff, 0xa7, 0x9c, 0xff, 0xa7, 0xbc, 0xff, 0x9f, 0xbc, 0xff, 0x8f, 0xbd, 0xff, 0x77, 0x5b, 0xff, 0x6f, 0x3c, 0xff, 0x6f, 0x7d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x3c, 0xff, 0x6f, 0x3c, 0xff, 0x87, 0x1b, 0xff, 0x6d, 0x75, 0xff, 0x4a, 0xcb, 0xff, 0x5a, 0xaa, 0xcf, 0xac, 0xf4, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x83, 0xcf, 0x6b, 0x52, 0xaa, 0xf5, 0x53, 0xcf, 0xff, 0x7e, 0xba, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x3b, 0xff, 0x97, 0xdd, 0xff, 0x9f, 0xbd, 0xff, 0xa7, 0x9d, 0xff, 0x9f, 0xbd, 0xff, 0x97, 0xbd, 0xff, 0x8f, 0xbd, 0xff, 0x77, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3c, 0xff, 0x7f, 0x1b, 0xff, 0x75, 0x54, 0xff, 0x52, 0xcb, 0xfd, 0x62, 0xeb, 0xae, 0xad, 0x35, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x51, 0x3d, 0x5a, 0xec, 0xe5, 0x53, 0x8e, 0xff, 0x7e, 0x99, 0xff, 0x6f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x77, 0x7c, 0xff, 0x8f, 0xbd, 0xff, 0x8f, 0xbd, 0xff, 0x87, 0xbd, 0xff, 0x7f, 0x7c, 0xff, 0x6f, 0x3b, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x6f, 0x1c, 0xff, 0x86, 0xfb, 0xff, 0x64, 0xd2, 0xff, 0x53, 0x0b, 0xf8, 0x6b, 0x2c, 0x80, 0xc6, 0x18, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x75, 0x15, 0x5a, 0xcb, 0xc9, 0x4b, 0x4d, 0xff, 0x7e, 0x17, 0xff, 0x77, 0x3b, 0xff, 0x67, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x1b, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x6f, 0x3c, 0xff, 0x86, 0xfa, 0xff, 0x53, 0xcf, 0xff, 0x52, 0x8a, 0xed, 0x8c, 0x10, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x7a, 0x05, 0x7b, 0x8e, 0x81, 0x53, 0x2c, 0xfa, 0x6d, 0x54, 0xff, 0x7f, 0x3b, 0xff, 0x67, 0x7c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x1b, 0xff, 0x7e, 0x17, 0xff, 0x4a, 0xcb, 0xff, 0x5a, 0x8a, 0xb9, 0xce, 0x59, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x3c, 0x52, 0xab, 0xe8, 0x54, 0x30, 0xff, 0x7f, 0x1b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x7e, 0xfa, 0xff, 0x54, 0x50, 0xff, 0x4a, 0x89, 0xf7, 0x73, 0x8e, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x7a, 0x0a, 0x5a, 0xcb, 0xae, 0x42, 0xeb, 0xfe, 0x7e, 0x38, 0xff, 0x6f, 0x1b, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3b, 0xff, 0x76, 0x37, 0xff, 0x42, 0xcb, 0xff, 0x5a, 0x8a, 0xd0, 0xa5, 0x34, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x30, 0x4d, 0x52, 0x8a, 0xf3, 0x5c, 0xb2, 0xff, 0x76, 0xfb, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x57, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x7c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x3b, 0xff, 0x7f, 0x1b, 0xff, 0x64, 0x92, 0xff, 0x52, 0xaa, 0xfa, 0x83, 0xef, 0x6c, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x59, 0x0e, 0x62, 0xeb, 0xb9, 0x42, 0xeb, 0xff, 0x76, 0x58, 0xff, 0x6f, 0x3b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x7d, 0xff, 0x57, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x7c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x86, 0x79, 0xff, 0x53, 0x4c, 0xff, 0x63, 0x0b, 0xd3, 0xbd, 0x76, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xcf, 0x52, 0x42, 0x69, 0xf6, 0x54, 0xb2, 0xff, 0x77, 0x1c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x57, 0x7d, 0xff, 0x57, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x5c, 0xff, 0x67, 0x7c, 0xff, 0x7f, 0x3b, 0xff, 0x6d, 0x33, 0xff, 0x52, 0xeb, 0xfa, 0x7b, 0x6e, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0x18, 0x0c, 0x6a, 0xec, 0xb9, 0x42, 0xcb, 0xff, 0x76, 0x78, 0xff, 0x67, 0x1c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3b, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x6f, 0x3b, 0xff, 0x7e, 0x98, 0xff, 0x4b, 0x0b, 0xff, 0x62, 0xcb, 0xc9, 0xde, 0xf9, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xb2, 0x47, 0x5a, 0xcb, 0xf4, 0x54, 0x51, 0xff, 0x76, 0xfb, 0xff, 0x5f, 0x3d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x66, 0x79, 0xff, 0x65, 0xb6, 0xff, 0x76, 0x58, 0xff, 0x86, 0xdb, 0xff, 0x77, 0x1b, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x7c, 0xff, 0x57, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x6f, 0x3b, 0xff, 0x76, 0xfa, 0xff, 0x76, 0x99, 0xff, 0x66, 0x37, 0xff, 0x66, 0xb9, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3b, 0xff, 0x76, 0xfa, 0xff, 0x5c, 0x91, 0xff, 0x52, 0xca, 0xf5, 0x94, 0x50, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x07, 0x63, 0x0c, 0xb3, 0x4a, 0xeb, 0xff, 0x75, 0xf7, 0xff, 0x6f, 0x1c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3c, 0xff, 0x77, 0x1b, 0xff, 0x65, 0x33, 0xff, 0x42, 0xeb, 0xff, 0x42, 0xaa, 0xff, 0x4b, 0x6d, 0xff, 0x6d, 0x54, 0xff, 0x7e, 0xda, 0xff, 0x6f, 0x3b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x6f, 0x3b, 0xff, 0x86, 0xfa, 0xff, 0x75, 0xb5, 0xff, 0x54, 0x0f, 0xff, 0x3a, 0xeb, 0xff, 0x4b, 0x8d, 0xff, 0x6d, 0xb5, 0xff, 0x77, 0x1b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x7e, 0x17, 0xff, 0x4b, 0x0b, 0xfe, 0x6b, 0x4c, 0xaf, 0xc6, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x71, 0x41, 0x5a, 0xeb, 0xf1, 0x53, 0xef, 0xff, 0x86, 0xdb, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7b, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x76, 0x79, 0xff, 0x6c, 0x91, 0xff, 0x5a, 0xeb, 0xff, 0x62, 0xa9, 0xff, 0x62, 0xa9, 0xff, 0x52, 0xca, 0xff, 0x54, 0x30, 0xff, 0x86, 0xba, 0xff, 0x6f, 0x3c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x6f, 0x3c, 0xff, 0x76, 0xb9, 0xff, 0x54, 0x50, 0xff, 0x4a, 0xca, 0xff, 0x52, 0x89, 0xff, 0x5a, 0x69, 0xff, 0x63, 0x4d, 0xff, 0x5c, 0x71, 0xff, 0x6e, 0x78, 0xff, 0x6f, 0x5c, 0xff, 0x67, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x86, 0xda, 0xff, 0x5c, 0x50, 0xff, 0x5a, 0xeb, 0xee, 0xa4, 0xb2, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x75, 0x18, 0xac, 0xf3, 0x51, 0xa4, 0xd3, 0x53, 0xac, 0xf4, 0x46, 0xc5, 0x96, 0x2a, 0xe7, 0x3c, 0x09, 0xff, 0xfb, 0x07, 0x7b, 0xad, 0xa4, 0x53, 0x0b, 0xfe, 0x75, 0x95, 0xff, 0x7f, 0x3c, 0xff, 0x67, 0x3d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x1b, 0xff, 0x55, 0x34, 0xff, 0x33, 0x0b, 0xff, 0x4a, 0xeb, 0xff, 0x4a, 0xaa, 0xff, 0x52, 0x89, 0xff, 0x5a, 0x89, 0xff, 0x52, 0xaa, 0xff, 0x54, 0x30, 0xff, 0x7f, 0x1b, 0xff, 0x6f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x5c, 0xff, 0x76, 0xda, 0xff, 0x43, 0xee, 0xff, 0x4a, 0xc9, 0xff, 0x52, 0xa9, 0xff, 0x52, 0x89, 0xff, 0x4a, 0xaa, 0xff, 0x4b, 0x0c, 0xff, 0x3b, 0x4d, 0xff, 0x55, 0x34, 0xff, 0x77, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x3c, 0xff, 0x7f, 0x1b, 0xff, 0x85, 0xb6, 0xff, 0x52, 0xca, 0xfe, 0x73, 0x6d, 0x98, 0x9c, 0x91, 0x37, 0xa4, 0xf2, 0x49, 0xad, 0x14, 0x3c, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xf0, 0x37, 0x6a, 0xeb, 0x9b, 0x62, 0xcb, 0xb6, 0x6a, 0xca, 0xd8, 0x6a, 0xcb, 0xda, 0x73, 0x2d, 0xaa, 0x94, 0x30, 0x80, 0x62, 0xeb, 0xf0, 0x5b, 0x4d, 0xff, 0x8e, 0xba, 0xff, 0x6f, 0x3b, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x3d, 0xff, 0x67, 0x3c, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x3b, 0xff, 0x76, 0xda, 0xff, 0x7e, 0x58, 0xff, 0x7e, 0x38, 0xff, 0x7e, 0x18, 0xff, 0x75, 0xb6, 0xff, 0x64, 0xb2, 0xff, 0x4b, 0x6d, 0xff, 0x33, 0x2c, 0xff, 0x5e, 0x17, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x3c, 0xff, 0x77, 0x1b, 0xff, 0x7f, 0x1b, 0xff, 0x7f, 0x1b, 0xff, 0x7f, 0x1b, 0xff, 0x77, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x6f, 0x3c, 0xff, 0x65, 0xd7, 0xff, 0x33, 0x2c, 0xff, 0x43, 0x0b, 0xff, 0x5c, 0x30, 0xff, 0x75, 0x95, 0xff, 0x7e, 0x38, 0xff, 0x7e, 0x79, 0xff, 0x7e, 0x99, 0xff, 0x76, 0xda, 0xff, 0x6f, 0x1b, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3c, 0xff, 0x77, 0x1b, 0xff, 0x76, 0x99, 0xff, 0x6d, 0xb5, 0xff, 0x64, 0x50, 0xff, 0x52, 0x8a, 0xff, 0x5a, 0x69, 0xfb, 0x62, 0xaa, 0xc8, 0x62, 0xca, 0xa1, 0x63, 0x2c, 0x85, 0xd6, 0x9a, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xc6, 0x18, 0x04, 0xad, 0x75, 0x09, 0xbd, 0x74, 0x19, 0xac, 0xb2, 0x2d, 0x93, 0xef, 0x6b, 0x6a, 0xca, 0xeb, 0x5a, 0xcb, 0xff, 0x53, 0xae, 0xff, 0x86, 0xba, 0xff, 0x6f, 0x5c, 0xff, 0x6f, 0x5c, 0xff, 0x77, 0x1b, 0xff, 0x87, 0x1b, 0xff, 0x87, 0x1a, 0xff, 0x87, 0x1a, 0xff, 0x7f, 0x1a, 0xff, 0x7e, 0xfa, 0xff, 0x76, 0xfa, 0xff, 0x6e, 0xfb, 0xff, 0x6e, 0xfc, 0xff, 0x6f, 0x1c, 0xff, 0x76, 0xfb, 0xff, 0x7e, 0xba, 0xff, 0x5d, 0x95, 0xff, 0x6e, 0xda, 0xff, 0x6f, 0x1b, 0xff, 0x6f, 0x1b, 0xff, 0x76, 0xfb, 0xff, 0x86, 0xba, 0xff, 0x65, 0x54, 0xff, 0x54, 0x51, 0xff, 0x53, 0xef, 0xff, 0x53, 0xee, 0xff, 0x54, 0x0f, 0xff, 0x65, 0x13, 0xff, 0x86, 0xba, 0xff, 0x7f, 0x1b, 0xff, 0x77, 0x1b, 0xff, 0x6f, 0x3c, 0xff, 0x6f, 0x3c, 0xff, 0x6f, 0x3c, 0xff, 0x7e, 0xfb, 0xff, 0x5d, 0x54, 0xff, 0x7e, 0x38, 0xff, 0x86, 0xfb, 0xff, 0x7f, 0x1c, 0xff, 0x6f, 0x1c, 0xff, 0x77, 0x1b, 0xff, 0x7f, 0x1a, 0xff, 0x7e, 0xfa, 0xff, 0x86, 0xfb, 0xff, 0x86, 0xfb, 0xff, 0x7e, 0xfb, 0xff, 0x77, 0x1b, 0xff, 0x6f, 0x3b, 0xff, 0x6f, 0x5c, 0xff, 0x77, 0x3c, 0xff, 0x55, 0x55, 0xff, 0x2b, 0xae, 0xff, 0x33, 0xce, 0xff, 0x6c, 0xd2, 0xff, 0x6b, 0xef, 0xff, 0x5a, 0x8a, 0xfe, 0x94, 0x30, 0x84, 0xde, 0xfb, 0x07, 0xc6, 0x18, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0xd3, 0x3e, 0x5a, 0x89, 0xf2, 0x5b, 0x4c, 0xff, 0x6c, 0xf3, 0xff, 0x66, 0x17, 0xff, 0x6f, 0x3b, 0xff, 0x7f, 0x3b, 0xff, 0x8f, 0x1a, 0xff, 0xa6, 0xfa, 0xff, 0xae, 0xd9, 0xff, 0xae, 0xd9, 0xff, 0xa6, 0xd9, 0xff, 0x9e, 0xfa, 0xff, 0x87, 0x1a, 0xff, 0x77, 0x3c, 0xff, 0x67, 0x3d, 0xff, 0x67, 0x3d, 0xff, 0x67, 0x3c, 0xff, 0x6f, 0x1b, 0xff, 0x77, 0x1b, 0xff, 0x7e, 0xda, 0xff, 0x7e, 0x58, 0xff, 0x6d, 0xb5, 0xff, 0x6d, 0x34, 0xff, 0x5b, 0xef, 0xff, 0x52, 0xeb, 0xff, 0x5a, 0xaa, 0xff, 0x62, 0xaa, 0xff, 0x62, 0xaa, 0xff, 0x62, 0xcb, 0xff, 0x52, 0xca, 0xff, 0x4b, 0x4c, 0xff, 0x43, 0x8d, 0xff, 0x5c, 0x71, 0xff, 0x6d, 0x75, 0xff, 0x76, 0x58, 0xff, 0x7e, 0xfa, 0xff, 0x7f, 0x1b, 0xff, 0x7f, 0x3c, 0xff, 0x77, 0x1c, 0xff, 0x6f, 0x5d, 0xff, 0x67, 0x3d, 0xff, 0x6f, 0x3c, 0xff, 0x7f, 0x1b, 0xff, 0x97, 0x1a, 0xff, 0xa6, 0xd9, 0xff, 0xae, 0xd9, 0xff, 0xa6, 0xd9, 0xff, 0xa6, 0xf9, 0xff, 0x97, 0x1a, 0xff, 0x87, 0x1b, 0xff, 0x77, 0x3c, 0xff, 0x76, 0xfb, 0xff, 0x4d, 0x75, 0xff, 0x65, 0xf7, 0xff, 0x76, 0xba, 0xff, 0x86, 0xda, 0xff, 0x8e, 0x18, 0xff, 0x53, 0x0c, 0xff, 0x6a, 0xeb, 0xd5, 0xc5, 0xb5, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xfb, 0x0e, 0x6b, 0x2b, 0xb7, 0x52, 0xca, 0xff, 0x7c, 0xf3, 0xff, 0x8e, 0xba, 0xff, 0x77, 0x1b, 0xff, 0x6f, 0x1a, 0xff, 0x86, 0xfa, 0xff, 0xa6, 0xf8, 0xff, 0xc6, 0xb8, 0xff, 0xce, 0x98, 0xff, 0xce, 0x97, 0xff, 0xce, 0x98, 0xff, 0xb6, 0xb9, 0xff, 0x9e, 0xda, 0xff, 0x7f, 0x1b, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x3d, 0xff, 0x67, 0x1c, 0xff, 0x7e, 0xdb, 0xff, 0x6d, 0x96, 0xff, 0x53, 0xcf, 0xff, 0x3a, 0xca, 0xff, 0x63, 0xad, 0xff, 0x95, 0x12, 0xff, 0xa5, 0x53, 0xff, 0x52, 0x89, 0xff, 0x5a, 0x68, 0xff, 0x5a, 0x68, 0xff, 0x62, 0x69, 0xff, 0x62, 0x89, 0xff, 0x62, 0xca, 0xff, 0xa5, 0x73, 0xff, 0xb5, 0xf5, 0xff, 0x9d, 0x53, 0xff, 0x63, 0xad, 0xff, 0x3a, 0xca, 0xff, 0x53, 0xef, 0xff, 0x6d, 0x75, 0xff, 0x86, 0xba, 0xff, 0x6f, 0x1c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x77, 0x3c, 0xff, 0x8e, 0xfa, 0xff, 0xae, 0xd9, 0xff, 0xbe, 0xb8, 0xff, 0xc6, 0xb7, 0xff, 0xbe, 0xb7, 0xff, 0xbe, 0xd8, 0xff, 0xae, 0xd9, 0xff, 0x9e, 0xfb, 0xff, 0x7e, 0xfb, 0xff, 0x6f, 0x1c, 0xff, 0x6f, 0x1c, 0xff, 0x76, 0xfc, 0xff, 0x77, 0x1c, 0xff, 0x77, 0x1b, 0xff, 0x8f, 0x1b, 0xff, 0x6c, 0x91, 0xff, 0x63, 0x0b, 0xfc, 0x8b, 0xce, 0x7e, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xd6, 0x7a, 0x05, 0xc5, 0x76, 0x1c, 0x7b, 0x8d, 0x81, 0x52, 0x69, 0xfb, 0x53, 0x2b, 0xff, 0x85, 0xb6, 0xff, 0x76, 0xba, 0xff, 0x67, 0x1b, 0xff, 0x6f, 0x1a, 0xff, 0x8e, 0xd9, 0xff, 0xb6, 0xb8, 0xff, 0xce, 0x78, 0xff, 0xd6, 0x77, 0xff, 0xd6, 0x96, 0xff, 0xde, 0x77, 0xff, 0xc6, 0x98, 0xff, 0xa6, 0xda, 0xff, 0x8f, 0x1b, 0xff, 0x6f, 0x3b, 0xff, 0x6f, 0x1c, 0xff, 0x7e, 0xba, 0xff, 0x5c, 0x92, 0xff, 0x4a, 0xeb, 0xff, 0x94, 0xd2, 0xff, 0xd6, 0xd9, 0xff, 0xe7, 0x7b, 0xff, 0xe7, 0x9b, 0xff, 0xe7, 0x7b, 0xff, 0xdf, 0x19, 0xff, 0x8c, 0x90, 0xff, 0x63, 0x0a, 0xff, 0x5a, 0xa9, 0xff, 0x8c, 0x90, 0xff, 0xd7, 0x19, 0xff, 0xe7, 0x9b, 0xff, 0xdf, 0x7b, 0xff, 0xe7, 0x9c, 0xff, 0xe7, 0x9c, 0xff, 0xd6, 0xfa, 0xff, 0x9d, 0x33, 0xff, 0x53, 0x2b, 0xff, 0x4b, 0xce, 0xff, 0x76, 0x38, 0xff, 0x77, 0x1b, 0xff, 0x6f, 0x3c, 0xff, 0x7f, 0x1b, 0xff, 0x96, 0xfa, 0xff, 0xb6, 0xd9, 0xff, 0xce, 0xb8, 0xff, 0xce, 0x97, 0xff, 0xce, 0x97, 0xff, 0xce, 0x97, 0xff, 0xbe, 0xb9, 0xff, 0x9e, 0xda, 0xff, 0x87, 0x1b, 0xff, 0x6f, 0x1b, 0xff, 0x67, 0x1b, 0xff, 0x6e, 0x9a, 0xff, 0x76, 0x7a, 0xff, 0x76, 0x79, 0xff, 0x8e, 0xb9, 0xff, 0x9e, 0x17, 0xff, 0x6b, 0x2c, 0xff, 0x73, 0x0c, 0xec, 0xad, 0x14, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x75, 0x15, 0x8c, 0x10, 0x5e, 0x7b, 0x4d, 0xa7, 0x6a, 0xca, 0xde, 0x5a, 0x89, 0xfb, 0x52, 0xaa, 0xff, 0x43, 0x2c, 0xff, 0x3b, 0xf0, 0xff, 0x55, 0xf8, 0xff, 0x5f, 0x3b, 0xff, 0x6f, 0x1a, 0xff, 0x8e, 0xd9, 0xff, 0xb6, 0xb8, 0xff, 0xce, 0x98, 0xff, 0xd6, 0x77, 0xff, 0xd6, 0x96, 0xff, 0xd6, 0x97, 0xff, 0xc6, 0xb8, 0xff, 0xae, 0xda, 0xff, 0x8f, 0x1b, 0xff, 0x7f, 0x3b, 0xff, 0x86, 0xdb, 0xff, 0x5c, 0x51, 0xff, 0x53, 0x2b, 0xff, 0xc6, 0x57, 0xff, 0xe7, 0x7b, 0xff, 0xdf, 0x7a, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x7a, 0xff, 0xdf, 0x7a, 0xff, 0xdf, 0x7b, 0xff, 0xe7, 0x7b, 0xff, 0xd7, 0x1a, 0xff, 0xce, 0xb8, 0xff, 0xdf, 0x7b, 0xff, 0xdf, 0x7b, 0xff, 0xdf, 0x7b, 0xff, 0xdf, 0x7b, 0xff, 0xdf, 0x7b, 0xff, 0xdf, 0x7a, 0xff, 0xdf, 0x7b, 0xff, 0xe7, 0x9b, 0xff, 0xce, 0xd8, 0xff, 0x74, 0x0e, 0xff, 0x53, 0xae, 0xff, 0x86, 0x59, 0xff, 0x7f, 0x1b, 0xff, 0x7f, 0x1b, 0xff, 0x96, 0xfa, 0xff, 0xb6, 0xd9, 0xff, 0xce, 0x98, 0xff, 0xd6, 0x77, 0xff, 0xd6, 0x77, 0xff, 0xce, 0x98, 0xff, 0xbe, 0xb9, 0xff, 0x9e, 0xfa, 0xff, 0x7f, 0x1b, 0xff, 0x6f, 0x3b, 0xff, 0x66, 0xfb, 0xff, 0x34, 0x50, 0xff, 0x2b, 0x8e, 0xff, 0x33, 0x6d, 0xff, 0x33, 0x6c, 0xff, 0x53, 0x8d, 0xff, 0x5a, 0xeb, 0xff, 0x6b, 0x0c, 0xff, 0x73, 0x0c, 0xcb, 0xc5, 0xb6, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xbb, 0x06, 0x62, 0xcb, 0x94, 0x62, 0xeb, 0xbc, 0x8b, 0xef, 0x9c, 0x6a, 0xca, 0xf8, 0x5b, 0x0b, 0xff, 0x75, 0x13, 0xff, 0x8e, 0x9a, 0xff, 0x76, 0xdb, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x1b, 0xff, 0x7f, 0x1a, 0xff, 0x9e, 0xd9, 0xff, 0xbe, 0xb8, 0xff, 0xce, 0x78, 0xff, 0xce, 0x97, 0xff, 0xbe, 0xb8, 0xff, 0xbe, 0xd9, 0xff, 0xae, 0xda, 0xff, 0x96, 0xfb, 0xff, 0x8f, 0x1a, 0xff, 0x75, 0x75, 0xff, 0x5b, 0x2c, 0xff, 0xce, 0x78, 0xff, 0xe7, 0x9b, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x9a, 0xff, 0xcf, 0x7a, 0xff, 0xd7, 0x9a, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9a, 0xff, 0xdf, 0x9b, 0xff, 0xdf, 0x9a, 0xff, 0xdf, 0x9a, 0xff, 0xdf, 0x7a, 0xff, 0xdf, 0x9a, 0xff, 0xdf, 0x9a, 0xff, 0xe7, 0x7a, 0xff, 0xdf, 0x3a, 0xff, 0x7c, 0x0f, 0xff, 0x5b, 0xef, 0xff, 0x8e, 0x99, 0xff, 0x86, 0xda, 0xff, 0x8e, 0xda, 0xff, 0xa6, 0xb9, 0xff, 0xb6, 0x98, 0xff, 0xbe, 0x98, 0xff, 0xbe, 0x98, 0xff, 0xb6, 0xb9, 0xff, 0xa6, 0xd9, 0xff, 0x86, 0xfa, 0xff, 0x6f, 0x1b, 0xff, 0x67, 0x3c, 0xff, 0x6f, 0x3c, 0xff, 0x77, 0x1b, 0xff, 0x7e, 0xda, 0xff, 0x7e, 0x9a, 0xff, 0x7e, 0x38, 0xff, 0x65, 0x54, 0xff, 0x54, 0x0f, 0xff, 0x4a, 0xca, 0xff, 0x62, 0xca, 0xfd, 0x7b, 0x8d, 0x9d, 0xe7, 0x3c, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x92, 0x12, 0xde, 0xbb, 0x0c, 0x8b, 0xf0, 0x6b, 0x63, 0x0c, 0xfc, 0x5c, 0x30, 0xff, 0x86, 0xfb, 0xff, 0x77, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x7e, 0xfa, 0xff, 0x96, 0xf9, 0xff, 0xa6, 0xd9, 0xff, 0xa6, 0xd9, 0xff, 0xa6, 0xf9, 0xff, 0x9e, 0xb9, 0xff, 0x8d, 0xf7, 0xff, 0x75, 0x75, 0xff, 0x75, 0x53, 0xff, 0x5b, 0xad, 0xff, 0x83, 0xee, 0xff, 0xd6, 0xb9, 0xff, 0xef, 0xbc, 0xff, 0xdf, 0x9b, 0xff, 0xd7, 0x9a, 0xff, 0xd7, 0x9a, 0xff, 0xd7, 0x9a, 0xff, 0xd7, 0x9a, 0xff, 0xcf, 0x7a, 0xff, 0xcf, 0x7b, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x9b, 0xff, 0xcf, 0x7a, 0xff, 0xd7, 0x7b, 0xff, 0xdf, 0x9b, 0xff, 0xdf, 0x7b, 0xff, 0xdf, 0x7a, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9b, 0xff, 0xe7, 0x7b, 0xff, 0xe7, 0x5b, 0xff, 0xc6, 0x37, 0xff, 0x5b, 0x2c, 0xff, 0x6c, 0x92, 0xff, 0x7d, 0x55, 0xff, 0x7d, 0xd7, 0xff, 0x8e, 0x79, 0xff, 0x96, 0xb9, 0xff, 0x9e, 0xda, 0xff, 0x96, 0xda, 0xff, 0x96, 0xda, 0xff, 0x86, 0xfb, 0xff, 0x77, 0x3b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x6f, 0x3c, 0xff, 0x6f, 0x3b, 0xff, 0x77, 0x1b, 0xff, 0x86, 0xda, 0xff, 0x86, 0x38, 0xff, 0x4b, 0x2c, 0xff, 0x52, 0xca, 0xf5, 0x94, 0x71, 0x5e, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x7a, 0x05, 0x94, 0x71, 0x50, 0x62, 0xcb, 0xe5, 0x4b, 0x2d, 0xff, 0x7e, 0x59, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3b, 0xff, 0x77, 0x3b, 0xff, 0x7f, 0x1a, 0xff, 0x7e, 0xfa, 0xff, 0x7e, 0xfa, 0xff, 0x76, 0x79, 0xff, 0x5d, 0x75, 0xff, 0x6d, 0x95, 0xff, 0x74, 0xd2, 0xff, 0x5a, 0xea, 0xff, 0x9c, 0xb1, 0xff, 0xa5, 0x53, 0xff, 0xe7, 0x9c, 0xff, 0xdf, 0x9b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9a, 0xff, 0xd7, 0x9a, 0xff, 0xcf, 0x9a, 0xff, 0xcf, 0x9b, 0xff, 0xcf, 0x9b, 0xff, 0xc7, 0x7b, 0xff, 0xbf, 0x3a, 0xff, 0xc7, 0x5b, 0xff, 0xcf, 0x9b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9b, 0xff, 0xdf, 0x7b, 0xff, 0xce, 0x98, 0xff, 0x84, 0x2f, 0xff, 0x6b, 0x6c, 0xff, 0x53, 0x0b, 0xff, 0x5c, 0x51, 0xff, 0x4c, 0x71, 0xff, 0x4d, 0x14, 0xff, 0x76, 0xda, 0xff, 0x77, 0x1b, 0xff, 0x77, 0x1b, 0xff, 0x77, 0x1b, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x7d, 0xff, 0x6f, 0x3c, 0xff, 0x77, 0x1b, 0xff, 0x6d, 0xb5, 0xff, 0x42, 0xca, 0xff, 0x6b, 0x0b, 0xd4, 0xcd, 0xf7, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x74, 0x1b, 0x73, 0x2c, 0x97, 0x62, 0xca, 0xf2, 0x4a, 0xcb, 0xff, 0x65, 0x14, 0xff, 0x7f, 0x1c, 0xff, 0x6f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3b, 0xff, 0x67, 0x1b, 0xff, 0x67, 0x1b, 0xff, 0x6f, 0x1c, 0xff, 0x7e, 0xfb, 0xff, 0x85, 0xd7, 0xff, 0x5a, 0xeb, 0xff, 0xef, 0x7b, 0xff, 0xe7, 0xbc, 0xff, 0xe7, 0x9c, 0xff, 0xdf, 0x9b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9b, 0xff, 0xcf, 0x9b, 0xff, 0xcf, 0xbb, 0xff, 0xc7, 0x9b, 0xff, 0xb7, 0x3a, 0xff, 0xae, 0xd9, 0xff, 0xae, 0xb9, 0xff, 0xae, 0xb9, 0xff, 0xb7, 0x1a, 0xff, 0xbf, 0x7b, 0xff, 0xcf, 0x9b, 0xff, 0xcf, 0x7b, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9b, 0xff, 0xdf, 0x7b, 0xff, 0xdf, 0x3a, 0xff, 0xe7, 0x1a, 0xff, 0xad, 0x33, 0xff, 0x5b, 0x8d, 0xff, 0x8e, 0xb9, 0xff, 0x77, 0x3b, 0xff, 0x6f, 0x3c, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x7f, 0x1b, 0xff, 0x64, 0xb2, 0xff, 0x5a, 0xcb, 0xfe, 0x6b, 0x0b, 0xd6, 0x8c, 0x2f, 0x4c, 0xff, 0xf5, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x9c, 0xb2, 0x2f, 0x6a, 0xeb, 0xc4, 0x5a, 0xa9, 0xfd, 0x5a, 0xca, 0xff, 0x4b, 0xef, 0xff, 0x7e, 0xfb, 0xff, 0x6f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x1b, 0xff, 0x75, 0xb6, 0xff, 0x4a, 0xca, 0xff, 0xa5, 0x33, 0xff, 0x95, 0x73, 0xff, 0xdf, 0xbc, 0xff, 0xdf, 0x9c, 0xff, 0xd7, 0x9c, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0x9c, 0xff, 0xbf, 0x5b, 0xff, 0xae, 0xf9, 0xff, 0xa6, 0x98, 0xff, 0x8d, 0x74, 0xff, 0x85, 0x33, 0xff, 0xae, 0x78, 0xff, 0xa6, 0x98, 0xff, 0x9e, 0xd9, 0xff, 0xaf, 0x1a, 0xff, 0xbf, 0x5b, 0xff, 0xc7, 0x7b, 0xff, 0xc7, 0x7b, 0xff, 0xcf, 0x9b, 0xff, 0xcf, 0x9b, 0xff, 0xb6, 0x57, 0xff, 0xc6, 0x57, 0xff, 0xad, 0x53, 0xff, 0x4b, 0x4c, 0xff, 0x7e, 0xda, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x7c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x57, 0x7d, 0xff, 0x57, 0x7d, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x6f, 0x3c, 0xff, 0x86, 0xba, 0xff, 0x4b, 0x4d, 0xff, 0x5a, 0xa9, 0xff, 0x5a, 0x69, 0xec, 0x83, 0xae, 0x6f, 0xce, 0x59, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x9c, 0x72, 0x38, 0x5a, 0xaa, 0xd4, 0x63, 0x0b, 0xfe, 0x52, 0x89, 0xff, 0x4a, 0xca, 0xff, 0x76, 0x17, 0xff, 0x6f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x6e, 0xfa, 0xff, 0x6d, 0x75, 0xff, 0x4a, 0x8a, 0xff, 0x94, 0xd2, 0xff, 0xb6, 0xb8, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7c, 0xff, 0xc7, 0x7b, 0xff, 0xb7, 0x3a, 0xff, 0xae, 0xd9, 0xff, 0xa6, 0x98, 0xff, 0xae, 0x98, 0xff, 0x84, 0xf2, 0xff, 0x4b, 0x2c, 0xff, 0x53, 0x4c, 0xff, 0x7c, 0xd2, 0xff, 0x9e, 0x58, 0xff, 0x96, 0x78, 0xff, 0x96, 0x98, 0xff, 0x9e, 0xb9, 0xff, 0x9e, 0xd9, 0xff, 0xa6, 0xf8, 0xff, 0xa6, 0xf9, 0xff, 0xae, 0xf9, 0xff, 0x95, 0x95, 0xff, 0x6b, 0xad, 0xff, 0x63, 0x2b, 0xff, 0x4b, 0x4c, 0xff, 0x86, 0xb9, 0xff, 0x77, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x5c, 0xff, 0x7f, 0x1c, 0xff, 0x65, 0x13, 0xff, 0x4a, 0xaa, 0xff, 0x5a, 0x69, 0xff, 0x62, 0xab, 0xf5, 0x73, 0x4d, 0x86, 0xd6, 0x9a, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xa4, 0xf3, 0x36, 0x5a, 0xaa, 0xd8, 0x5b, 0x0b, 0xff, 0x73, 0xee, 0xff, 0x4a, 0x89, 0xff, 0x4c, 0x0f, 0xff, 0x7f, 0x1b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x6f, 0x1b, 0xff, 0x5d, 0xb5, 0xff, 0x4b, 0x8e, 0xff, 0x53, 0x0c, 0xff, 0x8c, 0xf3, 0xff, 0xb6, 0x98, 0xff, 0xae, 0xd9, 0xff, 0xa6, 0xd9, 0xff, 0xa6, 0xb9, 0xff, 0xa6, 0x98, 0xff, 0xae, 0x98, 0xff, 0xa6, 0x17, 0xff, 0x74, 0x71, 0xff, 0x53, 0x4d, 0xff, 0x74, 0xb2, 0xff, 0x7c, 0xd3, 0xff, 0x4b, 0x4c, 0xff, 0x6c, 0x51, 0xff, 0x9e, 0x58, 0xff, 0x9e, 0x99, 0xff, 0x96, 0x99, 0xff, 0x8e, 0x98, 0xff, 0x96, 0x98, 0xff, 0x96, 0x98, 0xff, 0x96, 0x98, 0xff, 0xae, 0x98, 0xff, 0xbe, 0x78, 0xff, 0x73, 0xce, 0xff, 0x4b, 0x4c, 0xff, 0x54, 0x91, 0xff, 0x76, 0x79, 0xff, 0x77, 0x3c, 0xff, 0x67, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x1c, 0xff, 0x7e, 0xb9, 0xff, 0x43, 0x2b, 0xff, 0x5a, 0xcb, 0xff, 0x7c, 0x0f, 0xff, 0x5b, 0x0b, 0xf7, 0x7b, 0xae, 0x86, 0xcd, 0x75, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x55, 0x28, 0x5a, 0xaa, 0xce, 0x4a, 0xeb, 0xff, 0x85, 0x13, 0xff, 0x74, 0x30, 0xff, 0x3a, 0xaa, 0xff, 0x65, 0xd6, 0xff, 0x6f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x1b, 0xff, 0x4d, 0x95, 0xff, 0x4d, 0x34, 0xff, 0x7e, 0x58, 0xff, 0x75, 0x55, 0xff, 0x42, 0xcb, 0xff, 0x73, 0xef, 0xff, 0x95, 0x74, 0xff, 0x9d, 0xd6, 0xff, 0x9d, 0xd6, 0xff, 0x9d, 0x95, 0xff, 0x84, 0xd2, 0xff, 0x5b, 0xae, 0xff, 0x5c, 0x10, 0xff, 0x75, 0x55, 0xff, 0x75, 0xb7, 0xff, 0x75, 0xb6, 0xff, 0x6d, 0x13, 0xff, 0x53, 0x8e, 0xff, 0x53, 0x6e, 0xff, 0x85, 0x34, 0xff, 0x9e, 0x37, 0xff, 0xa6, 0x98, 0xff, 0xa6, 0x78, 0xff, 0xa6, 0x99, 0xff, 0xa6, 0x99, 0xff, 0xae, 0x77, 0xff, 0x8d, 0x12, 0xff, 0x4b, 0x4c, 0xff, 0x7d, 0x95, 0xff, 0x65, 0x95, 0xff, 0x34, 0x51, 0xff, 0x5e, 0x38, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x3d, 0xff, 0x6f, 0x3b, 0xff, 0x65, 0x33, 0xff, 0x4a, 0xeb, 0xff, 0x8d, 0x54, 0xff, 0x7c, 0x91, 0xff, 0x5b, 0x0b, 0xf7, 0x73, 0x6d, 0x80, 0xde, 0xfb, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x98, 0x10, 0x62, 0xeb, 0xb0, 0x42, 0xca, 0xfe, 0x75, 0x13, 0xff, 0x9e, 0x58, 0xff, 0x3a, 0xeb, 0xff, 0x43, 0x8e, 0xff, 0x76, 0xda, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5e, 0xfb, 0xff, 0x66, 0x9a, 0xff, 0x6f, 0x1b, 0xff, 0x67, 0x3b, 0xff, 0x76, 0xfa, 0xff, 0x4b, 0xae, 0xff, 0x5a, 0x8a, 0xff, 0x62, 0xeb, 0xff, 0x63, 0x2c, 0xff, 0x6b, 0x0c, 0xff, 0x62, 0xeb, 0xff, 0x5b, 0x6d, 0xff, 0x75, 0x14, 0xff, 0x6d, 0xb7, 0xff, 0x65, 0xf8, 0xff, 0x5e, 0x39, 0xff, 0x5e, 0x38, 0xff, 0x65, 0xd7, 0xff, 0x75, 0x55, 0xff, 0x5c, 0x31, 0xff, 0x43, 0x2c, 0xff, 0x5b, 0x4d, 0xff, 0x74, 0x0f, 0xff, 0x84, 0x71, 0xff, 0x8c, 0xd3, 0xff, 0x84, 0x92, 0xff, 0x6b, 0xad, 0xff, 0x4a, 0xea, 0xff, 0x75, 0x74, 0xff, 0x87, 0x1b, 0xff, 0x77, 0x1b, 0xff, 0x6e, 0xdb, 0xff, 0x45, 0xd6, 0xff, 0x5f, 0x3b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x6f, 0x5c, 0xff, 0x7e, 0x99, 0xff, 0x4b, 0x6d, 0xff, 0x5b, 0xcf, 0xff, 0xa6, 0x99, 0xff, 0x64, 0x30, 0xff, 0x4a, 0xeb, 0xf2, 0x7b, 0xae, 0x67, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x7a, 0x05, 0x7b, 0x8d, 0x83, 0x52, 0xca, 0xfa, 0x54, 0x70, 0xff, 0x8e, 0xba, 0xff, 0x7d, 0x75, 0xff, 0x2a, 0xaa, 0xff, 0x65, 0x34, 0xff, 0x6f, 0x1b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x65, 0x34, 0xff, 0x6b, 0x6d, 0xff, 0xde, 0xba, 0xff, 0xd6, 0x79, 0xff, 0xde, 0x99, 0xff, 0x94, 0x71, 0xff, 0x6c, 0x51, 0xff, 0x75, 0xd7, 0xff, 0x66, 0x19, 0xff, 0x5e, 0x5a, 0xff, 0x66, 0x9a, 0xff, 0x5e, 0xba, 0xff, 0x5e, 0x59, 0xff, 0x65, 0xd8, 0xff, 0x65, 0xb7, 0xff, 0x75, 0x55, 0xff, 0x64, 0x10, 0xff, 0x63, 0x0b, 0xf9, 0x6b, 0x2c, 0xc8, 0x63, 0x0c, 0xb7, 0x73, 0x4d, 0xa3, 0x83, 0xae, 0xa3, 0x4b, 0x0b, 0xfb, 0x86, 0xb9, 0xff, 0x6f, 0x5c, 0xff, 0x67, 0x7d, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x77, 0x3b, 0xff, 0x5c, 0xd2, 0xff, 0x43, 0x2c, 0xff, 0x8e, 0x17, 0xff, 0x96, 0x79, 0xff, 0x43, 0x4c, 0xff, 0x4a, 0xaa, 0xe4, 0x9c, 0x92, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x10, 0x44, 0x5a, 0xaa, 0xec, 0x4b, 0x8d, 0xff, 0x76, 0x78, 0xff, 0x8e, 0xdb, 0xff, 0x54, 0x10, 0xff, 0x32, 0xeb, 0xff, 0x76, 0x79, 0xff, 0x67, 0x3b, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x65, 0x95, 0xff, 0x63, 0x6d, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0x30, 0xff, 0x64, 0xd3, 0xff, 0x6e, 0x59, 0xff, 0x5e, 0xba, 0xff, 0x66, 0xfb, 0xff, 0x67, 0x1c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x1c, 0xff, 0x66, 0xdb, 0xff, 0x5e, 0x7a, 0xff, 0x66, 0x17, 0xff, 0x75, 0x75, 0xff, 0x5b, 0x4c, 0xe6, 0xc6, 0x18, 0x20, 0xff, 0xff, 0x04, 0xff, 0xff, 0x03, 0x8c, 0x30, 0x39, 0x43, 0x4c, 0xf6, 0x7e, 0xfb, 0xff, 0x67, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x5b, 0xff, 0x6d, 0xf6, 0xff, 0x3b, 0x0b, 0xff, 0x65, 0x13, 0xff, 0x8e, 0xda, 0xff, 0x75, 0xd6, 0xff, 0x42, 0xcb, 0xfe, 0x63, 0x0b, 0xaf, 0xde, 0xbb, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0x18, 0x0c, 0x6b, 0x0c, 0xb8, 0x52, 0xeb, 0xff, 0x75, 0xf7, 0xff, 0x7e, 0xfb, 0xff, 0x86, 0x9a, 0xff, 0x43, 0x4d, 0xff, 0x4c, 0x10, 0xff, 0x76, 0xda, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x57, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x6d, 0xd7, 0xff, 0x52, 0xec, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0x63, 0x4d, 0xff, 0x6d, 0x95, 0xff, 0x67, 0x1b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x6e, 0xdb, 0xff, 0x86, 0x59, 0xff, 0x53, 0xae, 0xe9, 0xad, 0x35, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x4d, 0x50, 0x4b, 0xef, 0xf9, 0x76, 0xfb, 0xff, 0x67, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x3b, 0xff, 0x76, 0x99, 0xff, 0x3b, 0x4c, 0xff, 0x4b, 0xef, 0xff, 0x86, 0xda, 0xff, 0x7e, 0xfb, 0xff, 0x5c, 0xb2, 0xff, 0x52, 0xca, 0xf7, 0x7b, 0xce, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x0f, 0x4d, 0x5a, 0xeb, 0xf5, 0x5c, 0x71, 0xff, 0x7e, 0xdb, 0xff, 0x76, 0xfb, 0xff, 0x75, 0xf7, 0xff, 0x3b, 0x2c, 0xff, 0x65, 0x33, 0xff, 0x77, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5c, 0xff, 0x76, 0x58, 0xff, 0x4b, 0x0c, 0xff, 0xf7, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0xff, 0x4b, 0x0c, 0xff, 0x76, 0x17, 0xff, 0x5f, 0x3b, 0xff, 0x57, 0x7c, 0xff, 0x5f, 0x3d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x1b, 0xff, 0x7e, 0xda, 0xff, 0x5c, 0x10, 0xef, 0x8c, 0x92, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x63, 0x2c, 0x77, 0x5c, 0x91, 0xfc, 0x76, 0xfb, 0xff, 0x67, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x3c, 0xff, 0x76, 0xfa, 0xff, 0x44, 0x0f, 0xff, 0x43, 0x6d, 0xff, 0x76, 0x78, 0xff, 0x77, 0x1b, 0xff, 0x86, 0x79, 0xff, 0x4b, 0x2c, 0xff, 0x5b, 0x0b, 0xc8, 0xce, 0x57, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xfb, 0x07, 0x62, 0xcb, 0xb3, 0x53, 0x0c, 0xff, 0x7e, 0x18, 0xff, 0x6f, 0x1c, 0xff, 0x77, 0x1c, 0xff, 0x65, 0x34, 0xff, 0x3b, 0x4c, 0xff, 0x6d, 0xf7, 0xff, 0x6f, 0x5c, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5c, 0xff, 0x7e, 0xba, 0xff, 0x4b, 0x8e, 0xff, 0xd6, 0xda, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1b, 0xff, 0x4b, 0x0c, 0xff, 0x76, 0x79, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x3c, 0xff, 0x76, 0xfb, 0xff, 0x5c, 0x71, 0xf8, 0x84, 0x10, 0x4f, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x53, 0x2b, 0x8d, 0x65, 0x74, 0xfe, 0x6f, 0x3b, 0xff, 0x67, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x77, 0x1b, 0xff, 0x5c, 0xf2, 0xff, 0x43, 0x0c, 0xff, 0x76, 0x17, 0xff, 0x6f, 0x5c, 0xff, 0x7f, 0x3c, 0xff, 0x64, 0xf3, 0xff, 0x52, 0xeb, 0xf3, 0x8c, 0x30, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xef, 0x2c, 0x52, 0x8a, 0xe9, 0x53, 0xcf, 0xff, 0x7e, 0xda, 0xff, 0x6f, 0x3c, 0xff, 0x77, 0x1b, 0xff, 0x54, 0x91, 0xff, 0x3b, 0x4c, 0xff, 0x76, 0x99, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5c, 0xff, 0x7f, 0x1b, 0xff, 0x5c, 0x51, 0xff, 0xb5, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9a, 0xff, 0x4b, 0x6d, 0xff, 0x7e, 0xda, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x76, 0xfb, 0xff, 0x64, 0xd2, 0xfc, 0x7b, 0xcf, 0x65, 0x00, 0x00, 0x00, 0xb5, 0x99, 0x0d, 0x4a, 0xeb, 0xc4, 0x76, 0x17, 0xff, 0x6f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x1b, 0xff, 0x75, 0xd6, 0xff, 0x3b, 0x2c, 0xff, 0x6d, 0xb6, 0xff, 0x6f, 0x3c, 0xff, 0x6f, 0x5c, 0xff, 0x7e, 0x79, 0xff, 0x4b, 0x0b, 0xfd, 0x73, 0x8e, 0x89, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xf3, 0x2e, 0xc5, 0xd7, 0x19, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xac, 0xb3, 0x26, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x4d, 0x4e, 0x4a, 0x8a, 0xfa, 0x64, 0xf3, 0xff, 0x77, 0x1b, 0xff, 0x67, 0x3c, 0xff, 0x7e, 0xdb, 0xff, 0x4b, 0xef, 0xff, 0x43, 0x8d, 0xff, 0x7e, 0xfa, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5d, 0xff, 0x77, 0x3c, 0xff, 0x65, 0x75, 0xff, 0x84, 0x30, 0xff, 0xff, 0xbe, 0xff, 0xc6, 0x38, 0xff, 0x4b, 0xae, 0xff, 0x7e, 0xfa, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x1b, 0xff, 0x65, 0x13, 0xfe, 0x73, 0xcf, 0x79, 0x00, 0x00, 0x00, 0x7b, 0xf0, 0x3f, 0x4b, 0x4d, 0xf2, 0x7e, 0xba, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x6f, 0x3c, 0xff, 0x76, 0x58, 0xff, 0x3b, 0x2c, 0xff, 0x65, 0x55, 0xff, 0x77, 0x3c, 0xff, 0x6f, 0x5c, 0xff, 0x7e, 0xfb, 0xff, 0x4b, 0xce, 0xff, 0x63, 0x2c, 0xb7, 0xc5, 0x14, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x92, 0x52, 0x94, 0x91, 0x6c, 0xff, 0xff, 0x01, 
-  0x00, 0x00, 0x00, 0xde, 0x59, 0x0e, 0x7b, 0x6d, 0x8d, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x0c, 0x66, 0x4a, 0xaa, 0xfc, 0x6d, 0xb6, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x7e, 0x99, 0xff, 0x4b, 0xae, 0xff, 0x4b, 0xae, 0xff, 0x7f, 0x1b, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x76, 0x99, 0xff, 0x53, 0x4d, 0xff, 0xd6, 0x59, 0xff, 0xbd, 0xd6, 0xff, 0x5c, 0x0f, 0xff, 0x7f, 0x3b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x7c, 0xff, 0x6f, 0x5c, 0xff, 0x65, 0x95, 0xff, 0x73, 0xef, 0xa2, 0xff, 0xfd, 0x0d, 0x53, 0x2c, 0xa7, 0x5c, 0x91, 0xfe, 0x77, 0x3c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x7e, 0x9a, 0xff, 0x3b, 0x6d, 0xff, 0x5c, 0xf3, 0xff, 0x77, 0x1b, 0xff, 0x67, 0x5c, 0xff, 0x77, 0x3b, 0xff, 0x5c, 0x92, 0xff, 0x5a, 0xeb, 0xdc, 0xa5, 0x14, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xb2, 0x28, 0x83, 0xef, 0xa1, 0xd6, 0x7a, 0x0a, 
-  0x00, 0x00, 0x00, 0x9c, 0x72, 0x3c, 0x83, 0x8e, 0xa5, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x73, 0x4d, 0x77, 0x4a, 0xaa, 0xfd, 0x6d, 0xd7, 0xff, 0x5f, 0x1b, 0xff, 0x67, 0x3c, 0xff, 0x6d, 0xf7, 0xff, 0x43, 0x4c, 0xff, 0x4b, 0xae, 0xff, 0x7f, 0x1b, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x77, 0x1b, 0xff, 0x65, 0x13, 0xff, 0x73, 0xce, 0xff, 0x9c, 0xd2, 0xff, 0x5c, 0x71, 0xff, 0x7f, 0x5b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x57, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x7c, 0xff, 0x6f, 0x5c, 0xff, 0x75, 0xf7, 0xff, 0x6b, 0xae, 0xd8, 0xa5, 0x14, 0x6f, 0x4a, 0xeb, 0xf3, 0x75, 0xf7, 0xff, 0x67, 0x3b, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x7e, 0xda, 0xff, 0x3b, 0x6d, 0xff, 0x54, 0x91, 0xff, 0x76, 0xfb, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x3c, 0xff, 0x64, 0xf3, 0xff, 0x5a, 0xcb, 0xe5, 0x9c, 0xf2, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x14, 0x18, 0x7b, 0xae, 0xbf, 0xbd, 0xb6, 0x22, 
-  0x00, 0x00, 0x00, 0x94, 0x30, 0x70, 0x83, 0xaf, 0xa6, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x73, 0x2c, 0x77, 0x4a, 0xaa, 0xfd, 0x6d, 0xf7, 0xff, 0x67, 0x1c, 0xff, 0x66, 0xfb, 0xff, 0x65, 0xb6, 0xff, 0x3b, 0x0b, 0xff, 0x4b, 0xae, 0xff, 0x7e, 0xfb, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x3c, 0xff, 0x7e, 0xda, 0xff, 0x54, 0x91, 0xff, 0x33, 0x0b, 0xff, 0x6d, 0xb6, 0xff, 0x77, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x76, 0x79, 0xff, 0x4b, 0x8d, 0xfd, 0x53, 0x8d, 0xf8, 0x64, 0xb3, 0xff, 0x76, 0xda, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x7e, 0xda, 0xff, 0x3b, 0x6d, 0xff, 0x4c, 0x30, 0xff, 0x6e, 0xda, 0xff, 0x67, 0x5c, 0xff, 0x77, 0x3c, 0xff, 0x65, 0x34, 0xff, 0x5a, 0xeb, 0xe7, 0x9c, 0xb1, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x75, 0x12, 0x7b, 0x8e, 0xc8, 0xa4, 0xf3, 0x3b, 
-  0x00, 0x00, 0x00, 0x94, 0x10, 0x89, 0x8b, 0xef, 0xa7, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x2c, 0x59, 0x4a, 0xca, 0xfb, 0x6d, 0x96, 0xff, 0x6e, 0xfc, 0xff, 0x66, 0xfb, 0xff, 0x65, 0xb6, 0xff, 0x3b, 0x0b, 0xff, 0x43, 0x6d, 0xff, 0x7e, 0xfb, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x3c, 0xff, 0x7e, 0xfb, 0xff, 0x76, 0x79, 0xff, 0x77, 0x1b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x3b, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x3b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x3c, 0xff, 0x77, 0x1b, 0xff, 0x65, 0x94, 0xff, 0x5d, 0x74, 0xff, 0x76, 0xdb, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x76, 0xb9, 0xff, 0x3b, 0x4d, 0xff, 0x4c, 0x30, 0xff, 0x6e, 0xb9, 0xff, 0x67, 0x3b, 0xff, 0x77, 0x1b, 0xff, 0x64, 0xb2, 0xff, 0x5b, 0x0b, 0xe1, 0xac, 0xf2, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x75, 0x12, 0x7b, 0x6d, 0xcd, 0xa4, 0xb2, 0x48, 
-  0x00, 0x00, 0x00, 0x94, 0x10, 0x85, 0x93, 0xf0, 0xaf, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x6d, 0x40, 0x52, 0xea, 0xf5, 0x64, 0xd3, 0xff, 0x7e, 0xbb, 0xff, 0x6e, 0x9a, 0xff, 0x65, 0xb6, 0xff, 0x3b, 0x2b, 0xff, 0x3b, 0x2c, 0xff, 0x76, 0xb9, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x6f, 0x5c, 0xff, 0x6f, 0x3c, 0xff, 0x6f, 0x3b, 0xff, 0x77, 0x3b, 0xff, 0x87, 0x3b, 0xff, 0x87, 0x5c, 0xff, 0x87, 0x5c, 0xff, 0x8f, 0x7c, 0xff, 0x87, 0x5c, 0xff, 0x7f, 0x3b, 0xff, 0x6f, 0x3b, 0xff, 0x6f, 0x3b, 0xff, 0x6f, 0x1b, 0xff, 0x77, 0x3b, 0xff, 0x6f, 0x5b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3d, 0xff, 0x5f, 0x3d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3b, 0xff, 0x76, 0x58, 0xff, 0x3b, 0x2c, 0xff, 0x54, 0x51, 0xff, 0x66, 0x59, 0xff, 0x5e, 0xba, 0xff, 0x76, 0xda, 0xff, 0x4b, 0xef, 0xff, 0x63, 0x0c, 0xc5, 0xa4, 0xf4, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x75, 0x18, 0x73, 0x8d, 0xd2, 0xa4, 0xf3, 0x3f, 
-  0x00, 0x00, 0x00, 0x94, 0x30, 0x6d, 0x8b, 0xcf, 0xbe, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x0f, 0x1a, 0x5a, 0xaa, 0xdd, 0x53, 0xcf, 0xff, 0x76, 0x79, 0xff, 0x66, 0x79, 0xff, 0x5d, 0x96, 0xff, 0x3b, 0x2c, 0xff, 0x3a, 0xeb, 0xff, 0x6e, 0x38, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x3d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x77, 0x1b, 0xff, 0x87, 0x3b, 0xff, 0x97, 0x9c, 0xff, 0xa7, 0xdd, 0xff, 0xaf, 0xfd, 0xff, 0xbf, 0xfd, 0xff, 0xbf, 0xfe, 0xff, 0xbf, 0xfe, 0xff, 0xbf, 0xfe, 0xff, 0xbf, 0xfe, 0xff, 0xb7, 0xfe, 0xff, 0xb7, 0xfe, 0xff, 0xa7, 0xdd, 0xff, 0x97, 0x9c, 0xff, 0x87, 0x5b, 0xff, 0x77, 0x1b, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3c, 0xff, 0x6e, 0xfb, 0xff, 0x75, 0xd7, 0xff, 0x43, 0x4d, 0xff, 0x54, 0xb2, 0xff, 0x66, 0x38, 0xff, 0x5e, 0x58, 0xff, 0x6d, 0xf7, 0xff, 0x43, 0x0b, 0xfe, 0x62, 0xeb, 0x9e, 0xfd, 0x75, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xb3, 0x24, 0x73, 0x8d, 0xd5, 0xad, 0x75, 0x2a, 
-  0x00, 0x00, 0x00, 0x9c, 0x92, 0x44, 0x8b, 0xcf, 0xcf, 0xbd, 0x75, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x04, 0x62, 0xaa, 0xa2, 0x53, 0x0b, 0xff, 0x6d, 0x75, 0xff, 0x66, 0x18, 0xff, 0x5d, 0x76, 0xff, 0x43, 0x8e, 0xff, 0x32, 0xaa, 0xff, 0x65, 0xb6, 0xff, 0x5e, 0xfb, 0xff, 0x5f, 0x3d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x87, 0x3b, 0xff, 0xa7, 0xbd, 0xff, 0xbf, 0xfe, 0xff, 0xc7, 0xfd, 0xff, 0xc7, 0xfd, 0xff, 0xcf, 0xfc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xc7, 0xdd, 0xff, 0xbf, 0xfd, 0xff, 0xbf, 0xfe, 0xff, 0xaf, 0xdd, 0xff, 0x97, 0x9d, 0xff, 0x77, 0x3b, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x6e, 0xba, 0xff, 0x6d, 0x54, 0xff, 0x43, 0x4d, 0xff, 0x65, 0x34, 0xff, 0x6e, 0x38, 0xff, 0x6e, 0x38, 0xff, 0x64, 0x92, 0xff, 0x4a, 0x8a, 0xf7, 0x73, 0x6d, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x71, 0x57, 0x7b, 0xae, 0xbf, 0xd6, 0x77, 0x0f, 
-  0x00, 0x00, 0x00, 0xbd, 0x14, 0x18, 0x8c, 0x10, 0xcb, 0x9c, 0x92, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xcf, 0x42, 0x5a, 0xaa, 0xef, 0x53, 0x8e, 0xff, 0x6d, 0x76, 0xff, 0x65, 0x36, 0xff, 0x5c, 0x30, 0xff, 0x32, 0xaa, 0xff, 0x5c, 0xf3, 0xff, 0x5e, 0x99, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x5b, 0xff, 0x7f, 0x3b, 0xff, 0x9f, 0xbc, 0xff, 0xb7, 0xfd, 0xff, 0xbf, 0xfc, 0xff, 0xcf, 0xfc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xfb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xc7, 0xfd, 0xff, 0xbf, 0xfd, 0xff, 0xb7, 0xfe, 0xff, 0x9f, 0x9d, 0xff, 0x77, 0x1b, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x1b, 0xff, 0x6e, 0x79, 0xff, 0x5c, 0x91, 0xff, 0x43, 0x4c, 0xff, 0x75, 0x95, 0xff, 0x76, 0x17, 0xff, 0x75, 0x95, 0xff, 0x4b, 0x0c, 0xff, 0x5a, 0xaa, 0xd1, 0xac, 0xb3, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x83, 0xcf, 0x91, 0x84, 0x0f, 0x87, 0xff, 0xff, 0x02, 
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x94, 0x51, 0x87, 0x94, 0x51, 0x89, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xbb, 0x06, 0x62, 0x8a, 0x91, 0x52, 0xaa, 0xfb, 0x5b, 0xd0, 0xff, 0x7c, 0xf4, 0xff, 0x74, 0x92, 0xff, 0x3a, 0xaa, 0xff, 0x54, 0x50, 0xff, 0x66, 0x18, 0xff, 0x5e, 0xfb, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3b, 0xff, 0x7f, 0x3b, 0xff, 0xaf, 0xdd, 0xff, 0xc7, 0xfd, 0xff, 0xc7, 0xfc, 0xff, 0xcf, 0xfb, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xc7, 0xfd, 0xff, 0xc7, 0xfd, 0xff, 0xaf, 0xdd, 0xff, 0x7f, 0x1b, 0xff, 0x6f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5d, 0xff, 0x57, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x3c, 0xff, 0x5e, 0xfa, 0xff, 0x6e, 0x17, 0xff, 0x43, 0x8d, 0xff, 0x4b, 0x4c, 0xff, 0x8d, 0x95, 0xff, 0x85, 0x95, 0xff, 0x5b, 0xce, 0xff, 0x52, 0xab, 0xee, 0x73, 0x6d, 0x58, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x13, 0x1e, 0x6b, 0x0c, 0xc2, 0x9c, 0xb2, 0x32, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x54, 0x20, 0x83, 0xae, 0xb1, 0xa4, 0xb3, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x53, 0x13, 0x62, 0xcb, 0x9b, 0x5a, 0xcb, 0xf6, 0x63, 0x4d, 0xff, 0x7c, 0x51, 0xff, 0x5b, 0x0b, 0xff, 0x4b, 0x6d, 0xff, 0x6d, 0xd7, 0xff, 0x5e, 0x9a, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3b, 0xff, 0x7f, 0x3b, 0xff, 0xb7, 0xdd, 0xff, 0xcf, 0xfd, 0xff, 0xd7, 0xfc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xfc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xfc, 0xff, 0xcf, 0xfc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xc7, 0xdd, 0xff, 0xb7, 0xdd, 0xff, 0x7f, 0x1b, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x1c, 0xff, 0x5f, 0x3c, 0xff, 0x5e, 0x99, 0xff, 0x65, 0x75, 0xff, 0x42, 0xcb, 0xff, 0x6b, 0x8d, 0xff, 0x8c, 0xd2, 0xff, 0x5b, 0x2c, 0xff, 0x52, 0xcb, 0xf0, 0x73, 0xae, 0x67, 0xd6, 0x7a, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x73, 0x6d, 0x75, 0x7b, 0xae, 0x7f, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x8b, 0xcf, 0x5a, 0x83, 0xaf, 0x78, 0xd6, 0x7a, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x34, 0x0b, 0x62, 0xeb, 0x6c, 0x5a, 0xcb, 0xd4, 0x62, 0xcb, 0xf9, 0x5a, 0xaa, 0xff, 0x4a, 0xcb, 0xff, 0x6d, 0x55, 0xff, 0x5e, 0x18, 0xff, 0x5e, 0xda, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x77, 0x1a, 0xff, 0xaf, 0xdd, 0xff, 0xc7, 0xfd, 0xff, 0xcf, 0xdc, 0xff, 0xd7, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xc7, 0xfd, 0xff, 0xaf, 0xdd, 0xff, 0x77, 0x1a, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5e, 0xfb, 0xff, 0x5e, 0xba, 0xff, 0x5e, 0x38, 0xff, 0x5c, 0x72, 0xff, 0x52, 0x8a, 0xff, 0x5a, 0xaa, 0xff, 0x5a, 0x8a, 0xfb, 0x62, 0xcb, 0xd9, 0x73, 0x6d, 0x5f, 0xd6, 0x7a, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xd2, 0x20, 0x73, 0x6d, 0x83, 0xc5, 0xf8, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x75, 0x06, 0x83, 0x8f, 0x5a, 0x94, 0x31, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x8b, 0xef, 0x19, 0x73, 0x2d, 0x61, 0x62, 0xaa, 0xb9, 0x52, 0x8a, 0xfb, 0x5c, 0x30, 0xff, 0x6d, 0xd7, 0xff, 0x5e, 0x38, 0xff, 0x5e, 0xbb, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x1b, 0xff, 0x9f, 0x7c, 0xff, 0xc7, 0xfd, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xfd, 0xff, 0xbf, 0xfc, 0xff, 0x97, 0x9c, 0xff, 0x67, 0x3b, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x1b, 0xff, 0x56, 0xba, 0xff, 0x5e, 0x38, 0xff, 0x6d, 0x96, 0xff, 0x4b, 0x6d, 0xff, 0x5a, 0xaa, 0xf8, 0x62, 0x8a, 0xbc, 0x7b, 0x4d, 0x6b, 0x9c, 0xb2, 0x21, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xb2, 0x0e, 0xad, 0xb5, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x04, 0x94, 0x92, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x16, 0x52, 0x89, 0xbb, 0x4a, 0xec, 0xfe, 0x75, 0x55, 0xff, 0x5d, 0xd7, 0xff, 0x56, 0x59, 0xff, 0x5e, 0xdb, 0xff, 0x67, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x7f, 0x3b, 0xff, 0xb7, 0xfd, 0xff, 0xc7, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xc7, 0xdc, 0xff, 0xb7, 0xfd, 0xff, 0x7f, 0x5b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x1c, 0xff, 0x56, 0xda, 0xff, 0x56, 0x58, 0xff, 0x5d, 0xd6, 0xff, 0x64, 0xd3, 0xff, 0x52, 0xeb, 0xfd, 0x6b, 0x2c, 0x9b, 0xce, 0x59, 0x0e, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xae, 0x47, 0x52, 0xaa, 0xed, 0x64, 0x10, 0xff, 0x6d, 0x96, 0xff, 0x55, 0xd7, 0xff, 0x56, 0x38, 0xff, 0x5e, 0xfb, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x97, 0x9c, 0xff, 0xbf, 0xfd, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xfc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xc7, 0xfd, 0xff, 0x9f, 0xbd, 0xff, 0x6f, 0x3b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3c, 0xff, 0x5e, 0xfb, 0xff, 0x56, 0x9a, 0xff, 0x4e, 0x38, 0xff, 0x55, 0xd6, 0xff, 0x6d, 0x74, 0xff, 0x53, 0x8d, 0xff, 0x5a, 0xcb, 0xdf, 0x9c, 0xb2, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0x07, 0x62, 0xeb, 0xa2, 0x53, 0x0c, 0xfd, 0x6c, 0xf3, 0xff, 0x5d, 0x96, 0xff, 0x55, 0xd7, 0xff, 0x4e, 0x38, 0xff, 0x5e, 0xdb, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x7c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x5b, 0xff, 0x7f, 0x3b, 0xff, 0xb7, 0xfd, 0xff, 0xc7, 0xfd, 0xff, 0xd7, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xb7, 0xfe, 0xff, 0x7f, 0x3b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x3c, 0xff, 0x5e, 0xfb, 0xff, 0x56, 0x9a, 0xff, 0x4e, 0x18, 0xff, 0x4d, 0xb7, 0xff, 0x5d, 0x95, 0xff, 0x5c, 0x70, 0xff, 0x52, 0xcb, 0xfb, 0x6b, 0x0c, 0x81, 0xfd, 0x75, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xae, 0x31, 0x5b, 0x0b, 0xe3, 0x5b, 0x8e, 0xff, 0x6d, 0x55, 0xff, 0x5d, 0x96, 0xff, 0x55, 0xf7, 0xff, 0x4e, 0x18, 0xff, 0x56, 0x9a, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5b, 0xff, 0x87, 0x5b, 0xff, 0xbf, 0xfe, 0xff, 0xcf, 0xfd, 0xff, 0xd7, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xbf, 0xfd, 0xff, 0x8f, 0x7c, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x1c, 0xff, 0x5e, 0xdb, 0xff, 0x56, 0x79, 0xff, 0x4e, 0x18, 0xff, 0x55, 0xb7, 0xff, 0x5d, 0x76, 0xff, 0x64, 0xf3, 0xff, 0x4a, 0xeb, 0xff, 0x5a, 0xca, 0xc9, 0xa5, 0x14, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x75, 0x03, 0x6b, 0x2c, 0x6f, 0x5a, 0xeb, 0xf5, 0x5b, 0xf0, 0xff, 0x6d, 0x75, 0xff, 0x55, 0x96, 0xff, 0x55, 0xb7, 0xff, 0x4d, 0xf8, 0xff, 0x56, 0x9a, 0xff, 0x5f, 0x1c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x57, 0x7d, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x5b, 0xff, 0x8f, 0x7c, 0xff, 0xc7, 0xfe, 0xff, 0xcf, 0xfd, 0xff, 0xd7, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xbf, 0xfc, 0xff, 0x97, 0xbc, 0xff, 0x67, 0x3b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x5e, 0xfb, 0xff, 0x5e, 0x9a, 0xff, 0x56, 0x59, 0xff, 0x4d, 0xf7, 0xff, 0x4d, 0xb7, 0xff, 0x5d, 0x96, 0xff, 0x65, 0x34, 0xff, 0x4b, 0x0c, 0xff, 0x52, 0x8a, 0xeb, 0x94, 0x91, 0x47, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x15, 0x0c, 0x62, 0xab, 0xa7, 0x52, 0xcb, 0xfc, 0x5c, 0x10, 0xff, 0x65, 0x55, 0xff, 0x5d, 0x75, 0xff, 0x55, 0xd7, 0xff, 0x4d, 0xf8, 0xff, 0x56, 0x59, 0xff, 0x5e, 0xdb, 0xff, 0x5f, 0x1b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x97, 0x7c, 0xff, 0xcf, 0xfd, 0xff, 0xd7, 0xfc, 0xff, 0xd7, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xc7, 0xfc, 0xff, 0x9f, 0xbc, 0xff, 0x67, 0x1b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x1b, 0xff, 0x5e, 0xda, 0xff, 0x56, 0x59, 0xff, 0x56, 0x18, 0xff, 0x55, 0xf8, 0xff, 0x55, 0xd7, 0xff, 0x5d, 0x96, 0xff, 0x6d, 0x35, 0xff, 0x53, 0x6d, 0xff, 0x52, 0xaa, 0xf7, 0x73, 0x6d, 0x75, 0xff, 0xf5, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x31, 0x1d, 0x5a, 0xab, 0xb5, 0x4a, 0x8a, 0xfc, 0x53, 0xcf, 0xff, 0x6d, 0x55, 0xff, 0x55, 0x75, 0xff, 0x4d, 0xd7, 0xff, 0x4d, 0xf8, 0xff, 0x4e, 0x18, 0xff, 0x56, 0x79, 0xff, 0x5e, 0xdb, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x9f, 0x9c, 0xff, 0xcf, 0xfd, 0xff, 0xd7, 0xfc, 0xff, 0xd7, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xcf, 0xfc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xc7, 0xfd, 0xff, 0xa7, 0xdd, 0xff, 0x67, 0x1b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x1b, 0xff, 0x5e, 0xdb, 0xff, 0x56, 0x99, 0xff, 0x4e, 0x38, 0xff, 0x55, 0xf8, 0xff, 0x5d, 0xf8, 0xff, 0x55, 0xd7, 0xff, 0x5d, 0xb6, 0xff, 0x6d, 0x35, 0xff, 0x4b, 0x4d, 0xff, 0x5a, 0xca, 0xfb, 0x73, 0x6d, 0x9d, 0xde, 0xd9, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x72, 0x1d, 0x52, 0x8a, 0xb9, 0x4a, 0x8a, 0xfa, 0x53, 0x8e, 0xff, 0x6d, 0x34, 0xff, 0x5d, 0x96, 0xff, 0x4d, 0xd7, 0xff, 0x4d, 0xf8, 0xff, 0x56, 0x18, 0xff, 0x4e, 0x38, 0xff, 0x56, 0x99, 0xff, 0x5f, 0x1b, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x9f, 0x9c, 0xff, 0xc7, 0xfd, 0xff, 0xcf, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xbb, 0xff, 0xc7, 0xdc, 0xff, 0xa7, 0xdd, 0xff, 0x6e, 0xfa, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x1c, 0xff, 0x5e, 0xdb, 0xff, 0x56, 0x79, 0xff, 0x56, 0x59, 0xff, 0x56, 0x18, 0xff, 0x55, 0xf8, 0xff, 0x55, 0xd8, 0xff, 0x5d, 0xd7, 0xff, 0x6d, 0xd6, 0xff, 0x75, 0x54, 0xff, 0x5b, 0x6d, 0xff, 0x5a, 0xca, 0xfb, 0x62, 0xeb, 0xab, 0xc6, 0x18, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xb3, 0x18, 0x62, 0xcb, 0x91, 0x5a, 0xab, 0xf5, 0x53, 0x2c, 0xff, 0x5c, 0xd2, 0xff, 0x5d, 0xd6, 0xff, 0x55, 0xf8, 0xff, 0x55, 0xf8, 0xff, 0x56, 0x18, 0xff, 0x4e, 0x18, 0xff, 0x56, 0x59, 0xff, 0x56, 0x9a, 0xff, 0x5e, 0xfb, 0xff, 0x6f, 0x1b, 0xff, 0x97, 0x5c, 0xff, 0xc7, 0xfe, 0xff, 0xcf, 0xfd, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xc7, 0xdc, 0xff, 0xaf, 0xdd, 0xff, 0x6e, 0xda, 0xff, 0x66, 0xfb, 0xff, 0x5e, 0xdb, 0xff, 0x5e, 0x9a, 0xff, 0x56, 0x39, 0xff, 0x55, 0xf8, 0xff, 0x55, 0xd7, 0xff, 0x55, 0xd7, 0xff, 0x55, 0xd8, 0xff, 0x5d, 0xd7, 0xff, 0x6d, 0xd7, 0xff, 0x6d, 0x13, 0xff, 0x53, 0x2c, 0xff, 0x5a, 0xaa, 0xf4, 0x7b, 0x6d, 0x96, 0xcd, 0xd7, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0x07, 0x6a, 0xeb, 0x73, 0x5a, 0xab, 0xe4, 0x4a, 0xec, 0xff, 0x5c, 0xf3, 0xff, 0x5d, 0xf7, 0xff, 0x55, 0xf8, 0xff, 0x55, 0xf8, 0xff, 0x55, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x4e, 0x18, 0xff, 0x56, 0x59, 0xff, 0x66, 0x79, 0xff, 0x86, 0xba, 0xff, 0xbf, 0xbd, 0xff, 0xc7, 0xbc, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xbc, 0xff, 0xc7, 0xbc, 0xff, 0xbf, 0xbc, 0xff, 0xa7, 0x9c, 0xff, 0x66, 0x58, 0xff, 0x5e, 0x38, 0xff, 0x56, 0x18, 0xff, 0x55, 0xf7, 0xff, 0x55, 0xd7, 0xff, 0x55, 0xb7, 0xff, 0x55, 0xb6, 0xff, 0x55, 0xb7, 0xff, 0x55, 0xd7, 0xff, 0x65, 0xd6, 0xff, 0x64, 0xb2, 0xff, 0x4a, 0xeb, 0xfe, 0x5a, 0xab, 0xd8, 0x7b, 0x6d, 0x67, 0xef, 0x5a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x7b, 0x6d, 0x64, 0x52, 0xab, 0xf8, 0x64, 0x51, 0xff, 0x6d, 0xd7, 0xff, 0x56, 0x18, 0xff, 0x55, 0xf8, 0xff, 0x55, 0xf7, 0xff, 0x55, 0xd7, 0xff, 0x55, 0xf8, 0xff, 0x55, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x65, 0xf7, 0xff, 0x9f, 0x1a, 0xff, 0xaf, 0x3b, 0xff, 0xb7, 0x5b, 0xff, 0xbf, 0x7b, 0xff, 0xbf, 0x9b, 0xff, 0xc7, 0xbc, 0xff, 0xcf, 0xbb, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0x9c, 0xff, 0xc7, 0xbc, 0xff, 0xc7, 0x9c, 0xff, 0xbf, 0x9b, 0xff, 0xb7, 0x5b, 0xff, 0xaf, 0x5b, 0xff, 0x96, 0xfa, 0xff, 0x5d, 0xf7, 0xff, 0x55, 0xd7, 0xff, 0x55, 0xb7, 0xff, 0x55, 0xb7, 0xff, 0x55, 0xd7, 0xff, 0x55, 0xb7, 0xff, 0x55, 0xb6, 0xff, 0x55, 0xb6, 0xff, 0x55, 0xd6, 0xff, 0x6d, 0x95, 0xff, 0x4b, 0x4d, 0xff, 0x52, 0x8a, 0xef, 0x94, 0x71, 0x40, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x71, 0x1d, 0x5a, 0xcb, 0xde, 0x5b, 0xef, 0xff, 0x75, 0xb7, 0xff, 0x5d, 0xf8, 0xff, 0x55, 0xf8, 0xff, 0x55, 0xd7, 0xff, 0x5d, 0xd7, 0xff, 0x55, 0xd7, 0xff, 0x55, 0xd7, 0xff, 0x55, 0xb6, 0xff, 0x5d, 0xb6, 0xff, 0x7e, 0x58, 0xff, 0x96, 0xd9, 0xff, 0x9e, 0xd9, 0xff, 0xa6, 0xfa, 0xff, 0xaf, 0x1a, 0xff, 0xaf, 0x3a, 0xff, 0xb7, 0x5a, 0xff, 0xb7, 0x5a, 0xff, 0xbf, 0x7b, 0xff, 0xbf, 0x7b, 0xff, 0xbf, 0x7b, 0xff, 0xc7, 0x7b, 0xff, 0xc7, 0x9b, 0xff, 0xc7, 0x9b, 0xff, 0xc7, 0xbb, 0xff, 0xc7, 0xbb, 0xff, 0xc7, 0xbb, 0xff, 0xc7, 0xbb, 0xff, 0xc7, 0x9b, 0xff, 0xc7, 0x9b, 0xff, 0xbf, 0x9b, 0xff, 0xbf, 0x9b, 0xff, 0xbf, 0x7b, 0xff, 0xbf, 0x7b, 0xff, 0xb7, 0x5a, 0xff, 0xb7, 0x3a, 0xff, 0xb7, 0x3a, 0xff, 0xaf, 0x1a, 0xff, 0xa7, 0x1a, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0x86, 0x58, 0xff, 0x5d, 0xd7, 0xff, 0x5d, 0xd7, 0xff, 0x55, 0xb6, 0xff, 0x55, 0xb7, 0xff, 0x55, 0xb6, 0xff, 0x55, 0xb6, 0xff, 0x55, 0xd7, 0xff, 0x55, 0xd6, 0xff, 0x55, 0xb6, 0xff, 0x6d, 0x34, 0xff, 0x4a, 0xeb, 0xff, 0x5a, 0xca, 0xc8, 0xb5, 0x96, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x05, 0x5a, 0xcb, 0xb1, 0x53, 0x4d, 0xff, 0x75, 0x96, 0xff, 0x5d, 0xd7, 0xff, 0x55, 0xf8, 0xff, 0x55, 0xf8, 0xff, 0x55, 0xd7, 0xff, 0x55, 0xb7, 0xff, 0x55, 0x76, 0xff, 0x5d, 0x35, 0xff, 0x65, 0x55, 0xff, 0x6d, 0x96, 0xff, 0x96, 0x99, 0xff, 0x9e, 0xb9, 0xff, 0xa6, 0xd9, 0xff, 0xa6, 0xd9, 0xff, 0xa6, 0xf9, 0xff, 0xaf, 0x1a, 0xff, 0xaf, 0x1a, 0xff, 0xaf, 0x1a, 0xff, 0xaf, 0x1a, 0xff, 0xaf, 0x1a, 0xff, 0xaf, 0x1a, 0xff, 0xb7, 0x1b, 0xff, 0xb7, 0x3a, 0xff, 0xb7, 0x3b, 0xff, 0xb7, 0x3b, 0xff, 0xb7, 0x5b, 0xff, 0xb7, 0x3b, 0xff, 0xb7, 0x3a, 0xff, 0xb7, 0x3a, 0xff, 0xaf, 0x1a, 0xff, 0xaf, 0x1a, 0xff, 0xaf, 0x1a, 0xff, 0xaf, 0x1a, 0xff, 0xaf, 0x1a, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0x9e, 0xda, 0xff, 0x9e, 0xd9, 0xff, 0xa6, 0xf9, 0xff, 0xa6, 0xfa, 0xff, 0x7d, 0xf7, 0xff, 0x75, 0xd7, 0xff, 0x75, 0x96, 0xff, 0x55, 0x14, 0xff, 0x5d, 0xb6, 0xff, 0x5d, 0xb7, 0xff, 0x55, 0xd7, 0xff, 0x55, 0xd7, 0xff, 0x55, 0xd7, 0xff, 0x5d, 0xd6, 0xff, 0x6c, 0xd3, 0xff, 0x4a, 0x8a, 0xfd, 0x73, 0x6d, 0x8b, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x6d, 0x63, 0x52, 0xeb, 0xf9, 0x6d, 0x14, 0xff, 0x65, 0xf7, 0xff, 0x5d, 0xf8, 0xff, 0x55, 0xd7, 0xff, 0x55, 0xd7, 0xff, 0x55, 0xb6, 0xff, 0x5d, 0x96, 0xff, 0x44, 0x51, 0xff, 0x33, 0x8e, 0xff, 0x4b, 0xcf, 0xff, 0x7d, 0x34, 0xff, 0xa6, 0x17, 0xff, 0xae, 0x98, 0xff, 0xb6, 0xd9, 0xff, 0xb6, 0xda, 0xff, 0xae, 0xfa, 0xff, 0xae, 0xfa, 0xff, 0xae, 0xfa, 0xff, 0xae, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xae, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xa7, 0x1a, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xda, 0xff, 0xa6, 0xda, 0xff, 0xa6, 0xda, 0xff, 0xae, 0xda, 0xff, 0xae, 0xda, 0xff, 0xb6, 0xd9, 0xff, 0xae, 0xb8, 0xff, 0x9e, 0x17, 0xff, 0x6c, 0x92, 0xff, 0x4b, 0xef, 0xff, 0x3b, 0x8e, 0xff, 0x44, 0x31, 0xff, 0x65, 0xd7, 0xff, 0x5d, 0xd7, 0xff, 0x55, 0xd7, 0xff, 0x55, 0xf7, 0xff, 0x55, 0xd7, 0xff, 0x65, 0xd6, 0xff, 0x5c, 0x30, 0xff, 0x52, 0x89, 0xf4, 0x94, 0x71, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xd2, 0x19, 0x5a, 0xcb, 0xda, 0x64, 0x30, 0xff, 0x76, 0x38, 0xff, 0x5d, 0xf8, 0xff, 0x55, 0xd7, 0xff, 0x4d, 0xd7, 0xff, 0x55, 0xd6, 0xff, 0x55, 0xb6, 0xff, 0x5d, 0x96, 0xff, 0x5c, 0xf4, 0xff, 0x53, 0xf0, 0xff, 0x42, 0xeb, 0xff, 0x4a, 0xaa, 0xff, 0x5b, 0x0b, 0xff, 0x6b, 0xce, 0xff, 0x84, 0x71, 0xff, 0x95, 0x34, 0xff, 0x9d, 0x95, 0xff, 0xa6, 0x17, 0xff, 0xae, 0x78, 0xff, 0xae, 0xb9, 0xff, 0xae, 0xd9, 0xff, 0xae, 0xda, 0xff, 0xae, 0xfa, 0xff, 0xae, 0xda, 0xff, 0xae, 0xda, 0xff, 0xae, 0xd9, 0xff, 0xae, 0xda, 0xff, 0xa6, 0xd9, 0xff, 0xae, 0xd9, 0xff, 0xae, 0xd9, 0xff, 0xae, 0xb9, 0xff, 0xa6, 0x98, 0xff, 0xa6, 0x58, 0xff, 0xa5, 0xf7, 0xff, 0x95, 0x75, 0xff, 0x8d, 0x14, 0xff, 0x7c, 0x70, 0xff, 0x6b, 0xad, 0xff, 0x5b, 0x0b, 0xff, 0x42, 0xca, 0xff, 0x43, 0x2d, 0xff, 0x53, 0xf0, 0xff, 0x65, 0x14, 0xff, 0x6d, 0xd7, 0xff, 0x65, 0xf7, 0xff, 0x5d, 0xf8, 0xff, 0x56, 0x18, 0xff, 0x56, 0x38, 0xff, 0x66, 0x18, 0xff, 0x7e, 0x17, 0xff, 0x4b, 0x0c, 0xff, 0x5a, 0xaa, 0xd3, 0xce, 0x59, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x75, 0x03, 0x6b, 0x0c, 0x8b, 0x4a, 0xcb, 0xfd, 0x75, 0xf6, 0xff, 0x66, 0x79, 0xff, 0x56, 0x38, 0xff, 0x4e, 0x37, 0xff, 0x4d, 0xf7, 0xff, 0x55, 0xd7, 0xff, 0x55, 0xb6, 0xff, 0x5d, 0x96, 0xff, 0x6d, 0x76, 0xff, 0x7d, 0x14, 0xff, 0x73, 0xf0, 0xff, 0x5a, 0xcb, 0xfe, 0x62, 0xcb, 0xea, 0x5a, 0x8a, 0xe2, 0x5a, 0x6a, 0xef, 0x5a, 0xaa, 0xf8, 0x62, 0xcb, 0xfb, 0x62, 0xeb, 0xfe, 0x63, 0x4c, 0xff, 0x6b, 0xae, 0xff, 0x74, 0x30, 0xff, 0x7c, 0xb1, 0xff, 0x8c, 0xf3, 0xff, 0x95, 0x54, 0xff, 0x95, 0x75, 0xff, 0x8d, 0x54, 0xff, 0x85, 0x13, 0xff, 0x7c, 0x91, 0xff, 0x74, 0x2f, 0xff, 0x6b, 0xad, 0xff, 0x5b, 0x4c, 0xff, 0x52, 0xca, 0xff, 0x52, 0x8a, 0xfe, 0x52, 0x69, 0xfa, 0x52, 0x69, 0xf0, 0x5a, 0x8a, 0xe2, 0x5a, 0xaa, 0xf3, 0x52, 0xaa, 0xff, 0x6c, 0x30, 0xff, 0x7d, 0x55, 0xff, 0x75, 0xd7, 0xff, 0x6d, 0xf8, 0xff, 0x5d, 0xf8, 0xff, 0x5e, 0x18, 0xff, 0x56, 0x19, 0xff, 0x56, 0x79, 0xff, 0x66, 0x9a, 0xff, 0x7e, 0xba, 0xff, 0x7d, 0x54, 0xff, 0x4a, 0x8a, 0xfd, 0x6b, 0x2c, 0x80, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x8e, 0x33, 0x4a, 0x6a, 0xe9, 0x54, 0x30, 0xff, 0x7e, 0xba, 0xff, 0x66, 0xda, 0xff, 0x56, 0x99, 0xff, 0x46, 0x38, 0xff, 0x4d, 0xf8, 0xff, 0x4d, 0xd7, 0xff, 0x55, 0xd7, 0xff, 0x55, 0xb7, 0xff, 0x75, 0x76, 0xff, 0x6b, 0xf0, 0xff, 0x62, 0xec, 0xea, 0x94, 0x31, 0x47, 0xb5, 0x34, 0x19, 0x9c, 0x31, 0x2e, 0x7b, 0x6e, 0x53, 0x6b, 0x0c, 0x64, 0x6a, 0xcb, 0x7b, 0x62, 0x8b, 0xa0, 0x62, 0xaa, 0xb2, 0x62, 0xab, 0xbe, 0x5a, 0xab, 0xc8, 0x5a, 0xab, 0xd0, 0x5a, 0xab, 0xd5, 0x5a, 0xab, 0xd6, 0x5a, 0xcb, 0xd5, 0x5a, 0xcb, 0xd0, 0x5a, 0xaa, 0xc8, 0x5a, 0x8a, 0xc1, 0x5a, 0x8a, 0xb7, 0x5a, 0x8a, 0xa6, 0x5a, 0x8a, 0x85, 0x62, 0x8b, 0x6e, 0x72, 0xed, 0x59, 0x8b, 0xd0, 0x2f, 0xbd, 0x36, 0x19, 0x62, 0xab, 0x89, 0x52, 0x8a, 0xfd, 0x74, 0x71, 0xff, 0x75, 0xb6, 0xff, 0x5e, 0x18, 0xff, 0x56, 0x18, 0xff, 0x56, 0x38, 0xff, 0x56, 0x39, 0xff, 0x56, 0x7a, 0xff, 0x66, 0xdb, 0xff, 0x76, 0xda, 0xff, 0x8e, 0x9a, 0xff, 0x53, 0x6d, 0xff, 0x5a, 0xab, 0xda, 0xb5, 0x35, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x75, 0x03, 0x62, 0xcb, 0x87, 0x4a, 0xcb, 0xfb, 0x75, 0x95, 0xff, 0x7e, 0xda, 0xff, 0x66, 0xfb, 0xff, 0x5e, 0xfc, 0xff, 0x56, 0x7a, 0xff, 0x56, 0x38, 0xff, 0x56, 0x18, 0xff, 0x65, 0xd7, 0xff, 0x75, 0x14, 0xff, 0x5b, 0x0d, 0xff, 0x6b, 0x0d, 0xa8, 0xde, 0xfb, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xfe, 0x7f, 0x05, 0xdd, 0xd7, 0x07, 0xb4, 0xd6, 0x0a, 0xa4, 0x51, 0x0d, 0x93, 0x90, 0x10, 0x83, 0x90, 0x10, 0x8b, 0xd1, 0x0f, 0x9c, 0xb3, 0x0c, 0xad, 0x75, 0x09, 0xbd, 0xdb, 0x07, 0xde, 0xbb, 0x06, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xf0, 0x27, 0x52, 0x6a, 0xe1, 0x53, 0x2d, 0xff, 0x6d, 0x75, 0xff, 0x5e, 0x18, 0xff, 0x5e, 0x59, 0xff, 0x56, 0x79, 0xff, 0x5e, 0xbb, 0xff, 0x66, 0xdb, 0xff, 0x6e, 0xfb, 0xff, 0x8e, 0xfb, 0xff, 0x6c, 0xb2, 0xff, 0x5b, 0x0c, 0xf6, 0x83, 0xf0, 0x64, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xb4, 0x15, 0x5a, 0xab, 0xbe, 0x4b, 0x4d, 0xff, 0x7e, 0x18, 0xff, 0x76, 0xfb, 0xff, 0x6f, 0x1c, 0xff, 0x6f, 0x1c, 0xff, 0x66, 0x99, 0xff, 0x66, 0x17, 0xff, 0x75, 0x75, 0xff, 0x5b, 0x8e, 0xff, 0x62, 0xcc, 0xe8, 0x8b, 0xcf, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x73, 0x0d, 0x74, 0x52, 0xab, 0xf9, 0x5c, 0x31, 0xff, 0x75, 0xd7, 0xff, 0x66, 0x59, 0xff, 0x66, 0xdb, 0xff, 0x66, 0xfb, 0xff, 0x76, 0xfb, 0xff, 0x7e, 0xda, 0xff, 0x6d, 0x34, 0xff, 0x5b, 0x2c, 0xfc, 0x62, 0xec, 0xa0, 0xcd, 0x99, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xd0, 0x37, 0x5a, 0xcb, 0xd9, 0x53, 0x6d, 0xff, 0x7d, 0x75, 0xff, 0x86, 0x9a, 0xff, 0x86, 0xdb, 0xff, 0x86, 0x9a, 0xff, 0x75, 0x96, 0xff, 0x5b, 0x8e, 0xff, 0x5a, 0xec, 0xf6, 0x73, 0x2e, 0x7a, 0xc6, 0x18, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0xd5, 0x11, 0x62, 0xac, 0xae, 0x52, 0xec, 0xfd, 0x6c, 0x71, 0xff, 0x75, 0xd6, 0xff, 0x7e, 0x79, 0xff, 0x7e, 0x79, 0xff, 0x7e, 0x18, 0xff, 0x64, 0x71, 0xff, 0x52, 0xeb, 0xfc, 0x63, 0x0b, 0xaf, 0xb5, 0x56, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x83, 0xaf, 0x3d, 0x62, 0xcb, 0xc7, 0x52, 0xeb, 0xfb, 0x53, 0x6d, 0xff, 0x64, 0x10, 0xff, 0x64, 0x0f, 0xff, 0x53, 0x2c, 0xff, 0x5a, 0xeb, 0xeb, 0x73, 0x4e, 0x82, 0xbd, 0x37, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x72, 0x21, 0x62, 0xec, 0xb4, 0x52, 0xca, 0xfa, 0x53, 0x2c, 0xff, 0x5b, 0xce, 0xff, 0x53, 0x6d, 0xff, 0x4a, 0xec, 0xff, 0x52, 0xab, 0xef, 0x6a, 0xec, 0x97, 0xa4, 0x93, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0xf3, 0x17, 0x7b, 0x6e, 0x6b, 0x5a, 0xcb, 0xc1, 0x5a, 0xaa, 0xda, 0x5a, 0xaa, 0xd4, 0x6b, 0x0c, 0x9e, 0x8b, 0xef, 0x3c, 0xde, 0xbb, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xb4, 0x13, 0x73, 0x2d, 0x6a, 0x62, 0x8a, 0xbd, 0x52, 0x69, 0xd6, 0x52, 0x89, 0xcf, 0x62, 0xcb, 0x98, 0x83, 0x8f, 0x3d, 0xc5, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x1c, 0x08, 0xc5, 0x98, 0x10, 0xcd, 0x99, 0x0d, 0xfe, 0x1f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xfb, 0x07, 0xcd, 0x37, 0x0e, 0xbd, 0xd7, 0x0b, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x04, 0xb9, 0xb9, 0xd1, 0x16, 0x8c, 0x8c, 0x94, 0x3e, 0x78, 0x78, 0x7f, 0x60, 0x75, 0x77, 0x80, 0x74, 0x6e, 0x75, 0x7a, 0x90, 0x69, 0x6d, 0x72, 0xa1, 0x64, 0x6a, 0x6b, 0xa9, 0x63, 0x69, 0x6c, 0xa7, 0x67, 0x6d, 0x73, 0x94, 0x6f, 0x72, 0x76, 0x6e, 0x78, 0x75, 0x7b, 0x59, 0x8b, 0x8b, 0x94, 0x39, 0xb6, 0xb6, 0xc2, 0x15, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xdb, 0xdb, 0x07, 0xaa, 0xb1, 0xb7, 0x27, 0x7a, 0x7c, 0x85, 0x75, 0x50, 0x54, 0x5a, 0xba, 0x42, 0x46, 0x47, 0xe1, 0x4a, 0x4c, 0x49, 0xf0, 0x4c, 0x4e, 0x47, 0xfb, 0x4d, 0x53, 0x43, 0xfd, 0x51, 0x58, 0x43, 0xfe, 0x56, 0x5e, 0x45, 0xfe, 0x5b, 0x64, 0x48, 0xfe, 0x5b, 0x63, 0x48, 0xfe, 0x59, 0x60, 0x49, 0xfe, 0x56, 0x5b, 0x49, 0xfc, 0x57, 0x58, 0x4e, 0xf8, 0x4f, 0x54, 0x4d, 0xee, 0x46, 0x4a, 0x4a, 0xde, 0x4a, 0x50, 0x54, 0xba, 0x64, 0x69, 0x6f, 0x7a, 0x89, 0x89, 0x93, 0x34, 0xbf, 0xbf, 0xbf, 0x0c, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xc8, 0xdb, 0x0e, 0x8b, 0x84, 0x92, 0x4d, 0x6a, 0x6a, 0x78, 0xa8, 0x52, 0x54, 0x5f, 0xe8, 0x4c, 0x4f, 0x51, 0xfc, 0x4c, 0x50, 0x44, 0xff, 0x62, 0x66, 0x45, 0xff, 0x81, 0x86, 0x55, 0xff, 0x9a, 0xa0, 0x64, 0xff, 0xb2, 0xb6, 0x68, 0xff, 0xbe, 0xc2, 0x6f, 0xff, 0xc3, 0xc9, 0x73, 0xff, 0xc9, 0xcf, 0x77, 0xff, 0xc9, 0xd0, 0x79, 0xff, 0xc8, 0xce, 0x7a, 0xff, 0xbe, 0xc3, 0x74, 0xff, 0xa7, 0xb1, 0x6d, 0xff, 0x8c, 0x94, 0x5b, 0xff, 0x70, 0x76, 0x4e, 0xff, 0x54, 0x59, 0x46, 0xff, 0x4f, 0x51, 0x4f, 0xfc, 0x53, 0x53, 0x58, 0xee, 0x60, 0x5f, 0x67, 0xb9, 0x74, 0x74, 0x7e, 0x67, 0x8d, 0x8d, 0x9e, 0x1d, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0x0a, 0x83, 0x83, 0x8f, 0x50, 0x62, 0x62, 0x6e, 0xbc, 0x57, 0x5b, 0x5d, 0xf5, 0x5a, 0x5f, 0x50, 0xff, 0x6f, 0x74, 0x51, 0xff, 0x9e, 0xa0, 0x69, 0xff, 0xc1, 0xc3, 0x77, 0xff, 0xd2, 0xd5, 0x77, 0xff, 0xd6, 0xdb, 0x70, 0xff, 0xd7, 0xdf, 0x6b, 0xff, 0xdd, 0xe1, 0x63, 0xff, 0xdd, 0xe1, 0x5f, 0xff, 0xdd, 0xe2, 0x5d, 0xff, 0xdc, 0xe3, 0x5c, 0xff, 0xdd, 0xe4, 0x5e, 0xff, 0xde, 0xe4, 0x61, 0xff, 0xdb, 0xe4, 0x63, 0xff, 0xd7, 0xe4, 0x6a, 0xff, 0xd7, 0xe0, 0x73, 0xff, 0xd7, 0xdd, 0x7d, 0xff, 0xc6, 0xcc, 0x7b, 0xff, 0xac, 0xb2, 0x71, 0xff, 0x87, 0x8d, 0x5f, 0xff, 0x62, 0x68, 0x4d, 0xff, 0x57, 0x5c, 0x54, 0xf9, 0x56, 0x58, 0x5c, 0xd6, 0x69, 0x69, 0x74, 0x77, 0xb5, 0xb5, 0xbf, 0x18, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x86, 0x86, 0x90, 0x37, 0x58, 0x5e, 0x66, 0xad, 0x51, 0x57, 0x55, 0xf3, 0x5d, 0x62, 0x4a, 0xff, 0x81, 0x84, 0x52, 0xff, 0xb3, 0xb8, 0x73, 0xff, 0xd0, 0xd7, 0x83, 0xff, 0xd8, 0xdf, 0x79, 0xff, 0xdf, 0xe5, 0x6b, 0xff, 0xe1, 0xe6, 0x5f, 0xff, 0xe2, 0xe8, 0x5b, 0xff, 0xe1, 0xe7, 0x58, 0xff, 0xdf, 0xe3, 0x59, 0xff, 0xe3, 0xe7, 0x5b, 0xff, 0xe1, 0xe7, 0x57, 0xff, 0xdd, 0xe6, 0x54, 0xff, 0xdf, 0xe7, 0x57, 0xff, 0xe0, 0xe7, 0x59, 0xff, 0xdf, 0xe7, 0x59, 0xff, 0xdd, 0xe9, 0x56, 0xff, 0xe1, 0xea, 0x5c, 0xff, 0xdf, 0xe6, 0x5f, 0xff, 0xdd, 0xe5, 0x66, 0xff, 0xda, 0xe4, 0x6e, 0xff, 0xd7, 0xe3, 0x7a, 0xff, 0xc4, 0xd1, 0x7a, 0xff, 0x9a, 0xa5, 0x62, 0xff, 0x68, 0x6f, 0x45, 0xff, 0x55, 0x58, 0x49, 0xf9, 0x56, 0x58, 0x5a, 0xc7, 0x7b, 0x7b, 0x84, 0x4f, 0xcc, 0xcc, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x08, 0x6f, 0x71, 0x78, 0x6c, 0x4a, 0x4f, 0x50, 0xe2, 0x4b, 0x53, 0x45, 0xfe, 0x7f, 0x88, 0x54, 0xff, 0xb9, 0xc1, 0x73, 0xff, 0xd7, 0xdc, 0x80, 0xff, 0xda, 0xde, 0x81, 0xff, 0xdc, 0xe0, 0x7f, 0xff, 0xe0, 0xe3, 0x78, 0xff, 0xe1, 0xe2, 0x6c, 0xff, 0xe2, 0xe3, 0x62, 0xff, 0xe6, 0xe7, 0x5e, 0xff, 0xe7, 0xe7, 0x5a, 0xff, 0xe4, 0xe7, 0x58, 0xff, 0xe2, 0xe7, 0x57, 0xff, 0xe2, 0xe8, 0x54, 0xff, 0xe2, 0xe9, 0x53, 0xff, 0xe2, 0xea, 0x53, 0xff, 0xe2, 0xe9, 0x55, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe6, 0xea, 0x59, 0xff, 0xe6, 0xe8, 0x5a, 0xff, 0xe8, 0xe9, 0x5c, 0xff, 0xe5, 0xe9, 0x5a, 0xff, 0xe1, 0xe7, 0x5b, 0xff, 0xdf, 0xe6, 0x60, 0xff, 0xdb, 0xe4, 0x67, 0xff, 0xda, 0xe3, 0x71, 0xff, 0xcb, 0xd3, 0x71, 0xff, 0x9d, 0xa3, 0x5e, 0xff, 0x60, 0x61, 0x46, 0xff, 0x4f, 0x50, 0x4e, 0xf0, 0x63, 0x67, 0x6b, 0x88, 0x9e, 0xaa, 0xaa, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xb8, 0xc6, 0x12, 0x59, 0x59, 0x60, 0x90, 0x49, 0x4f, 0x49, 0xf4, 0x65, 0x67, 0x44, 0xff, 0xb4, 0xb7, 0x6b, 0xff, 0xd3, 0xda, 0x72, 0xff, 0xd4, 0xdd, 0x6b, 0xff, 0xd9, 0xe2, 0x77, 0xff, 0xdf, 0xe9, 0x8a, 0xff, 0xeb, 0xf4, 0x99, 0xff, 0xf1, 0xf6, 0x9e, 0xff, 0xf1, 0xf3, 0x96, 0xff, 0xe1, 0xe4, 0x78, 0xff, 0xdf, 0xe4, 0x63, 0xff, 0xdf, 0xe5, 0x57, 0xff, 0xe5, 0xe7, 0x59, 0xff, 0xe5, 0xe8, 0x58, 0xff, 0xe5, 0xe8, 0x55, 0xff, 0xe5, 0xe9, 0x53, 0xff, 0xe5, 0xe9, 0x54, 0xff, 0xe5, 0xe9, 0x56, 0xff, 0xe6, 0xea, 0x57, 0xff, 0xe6, 0xea, 0x55, 0xff, 0xe7, 0xe9, 0x57, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe7, 0xea, 0x55, 0xff, 0xe6, 0xea, 0x55, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe6, 0xe7, 0x5c, 0xff, 0xe4, 0xe4, 0x5a, 0xff, 0xe0, 0xe5, 0x5e, 0xff, 0xda, 0xdf, 0x6e, 0xff, 0xc3, 0xc7, 0x78, 0xff, 0x7c, 0x7c, 0x52, 0xff, 0x51, 0x51, 0x45, 0xfa, 0x4f, 0x53, 0x55, 0xb5, 0x9e, 0x9e, 0xa4, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xae, 0xb9, 0x16, 0x61, 0x5f, 0x66, 0xa3, 0x51, 0x53, 0x47, 0xfa, 0x75, 0x78, 0x4c, 0xff, 0xc8, 0xc9, 0x77, 0xff, 0xdd, 0xdf, 0x69, 0xff, 0xdd, 0xe1, 0x5f, 0xff, 0xe1, 0xea, 0x75, 0xff, 0xe6, 0xf4, 0x93, 0xff, 0xe4, 0xf4, 0x9f, 0xff, 0xe4, 0xf2, 0xa5, 0xff, 0xe7, 0xf2, 0xa7, 0xff, 0xea, 0xf4, 0xa5, 0xff, 0xea, 0xf4, 0x93, 0xff, 0xdc, 0xe7, 0x6f, 0xff, 0xdf, 0xe9, 0x62, 0xff, 0xe5, 0xe8, 0x5f, 0xff, 0xe5, 0xe8, 0x5c, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe6, 0xea, 0x55, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x56, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe8, 0xe7, 0x59, 0xff, 0xe8, 0xe6, 0x58, 0xff, 0xe7, 0xe7, 0x57, 0xff, 0xe3, 0xe6, 0x59, 0xff, 0xdd, 0xe1, 0x69, 0xff, 0xd1, 0xd3, 0x7d, 0xff, 0x92, 0x93, 0x5c, 0xff, 0x52, 0x56, 0x42, 0xfe, 0x4f, 0x51, 0x4e, 0xcf, 0x88, 0x84, 0x8d, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xcf, 0x10, 0x5e, 0x5e, 0x62, 0xa2, 0x52, 0x54, 0x44, 0xfc, 0x84, 0x85, 0x53, 0xff, 0xd3, 0xd3, 0x7a, 0xff, 0xdc, 0xe0, 0x6a, 0xff, 0xdd, 0xe3, 0x5e, 0xff, 0xdf, 0xe5, 0x6e, 0xff, 0xe9, 0xf4, 0x90, 0xff, 0xe0, 0xf1, 0x9b, 0xff, 0xdd, 0xef, 0xa3, 0xff, 0xde, 0xef, 0xa6, 0xff, 0xe0, 0xf1, 0xa3, 0xff, 0xe5, 0xf5, 0x9d, 0xff, 0xe5, 0xf2, 0x8e, 0xff, 0xe5, 0xed, 0x7d, 0xff, 0xf5, 0xf9, 0x80, 0xff, 0xe5, 0xe8, 0x61, 0xff, 0xe5, 0xe8, 0x5c, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe6, 0xea, 0x58, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xe9, 0x58, 0xff, 0xe7, 0xe7, 0x5a, 0xff, 0xe7, 0xe7, 0x5b, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe7, 0xe8, 0x59, 0xff, 0xe5, 0xea, 0x55, 0xff, 0xe5, 0xea, 0x56, 0xff, 0xe8, 0xe6, 0x5c, 0xff, 0xe8, 0xe8, 0x5a, 0xff, 0xe2, 0xe8, 0x57, 0xff, 0xdd, 0xe3, 0x66, 0xff, 0xd7, 0xda, 0x7e, 0xff, 0xa1, 0xa7, 0x6c, 0xff, 0x55, 0x5b, 0x40, 0xfe, 0x50, 0x53, 0x51, 0xd5, 0x89, 0x8d, 0x92, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0x09, 0x5e, 0x60, 0x67, 0x8a, 0x52, 0x53, 0x47, 0xf9, 0x80, 0x83, 0x4f, 0xff, 0xd1, 0xd4, 0x7a, 0xff, 0xe0, 0xe2, 0x65, 0xff, 0xde, 0xe5, 0x5c, 0xff, 0xd7, 0xe1, 0x60, 0xff, 0xe7, 0xf2, 0x89, 0xff, 0xe4, 0xf1, 0x9c, 0xff, 0xdf, 0xef, 0x9f, 0xff, 0xde, 0xef, 0xa1, 0xff, 0xe0, 0xf2, 0x9f, 0xff, 0xe2, 0xf4, 0x95, 0xff, 0xe6, 0xf5, 0x89, 0xff, 0xdb, 0xe7, 0x71, 0xff, 0xdc, 0xe3, 0x67, 0xff, 0xe5, 0xea, 0x6a, 0xff, 0xe5, 0xe8, 0x5d, 0xff, 0xe6, 0xe9, 0x5a, 0xff, 0xe6, 0xea, 0x59, 0xff, 0xe6, 0xea, 0x57, 0xff, 0xe6, 0xe9, 0x56, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe7, 0xe9, 0x58, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x56, 0xff, 0xe7, 0xe9, 0x56, 0xff, 0xe4, 0xea, 0x54, 0xff, 0xe4, 0xeb, 0x56, 0xff, 0xe5, 0xe6, 0x5b, 0xff, 0xe6, 0xe7, 0x59, 0xff, 0xe6, 0xea, 0x57, 0xff, 0xde, 0xe4, 0x57, 0xff, 0xdd, 0xe3, 0x65, 0xff, 0xd8, 0xdf, 0x7d, 0xff, 0xa7, 0xad, 0x68, 0xff, 0x56, 0x58, 0x44, 0xff, 0x53, 0x53, 0x5a, 0xcf, 0x9d, 0x9d, 0xaa, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x75, 0x77, 0x7e, 0x6b, 0x52, 0x52, 0x4f, 0xf5, 0x79, 0x78, 0x4e, 0xff, 0xd2, 0xd4, 0x79, 0xff, 0xdd, 0xe2, 0x63, 0xff, 0xe3, 0xe8, 0x5b, 0xff, 0xde, 0xe5, 0x55, 0xff, 0xdb, 0xe5, 0x62, 0xff, 0xeb, 0xf7, 0x8c, 0xff, 0xe5, 0xf3, 0x99, 0xff, 0xe5, 0xf1, 0x9c, 0xff, 0xe6, 0xf4, 0x9a, 0xff, 0xe6, 0xf4, 0x93, 0xff, 0xe8, 0xf3, 0x87, 0xff, 0xdc, 0xe5, 0x6d, 0xff, 0xdc, 0xe2, 0x60, 0xff, 0xe0, 0xe5, 0x5d, 0xff, 0xe2, 0xe5, 0x5a, 0xff, 0xe6, 0xe9, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe7, 0x57, 0xff, 0xe3, 0xe6, 0x58, 0xff, 0xe1, 0xe7, 0x59, 0xff, 0xe0, 0xe5, 0x64, 0xff, 0xda, 0xde, 0x79, 0xff, 0xa3, 0xa6, 0x6f, 0xff, 0x57, 0x58, 0x4f, 0xfd, 0x58, 0x5c, 0x5e, 0xae, 0xa5, 0xa5, 0xa5, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x86, 0x8e, 0x3d, 0x5e, 0x5b, 0x59, 0xe5, 0x70, 0x70, 0x4e, 0xff, 0xca, 0xce, 0x7b, 0xff, 0xdf, 0xe6, 0x66, 0xff, 0xe2, 0xe8, 0x56, 0xff, 0xe2, 0xe7, 0x56, 0xff, 0xe1, 0xe7, 0x54, 0xff, 0xdc, 0xe4, 0x5a, 0xff, 0xdf, 0xea, 0x70, 0xff, 0xe7, 0xf3, 0x86, 0xff, 0xea, 0xf5, 0x8a, 0xff, 0xe7, 0xf2, 0x81, 0xff, 0xe1, 0xec, 0x74, 0xff, 0xda, 0xe3, 0x64, 0xff, 0xdf, 0xe5, 0x5e, 0xff, 0xe3, 0xe6, 0x5a, 0xff, 0xe5, 0xe7, 0x58, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe7, 0xe7, 0x57, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe6, 0xe7, 0x58, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe4, 0xe7, 0x5c, 0xff, 0xdd, 0xe1, 0x6a, 0xff, 0xd4, 0xdb, 0x83, 0xff, 0x91, 0x98, 0x63, 0xff, 0x5a, 0x5f, 0x51, 0xf8, 0x62, 0x64, 0x68, 0x80, 0xbf, 0xbf, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xb6, 0x15, 0x58, 0x58, 0x58, 0xc9, 0x66, 0x67, 0x4b, 0xff, 0xbb, 0xc0, 0x74, 0xff, 0xdb, 0xe3, 0x6e, 0xff, 0xe4, 0xea, 0x5c, 0xff, 0xe5, 0xea, 0x56, 0xff, 0xe3, 0xe7, 0x55, 0xff, 0xe5, 0xe8, 0x53, 0xff, 0xe2, 0xe7, 0x55, 0xff, 0xdc, 0xe4, 0x5b, 0xff, 0xd8, 0xe1, 0x5d, 0xff, 0xdc, 0xe3, 0x5f, 0xff, 0xdf, 0xe6, 0x5e, 0xff, 0xdf, 0xe6, 0x5b, 0xff, 0xe3, 0xe9, 0x5b, 0xff, 0xe3, 0xe8, 0x58, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe7, 0xe8, 0x56, 0xff, 0xe8, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x55, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe6, 0xea, 0x57, 0xff, 0xe8, 0xe8, 0x58, 0xff, 0xe9, 0xe8, 0x58, 0xff, 0xe9, 0xe8, 0x58, 0xff, 0xe8, 0xe8, 0x58, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe4, 0xe7, 0x5f, 0xff, 0xdc, 0xe4, 0x6b, 0xff, 0xd0, 0xdb, 0x7e, 0xff, 0x74, 0x79, 0x4f, 0xff, 0x51, 0x50, 0x53, 0xed, 0x7e, 0x7e, 0x85, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xff, 0x05, 0x6d, 0x6f, 0x77, 0x81, 0x61, 0x63, 0x52, 0xfa, 0xa1, 0xa8, 0x64, 0xff, 0xd9, 0xe3, 0x75, 0xff, 0xe1, 0xea, 0x63, 0xff, 0xe2, 0xe7, 0x5f, 0xff, 0xe4, 0xe7, 0x5d, 0xff, 0xe4, 0xe8, 0x56, 0xff, 0xe6, 0xe9, 0x54, 0xff, 0xe5, 0xe8, 0x55, 0xff, 0xe2, 0xe9, 0x56, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x59, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe3, 0xe8, 0x55, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe2, 0xe9, 0x55, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe9, 0x55, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe9, 0xe8, 0x58, 0xff, 0xe8, 0xe8, 0x58, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe7, 0xea, 0x56, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe1, 0xe7, 0x5b, 0xff, 0xd8, 0xe1, 0x69, 0xff, 0xb9, 0xbe, 0x78, 0xff, 0x57, 0x56, 0x4a, 0xff, 0x51, 0x51, 0x58, 0xb9, 0xc8, 0xc8, 0xc8, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x84, 0x88, 0x3c, 0x54, 0x55, 0x4e, 0xe8, 0x7c, 0x83, 0x50, 0xff, 0xd6, 0xde, 0x7b, 0xff, 0xdf, 0xe7, 0x63, 0xff, 0xe2, 0xe8, 0x5b, 0xff, 0xe3, 0xe7, 0x5e, 0xff, 0xe1, 0xe6, 0x5b, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe7, 0xe8, 0x57, 0xff, 0xe7, 0xe8, 0x56, 0xff, 0xe5, 0xe9, 0x56, 0xff, 0xe4, 0xe9, 0x55, 0xff, 0xe7, 0xe8, 0x55, 0xff, 0xe7, 0xe8, 0x55, 0xff, 0xe5, 0xe9, 0x55, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe2, 0xe9, 0x56, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe6, 0xe8, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe5, 0xea, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe7, 0xe9, 0x57, 0xff, 0xe7, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe2, 0xea, 0x58, 0xff, 0xe2, 0xe8, 0x56, 0xff, 0xe2, 0xe6, 0x54, 0xff, 0xde, 0xe5, 0x5d, 0xff, 0xd2, 0xda, 0x75, 0xff, 0x81, 0x86, 0x52, 0xff, 0x4b, 0x4e, 0x47, 0xf7, 0x6e, 0x70, 0x73, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xe6, 0x0a, 0x58, 0x58, 0x5b, 0xae, 0x57, 0x5b, 0x3f, 0xfe, 0xbd, 0xc3, 0x77, 0xff, 0xdb, 0xe1, 0x6a, 0xff, 0xe6, 0xe8, 0x5b, 0xff, 0xe6, 0xe8, 0x57, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe3, 0xeb, 0x56, 0xff, 0xe5, 0xea, 0x58, 0xff, 0xe7, 0xe7, 0x59, 0xff, 0xe7, 0xe7, 0x59, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe8, 0xe8, 0x58, 0xff, 0xe9, 0xe8, 0x58, 0xff, 0xe7, 0xe7, 0x55, 0xff, 0xe6, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe7, 0xe8, 0x55, 0xff, 0xe8, 0xe8, 0x55, 0xff, 0xe7, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe5, 0xea, 0x55, 0xff, 0xe6, 0xe9, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xdf, 0xea, 0x58, 0xff, 0xe1, 0xeb, 0x57, 0xff, 0xe4, 0xe7, 0x55, 0xff, 0xe2, 0xe6, 0x58, 0xff, 0xd7, 0xe2, 0x62, 0xff, 0xb9, 0xc5, 0x71, 0xff, 0x54, 0x58, 0x41, 0xff, 0x4d, 0x51, 0x55, 0xd0, 0xa3, 0xa3, 0xa3, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x84, 0x8b, 0x4d, 0x50, 0x51, 0x4c, 0xf3, 0x8f, 0x93, 0x57, 0xff, 0xd5, 0xdb, 0x72, 0xff, 0xe0, 0xe4, 0x5a, 0xff, 0xe7, 0xe8, 0x56, 0xff, 0xe5, 0xe9, 0x55, 0xff, 0xe3, 0xeb, 0x56, 0xff, 0xe4, 0xeb, 0x55, 0xff, 0xe9, 0xea, 0x57, 0xff, 0xe8, 0xe8, 0x59, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe7, 0xe8, 0x57, 0xff, 0xe6, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x56, 0xff, 0xe7, 0xe8, 0x56, 0xff, 0xe6, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe6, 0xe9, 0x55, 0xff, 0xe7, 0xe9, 0x54, 0xff, 0xe7, 0xe9, 0x55, 0xff, 0xe6, 0xe9, 0x56, 0xff, 0xe3, 0xeb, 0x55, 0xff, 0xe2, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe5, 0xec, 0x54, 0xff, 0xe4, 0xeb, 0x52, 0xff, 0xe5, 0xeb, 0x55, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe1, 0xe8, 0x58, 0xff, 0xe1, 0xe9, 0x56, 0xff, 0xe0, 0xec, 0x4f, 0xff, 0xe0, 0xe8, 0x51, 0xff, 0xe0, 0xe4, 0x57, 0xff, 0xd9, 0xe3, 0x57, 0xff, 0xd4, 0xdf, 0x74, 0xff, 0x8d, 0x90, 0x5c, 0xff, 0x52, 0x55, 0x50, 0xfa, 0x76, 0x7b, 0x7d, 0x6c, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xc8, 0xc8, 0x0e, 0x58, 0x5a, 0x5c, 0xb9, 0x59, 0x5c, 0x3e, 0xff, 0xc3, 0xc6, 0x71, 0xff, 0xda, 0xe2, 0x64, 0xff, 0xe1, 0xe6, 0x55, 0xff, 0xe4, 0xe7, 0x55, 0xff, 0xe3, 0xe9, 0x55, 0xff, 0xe0, 0xe8, 0x55, 0xff, 0xe3, 0xe9, 0x59, 0xff, 0xe6, 0xe8, 0x5a, 0xff, 0xe5, 0xe8, 0x5a, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xeb, 0x53, 0xff, 0xe6, 0xeb, 0x52, 0xff, 0xe7, 0xea, 0x55, 0xff, 0xe6, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe6, 0xe8, 0x55, 0xff, 0xe7, 0xe9, 0x55, 0xff, 0xe7, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x59, 0xff, 0xe6, 0xea, 0x59, 0xff, 0xe7, 0xeb, 0x55, 0xff, 0xe7, 0xeb, 0x55, 0xff, 0xe5, 0xea, 0x56, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe3, 0xec, 0x50, 0xff, 0xe0, 0xe8, 0x52, 0xff, 0xe1, 0xe4, 0x57, 0xff, 0xdf, 0xe8, 0x56, 0xff, 0xd8, 0xe4, 0x65, 0xff, 0xc7, 0xcc, 0x7f, 0xff, 0x62, 0x68, 0x4d, 0xff, 0x5b, 0x5f, 0x5c, 0xd3, 0xad, 0xad, 0xb8, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x79, 0x86, 0x52, 0x48, 0x4a, 0x3e, 0xf6, 0x8c, 0x92, 0x53, 0xff, 0xdc, 0xdf, 0x6e, 0xff, 0xdd, 0xe4, 0x58, 0xff, 0xe1, 0xe9, 0x54, 0xff, 0xe3, 0xe8, 0x56, 0xff, 0xe3, 0xe9, 0x55, 0xff, 0xe2, 0xe8, 0x55, 0xff, 0xe1, 0xe8, 0x5b, 0xff, 0xe0, 0xe7, 0x59, 0xff, 0xe4, 0xe9, 0x59, 0xff, 0xe6, 0xea, 0x57, 0xff, 0xe7, 0xec, 0x53, 0xff, 0xe6, 0xe9, 0x52, 0xff, 0xe6, 0xe8, 0x57, 0xff, 0xe6, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe7, 0xe7, 0x57, 0xff, 0xe6, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe4, 0xe7, 0x57, 0xff, 0xe7, 0xe7, 0x57, 0xff, 0xe8, 0xe7, 0x59, 0xff, 0xe9, 0xe8, 0x59, 0xff, 0xe8, 0xe9, 0x59, 0xff, 0xe8, 0xe9, 0x59, 0xff, 0xe6, 0xe9, 0x5a, 0xff, 0xe6, 0xe9, 0x59, 0xff, 0xe4, 0xe7, 0x56, 0xff, 0xe6, 0xe9, 0x55, 0xff, 0xe4, 0xe7, 0x57, 0xff, 0xe2, 0xe9, 0x53, 0xff, 0xe2, 0xe7, 0x56, 0xff, 0xe4, 0xe6, 0x59, 0xff, 0xe2, 0xe9, 0x52, 0xff, 0xdf, 0xec, 0x5c, 0xff, 0xd7, 0xe2, 0x78, 0xff, 0x97, 0xa2, 0x68, 0xff, 0x56, 0x5b, 0x50, 0xfa, 0x6d, 0x6d, 0x74, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xd4, 0x0c, 0x5c, 0x5a, 0x66, 0xb9, 0x56, 0x58, 0x3d, 0xff, 0xc3, 0xcb, 0x6f, 0xff, 0xe1, 0xe0, 0x5e, 0xff, 0xe2, 0xe8, 0x55, 0xff, 0xe0, 0xe8, 0x54, 0xff, 0xe0, 0xe6, 0x54, 0xff, 0xe2, 0xe8, 0x51, 0xff, 0xe2, 0xea, 0x58, 0xff, 0xdc, 0xe5, 0x5e, 0xff, 0xd9, 0xe4, 0x60, 0xff, 0xdc, 0xe3, 0x60, 0xff, 0xe0, 0xe4, 0x5d, 0xff, 0xe5, 0xe7, 0x5a, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe7, 0xe6, 0x59, 0xff, 0xe6, 0xe8, 0x57, 0xff, 0xe4, 0xe8, 0x56, 0xff, 0xe4, 0xe8, 0x56, 0xff, 0xe4, 0xe8, 0x56, 0xff, 0xe4, 0xe8, 0x56, 0xff, 0xe4, 0xe8, 0x56, 0xff, 0xe4, 0xe8, 0x56, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe3, 0xe8, 0x56, 0xff, 0xe6, 0xe8, 0x56, 0xff, 0xe6, 0xe8, 0x57, 0xff, 0xe3, 0xe8, 0x55, 0xff, 0xe1, 0xe9, 0x52, 0xff, 0xe4, 0xe9, 0x54, 0xff, 0xe5, 0xe7, 0x57, 0xff, 0xe5, 0xe7, 0x5a, 0xff, 0xe2, 0xe7, 0x5c, 0xff, 0xdf, 0xe3, 0x61, 0xff, 0xdf, 0xe4, 0x64, 0xff, 0xdf, 0xe5, 0x5f, 0xff, 0xe2, 0xe7, 0x58, 0xff, 0xe5, 0xe8, 0x54, 0xff, 0xe6, 0xe8, 0x57, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe4, 0xe7, 0x59, 0xff, 0xe5, 0xe5, 0x5b, 0xff, 0xe5, 0xe9, 0x55, 0xff, 0xe2, 0xec, 0x59, 0xff, 0xd7, 0xe3, 0x65, 0xff, 0xc1, 0xce, 0x79, 0xff, 0x5b, 0x60, 0x46, 0xff, 0x58, 0x59, 0x5f, 0xc9, 0xc8, 0xdb, 0xdb, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x93, 0x9a, 0x47, 0x56, 0x56, 0x56, 0xf4, 0x86, 0x89, 0x53, 0xff, 0xd6, 0xdd, 0x6f, 0xff, 0xe4, 0xe4, 0x5a, 0xff, 0xe0, 0xe8, 0x56, 0xff, 0xde, 0xe7, 0x55, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe3, 0xe9, 0x52, 0xff, 0xdc, 0xe6, 0x5e, 0xff, 0xc5, 0xcd, 0x61, 0xff, 0xaf, 0xb5, 0x5f, 0xff, 0xc2, 0xc6, 0x72, 0xff, 0xd5, 0xd9, 0x7d, 0xff, 0xd9, 0xde, 0x6e, 0xff, 0xde, 0xe4, 0x60, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe4, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe3, 0xea, 0x53, 0xff, 0xe1, 0xeb, 0x51, 0xff, 0xdc, 0xe8, 0x55, 0xff, 0xdc, 0xe5, 0x63, 0xff, 0xd9, 0xe2, 0x6a, 0xff, 0xd3, 0xdd, 0x72, 0xff, 0xc9, 0xd0, 0x71, 0xff, 0xbb, 0xc2, 0x62, 0xff, 0xc9, 0xd2, 0x61, 0xff, 0xdd, 0xe5, 0x60, 0xff, 0xe2, 0xe8, 0x58, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe3, 0xe7, 0x5b, 0xff, 0xe6, 0xe5, 0x5b, 0xff, 0xe7, 0xe8, 0x59, 0xff, 0xe1, 0xe7, 0x59, 0xff, 0xda, 0xe3, 0x5f, 0xff, 0xd1, 0xdc, 0x72, 0xff, 0x89, 0x8e, 0x5a, 0xff, 0x53, 0x56, 0x53, 0xf5, 0x83, 0x86, 0x8d, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x07, 0x5d, 0x61, 0x61, 0xb3, 0x59, 0x5d, 0x4a, 0xff, 0xb9, 0xbc, 0x71, 0xff, 0xdc, 0xe1, 0x66, 0xff, 0xe2, 0xe6, 0x5b, 0xff, 0xdd, 0xe9, 0x57, 0xff, 0xde, 0xe9, 0x56, 0xff, 0xe4, 0xe8, 0x55, 0xff, 0xe1, 0xe5, 0x56, 0xff, 0xd9, 0xe1, 0x6e, 0xff, 0x9a, 0xa2, 0x61, 0xff, 0x59, 0x5d, 0x42, 0xff, 0x50, 0x54, 0x42, 0xff, 0x67, 0x6d, 0x4b, 0xff, 0xa1, 0xa9, 0x69, 0xff, 0xcf, 0xd9, 0x77, 0xff, 0xd9, 0xe3, 0x64, 0xff, 0xe1, 0xe8, 0x59, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe3, 0xea, 0x57, 0xff, 0xe2, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xea, 0x57, 0xff, 0xe3, 0xeb, 0x5b, 0xff, 0xd7, 0xe2, 0x65, 0xff, 0xd0, 0xda, 0x7d, 0xff, 0xaa, 0xb5, 0x6e, 0xff, 0x77, 0x80, 0x4c, 0xff, 0x56, 0x5c, 0x39, 0xff, 0x67, 0x6e, 0x48, 0xff, 0xa8, 0xb2, 0x67, 0xff, 0xd7, 0xe1, 0x6d, 0xff, 0xdf, 0xe6, 0x5d, 0xff, 0xe2, 0xe8, 0x58, 0xff, 0xe2, 0xe8, 0x59, 0xff, 0xe0, 0xe7, 0x58, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe6, 0xe8, 0x58, 0xff, 0xe2, 0xe6, 0x58, 0xff, 0xde, 0xe6, 0x59, 0xff, 0xda, 0xe2, 0x64, 0xff, 0xbb, 0xc1, 0x76, 0xff, 0x5a, 0x61, 0x48, 0xfe, 0x62, 0x67, 0x66, 0xaf, 0xbf, 0xbf, 0xbf, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x8d, 0x91, 0x41, 0x54, 0x5c, 0x54, 0xf1, 0x74, 0x7c, 0x50, 0xff, 0xd4, 0xd9, 0x7f, 0xff, 0xe2, 0xe8, 0x62, 0xff, 0xe1, 0xe9, 0x5a, 0xff, 0xdb, 0xea, 0x56, 0xff, 0xdd, 0xea, 0x55, 0xff, 0xe2, 0xe7, 0x54, 0xff, 0xe0, 0xe3, 0x5d, 0xff, 0xc5, 0xca, 0x6c, 0xff, 0x89, 0x90, 0x65, 0xff, 0x54, 0x5d, 0x56, 0xff, 0x4a, 0x53, 0x5d, 0xff, 0x48, 0x52, 0x5f, 0xff, 0x4c, 0x56, 0x4f, 0xff, 0x7c, 0x84, 0x50, 0xff, 0xce, 0xd5, 0x7d, 0xff, 0xde, 0xe5, 0x64, 0xff, 0xe3, 0xea, 0x59, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe2, 0xea, 0x57, 0xff, 0xe2, 0xe9, 0x57, 0xff, 0xe2, 0xe9, 0x57, 0xff, 0xe2, 0xe9, 0x56, 0xff, 0xe2, 0xea, 0x57, 0xff, 0xe2, 0xea, 0x57, 0xff, 0xe1, 0xe9, 0x56, 0xff, 0xe1, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x59, 0xff, 0xe8, 0xe9, 0x5c, 0xff, 0xe0, 0xe5, 0x65, 0xff, 0xc9, 0xd3, 0x72, 0xff, 0x7e, 0x86, 0x50, 0xff, 0x51, 0x59, 0x46, 0xff, 0x49, 0x4f, 0x52, 0xff, 0x4a, 0x4d, 0x57, 0xff, 0x65, 0x69, 0x5f, 0xff, 0x84, 0x8c, 0x59, 0xff, 0xc2, 0xcc, 0x69, 0xff, 0xde, 0xe7, 0x65, 0xff, 0xe5, 0xec, 0x5d, 0xff, 0xe0, 0xe8, 0x59, 0xff, 0xe0, 0xe9, 0x57, 0xff, 0xe3, 0xe9, 0x54, 0xff, 0xe4, 0xe8, 0x53, 0xff, 0xe2, 0xe8, 0x55, 0xff, 0xe0, 0xe9, 0x54, 0xff, 0xde, 0xe5, 0x5a, 0xff, 0xd0, 0xd9, 0x7c, 0xff, 0x7d, 0x86, 0x58, 0xff, 0x55, 0x5d, 0x54, 0xee, 0x8d, 0x92, 0x9c, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xb5, 0x18, 0x9a, 0x9a, 0xa4, 0x51, 0x97, 0x97, 0xa3, 0x53, 0x9d, 0x9d, 0xab, 0x46, 0xb0, 0xb0, 0xbc, 0x2a, 0xe3, 0xe3, 0xe3, 0x09, 0xdb, 0xff, 0xff, 0x07, 0x6b, 0x72, 0x78, 0xa4, 0x59, 0x5e, 0x53, 0xfe, 0xa9, 0xae, 0x6d, 0xff, 0xe1, 0xe5, 0x77, 0xff, 0xe5, 0xe5, 0x5e, 0xff, 0xe9, 0xe7, 0x59, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xdd, 0xe9, 0x57, 0xff, 0xdd, 0xe7, 0x59, 0xff, 0xd9, 0xe1, 0x64, 0xff, 0x9d, 0xa2, 0x4c, 0xff, 0x5b, 0x5f, 0x30, 0xff, 0x57, 0x5b, 0x44, 0xff, 0x50, 0x54, 0x4b, 0xff, 0x49, 0x50, 0x53, 0xff, 0x4b, 0x4f, 0x5b, 0xff, 0x53, 0x55, 0x52, 0xff, 0x7e, 0x85, 0x4f, 0xff, 0xd4, 0xdf, 0x74, 0xff, 0xdc, 0xe7, 0x64, 0xff, 0xe1, 0xe8, 0x5a, 0xff, 0xe5, 0xea, 0x54, 0xff, 0xe5, 0xea, 0x54, 0xff, 0xe4, 0xea, 0x59, 0xff, 0xe1, 0xe8, 0x5c, 0xff, 0xe1, 0xe8, 0x5b, 0xff, 0xdf, 0xe6, 0x5c, 0xff, 0xe0, 0xe7, 0x5c, 0xff, 0xdf, 0xe9, 0x59, 0xff, 0xdf, 0xe9, 0x54, 0xff, 0xe0, 0xe9, 0x52, 0xff, 0xe3, 0xea, 0x55, 0xff, 0xe0, 0xe9, 0x55, 0xff, 0xe2, 0xeb, 0x54, 0xff, 0xdf, 0xe8, 0x5e, 0xff, 0xcd, 0xd9, 0x73, 0xff, 0x6e, 0x7b, 0x43, 0xff, 0x4b, 0x59, 0x48, 0xff, 0x46, 0x54, 0x50, 0xff, 0x46, 0x51, 0x4f, 0xff, 0x51, 0x55, 0x4b, 0xff, 0x5f, 0x5f, 0x48, 0xff, 0x69, 0x69, 0x38, 0xff, 0xa3, 0xa5, 0x51, 0xff, 0xe1, 0xe4, 0x6d, 0xff, 0xdf, 0xe7, 0x57, 0xff, 0xe2, 0xe9, 0x59, 0xff, 0xe1, 0xe7, 0x59, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x54, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xdf, 0xe6, 0x5d, 0xff, 0xdf, 0xe2, 0x66, 0xff, 0xd7, 0xdf, 0x7a, 0xff, 0xad, 0xb5, 0x7f, 0xff, 0x4f, 0x56, 0x4e, 0xfe, 0x68, 0x6d, 0x72, 0x98, 0x86, 0x90, 0x94, 0x37, 0x93, 0x9a, 0xa1, 0x49, 0x9d, 0xa1, 0xa6, 0x3c, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x7d, 0x8b, 0x37, 0x59, 0x5a, 0x66, 0x9b, 0x54, 0x57, 0x63, 0xb6, 0x51, 0x56, 0x64, 0xd8, 0x55, 0x58, 0x68, 0xda, 0x64, 0x63, 0x73, 0xaa, 0x81, 0x83, 0x8f, 0x80, 0x57, 0x5c, 0x62, 0xf0, 0x64, 0x69, 0x54, 0xff, 0xce, 0xd4, 0x8a, 0xff, 0xdb, 0xe3, 0x6a, 0xff, 0xe3, 0xe8, 0x5f, 0xff, 0xe6, 0xe5, 0x5f, 0xff, 0xdf, 0xe5, 0x63, 0xff, 0xdb, 0xe6, 0x65, 0xff, 0xdb, 0xe6, 0x64, 0xff, 0xd9, 0xe3, 0x68, 0xff, 0xcf, 0xd7, 0x71, 0xff, 0xc1, 0xc9, 0x74, 0xff, 0xbe, 0xc3, 0x76, 0xff, 0xbc, 0xc1, 0x77, 0xff, 0xac, 0xb4, 0x6d, 0xff, 0x8e, 0x94, 0x60, 0xff, 0x67, 0x6c, 0x47, 0xff, 0x5d, 0x63, 0x30, 0xff, 0xb6, 0xbe, 0x57, 0xff, 0xdd, 0xe5, 0x64, 0xff, 0xe0, 0xe7, 0x5f, 0xff, 0xe2, 0xe8, 0x5d, 0xff, 0xe0, 0xe6, 0x61, 0xff, 0xdf, 0xe5, 0x6b, 0xff, 0xd9, 0xe1, 0x70, 0xff, 0xd5, 0xe0, 0x75, 0xff, 0xd7, 0xe1, 0x78, 0xff, 0xd8, 0xe1, 0x75, 0xff, 0xdd, 0xe6, 0x6e, 0xff, 0xde, 0xe7, 0x5f, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe2, 0xe9, 0x54, 0xff, 0xe2, 0xea, 0x56, 0xff, 0xe4, 0xe9, 0x59, 0xff, 0xe1, 0xe5, 0x69, 0xff, 0xb5, 0xb9, 0x63, 0xff, 0x5d, 0x64, 0x32, 0xff, 0x57, 0x61, 0x42, 0xff, 0x7e, 0x85, 0x5b, 0xff, 0xa9, 0xb0, 0x6f, 0xff, 0xbe, 0xc3, 0x78, 0xff, 0xc7, 0xcd, 0x79, 0xff, 0xc9, 0xcf, 0x74, 0xff, 0xd2, 0xd9, 0x6f, 0xff, 0xdb, 0xe1, 0x69, 0xff, 0xde, 0xe2, 0x63, 0xff, 0xde, 0xe3, 0x63, 0xff, 0xde, 0xe5, 0x5e, 0xff, 0xe1, 0xe7, 0x57, 0xff, 0xe2, 0xe8, 0x58, 0xff, 0xdf, 0xe4, 0x65, 0xff, 0xdb, 0xe1, 0x73, 0xff, 0xca, 0xd0, 0x73, 0xff, 0xa9, 0xb3, 0x64, 0xff, 0x7f, 0x86, 0x5d, 0xff, 0x4c, 0x4f, 0x50, 0xff, 0x48, 0x4c, 0x59, 0xfb, 0x4f, 0x55, 0x60, 0xc8, 0x52, 0x59, 0x61, 0xa1, 0x5c, 0x62, 0x62, 0x85, 0xd1, 0xd1, 0xd1, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xbf, 0xbf, 0xbf, 0x04, 0xaa, 0xaa, 0xaa, 0x09, 0xa3, 0xad, 0xb8, 0x19, 0x93, 0x93, 0xa4, 0x2d, 0x7a, 0x7a, 0x8d, 0x6b, 0x52, 0x58, 0x67, 0xeb, 0x54, 0x59, 0x59, 0xff, 0x71, 0x75, 0x52, 0xff, 0xcc, 0xd3, 0x7d, 0xff, 0xdc, 0xe6, 0x69, 0xff, 0xde, 0xe7, 0x67, 0xff, 0xd9, 0xe1, 0x6f, 0xff, 0xd6, 0xe0, 0x7d, 0xff, 0xd3, 0xe1, 0x83, 0xff, 0xd2, 0xe0, 0x7e, 0xff, 0xd3, 0xe0, 0x7b, 0xff, 0xd0, 0xdc, 0x77, 0xff, 0xd2, 0xdd, 0x6f, 0xff, 0xd6, 0xdd, 0x68, 0xff, 0xdc, 0xdd, 0x67, 0xff, 0xdd, 0xdf, 0x69, 0xff, 0xd8, 0xdc, 0x72, 0xff, 0xcc, 0xd3, 0x76, 0xff, 0xa5, 0xaf, 0x56, 0xff, 0xcc, 0xd6, 0x66, 0xff, 0xd7, 0xe0, 0x65, 0xff, 0xd7, 0xde, 0x69, 0xff, 0xd6, 0xdc, 0x73, 0xff, 0xd0, 0xd4, 0x7c, 0xff, 0xa2, 0xa7, 0x5f, 0xff, 0x84, 0x88, 0x4f, 0xff, 0x74, 0x7d, 0x4e, 0xff, 0x73, 0x7a, 0x4e, 0xff, 0x7b, 0x81, 0x4e, 0xff, 0x9a, 0xa0, 0x5c, 0xff, 0xd0, 0xd5, 0x7f, 0xff, 0xda, 0xdf, 0x78, 0xff, 0xdb, 0xe0, 0x6f, 0xff, 0xdc, 0xe3, 0x69, 0xff, 0xde, 0xe2, 0x64, 0xff, 0xdd, 0xe2, 0x69, 0xff, 0xd5, 0xda, 0x74, 0xff, 0xa3, 0xa8, 0x56, 0xff, 0xbf, 0xc2, 0x78, 0xff, 0xd8, 0xda, 0x83, 0xff, 0xe1, 0xe1, 0x74, 0xff, 0xdd, 0xe0, 0x6a, 0xff, 0xd9, 0xe0, 0x6c, 0xff, 0xd3, 0xde, 0x74, 0xff, 0xd0, 0xdc, 0x7b, 0xff, 0xd4, 0xdd, 0x7f, 0xff, 0xd8, 0xdd, 0x81, 0xff, 0xd6, 0xdc, 0x7b, 0xff, 0xd7, 0xe1, 0x71, 0xff, 0xdb, 0xe5, 0x65, 0xff, 0xe1, 0xe8, 0x67, 0xff, 0xdd, 0xe2, 0x70, 0xff, 0xa5, 0xa9, 0x52, 0xff, 0x6c, 0x72, 0x2a, 0xff, 0x6f, 0x79, 0x30, 0xff, 0x90, 0x97, 0x64, 0xff, 0x79, 0x7a, 0x67, 0xff, 0x50, 0x50, 0x58, 0xfe, 0x80, 0x85, 0x8f, 0x84, 0xdb, 0xdb, 0xdb, 0x07, 0xbf, 0xbf, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x98, 0xa5, 0x3e, 0x4b, 0x51, 0x57, 0xf2, 0x63, 0x66, 0x55, 0xff, 0x97, 0x9a, 0x65, 0xff, 0xb9, 0xc0, 0x5c, 0xff, 0xd8, 0xe3, 0x6a, 0xff, 0xd7, 0xe3, 0x75, 0xff, 0xce, 0xe0, 0x8b, 0xff, 0xcd, 0xdb, 0xa1, 0xff, 0xca, 0xd9, 0xaa, 0xff, 0xc9, 0xd9, 0xa8, 0xff, 0xcb, 0xd9, 0xa3, 0xff, 0xcf, 0xda, 0x94, 0xff, 0xd3, 0xe0, 0x7f, 0xff, 0xdc, 0xe4, 0x6c, 0xff, 0xe6, 0xe5, 0x62, 0xff, 0xea, 0xe5, 0x5c, 0xff, 0xe2, 0xe2, 0x5c, 0xff, 0xda, 0xe1, 0x66, 0xff, 0xd4, 0xde, 0x70, 0xff, 0xcc, 0xd6, 0x79, 0xff, 0xbf, 0xc7, 0x74, 0xff, 0xab, 0xb3, 0x68, 0xff, 0x9e, 0xa5, 0x6a, 0xff, 0x74, 0x7a, 0x54, 0xff, 0x56, 0x5a, 0x4d, 0xff, 0x51, 0x54, 0x57, 0xff, 0x4d, 0x53, 0x5c, 0xff, 0x50, 0x53, 0x60, 0xff, 0x54, 0x57, 0x60, 0xff, 0x53, 0x59, 0x52, 0xff, 0x61, 0x68, 0x4a, 0xff, 0x68, 0x70, 0x3f, 0xff, 0x86, 0x8d, 0x54, 0xff, 0xa5, 0xad, 0x65, 0xff, 0xc0, 0xc8, 0x71, 0xff, 0xd2, 0xdb, 0x77, 0xff, 0xd9, 0xe1, 0x79, 0xff, 0xdd, 0xe3, 0x76, 0xff, 0xe0, 0xe1, 0x6d, 0xff, 0xe7, 0xe6, 0x68, 0xff, 0xe5, 0xe4, 0x63, 0xff, 0xe2, 0xe3, 0x68, 0xff, 0xdb, 0xe1, 0x7a, 0xff, 0xd1, 0xde, 0x92, 0xff, 0xc9, 0xd9, 0x9f, 0xff, 0xc7, 0xd8, 0xa5, 0xff, 0xc9, 0xd9, 0xa1, 0xff, 0xcb, 0xda, 0x9c, 0xff, 0xd0, 0xde, 0x92, 0xff, 0xd8, 0xe1, 0x80, 0xff, 0xde, 0xe3, 0x72, 0xff, 0xda, 0xdd, 0x6d, 0xff, 0xa9, 0xaa, 0x4b, 0xff, 0xbb, 0xba, 0x63, 0xff, 0xd0, 0xd4, 0x72, 0xff, 0xd1, 0xd8, 0x7d, 0xff, 0xbc, 0xbf, 0x84, 0xff, 0x5e, 0x5e, 0x4e, 0xff, 0x59, 0x5d, 0x65, 0xd5, 0xaa, 0xb5, 0xbf, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xdb, 0xdb, 0x0e, 0x5b, 0x62, 0x6a, 0xb7, 0x4e, 0x56, 0x4f, 0xff, 0x99, 0x9b, 0x74, 0xff, 0xd2, 0xd4, 0x87, 0xff, 0xd7, 0xde, 0x6c, 0xff, 0xd2, 0xde, 0x69, 0xff, 0xce, 0xdc, 0x82, 0xff, 0xc3, 0xda, 0xa2, 0xff, 0xc2, 0xd3, 0xbd, 0xff, 0xbe, 0xd0, 0xc6, 0xff, 0xbb, 0xd1, 0xc6, 0xff, 0xbf, 0xd0, 0xc5, 0xff, 0xc6, 0xd2, 0xb2, 0xff, 0xce, 0xd9, 0x95, 0xff, 0xd6, 0xdf, 0x78, 0xff, 0xe1, 0xe5, 0x62, 0xff, 0xe6, 0xe4, 0x5a, 0xff, 0xe0, 0xdf, 0x63, 0xff, 0xd7, 0xd9, 0x77, 0xff, 0xae, 0xb0, 0x69, 0xff, 0x74, 0x78, 0x4e, 0xff, 0x4e, 0x56, 0x3b, 0xff, 0x67, 0x73, 0x60, 0xff, 0x92, 0xa0, 0x92, 0xff, 0x99, 0xa7, 0x9f, 0xff, 0x44, 0x51, 0x53, 0xff, 0x3e, 0x4a, 0x55, 0xff, 0x42, 0x4a, 0x5a, 0xff, 0x44, 0x4b, 0x5e, 0xff, 0x46, 0x4f, 0x60, 0xff, 0x4c, 0x59, 0x5d, 0xff, 0x9b, 0xac, 0xa3, 0xff, 0xaa, 0xbc, 0xac, 0xff, 0x96, 0xa8, 0x96, 0xff, 0x68, 0x75, 0x62, 0xff, 0x4f, 0x59, 0x38, 0xff, 0x75, 0x7d, 0x4d, 0xff, 0xa4, 0xaa, 0x6a, 0xff, 0xcf, 0xd4, 0x7c, 0xff, 0xdf, 0xe1, 0x6a, 0xff, 0xe3, 0xe6, 0x5f, 0xff, 0xe2, 0xe7, 0x63, 0xff, 0xde, 0xe3, 0x70, 0xff, 0xd3, 0xdc, 0x8a, 0xff, 0xca, 0xd9, 0xa9, 0xff, 0xc0, 0xd5, 0xba, 0xff, 0xbb, 0xd4, 0xbe, 0xff, 0xbb, 0xd5, 0xba, 0xff, 0xc0, 0xd6, 0xb6, 0xff, 0xc7, 0xd6, 0xab, 0xff, 0xd4, 0xdc, 0x95, 0xff, 0xda, 0xdd, 0x78, 0xff, 0xdd, 0xdf, 0x68, 0xff, 0xde, 0xe0, 0x67, 0xff, 0xe0, 0xdc, 0x6f, 0xff, 0xdf, 0xde, 0x6f, 0xff, 0xdb, 0xe1, 0x6f, 0xff, 0xd5, 0xde, 0x86, 0xff, 0x8a, 0x8f, 0x65, 0xff, 0x5b, 0x5f, 0x62, 0xfc, 0x73, 0x79, 0x86, 0x7e, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xcc, 0xcc, 0xcc, 0x05, 0xad, 0xad, 0xbf, 0x1c, 0x6b, 0x6f, 0x7b, 0x81, 0x44, 0x4c, 0x52, 0xfb, 0x5b, 0x62, 0x4f, 0xff, 0xb2, 0xb2, 0x7e, 0xff, 0xd3, 0xd2, 0x72, 0xff, 0xd7, 0xde, 0x5d, 0xff, 0xd2, 0xe0, 0x6a, 0xff, 0xc9, 0xd9, 0x89, 0xff, 0xbd, 0xd4, 0xae, 0xff, 0xbe, 0xcd, 0xca, 0xff, 0xb6, 0xcc, 0xd1, 0xff, 0xb2, 0xce, 0xd2, 0xff, 0xb8, 0xcd, 0xd6, 0xff, 0xc3, 0xd1, 0xc3, 0xff, 0xce, 0xd8, 0xa3, 0xff, 0xd5, 0xde, 0x84, 0xff, 0xda, 0xe3, 0x66, 0xff, 0xdd, 0xde, 0x68, 0xff, 0xd2, 0xd2, 0x7b, 0xff, 0x8c, 0x8f, 0x58, 0xff, 0x55, 0x5b, 0x49, 0xff, 0x8c, 0x98, 0x91, 0xff, 0xc7, 0xd7, 0xce, 0xff, 0xd9, 0xed, 0xe0, 0xff, 0xd8, 0xef, 0xe1, 0xff, 0xd4, 0xeb, 0xdf, 0xff, 0xcb, 0xdf, 0xd5, 0xff, 0x80, 0x90, 0x8a, 0xff, 0x51, 0x5f, 0x5d, 0xff, 0x47, 0x55, 0x55, 0xff, 0x7d, 0x8e, 0x89, 0xff, 0xc8, 0xde, 0xd2, 0xff, 0xd7, 0xee, 0xdc, 0xff, 0xd7, 0xed, 0xda, 0xff, 0xdc, 0xf0, 0xe1, 0xff, 0xdd, 0xf1, 0xe3, 0xff, 0xcd, 0xdc, 0xd0, 0xff, 0x96, 0xa2, 0x98, 0xff, 0x58, 0x63, 0x4f, 0xff, 0x70, 0x77, 0x46, 0xff, 0xbf, 0xc5, 0x73, 0xff, 0xdb, 0xe1, 0x72, 0xff, 0xde, 0xe4, 0x6b, 0xff, 0xd7, 0xde, 0x74, 0xff, 0xd1, 0xdd, 0x93, 0xff, 0xc6, 0xd8, 0xb2, 0xff, 0xbc, 0xd2, 0xc6, 0xff, 0xb7, 0xce, 0xcb, 0xff, 0xb6, 0xcf, 0xc8, 0xff, 0xbb, 0xd1, 0xc6, 0xff, 0xc4, 0xd4, 0xb7, 0xff, 0xd1, 0xd9, 0x9b, 0xff, 0xdb, 0xe0, 0x7c, 0xff, 0xdb, 0xe0, 0x66, 0xff, 0xdb, 0xe1, 0x63, 0xff, 0xcf, 0xd1, 0x65, 0xff, 0xcc, 0xcc, 0x6f, 0xff, 0xc7, 0xcc, 0x71, 0xff, 0xc9, 0xd4, 0x85, 0xff, 0xb9, 0xc1, 0x99, 0xff, 0x5f, 0x63, 0x64, 0xff, 0x5c, 0x5f, 0x6c, 0xec, 0x9d, 0xa1, 0xa9, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xb6, 0x15, 0x80, 0x80, 0x8a, 0x5e, 0x65, 0x68, 0x77, 0xa7, 0x53, 0x58, 0x69, 0xde, 0x49, 0x4f, 0x5a, 0xfb, 0x4c, 0x52, 0x4e, 0xff, 0x60, 0x63, 0x42, 0xff, 0x7d, 0x7d, 0x39, 0xff, 0xbd, 0xbd, 0x4f, 0xff, 0xdb, 0xe2, 0x5b, 0xff, 0xd0, 0xdf, 0x66, 0xff, 0xc7, 0xd9, 0x84, 0xff, 0xbf, 0xd3, 0xaf, 0xff, 0xbf, 0xce, 0xcb, 0xff, 0xb8, 0xcc, 0xd3, 0xff, 0xb1, 0xce, 0xd2, 0xff, 0xb6, 0xce, 0xd1, 0xff, 0xc1, 0xd2, 0xc0, 0xff, 0xce, 0xd8, 0xa7, 0xff, 0xd8, 0xe0, 0x8b, 0xff, 0xd8, 0xe3, 0x74, 0xff, 0xd4, 0xd8, 0x80, 0xff, 0x87, 0x87, 0x59, 0xff, 0x5a, 0x62, 0x51, 0xff, 0xb4, 0xc7, 0xbc, 0xff, 0xd5, 0xeb, 0xdc, 0xff, 0xd1, 0xea, 0xd5, 0xff, 0xce, 0xea, 0xd3, 0xff, 0xcf, 0xec, 0xd3, 0xff, 0xd0, 0xec, 0xd4, 0xff, 0xd5, 0xec, 0xd9, 0xff, 0xda, 0xec, 0xdd, 0xff, 0xcc, 0xde, 0xd1, 0xff, 0xc0, 0xd4, 0xc6, 0xff, 0xd4, 0xeb, 0xd9, 0xff, 0xd4, 0xec, 0xd6, 0xff, 0xd5, 0xed, 0xd4, 0xff, 0xd7, 0xed, 0xd6, 0xff, 0xd5, 0xec, 0xd8, 0xff, 0xd2, 0xec, 0xda, 0xff, 0xd6, 0xed, 0xd9, 0xff, 0xd8, 0xee, 0xdc, 0xff, 0xc1, 0xd6, 0xc7, 0xff, 0x70, 0x81, 0x6d, 0xff, 0x6c, 0x75, 0x4c, 0xff, 0xc5, 0xc9, 0x7e, 0xff, 0xdb, 0xde, 0x7b, 0xff, 0xd6, 0xde, 0x7a, 0xff, 0xcf, 0xdc, 0x8f, 0xff, 0xc6, 0xd7, 0xaf, 0xff, 0xbc, 0xcf, 0xc5, 0xff, 0xb8, 0xcb, 0xcd, 0xff, 0xba, 0xcd, 0xcd, 0xff, 0xbf, 0xd0, 0xc7, 0xff, 0xc6, 0xd4, 0xb4, 0xff, 0xcf, 0xdb, 0x95, 0xff, 0xd5, 0xdf, 0x75, 0xff, 0xd8, 0xe2, 0x66, 0xff, 0xd4, 0xdb, 0x61, 0xff, 0x81, 0x88, 0x2c, 0xff, 0x6e, 0x70, 0x26, 0xff, 0x69, 0x6d, 0x2c, 0xff, 0x61, 0x6c, 0x2f, 0xff, 0x69, 0x71, 0x51, 0xff, 0x59, 0x5d, 0x57, 0xff, 0x5c, 0x5f, 0x68, 0xff, 0x5c, 0x61, 0x6d, 0xcb, 0xb3, 0xb3, 0xbd, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xd4, 0xd4, 0x06, 0x5a, 0x58, 0x62, 0x94, 0x55, 0x5a, 0x62, 0xbc, 0x74, 0x7c, 0x89, 0x9c, 0x52, 0x59, 0x67, 0xf8, 0x57, 0x5e, 0x54, 0xff, 0x9b, 0xa1, 0x6f, 0xff, 0xcc, 0xd0, 0x86, 0xff, 0xd5, 0xd9, 0x70, 0xff, 0xdf, 0xe3, 0x61, 0xff, 0xdc, 0xe3, 0x5b, 0xff, 0xd4, 0xe1, 0x62, 0xff, 0xcf, 0xde, 0x74, 0xff, 0xc6, 0xd7, 0x99, 0xff, 0xc3, 0xd3, 0xb4, 0xff, 0xbc, 0xcd, 0xc4, 0xff, 0xba, 0xcf, 0xc5, 0xff, 0xbe, 0xd4, 0xbb, 0xff, 0xc7, 0xd8, 0xb5, 0xff, 0xcf, 0xd8, 0xa9, 0xff, 0xd7, 0xdc, 0x92, 0xff, 0xd1, 0xde, 0x86, 0xff, 0xa5, 0xac, 0x73, 0xff, 0x60, 0x62, 0x5b, 0xff, 0xc0, 0xcb, 0xc8, 0xff, 0xd6, 0xef, 0xdd, 0xff, 0xd1, 0xea, 0xd3, 0xff, 0xd1, 0xea, 0xd1, 0xff, 0xcf, 0xed, 0xcf, 0xff, 0xce, 0xef, 0xcd, 0xff, 0xcc, 0xed, 0xc9, 0xff, 0xd2, 0xee, 0xcd, 0xff, 0xd4, 0xeb, 0xce, 0xff, 0xd6, 0xec, 0xd3, 0xff, 0xd5, 0xed, 0xd1, 0xff, 0xd4, 0xee, 0xd0, 0xff, 0xd3, 0xef, 0xd3, 0xff, 0xd4, 0xef, 0xd6, 0xff, 0xd2, 0xee, 0xd5, 0xff, 0xd1, 0xee, 0xd6, 0xff, 0xcf, 0xec, 0xd5, 0xff, 0xd3, 0xee, 0xd4, 0xff, 0xd3, 0xee, 0xd5, 0xff, 0xd3, 0xed, 0xdd, 0xff, 0xce, 0xe4, 0xd8, 0xff, 0x75, 0x80, 0x74, 0xff, 0x78, 0x7b, 0x54, 0xff, 0xcb, 0xcf, 0x8b, 0xff, 0xcf, 0xd8, 0x82, 0xff, 0xcc, 0xd8, 0x88, 0xff, 0xc7, 0xd5, 0xa0, 0xff, 0xbf, 0xce, 0xb0, 0xff, 0xbf, 0xd1, 0xb8, 0xff, 0xc2, 0xd1, 0xb5, 0xff, 0xc7, 0xd2, 0xb0, 0xff, 0xcb, 0xd6, 0xa0, 0xff, 0xd0, 0xdd, 0x83, 0xff, 0xd4, 0xe1, 0x67, 0xff, 0xdc, 0xe4, 0x5f, 0xff, 0xe0, 0xe4, 0x64, 0xff, 0xd8, 0xde, 0x6d, 0xff, 0xd2, 0xd6, 0x75, 0xff, 0xcc, 0xcf, 0x7a, 0xff, 0xbe, 0xc4, 0x74, 0xff, 0x9d, 0xa6, 0x62, 0xff, 0x78, 0x7e, 0x51, 0xff, 0x53, 0x56, 0x48, 0xff, 0x53, 0x57, 0x5e, 0xfd, 0x68, 0x70, 0x77, 0x9d, 0xe3, 0xe3, 0xe3, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x8e, 0x8e, 0x12, 0xd4, 0xd4, 0xd4, 0x0c, 0x7c, 0x7c, 0x85, 0x6b, 0x5e, 0x60, 0x5d, 0xfc, 0x80, 0x83, 0x56, 0xff, 0xd6, 0xdb, 0x80, 0xff, 0xdd, 0xe2, 0x70, 0xff, 0xe0, 0xe6, 0x5f, 0xff, 0xe3, 0xea, 0x56, 0xff, 0xdf, 0xe7, 0x54, 0xff, 0xdd, 0xe6, 0x5d, 0xff, 0xd7, 0xe2, 0x65, 0xff, 0xcd, 0xdd, 0x7a, 0xff, 0xca, 0xda, 0x8f, 0xff, 0xc5, 0xd6, 0x9f, 0xff, 0xc5, 0xd6, 0xa3, 0xff, 0xc8, 0xda, 0xa0, 0xff, 0xc8, 0xd4, 0x99, 0xff, 0xb4, 0xba, 0x84, 0xff, 0xa5, 0xab, 0x71, 0xff, 0x9a, 0xa6, 0x6c, 0xff, 0x69, 0x72, 0x57, 0xff, 0x73, 0x7a, 0x7c, 0xff, 0xc6, 0xd4, 0xd0, 0xff, 0xde, 0xf3, 0xe4, 0xff, 0xd7, 0xf0, 0xd6, 0xff, 0xd3, 0xee, 0xd0, 0xff, 0xcf, 0xee, 0xcd, 0xff, 0xcf, 0xef, 0xcd, 0xff, 0xd2, 0xf0, 0xcd, 0xff, 0xd2, 0xec, 0xca, 0xff, 0xd5, 0xeb, 0xca, 0xff, 0xd7, 0xed, 0xcc, 0xff, 0xd7, 0xee, 0xcc, 0xff, 0xd3, 0xeb, 0xca, 0xff, 0xd4, 0xed, 0xcf, 0xff, 0xd4, 0xee, 0xd4, 0xff, 0xd4, 0xed, 0xd6, 0xff, 0xd1, 0xec, 0xd4, 0xff, 0xd2, 0xed, 0xd0, 0xff, 0xd5, 0xee, 0xce, 0xff, 0xd6, 0xee, 0xd2, 0xff, 0xd5, 0xed, 0xdc, 0xff, 0xd7, 0xe9, 0xe2, 0xff, 0xbb, 0xc5, 0xc1, 0xff, 0x5f, 0x65, 0x55, 0xff, 0x8c, 0x91, 0x6a, 0xff, 0xa6, 0xa9, 0x74, 0xff, 0xb4, 0xb8, 0x7a, 0xff, 0xc4, 0xcb, 0x8b, 0xff, 0xca, 0xd4, 0x92, 0xff, 0xcc, 0xd6, 0x95, 0xff, 0xcf, 0xd8, 0x93, 0xff, 0xd0, 0xd8, 0x8d, 0xff, 0xd4, 0xdc, 0x83, 0xff, 0xd8, 0xe2, 0x6f, 0xff, 0xde, 0xe7, 0x5e, 0xff, 0xe3, 0xe8, 0x59, 0xff, 0xe4, 0xe5, 0x5b, 0xff, 0xe0, 0xe7, 0x5b, 0xff, 0xdf, 0xe5, 0x62, 0xff, 0xdf, 0xe4, 0x69, 0xff, 0xdb, 0xe2, 0x6a, 0xff, 0xd7, 0xe0, 0x71, 0xff, 0xd1, 0xd9, 0x7c, 0xff, 0xbd, 0xc3, 0x7e, 0xff, 0x5f, 0x65, 0x47, 0xff, 0x50, 0x58, 0x53, 0xf5, 0x85, 0x8d, 0x90, 0x5e, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xff, 0x05, 0x86, 0x8c, 0x93, 0x50, 0x58, 0x57, 0x5c, 0xe5, 0x66, 0x64, 0x48, 0xff, 0xc8, 0xc8, 0x7a, 0xff, 0xe2, 0xe4, 0x6b, 0xff, 0xe5, 0xe8, 0x61, 0xff, 0xe4, 0xe9, 0x5a, 0xff, 0xe4, 0xeb, 0x58, 0xff, 0xe2, 0xe8, 0x57, 0xff, 0xe1, 0xe6, 0x5c, 0xff, 0xdf, 0xe4, 0x5f, 0xff, 0xd9, 0xe5, 0x61, 0xff, 0xd5, 0xe2, 0x6c, 0xff, 0xd2, 0xdf, 0x76, 0xff, 0xcf, 0xdd, 0x78, 0xff, 0xd1, 0xdd, 0x79, 0xff, 0xc7, 0xcd, 0x6d, 0xff, 0xaa, 0xad, 0x56, 0xff, 0xaa, 0xb0, 0x68, 0xff, 0x91, 0x99, 0x6c, 0xff, 0x52, 0x5c, 0x55, 0xff, 0x87, 0x95, 0x98, 0xff, 0x96, 0xa9, 0x9f, 0xff, 0xde, 0xf1, 0xe3, 0xff, 0xd7, 0xef, 0xd6, 0xff, 0xd4, 0xf0, 0xcf, 0xff, 0xd2, 0xef, 0xce, 0xff, 0xd3, 0xee, 0xcd, 0xff, 0xd3, 0xee, 0xc9, 0xff, 0xd8, 0xf0, 0xc9, 0xff, 0xdb, 0xf0, 0xc7, 0xff, 0xd7, 0xec, 0xc0, 0xff, 0xd0, 0xe5, 0xba, 0xff, 0xd4, 0xe9, 0xc1, 0xff, 0xd8, 0xee, 0xc9, 0xff, 0xd7, 0xef, 0xce, 0xff, 0xd6, 0xec, 0xd1, 0xff, 0xd4, 0xea, 0xd0, 0xff, 0xd6, 0xee, 0xd0, 0xff, 0xd8, 0xf0, 0xcf, 0xff, 0xd9, 0xf0, 0xd3, 0xff, 0xd6, 0xec, 0xd9, 0xff, 0xbf, 0xd0, 0xca, 0xff, 0x76, 0x82, 0x83, 0xff, 0x61, 0x6a, 0x6a, 0xff, 0x5a, 0x60, 0x4d, 0xff, 0x84, 0x87, 0x59, 0xff, 0x89, 0x8b, 0x44, 0xff, 0x9c, 0xa0, 0x46, 0xff, 0xd3, 0xd8, 0x70, 0xff, 0xdb, 0xdf, 0x71, 0xff, 0xda, 0xe0, 0x6e, 0xff, 0xdb, 0xe0, 0x6c, 0xff, 0xde, 0xe3, 0x68, 0xff, 0xe0, 0xe6, 0x5e, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe7, 0xe9, 0x57, 0xff, 0xe8, 0xe8, 0x59, 0xff, 0xe6, 0xea, 0x57, 0xff, 0xe8, 0xea, 0x5a, 0xff, 0xe6, 0xe8, 0x5a, 0xff, 0xe5, 0xea, 0x5b, 0xff, 0xe4, 0xeb, 0x60, 0xff, 0xdf, 0xe5, 0x65, 0xff, 0xd8, 0xde, 0x71, 0xff, 0xab, 0xb3, 0x69, 0xff, 0x53, 0x58, 0x41, 0xff, 0x5b, 0x60, 0x66, 0xd4, 0xb4, 0xbb, 0xc7, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xaa, 0xaa, 0x1b, 0x5f, 0x64, 0x6c, 0x97, 0x50, 0x56, 0x5d, 0xf2, 0x58, 0x59, 0x4b, 0xff, 0x9f, 0xa0, 0x5f, 0xff, 0xdf, 0xe1, 0x78, 0xff, 0xe7, 0xe8, 0x64, 0xff, 0xe6, 0xe9, 0x5f, 0xff, 0xe2, 0xe8, 0x5c, 0xff, 0xe1, 0xe8, 0x5b, 0xff, 0xe1, 0xe8, 0x5c, 0xff, 0xe2, 0xe8, 0x5c, 0xff, 0xe3, 0xe6, 0x5c, 0xff, 0xe1, 0xe7, 0x59, 0xff, 0xdf, 0xe5, 0x5b, 0xff, 0xdd, 0xe4, 0x5c, 0xff, 0xdb, 0xe3, 0x5d, 0xff, 0xdb, 0xe1, 0x5f, 0xff, 0xdb, 0xdf, 0x60, 0xff, 0xdf, 0xe1, 0x66, 0xff, 0xd9, 0xdd, 0x74, 0xff, 0xb4, 0xb9, 0x7e, 0xff, 0x55, 0x5d, 0x54, 0xff, 0xda, 0xeb, 0xe8, 0xff, 0xdd, 0xf5, 0xe2, 0xff, 0xdc, 0xf0, 0xde, 0xff, 0xd9, 0xee, 0xd7, 0xff, 0xd9, 0xf1, 0xd2, 0xff, 0xd7, 0xee, 0xcd, 0xff, 0xd8, 0xf0, 0xcb, 0xff, 0xdb, 0xf2, 0xc8, 0xff, 0xda, 0xf0, 0xc1, 0xff, 0xce, 0xe3, 0xb2, 0xff, 0xc6, 0xd8, 0xa8, 0xff, 0xc4, 0xd4, 0xa8, 0xff, 0xc4, 0xd5, 0xab, 0xff, 0xcc, 0xe0, 0xb1, 0xff, 0xd5, 0xea, 0xbb, 0xff, 0xdb, 0xef, 0xc6, 0xff, 0xda, 0xed, 0xcb, 0xff, 0xd6, 0xec, 0xce, 0xff, 0xd7, 0xee, 0xcf, 0xff, 0xd8, 0xef, 0xd1, 0xff, 0xd7, 0xed, 0xd4, 0xff, 0xd1, 0xe5, 0xd7, 0xff, 0xce, 0xe0, 0xdf, 0xff, 0x98, 0xa3, 0xa7, 0xff, 0x69, 0x6e, 0x55, 0xff, 0xcb, 0xd3, 0x85, 0xff, 0xda, 0xe3, 0x70, 0xff, 0xdd, 0xe4, 0x66, 0xff, 0xe0, 0xe4, 0x65, 0xff, 0xe1, 0xe7, 0x5f, 0xff, 0xdf, 0xe6, 0x5a, 0xff, 0xe1, 0xe6, 0x5c, 0xff, 0xe2, 0xe6, 0x5a, 0xff, 0xe3, 0xe8, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe6, 0xe8, 0x5a, 0xff, 0xe7, 0xe7, 0x5c, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe8, 0xe8, 0x58, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe1, 0xe7, 0x54, 0xff, 0xe0, 0xe7, 0x57, 0xff, 0xdf, 0xe6, 0x5f, 0xff, 0xda, 0xe1, 0x78, 0xff, 0x90, 0x94, 0x5e, 0xff, 0x54, 0x59, 0x55, 0xfe, 0x58, 0x61, 0x6b, 0xd6, 0x79, 0x83, 0x8a, 0x4c, 0xaa, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x92, 0x92, 0x98, 0x2f, 0x56, 0x5c, 0x64, 0xc4, 0x4a, 0x54, 0x5b, 0xfd, 0x51, 0x59, 0x54, 0xff, 0x76, 0x7b, 0x4a, 0xff, 0xd7, 0xdc, 0x7b, 0xff, 0xe0, 0xe4, 0x68, 0xff, 0xe3, 0xe8, 0x5b, 0xff, 0xe3, 0xe9, 0x5a, 0xff, 0xe3, 0xe9, 0x5a, 0xff, 0xe2, 0xe9, 0x59, 0xff, 0xe3, 0xeb, 0x59, 0xff, 0xe3, 0xeb, 0x57, 0xff, 0xe3, 0xeb, 0x56, 0xff, 0xe4, 0xe7, 0x59, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe4, 0xe7, 0x55, 0xff, 0xe3, 0xe7, 0x55, 0xff, 0xe4, 0xe7, 0x57, 0xff, 0xe2, 0xe6, 0x58, 0xff, 0xe1, 0xe6, 0x57, 0xff, 0xdb, 0xdf, 0x65, 0xff, 0xb1, 0xb4, 0x6e, 0xff, 0x52, 0x57, 0x49, 0xff, 0x96, 0xa5, 0x9c, 0xff, 0x97, 0xad, 0x93, 0xff, 0xdd, 0xf2, 0xd5, 0xff, 0xe0, 0xf1, 0xd5, 0xff, 0xdf, 0xf1, 0xcf, 0xff, 0xde, 0xf2, 0xca, 0xff, 0xdd, 0xf1, 0xc5, 0xff, 0xd4, 0xe6, 0xb8, 0xff, 0xc8, 0xda, 0xab, 0xff, 0xc0, 0xd0, 0xa3, 0xff, 0xa0, 0xac, 0x84, 0xff, 0x98, 0xa2, 0x80, 0xff, 0xc1, 0xcb, 0xa6, 0xff, 0xbf, 0xce, 0x9c, 0xff, 0xc4, 0xd6, 0x9b, 0xff, 0xcc, 0xde, 0xa6, 0xff, 0xd5, 0xe6, 0xb7, 0xff, 0xd5, 0xea, 0xc1, 0xff, 0xd4, 0xec, 0xc3, 0xff, 0xd7, 0xef, 0xc5, 0xff, 0xda, 0xee, 0xc7, 0xff, 0xb7, 0xc9, 0xb0, 0xff, 0xb4, 0xc7, 0xc0, 0xff, 0x99, 0xa6, 0xa5, 0xff, 0x63, 0x69, 0x48, 0xff, 0xcc, 0xd7, 0x77, 0xff, 0xdd, 0xe9, 0x62, 0xff, 0xe1, 0xea, 0x5d, 0xff, 0xe1, 0xe8, 0x5d, 0xff, 0xe4, 0xea, 0x5b, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe5, 0xea, 0x58, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe5, 0xe9, 0x59, 0xff, 0xe4, 0xe8, 0x5a, 0xff, 0xe4, 0xe7, 0x5b, 0xff, 0xe4, 0xe8, 0x5a, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe6, 0xeb, 0x53, 0xff, 0xe5, 0xea, 0x52, 0xff, 0xe3, 0xe9, 0x53, 0xff, 0xe4, 0xeb, 0x55, 0xff, 0xe1, 0xea, 0x56, 0xff, 0xdd, 0xe4, 0x65, 0xff, 0xce, 0xd2, 0x80, 0xff, 0x64, 0x68, 0x49, 0xff, 0x4b, 0x54, 0x56, 0xff, 0x46, 0x4d, 0x58, 0xec, 0x73, 0x73, 0x7c, 0x6f, 0xc6, 0xc6, 0xc6, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x8d, 0x8d, 0x96, 0x38, 0x52, 0x55, 0x5b, 0xd4, 0x57, 0x5e, 0x62, 0xfe, 0x49, 0x51, 0x53, 0xff, 0x53, 0x58, 0x45, 0xff, 0xbb, 0xbf, 0x6f, 0xff, 0xe1, 0xe8, 0x6a, 0xff, 0xe1, 0xe7, 0x5f, 0xff, 0xe2, 0xe9, 0x5a, 0xff, 0xe4, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x5a, 0xff, 0xe7, 0xe9, 0x5a, 0xff, 0xe6, 0xe9, 0x59, 0xff, 0xe5, 0xea, 0x58, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe2, 0xe8, 0x5b, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe7, 0xeb, 0x56, 0xff, 0xe7, 0xe8, 0x56, 0xff, 0xe4, 0xe7, 0x56, 0xff, 0xe2, 0xe8, 0x58, 0xff, 0xdd, 0xe5, 0x5b, 0xff, 0xd1, 0xdb, 0x6a, 0xff, 0xa4, 0xaa, 0x6a, 0xff, 0x4d, 0x50, 0x44, 0xff, 0x90, 0x99, 0x8f, 0xff, 0xc1, 0xd3, 0xb2, 0xff, 0xdb, 0xed, 0xc5, 0xff, 0xdd, 0xed, 0xc4, 0xff, 0xdb, 0xec, 0xbf, 0xff, 0xd1, 0xe3, 0xb2, 0xff, 0xc7, 0xd9, 0xa5, 0xff, 0xc2, 0xd1, 0xa3, 0xff, 0xc2, 0xce, 0xa8, 0xff, 0x91, 0x9a, 0x7c, 0xff, 0x5c, 0x62, 0x4a, 0xff, 0x62, 0x66, 0x52, 0xff, 0x91, 0x97, 0x7b, 0xff, 0xbc, 0xc7, 0x98, 0xff, 0xbe, 0xcd, 0x8d, 0xff, 0xc3, 0xd1, 0x90, 0xff, 0xc5, 0xd2, 0x96, 0xff, 0xc5, 0xd9, 0x9b, 0xff, 0xc3, 0xda, 0x9f, 0xff, 0xc5, 0xda, 0xa0, 0xff, 0xcb, 0xda, 0xa6, 0xff, 0xa7, 0xb1, 0x8e, 0xff, 0x6a, 0x75, 0x6a, 0xff, 0x56, 0x62, 0x5f, 0xff, 0x5e, 0x66, 0x4a, 0xff, 0xca, 0xd2, 0x83, 0xff, 0xdd, 0xe4, 0x6d, 0xff, 0xe2, 0xe9, 0x5f, 0xff, 0xe4, 0xe8, 0x5b, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe6, 0xec, 0x58, 0xff, 0xe5, 0xeb, 0x56, 0xff, 0xe5, 0xea, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe5, 0xea, 0x55, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe7, 0xe9, 0x56, 0xff, 0xe8, 0xea, 0x54, 0xff, 0xe7, 0xe9, 0x56, 0xff, 0xe6, 0xe8, 0x58, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe2, 0xea, 0x56, 0xff, 0xe2, 0xe8, 0x5d, 0xff, 0xdc, 0xe1, 0x75, 0xff, 0x9a, 0xa0, 0x62, 0xff, 0x4d, 0x55, 0x49, 0xff, 0x47, 0x4d, 0x58, 0xff, 0x55, 0x54, 0x5f, 0xf5, 0x6b, 0x69, 0x6e, 0x86, 0xd1, 0xd1, 0xd1, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x97, 0x9c, 0xa1, 0x36, 0x50, 0x53, 0x55, 0xd8, 0x58, 0x5f, 0x55, 0xff, 0x72, 0x7a, 0x73, 0xff, 0x48, 0x4e, 0x48, 0xff, 0x77, 0x7e, 0x49, 0xff, 0xd9, 0xe0, 0x76, 0xff, 0xe1, 0xe8, 0x5e, 0xff, 0xe1, 0xe9, 0x59, 0xff, 0xe3, 0xe9, 0x59, 0xff, 0xe6, 0xe9, 0x59, 0xff, 0xe7, 0xe9, 0x5a, 0xff, 0xe7, 0xe8, 0x5a, 0xff, 0xe6, 0xe7, 0x5a, 0xff, 0xe4, 0xe7, 0x59, 0xff, 0xe3, 0xe9, 0x5a, 0xff, 0xe1, 0xea, 0x59, 0xff, 0xe3, 0xe8, 0x59, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe4, 0xe7, 0x5b, 0xff, 0xe0, 0xe5, 0x62, 0xff, 0xd5, 0xdf, 0x67, 0xff, 0xaa, 0xb5, 0x5a, 0xff, 0x6f, 0x71, 0x45, 0xff, 0x60, 0x60, 0x50, 0xff, 0x94, 0x9b, 0x8b, 0xff, 0xc3, 0xd0, 0xaf, 0xff, 0xc8, 0xd6, 0xaa, 0xff, 0xca, 0xd6, 0xa3, 0xff, 0xc6, 0xd3, 0x9f, 0xff, 0xc0, 0xcf, 0x9e, 0xff, 0xc3, 0xd0, 0xa6, 0xff, 0xb8, 0xc1, 0x9f, 0xff, 0x86, 0x8b, 0x70, 0xff, 0x66, 0x69, 0x4f, 0xff, 0x93, 0x93, 0x72, 0xff, 0x96, 0x98, 0x78, 0xff, 0x63, 0x66, 0x4b, 0xff, 0x84, 0x88, 0x69, 0xff, 0xbf, 0xc6, 0x96, 0xff, 0xc5, 0xce, 0x94, 0xff, 0xc5, 0xd0, 0x92, 0xff, 0xc0, 0xd1, 0x8b, 0xff, 0xbd, 0xcf, 0x8e, 0xff, 0xc1, 0xd0, 0x8e, 0xff, 0xc2, 0xd0, 0x92, 0xff, 0xbf, 0xcf, 0xa4, 0xff, 0xbf, 0xcc, 0xba, 0xff, 0x6f, 0x78, 0x70, 0xff, 0x5e, 0x66, 0x49, 0xff, 0x8b, 0x8f, 0x52, 0xff, 0xca, 0xcd, 0x70, 0xff, 0xe0, 0xe4, 0x6d, 0xff, 0xe4, 0xea, 0x5e, 0xff, 0xe6, 0xe9, 0x56, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe6, 0xeb, 0x57, 0xff, 0xe6, 0xeb, 0x57, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe6, 0xea, 0x54, 0xff, 0xe8, 0xe8, 0x58, 0xff, 0xe7, 0xe9, 0x57, 0xff, 0xe7, 0xe9, 0x57, 0xff, 0xe6, 0xe8, 0x58, 0xff, 0xe5, 0xe7, 0x5a, 0xff, 0xe4, 0xe8, 0x5a, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe2, 0xe7, 0x5b, 0xff, 0xde, 0xe1, 0x67, 0xff, 0xc9, 0xd3, 0x74, 0xff, 0x59, 0x62, 0x3d, 0xff, 0x54, 0x59, 0x59, 0xff, 0x7b, 0x80, 0x77, 0xff, 0x5b, 0x5f, 0x57, 0xf7, 0x72, 0x74, 0x78, 0x86, 0xaa, 0xaa, 0xc6, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xa6, 0xac, 0x28, 0x52, 0x55, 0x55, 0xce, 0x57, 0x5c, 0x4a, 0xff, 0x99, 0xa1, 0x7e, 0xff, 0x7d, 0x84, 0x6c, 0xff, 0x4f, 0x52, 0x3b, 0xff, 0xae, 0xb7, 0x63, 0xff, 0xde, 0xe6, 0x68, 0xff, 0xe3, 0xe6, 0x5d, 0xff, 0xe3, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe8, 0xe8, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe2, 0xe8, 0x57, 0xff, 0xe2, 0xea, 0x58, 0xff, 0xe1, 0xea, 0x56, 0xff, 0xe3, 0xe8, 0x5b, 0xff, 0xe5, 0xe6, 0x5c, 0xff, 0xe6, 0xea, 0x5a, 0xff, 0xe1, 0xe8, 0x5b, 0xff, 0xdb, 0xe1, 0x64, 0xff, 0xa7, 0xae, 0x49, 0xff, 0x9d, 0xa4, 0x4a, 0xff, 0xc1, 0xc6, 0x7a, 0xff, 0xa5, 0xa9, 0x70, 0xff, 0x54, 0x59, 0x3e, 0xff, 0x77, 0x7d, 0x6f, 0xff, 0xa2, 0xab, 0x92, 0xff, 0xb3, 0xb9, 0x9a, 0xff, 0xb1, 0xb7, 0x9a, 0xff, 0xa7, 0xb1, 0x97, 0xff, 0x8d, 0x96, 0x7e, 0xff, 0x71, 0x74, 0x56, 0xff, 0x81, 0x81, 0x55, 0xff, 0xa6, 0xa6, 0x6d, 0xff, 0xb5, 0xb3, 0x6c, 0xff, 0xb2, 0xb5, 0x6d, 0xff, 0x9b, 0x9f, 0x6a, 0xff, 0x6f, 0x6e, 0x51, 0xff, 0x6d, 0x6c, 0x50, 0xff, 0xa0, 0xa5, 0x80, 0xff, 0xba, 0xc2, 0x9a, 0xff, 0xc3, 0xcf, 0x9f, 0xff, 0xc2, 0xcd, 0xa3, 0xff, 0xc9, 0xd0, 0xa0, 0xff, 0xc6, 0xd0, 0xa0, 0xff, 0xb6, 0xca, 0xa7, 0xff, 0x8f, 0x9e, 0x89, 0xff, 0x5e, 0x66, 0x48, 0xff, 0xa6, 0xaf, 0x74, 0xff, 0xa8, 0xae, 0x63, 0xff, 0x84, 0x86, 0x33, 0xff, 0xbe, 0xc4, 0x59, 0xff, 0xe0, 0xe8, 0x5e, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe8, 0xeb, 0x59, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe6, 0xe6, 0x5b, 0xff, 0xe4, 0xe4, 0x61, 0xff, 0xd8, 0xe3, 0x69, 0xff, 0x99, 0xa3, 0x5f, 0xff, 0x59, 0x5c, 0x4a, 0xff, 0xa0, 0xa6, 0x8a, 0xff, 0x8b, 0x91, 0x74, 0xff, 0x5b, 0x5e, 0x55, 0xf7, 0x6a, 0x6c, 0x70, 0x80, 0xdb, 0xdb, 0xdb, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xcf, 0xcf, 0x10, 0x57, 0x5b, 0x61, 0xb0, 0x51, 0x56, 0x40, 0xfe, 0x99, 0x9f, 0x6c, 0xff, 0xc2, 0xc9, 0x94, 0xff, 0x56, 0x5a, 0x36, 0xff, 0x6c, 0x6e, 0x3c, 0xff, 0xd1, 0xd9, 0x72, 0xff, 0xe0, 0xe7, 0x5c, 0xff, 0xe4, 0xe6, 0x5a, 0xff, 0xe6, 0xe9, 0x59, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe7, 0xe7, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe1, 0xe8, 0x57, 0xff, 0xe1, 0xe8, 0x56, 0xff, 0xe1, 0xe9, 0x56, 0xff, 0xe3, 0xe8, 0x5a, 0xff, 0xe5, 0xe7, 0x5b, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xeb, 0x5b, 0xff, 0xd7, 0xdd, 0x59, 0xff, 0xce, 0xd1, 0x5c, 0xff, 0xdb, 0xdf, 0x66, 0xff, 0xd8, 0xe4, 0x5f, 0xff, 0xcc, 0xdb, 0x6e, 0xff, 0x6c, 0x74, 0x46, 0xff, 0x4f, 0x51, 0x59, 0xff, 0x55, 0x5d, 0x61, 0xff, 0x5c, 0x62, 0x63, 0xff, 0x5c, 0x60, 0x67, 0xff, 0x58, 0x5d, 0x5d, 0xff, 0x6a, 0x6d, 0x57, 0xff, 0x9f, 0x9e, 0x6c, 0xff, 0xb5, 0xb3, 0x65, 0xff, 0xbd, 0xbc, 0x5c, 0xff, 0xc4, 0xc4, 0x59, 0xff, 0xc0, 0xc3, 0x58, 0xff, 0xb7, 0xb9, 0x63, 0xff, 0xaa, 0xa7, 0x6d, 0xff, 0x87, 0x85, 0x59, 0xff, 0x5f, 0x62, 0x43, 0xff, 0x64, 0x68, 0x57, 0xff, 0x79, 0x7e, 0x6e, 0xff, 0x87, 0x8d, 0x7f, 0xff, 0x96, 0x98, 0x84, 0xff, 0x8c, 0x90, 0x7d, 0xff, 0x67, 0x73, 0x67, 0xff, 0x4e, 0x5a, 0x46, 0xff, 0xa3, 0xab, 0x6c, 0xff, 0xd4, 0xde, 0x7d, 0xff, 0xd8, 0xdf, 0x6f, 0xff, 0xd4, 0xd7, 0x66, 0xff, 0xb1, 0xb8, 0x42, 0xff, 0xdb, 0xe4, 0x57, 0xff, 0xe3, 0xe9, 0x59, 0xff, 0xe7, 0xeb, 0x59, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe9, 0xe8, 0x58, 0xff, 0xe5, 0xe7, 0x5b, 0xff, 0xdd, 0xe6, 0x64, 0xff, 0xc5, 0xcf, 0x74, 0xff, 0x67, 0x6b, 0x45, 0xff, 0x75, 0x79, 0x59, 0xff, 0xca, 0xd0, 0xa3, 0xff, 0x80, 0x84, 0x61, 0xff, 0x55, 0x5a, 0x4b, 0xf2, 0x6f, 0x74, 0x74, 0x67, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0x05, 0x67, 0x6f, 0x79, 0x83, 0x4f, 0x56, 0x4d, 0xfa, 0x81, 0x8b, 0x4f, 0xff, 0xcd, 0xd2, 0x86, 0xff, 0xab, 0xad, 0x74, 0xff, 0x53, 0x55, 0x28, 0xff, 0xa2, 0xa5, 0x5c, 0xff, 0xd5, 0xde, 0x65, 0xff, 0xdf, 0xe7, 0x54, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe2, 0xe7, 0x56, 0xff, 0xe1, 0xe9, 0x56, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe6, 0xec, 0x58, 0xff, 0xe2, 0xea, 0x57, 0xff, 0xdf, 0xe7, 0x5b, 0xff, 0xe0, 0xe4, 0x60, 0xff, 0xe1, 0xe3, 0x5d, 0xff, 0xdf, 0xe7, 0x58, 0xff, 0xd5, 0xe3, 0x65, 0xff, 0x9c, 0xa5, 0x60, 0xff, 0x6a, 0x6d, 0x6a, 0xff, 0xce, 0xd5, 0xda, 0xff, 0xc5, 0xcc, 0xd1, 0xff, 0xc8, 0xce, 0xd5, 0xff, 0x87, 0x8b, 0x8d, 0xff, 0x86, 0x87, 0x67, 0xff, 0xb9, 0xb6, 0x72, 0xff, 0xc5, 0xc1, 0x5d, 0xff, 0xcd, 0xc9, 0x58, 0xff, 0xd2, 0xd0, 0x5d, 0xff, 0xd2, 0xd4, 0x5b, 0xff, 0xc8, 0xc9, 0x5a, 0xff, 0xbc, 0xb9, 0x5c, 0xff, 0xb4, 0xb2, 0x63, 0xff, 0xa4, 0xa8, 0x6d, 0xff, 0x7e, 0x81, 0x61, 0xff, 0x5b, 0x5e, 0x5e, 0xf9, 0x60, 0x62, 0x69, 0xc8, 0x60, 0x60, 0x62, 0xb7, 0x67, 0x67, 0x6e, 0xa3, 0x6f, 0x75, 0x7c, 0xa3, 0x56, 0x5f, 0x45, 0xfb, 0xca, 0xd2, 0x7c, 0xff, 0xe0, 0xe7, 0x66, 0xff, 0xe4, 0xea, 0x60, 0xff, 0xe0, 0xe4, 0x5f, 0xff, 0xe1, 0xe7, 0x5f, 0xff, 0xdf, 0xe9, 0x57, 0xff, 0xe2, 0xe9, 0x59, 0xff, 0xe6, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x58, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe3, 0xe8, 0x55, 0xff, 0xde, 0xe8, 0x5e, 0xff, 0xd7, 0xe4, 0x73, 0xff, 0x91, 0x97, 0x59, 0xff, 0x5e, 0x63, 0x40, 0xff, 0xba, 0xc0, 0x88, 0xff, 0xc5, 0xcc, 0x8c, 0xff, 0x63, 0x69, 0x3e, 0xff, 0x4f, 0x52, 0x4b, 0xe4, 0x8c, 0x90, 0x9a, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x7f, 0x8b, 0x44, 0x52, 0x54, 0x5a, 0xec, 0x6a, 0x71, 0x47, 0xff, 0xc1, 0xcc, 0x73, 0xff, 0xd6, 0xd8, 0x86, 0xff, 0x82, 0x81, 0x52, 0xff, 0x5b, 0x5d, 0x2f, 0xff, 0xc5, 0xca, 0x70, 0xff, 0xda, 0xe4, 0x5f, 0xff, 0xe0, 0xeb, 0x54, 0xff, 0xe1, 0xea, 0x55, 0xff, 0xe2, 0xe9, 0x55, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe2, 0xe8, 0x56, 0xff, 0xe2, 0xe9, 0x56, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe2, 0xe8, 0x55, 0xff, 0xe0, 0xe7, 0x53, 0xff, 0xe2, 0xea, 0x58, 0xff, 0xdf, 0xe8, 0x58, 0xff, 0xe1, 0xe8, 0x5a, 0xff, 0xe0, 0xe6, 0x5a, 0xff, 0xda, 0xe2, 0x66, 0xff, 0xa8, 0xaf, 0x62, 0xff, 0x6a, 0x6b, 0x5c, 0xff, 0xf4, 0xf6, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfa, 0xfc, 0xfd, 0xff, 0x83, 0x84, 0x7e, 0xff, 0x95, 0x97, 0x62, 0xff, 0xc6, 0xc8, 0x68, 0xff, 0xd1, 0xd3, 0x59, 0xff, 0xd9, 0xda, 0x5c, 0xff, 0xdc, 0xde, 0x62, 0xff, 0xdd, 0xe2, 0x60, 0xff, 0xdc, 0xe0, 0x5f, 0xff, 0xd9, 0xd8, 0x5f, 0xff, 0xcc, 0xcd, 0x5a, 0xff, 0xbb, 0xbe, 0x62, 0xff, 0xa8, 0xaa, 0x70, 0xff, 0x62, 0x66, 0x58, 0xe6, 0xbf, 0xbf, 0xbf, 0x20, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0x03, 0x7d, 0x82, 0x86, 0x39, 0x5f, 0x67, 0x3f, 0xf6, 0xd4, 0xdb, 0x77, 0xff, 0xe9, 0xed, 0x63, 0xff, 0xea, 0xec, 0x5a, 0xff, 0xe8, 0xe8, 0x5c, 0xff, 0xe5, 0xe9, 0x5c, 0xff, 0xe2, 0xec, 0x56, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe8, 0xec, 0x5a, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe8, 0xea, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe0, 0xe8, 0x57, 0xff, 0xdf, 0xe9, 0x5c, 0xff, 0xd8, 0xe6, 0x67, 0xff, 0xb1, 0xbb, 0x6b, 0xff, 0x59, 0x61, 0x39, 0xff, 0x97, 0x9e, 0x63, 0xff, 0xd0, 0xd8, 0x84, 0xff, 0xb0, 0xb7, 0x6d, 0xff, 0x54, 0x58, 0x3d, 0xfe, 0x5a, 0x5f, 0x62, 0xaf, 0xd4, 0xd4, 0xd4, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xd4, 0x0c, 0x60, 0x61, 0x68, 0xb8, 0x5a, 0x5c, 0x4c, 0xff, 0xb7, 0xbb, 0x70, 0xff, 0xd5, 0xdc, 0x74, 0xff, 0xcc, 0xcf, 0x7f, 0xff, 0x66, 0x67, 0x3e, 0xff, 0x7c, 0x80, 0x48, 0xff, 0xd3, 0xd9, 0x71, 0xff, 0xdf, 0xe7, 0x5b, 0xff, 0xe0, 0xea, 0x55, 0xff, 0xe1, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x56, 0xff, 0xe5, 0xe9, 0x56, 0xff, 0xe5, 0xe9, 0x56, 0xff, 0xe4, 0xe9, 0x56, 0xff, 0xe4, 0xe9, 0x56, 0xff, 0xe4, 0xe9, 0x56, 0xff, 0xe4, 0xe9, 0x56, 0xff, 0xe3, 0xe9, 0x55, 0xff, 0xe3, 0xe9, 0x55, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe3, 0xe8, 0x56, 0xff, 0xe5, 0xec, 0x58, 0xff, 0xe2, 0xec, 0x56, 0xff, 0xe1, 0xeb, 0x54, 0xff, 0xe1, 0xe9, 0x53, 0xff, 0xdd, 0xe4, 0x62, 0xff, 0xb4, 0xb6, 0x6a, 0xff, 0x5f, 0x5c, 0x50, 0xff, 0xf4, 0xf3, 0xf7, 0xff, 0xf9, 0xfb, 0xfd, 0xff, 0xf1, 0xf1, 0xf3, 0xff, 0x6a, 0x69, 0x5d, 0xff, 0xab, 0xaf, 0x68, 0xff, 0xd5, 0xde, 0x63, 0xff, 0xdf, 0xe8, 0x57, 0xff, 0xe0, 0xe7, 0x5a, 0xff, 0xe2, 0xe7, 0x5b, 0xff, 0xe0, 0xe8, 0x58, 0xff, 0xe2, 0xe8, 0x5c, 0xff, 0xe4, 0xe6, 0x5e, 0xff, 0xe1, 0xe4, 0x5f, 0xff, 0xd6, 0xd8, 0x67, 0xff, 0xc7, 0xc9, 0x7c, 0xff, 0x6c, 0x72, 0x50, 0xe9, 0xa5, 0xa5, 0xa5, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x50, 0x74, 0x7a, 0x48, 0xf9, 0xd7, 0xdd, 0x72, 0xff, 0xe7, 0xeb, 0x61, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe8, 0xe7, 0x5a, 0xff, 0xe5, 0xe8, 0x5b, 0xff, 0xe6, 0xec, 0x56, 0xff, 0xe7, 0xea, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe8, 0xea, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe1, 0xe7, 0x58, 0xff, 0xe1, 0xea, 0x59, 0xff, 0xdb, 0xe5, 0x60, 0xff, 0xc6, 0xd0, 0x70, 0xff, 0x5e, 0x67, 0x38, 0xff, 0x76, 0x7c, 0x49, 0xff, 0xd0, 0xd9, 0x7e, 0xff, 0xd4, 0xdd, 0x79, 0xff, 0x8f, 0x93, 0x5a, 0xff, 0x53, 0x59, 0x4c, 0xf7, 0x70, 0x79, 0x76, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x7e, 0x84, 0x4d, 0x55, 0x5b, 0x56, 0xf5, 0x88, 0x8a, 0x57, 0xff, 0xd7, 0xd7, 0x77, 0xff, 0xd9, 0xdb, 0x71, 0xff, 0xb9, 0xbd, 0x72, 0xff, 0x5e, 0x64, 0x37, 0xff, 0x9b, 0xa2, 0x5c, 0xff, 0xdd, 0xe3, 0x6d, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe5, 0xe7, 0x59, 0xff, 0xe8, 0xe8, 0x5a, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe4, 0xea, 0x55, 0xff, 0xe4, 0xea, 0x55, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xeb, 0x56, 0xff, 0xe6, 0xec, 0x55, 0xff, 0xe4, 0xe9, 0x55, 0xff, 0xe6, 0xea, 0x55, 0xff, 0xe1, 0xe8, 0x60, 0xff, 0xc1, 0xc6, 0x6e, 0xff, 0x5e, 0x61, 0x47, 0xff, 0xe7, 0xea, 0xec, 0xff, 0xf7, 0xfd, 0xff, 0xff, 0xe4, 0xe8, 0xe7, 0xff, 0x5e, 0x5f, 0x4a, 0xff, 0xb9, 0xc0, 0x6d, 0xff, 0xd9, 0xe3, 0x5b, 0xff, 0xe3, 0xec, 0x53, 0xff, 0xe4, 0xe5, 0x5a, 0xff, 0xe9, 0xe7, 0x57, 0xff, 0xe6, 0xe9, 0x56, 0xff, 0xe2, 0xe8, 0x5a, 0xff, 0xe0, 0xe7, 0x5a, 0xff, 0xe0, 0xe8, 0x57, 0xff, 0xd8, 0xe1, 0x60, 0xff, 0xcf, 0xd6, 0x77, 0xff, 0x7c, 0x80, 0x57, 0xef, 0x8e, 0x8e, 0x88, 0x2b, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x60, 0x65, 0x5c, 0x77, 0x89, 0x8f, 0x55, 0xfc, 0xd5, 0xdc, 0x6d, 0xff, 0xe3, 0xeb, 0x5f, 0xff, 0xe7, 0xeb, 0x58, 0xff, 0xe6, 0xe7, 0x5a, 0xff, 0xe5, 0xe7, 0x59, 0xff, 0xe7, 0xeb, 0x56, 0xff, 0xe9, 0xe9, 0x58, 0xff, 0xe8, 0xe9, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe8, 0xea, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe4, 0xea, 0x55, 0xff, 0xe0, 0xe5, 0x5d, 0xff, 0xd3, 0xda, 0x6f, 0xff, 0x76, 0x7f, 0x43, 0xff, 0x65, 0x6a, 0x40, 0xff, 0xc3, 0xcc, 0x71, 0xff, 0xd7, 0xdf, 0x6c, 0xff, 0xc9, 0xcc, 0x80, 0xff, 0x5e, 0x64, 0x47, 0xff, 0x54, 0x5e, 0x55, 0xc8, 0xb6, 0xc8, 0xc8, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xdb, 0xdb, 0x07, 0x55, 0x58, 0x5e, 0xb3, 0x5c, 0x60, 0x4d, 0xff, 0xbe, 0xc1, 0x74, 0xff, 0xde, 0xe1, 0x6a, 0xff, 0xdc, 0xe0, 0x71, 0xff, 0x9f, 0xa5, 0x61, 0xff, 0x5c, 0x67, 0x3b, 0xff, 0xb4, 0xbd, 0x6a, 0xff, 0xe1, 0xe6, 0x69, 0xff, 0xe5, 0xe9, 0x5c, 0xff, 0xe6, 0xe9, 0x59, 0xff, 0xe9, 0xe6, 0x5a, 0xff, 0xe8, 0xe9, 0x59, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xea, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe6, 0xea, 0x57, 0xff, 0xe6, 0xea, 0x58, 0xff, 0xe5, 0xec, 0x58, 0xff, 0xe0, 0xe9, 0x63, 0xff, 0xd0, 0xd5, 0x79, 0xff, 0x6c, 0x70, 0x46, 0xff, 0xd1, 0xd7, 0xd3, 0xff, 0xf5, 0xfd, 0xfe, 0xff, 0xda, 0xdf, 0xe0, 0xff, 0x5e, 0x61, 0x48, 0xff, 0xc4, 0xcb, 0x73, 0xff, 0xdc, 0xe4, 0x5b, 0xff, 0xe6, 0xeb, 0x56, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe8, 0xe9, 0x56, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe1, 0xe8, 0x5c, 0xff, 0xe2, 0xeb, 0x59, 0xff, 0xe3, 0xec, 0x57, 0xff, 0xde, 0xe5, 0x5d, 0xff, 0xd4, 0xdc, 0x70, 0xff, 0x85, 0x8d, 0x58, 0xf8, 0x7e, 0x81, 0x7e, 0x4f, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x5a, 0x62, 0x50, 0x8d, 0xa1, 0xac, 0x60, 0xfe, 0xda, 0xe2, 0x66, 0xff, 0xe4, 0xea, 0x5c, 0xff, 0xe5, 0xe8, 0x58, 0xff, 0xe8, 0xe8, 0x59, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe7, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe9, 0x54, 0xff, 0xdf, 0xe3, 0x5c, 0xff, 0xd7, 0xe0, 0x6e, 0xff, 0x93, 0x9c, 0x58, 0xff, 0x5e, 0x60, 0x3c, 0xff, 0xbb, 0xc1, 0x6f, 0xff, 0xdf, 0xe7, 0x6a, 0xff, 0xdc, 0xe2, 0x76, 0xff, 0x98, 0x9d, 0x62, 0xff, 0x54, 0x5a, 0x4e, 0xf3, 0x7f, 0x83, 0x8b, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x85, 0x2c, 0x4d, 0x4f, 0x51, 0xe9, 0x76, 0x79, 0x51, 0xff, 0xd3, 0xd7, 0x79, 0xff, 0xe1, 0xe5, 0x65, 0xff, 0xdb, 0xe0, 0x73, 0xff, 0x88, 0x8f, 0x51, 0xff, 0x5d, 0x67, 0x3b, 0xff, 0xc5, 0xce, 0x73, 0xff, 0xe1, 0xe4, 0x63, 0xff, 0xe4, 0xe8, 0x5c, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe9, 0xe8, 0x5a, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe6, 0xea, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe6, 0xeb, 0x58, 0xff, 0xe6, 0xeb, 0x58, 0xff, 0xe4, 0xec, 0x58, 0xff, 0xe2, 0xe9, 0x62, 0xff, 0xdb, 0xdf, 0x7a, 0xff, 0x86, 0x89, 0x54, 0xff, 0xad, 0xb2, 0xae, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0xcd, 0xd1, 0xcd, 0xff, 0x68, 0x6b, 0x47, 0xff, 0xcf, 0xd7, 0x78, 0xff, 0xdf, 0xe6, 0x5b, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe6, 0xeb, 0x56, 0xff, 0xe2, 0xe8, 0x5a, 0xff, 0xe1, 0xe9, 0x5c, 0xff, 0xe1, 0xeb, 0x57, 0xff, 0xe1, 0xe9, 0x54, 0xff, 0xde, 0xe6, 0x5c, 0xff, 0xd6, 0xdd, 0x6d, 0xff, 0x8f, 0x97, 0x5f, 0xfc, 0x79, 0x79, 0x79, 0x65, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xb1, 0xb1, 0x0d, 0x58, 0x5b, 0x48, 0xc4, 0xba, 0xc0, 0x73, 0xff, 0xde, 0xe3, 0x67, 0xff, 0xe3, 0xe7, 0x58, 0xff, 0xe5, 0xe8, 0x58, 0xff, 0xe8, 0xe8, 0x58, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe8, 0x58, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe9, 0x54, 0xff, 0xe2, 0xe6, 0x5d, 0xff, 0xd7, 0xe0, 0x68, 0xff, 0xaf, 0xb6, 0x6c, 0xff, 0x5f, 0x62, 0x3a, 0xff, 0xb0, 0xb3, 0x68, 0xff, 0xde, 0xe5, 0x6b, 0xff, 0xe0, 0xe7, 0x69, 0xff, 0xc4, 0xca, 0x7b, 0xff, 0x5b, 0x5f, 0x49, 0xfd, 0x6e, 0x70, 0x72, 0x89, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x9b, 0x9b, 0x2e, 0xb8, 0xb8, 0xc2, 0x19, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x9a, 0x94, 0xa8, 0x26, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x69, 0x76, 0x4e, 0x4e, 0x4f, 0x4a, 0xfa, 0x97, 0x9c, 0x5d, 0xff, 0xd9, 0xde, 0x6d, 0xff, 0xdd, 0xe2, 0x60, 0xff, 0xd4, 0xd8, 0x75, 0xff, 0x77, 0x7d, 0x48, 0xff, 0x65, 0x6e, 0x3f, 0xff, 0xd3, 0xda, 0x78, 0xff, 0xe8, 0xe9, 0x61, 0xff, 0xe5, 0xe8, 0x58, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe9, 0xe8, 0x59, 0xff, 0xe5, 0xe9, 0x56, 0xff, 0xe5, 0xe9, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe6, 0xea, 0x59, 0xff, 0xe5, 0xe9, 0x5c, 0xff, 0xe0, 0xe5, 0x6e, 0xff, 0xa5, 0xaa, 0x61, 0xff, 0x7e, 0x83, 0x7c, 0xff, 0xf0, 0xf5, 0xf5, 0xff, 0xc0, 0xc2, 0xbe, 0xff, 0x6e, 0x72, 0x47, 0xff, 0xd2, 0xdb, 0x74, 0xff, 0xde, 0xe6, 0x58, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe4, 0xe9, 0x59, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe0, 0xe9, 0x59, 0xff, 0xe1, 0xeb, 0x56, 0xff, 0xe1, 0xea, 0x55, 0xff, 0xe0, 0xe8, 0x5c, 0xff, 0xd8, 0xe0, 0x69, 0xff, 0x99, 0xa0, 0x5f, 0xfe, 0x74, 0x76, 0x70, 0x79, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x7d, 0x75, 0x3f, 0x65, 0x68, 0x44, 0xf2, 0xd0, 0xd3, 0x7a, 0xff, 0xe2, 0xe4, 0x63, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x56, 0xff, 0xe6, 0xe9, 0x53, 0xff, 0xe4, 0xe6, 0x59, 0xff, 0xdc, 0xe3, 0x65, 0xff, 0xc1, 0xc6, 0x73, 0xff, 0x63, 0x64, 0x38, 0xff, 0xa4, 0xa8, 0x61, 0xff, 0xdc, 0xe2, 0x6d, 0xff, 0xe1, 0xe9, 0x64, 0xff, 0xd4, 0xdb, 0x78, 0xff, 0x70, 0x76, 0x4a, 0xff, 0x62, 0x64, 0x63, 0xb7, 0x9f, 0x9f, 0xbf, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x8f, 0x92, 0x52, 0x89, 0x8e, 0x90, 0x6c, 0xff, 0xff, 0xff, 0x01, 
-  0x00, 0x00, 0x00, 0x00, 0xc8, 0xc8, 0xdb, 0x0e, 0x6b, 0x6b, 0x79, 0x8d, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x5f, 0x6e, 0x66, 0x51, 0x52, 0x47, 0xfc, 0xae, 0xb4, 0x65, 0xff, 0xdc, 0xe2, 0x61, 0xff, 0xe0, 0xe3, 0x61, 0xff, 0xcb, 0xcf, 0x75, 0xff, 0x6d, 0x73, 0x45, 0xff, 0x6d, 0x74, 0x44, 0xff, 0xda, 0xdf, 0x78, 0xff, 0xe8, 0xe8, 0x5c, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe6, 0xeb, 0x55, 0xff, 0xe9, 0xe9, 0x58, 0xff, 0xe5, 0xeb, 0x55, 0xff, 0xe5, 0xea, 0x55, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe5, 0xeb, 0x56, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe5, 0xe7, 0x5a, 0xff, 0xe7, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x60, 0xff, 0xca, 0xd1, 0x73, 0xff, 0x64, 0x69, 0x4c, 0xff, 0xc4, 0xc8, 0xcc, 0xff, 0xb3, 0xb7, 0xb9, 0xff, 0x78, 0x80, 0x54, 0xff, 0xd8, 0xe3, 0x7b, 0xff, 0xe1, 0xe9, 0x5b, 0xff, 0xe5, 0xe9, 0x54, 0xff, 0xe5, 0xe9, 0x54, 0xff, 0xe4, 0xe8, 0x56, 0xff, 0xe0, 0xe8, 0x57, 0xff, 0xdf, 0xe9, 0x57, 0xff, 0xe1, 0xea, 0x56, 0xff, 0xe5, 0xec, 0x58, 0xff, 0xe3, 0xea, 0x5d, 0xff, 0xde, 0xe6, 0x68, 0xff, 0xa7, 0xb0, 0x62, 0xff, 0x74, 0x7c, 0x70, 0xa2, 0xeb, 0xff, 0xff, 0x0d, 0x5f, 0x62, 0x52, 0xa7, 0x8a, 0x90, 0x55, 0xfe, 0xdc, 0xe4, 0x71, 0xff, 0xe7, 0xeb, 0x5a, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x56, 0xff, 0xe7, 0xe9, 0x53, 0xff, 0xe6, 0xe6, 0x57, 0xff, 0xdf, 0xe4, 0x60, 0xff, 0xcd, 0xd1, 0x75, 0xff, 0x6a, 0x6c, 0x3b, 0xff, 0x96, 0x9a, 0x58, 0xff, 0xd9, 0xdf, 0x6f, 0xff, 0xe1, 0xe9, 0x5e, 0xff, 0xdb, 0xe4, 0x6f, 0xff, 0x8c, 0x91, 0x55, 0xff, 0x59, 0x5c, 0x57, 0xdc, 0x9f, 0x9f, 0x9f, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x93, 0x93, 0x28, 0x77, 0x7a, 0x7f, 0xa1, 0xcc, 0xcc, 0xcc, 0x0a, 
-  0x00, 0x00, 0x00, 0x00, 0x8c, 0x8c, 0x99, 0x3c, 0x6f, 0x6f, 0x7f, 0xa5, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x65, 0x67, 0x6f, 0x77, 0x51, 0x53, 0x45, 0xfd, 0xb5, 0xb8, 0x64, 0xff, 0xda, 0xe0, 0x5b, 0xff, 0xdf, 0xe3, 0x62, 0xff, 0xb6, 0xba, 0x64, 0xff, 0x5e, 0x66, 0x3c, 0xff, 0x6f, 0x75, 0x44, 0xff, 0xda, 0xde, 0x76, 0xff, 0xe8, 0xe8, 0x5c, 0xff, 0xe7, 0xeb, 0x59, 0xff, 0xe5, 0xeb, 0x56, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe5, 0xeb, 0x54, 0xff, 0xe5, 0xea, 0x55, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xea, 0x57, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe5, 0xe6, 0x5b, 0xff, 0xe7, 0xe9, 0x56, 0xff, 0xe3, 0xe9, 0x55, 0xff, 0xd9, 0xe1, 0x70, 0xff, 0x99, 0x9e, 0x5e, 0xff, 0x71, 0x77, 0x6f, 0xff, 0x92, 0x98, 0x95, 0xff, 0x84, 0x8d, 0x59, 0xff, 0xdb, 0xe6, 0x7b, 0xff, 0xe2, 0xe9, 0x5b, 0xff, 0xe7, 0xea, 0x54, 0xff, 0xe5, 0xe9, 0x52, 0xff, 0xe1, 0xe6, 0x55, 0xff, 0xde, 0xe7, 0x57, 0xff, 0xde, 0xe9, 0x56, 0xff, 0xdf, 0xe8, 0x56, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe3, 0xea, 0x5c, 0xff, 0xdf, 0xe7, 0x65, 0xff, 0xb5, 0xbd, 0x6c, 0xff, 0x6d, 0x75, 0x69, 0xd8, 0x9c, 0xa1, 0xa1, 0x6f, 0x5b, 0x5a, 0x47, 0xf3, 0xb6, 0xbc, 0x70, 0xff, 0xdb, 0xe4, 0x62, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe6, 0xe7, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe7, 0xe9, 0x54, 0xff, 0xe6, 0xe6, 0x57, 0xff, 0xdf, 0xe5, 0x5e, 0xff, 0xd0, 0xd6, 0x75, 0xff, 0x6a, 0x6c, 0x39, 0xff, 0x89, 0x8e, 0x4e, 0xff, 0xd4, 0xdc, 0x6e, 0xff, 0xe0, 0xe9, 0x5c, 0xff, 0xdd, 0xe4, 0x6a, 0xff, 0x98, 0x9d, 0x5c, 0xff, 0x56, 0x58, 0x54, 0xe5, 0x93, 0x9b, 0x9b, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0xaa, 0x18, 0x6f, 0x73, 0x79, 0xbf, 0xac, 0xb4, 0xb4, 0x22, 
-  0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x8f, 0x70, 0x75, 0x75, 0x83, 0xa6, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x63, 0x63, 0x6d, 0x77, 0x4f, 0x53, 0x45, 0xfd, 0xb9, 0xba, 0x6b, 0xff, 0xdf, 0xdf, 0x62, 0xff, 0xd9, 0xdd, 0x60, 0xff, 0xae, 0xb4, 0x60, 0xff, 0x5a, 0x61, 0x3a, 0xff, 0x6d, 0x74, 0x44, 0xff, 0xd9, 0xdd, 0x77, 0xff, 0xe6, 0xe6, 0x5b, 0xff, 0xe3, 0xe8, 0x58, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe6, 0xe8, 0x57, 0xff, 0xe5, 0xeb, 0x54, 0xff, 0xe6, 0xea, 0x55, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xea, 0x58, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe3, 0xe7, 0x5a, 0xff, 0xe4, 0xe9, 0x56, 0xff, 0xe4, 0xea, 0x54, 0xff, 0xdf, 0xe5, 0x63, 0xff, 0xd3, 0xd8, 0x77, 0xff, 0x8a, 0x8e, 0x52, 0xff, 0x5b, 0x60, 0x32, 0xff, 0xad, 0xb3, 0x65, 0xff, 0xdc, 0xe5, 0x6c, 0xff, 0xe2, 0xe8, 0x58, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe1, 0xe8, 0x54, 0xff, 0xe0, 0xe5, 0x58, 0xff, 0xdf, 0xe7, 0x58, 0xff, 0xdd, 0xe8, 0x56, 0xff, 0xe1, 0xe9, 0x58, 0xff, 0xe3, 0xe7, 0x59, 0xff, 0xe2, 0xe8, 0x5b, 0xff, 0xdf, 0xe7, 0x60, 0xff, 0xc4, 0xca, 0x6f, 0xff, 0x65, 0x6e, 0x4b, 0xfd, 0x69, 0x6e, 0x53, 0xf8, 0x97, 0x95, 0x5c, 0xff, 0xd3, 0xd7, 0x73, 0xff, 0xe0, 0xe5, 0x5f, 0xff, 0xe6, 0xe6, 0x57, 0xff, 0xe6, 0xe8, 0x57, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x58, 0xff, 0xe7, 0xe7, 0x59, 0xff, 0xe7, 0xe9, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe2, 0xe8, 0x5a, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe7, 0xe8, 0x57, 0xff, 0xe6, 0xe6, 0x5a, 0xff, 0xdf, 0xe5, 0x5f, 0xff, 0xcf, 0xd6, 0x74, 0xff, 0x69, 0x6b, 0x39, 0xff, 0x7e, 0x83, 0x47, 0xff, 0xce, 0xd8, 0x6a, 0xff, 0xde, 0xe7, 0x5d, 0xff, 0xdd, 0xe2, 0x6d, 0xff, 0x9e, 0xa2, 0x63, 0xff, 0x58, 0x5d, 0x58, 0xe7, 0x8a, 0x92, 0x99, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x12, 0x6c, 0x6f, 0x78, 0xc8, 0x97, 0x9c, 0xa0, 0x3b, 
-  0x00, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x8d, 0x89, 0x7a, 0x7a, 0x89, 0xa7, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x64, 0x67, 0x59, 0x52, 0x59, 0x4a, 0xfb, 0xaf, 0xae, 0x68, 0xff, 0xde, 0xdb, 0x68, 0xff, 0xd6, 0xda, 0x62, 0xff, 0xac, 0xb4, 0x60, 0xff, 0x59, 0x60, 0x3a, 0xff, 0x67, 0x6d, 0x3f, 0xff, 0xd5, 0xda, 0x74, 0xff, 0xe2, 0xe4, 0x59, 0xff, 0xe2, 0xe7, 0x58, 0xff, 0xe1, 0xe8, 0x56, 0xff, 0xe5, 0xe7, 0x56, 0xff, 0xe5, 0xea, 0x54, 0xff, 0xe6, 0xea, 0x55, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe8, 0xe8, 0x58, 0xff, 0xe8, 0xe8, 0x58, 0xff, 0xe8, 0xe8, 0x58, 0xff, 0xe8, 0xe8, 0x58, 0xff, 0xe9, 0xe9, 0x59, 0xff, 0xe9, 0xe9, 0x59, 0xff, 0xe7, 0xe9, 0x58, 0xff, 0xe3, 0xe7, 0x58, 0xff, 0xe1, 0xe7, 0x5a, 0xff, 0xe2, 0xe8, 0x57, 0xff, 0xe4, 0xe9, 0x54, 0xff, 0xe3, 0xe8, 0x5c, 0xff, 0xe0, 0xe4, 0x69, 0xff, 0xd9, 0xdb, 0x77, 0xff, 0xca, 0xcb, 0x6e, 0xff, 0xdb, 0xdf, 0x72, 0xff, 0xe0, 0xe7, 0x5f, 0xff, 0xe3, 0xe8, 0x59, 0xff, 0xde, 0xe4, 0x5a, 0xff, 0xdb, 0xe5, 0x5c, 0xff, 0xdf, 0xe5, 0x5e, 0xff, 0xdc, 0xe4, 0x5a, 0xff, 0xda, 0xe4, 0x58, 0xff, 0xe0, 0xe6, 0x5b, 0xff, 0xdf, 0xe3, 0x5a, 0xff, 0xdd, 0xe3, 0x58, 0xff, 0xdc, 0xe4, 0x59, 0xff, 0xd5, 0xde, 0x6d, 0xff, 0xa0, 0xae, 0x5f, 0xff, 0x9f, 0xaa, 0x58, 0xff, 0xd5, 0xd7, 0x6f, 0xff, 0xde, 0xe3, 0x60, 0xff, 0xe4, 0xe7, 0x59, 0xff, 0xe8, 0xe7, 0x5a, 0xff, 0xe6, 0xe8, 0x56, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe7, 0xe8, 0x59, 0xff, 0xe7, 0xe9, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe2, 0xe8, 0x5b, 0xff, 0xe3, 0xe8, 0x5a, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe4, 0xe6, 0x5b, 0xff, 0xdd, 0xe5, 0x5f, 0xff, 0xca, 0xd3, 0x72, 0xff, 0x65, 0x67, 0x37, 0xff, 0x80, 0x84, 0x49, 0xff, 0xc9, 0xd3, 0x66, 0xff, 0xda, 0xe3, 0x5c, 0xff, 0xdb, 0xdf, 0x71, 0xff, 0x92, 0x95, 0x5d, 0xff, 0x58, 0x60, 0x5b, 0xe1, 0x92, 0x9b, 0xa4, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x12, 0x6b, 0x6d, 0x75, 0xcd, 0x91, 0x95, 0x9c, 0x48, 
-  0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x8e, 0x85, 0x7c, 0x7a, 0x8c, 0xaf, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x6c, 0x74, 0x40, 0x52, 0x5b, 0x52, 0xf5, 0x96, 0x97, 0x60, 0xff, 0xd8, 0xd5, 0x76, 0xff, 0xd0, 0xd1, 0x65, 0xff, 0xac, 0xb2, 0x60, 0xff, 0x5a, 0x62, 0x39, 0xff, 0x5f, 0x63, 0x3a, 0xff, 0xcb, 0xd2, 0x6f, 0xff, 0xe2, 0xe8, 0x57, 0xff, 0xe8, 0xe8, 0x57, 0xff, 0xe5, 0xe7, 0x57, 0xff, 0xe4, 0xea, 0x52, 0xff, 0xe6, 0xe9, 0x56, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe7, 0xe9, 0x5a, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xea, 0x57, 0xff, 0xe2, 0xe9, 0x57, 0xff, 0xe1, 0xe6, 0x5a, 0xff, 0xe5, 0xe7, 0x5a, 0xff, 0xe7, 0xe8, 0x56, 0xff, 0xe6, 0xe8, 0x57, 0xff, 0xe0, 0xe6, 0x5b, 0xff, 0xdf, 0xe5, 0x60, 0xff, 0xdd, 0xe3, 0x62, 0xff, 0xdf, 0xe6, 0x68, 0xff, 0xdc, 0xe5, 0x66, 0xff, 0xd9, 0xe3, 0x68, 0xff, 0xd8, 0xe2, 0x71, 0xff, 0xdb, 0xe5, 0x7c, 0xff, 0xdd, 0xe7, 0x81, 0xff, 0xdf, 0xe9, 0x83, 0xff, 0xe1, 0xea, 0x84, 0xff, 0xdf, 0xe8, 0x7e, 0xff, 0xdb, 0xe5, 0x75, 0xff, 0xd8, 0xe4, 0x6b, 0xff, 0xd7, 0xe3, 0x67, 0xff, 0xd6, 0xe1, 0x6b, 0xff, 0xd7, 0xe4, 0x6d, 0xff, 0xdb, 0xe6, 0x69, 0xff, 0xde, 0xe6, 0x61, 0xff, 0xe3, 0xe6, 0x5b, 0xff, 0xe5, 0xe4, 0x57, 0xff, 0xe5, 0xe5, 0x56, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe7, 0xe9, 0x57, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe2, 0xe8, 0x5a, 0xff, 0xe3, 0xea, 0x56, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe2, 0xe7, 0x57, 0xff, 0xd9, 0xe3, 0x5e, 0xff, 0xbe, 0xc7, 0x6d, 0xff, 0x61, 0x63, 0x39, 0xff, 0x85, 0x86, 0x4d, 0xff, 0xc6, 0xc9, 0x62, 0xff, 0xce, 0xd4, 0x55, 0xff, 0xcd, 0xd6, 0x6f, 0xff, 0x74, 0x7a, 0x49, 0xff, 0x5c, 0x5e, 0x5e, 0xc5, 0x9d, 0x9d, 0x9d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xb5, 0x18, 0x6b, 0x6e, 0x73, 0xd2, 0x96, 0x9a, 0x9e, 0x3f, 
-  0x00, 0x00, 0x00, 0x00, 0x83, 0x83, 0x91, 0x6d, 0x77, 0x77, 0x88, 0xbe, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x7f, 0x89, 0x1a, 0x4e, 0x54, 0x58, 0xdd, 0x74, 0x78, 0x51, 0xff, 0xc8, 0xcb, 0x73, 0xff, 0xcb, 0xcb, 0x5e, 0xff, 0xae, 0xaf, 0x59, 0xff, 0x60, 0x65, 0x3a, 0xff, 0x57, 0x5a, 0x35, 0xff, 0xbd, 0xc3, 0x67, 0xff, 0xdf, 0xe4, 0x59, 0xff, 0xe5, 0xe4, 0x56, 0xff, 0xe6, 0xe6, 0x59, 0xff, 0xe5, 0xe9, 0x54, 0xff, 0xe7, 0xe7, 0x57, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe7, 0xe9, 0x5a, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe3, 0xe7, 0x59, 0xff, 0xe1, 0xe7, 0x5a, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe7, 0xea, 0x54, 0xff, 0xe3, 0xe8, 0x55, 0xff, 0xdd, 0xe6, 0x5d, 0xff, 0xd8, 0xe2, 0x64, 0xff, 0xd6, 0xdf, 0x6c, 0xff, 0xd9, 0xe3, 0x7c, 0xff, 0xe2, 0xef, 0x90, 0xff, 0xe7, 0xf8, 0x9f, 0xff, 0xe9, 0xfb, 0xab, 0xff, 0xeb, 0xfe, 0xb4, 0xff, 0xed, 0xfe, 0xbb, 0xff, 0xed, 0xfc, 0xba, 0xff, 0xee, 0xfb, 0xba, 0xff, 0xed, 0xfb, 0xb7, 0xff, 0xee, 0xfc, 0xb3, 0xff, 0xec, 0xfb, 0xad, 0xff, 0xe8, 0xf6, 0xa3, 0xff, 0xe3, 0xf0, 0x93, 0xff, 0xda, 0xe7, 0x83, 0xff, 0xd6, 0xe1, 0x73, 0xff, 0xdc, 0xe4, 0x6a, 0xff, 0xdf, 0xe4, 0x5f, 0xff, 0xe4, 0xe6, 0x59, 0xff, 0xe7, 0xe9, 0x59, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe1, 0xe9, 0x56, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe3, 0xe8, 0x58, 0xff, 0xe3, 0xe8, 0x59, 0xff, 0xe6, 0xe9, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x56, 0xff, 0xe4, 0xe9, 0x55, 0xff, 0xe4, 0xe7, 0x57, 0xff, 0xe0, 0xe5, 0x58, 0xff, 0xd5, 0xdc, 0x64, 0xff, 0xb4, 0xb9, 0x6e, 0xff, 0x64, 0x66, 0x3c, 0xff, 0x8f, 0x92, 0x53, 0xff, 0xc0, 0xc3, 0x5f, 0xff, 0xc2, 0xc8, 0x59, 0xff, 0xb4, 0xba, 0x6b, 0xff, 0x59, 0x5e, 0x42, 0xfe, 0x5a, 0x5c, 0x61, 0x9e, 0xaa, 0xaa, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x95, 0x9c, 0x24, 0x6b, 0x6e, 0x73, 0xd5, 0xa4, 0xaa, 0xaa, 0x2a, 
-  0x00, 0x00, 0x00, 0x00, 0x8e, 0x8e, 0x9a, 0x44, 0x77, 0x77, 0x85, 0xcf, 0xaa, 0xaa, 0xb6, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x04, 0x53, 0x55, 0x63, 0xa2, 0x59, 0x61, 0x52, 0xff, 0xa5, 0xab, 0x68, 0xff, 0xc2, 0xc0, 0x5f, 0xff, 0xb0, 0xac, 0x56, 0xff, 0x70, 0x71, 0x43, 0xff, 0x51, 0x55, 0x33, 0xff, 0xad, 0xb2, 0x5f, 0xff, 0xd6, 0xda, 0x5a, 0xff, 0xe5, 0xe3, 0x59, 0xff, 0xe6, 0xe7, 0x5a, 0xff, 0xe6, 0xe8, 0x55, 0xff, 0xe8, 0xe7, 0x57, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe4, 0xe9, 0x56, 0xff, 0xe6, 0xe8, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe7, 0x59, 0xff, 0xe5, 0xe7, 0x5c, 0xff, 0xe3, 0xe9, 0x59, 0xff, 0xe3, 0xeb, 0x55, 0xff, 0xe2, 0xea, 0x56, 0xff, 0xde, 0xe7, 0x5f, 0xff, 0xd6, 0xe2, 0x68, 0xff, 0xd4, 0xe3, 0x7e, 0xff, 0xe6, 0xf5, 0xa0, 0xff, 0xed, 0xfc, 0xb4, 0xff, 0xea, 0xfc, 0xbd, 0xff, 0xe4, 0xfc, 0xc1, 0xff, 0xde, 0xfa, 0xc4, 0xff, 0xdb, 0xf9, 0xc7, 0xff, 0xde, 0xf8, 0xc7, 0xff, 0xdd, 0xf7, 0xc7, 0xff, 0xdf, 0xf7, 0xc9, 0xff, 0xdf, 0xf5, 0xc8, 0xff, 0xe1, 0xf7, 0xc7, 0xff, 0xe1, 0xf8, 0xc5, 0xff, 0xe4, 0xf9, 0xc1, 0xff, 0xe9, 0xfd, 0xba, 0xff, 0xed, 0xfd, 0xb8, 0xff, 0xeb, 0xf9, 0xaa, 0xff, 0xe4, 0xef, 0x93, 0xff, 0xd9, 0xe2, 0x73, 0xff, 0xdc, 0xe3, 0x65, 0xff, 0xe0, 0xe7, 0x60, 0xff, 0xe2, 0xe8, 0x5c, 0xff, 0xe1, 0xe9, 0x57, 0xff, 0xe2, 0xe9, 0x56, 0xff, 0xe4, 0xeb, 0x57, 0xff, 0xe3, 0xe9, 0x59, 0xff, 0xe3, 0xe8, 0x5c, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe4, 0xe7, 0x56, 0xff, 0xe4, 0xe8, 0x55, 0xff, 0xe4, 0xe9, 0x54, 0xff, 0xe4, 0xe8, 0x55, 0xff, 0xe3, 0xe6, 0x55, 0xff, 0xde, 0xe2, 0x59, 0xff, 0xcf, 0xd4, 0x67, 0xff, 0xa3, 0xa6, 0x66, 0xff, 0x65, 0x67, 0x3d, 0xff, 0x9e, 0xa3, 0x60, 0xff, 0xbf, 0xc5, 0x66, 0xff, 0xbe, 0xc2, 0x6b, 0xff, 0x8c, 0x8e, 0x5c, 0xff, 0x4d, 0x4f, 0x49, 0xf7, 0x67, 0x6a, 0x73, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x8a, 0x90, 0x57, 0x71, 0x75, 0x79, 0xbf, 0xbb, 0xcc, 0xcc, 0x0f, 
-  0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0xb5, 0x18, 0x80, 0x81, 0x8b, 0xcb, 0x90, 0x90, 0x98, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x78, 0x83, 0x42, 0x4d, 0x54, 0x57, 0xef, 0x6c, 0x71, 0x51, 0xff, 0xaf, 0xaa, 0x69, 0xff, 0xad, 0xa5, 0x60, 0xff, 0x81, 0x82, 0x55, 0xff, 0x4e, 0x54, 0x32, 0xff, 0x98, 0x9d, 0x57, 0xff, 0xcb, 0xce, 0x5b, 0xff, 0xe3, 0xe2, 0x5c, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe6, 0xe9, 0x56, 0xff, 0xe9, 0xe9, 0x56, 0xff, 0xe6, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe8, 0x58, 0xff, 0xe7, 0xe8, 0x59, 0xff, 0xe2, 0xec, 0x57, 0xff, 0xdd, 0xeb, 0x57, 0xff, 0xda, 0xe6, 0x62, 0xff, 0xd6, 0xe2, 0x74, 0xff, 0xe3, 0xf2, 0x97, 0xff, 0xe9, 0xff, 0xb3, 0xff, 0xe3, 0xfb, 0xbb, 0xff, 0xe3, 0xfa, 0xc5, 0xff, 0xdf, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdc, 0xf8, 0xca, 0xff, 0xda, 0xf7, 0xc9, 0xff, 0xdb, 0xfa, 0xc5, 0xff, 0xdb, 0xf9, 0xc5, 0xff, 0xdb, 0xf8, 0xc6, 0xff, 0xdc, 0xf7, 0xc8, 0xff, 0xdd, 0xf7, 0xc7, 0xff, 0xdd, 0xf8, 0xc7, 0xff, 0xdc, 0xf7, 0xc6, 0xff, 0xda, 0xf7, 0xc5, 0xff, 0xdf, 0xf9, 0xc6, 0xff, 0xe4, 0xfb, 0xc3, 0xff, 0xeb, 0xfc, 0xbb, 0xff, 0xef, 0xfd, 0xae, 0xff, 0xe4, 0xf1, 0x96, 0xff, 0xd7, 0xe0, 0x71, 0xff, 0xdd, 0xe4, 0x62, 0xff, 0xe0, 0xe7, 0x5b, 0xff, 0xe4, 0xe9, 0x55, 0xff, 0xe7, 0xea, 0x54, 0xff, 0xe5, 0xe9, 0x55, 0xff, 0xe4, 0xe7, 0x58, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x55, 0xff, 0xe5, 0xe8, 0x54, 0xff, 0xe5, 0xe7, 0x57, 0xff, 0xe2, 0xe5, 0x54, 0xff, 0xdb, 0xe0, 0x57, 0xff, 0xc7, 0xcc, 0x66, 0xff, 0x8a, 0x8e, 0x54, 0xff, 0x61, 0x67, 0x3c, 0xff, 0xa7, 0xae, 0x6f, 0xff, 0xb8, 0xbf, 0x70, 0xff, 0xaa, 0xae, 0x70, 0xff, 0x5e, 0x5e, 0x48, 0xff, 0x51, 0x52, 0x55, 0xd1, 0x95, 0x95, 0xaa, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x76, 0x78, 0x7f, 0x91, 0x7b, 0x7f, 0x82, 0x87, 0xff, 0xff, 0xff, 0x02, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x84, 0x88, 0x91, 0x87, 0x86, 0x86, 0x8f, 0x89, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xd4, 0xd4, 0x06, 0x4d, 0x51, 0x5d, 0x91, 0x52, 0x53, 0x53, 0xfb, 0x7c, 0x77, 0x5b, 0xff, 0xa2, 0x9d, 0x75, 0xff, 0x8d, 0x8f, 0x6d, 0xff, 0x4c, 0x53, 0x38, 0xff, 0x81, 0x86, 0x4e, 0xff, 0xbf, 0xc1, 0x5f, 0xff, 0xda, 0xdc, 0x5b, 0xff, 0xe2, 0xe8, 0x5a, 0xff, 0xe4, 0xe9, 0x56, 0xff, 0xe9, 0xeb, 0x56, 0xff, 0xe6, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x55, 0xff, 0xe4, 0xe8, 0x56, 0xff, 0xdc, 0xe9, 0x58, 0xff, 0xd4, 0xe5, 0x62, 0xff, 0xd4, 0xe3, 0x7b, 0xff, 0xe9, 0xf6, 0xaa, 0xff, 0xea, 0xfc, 0xbe, 0xff, 0xe0, 0xfc, 0xc2, 0xff, 0xdb, 0xfa, 0xc5, 0xff, 0xdd, 0xf8, 0xcb, 0xff, 0xdd, 0xf8, 0xcb, 0xff, 0xde, 0xf9, 0xc8, 0xff, 0xdf, 0xf8, 0xc6, 0xff, 0xdf, 0xf8, 0xc6, 0xff, 0xdf, 0xf9, 0xc5, 0xff, 0xdf, 0xf9, 0xc6, 0xff, 0xdf, 0xf8, 0xc7, 0xff, 0xdf, 0xf8, 0xc7, 0xff, 0xdf, 0xf7, 0xc7, 0xff, 0xdf, 0xf7, 0xc8, 0xff, 0xdc, 0xf7, 0xc9, 0xff, 0xd7, 0xf8, 0xcb, 0xff, 0xd8, 0xf7, 0xcb, 0xff, 0xda, 0xf7, 0xca, 0xff, 0xe0, 0xf8, 0xc7, 0xff, 0xe6, 0xfa, 0xc2, 0xff, 0xe9, 0xfa, 0xbd, 0xff, 0xe9, 0xf6, 0xa6, 0xff, 0xd7, 0xe1, 0x77, 0xff, 0xdc, 0xe2, 0x66, 0xff, 0xe2, 0xe6, 0x59, 0xff, 0xe7, 0xe9, 0x53, 0xff, 0xe7, 0xe9, 0x53, 0xff, 0xe7, 0xe8, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x55, 0xff, 0xe5, 0xe7, 0x55, 0xff, 0xe2, 0xe3, 0x5a, 0xff, 0xe0, 0xe4, 0x57, 0xff, 0xd3, 0xdb, 0x57, 0xff, 0xb9, 0xbe, 0x64, 0xff, 0x6a, 0x70, 0x41, 0xff, 0x62, 0x69, 0x49, 0xff, 0xa8, 0xb1, 0x85, 0xff, 0xaa, 0xb0, 0x7e, 0xff, 0x73, 0x76, 0x54, 0xff, 0x54, 0x55, 0x4f, 0xee, 0x6b, 0x6b, 0x71, 0x58, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xa1, 0xa1, 0x1e, 0x5f, 0x61, 0x67, 0xc2, 0x8f, 0x94, 0x99, 0x32, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xa7, 0xaf, 0x20, 0x73, 0x75, 0x82, 0xb1, 0x95, 0x95, 0xa3, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x86, 0xa1, 0x13, 0x56, 0x56, 0x5e, 0x9b, 0x56, 0x57, 0x54, 0xf6, 0x69, 0x69, 0x5c, 0xff, 0x86, 0x88, 0x7b, 0xff, 0x59, 0x5f, 0x54, 0xff, 0x6a, 0x6d, 0x49, 0xff, 0xb7, 0xb7, 0x68, 0xff, 0xcc, 0xce, 0x58, 0xff, 0xde, 0xe4, 0x5c, 0xff, 0xe4, 0xea, 0x5c, 0xff, 0xe9, 0xeb, 0x58, 0xff, 0xe6, 0xeb, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe5, 0xe9, 0x56, 0xff, 0xe0, 0xe7, 0x58, 0xff, 0xd4, 0xe3, 0x5d, 0xff, 0xd4, 0xe5, 0x7a, 0xff, 0xeb, 0xf9, 0xae, 0xff, 0xe9, 0xfa, 0xc5, 0xff, 0xe1, 0xfa, 0xcc, 0xff, 0xdb, 0xf9, 0xc8, 0xff, 0xdc, 0xfa, 0xc8, 0xff, 0xdb, 0xf7, 0xc9, 0xff, 0xdd, 0xfa, 0xc8, 0xff, 0xdf, 0xfa, 0xc6, 0xff, 0xdf, 0xf8, 0xc6, 0xff, 0xdf, 0xf7, 0xc8, 0xff, 0xdf, 0xf8, 0xc9, 0xff, 0xdf, 0xf8, 0xc9, 0xff, 0xdf, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc9, 0xff, 0xde, 0xf8, 0xc9, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xdc, 0xf8, 0xcb, 0xff, 0xdb, 0xf8, 0xca, 0xff, 0xdc, 0xf8, 0xc9, 0xff, 0xdc, 0xf8, 0xc9, 0xff, 0xdf, 0xf8, 0xc8, 0xff, 0xe2, 0xf9, 0xca, 0xff, 0xe6, 0xf9, 0xc0, 0xff, 0xeb, 0xf8, 0xac, 0xff, 0xd4, 0xdf, 0x7a, 0xff, 0xdc, 0xe4, 0x63, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe8, 0xea, 0x57, 0xff, 0xe7, 0xe9, 0x59, 0xff, 0xe5, 0xe9, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x54, 0xff, 0xe4, 0xe8, 0x55, 0xff, 0xdf, 0xe1, 0x5c, 0xff, 0xdc, 0xe2, 0x58, 0xff, 0xc9, 0xd0, 0x55, 0xff, 0xa6, 0xaa, 0x62, 0xff, 0x54, 0x56, 0x40, 0xff, 0x68, 0x6f, 0x64, 0xff, 0x90, 0x97, 0x85, 0xff, 0x61, 0x64, 0x55, 0xff, 0x56, 0x58, 0x53, 0xf0, 0x6d, 0x72, 0x72, 0x67, 0xcc, 0xcc, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x6b, 0x6d, 0x6f, 0x75, 0x6e, 0x72, 0x74, 0x7f, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x77, 0x77, 0x85, 0x5a, 0x77, 0x73, 0x82, 0x78, 0xcc, 0xcc, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xa2, 0xb9, 0x0b, 0x5a, 0x5c, 0x61, 0x6c, 0x54, 0x57, 0x5b, 0xd4, 0x55, 0x56, 0x5d, 0xf9, 0x52, 0x55, 0x59, 0xff, 0x54, 0x56, 0x46, 0xff, 0xa6, 0xa6, 0x68, 0xff, 0xbf, 0xc1, 0x5b, 0xff, 0xd2, 0xd6, 0x58, 0xff, 0xe3, 0xe6, 0x60, 0xff, 0xe8, 0xe8, 0x5b, 0xff, 0xe6, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe5, 0xea, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x56, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xdf, 0xe6, 0x5f, 0xff, 0xd3, 0xe1, 0x70, 0xff, 0xe7, 0xf8, 0xa5, 0xff, 0xe8, 0xfa, 0xc1, 0xff, 0xe1, 0xf7, 0xcb, 0xff, 0xda, 0xf7, 0xce, 0xff, 0xdb, 0xf9, 0xca, 0xff, 0xdd, 0xf8, 0xc8, 0xff, 0xdd, 0xf8, 0xc9, 0xff, 0xdb, 0xf9, 0xc7, 0xff, 0xdc, 0xf9, 0xc7, 0xff, 0xdd, 0xf9, 0xc9, 0xff, 0xdd, 0xf7, 0xcb, 0xff, 0xdd, 0xf8, 0xc9, 0xff, 0xdd, 0xf9, 0xc8, 0xff, 0xdd, 0xf9, 0xc7, 0xff, 0xdc, 0xf9, 0xc7, 0xff, 0xdc, 0xf9, 0xc7, 0xff, 0xdc, 0xf9, 0xc7, 0xff, 0xde, 0xf9, 0xc8, 0xff, 0xe0, 0xf7, 0xca, 0xff, 0xdf, 0xf8, 0xc9, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc9, 0xff, 0xde, 0xf7, 0xca, 0xff, 0xe1, 0xf7, 0xc6, 0xff, 0xe8, 0xfa, 0xbe, 0xff, 0xe7, 0xf6, 0xa5, 0xff, 0xd3, 0xe0, 0x6d, 0xff, 0xdf, 0xe5, 0x5b, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x59, 0xff, 0xe3, 0xe9, 0x59, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe6, 0xea, 0x57, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe5, 0xea, 0x55, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xdb, 0xdc, 0x59, 0xff, 0xd1, 0xd4, 0x55, 0xff, 0xbf, 0xc2, 0x5b, 0xff, 0x8c, 0x8d, 0x57, 0xff, 0x50, 0x51, 0x4f, 0xff, 0x4f, 0x53, 0x5a, 0xff, 0x4e, 0x50, 0x57, 0xfb, 0x55, 0x56, 0x5d, 0xd9, 0x69, 0x6b, 0x73, 0x5f, 0xcc, 0xcc, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x97, 0x97, 0x20, 0x67, 0x6b, 0x6d, 0x83, 0xbc, 0xbc, 0xbc, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x06, 0x74, 0x71, 0x82, 0x5a, 0x89, 0x83, 0x90, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x7a, 0x7a, 0x85, 0x19, 0x64, 0x64, 0x71, 0x61, 0x53, 0x54, 0x60, 0xb9, 0x4e, 0x51, 0x4e, 0xfb, 0x80, 0x84, 0x59, 0xff, 0xb8, 0xb9, 0x6a, 0xff, 0xc3, 0xc4, 0x57, 0xff, 0xd6, 0xd5, 0x57, 0xff, 0xe6, 0xe6, 0x60, 0xff, 0xe6, 0xea, 0x58, 0xff, 0xe4, 0xea, 0x55, 0xff, 0xe4, 0xea, 0x55, 0xff, 0xe5, 0xea, 0x55, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xe8, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe6, 0xe9, 0x56, 0xff, 0xe4, 0xe9, 0x54, 0xff, 0xe2, 0xe9, 0x56, 0xff, 0xe0, 0xe6, 0x59, 0xff, 0xd7, 0xe1, 0x64, 0xff, 0xde, 0xed, 0x95, 0xff, 0xe8, 0xfd, 0xc1, 0xff, 0xe0, 0xf7, 0xc8, 0xff, 0xdd, 0xf7, 0xcb, 0xff, 0xdb, 0xf8, 0xcb, 0xff, 0xdb, 0xf9, 0xc9, 0xff, 0xdb, 0xf9, 0xc8, 0xff, 0xdb, 0xf8, 0xc7, 0xff, 0xdb, 0xf8, 0xc7, 0xff, 0xdc, 0xf9, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xe3, 0xf7, 0xc7, 0xff, 0xe7, 0xfa, 0xc5, 0xff, 0xe3, 0xfb, 0xb9, 0xff, 0xdc, 0xef, 0x91, 0xff, 0xda, 0xe3, 0x62, 0xff, 0xe4, 0xe9, 0x55, 0xff, 0xe3, 0xea, 0x56, 0xff, 0xe2, 0xe9, 0x59, 0xff, 0xe2, 0xe8, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe3, 0xe9, 0x54, 0xff, 0xe3, 0xea, 0x53, 0xff, 0xe3, 0xe9, 0x55, 0xff, 0xe2, 0xe8, 0x59, 0xff, 0xda, 0xe1, 0x55, 0xff, 0xd0, 0xd2, 0x51, 0xff, 0xc3, 0xc2, 0x56, 0xff, 0xb1, 0xaf, 0x66, 0xff, 0x6b, 0x6c, 0x4b, 0xff, 0x51, 0x54, 0x57, 0xf8, 0x51, 0x51, 0x62, 0xbc, 0x66, 0x66, 0x75, 0x6b, 0x93, 0x93, 0x9b, 0x21, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x92, 0x92, 0x0e, 0xa5, 0xb4, 0xa5, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x04, 0x8e, 0x8e, 0x8e, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x97, 0x97, 0x16, 0x4b, 0x4e, 0x4f, 0xbb, 0x5c, 0x5d, 0x49, 0xfe, 0xa7, 0xa8, 0x6e, 0xff, 0xb8, 0xb9, 0x5b, 0xff, 0xc6, 0xc6, 0x50, 0xff, 0xd9, 0xd8, 0x59, 0xff, 0xe6, 0xea, 0x5e, 0xff, 0xe3, 0xe8, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe5, 0xe8, 0x58, 0xff, 0xe5, 0xe8, 0x58, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe3, 0xea, 0x56, 0xff, 0xe0, 0xe7, 0x57, 0xff, 0xdc, 0xe5, 0x5e, 0xff, 0xd8, 0xe4, 0x76, 0xff, 0xeb, 0xfb, 0xae, 0xff, 0xe3, 0xf9, 0xc3, 0xff, 0xde, 0xf7, 0xc9, 0xff, 0xdc, 0xf8, 0xca, 0xff, 0xdc, 0xf9, 0xc9, 0xff, 0xdb, 0xf9, 0xc8, 0xff, 0xdc, 0xf9, 0xc8, 0xff, 0xdc, 0xf9, 0xc8, 0xff, 0xdc, 0xf9, 0xc8, 0xff, 0xdd, 0xf9, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdf, 0xf7, 0xc9, 0xff, 0xdf, 0xf7, 0xc9, 0xff, 0xde, 0xf8, 0xc3, 0xff, 0xe8, 0xfd, 0xb0, 0xff, 0xdb, 0xe7, 0x7a, 0xff, 0xdf, 0xe6, 0x60, 0xff, 0xe0, 0xea, 0x5a, 0xff, 0xe2, 0xe9, 0x5a, 0xff, 0xe3, 0xe9, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe8, 0x58, 0xff, 0xe5, 0xe7, 0x58, 0xff, 0xe3, 0xe7, 0x56, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe2, 0xe5, 0x5a, 0xff, 0xdc, 0xdf, 0x58, 0xff, 0xd1, 0xd7, 0x52, 0xff, 0xc0, 0xc6, 0x4d, 0xff, 0xb2, 0xb7, 0x5a, 0xff, 0x95, 0x98, 0x63, 0xff, 0x59, 0x5b, 0x4e, 0xfd, 0x5e, 0x63, 0x68, 0x9b, 0xc8, 0xc8, 0xc8, 0x0e, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x73, 0x77, 0x47, 0x53, 0x54, 0x52, 0xed, 0x7f, 0x80, 0x5d, 0xff, 0xaf, 0xb1, 0x67, 0xff, 0xb8, 0xb9, 0x4f, 0xff, 0xc3, 0xc2, 0x4c, 0xff, 0xd5, 0xda, 0x55, 0xff, 0xe0, 0xe6, 0x5c, 0xff, 0xe1, 0xe6, 0x58, 0xff, 0xe2, 0xe8, 0x56, 0xff, 0xe4, 0xe9, 0x55, 0xff, 0xe4, 0xe9, 0x55, 0xff, 0xe3, 0xe8, 0x54, 0xff, 0xe4, 0xe7, 0x55, 0xff, 0xe6, 0xe7, 0x57, 0xff, 0xe6, 0xe8, 0x57, 0xff, 0xe5, 0xea, 0x56, 0xff, 0xe3, 0xec, 0x59, 0xff, 0xdd, 0xe8, 0x5b, 0xff, 0xd6, 0xe3, 0x67, 0xff, 0xe0, 0xf0, 0x93, 0xff, 0xe9, 0xfc, 0xb9, 0xff, 0xe1, 0xf9, 0xc8, 0xff, 0xdd, 0xf8, 0xcb, 0xff, 0xde, 0xf9, 0xc9, 0xff, 0xdd, 0xfa, 0xc8, 0xff, 0xdc, 0xf9, 0xc8, 0xff, 0xdc, 0xf9, 0xc8, 0xff, 0xdc, 0xf9, 0xc8, 0xff, 0xdc, 0xf9, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xca, 0xff, 0xdc, 0xf6, 0xcb, 0xff, 0xdb, 0xf6, 0xca, 0xff, 0xe6, 0xfb, 0xbf, 0xff, 0xe4, 0xf2, 0x98, 0xff, 0xd8, 0xe2, 0x69, 0xff, 0xdf, 0xe9, 0x5d, 0xff, 0xe3, 0xea, 0x5a, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x55, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe7, 0x59, 0xff, 0xe5, 0xe7, 0x5b, 0xff, 0xe2, 0xe4, 0x5b, 0xff, 0xdb, 0xdd, 0x5a, 0xff, 0xcf, 0xcf, 0x52, 0xff, 0xbf, 0xc2, 0x47, 0xff, 0xb0, 0xb8, 0x4d, 0xff, 0xa3, 0xad, 0x66, 0xff, 0x69, 0x6e, 0x52, 0xff, 0x56, 0x58, 0x59, 0xdf, 0x93, 0x93, 0x99, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb6, 0xb6, 0x07, 0x57, 0x5a, 0x5e, 0xa2, 0x5d, 0x5f, 0x50, 0xfd, 0x98, 0x9c, 0x66, 0xff, 0xaf, 0xb1, 0x5b, 0xff, 0xb7, 0xb6, 0x4d, 0xff, 0xc1, 0xc5, 0x49, 0xff, 0xd4, 0xd9, 0x56, 0xff, 0xdf, 0xe3, 0x5a, 0xff, 0xe2, 0xe6, 0x58, 0xff, 0xe3, 0xe9, 0x54, 0xff, 0xe3, 0xea, 0x53, 0xff, 0xe2, 0xe9, 0x52, 0xff, 0xe5, 0xe8, 0x55, 0xff, 0xe7, 0xe8, 0x56, 0xff, 0xe7, 0xe9, 0x56, 0xff, 0xe3, 0xea, 0x54, 0xff, 0xe1, 0xec, 0x5a, 0xff, 0xda, 0xe8, 0x5f, 0xff, 0xd5, 0xe4, 0x74, 0xff, 0xea, 0xfa, 0xad, 0xff, 0xe7, 0xfc, 0xc3, 0xff, 0xdf, 0xf9, 0xcc, 0xff, 0xdc, 0xf7, 0xcb, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xdd, 0xf9, 0xc7, 0xff, 0xdc, 0xf9, 0xc8, 0xff, 0xdc, 0xf9, 0xc8, 0xff, 0xdc, 0xf9, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xdf, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xde, 0xf7, 0xc8, 0xff, 0xdd, 0xf7, 0xca, 0xff, 0xdd, 0xf6, 0xcd, 0xff, 0xe3, 0xf9, 0xc5, 0xff, 0xec, 0xfc, 0xae, 0xff, 0xd9, 0xe4, 0x74, 0xff, 0xdf, 0xe8, 0x5e, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x53, 0xff, 0xe4, 0xe7, 0x56, 0xff, 0xe2, 0xe5, 0x58, 0xff, 0xe1, 0xe4, 0x59, 0xff, 0xd9, 0xdb, 0x56, 0xff, 0xcd, 0xce, 0x52, 0xff, 0xbf, 0xbf, 0x4a, 0xff, 0xb5, 0xb5, 0x49, 0xff, 0xaa, 0xb1, 0x5b, 0xff, 0x82, 0x8a, 0x58, 0xff, 0x54, 0x58, 0x4f, 0xfb, 0x61, 0x61, 0x67, 0x81, 0xaa, 0xaa, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x72, 0x78, 0x31, 0x59, 0x5e, 0x5a, 0xe3, 0x6d, 0x70, 0x54, 0xff, 0xa6, 0xa7, 0x6b, 0xff, 0xb0, 0xb0, 0x58, 0xff, 0xb6, 0xba, 0x4c, 0xff, 0xbc, 0xbf, 0x48, 0xff, 0xd0, 0xd1, 0x53, 0xff, 0xe3, 0xe4, 0x5d, 0xff, 0xe3, 0xe7, 0x58, 0xff, 0xe3, 0xe9, 0x55, 0xff, 0xe1, 0xea, 0x53, 0xff, 0xe3, 0xe9, 0x54, 0xff, 0xe6, 0xe9, 0x54, 0xff, 0xe6, 0xea, 0x54, 0xff, 0xe2, 0xe9, 0x53, 0xff, 0xde, 0xe9, 0x58, 0xff, 0xd9, 0xe6, 0x62, 0xff, 0xd8, 0xe8, 0x81, 0xff, 0xed, 0xfe, 0xbb, 0xff, 0xe6, 0xfc, 0xc9, 0xff, 0xdf, 0xf8, 0xcf, 0xff, 0xdd, 0xf8, 0xcc, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xdd, 0xf9, 0xc8, 0xff, 0xdc, 0xf9, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xdf, 0xf8, 0xc8, 0xff, 0xe0, 0xf8, 0xc8, 0xff, 0xe0, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xde, 0xf7, 0xc8, 0xff, 0xde, 0xf7, 0xc9, 0xff, 0xdd, 0xf6, 0xcb, 0xff, 0xe0, 0xf8, 0xc8, 0xff, 0xe9, 0xfd, 0xb6, 0xff, 0xde, 0xec, 0x84, 0xff, 0xdd, 0xe5, 0x5f, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe3, 0xe5, 0x59, 0xff, 0xdd, 0xe0, 0x59, 0xff, 0xd6, 0xd9, 0x56, 0xff, 0xcb, 0xcd, 0x50, 0xff, 0xbe, 0xbf, 0x4b, 0xff, 0xb5, 0xb4, 0x4c, 0xff, 0xac, 0xac, 0x56, 0xff, 0x99, 0x9b, 0x63, 0xff, 0x58, 0x5b, 0x46, 0xff, 0x51, 0x56, 0x55, 0xc9, 0x9e, 0x9e, 0x9e, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0x63, 0x65, 0x6a, 0x6f, 0x5b, 0x5c, 0x5a, 0xf5, 0x7d, 0x7c, 0x58, 0xff, 0xab, 0xaa, 0x65, 0xff, 0xaf, 0xb0, 0x52, 0xff, 0xb5, 0xb5, 0x4d, 0xff, 0xbc, 0xba, 0x49, 0xff, 0xcf, 0xce, 0x51, 0xff, 0xdd, 0xde, 0x58, 0xff, 0xe0, 0xe5, 0x59, 0xff, 0xe0, 0xe7, 0x57, 0xff, 0xe2, 0xeb, 0x56, 0xff, 0xe5, 0xea, 0x55, 0xff, 0xe5, 0xea, 0x52, 0xff, 0xe2, 0xe9, 0x52, 0xff, 0xde, 0xe8, 0x59, 0xff, 0xd8, 0xe6, 0x64, 0xff, 0xdd, 0xec, 0x8b, 0xff, 0xee, 0xfe, 0xc1, 0xff, 0xe5, 0xfb, 0xcb, 0xff, 0xdf, 0xf8, 0xd0, 0xff, 0xde, 0xf8, 0xcd, 0xff, 0xde, 0xf8, 0xc9, 0xff, 0xdd, 0xf8, 0xca, 0xff, 0xdd, 0xf7, 0xc8, 0xff, 0xdd, 0xf7, 0xc7, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xdf, 0xf8, 0xc8, 0xff, 0xe0, 0xf8, 0xc8, 0xff, 0xe0, 0xf8, 0xc8, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xde, 0xf7, 0xc8, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdb, 0xf6, 0xcb, 0xff, 0xdb, 0xf7, 0xc8, 0xff, 0xe2, 0xfb, 0xb9, 0xff, 0xdf, 0xf2, 0x91, 0xff, 0xd7, 0xe2, 0x62, 0xff, 0xe2, 0xe6, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x5a, 0xff, 0xe3, 0xe9, 0x5a, 0xff, 0xe1, 0xe4, 0x5c, 0xff, 0xda, 0xdb, 0x59, 0xff, 0xcf, 0xd1, 0x54, 0xff, 0xc6, 0xc8, 0x50, 0xff, 0xbb, 0xbd, 0x4a, 0xff, 0xb5, 0xb4, 0x4b, 0xff, 0xaf, 0xb0, 0x54, 0xff, 0xa1, 0xa4, 0x63, 0xff, 0x60, 0x60, 0x47, 0xff, 0x4d, 0x50, 0x52, 0xeb, 0x88, 0x90, 0x93, 0x47, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xbf, 0xbf, 0x0c, 0x56, 0x54, 0x5c, 0xa7, 0x59, 0x56, 0x4f, 0xfc, 0x7f, 0x7e, 0x58, 0xff, 0xa7, 0xa8, 0x62, 0xff, 0xab, 0xad, 0x54, 0xff, 0xb7, 0xb6, 0x4e, 0xff, 0xbd, 0xba, 0x48, 0xff, 0xc9, 0xc6, 0x4d, 0xff, 0xd4, 0xd6, 0x54, 0xff, 0xd9, 0xe0, 0x57, 0xff, 0xdf, 0xe7, 0x59, 0xff, 0xe0, 0xe7, 0x57, 0xff, 0xe1, 0xe8, 0x54, 0xff, 0xe2, 0xea, 0x53, 0xff, 0xde, 0xe8, 0x59, 0xff, 0xd9, 0xe5, 0x65, 0xff, 0xdf, 0xed, 0x92, 0xff, 0xea, 0xfd, 0xc4, 0xff, 0xe2, 0xfa, 0xcd, 0xff, 0xde, 0xf7, 0xd0, 0xff, 0xdf, 0xf8, 0xcd, 0xff, 0xdf, 0xf9, 0xca, 0xff, 0xdd, 0xf8, 0xcb, 0xff, 0xdc, 0xf8, 0xca, 0xff, 0xdc, 0xf8, 0xc8, 0xff, 0xdd, 0xf8, 0xc9, 0xff, 0xdd, 0xf8, 0xc9, 0xff, 0xde, 0xf8, 0xc9, 0xff, 0xde, 0xf8, 0xc9, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xdf, 0xf8, 0xca, 0xff, 0xdf, 0xf8, 0xc9, 0xff, 0xdf, 0xf8, 0xc9, 0xff, 0xdf, 0xf8, 0xc9, 0xff, 0xdf, 0xf8, 0xc9, 0xff, 0xde, 0xf7, 0xc8, 0xff, 0xde, 0xf7, 0xc8, 0xff, 0xde, 0xf6, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xde, 0xf7, 0xc7, 0xff, 0xdd, 0xf7, 0xc8, 0xff, 0xdc, 0xf6, 0xca, 0xff, 0xdb, 0xf7, 0xc9, 0xff, 0xe1, 0xfb, 0xbe, 0xff, 0xe3, 0xf5, 0x9a, 0xff, 0xd5, 0xe0, 0x62, 0xff, 0xe2, 0xe6, 0x55, 0xff, 0xe5, 0xe8, 0x54, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe5, 0xea, 0x5b, 0xff, 0xe4, 0xe8, 0x5d, 0xff, 0xe1, 0xe6, 0x5d, 0xff, 0xda, 0xe0, 0x58, 0xff, 0xd0, 0xd9, 0x55, 0xff, 0xc7, 0xc9, 0x52, 0xff, 0xc3, 0xc0, 0x53, 0xff, 0xbd, 0xbc, 0x4c, 0xff, 0xb9, 0xb9, 0x4e, 0xff, 0xaf, 0xae, 0x54, 0xff, 0xa4, 0xa5, 0x64, 0xff, 0x67, 0x6b, 0x4c, 0xff, 0x52, 0x53, 0x4d, 0xf7, 0x69, 0x6b, 0x71, 0x75, 0xaa, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x84, 0x8d, 0x1d, 0x55, 0x52, 0x57, 0xb5, 0x50, 0x50, 0x4b, 0xfc, 0x76, 0x77, 0x4f, 0xff, 0xa4, 0xa7, 0x66, 0xff, 0xaa, 0xac, 0x52, 0xff, 0xb6, 0xb6, 0x4b, 0xff, 0xbc, 0xbb, 0x48, 0xff, 0xc2, 0xc1, 0x49, 0xff, 0xc8, 0xcb, 0x4d, 0xff, 0xd4, 0xd9, 0x55, 0xff, 0xdc, 0xe2, 0x5c, 0xff, 0xe2, 0xe8, 0x5c, 0xff, 0xe2, 0xe9, 0x55, 0xff, 0xe0, 0xe8, 0x5a, 0xff, 0xd9, 0xe4, 0x66, 0xff, 0xe0, 0xf0, 0x96, 0xff, 0xe8, 0xfe, 0xc5, 0xff, 0xe0, 0xfa, 0xcd, 0xff, 0xdc, 0xf7, 0xcf, 0xff, 0xde, 0xf9, 0xcd, 0xff, 0xe0, 0xfa, 0xca, 0xff, 0xde, 0xf9, 0xcb, 0xff, 0xdd, 0xf8, 0xca, 0xff, 0xdd, 0xf8, 0xc8, 0xff, 0xdd, 0xf8, 0xc9, 0xff, 0xdd, 0xf8, 0xc9, 0xff, 0xdd, 0xf8, 0xc9, 0xff, 0xdd, 0xf8, 0xca, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xdf, 0xf8, 0xc9, 0xff, 0xdf, 0xf8, 0xc9, 0xff, 0xdf, 0xf8, 0xc9, 0xff, 0xdf, 0xf8, 0xc9, 0xff, 0xde, 0xf8, 0xc9, 0xff, 0xde, 0xf7, 0xc8, 0xff, 0xde, 0xf7, 0xc8, 0xff, 0xdd, 0xf7, 0xc8, 0xff, 0xdd, 0xf7, 0xc8, 0xff, 0xdd, 0xf7, 0xc8, 0xff, 0xdd, 0xf7, 0xc8, 0xff, 0xdd, 0xf7, 0xc8, 0xff, 0xdd, 0xf7, 0xc7, 0xff, 0xdd, 0xf7, 0xc7, 0xff, 0xdc, 0xf6, 0xca, 0xff, 0xdc, 0xf6, 0xca, 0xff, 0xe4, 0xfa, 0xc1, 0xff, 0xe9, 0xf9, 0xa0, 0xff, 0xd5, 0xde, 0x60, 0xff, 0xe2, 0xe7, 0x55, 0xff, 0xe5, 0xe8, 0x55, 0xff, 0xe3, 0xe7, 0x58, 0xff, 0xe2, 0xe5, 0x5d, 0xff, 0xdb, 0xdf, 0x5c, 0xff, 0xd4, 0xd8, 0x59, 0xff, 0xc9, 0xce, 0x51, 0xff, 0xbe, 0xc5, 0x49, 0xff, 0xbc, 0xbb, 0x4e, 0xff, 0xbe, 0xba, 0x54, 0xff, 0xb8, 0xb7, 0x51, 0xff, 0xb0, 0xb4, 0x59, 0xff, 0xa5, 0xa5, 0x69, 0xff, 0x66, 0x66, 0x4a, 0xff, 0x52, 0x56, 0x54, 0xfb, 0x6a, 0x6b, 0x6d, 0x9d, 0xc4, 0xd8, 0xd8, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x8d, 0x8d, 0x1d, 0x4f, 0x4f, 0x4f, 0xb9, 0x52, 0x51, 0x47, 0xfa, 0x71, 0x71, 0x51, 0xff, 0xa1, 0xa4, 0x67, 0xff, 0xac, 0xb0, 0x54, 0xff, 0xb6, 0xb9, 0x49, 0xff, 0xbc, 0xbb, 0x4a, 0xff, 0xc2, 0xbe, 0x4f, 0xff, 0xc3, 0xc5, 0x4b, 0xff, 0xcb, 0xcf, 0x52, 0xff, 0xd9, 0xde, 0x59, 0xff, 0xdf, 0xe3, 0x58, 0xff, 0xe0, 0xe7, 0x5e, 0xff, 0xd9, 0xe3, 0x69, 0xff, 0xe2, 0xf0, 0x96, 0xff, 0xe8, 0xfe, 0xc2, 0xff, 0xe1, 0xf9, 0xca, 0xff, 0xdf, 0xf9, 0xcf, 0xff, 0xde, 0xf8, 0xc9, 0xff, 0xde, 0xf9, 0xc6, 0xff, 0xdd, 0xf8, 0xc8, 0xff, 0xdd, 0xf7, 0xc7, 0xff, 0xdf, 0xf7, 0xc7, 0xff, 0xdf, 0xf7, 0xc8, 0xff, 0xdf, 0xf7, 0xc8, 0xff, 0xdf, 0xf7, 0xc7, 0xff, 0xdf, 0xf7, 0xc7, 0xff, 0xdf, 0xf7, 0xc8, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xde, 0xf8, 0xc9, 0xff, 0xdd, 0xf7, 0xc7, 0xff, 0xdd, 0xf7, 0xc7, 0xff, 0xdd, 0xf7, 0xc7, 0xff, 0xdd, 0xf7, 0xc7, 0xff, 0xdd, 0xf7, 0xc7, 0xff, 0xdd, 0xf7, 0xc7, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdc, 0xf7, 0xca, 0xff, 0xdb, 0xf6, 0xca, 0xff, 0xdb, 0xf5, 0xcb, 0xff, 0xe3, 0xf9, 0xc2, 0xff, 0xe8, 0xf9, 0xa3, 0xff, 0xd3, 0xdd, 0x65, 0xff, 0xe0, 0xe4, 0x5b, 0xff, 0xe3, 0xe5, 0x5c, 0xff, 0xdd, 0xdf, 0x5b, 0xff, 0xd5, 0xd7, 0x58, 0xff, 0xca, 0xcd, 0x52, 0xff, 0xc5, 0xc6, 0x50, 0xff, 0xbe, 0xbf, 0x4c, 0xff, 0xbf, 0xba, 0x4d, 0xff, 0xbc, 0xb8, 0x4f, 0xff, 0xbb, 0xb9, 0x57, 0xff, 0xb3, 0xb6, 0x64, 0xff, 0xa2, 0xa7, 0x70, 0xff, 0x67, 0x6a, 0x56, 0xff, 0x53, 0x56, 0x57, 0xfb, 0x58, 0x5c, 0x5e, 0xab, 0xbf, 0xbf, 0xbf, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x95, 0x9f, 0x18, 0x58, 0x58, 0x5f, 0x91, 0x56, 0x54, 0x56, 0xf5, 0x62, 0x63, 0x4d, 0xff, 0x91, 0x96, 0x59, 0xff, 0xb1, 0xb7, 0x59, 0xff, 0xbc, 0xbb, 0x53, 0xff, 0xbf, 0xba, 0x51, 0xff, 0xc0, 0xc0, 0x4d, 0xff, 0xbe, 0xbe, 0x4b, 0xff, 0xc4, 0xc6, 0x4d, 0xff, 0xcf, 0xd1, 0x51, 0xff, 0xd7, 0xdb, 0x5b, 0xff, 0xd8, 0xde, 0x6a, 0xff, 0xde, 0xe9, 0x92, 0xff, 0xee, 0xfe, 0xc3, 0xff, 0xe4, 0xfa, 0xca, 0xff, 0xdf, 0xf6, 0xcb, 0xff, 0xdf, 0xf7, 0xc8, 0xff, 0xdf, 0xf9, 0xc6, 0xff, 0xdc, 0xf7, 0xc6, 0xff, 0xdc, 0xf6, 0xc8, 0xff, 0xde, 0xf6, 0xca, 0xff, 0xde, 0xf6, 0xca, 0xff, 0xde, 0xf6, 0xca, 0xff, 0xde, 0xf6, 0xc9, 0xff, 0xde, 0xf6, 0xc9, 0xff, 0xde, 0xf6, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xde, 0xf8, 0xcb, 0xff, 0xdc, 0xf8, 0xca, 0xff, 0xdc, 0xf7, 0xca, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdc, 0xf6, 0xc9, 0xff, 0xdb, 0xf6, 0xca, 0xff, 0xdd, 0xf6, 0xca, 0xff, 0xdf, 0xf7, 0xca, 0xff, 0xe2, 0xf8, 0xc1, 0xff, 0xe7, 0xf7, 0xa6, 0xff, 0xce, 0xd9, 0x6a, 0xff, 0xd6, 0xdb, 0x5d, 0xff, 0xd6, 0xd7, 0x5a, 0xff, 0xcd, 0xce, 0x55, 0xff, 0xc4, 0xc4, 0x50, 0xff, 0xbc, 0xbd, 0x4d, 0xff, 0xb9, 0xb9, 0x4d, 0xff, 0xb9, 0xb8, 0x4e, 0xff, 0xbd, 0xb8, 0x53, 0xff, 0xba, 0xb8, 0x57, 0xff, 0xb5, 0xb7, 0x67, 0xff, 0x9b, 0x9f, 0x6b, 0xff, 0x5e, 0x62, 0x50, 0xff, 0x50, 0x53, 0x59, 0xf4, 0x69, 0x6d, 0x79, 0x96, 0xb8, 0xb8, 0xc6, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb6, 0xb6, 0x07, 0x5b, 0x5b, 0x64, 0x73, 0x55, 0x54, 0x5b, 0xe4, 0x5c, 0x5d, 0x46, 0xff, 0x96, 0x9a, 0x57, 0xff, 0xb9, 0xba, 0x5b, 0xff, 0xbe, 0xbc, 0x4e, 0xff, 0xbe, 0xbd, 0x4f, 0xff, 0xb9, 0xba, 0x4f, 0xff, 0xbb, 0xbb, 0x4d, 0xff, 0xbf, 0xbf, 0x49, 0xff, 0xc6, 0xc8, 0x50, 0xff, 0xc7, 0xcc, 0x5c, 0xff, 0xcc, 0xd4, 0x7c, 0xff, 0xe8, 0xf5, 0xb6, 0xff, 0xe2, 0xf3, 0xc2, 0xff, 0xdf, 0xf3, 0xc7, 0xff, 0xe0, 0xf5, 0xc6, 0xff, 0xe0, 0xf6, 0xc5, 0xff, 0xde, 0xf6, 0xc8, 0xff, 0xdd, 0xf6, 0xca, 0xff, 0xdc, 0xf6, 0xcb, 0xff, 0xdc, 0xf6, 0xcb, 0xff, 0xdc, 0xf6, 0xcb, 0xff, 0xdc, 0xf6, 0xcb, 0xff, 0xdc, 0xf5, 0xcb, 0xff, 0xdc, 0xf5, 0xca, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xde, 0xf7, 0xc8, 0xff, 0xde, 0xf7, 0xc8, 0xff, 0xde, 0xf7, 0xc8, 0xff, 0xde, 0xf7, 0xc9, 0xff, 0xde, 0xf8, 0xc9, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xde, 0xf7, 0xcc, 0xff, 0xde, 0xf6, 0xcc, 0xff, 0xde, 0xf6, 0xcb, 0xff, 0xe0, 0xf6, 0xcb, 0xff, 0xdf, 0xf5, 0xca, 0xff, 0xdf, 0xf4, 0xca, 0xff, 0xde, 0xf5, 0xc9, 0xff, 0xdf, 0xf6, 0xc8, 0xff, 0xdf, 0xf5, 0xc5, 0xff, 0xde, 0xf4, 0xc2, 0xff, 0xe1, 0xf4, 0xbb, 0xff, 0xe0, 0xee, 0xa1, 0xff, 0xbf, 0xc7, 0x61, 0xff, 0xc2, 0xc5, 0x54, 0xff, 0xc1, 0xc1, 0x51, 0xff, 0xbb, 0xbb, 0x4d, 0xff, 0xb7, 0xb8, 0x4c, 0xff, 0xb4, 0xb4, 0x4c, 0xff, 0xb1, 0xb3, 0x4c, 0xff, 0xb4, 0xb5, 0x50, 0xff, 0xb4, 0xb6, 0x51, 0xff, 0xb2, 0xb6, 0x61, 0xff, 0x90, 0x94, 0x5d, 0xff, 0x5b, 0x5d, 0x4a, 0xfe, 0x55, 0x55, 0x59, 0xd8, 0x6a, 0x6d, 0x74, 0x67, 0xcc, 0xe6, 0xe6, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x6b, 0x6b, 0x78, 0x64, 0x54, 0x54, 0x51, 0xf8, 0x87, 0x88, 0x5e, 0xff, 0xba, 0xb9, 0x66, 0xff, 0xbe, 0xbe, 0x4f, 0xff, 0xbe, 0xbd, 0x50, 0xff, 0xba, 0xba, 0x53, 0xff, 0xba, 0xb9, 0x52, 0xff, 0xbc, 0xbb, 0x4e, 0xff, 0xbb, 0xbc, 0x4c, 0xff, 0xb8, 0xbb, 0x51, 0xff, 0xb6, 0xbc, 0x61, 0xff, 0xd3, 0xde, 0x95, 0xff, 0xd5, 0xe3, 0xa8, 0xff, 0xd5, 0xe7, 0xb3, 0xff, 0xd8, 0xeb, 0xb6, 0xff, 0xda, 0xee, 0xb9, 0xff, 0xdc, 0xf2, 0xc0, 0xff, 0xdb, 0xf3, 0xc4, 0xff, 0xdc, 0xf4, 0xc5, 0xff, 0xde, 0xf6, 0xc7, 0xff, 0xdf, 0xf7, 0xc9, 0xff, 0xdf, 0xf6, 0xca, 0xff, 0xdf, 0xf6, 0xca, 0xff, 0xdf, 0xf6, 0xca, 0xff, 0xdf, 0xf6, 0xc7, 0xff, 0xdf, 0xf7, 0xc6, 0xff, 0xdf, 0xf7, 0xc6, 0xff, 0xdf, 0xf8, 0xc7, 0xff, 0xdf, 0xf8, 0xc7, 0xff, 0xdf, 0xf7, 0xc6, 0xff, 0xdf, 0xf7, 0xc7, 0xff, 0xde, 0xf7, 0xc8, 0xff, 0xdf, 0xf7, 0xc8, 0xff, 0xdf, 0xf6, 0xc8, 0xff, 0xdf, 0xf4, 0xc6, 0xff, 0xde, 0xf3, 0xc5, 0xff, 0xde, 0xf1, 0xc4, 0xff, 0xdd, 0xf2, 0xc2, 0xff, 0xdc, 0xf1, 0xbc, 0xff, 0xdb, 0xee, 0xb7, 0xff, 0xd7, 0xe9, 0xb1, 0xff, 0xd7, 0xe6, 0xab, 0xff, 0xd2, 0xdc, 0x92, 0xff, 0xb5, 0xba, 0x5a, 0xff, 0xb6, 0xb7, 0x50, 0xff, 0xb5, 0xb4, 0x4e, 0xff, 0xb5, 0xb5, 0x4f, 0xff, 0xb5, 0xb6, 0x50, 0xff, 0xb4, 0xb5, 0x51, 0xff, 0xb3, 0xb4, 0x50, 0xff, 0xb3, 0xb5, 0x50, 0xff, 0xb1, 0xb7, 0x52, 0xff, 0xa9, 0xaf, 0x67, 0xff, 0x65, 0x68, 0x47, 0xff, 0x4f, 0x51, 0x4f, 0xef, 0x87, 0x8b, 0x8f, 0x40, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x8d, 0x8d, 0x1d, 0x54, 0x56, 0x54, 0xde, 0x7a, 0x7a, 0x5b, 0xff, 0xb6, 0xb4, 0x6d, 0xff, 0xbe, 0xbd, 0x54, 0xff, 0xbd, 0xbc, 0x50, 0xff, 0xba, 0xb9, 0x53, 0xff, 0xb9, 0xb8, 0x54, 0xff, 0xbb, 0xb9, 0x50, 0xff, 0xb8, 0xb7, 0x4c, 0xff, 0xb2, 0xb3, 0x4e, 0xff, 0xae, 0xb3, 0x55, 0xff, 0xbd, 0xc7, 0x74, 0xff, 0xca, 0xd7, 0x93, 0xff, 0xc8, 0xd8, 0x9b, 0xff, 0xcc, 0xdd, 0xa1, 0xff, 0xce, 0xe1, 0xa6, 0xff, 0xcd, 0xe3, 0xab, 0xff, 0xd0, 0xe6, 0xaf, 0xff, 0xd2, 0xe8, 0xb1, 0xff, 0xd5, 0xeb, 0xb5, 0xff, 0xd7, 0xec, 0xb9, 0xff, 0xd8, 0xec, 0xbb, 0xff, 0xd9, 0xed, 0xbe, 0xff, 0xdb, 0xee, 0xc0, 0xff, 0xdb, 0xf1, 0xc0, 0xff, 0xdb, 0xf2, 0xc0, 0xff, 0xdb, 0xf3, 0xc1, 0xff, 0xdb, 0xf2, 0xc1, 0xff, 0xda, 0xf2, 0xc0, 0xff, 0xd9, 0xf1, 0xbf, 0xff, 0xd9, 0xf1, 0xbd, 0xff, 0xd8, 0xf1, 0xbb, 0xff, 0xd7, 0xef, 0xb9, 0xff, 0xd5, 0xec, 0xb7, 0xff, 0xd4, 0xeb, 0xb5, 0xff, 0xd3, 0xe8, 0xb3, 0xff, 0xd1, 0xe4, 0xb0, 0xff, 0xce, 0xe2, 0xad, 0xff, 0xcc, 0xdf, 0xa6, 0xff, 0xce, 0xdf, 0xa2, 0xff, 0xcd, 0xdb, 0x9e, 0xff, 0xcf, 0xda, 0x9c, 0xff, 0xbf, 0xc6, 0x7c, 0xff, 0xb4, 0xb6, 0x5b, 0xff, 0xb7, 0xb7, 0x58, 0xff, 0xb3, 0xb3, 0x53, 0xff, 0xb4, 0xb4, 0x53, 0xff, 0xb3, 0xb4, 0x52, 0xff, 0xb3, 0xb5, 0x51, 0xff, 0xb4, 0xb6, 0x51, 0xff, 0xb3, 0xb6, 0x50, 0xff, 0xb1, 0xb4, 0x53, 0xff, 0xa3, 0xa5, 0x67, 0xff, 0x5a, 0x5d, 0x47, 0xff, 0x53, 0x58, 0x59, 0xc8, 0xaf, 0xaf, 0xaf, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x05, 0x55, 0x56, 0x58, 0xb1, 0x65, 0x66, 0x53, 0xff, 0xaf, 0xae, 0x6e, 0xff, 0xba, 0xb9, 0x55, 0xff, 0xbd, 0xbc, 0x51, 0xff, 0xbc, 0xba, 0x51, 0xff, 0xbb, 0xb7, 0x50, 0xff, 0xb9, 0xb5, 0x4f, 0xff, 0xb0, 0xad, 0x50, 0xff, 0xa8, 0xa5, 0x58, 0xff, 0xa9, 0xa9, 0x60, 0xff, 0xac, 0xb1, 0x69, 0xff, 0xc8, 0xd0, 0x91, 0xff, 0xc7, 0xd3, 0x9a, 0xff, 0xc9, 0xd9, 0x9f, 0xff, 0xc9, 0xd9, 0x9e, 0xff, 0xca, 0xda, 0xa0, 0xff, 0xce, 0xde, 0xa5, 0xff, 0xce, 0xdf, 0xa6, 0xff, 0xd1, 0xe1, 0xa8, 0xff, 0xd1, 0xe0, 0xa9, 0xff, 0xd2, 0xe0, 0xab, 0xff, 0xd3, 0xe0, 0xab, 0xff, 0xd4, 0xe0, 0xac, 0xff, 0xd2, 0xe2, 0xae, 0xff, 0xd4, 0xe5, 0xb0, 0xff, 0xd5, 0xe5, 0xb0, 0xff, 0xd5, 0xe6, 0xb0, 0xff, 0xd4, 0xe5, 0xae, 0xff, 0xd2, 0xe3, 0xac, 0xff, 0xd1, 0xe3, 0xad, 0xff, 0xcf, 0xe1, 0xab, 0xff, 0xce, 0xdf, 0xa9, 0xff, 0xcf, 0xdf, 0xa8, 0xff, 0xcf, 0xe0, 0xa7, 0xff, 0xce, 0xdf, 0xa4, 0xff, 0xcd, 0xdc, 0xa0, 0xff, 0xcd, 0xda, 0x9d, 0xff, 0xce, 0xd8, 0x9a, 0xff, 0xc9, 0xd7, 0x99, 0xff, 0xca, 0xda, 0x9d, 0xff, 0xcc, 0xda, 0x9d, 0xff, 0xb5, 0xbd, 0x7a, 0xff, 0xb4, 0xb7, 0x70, 0xff, 0xb1, 0xaf, 0x6c, 0xff, 0xa1, 0xa0, 0x52, 0xff, 0xb3, 0xb4, 0x58, 0xff, 0xb6, 0xb5, 0x54, 0xff, 0xb8, 0xb8, 0x4f, 0xff, 0xb8, 0xb9, 0x4c, 0xff, 0xb7, 0xb8, 0x4f, 0xff, 0xb2, 0xb6, 0x55, 0xff, 0x95, 0x97, 0x64, 0xff, 0x4e, 0x51, 0x48, 0xfd, 0x69, 0x6a, 0x6c, 0x8b, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x6c, 0x6f, 0x63, 0x5a, 0x5b, 0x51, 0xf9, 0x9f, 0x9f, 0x68, 0xff, 0xba, 0xbd, 0x5e, 0xff, 0xbc, 0xbb, 0x54, 0xff, 0xba, 0xb9, 0x51, 0xff, 0xb8, 0xb6, 0x4e, 0xff, 0xb3, 0xb3, 0x4d, 0xff, 0xae, 0xae, 0x54, 0xff, 0x89, 0x89, 0x3f, 0xff, 0x6e, 0x6e, 0x31, 0xff, 0x77, 0x79, 0x46, 0xff, 0x9f, 0xa2, 0x7a, 0xff, 0xb9, 0xc1, 0x9d, 0xff, 0xc3, 0xcf, 0xa9, 0xff, 0xca, 0xd6, 0xad, 0xff, 0xcf, 0xd9, 0xb0, 0xff, 0xce, 0xda, 0xab, 0xff, 0xcd, 0xda, 0xa8, 0xff, 0xce, 0xdb, 0xa6, 0xff, 0xcf, 0xdc, 0xa4, 0xff, 0xcd, 0xdb, 0xa1, 0xff, 0xcd, 0xdc, 0x9f, 0xff, 0xcf, 0xdd, 0x9f, 0xff, 0xcf, 0xdc, 0xa4, 0xff, 0xcd, 0xda, 0xa2, 0xff, 0xcd, 0xdb, 0xa2, 0xff, 0xce, 0xdb, 0xa2, 0xff, 0xcf, 0xdd, 0xa3, 0xff, 0xce, 0xdd, 0xa2, 0xff, 0xcd, 0xdc, 0xa0, 0xff, 0xd0, 0xde, 0xa0, 0xff, 0xd0, 0xdd, 0xa0, 0xff, 0xce, 0xda, 0x9f, 0xff, 0xce, 0xd8, 0x9f, 0xff, 0xd0, 0xd9, 0xa3, 0xff, 0xd0, 0xd8, 0xa2, 0xff, 0xd2, 0xd9, 0xa7, 0xff, 0xd0, 0xd9, 0xab, 0xff, 0xca, 0xd7, 0xad, 0xff, 0xc3, 0xd2, 0xa9, 0xff, 0xb5, 0xc1, 0x98, 0xff, 0x8c, 0x90, 0x64, 0xff, 0x7b, 0x7a, 0x49, 0xff, 0x73, 0x70, 0x3a, 0xff, 0x85, 0x85, 0x3d, 0xff, 0xb6, 0xb6, 0x5d, 0xff, 0xb9, 0xb9, 0x59, 0xff, 0xb8, 0xb9, 0x4e, 0xff, 0xba, 0xbc, 0x4c, 0xff, 0xb7, 0xb9, 0x51, 0xff, 0xb1, 0xb8, 0x61, 0xff, 0x7f, 0x82, 0x58, 0xff, 0x4b, 0x4e, 0x4c, 0xf4, 0x89, 0x8c, 0x90, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x99, 0x99, 0x19, 0x57, 0x57, 0x54, 0xda, 0x83, 0x84, 0x5d, 0xff, 0xbc, 0xc4, 0x6e, 0xff, 0xbf, 0xbd, 0x58, 0xff, 0xb8, 0xb9, 0x4e, 0xff, 0xb5, 0xb9, 0x4b, 0xff, 0xb1, 0xb6, 0x4c, 0xff, 0xb1, 0xb4, 0x53, 0xff, 0xae, 0xaf, 0x5a, 0xff, 0x9c, 0x9a, 0x56, 0xff, 0x7d, 0x7b, 0x4e, 0xff, 0x5a, 0x5a, 0x3e, 0xff, 0x4f, 0x53, 0x44, 0xff, 0x5a, 0x61, 0x55, 0xff, 0x72, 0x79, 0x6b, 0xff, 0x87, 0x8c, 0x7d, 0xff, 0x9c, 0xa2, 0x8c, 0xff, 0xa8, 0xb0, 0x95, 0xff, 0xb8, 0xc0, 0xa2, 0xff, 0xc3, 0xcc, 0xa9, 0xff, 0xc8, 0xd3, 0xaa, 0xff, 0xcb, 0xd7, 0xa9, 0xff, 0xcd, 0xd9, 0xa9, 0xff, 0xce, 0xda, 0xab, 0xff, 0xcd, 0xd8, 0xa8, 0xff, 0xcc, 0xd7, 0xa6, 0xff, 0xcb, 0xd7, 0xa6, 0xff, 0xcc, 0xd8, 0xa6, 0xff, 0xca, 0xd6, 0xa3, 0xff, 0xcb, 0xd8, 0xa5, 0xff, 0xc9, 0xd9, 0xa4, 0xff, 0xc7, 0xd5, 0xa4, 0xff, 0xc3, 0xcf, 0xa3, 0xff, 0xbd, 0xc7, 0xa1, 0xff, 0xb6, 0xbb, 0x9c, 0xff, 0xaa, 0xad, 0x91, 0xff, 0x9c, 0xa0, 0x89, 0xff, 0x83, 0x8a, 0x79, 0xff, 0x6a, 0x74, 0x67, 0xff, 0x56, 0x61, 0x54, 0xff, 0x51, 0x59, 0x43, 0xff, 0x64, 0x64, 0x43, 0xff, 0x82, 0x7c, 0x50, 0xff, 0xa2, 0x9f, 0x62, 0xff, 0xb8, 0xb9, 0x67, 0xff, 0xbb, 0xbb, 0x5d, 0xff, 0xbf, 0xbd, 0x59, 0xff, 0xbd, 0xbe, 0x4f, 0xff, 0xbf, 0xc3, 0x50, 0xff, 0xbe, 0xc1, 0x5d, 0xff, 0xb7, 0xbe, 0x79, 0xff, 0x5c, 0x5f, 0x44, 0xff, 0x4f, 0x53, 0x55, 0xd3, 0xc6, 0xc6, 0xc6, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0x5f, 0x5e, 0x65, 0x8b, 0x57, 0x58, 0x47, 0xfd, 0xb2, 0xbb, 0x73, 0xff, 0xca, 0xcb, 0x62, 0xff, 0xc0, 0xc4, 0x4d, 0xff, 0xbb, 0xc2, 0x46, 0xff, 0xb7, 0xbd, 0x47, 0xff, 0xb6, 0xb8, 0x4c, 0xff, 0xb3, 0xb2, 0x50, 0xff, 0xb3, 0xb1, 0x57, 0xff, 0xae, 0xab, 0x65, 0xff, 0xa1, 0xa0, 0x75, 0xff, 0x7d, 0x7d, 0x6d, 0xff, 0x54, 0x56, 0x59, 0xfe, 0x56, 0x59, 0x60, 0xea, 0x4f, 0x50, 0x58, 0xe2, 0x4c, 0x4c, 0x54, 0xef, 0x52, 0x52, 0x58, 0xf8, 0x57, 0x59, 0x5d, 0xfb, 0x5a, 0x5d, 0x5c, 0xfe, 0x63, 0x66, 0x5f, 0xff, 0x6e, 0x74, 0x67, 0xff, 0x7c, 0x82, 0x72, 0xff, 0x8b, 0x92, 0x7a, 0xff, 0x97, 0x9d, 0x84, 0xff, 0xa1, 0xa7, 0x8e, 0xff, 0xa5, 0xac, 0x90, 0xff, 0x9e, 0xa6, 0x8a, 0xff, 0x97, 0x9e, 0x82, 0xff, 0x87, 0x90, 0x76, 0xff, 0x75, 0x82, 0x6c, 0xff, 0x6a, 0x75, 0x64, 0xff, 0x5c, 0x66, 0x5a, 0xff, 0x4f, 0x56, 0x51, 0xff, 0x4c, 0x50, 0x51, 0xfe, 0x48, 0x4b, 0x51, 0xfa, 0x49, 0x4a, 0x53, 0xf0, 0x50, 0x50, 0x5a, 0xe2, 0x4d, 0x52, 0x5b, 0xf3, 0x4d, 0x54, 0x52, 0xff, 0x7f, 0x84, 0x6b, 0xff, 0xa5, 0xa7, 0x74, 0xff, 0xb9, 0xb7, 0x6e, 0xff, 0xbd, 0xbb, 0x66, 0xff, 0xbd, 0xbc, 0x59, 0xff, 0xc3, 0xc0, 0x55, 0xff, 0xc4, 0xc0, 0x51, 0xff, 0xc9, 0xca, 0x52, 0xff, 0xcc, 0xd1, 0x5d, 0xff, 0xce, 0xd3, 0x75, 0xff, 0xa2, 0xa8, 0x76, 0xff, 0x4c, 0x4e, 0x46, 0xfd, 0x60, 0x62, 0x68, 0x80, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x6e, 0x73, 0x33, 0x4c, 0x4d, 0x49, 0xe9, 0x7c, 0x82, 0x52, 0xff, 0xcf, 0xd3, 0x74, 0xff, 0xd1, 0xd7, 0x61, 0xff, 0xca, 0xd0, 0x4c, 0xff, 0xc0, 0xc3, 0x41, 0xff, 0xbe, 0xbd, 0x46, 0xff, 0xbb, 0xb9, 0x4b, 0xff, 0xbb, 0xb9, 0x4c, 0xff, 0xb7, 0xb5, 0x53, 0xff, 0xae, 0xab, 0x70, 0xff, 0x7d, 0x7b, 0x65, 0xff, 0x5e, 0x5c, 0x60, 0xea, 0x88, 0x85, 0x93, 0x47, 0xa3, 0xa3, 0xad, 0x19, 0x8b, 0x85, 0x96, 0x2e, 0x6f, 0x6c, 0x78, 0x53, 0x5e, 0x5e, 0x6b, 0x64, 0x5b, 0x59, 0x66, 0x7b, 0x54, 0x51, 0x60, 0xa0, 0x53, 0x52, 0x5c, 0xb2, 0x55, 0x53, 0x5d, 0xbe, 0x54, 0x53, 0x55, 0xc8, 0x55, 0x53, 0x57, 0xd0, 0x54, 0x53, 0x56, 0xd5, 0x55, 0x55, 0x57, 0xd6, 0x59, 0x59, 0x59, 0xd5, 0x57, 0x57, 0x56, 0xd0, 0x53, 0x52, 0x55, 0xc8, 0x51, 0x4e, 0x55, 0xc1, 0x52, 0x4f, 0x56, 0xb7, 0x51, 0x4e, 0x58, 0xa6, 0x52, 0x4f, 0x5a, 0x85, 0x58, 0x51, 0x5f, 0x6e, 0x64, 0x5c, 0x6d, 0x59, 0x7d, 0x77, 0x88, 0x2f, 0xad, 0xa3, 0xb8, 0x19, 0x56, 0x54, 0x63, 0x89, 0x4c, 0x4e, 0x50, 0xfd, 0x89, 0x8d, 0x6c, 0xff, 0xb0, 0xb5, 0x6d, 0xff, 0xbc, 0xbe, 0x56, 0xff, 0xbe, 0xbf, 0x51, 0xff, 0xc2, 0xc3, 0x4d, 0xff, 0xc9, 0xc5, 0x4c, 0xff, 0xd0, 0xcc, 0x53, 0xff, 0xd5, 0xd6, 0x5c, 0xff, 0xd3, 0xd8, 0x6e, 0xff, 0xce, 0xd1, 0x86, 0xff, 0x69, 0x6d, 0x52, 0xff, 0x55, 0x55, 0x55, 0xda, 0xa5, 0xa5, 0xad, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xff, 0x03, 0x5b, 0x57, 0x5e, 0x87, 0x57, 0x59, 0x4a, 0xfb, 0xab, 0xaf, 0x6d, 0xff, 0xd1, 0xd7, 0x76, 0xff, 0xd9, 0xdd, 0x5f, 0xff, 0xdc, 0xdd, 0x59, 0xff, 0xce, 0xcc, 0x51, 0xff, 0xc1, 0xc2, 0x4d, 0xff, 0xbd, 0xc0, 0x50, 0xff, 0xb7, 0xb8, 0x5e, 0xff, 0xa1, 0xa0, 0x6c, 0xff, 0x65, 0x5f, 0x56, 0xff, 0x66, 0x60, 0x6a, 0xa8, 0xdb, 0xdb, 0xdb, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xff, 0xcc, 0xff, 0x05, 0xb6, 0xb6, 0xdb, 0x07, 0xb3, 0x99, 0xb3, 0x0a, 0x89, 0x89, 0x9d, 0x0d, 0x7f, 0x70, 0x8f, 0x10, 0x7f, 0x70, 0x7f, 0x10, 0x88, 0x77, 0x88, 0x0f, 0x95, 0x95, 0x95, 0x0c, 0xaa, 0xaa, 0xaa, 0x09, 0xdb, 0xb6, 0xb6, 0x07, 0xd4, 0xd4, 0xd4, 0x06, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x7c, 0x89, 0x27, 0x4e, 0x4a, 0x53, 0xe1, 0x64, 0x65, 0x4d, 0xff, 0xa9, 0xab, 0x6a, 0xff, 0xbc, 0xbf, 0x5b, 0xff, 0xc5, 0xc7, 0x56, 0xff, 0xca, 0xcb, 0x50, 0xff, 0xd6, 0xd3, 0x57, 0xff, 0xdb, 0xd8, 0x5f, 0xff, 0xd6, 0xda, 0x6a, 0xff, 0xd4, 0xda, 0x88, 0xff, 0x8f, 0x92, 0x66, 0xff, 0x5f, 0x5e, 0x58, 0xf6, 0x7f, 0x7d, 0x82, 0x64, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x92, 0x9e, 0x15, 0x56, 0x53, 0x59, 0xbe, 0x65, 0x68, 0x4b, 0xff, 0xbd, 0xc1, 0x7b, 0xff, 0xd9, 0xdc, 0x73, 0xff, 0xe0, 0xdf, 0x66, 0xff, 0xdf, 0xde, 0x66, 0xff, 0xcb, 0xd1, 0x5c, 0xff, 0xb7, 0xbf, 0x5c, 0xff, 0xab, 0xad, 0x72, 0xff, 0x71, 0x70, 0x55, 0xff, 0x5f, 0x58, 0x5f, 0xe8, 0x7b, 0x77, 0x88, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0x67, 0x61, 0x70, 0x74, 0x58, 0x54, 0x52, 0xf9, 0x86, 0x85, 0x5b, 0xff, 0xb9, 0xb8, 0x71, 0xff, 0xc6, 0xc9, 0x63, 0xff, 0xd4, 0xd8, 0x62, 0xff, 0xd9, 0xda, 0x63, 0xff, 0xdb, 0xdb, 0x6d, 0xff, 0xd0, 0xd6, 0x78, 0xff, 0x9c, 0xa3, 0x68, 0xff, 0x60, 0x63, 0x56, 0xfc, 0x60, 0x5c, 0x60, 0xa0, 0xc4, 0xb1, 0xc4, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x79, 0x86, 0x37, 0x58, 0x58, 0x55, 0xd9, 0x66, 0x6a, 0x51, 0xff, 0xa9, 0xac, 0x74, 0xff, 0xd1, 0xd0, 0x82, 0xff, 0xd9, 0xd6, 0x80, 0xff, 0xce, 0xce, 0x7c, 0xff, 0xad, 0xb1, 0x72, 0xff, 0x72, 0x70, 0x59, 0xff, 0x61, 0x5b, 0x5b, 0xf6, 0x6d, 0x62, 0x71, 0x7a, 0xbf, 0xbf, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x96, 0xa5, 0x11, 0x5e, 0x54, 0x62, 0xae, 0x5d, 0x5a, 0x53, 0xfd, 0x85, 0x8b, 0x65, 0xff, 0xb2, 0xb8, 0x73, 0xff, 0xc6, 0xcb, 0x78, 0xff, 0xc8, 0xcc, 0x78, 0xff, 0xbd, 0xbf, 0x7a, 0xff, 0x8b, 0x8d, 0x61, 0xff, 0x58, 0x5c, 0x4f, 0xfc, 0x5a, 0x60, 0x5f, 0xaf, 0xb1, 0xa6, 0xb1, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x79, 0x75, 0x82, 0x3d, 0x57, 0x58, 0x5e, 0xc7, 0x57, 0x5c, 0x52, 0xfb, 0x69, 0x6d, 0x50, 0xff, 0x7f, 0x81, 0x5c, 0xff, 0x79, 0x7f, 0x5d, 0xff, 0x5e, 0x65, 0x51, 0xff, 0x5a, 0x5b, 0x58, 0xeb, 0x6c, 0x68, 0x70, 0x82, 0xb9, 0xa2, 0xb9, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x8b, 0x93, 0x21, 0x5c, 0x5b, 0x5f, 0xb4, 0x53, 0x58, 0x53, 0xfa, 0x5d, 0x62, 0x4e, 0xff, 0x72, 0x76, 0x57, 0xff, 0x69, 0x6d, 0x4c, 0xff, 0x5c, 0x5d, 0x49, 0xff, 0x56, 0x52, 0x50, 0xef, 0x60, 0x5b, 0x67, 0x97, 0x99, 0x8f, 0xa3, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x9b, 0xa6, 0x17, 0x6e, 0x6b, 0x77, 0x6b, 0x57, 0x57, 0x5b, 0xc1, 0x51, 0x52, 0x55, 0xda, 0x52, 0x54, 0x59, 0xd4, 0x5c, 0x5f, 0x66, 0x9e, 0x7b, 0x7b, 0x88, 0x3c, 0xd4, 0xd4, 0xd4, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0x94, 0xa1, 0x13, 0x65, 0x65, 0x73, 0x6a, 0x50, 0x51, 0x5e, 0xbd, 0x4a, 0x4b, 0x53, 0xd6, 0x4a, 0x4e, 0x53, 0xcf, 0x57, 0x57, 0x60, 0x98, 0x79, 0x71, 0x82, 0x3d, 0xbf, 0x9f, 0xbf, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xdf, 0xdf, 0x08, 0xbf, 0xaf, 0xbf, 0x10, 0xc4, 0xb1, 0xc4, 0x0d, 0xff, 0xbf, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xdb, 0xdb, 0x07, 0xb6, 0xa4, 0xc8, 0x0e, 0xb9, 0xb9, 0xb9, 0x0b, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-};
-
-const lv_img_dsc_t pet_idle_frame2 = {
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 100,
-  .header.h = 89,
-  .data_size = 8900 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .data = pet_idle_frame2_map,
-};
@@ -1,402 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_PET_IDLE_FRAME3
-#define LV_ATTRIBUTE_IMG_PET_IDLE_FRAME3
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_PET_IDLE_FRAME3 uint8_t pet_idle_frame3_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xff, 0x02, 0x6e, 0x05, 0xb6, 0x0e, 0xb6, 0x15, 0x92, 0x16, 0x92, 0x16, 0xb6, 0x15, 0xb6, 0x0e, 0x92, 0x06, 0xfe, 0x02, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0xd7, 0x12, 0x92, 0x36, 0x6e, 0x5c, 0x6d, 0x8c, 0x6d, 0xab, 0x6d, 0xc6, 0x4d, 0xcf, 0x6d, 0xd2, 0x6d, 0xd3, 0x6d, 0xd0, 0x6d, 0xc6, 0x6d, 0xae, 0x6e, 0x8e, 0x6e, 0x68, 0x92, 0x3b, 0xb2, 0x19, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xb6, 0x18, 0x8e, 0x55, 0x6e, 0x9d, 0x6d, 0xcf, 0x6d, 0xeb, 0x4d, 0xf8, 0x4d, 0xfd, 0x52, 0xff, 0x52, 0xff, 0x72, 0xff, 0x76, 0xff, 0x76, 0xff, 0x72, 0xff, 0x72, 0xff, 0x52, 0xff, 0x6e, 0xfd, 0x6e, 0xf9, 0x6e, 0xee, 0x6d, 0xd5, 0x6d, 0xa4, 0x6e, 0x5a, 0xb6, 0x19, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x09, 0xb6, 0x36, 0x6e, 0x87, 0x6d, 0xd6, 0x6d, 0xf5, 0x4d, 0xfe, 0x52, 0xff, 0x76, 0xff, 0x77, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x76, 0xff, 0x52, 0xff, 0x4d, 0xfe, 0x6d, 0xf6, 0x6d, 0xd5, 0x6e, 0x7c, 0xb6, 0x23, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x09, 0x92, 0x47, 0x6e, 0xaa, 0x6e, 0xea, 0x6e, 0xfd, 0x72, 0xff, 0x97, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x76, 0xff, 0x52, 0xff, 0x4d, 0xfb, 0x6d, 0xd8, 0x6d, 0x76, 0xb7, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xb6, 0x3a, 0x6e, 0xa9, 0x6d, 0xef, 0x6d, 0xfe, 0x72, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7b, 0xff, 0x52, 0xff, 0x6d, 0xf9, 0x6d, 0xbd, 0x92, 0x45, 0xdb, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x14, 0x92, 0x80, 0x6d, 0xe9, 0x4d, 0xff, 0x52, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x4d, 0xff, 0x6d, 0xea, 0x6e, 0x77, 0xdb, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xb7, 0x2d, 0x6e, 0xb3, 0x4d, 0xfa, 0x4e, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x52, 0xff, 0x4d, 0xf6, 0x6d, 0x98, 0xdb, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0xb6, 0x41, 0x6d, 0xd8, 0x4d, 0xfe, 0x76, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x52, 0xff, 0x4d, 0xfa, 0x6d, 0xad, 0xb7, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0xb6, 0x47, 0x6d, 0xde, 0x4d, 0xff, 0x76, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x52, 0xff, 0x49, 0xfb, 0x6d, 0xaa, 0xd7, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xb7, 0x39, 0x6d, 0xdc, 0x6d, 0xff, 0x77, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x52, 0xff, 0x4d, 0xfb, 0x6d, 0x99, 0xdb, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x23, 0x6d, 0xcc, 0x4d, 0xff, 0x76, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x52, 0xff, 0x49, 0xf7, 0x6d, 0x7f, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x0a, 0x6d, 0x9f, 0x4d, 0xfd, 0x72, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4e, 0xff, 0x4d, 0xee, 0x92, 0x59, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x54, 0x6d, 0xf3, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0x49, 0xd8, 0xb2, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x17, 0x6d, 0xc7, 0x4d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x4d, 0xfc, 0x6d, 0x98, 0xd7, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x92, 0x72, 0x6d, 0xfa, 0x76, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x4d, 0xf0, 0x6e, 0x57, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x1a, 0x6d, 0xd1, 0x4d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x4d, 0xfe, 0x69, 0xc4, 0xb6, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x92, 0x66, 0x4d, 0xf9, 0x76, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x4d, 0xf7, 0x6e, 0x64, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x0e, 0x6d, 0xc7, 0x4e, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4e, 0xff, 0x6d, 0xc7, 0xb6, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x47, 0x6d, 0xf5, 0x76, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x6d, 0xf5, 0x6d, 0x64, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x6e, 0x99, 0x4d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4d, 0xfe, 0x6d, 0xb6, 0xd7, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x17, 0x6d, 0xd8, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x6d, 0xe9, 0x92, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x4f, 0x49, 0xf5, 0x76, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x76, 0xff, 0x77, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4d, 0xfb, 0x6d, 0x83, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x6d, 0x95, 0x4d, 0xfd, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x4d, 0xd2, 0xb7, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x10, 0x6d, 0xcb, 0x4d, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x76, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x6d, 0xff, 0x69, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x77, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x6d, 0xf4, 0x6e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x2b, 0x49, 0xf0, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x4e, 0xff, 0x6d, 0xff, 0x69, 0xff, 0x49, 0xff, 0x4d, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x4e, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x6d, 0xff, 0x72, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4d, 0xfd, 0x6e, 0x88, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x4c, 0x6d, 0xfa, 0x76, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4d, 0xff, 0x69, 0xff, 0x69, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x76, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x52, 0xff, 0x6d, 0xff, 0x69, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x4e, 0xff, 0x6d, 0xc8, 0xdb, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xb2, 0x81, 0x4d, 0xfe, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4d, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x6d, 0xff, 0x52, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x52, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x77, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x4d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x6d, 0xf0, 0x92, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x17, 0x8e, 0xc8, 0x4d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x4d, 0xff, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x6d, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x49, 0xff, 0x4d, 0xff, 0x52, 0xff, 0x77, 0xff, 0x9b, 0xff, 0xbf, 0xff, 0x96, 0xff, 0x72, 0xff, 0x72, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4d, 0xfd, 0x8e, 0x7d, 0xff, 0x03, 0xff, 0x07, 0xb7, 0x13, 0xb6, 0x22, 0xb7, 0x13, 0xf7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0x6d, 0x91, 0x6d, 0xfc, 0x72, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x52, 0xff, 0x4d, 0xff, 0x72, 0xff, 0x92, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0x6d, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0x69, 0xff, 0xb6, 0xff, 0xbb, 0xff, 0x96, 0xff, 0x4d, 0xff, 0x4e, 0xff, 0x97, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0x6d, 0xd5, 0x92, 0x74, 0x6d, 0xa2, 0x6d, 0xbb, 0x6d, 0xb3, 0x6d, 0x7f, 0xb6, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x92, 0x63, 0x69, 0xf3, 0x6d, 0xff, 0x72, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x4d, 0xff, 0x96, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x69, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x4d, 0xff, 0x76, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0x69, 0xfa, 0x8e, 0x90, 0xb2, 0x4a, 0xb7, 0x23, 0xd7, 0x12, 0xff, 0x08, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0xff, 0x0b, 0xd7, 0x12, 0xff, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x39, 0x6d, 0xe0, 0x6d, 0xff, 0x6d, 0xff, 0x76, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x4d, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x4d, 0xff, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x72, 0xff, 0x69, 0xf7, 0xb6, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x03, 0x6e, 0x56, 0x6d, 0xc3, 0x6d, 0xd7, 0x6d, 0xb5, 0x92, 0x47, 0xdb, 0x05, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x14, 0x6d, 0xbf, 0x6d, 0xff, 0x92, 0xff, 0x6d, 0xff, 0x77, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x56, 0xff, 0x52, 0xff, 0x52, 0xff, 0x52, 0xff, 0x52, 0xff, 0x76, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x4d, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x4d, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x97, 0xff, 0x6d, 0xfa, 0x92, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x3d, 0x4d, 0xe8, 0x4d, 0xff, 0x4e, 0xff, 0x4d, 0xff, 0x49, 0xec, 0x6d, 0x76, 0xb7, 0x06, 0xff, 0x03, 0x6e, 0x7e, 0x4d, 0xf9, 0x76, 0xff, 0x96, 0xff, 0x4d, 0xff, 0x77, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x56, 0xff, 0x56, 0xff, 0x56, 0xff, 0x56, 0xff, 0x52, 0xff, 0x52, 0xff, 0x32, 0xff, 0x5b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xb6, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x4e, 0xff, 0x52, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4d, 0xfe, 0x8d, 0x9b, 0xb7, 0x19, 0xff, 0x06, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x04, 0x6d, 0x99, 0x49, 0xfe, 0x77, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x4d, 0xff, 0x49, 0xee, 0x92, 0x5a, 0xb2, 0x2f, 0x4d, 0xe3, 0x52, 0xff, 0x9b, 0xff, 0x76, 0xff, 0x4d, 0xff, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x56, 0xff, 0x52, 0xff, 0x6e, 0xff, 0x6d, 0xff, 0x92, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbb, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x57, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4d, 0xff, 0x69, 0xee, 0x69, 0xab, 0x6d, 0x94, 0x92, 0x69, 0xd7, 0x1c, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x12, 0x49, 0xd7, 0x4d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0x69, 0xde, 0x6d, 0xba, 0x4d, 0xfc, 0x9b, 0xff, 0x9f, 0xff, 0x77, 0xff, 0x4e, 0xff, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x5b, 0xff, 0x76, 0xff, 0x96, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xdb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x72, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x6d, 0xd4, 0xd7, 0x28, 0x8e, 0x43, 0x6d, 0x97, 0x6d, 0xab, 0x92, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x1a, 0x49, 0xe6, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x4d, 0xff, 0x6d, 0xfe, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4e, 0xff, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7b, 0xff, 0x57, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0x72, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x6d, 0xd9, 0xfb, 0x11, 0x00, 0x00, 0xdb, 0x05, 0x92, 0x29, 0x92, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xff, 0x01, 0xfb, 0x12, 0xb6, 0x2b, 0x92, 0x46, 0xb6, 0x2e, 0xfb, 0x0c, 0xd7, 0x21, 0x49, 0xea, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x52, 0xff, 0x76, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x77, 0xff, 0x52, 0xff, 0x52, 0xff, 0x76, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0xb6, 0xff, 0xdb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0x96, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbb, 0xff, 0x6d, 0xff, 0x6e, 0xff, 0x9b, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x76, 0xff, 0x6d, 0xe0, 0xb6, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x92, 0x1b, 0x6e, 0x7e, 0x6d, 0xd0, 0x6d, 0xea, 0x6d, 0xf3, 0x6d, 0xeb, 0x6d, 0xc2, 0x92, 0x93, 0x6d, 0xf5, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x52, 0xff, 0x56, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x76, 0xff, 0x52, 0xff, 0x52, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0x6d, 0xff, 0x92, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbb, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0x6d, 0xff, 0x72, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x6d, 0xff, 0x72, 0xff, 0x52, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x76, 0xff, 0x6d, 0xea, 0x92, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x09, 0xdb, 0x2d, 0xdb, 0x5b, 0xdb, 0x61, 0xdb, 0x3c, 0xff, 0x12, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x6d, 0xc0, 0x6d, 0xfa, 0x4e, 0xff, 0x72, 0xff, 0x76, 0xff, 0x76, 0xff, 0x4e, 0xff, 0x6d, 0xfe, 0x6d, 0xff, 0x4e, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x4d, 0xff, 0x76, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x56, 0xff, 0x56, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x5b, 0xff, 0x32, 0xff, 0x77, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x52, 0xff, 0x4d, 0xff, 0x6d, 0xff, 0xdb, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0x96, 0xff, 0x4e, 0xff, 0x4d, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4d, 0xff, 0x92, 0xff, 0x97, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xb6, 0xff, 0x92, 0xff, 0x6d, 0xff, 0x76, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x52, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x77, 0xff, 0x6d, 0xef, 0x92, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xdb, 0x25, 0xb7, 0x9c, 0xb7, 0xe9, 0xbb, 0xfb, 0xbb, 0xfb, 0xbb, 0xf2, 0xbb, 0xbc, 0xdb, 0x4b, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x4d, 0xfe, 0x72, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x77, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x4e, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x5b, 0xff, 0x56, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x32, 0xff, 0x77, 0xff, 0x9b, 0xff, 0x52, 0xff, 0x6e, 0xff, 0xbb, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbb, 0xff, 0xb6, 0xff, 0x72, 0xff, 0x4d, 0xff, 0x72, 0xff, 0x77, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x72, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x6d, 0xf0, 0x92, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x1e, 0xb7, 0xbe, 0xdb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xea, 0xdb, 0x60, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x4d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x52, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x4e, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x5b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x52, 0xff, 0x4d, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x72, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x96, 0xff, 0x6e, 0xff, 0xb6, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x76, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0xbb, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x6d, 0xf2, 0x92, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0xbb, 0x8c, 0xdb, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xd5, 0xdb, 0x1e, 0x00, 0x00, 0x00, 0x00, 
-  0x4e, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x52, 0xff, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x52, 0xff, 0x6d, 0xff, 0x92, 0xff, 0xb2, 0xff, 0xd6, 0xff, 0x8e, 0xff, 0x72, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xb6, 0xf9, 0xb7, 0x8b, 0xdb, 0x33, 0xdb, 0x35, 0xdb, 0x41, 0xdb, 0x67, 0xbb, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xf7, 0xdb, 0x51, 0x00, 0x00, 0x00, 0x00, 
-  0x4e, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x52, 0xff, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x76, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xfa, 0xbb, 0xf0, 0xb7, 0xf0, 0xbb, 0xf3, 0xbb, 0xfa, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xfb, 0xbb, 0x66, 0x00, 0x00, 0x00, 0x00, 
-  0x4d, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x4e, 0xff, 0x52, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x4d, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0x4d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0xbb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xfa, 0xdb, 0x5d, 0x00, 0x00, 0x00, 0x00, 
-  0x6d, 0xf4, 0x72, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x52, 0xff, 0x56, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x52, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x4e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xfa, 0xdb, 0x63, 0xff, 0x02, 0x00, 0x00, 
-  0x6d, 0xa9, 0x4d, 0xfd, 0x77, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x76, 0xff, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x72, 0xff, 0xb6, 0xff, 0xff, 0xff, 0x6d, 0xff, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xdf, 0xdb, 0x5b, 0xff, 0x03, 
-  0x6e, 0x2f, 0x6d, 0xd7, 0x4e, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x4d, 0xff, 0xd7, 0xff, 0xff, 0xff, 0x6d, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x77, 0xff, 0x72, 0xff, 0x92, 0xff, 0x52, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0xbb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xe1, 0xdb, 0x3b, 
-  0xff, 0x02, 0x6e, 0x56, 0x6d, 0xea, 0x4d, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x76, 0xff, 0x6e, 0xff, 0xb6, 0xff, 0x4e, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x52, 0xff, 0x52, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfe, 0xdb, 0xb1, 
-  0x00, 0x00, 0xdb, 0x04, 0x6d, 0x70, 0x4d, 0xeb, 0x4d, 0xff, 0x72, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x52, 0xff, 0x52, 0xff, 0x76, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x72, 0xff, 0xb7, 0xd9, 0xbb, 0xd3, 0xdb, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xf2, 
-  0x00, 0x00, 0x00, 0x00, 0xdb, 0x04, 0x6e, 0x53, 0x49, 0xd2, 0x4d, 0xfa, 0x4e, 0xff, 0x72, 0xff, 0x76, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x77, 0xff, 0x4d, 0xfe, 0x6e, 0x8f, 0xdf, 0x41, 0xbb, 0xf4, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xfb, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x92, 0x1a, 0x6d, 0x6f, 0x49, 0xcf, 0x4d, 0xf7, 0x4d, 0xfe, 0x4e, 0xff, 0x72, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x49, 0xfc, 0x92, 0x71, 0xdb, 0x55, 0xbb, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xfb, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xb6, 0x16, 0x6d, 0x60, 0x6d, 0xad, 0x6d, 0xe2, 0x6d, 0xf9, 0x4e, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x52, 0xff, 0x49, 0xf4, 0xb6, 0x3e, 0xdb, 0x8c, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xed, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x06, 0x92, 0x26, 0x8e, 0x6a, 0x6e, 0xeb, 0x72, 0xff, 0x9b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x4d, 0xff, 0x49, 0xcf, 0xdb, 0x18, 0xdb, 0xa3, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfa, 0xbb, 0x8c, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x04, 0x6d, 0x8e, 0x6d, 0xfc, 0x76, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x4d, 0xfc, 0x6d, 0x83, 0xdb, 0x04, 0xbb, 0x8c, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdb, 0xfd, 0xbb, 0xc2, 0xdb, 0x22, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x34, 0x6d, 0xe8, 0x72, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x72, 0xff, 0x4d, 0xee, 0x92, 0x3d, 0x00, 0x00, 0xdb, 0x44, 0xbb, 0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbb, 0xf8, 0xbb, 0xb8, 0xdb, 0x34, 0xff, 0x01, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x08, 0x6d, 0xab, 0x4d, 0xfe, 0x76, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x4e, 0xff, 0x6d, 0xc2, 0xb7, 0x0f, 0x00, 0x00, 0xdf, 0x0c, 0xbb, 0x9d, 0xdb, 0xfb, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbb, 0xee, 0xbb, 0xb4, 0xbb, 0xd6, 0xbb, 0xe3, 0xbb, 0xc0, 0xbb, 0x6c, 0xdb, 0x1a, 0xff, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x4b, 0x4d, 0xf1, 0x72, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x4d, 0xfc, 0x6d, 0x7d, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x19, 0xbb, 0x9a, 0xbb, 0xf2, 0xdb, 0xfe, 0xdb, 0xff, 0xdb, 0xff, 0xbb, 0xfd, 0xbb, 0xdf, 0xbb, 0x64, 0xff, 0x0d, 0xdf, 0x16, 0xdb, 0x1c, 0xdf, 0x0e, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x0c, 0x49, 0xc3, 0x4d, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x72, 0xff, 0x6d, 0xe9, 0x8e, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x0d, 0xbb, 0x4e, 0xbb, 0x97, 0xbb, 0xba, 0xbb, 0xb4, 0xbb, 0x83, 0xbb, 0x33, 0xdf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x50, 0x49, 0xf2, 0x72, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x4d, 0xfe, 0x6d, 0xa0, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xdb, 0x05, 0xdf, 0x0d, 0xdb, 0x09, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x0d, 0x6d, 0xad, 0x4d, 0xfe, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x77, 0xff, 0x77, 0xff, 0x52, 0xff, 0x4d, 0xea, 0x92, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x3b, 0x6d, 0xe4, 0x72, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x76, 0xff, 0x4d, 0xfd, 0x6d, 0x99, 0xdb, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x6e, 0x78, 0x6d, 0xf5, 0x72, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x4d, 0xff, 0x49, 0xd8, 0x92, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x0c, 0x6d, 0xa3, 0x6d, 0xfc, 0x76, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x72, 0xff, 0x4d, 0xf3, 0x6e, 0x63, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x26, 0x6d, 0xcf, 0x4d, 0xff, 0x76, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x72, 0xff, 0x4d, 0xfc, 0x6d, 0x9c, 0xd7, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x8e, 0x59, 0x6d, 0xf4, 0x72, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x6d, 0xfe, 0x6d, 0xbd, 0x92, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x16, 0x49, 0xdd, 0x4e, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x6d, 0xff, 0x6d, 0xf9, 0x92, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0c, 0x6d, 0xc9, 0x4d, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x77, 0xff, 0x72, 0xff, 0x4d, 0xff, 0x6d, 0xff, 0x6d, 0xf4, 0x92, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x6d, 0xa0, 0x4d, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x52, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbb, 0xff, 0x72, 0xff, 0x4d, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x6d, 0xf2, 0x92, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x71, 0x6d, 0xfa, 0x76, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x76, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x52, 0xff, 0x52, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x9b, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9b, 0xff, 0x6e, 0xff, 0x4d, 0xff, 0x52, 0xff, 0x97, 0xff, 0x72, 0xff, 0x6d, 0xf1, 0x92, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x33, 0x69, 0xeb, 0x72, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x52, 0xff, 0x52, 0xff, 0x76, 0xff, 0x77, 0xff, 0x97, 0xff, 0x4d, 0xff, 0x76, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x77, 0xff, 0x72, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbb, 0xff, 0x92, 0xff, 0x4d, 0xff, 0x4d, 0xff, 0x72, 0xff, 0x77, 0xff, 0x77, 0xff, 0x72, 0xff, 0x6d, 0xee, 0x92, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x0b, 0x6d, 0xb3, 0x4e, 0xff, 0x97, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x76, 0xff, 0x52, 0xff, 0x4d, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x4d, 0xff, 0x76, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x52, 0xff, 0x72, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbb, 0xff, 0x92, 0xff, 0x4d, 0xff, 0x6d, 0xff, 0x72, 0xff, 0x76, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x72, 0xff, 0x49, 0xe7, 0x92, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x92, 0x59, 0x4d, 0xf6, 0x72, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x96, 0xff, 0x6e, 0xff, 0x6d, 0xff, 0x6d, 0xfe, 0x4d, 0xff, 0x77, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x77, 0xff, 0x4d, 0xff, 0x96, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbb, 0xff, 0x96, 0xff, 0x72, 0xff, 0x6d, 0xff, 0x4d, 0xff, 0x6e, 0xff, 0x76, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x52, 0xff, 0x49, 0xd6, 0xb6, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x13, 0x6d, 0xc4, 0x4d, 0xff, 0x96, 0xff, 0x77, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x97, 0xff, 0x6e, 0xff, 0x6d, 0xd9, 0x8e, 0xb0, 0x4d, 0xfe, 0x76, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x52, 0xff, 0x4d, 0xff, 0xbb, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0x96, 0xff, 0x72, 0xff, 0x6d, 0xfe, 0x6d, 0xf5, 0x6d, 0xdd, 0x6d, 0xf6, 0x6d, 0xff, 0x97, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x4d, 0xff, 0x69, 0xb6, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x50, 0x4d, 0xe9, 0x72, 0xff, 0x76, 0xff, 0x77, 0xff, 0x77, 0xff, 0x97, 0xff, 0x72, 0xff, 0x6d, 0xf3, 0x92, 0x60, 0x8e, 0x75, 0x4d, 0xfd, 0x77, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x4d, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x96, 0xff, 0x96, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0x96, 0xff, 0x96, 0xff, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6d, 0xff, 0x49, 0xfc, 0x49, 0xf7, 0x69, 0xe5, 0x6d, 0xbe, 0x6d, 0x91, 0x8e, 0x49, 0xdb, 0x1d, 0x8e, 0x93, 0x6d, 0xfd, 0x72, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x6d, 0xf9, 0x6e, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x03, 0x6e, 0x62, 0x4d, 0xed, 0x72, 0xff, 0x76, 0xff, 0x96, 0xff, 0x72, 0xff, 0x6d, 0xf1, 0x8d, 0x7c, 0xf7, 0x06, 0x6e, 0x62, 0x4d, 0xfc, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x72, 0xff, 0x6d, 0xfb, 0x69, 0xea, 0x49, 0xec, 0x49, 0xf2, 0x69, 0xf4, 0x69, 0xf5, 0x69, 0xf5, 0x69, 0xf4, 0x6d, 0xf2, 0x69, 0xf0, 0x69, 0xea, 0x49, 0xe3, 0x49, 0xd6, 0x69, 0xbc, 0x69, 0x92, 0x6d, 0x75, 0x6e, 0x47, 0x92, 0x23, 0xb2, 0x0b, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x1f, 0x6d, 0xc3, 0x6d, 0xfe, 0x76, 0xff, 0x7b, 0xff, 0x77, 0xff, 0x77, 0xff, 0x97, 0xff, 0x72, 0xff, 0x6d, 0xd4, 0x92, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x04, 0x6d, 0x53, 0x6d, 0xc5, 0x6d, 0xe9, 0x6d, 0xe7, 0x6d, 0xc2, 0x6e, 0x56, 0xb7, 0x06, 0x00, 0x00, 0x6e, 0x53, 0x4d, 0xfa, 0x76, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x97, 0xff, 0x6d, 0xfb, 0x6d, 0x99, 0xb6, 0x21, 0x92, 0x21, 0x92, 0x36, 0x8e, 0x42, 0x8e, 0x49, 0x6e, 0x4a, 0x8e, 0x46, 0x8e, 0x3f, 0x92, 0x34, 0x92, 0x20, 0xb2, 0x15, 0xb6, 0x10, 0xdb, 0x09, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x2d, 0x6d, 0xc7, 0x6d, 0xfe, 0x72, 0xff, 0x96, 0xff, 0x96, 0xff, 0x72, 0xff, 0x6d, 0xf3, 0x6e, 0x68, 0x92, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x92, 0x13, 0x8e, 0x2f, 0x8e, 0x2b, 0x92, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x32, 0x4d, 0xec, 0x72, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x4e, 0xfe, 0x6d, 0xc8, 0xb2, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x26, 0x6d, 0xb1, 0x6d, 0xf4, 0x6d, 0xfd, 0x6d, 0xfc, 0x6d, 0xe8, 0x6d, 0x83, 0xb2, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x09, 0x6d, 0xb6, 0x4d, 0xff, 0x76, 0xff, 0x97, 0xff, 0x9b, 0xff, 0x97, 0xff, 0x76, 0xff, 0x4d, 0xff, 0x6d, 0xd8, 0x92, 0x38, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x10, 0x8e, 0x4d, 0x6e, 0x74, 0x6e, 0x6c, 0x92, 0x30, 0xdb, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x32, 0x6d, 0xd1, 0x6d, 0xfe, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6d, 0xfc, 0x6d, 0xcf, 0x92, 0x3d, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x92, 0x2a, 0x6d, 0x97, 0x69, 0xd9, 0x49, 0xe7, 0x6d, 0xd0, 0x6e, 0x80, 0x92, 0x20, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x04, 0xb6, 0x13, 0x92, 0x19, 0xb6, 0x10, 0x92, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xff, 0xff, 0x02, 0x4d, 0x6b, 0x05, 0xb2, 0x94, 0x0e, 0x12, 0xa5, 0x15, 0x71, 0x8c, 0x16, 0x70, 0x8c, 0x16, 0xb2, 0x94, 0x15, 0xb2, 0x94, 0x0e, 0x10, 0x84, 0x06, 0xf0, 0xff, 0x02, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x04, 0x75, 0xbd, 0x12, 0x30, 0x8c, 0x36, 0x6d, 0x73, 0x5c, 0x0b, 0x5b, 0x8c, 0xeb, 0x5a, 0xab, 0xca, 0x52, 0xc6, 0xea, 0x52, 0xcf, 0xea, 0x52, 0xd2, 0xeb, 0x5a, 0xd3, 0xca, 0x52, 0xd0, 0xeb, 0x5a, 0xc6, 0x0c, 0x63, 0xae, 0x2c, 0x6b, 0x8e, 0x6d, 0x73, 0x68, 0xaf, 0x7b, 0x3b, 0x92, 0x9c, 0x19, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x74, 0xad, 0x18, 0x6d, 0x73, 0x55, 0x2c, 0x6b, 0x9d, 0x0b, 0x5b, 0xcf, 0xeb, 0x52, 0xeb, 0x0b, 0x4b, 0xf8, 0x2c, 0x4b, 0xfd, 0x8d, 0x4b, 0xff, 0xef, 0x4b, 0xff, 0x71, 0x5c, 0xff, 0xd2, 0x64, 0xff, 0xd2, 0x64, 0xff, 0x91, 0x5c, 0xff, 0x30, 0x5c, 0xff, 0xae, 0x53, 0xff, 0x4d, 0x53, 0xfd, 0x4d, 0x5b, 0xf9, 0x2c, 0x5b, 0xee, 0x0c, 0x5b, 0xd5, 0xec, 0x6a, 0xa4, 0x4d, 0x73, 0x5a, 0xd3, 0x9c, 0x19, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x09, 0xb2, 0x9c, 0x36, 0x8e, 0x73, 0x87, 0x0c, 0x5b, 0xd6, 0x0b, 0x5b, 0xf5, 0x2c, 0x53, 0xfe, 0xce, 0x53, 0xff, 0xb1, 0x54, 0xff, 0x95, 0x65, 0xff, 0x58, 0x76, 0xff, 0xba, 0x76, 0xff, 0x1b, 0x77, 0xff, 0x1c, 0x77, 0xff, 0x3c, 0x77, 0xff, 0x3c, 0x77, 0xff, 0x1c, 0x7f, 0xff, 0x1b, 0x7f, 0xff, 0xfb, 0x7e, 0xff, 0x99, 0x7e, 0xff, 0xf7, 0x75, 0xff, 0x13, 0x65, 0xff, 0xcf, 0x53, 0xff, 0x2c, 0x53, 0xfe, 0xcb, 0x52, 0xf6, 0x8a, 0x52, 0xd5, 0x2c, 0x6b, 0x7c, 0xd2, 0x9c, 0x23, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xe7, 0x09, 0x10, 0x94, 0x47, 0x0c, 0x6b, 0xaa, 0x4d, 0x63, 0xea, 0x6d, 0x53, 0xfd, 0x2f, 0x5c, 0xff, 0x54, 0x75, 0xff, 0x58, 0x86, 0xff, 0xda, 0x7e, 0xff, 0x1b, 0x77, 0xff, 0x3c, 0x6f, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x1b, 0x6f, 0xff, 0xfb, 0x76, 0xff, 0xba, 0x7e, 0xff, 0x38, 0x76, 0xff, 0x54, 0x6d, 0xff, 0xae, 0x4b, 0xff, 0xcb, 0x4a, 0xfb, 0xcb, 0x5a, 0xd8, 0x0c, 0x63, 0x76, 0x75, 0xad, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0xf3, 0xa4, 0x3a, 0x4c, 0x73, 0xa9, 0xca, 0x5a, 0xef, 0x0c, 0x53, 0xfe, 0x51, 0x5c, 0xff, 0x37, 0x76, 0xff, 0xfa, 0x7e, 0xff, 0x3b, 0x7f, 0xff, 0x3b, 0x77, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x3b, 0x67, 0xff, 0xfb, 0x6e, 0xff, 0x1b, 0x77, 0xff, 0xb9, 0x7e, 0xff, 0xd6, 0x75, 0xff, 0x8e, 0x4b, 0xff, 0xcb, 0x52, 0xf9, 0xcb, 0x62, 0xbd, 0x10, 0x8c, 0x45, 0x18, 0xc6, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x14, 0xae, 0x7b, 0x80, 0xaa, 0x5a, 0xe9, 0xea, 0x4a, 0xff, 0x30, 0x54, 0xff, 0x17, 0x76, 0xff, 0x1b, 0x87, 0xff, 0x5c, 0x77, 0xff, 0x7c, 0x6f, 0xff, 0x7d, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x6f, 0xff, 0x7d, 0x7f, 0xff, 0x5d, 0x7f, 0xff, 0x3c, 0x7f, 0xff, 0x1b, 0x77, 0xff, 0x3b, 0x77, 0xff, 0xda, 0x7e, 0xff, 0x13, 0x65, 0xff, 0x0c, 0x4b, 0xff, 0xcb, 0x5a, 0xea, 0x4d, 0x6b, 0x77, 0x39, 0xce, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x35, 0xad, 0x2d, 0x2c, 0x6b, 0xb3, 0xca, 0x52, 0xfa, 0x6d, 0x43, 0xff, 0xb6, 0x6d, 0xff, 0xfb, 0x76, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x6f, 0xff, 0xbe, 0x8f, 0xff, 0x9d, 0x97, 0xff, 0x9d, 0x97, 0xff, 0x9d, 0x97, 0xff, 0x7d, 0x8f, 0xff, 0x5c, 0x77, 0xff, 0x3c, 0x6f, 0xff, 0x1b, 0x7f, 0xff, 0xf7, 0x75, 0xff, 0x8d, 0x4b, 0xff, 0xca, 0x52, 0xf6, 0x0c, 0x6b, 0x98, 0xd6, 0xbd, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0xf3, 0xa4, 0x41, 0xca, 0x52, 0xd8, 0x0c, 0x53, 0xfe, 0xb2, 0x5c, 0xff, 0xda, 0x76, 0xff, 0x1c, 0x77, 0xff, 0x3c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x7f, 0xff, 0x9d, 0x97, 0xff, 0x9d, 0x9f, 0xff, 0x9c, 0x9f, 0xff, 0x9c, 0x9f, 0xff, 0x9d, 0x9f, 0xff, 0x9d, 0x97, 0xff, 0x3c, 0x77, 0xff, 0x3c, 0x6f, 0xff, 0x1b, 0x6f, 0xff, 0xba, 0x7e, 0xff, 0xef, 0x4b, 0xff, 0xaa, 0x4a, 0xfa, 0xeb, 0x62, 0xad, 0x14, 0xad, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0xb2, 0x9c, 0x47, 0xeb, 0x62, 0xde, 0x2c, 0x53, 0xff, 0x34, 0x6d, 0xff, 0xfb, 0x7e, 0xff, 0x5c, 0x6f, 0xff, 0x3c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x77, 0xff, 0x9d, 0x97, 0xff, 0x7d, 0x9f, 0xff, 0x7c, 0xa7, 0xff, 0x9c, 0x9f, 0xff, 0x9c, 0x9f, 0xff, 0x9d, 0x9f, 0xff, 0x9d, 0x97, 0xff, 0x5c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x3b, 0x6f, 0xff, 0x99, 0x7e, 0xff, 0xef, 0x53, 0xff, 0x89, 0x4a, 0xfb, 0x0b, 0x6b, 0xaa, 0x96, 0xbd, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x75, 0xb5, 0x39, 0xca, 0x62, 0xdc, 0x0b, 0x53, 0xff, 0x74, 0x6d, 0xff, 0x3b, 0x7f, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x9d, 0x8f, 0xff, 0x9d, 0x9f, 0xff, 0x7c, 0xa7, 0xff, 0x7c, 0xa7, 0xff, 0x7c, 0xa7, 0xff, 0x7c, 0xa7, 0xff, 0x9d, 0x97, 0xff, 0x9d, 0x77, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3b, 0x77, 0xff, 0x99, 0x7e, 0xff, 0xce, 0x4b, 0xff, 0xaa, 0x52, 0xfb, 0xcb, 0x62, 0x99, 0x18, 0xc6, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xb5, 0x23, 0xeb, 0x62, 0xcc, 0xeb, 0x52, 0xff, 0x34, 0x6d, 0xff, 0x1b, 0x7f, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x6f, 0xff, 0x9d, 0x8f, 0xff, 0x9d, 0x97, 0xff, 0x9c, 0x9f, 0xff, 0x7c, 0x9f, 0xff, 0x7c, 0x9f, 0xff, 0xbd, 0x97, 0xff, 0x9d, 0x77, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x67, 0xff, 0x3b, 0x6f, 0xff, 0x79, 0x7e, 0xff, 0x8e, 0x4b, 0xff, 0x8a, 0x4a, 0xf7, 0x2c, 0x6b, 0x7f, 0xb5, 0xde, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xd6, 0x0a, 0x2b, 0x6b, 0x9f, 0xaa, 0x4a, 0xfd, 0x71, 0x5c, 0xff, 0xfb, 0x7e, 0xff, 0x5c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x6f, 0xff, 0x7c, 0x7f, 0xff, 0x9d, 0x87, 0xff, 0xbd, 0x8f, 0xff, 0xbd, 0x8f, 0xff, 0x9d, 0x87, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3b, 0x6f, 0xff, 0x79, 0x7e, 0xff, 0x6d, 0x4b, 0xff, 0x8a, 0x52, 0xee, 0xef, 0x8b, 0x59, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x94, 0x54, 0xaa, 0x52, 0xf3, 0xae, 0x4b, 0xff, 0xda, 0x7e, 0xff, 0x5c, 0x6f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x6f, 0xff, 0x5c, 0x6f, 0xff, 0x3b, 0x6f, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x77, 0xff, 0x38, 0x76, 0xff, 0x0b, 0x43, 0xff, 0x89, 0x52, 0xd8, 0x72, 0x9c, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xce, 0x17, 0xeb, 0x5a, 0xc7, 0x0b, 0x4b, 0xff, 0x17, 0x76, 0xff, 0x3c, 0x6f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x1b, 0x7f, 0xff, 0x54, 0x6d, 0xff, 0xca, 0x4a, 0xfc, 0xca, 0x62, 0x98, 0x75, 0xcd, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xae, 0x73, 0x72, 0xcb, 0x5a, 0xfa, 0xb2, 0x5c, 0xff, 0x1b, 0x7f, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x57, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x6f, 0xff, 0xfb, 0x86, 0xff, 0x50, 0x54, 0xff, 0x8a, 0x52, 0xf0, 0x4d, 0x73, 0x57, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0xbd, 0x1a, 0x2c, 0x5b, 0xd1, 0x4c, 0x53, 0xff, 0x79, 0x7e, 0xff, 0x5c, 0x77, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3b, 0x77, 0xff, 0x79, 0x86, 0xff, 0xcb, 0x4a, 0xfe, 0x8a, 0x52, 0xc4, 0x53, 0xad, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x10, 0x8c, 0x66, 0x0b, 0x53, 0xf9, 0x33, 0x6d, 0xff, 0x3b, 0x7f, 0xff, 0x9c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x1b, 0x7f, 0xff, 0x13, 0x6d, 0xff, 0xca, 0x52, 0xf7, 0x4c, 0x6b, 0x64, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xcd, 0x0e, 0xeb, 0x62, 0xc7, 0x2c, 0x53, 0xff, 0x99, 0x86, 0xff, 0x5c, 0x6f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x3c, 0x6f, 0xff, 0x99, 0x7e, 0xff, 0x4c, 0x4b, 0xff, 0xcb, 0x62, 0xc7, 0xd3, 0xa4, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x94, 0x47, 0xcb, 0x5a, 0xf5, 0xb2, 0x6c, 0xff, 0x1b, 0x7f, 0xff, 0x5c, 0x6f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x1b, 0x77, 0xff, 0xf3, 0x64, 0xff, 0xca, 0x52, 0xf5, 0x2c, 0x6b, 0x64, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x04, 0x4c, 0x6b, 0x99, 0xeb, 0x52, 0xff, 0x18, 0x7e, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x98, 0x76, 0xff, 0xca, 0x42, 0xfe, 0xca, 0x62, 0xb6, 0x34, 0xbd, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xc5, 0x17, 0xca, 0x5a, 0xd8, 0xad, 0x4b, 0xff, 0xda, 0x7e, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x57, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x3b, 0x67, 0xff, 0x3b, 0x6f, 0xff, 0x3b, 0x6f, 0xff, 0x3b, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1a, 0x77, 0xff, 0x50, 0x5c, 0xff, 0xaa, 0x5a, 0xe9, 0x30, 0x94, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x83, 0x4f, 0x8a, 0x52, 0xf5, 0xf3, 0x5c, 0xff, 0x1b, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1a, 0x6f, 0xff, 0x37, 0x76, 0xff, 0xf3, 0x5c, 0xff, 0x75, 0x6d, 0xff, 0xb9, 0x76, 0xff, 0x3b, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x3b, 0x6f, 0xff, 0x17, 0x7e, 0xff, 0xcb, 0x4a, 0xfb, 0x2c, 0x6b, 0x83, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0xeb, 0x62, 0x95, 0xaa, 0x4a, 0xfd, 0xf7, 0x6d, 0xff, 0x3b, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x6f, 0xff, 0xda, 0x76, 0xff, 0x59, 0x76, 0xff, 0xba, 0x76, 0xff, 0x3b, 0x77, 0xff, 0x3c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x6f, 0xff, 0x17, 0x6e, 0xff, 0xeb, 0x42, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x4a, 0xff, 0xae, 0x4b, 0xff, 0xba, 0x7e, 0xff, 0x5c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0xfa, 0x86, 0xff, 0xae, 0x53, 0xff, 0x89, 0x52, 0xd2, 0x94, 0xb5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xb5, 0x10, 0x8a, 0x5a, 0xcb, 0xeb, 0x42, 0xff, 0x99, 0x7e, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x1b, 0x6f, 0xff, 0x37, 0x6e, 0xff, 0x8d, 0x43, 0xff, 0x2c, 0x4b, 0xff, 0x4d, 0x43, 0xff, 0x13, 0x5d, 0xff, 0x1b, 0x77, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0xfb, 0x7e, 0xff, 0x30, 0x54, 0xff, 0x8a, 0x62, 0xff, 0x69, 0x62, 0xff, 0x89, 0x62, 0xff, 0xaa, 0x52, 0xff, 0x75, 0x75, 0xff, 0x3c, 0x7f, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x3b, 0x77, 0xff, 0x13, 0x6d, 0xff, 0xca, 0x52, 0xf4, 0x4d, 0x73, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xa4, 0x2b, 0x69, 0x52, 0xf0, 0xcf, 0x4b, 0xff, 0xfb, 0x7e, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0xda, 0x7e, 0xff, 0x4c, 0x43, 0xff, 0x89, 0x52, 0xff, 0x68, 0x5a, 0xff, 0x69, 0x52, 0xff, 0xca, 0x42, 0xff, 0xd6, 0x6d, 0xff, 0x5c, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x57, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0xdb, 0x7e, 0xff, 0x4c, 0x4b, 0xff, 0x89, 0x6a, 0xff, 0x67, 0x6a, 0xff, 0x87, 0x62, 0xff, 0xa9, 0x5a, 0xff, 0x30, 0x54, 0xff, 0x1b, 0x7f, 0xff, 0x5c, 0x6f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x6f, 0xff, 0x37, 0x7e, 0xff, 0xcb, 0x4a, 0xfd, 0x0c, 0x6b, 0x88, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x9c, 0x4c, 0xab, 0x52, 0xfa, 0xf3, 0x64, 0xff, 0x1b, 0x77, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x67, 0xff, 0x5c, 0x6f, 0xff, 0x37, 0x76, 0xff, 0xa9, 0x42, 0xff, 0x89, 0x6a, 0xff, 0x68, 0x6a, 0xff, 0x89, 0x62, 0xff, 0xcb, 0x62, 0xff, 0x91, 0x54, 0xff, 0x5b, 0x77, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0xfb, 0x76, 0xff, 0x99, 0x76, 0xff, 0x79, 0x76, 0xff, 0x79, 0x76, 0xff, 0xba, 0x76, 0xff, 0x1b, 0x77, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0xfb, 0x76, 0xff, 0xce, 0x4b, 0xff, 0xaa, 0x62, 0xff, 0x88, 0x6a, 0xff, 0x88, 0x6a, 0xff, 0xca, 0x62, 0xff, 0x71, 0x54, 0xff, 0x3b, 0x77, 0xff, 0x5c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0xda, 0x7e, 0xff, 0x6d, 0x53, 0xff, 0xaa, 0x5a, 0xc8, 0x16, 0xd6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x51, 0x94, 0x81, 0xab, 0x52, 0xfe, 0xf7, 0x75, 0xff, 0x1b, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x77, 0xff, 0xd6, 0x6d, 0xff, 0xcb, 0x4a, 0xff, 0x89, 0x6a, 0xff, 0x68, 0x6a, 0xff, 0x69, 0x62, 0xff, 0xaa, 0x5a, 0xff, 0x71, 0x54, 0xff, 0x3b, 0x6f, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x1b, 0x77, 0xff, 0xfb, 0x76, 0xff, 0x1b, 0x77, 0xff, 0xda, 0x7e, 0xff, 0x17, 0x76, 0xff, 0xce, 0x43, 0xff, 0x0b, 0x3b, 0xff, 0xeb, 0x42, 0xff, 0xca, 0x42, 0xff, 0x2b, 0x3b, 0xff, 0x74, 0x6d, 0xff, 0xb9, 0x86, 0xff, 0xfb, 0x76, 0xff, 0x1b, 0x6f, 0xff, 0x1b, 0x7f, 0xff, 0x33, 0x65, 0xff, 0xeb, 0x4a, 0xff, 0xca, 0x5a, 0xff, 0xca, 0x62, 0xff, 0x2c, 0x53, 0xff, 0x38, 0x76, 0xff, 0x3c, 0x77, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x5c, 0x67, 0xff, 0xfa, 0x76, 0xff, 0x70, 0x5c, 0xff, 0xaa, 0x52, 0xf0, 0x30, 0x94, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xcd, 0x17, 0x6d, 0x73, 0xc8, 0x2c, 0x53, 0xff, 0x79, 0x7e, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0x79, 0x76, 0xff, 0xeb, 0x3a, 0xff, 0x89, 0x5a, 0xff, 0x69, 0x62, 0xff, 0x89, 0x5a, 0xff, 0xca, 0x4a, 0xff, 0x55, 0x65, 0xff, 0x3b, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x1c, 0x77, 0xff, 0xfb, 0x7e, 0xff, 0x17, 0x76, 0xff, 0xf3, 0x64, 0xff, 0x10, 0x54, 0xff, 0x8e, 0x4b, 0xff, 0x2c, 0x53, 0xff, 0xaa, 0x52, 0xff, 0x69, 0x5a, 0xff, 0x68, 0x5a, 0xff, 0x48, 0x62, 0xff, 0x89, 0x5a, 0xff, 0x68, 0x3a, 0xff, 0xea, 0x32, 0xff, 0x0f, 0x4c, 0xff, 0x54, 0x65, 0xff, 0x99, 0x86, 0xff, 0xb9, 0x96, 0xff, 0x54, 0x75, 0xff, 0x2f, 0x54, 0xff, 0x10, 0x54, 0xff, 0xb6, 0x6d, 0xff, 0x3c, 0x7f, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x1b, 0x6f, 0xff, 0x95, 0x75, 0xff, 0x89, 0x4a, 0xfd, 0x6d, 0x7b, 0x7d, 0xff, 0xff, 0x03, 0xfb, 0xff, 0x07, 0x96, 0xb5, 0x13, 0xf4, 0xac, 0x22, 0x94, 0xb5, 0x13, 0x75, 0xfd, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xde, 0x07, 0xeb, 0x6a, 0x91, 0xca, 0x5a, 0xfc, 0x0e, 0x54, 0xff, 0xfb, 0x7e, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x1b, 0x77, 0xff, 0x13, 0x5d, 0xff, 0x0b, 0x43, 0xff, 0xaa, 0x4a, 0xff, 0xcb, 0x42, 0xff, 0x50, 0x54, 0xff, 0xdb, 0x7e, 0xff, 0x1b, 0x67, 0xff, 0xda, 0x7e, 0xff, 0xb6, 0x75, 0xff, 0x0f, 0x4c, 0xff, 0x2b, 0x4b, 0xff, 0x8d, 0x6b, 0xff, 0x50, 0x84, 0xff, 0x33, 0xa5, 0xff, 0xd2, 0x9c, 0xff, 0xaa, 0x62, 0xff, 0x89, 0x62, 0xff, 0x69, 0x6a, 0xff, 0x48, 0x62, 0xff, 0x48, 0x52, 0xff, 0x13, 0xa5, 0xff, 0xd6, 0xb5, 0xff, 0xb2, 0x8c, 0xff, 0x2c, 0x53, 0xff, 0x6c, 0x43, 0xff, 0x74, 0x7d, 0xff, 0xda, 0x96, 0xff, 0xfa, 0x86, 0xff, 0xfb, 0x7e, 0xff, 0x3c, 0x77, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x6f, 0xff, 0x78, 0x7e, 0xff, 0xca, 0x4a, 0xff, 0x89, 0x62, 0xd5, 0x8d, 0x7b, 0x74, 0x0b, 0x6b, 0xa2, 0xaa, 0x5a, 0xbb, 0xaa, 0x62, 0xb3, 0x0b, 0x63, 0x7f, 0xd3, 0x9c, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0xcf, 0x8b, 0x63, 0x69, 0x5a, 0xf3, 0xea, 0x62, 0xff, 0x70, 0x64, 0xff, 0x1b, 0x87, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x6f, 0xff, 0x1b, 0x7f, 0xff, 0x38, 0x76, 0xff, 0x75, 0x65, 0xff, 0xf7, 0x6d, 0xff, 0xfa, 0x7e, 0xff, 0x1b, 0x7f, 0xff, 0xb9, 0x76, 0xff, 0x91, 0x5c, 0xff, 0xca, 0x3a, 0xff, 0x90, 0x84, 0xff, 0xb9, 0xce, 0xff, 0x7c, 0xe7, 0xff, 0x9c, 0xe7, 0xff, 0x9c, 0xef, 0xff, 0x9c, 0xef, 0xff, 0x94, 0xb5, 0xff, 0xea, 0x62, 0xff, 0x89, 0x62, 0xff, 0x88, 0x5a, 0xff, 0x74, 0xad, 0xff, 0x7b, 0xe7, 0xff, 0x9c, 0xe7, 0xff, 0x9c, 0xef, 0xff, 0x3b, 0xdf, 0xff, 0x53, 0x9d, 0xff, 0xea, 0x3a, 0xff, 0xf2, 0x5c, 0xff, 0x1b, 0x7f, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x6f, 0xff, 0x78, 0x76, 0xff, 0x0b, 0x4b, 0xff, 0x69, 0x5a, 0xfa, 0x6d, 0x83, 0x90, 0x50, 0x94, 0x4a, 0x54, 0xad, 0x23, 0x75, 0xbd, 0x12, 0x18, 0xe7, 0x08, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x9a, 0xd6, 0x0b, 0x75, 0xbd, 0x12, 0x3c, 0xe7, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x84, 0x39, 0xaa, 0x62, 0xe0, 0xcb, 0x62, 0xff, 0xca, 0x5a, 0xff, 0xd2, 0x6c, 0xff, 0x3c, 0x87, 0xff, 0x5d, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0x1b, 0x77, 0xff, 0xfb, 0x76, 0xff, 0xfb, 0x76, 0xff, 0x1b, 0x77, 0xff, 0x1b, 0x6f, 0xff, 0x3c, 0x6f, 0xff, 0x3c, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0x3c, 0x77, 0xff, 0x3c, 0x6f, 0xff, 0x1b, 0x6f, 0xff, 0xb9, 0x7e, 0xff, 0x70, 0x54, 0xff, 0xca, 0x4a, 0xff, 0xd5, 0xb5, 0xff, 0x5a, 0xdf, 0xff, 0x5b, 0xe7, 0xff, 0x7b, 0xdf, 0xff, 0x9b, 0xdf, 0xff, 0x9b, 0xdf, 0xff, 0x7b, 0xe7, 0xff, 0x9c, 0xef, 0xff, 0xf9, 0xde, 0xff, 0x74, 0xad, 0xff, 0x77, 0xce, 0xff, 0x7b, 0xe7, 0xff, 0x7a, 0xdf, 0xff, 0x7a, 0xdf, 0xff, 0x7b, 0xdf, 0xff, 0x5a, 0xdf, 0xff, 0x7b, 0xe7, 0xff, 0xd6, 0xb5, 0xff, 0xeb, 0x4a, 0xff, 0x55, 0x65, 0xff, 0x1b, 0x77, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x99, 0x76, 0xff, 0xcf, 0x53, 0xff, 0x69, 0x5a, 0xf7, 0x92, 0xa4, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xad, 0x03, 0x4c, 0x6b, 0x56, 0x8a, 0x5a, 0xc3, 0x8a, 0x5a, 0xd7, 0xea, 0x62, 0xb5, 0x10, 0x84, 0x47, 0x7a, 0xd6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x14, 0xeb, 0x5a, 0xbf, 0xeb, 0x52, 0xff, 0x92, 0x84, 0xff, 0x2b, 0x53, 0xff, 0x54, 0x75, 0xff, 0x3c, 0x7f, 0xff, 0x7d, 0x5f, 0xff, 0x9d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x67, 0xff, 0x3b, 0x6f, 0xff, 0x13, 0x4d, 0xff, 0x71, 0x44, 0xff, 0x30, 0x44, 0xff, 0x50, 0x44, 0xff, 0x91, 0x4c, 0xff, 0xf2, 0x54, 0xff, 0xf7, 0x65, 0xff, 0x1c, 0x6f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x3b, 0x6f, 0xff, 0x1b, 0x7f, 0xff, 0xf3, 0x64, 0xff, 0xaa, 0x4a, 0xff, 0x16, 0xbe, 0xff, 0x7b, 0xdf, 0xff, 0x5a, 0xdf, 0xff, 0x7a, 0xdf, 0xff, 0x7a, 0xd7, 0xff, 0x9a, 0xd7, 0xff, 0x9a, 0xdf, 0xff, 0x9a, 0xdf, 0xff, 0x7b, 0xdf, 0xff, 0x7b, 0xdf, 0xff, 0x7b, 0xe7, 0xff, 0x5b, 0xdf, 0xff, 0x7b, 0xdf, 0xff, 0x9b, 0xd7, 0xff, 0x9a, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x7a, 0xdf, 0xff, 0x7a, 0xdf, 0xff, 0x7b, 0xe7, 0xff, 0xf2, 0x9c, 0xff, 0x0c, 0x43, 0xff, 0x38, 0x7e, 0xff, 0xdb, 0x7e, 0xff, 0x1b, 0x77, 0xff, 0x3b, 0x6f, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x1b, 0x77, 0xff, 0x75, 0x75, 0xff, 0xaa, 0x5a, 0xfa, 0xee, 0x8b, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x7b, 0x3d, 0x89, 0x52, 0xe8, 0xeb, 0x52, 0xff, 0x6d, 0x53, 0xff, 0xea, 0x4a, 0xff, 0x89, 0x4a, 0xec, 0x0c, 0x63, 0x76, 0x75, 0xad, 0x06, 0xff, 0xff, 0x03, 0x4d, 0x6b, 0x7e, 0xcb, 0x52, 0xf9, 0xb2, 0x6c, 0xff, 0x14, 0x7d, 0xff, 0x2b, 0x43, 0xff, 0x75, 0x6d, 0xff, 0x3c, 0x77, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0x34, 0x4d, 0xff, 0xb2, 0x4c, 0xff, 0x91, 0x54, 0xff, 0x91, 0x54, 0xff, 0x70, 0x54, 0xff, 0x0f, 0x44, 0xff, 0xce, 0x2b, 0xff, 0x18, 0x56, 0xff, 0x3c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x6f, 0xff, 0x3c, 0x77, 0xff, 0xda, 0x86, 0xff, 0x38, 0x86, 0xff, 0xeb, 0x4a, 0xff, 0x54, 0xad, 0xff, 0x7b, 0xe7, 0xff, 0x9a, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x9a, 0xdf, 0xff, 0x7b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x9c, 0xdf, 0xff, 0x9b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x9a, 0xd7, 0xff, 0x7a, 0xdf, 0xff, 0xf8, 0xd6, 0xff, 0x13, 0xa5, 0xff, 0xaa, 0x52, 0xff, 0xeb, 0x42, 0xff, 0x6d, 0x33, 0xff, 0x30, 0x3c, 0xff, 0xb6, 0x55, 0xff, 0x1b, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x77, 0xff, 0xb6, 0x75, 0xff, 0x8a, 0x4a, 0xfe, 0x4c, 0x73, 0x9b, 0x74, 0xb5, 0x19, 0xbb, 0xde, 0x06, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x04, 0xaa, 0x62, 0x99, 0x89, 0x42, 0xfe, 0x74, 0x75, 0xff, 0x99, 0x86, 0xff, 0xd6, 0x75, 0xff, 0x0c, 0x43, 0xff, 0x69, 0x4a, 0xee, 0x8d, 0x7b, 0x5a, 0x71, 0x94, 0x2f, 0x89, 0x4a, 0xe3, 0xae, 0x53, 0xff, 0x58, 0x86, 0xff, 0x34, 0x6d, 0xff, 0x0b, 0x33, 0xff, 0x75, 0x75, 0xff, 0x1c, 0x77, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x77, 0xff, 0x1b, 0x77, 0xff, 0x1b, 0x77, 0xff, 0x1b, 0x77, 0xff, 0x1b, 0x7f, 0xff, 0xda, 0x76, 0xff, 0xfb, 0x6e, 0xff, 0x1c, 0x6f, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0x79, 0x66, 0xff, 0xf3, 0x4c, 0xff, 0x30, 0x54, 0xff, 0x6d, 0x53, 0xff, 0xca, 0x5a, 0xff, 0xce, 0x7b, 0xff, 0x15, 0xae, 0xff, 0x9b, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x9a, 0xcf, 0xff, 0x7a, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x7b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0xbc, 0xd7, 0xff, 0x9c, 0xd7, 0xff, 0xbc, 0xd7, 0xff, 0xbc, 0xdf, 0xff, 0x9b, 0xd7, 0xff, 0x7b, 0xdf, 0xff, 0x7b, 0xd7, 0xff, 0x9a, 0xdf, 0xff, 0x9a, 0xdf, 0xff, 0xd9, 0xd6, 0xff, 0x95, 0xb5, 0xff, 0xae, 0x73, 0xff, 0x6d, 0x5b, 0xff, 0xf6, 0x85, 0xff, 0xd6, 0x65, 0xff, 0x55, 0x4d, 0xff, 0xfb, 0x66, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x6f, 0xff, 0xb5, 0x65, 0xff, 0xca, 0x4a, 0xff, 0x68, 0x5a, 0xee, 0x89, 0x5a, 0xab, 0x2c, 0x6b, 0x94, 0xae, 0x83, 0x69, 0x76, 0xbd, 0x1c, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0xce, 0x12, 0x68, 0x52, 0xd7, 0x2c, 0x4b, 0xff, 0x99, 0x7e, 0xff, 0x1b, 0x6f, 0xff, 0x1b, 0x6f, 0xff, 0xf7, 0x75, 0xff, 0xcb, 0x42, 0xff, 0x89, 0x52, 0xde, 0x0b, 0x6b, 0xba, 0xca, 0x42, 0xfc, 0x17, 0x7e, 0xff, 0xba, 0x76, 0xff, 0x75, 0x65, 0xff, 0x0c, 0x33, 0xff, 0x55, 0x6d, 0xff, 0x1c, 0x77, 0xff, 0x7d, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x3b, 0x6f, 0xff, 0x3c, 0x6f, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0xd6, 0x55, 0xff, 0x34, 0x5d, 0xff, 0x54, 0x7d, 0xff, 0x8d, 0x63, 0xff, 0xce, 0x83, 0xff, 0xb5, 0xb5, 0xff, 0xb8, 0xc6, 0xff, 0x7b, 0xdf, 0xff, 0x5a, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x9a, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x7b, 0xcf, 0xff, 0x9c, 0xcf, 0xff, 0x5b, 0xc7, 0xff, 0x1a, 0xbf, 0xff, 0x1a, 0xbf, 0xff, 0x7c, 0xc7, 0xff, 0x9c, 0xd7, 0xff, 0x7b, 0xd7, 0xff, 0x7b, 0xd7, 0xff, 0x7b, 0xd7, 0xff, 0x9b, 0xdf, 0xff, 0x7b, 0xe7, 0xff, 0x7b, 0xe7, 0xff, 0x13, 0x9d, 0xff, 0x8d, 0x53, 0xff, 0xda, 0x86, 0xff, 0x3b, 0x6f, 0xff, 0x3c, 0x6f, 0xff, 0x3c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0xb9, 0x7e, 0xff, 0xce, 0x5b, 0xff, 0x2b, 0x6b, 0xd4, 0x75, 0xbd, 0x28, 0x8d, 0x7b, 0x43, 0xeb, 0x6a, 0x97, 0xaa, 0x62, 0xab, 0xef, 0x83, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xad, 0x1a, 0x69, 0x4a, 0xe6, 0xae, 0x4b, 0xff, 0xdb, 0x7e, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0xfb, 0x7e, 0xff, 0xb2, 0x5c, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xfe, 0x30, 0x54, 0xff, 0xfb, 0x7e, 0xff, 0xfa, 0x6e, 0xff, 0x95, 0x5d, 0xff, 0x4d, 0x3b, 0xff, 0x34, 0x65, 0xff, 0x3b, 0x6f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x6f, 0xff, 0x3c, 0x7f, 0xff, 0xda, 0x7e, 0xff, 0x17, 0x6e, 0xff, 0x75, 0x4d, 0xff, 0xda, 0x66, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x6f, 0xff, 0x3b, 0x77, 0xff, 0xd9, 0x8e, 0xff, 0xce, 0x63, 0xff, 0x33, 0xa5, 0xff, 0x7b, 0xe7, 0xff, 0x7b, 0xdf, 0xff, 0x7b, 0xdf, 0xff, 0x7a, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x7a, 0xd7, 0xff, 0x7a, 0xcf, 0xff, 0x7b, 0xc7, 0xff, 0xf9, 0xb6, 0xff, 0x98, 0xa6, 0xff, 0x99, 0xa6, 0xff, 0x98, 0xa6, 0xff, 0x99, 0xa6, 0xff, 0x1a, 0xb7, 0xff, 0x7c, 0xc7, 0xff, 0x9c, 0xd7, 0xff, 0x7b, 0xd7, 0xff, 0x7b, 0xd7, 0xff, 0x39, 0xcf, 0xff, 0x32, 0x9d, 0xff, 0x91, 0x94, 0xff, 0xae, 0x5b, 0xff, 0xfb, 0x8e, 0xff, 0x3b, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0xfa, 0x76, 0xff, 0x50, 0x5c, 0xff, 0x2b, 0x63, 0xd9, 0x38, 0xd6, 0x11, 0x00, 0x00, 0x00, 0x7a, 0xd6, 0x05, 0x8e, 0x7b, 0x29, 0x31, 0x8c, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x57, 0xde, 0x12, 0x13, 0xa5, 0x2b, 0x71, 0x8c, 0x46, 0x91, 0x9c, 0x2e, 0x18, 0xde, 0x0c, 0x74, 0xb5, 0x21, 0x69, 0x52, 0xea, 0xae, 0x53, 0xff, 0xdb, 0x7e, 0xff, 0x3c, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0x38, 0x76, 0xff, 0xeb, 0x42, 0xff, 0xeb, 0x42, 0xff, 0xb6, 0x6d, 0xff, 0x3c, 0x77, 0xff, 0xfb, 0x66, 0xff, 0xb6, 0x5d, 0xff, 0x10, 0x4c, 0xff, 0x13, 0x55, 0xff, 0x1b, 0x6f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x67, 0xff, 0x5b, 0x67, 0xff, 0x3b, 0x7f, 0xff, 0x79, 0x7e, 0xff, 0x14, 0x65, 0xff, 0xf0, 0x43, 0xff, 0x8e, 0x33, 0xff, 0xf4, 0x54, 0xff, 0xdb, 0x6e, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x5b, 0x67, 0xff, 0xd9, 0x7e, 0xff, 0xee, 0x5b, 0xff, 0x33, 0xa5, 0xff, 0x57, 0xc6, 0xff, 0xf9, 0xce, 0xff, 0x9b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x9a, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x9b, 0xd7, 0xff, 0x5b, 0xc7, 0xff, 0xd9, 0xb6, 0xff, 0x57, 0x9e, 0xff, 0xf6, 0x95, 0xff, 0x33, 0x7d, 0xff, 0x37, 0x9e, 0xff, 0x78, 0x9e, 0xff, 0x78, 0x9e, 0xff, 0xb9, 0xa6, 0xff, 0x3a, 0xbf, 0xff, 0x7c, 0xcf, 0xff, 0x5b, 0xd7, 0xff, 0x19, 0xcf, 0xff, 0x94, 0xad, 0xff, 0xca, 0x5a, 0xff, 0x8d, 0x5b, 0xff, 0x58, 0x8e, 0xff, 0x3c, 0x7f, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x67, 0xff, 0x1a, 0x77, 0xff, 0xf2, 0x5c, 0xff, 0x0b, 0x5b, 0xe0, 0xb3, 0xa4, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x91, 0x94, 0x1b, 0x4c, 0x73, 0x7e, 0xcb, 0x62, 0xd0, 0xeb, 0x5a, 0xea, 0xeb, 0x52, 0xf3, 0xca, 0x5a, 0xeb, 0xeb, 0x62, 0xc2, 0xae, 0x83, 0x93, 0x89, 0x5a, 0xf5, 0x8d, 0x53, 0xff, 0xda, 0x7e, 0xff, 0x5c, 0x67, 0xff, 0x7d, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x79, 0x76, 0xff, 0x0c, 0x43, 0xff, 0x8e, 0x43, 0xff, 0xda, 0x76, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0xf6, 0x5d, 0xff, 0x91, 0x4c, 0xff, 0x13, 0x4d, 0xff, 0x1b, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0xfa, 0x76, 0xff, 0xf3, 0x54, 0xff, 0x8e, 0x3b, 0xff, 0x30, 0x44, 0xff, 0xb6, 0x65, 0xff, 0xfb, 0x7e, 0xff, 0x3c, 0x77, 0xff, 0x5c, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x1b, 0x6f, 0xff, 0xb8, 0x7e, 0xff, 0xee, 0x63, 0xff, 0x2b, 0x63, 0xff, 0x0e, 0x7c, 0xff, 0xb9, 0xc6, 0xff, 0x9c, 0xd7, 0xff, 0x9b, 0xcf, 0xff, 0x9b, 0xcf, 0xff, 0x9b, 0xcf, 0xff, 0x5b, 0xbf, 0xff, 0xb8, 0xa6, 0xff, 0x36, 0x96, 0xff, 0xd5, 0x8d, 0xff, 0x4c, 0x53, 0xff, 0x0b, 0x5b, 0xff, 0xae, 0x6b, 0xff, 0xb5, 0x9d, 0xff, 0x37, 0xa6, 0xff, 0x37, 0x9e, 0xff, 0x37, 0x96, 0xff, 0x78, 0xa6, 0xff, 0x98, 0xb6, 0xff, 0x98, 0xbe, 0xff, 0x74, 0xa5, 0xff, 0x0b, 0x53, 0xff, 0x2f, 0x5c, 0xff, 0xef, 0x43, 0xff, 0xf7, 0x6d, 0xff, 0x3c, 0x77, 0xff, 0x5d, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x9c, 0x5f, 0xff, 0x3b, 0x6f, 0xff, 0x54, 0x65, 0xff, 0x0b, 0x5b, 0xea, 0x0f, 0x8c, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xcf, 0x09, 0x18, 0xbe, 0x2d, 0xd7, 0xb5, 0x5b, 0xb7, 0xb5, 0x61, 0xf7, 0xbd, 0x3c, 0xbb, 0xde, 0x12, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xaa, 0x5a, 0xc0, 0xcb, 0x52, 0xfa, 0x0c, 0x4b, 0xff, 0x71, 0x5c, 0xff, 0x13, 0x6d, 0xff, 0xd2, 0x64, 0xff, 0x6d, 0x4b, 0xff, 0xca, 0x52, 0xfe, 0xca, 0x5a, 0xff, 0x4c, 0x4b, 0xff, 0xba, 0x7e, 0xff, 0x5c, 0x67, 0xff, 0x9d, 0x67, 0xff, 0x5c, 0x6f, 0xff, 0xd6, 0x6d, 0xff, 0xeb, 0x42, 0xff, 0xb1, 0x54, 0xff, 0x3b, 0x77, 0xff, 0x7c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x79, 0x66, 0xff, 0xf3, 0x4c, 0xff, 0xd2, 0x44, 0xff, 0xdb, 0x6e, 0xff, 0x3c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0xb6, 0x55, 0xff, 0xaf, 0x2b, 0xff, 0x96, 0x65, 0xff, 0xfb, 0x7e, 0xff, 0x3c, 0x77, 0xff, 0x5c, 0x6f, 0xff, 0x7d, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x57, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x6f, 0xff, 0x59, 0x76, 0xff, 0x0f, 0x44, 0xff, 0xeb, 0x42, 0xff, 0xea, 0x52, 0xff, 0xf6, 0xb5, 0xff, 0xda, 0xce, 0xff, 0xfa, 0xbe, 0xff, 0x1a, 0xb7, 0xff, 0xf9, 0xae, 0xff, 0xb8, 0xae, 0xff, 0x57, 0xa6, 0xff, 0x57, 0xa6, 0xff, 0x33, 0x85, 0xff, 0x4c, 0x4b, 0xff, 0x2c, 0x4b, 0xff, 0x30, 0x6c, 0xff, 0x6c, 0x53, 0xff, 0x2c, 0x53, 0xff, 0x71, 0x7c, 0xff, 0x74, 0x95, 0xff, 0xd5, 0x9d, 0xff, 0xd5, 0x9d, 0xff, 0x54, 0x9d, 0xff, 0x50, 0x84, 0xff, 0x2c, 0x53, 0xff, 0x91, 0x5c, 0xff, 0xfa, 0x8e, 0xff, 0x58, 0x76, 0xff, 0x92, 0x44, 0xff, 0x5a, 0x66, 0xff, 0x3d, 0x6f, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x67, 0xff, 0x3b, 0x77, 0xff, 0x95, 0x75, 0xff, 0x0b, 0x5b, 0xef, 0xce, 0x83, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xf7, 0xbd, 0x25, 0x76, 0xad, 0x9c, 0x76, 0xad, 0xe9, 0xb7, 0xb5, 0xfb, 0xb7, 0xb5, 0xfb, 0xb7, 0xb5, 0xf2, 0xb6, 0xb5, 0xbc, 0x37, 0xbe, 0x4b, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xab, 0x4a, 0xfe, 0x30, 0x54, 0xff, 0x79, 0x7e, 0xff, 0xfb, 0x76, 0xff, 0x1c, 0x77, 0xff, 0x3c, 0x7f, 0xff, 0xfa, 0x7e, 0xff, 0x54, 0x6d, 0xff, 0x2c, 0x43, 0xff, 0x4c, 0x3b, 0xff, 0x79, 0x76, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x67, 0xff, 0x5b, 0x7f, 0xff, 0x34, 0x65, 0xff, 0x2c, 0x43, 0xff, 0xd5, 0x6d, 0xff, 0x3b, 0x6f, 0xff, 0x7d, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0xfb, 0x66, 0xff, 0x96, 0x55, 0xff, 0xf3, 0x34, 0xff, 0xda, 0x66, 0xff, 0x5d, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0xfb, 0x66, 0xff, 0xfb, 0x6e, 0xff, 0x1c, 0x77, 0xff, 0x5c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5b, 0x5f, 0xff, 0x79, 0x66, 0xff, 0xcf, 0x33, 0xff, 0x54, 0x5d, 0xff, 0x58, 0x8e, 0xff, 0xad, 0x4b, 0xff, 0x4c, 0x5b, 0xff, 0xb6, 0xad, 0xff, 0x99, 0xc6, 0xff, 0x99, 0xbe, 0xff, 0xb9, 0xb6, 0xff, 0x58, 0xae, 0xff, 0x74, 0x9d, 0xff, 0xce, 0x63, 0xff, 0x0c, 0x4b, 0xff, 0xcf, 0x5b, 0xff, 0x34, 0x75, 0xff, 0x95, 0x6d, 0xff, 0x95, 0x6d, 0xff, 0x91, 0x5c, 0xff, 0x6d, 0x53, 0xff, 0x0b, 0x5b, 0xff, 0x2b, 0x63, 0xff, 0x2b, 0x63, 0xff, 0x0b, 0x6b, 0xff, 0x0b, 0x63, 0xff, 0xcf, 0x53, 0xff, 0xda, 0x86, 0xff, 0x3b, 0x77, 0xff, 0x3b, 0x77, 0xff, 0x1c, 0x77, 0xff, 0xdb, 0x6e, 0xff, 0x1c, 0x77, 0xff, 0x1c, 0x7f, 0xff, 0x1c, 0x7f, 0xff, 0x1c, 0x7f, 0xff, 0x3c, 0x77, 0xff, 0x1b, 0x7f, 0xff, 0xd7, 0x85, 0xff, 0x0c, 0x5b, 0xf0, 0x8e, 0x83, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x1e, 0x75, 0xad, 0xbe, 0x18, 0xbe, 0xfd, 0x7d, 0xef, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0x5d, 0xe7, 0xff, 0x18, 0xbe, 0xff, 0xb6, 0xad, 0xea, 0xf8, 0xbd, 0x60, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xec, 0x4a, 0xff, 0x18, 0x7e, 0xff, 0x1b, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x67, 0xff, 0x5c, 0x7f, 0xff, 0x58, 0x7e, 0xff, 0x10, 0x3c, 0xff, 0x59, 0x66, 0xff, 0x5d, 0x67, 0xff, 0x7d, 0x67, 0xff, 0x3b, 0x7f, 0xff, 0x91, 0x5c, 0xff, 0x4c, 0x3b, 0xff, 0xb9, 0x76, 0xff, 0x5c, 0x6f, 0xff, 0x5d, 0x67, 0xff, 0x7c, 0x57, 0xff, 0x3c, 0x67, 0xff, 0x9a, 0x66, 0xff, 0xf7, 0x4d, 0xff, 0xfb, 0x66, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x57, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5b, 0x67, 0xff, 0xb6, 0x4d, 0xff, 0x18, 0x66, 0xff, 0x3b, 0x77, 0xff, 0x3b, 0x77, 0xff, 0x79, 0x86, 0xff, 0xef, 0x53, 0xff, 0xeb, 0x52, 0xff, 0x4c, 0x6b, 0xff, 0xee, 0x7b, 0xff, 0xce, 0x73, 0xff, 0x0c, 0x63, 0xff, 0xeb, 0x5a, 0xff, 0x0c, 0x53, 0xff, 0x71, 0x64, 0xff, 0x76, 0x6d, 0xff, 0xb6, 0x65, 0xff, 0xd7, 0x55, 0xff, 0xf7, 0x5d, 0xff, 0xf7, 0x75, 0xff, 0xf3, 0x7c, 0xff, 0x4c, 0x73, 0xff, 0xf2, 0xac, 0xff, 0x54, 0xb5, 0xff, 0xd7, 0xc5, 0xff, 0xef, 0x83, 0xff, 0xf3, 0x64, 0xff, 0x1c, 0x7f, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x3c, 0x77, 0xff, 0xdb, 0x86, 0xff, 0x9a, 0x96, 0xff, 0x5a, 0x96, 0xff, 0xba, 0x8e, 0xff, 0xfb, 0x8e, 0xff, 0xf7, 0x8d, 0xff, 0x0c, 0x5b, 0xf2, 0xcf, 0x7b, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x06, 0xb6, 0xad, 0x8c, 0x38, 0xbe, 0xfc, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0x59, 0xc6, 0xff, 0x97, 0xad, 0xd5, 0x7a, 0xd6, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x2d, 0x53, 0xff, 0x9a, 0x7e, 0xff, 0x3c, 0x5f, 0xff, 0x7c, 0x57, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0x1c, 0x6f, 0xff, 0x1c, 0x67, 0xff, 0x7d, 0x67, 0xff, 0x7d, 0x67, 0xff, 0x3b, 0x7f, 0xff, 0x2f, 0x4c, 0xff, 0xae, 0x43, 0xff, 0xfa, 0x76, 0xff, 0x5c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x1b, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x77, 0xff, 0xda, 0x86, 0xff, 0x8e, 0x53, 0xff, 0x0b, 0x6b, 0xff, 0x2f, 0x94, 0xff, 0x51, 0x9c, 0xff, 0xf4, 0xb4, 0xff, 0x8e, 0x7b, 0xff, 0x51, 0x6c, 0xff, 0x96, 0x6d, 0xff, 0xf7, 0x5d, 0xff, 0x38, 0x56, 0xff, 0x58, 0x56, 0xff, 0x99, 0x5e, 0xff, 0x99, 0x6e, 0xff, 0xd6, 0x85, 0xff, 0x2c, 0x6b, 0xff, 0x1c, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x30, 0x8c, 0xff, 0x54, 0x6d, 0xff, 0x1b, 0x6f, 0xff, 0x5d, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0xdb, 0x8e, 0xff, 0x5a, 0xa6, 0xff, 0x59, 0xae, 0xff, 0x18, 0x9e, 0xff, 0x38, 0x9e, 0xff, 0xf8, 0xa5, 0xff, 0xf3, 0x94, 0xf9, 0x55, 0xa5, 0x8b, 0x59, 0xc6, 0x33, 0x7a, 0xce, 0x35, 0x5a, 0xce, 0x41, 0x39, 0xbe, 0x67, 0xb7, 0xad, 0xe8, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xef, 0xff, 0xb7, 0xad, 0xf7, 0xd7, 0xb5, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x2c, 0x4b, 0xff, 0x59, 0x7e, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x1a, 0x77, 0xff, 0xce, 0x43, 0xff, 0x10, 0x4c, 0xff, 0x1b, 0x77, 0xff, 0x5c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x1b, 0x77, 0xff, 0x13, 0x65, 0xff, 0x4d, 0x6b, 0xff, 0x5c, 0xf7, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0x51, 0x94, 0xff, 0xb2, 0x64, 0xff, 0x39, 0x6e, 0xff, 0xdb, 0x66, 0xff, 0x1c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0x79, 0x86, 0xff, 0xeb, 0x52, 0xff, 0xda, 0xde, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x0c, 0x5b, 0xff, 0xd6, 0x75, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x6f, 0xff, 0xdb, 0x86, 0xff, 0x7a, 0x9e, 0xff, 0xbb, 0xbe, 0xff, 0x9e, 0xdf, 0xff, 0xdc, 0xc6, 0xff, 0x18, 0xb6, 0xff, 0xd7, 0xad, 0xff, 0xb7, 0xad, 0xfa, 0x97, 0xad, 0xf0, 0x96, 0xad, 0xf0, 0x97, 0xad, 0xf3, 0xb7, 0xad, 0xfa, 0xb7, 0xad, 0xff, 0xbf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xd7, 0xb5, 0xfb, 0xd7, 0xb5, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xeb, 0x4a, 0xff, 0x96, 0x6d, 0xff, 0xfb, 0x76, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0xfa, 0x76, 0xff, 0x6d, 0x33, 0xff, 0x92, 0x4c, 0xff, 0x1b, 0x77, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1b, 0x67, 0xff, 0x38, 0x76, 0xff, 0xeb, 0x42, 0xff, 0x99, 0xde, 0xff, 0xde, 0xff, 0xff, 0xde, 0xff, 0xff, 0xf0, 0x7b, 0xff, 0x14, 0x6d, 0xff, 0xdb, 0x76, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x7d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x6f, 0xff, 0xda, 0x86, 0xff, 0x0c, 0x4b, 0xff, 0x59, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x99, 0xd6, 0xff, 0xaa, 0x3a, 0xff, 0x79, 0x7e, 0xff, 0x5c, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x1c, 0x77, 0xff, 0xbb, 0x8e, 0xff, 0x5a, 0xa6, 0xff, 0x3d, 0xd7, 0xff, 0xbf, 0xe7, 0xff, 0xbf, 0xe7, 0xff, 0x9e, 0xdf, 0xff, 0x5d, 0xdf, 0xff, 0xfc, 0xd6, 0xff, 0xdb, 0xd6, 0xff, 0xdb, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0x3d, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xd7, 0xb5, 0xfa, 0xd8, 0xb5, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xaa, 0x52, 0xf4, 0x30, 0x54, 0xff, 0x9a, 0x76, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x57, 0xff, 0x7c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1b, 0x77, 0xff, 0xf0, 0x3b, 0xff, 0xf3, 0x4c, 0xff, 0x3c, 0x6f, 0xff, 0x5c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0xda, 0x7e, 0xff, 0xae, 0x4b, 0xff, 0x14, 0xad, 0xff, 0xfe, 0xff, 0xff, 0xbd, 0xf7, 0xff, 0xae, 0x6b, 0xff, 0x75, 0x6d, 0xff, 0x1c, 0x6f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x1b, 0x87, 0xff, 0x6d, 0x4b, 0xff, 0x96, 0xbd, 0xff, 0xde, 0xff, 0xff, 0x13, 0xa5, 0xff, 0xce, 0x4b, 0xff, 0xda, 0x7e, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x3d, 0x6f, 0xff, 0xfc, 0x7e, 0xff, 0x9a, 0x96, 0xff, 0x5a, 0xae, 0xff, 0x7e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0xbe, 0xdf, 0xff, 0xdf, 0xef, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0xff, 0x76, 0xad, 0xfa, 0x39, 0xc6, 0x63, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 
-  0xcb, 0x62, 0xa9, 0xec, 0x4a, 0xfd, 0x75, 0x6d, 0xff, 0x99, 0x66, 0xff, 0xfb, 0x5e, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x6f, 0xff, 0xb7, 0x5d, 0xff, 0xd7, 0x55, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x1b, 0x77, 0xff, 0x34, 0x65, 0xff, 0x2c, 0x63, 0xff, 0x7c, 0xf7, 0xff, 0x9d, 0xf7, 0xff, 0x4d, 0x63, 0xff, 0xd6, 0x6d, 0xff, 0x3b, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x67, 0xff, 0x3c, 0x7f, 0xff, 0x91, 0x5c, 0xff, 0xb2, 0x9c, 0xff, 0x3c, 0xef, 0xff, 0x2c, 0x53, 0xff, 0x54, 0x65, 0xff, 0x1c, 0x77, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x3d, 0x6f, 0xff, 0xdb, 0x7e, 0xff, 0x5a, 0x96, 0xff, 0x5a, 0xae, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xdf, 0xff, 0x9e, 0xe7, 0xff, 0xdf, 0xef, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xe7, 0xff, 0x59, 0xc6, 0xff, 0x96, 0xb5, 0xdf, 0x18, 0xc6, 0x5b, 0xff, 0xff, 0x03, 
-  0x2c, 0x6b, 0x2f, 0xab, 0x5a, 0xd7, 0x6d, 0x4b, 0xff, 0x95, 0x6d, 0xff, 0x18, 0x66, 0xff, 0x59, 0x5e, 0xff, 0xda, 0x5e, 0xff, 0x1b, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x6f, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3b, 0x67, 0xff, 0x99, 0x7e, 0xff, 0xeb, 0x42, 0xff, 0x95, 0xb5, 0xff, 0x3c, 0xef, 0xff, 0x2c, 0x53, 0xff, 0x38, 0x76, 0xff, 0x3c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3c, 0x77, 0xff, 0x75, 0x6d, 0xff, 0xae, 0x6b, 0xff, 0x71, 0x8c, 0xff, 0xaf, 0x4b, 0xff, 0xda, 0x7e, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3d, 0x67, 0xff, 0x1c, 0x6f, 0xff, 0xbb, 0x7e, 0xff, 0x39, 0x96, 0xff, 0x19, 0xa6, 0xff, 0x1d, 0xcf, 0xff, 0x7e, 0xdf, 0xff, 0x7e, 0xdf, 0xff, 0xbf, 0xef, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xd6, 0xff, 0xd7, 0xb5, 0xe1, 0x58, 0xc6, 0x3b, 
-  0xff, 0xff, 0x02, 0x2c, 0x73, 0x56, 0xaa, 0x52, 0xea, 0x2c, 0x43, 0xff, 0x34, 0x6d, 0xff, 0xd7, 0x65, 0xff, 0x38, 0x56, 0xff, 0x79, 0x4e, 0xff, 0xba, 0x56, 0xff, 0xdb, 0x5e, 0xff, 0xfc, 0x5e, 0xff, 0x3c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1b, 0x77, 0xff, 0xf3, 0x64, 0xff, 0x0c, 0x5b, 0xff, 0xd3, 0x9c, 0xff, 0x2c, 0x4b, 0xff, 0x99, 0x76, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x57, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0xda, 0x7e, 0xff, 0x10, 0x54, 0xff, 0xef, 0x4b, 0xff, 0x79, 0x7e, 0xff, 0x5c, 0x6f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x57, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x1c, 0x77, 0xff, 0x59, 0x86, 0xff, 0xf8, 0x9d, 0xff, 0xd8, 0xad, 0xff, 0x9b, 0xc6, 0xff, 0x5e, 0xdf, 0xff, 0x7e, 0xdf, 0xff, 0x9e, 0xe7, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xce, 0xfe, 0xf7, 0xbd, 0xb1, 
-  0x00, 0x00, 0x00, 0x18, 0xc6, 0x04, 0xcb, 0x5a, 0x70, 0x8a, 0x52, 0xeb, 0xcb, 0x4a, 0xff, 0x71, 0x64, 0xff, 0x75, 0x6d, 0xff, 0xf7, 0x65, 0xff, 0x38, 0x56, 0xff, 0x38, 0x56, 0xff, 0x59, 0x56, 0xff, 0xba, 0x56, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x57, 0xff, 0x7c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x6f, 0xff, 0xda, 0x7e, 0xff, 0x71, 0x54, 0xff, 0xaf, 0x4b, 0xff, 0xf3, 0x54, 0xff, 0x1b, 0x77, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x57, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x3c, 0x6f, 0xff, 0x1c, 0x77, 0xff, 0x3c, 0x77, 0xff, 0x5c, 0x77, 0xff, 0x5c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3d, 0x5f, 0xff, 0x3d, 0x67, 0xff, 0x1b, 0x6f, 0xff, 0xd6, 0x6d, 0xff, 0x8e, 0x5b, 0xff, 0x34, 0xa5, 0xd9, 0xf8, 0xb5, 0xd3, 0x19, 0xb6, 0xfe, 0xfc, 0xce, 0xff, 0x5e, 0xdf, 0xff, 0x7e, 0xe7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0xff, 0xd7, 0xb5, 0xf2, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x04, 0x4d, 0x6b, 0x53, 0x69, 0x4a, 0xd2, 0xaa, 0x42, 0xfa, 0x4c, 0x4b, 0xff, 0x50, 0x54, 0xff, 0x34, 0x65, 0xff, 0x96, 0x6d, 0xff, 0xd6, 0x6d, 0xff, 0x58, 0x5e, 0xff, 0xba, 0x5e, 0xff, 0x1b, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x6f, 0xff, 0x1b, 0x77, 0xff, 0xda, 0x76, 0xff, 0xfb, 0x76, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x57, 0xff, 0x7c, 0x57, 0xff, 0x7c, 0x57, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3d, 0x5f, 0xff, 0x3d, 0x67, 0xff, 0xba, 0x66, 0xff, 0x54, 0x65, 0xff, 0xaa, 0x4a, 0xfe, 0x8d, 0x73, 0x8f, 0x9a, 0xce, 0x41, 0xd7, 0xad, 0xf4, 0xf8, 0xad, 0xff, 0x5e, 0xdf, 0xff, 0x5d, 0xdf, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0xff, 0xb7, 0xb5, 0xfb, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xcf, 0x83, 0x1a, 0xec, 0x62, 0x6f, 0x89, 0x4a, 0xcf, 0xa9, 0x4a, 0xf7, 0xca, 0x42, 0xfe, 0x6d, 0x53, 0xff, 0x50, 0x64, 0xff, 0x74, 0x6d, 0xff, 0x59, 0x6e, 0xff, 0xba, 0x66, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x57, 0xff, 0x7c, 0x57, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x57, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3d, 0x5f, 0xff, 0xfb, 0x5e, 0xff, 0x17, 0x5e, 0xff, 0x92, 0x5c, 0xff, 0x89, 0x4a, 0xfc, 0xce, 0x7b, 0x71, 0x38, 0xbe, 0x55, 0xf8, 0xb5, 0xfa, 0x5e, 0xdf, 0xff, 0x7e, 0xdf, 0xff, 0x9e, 0xe7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xef, 0xff, 0xfc, 0xd6, 0xff, 0xb7, 0xad, 0xfb, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xd1, 0x9c, 0x16, 0xaa, 0x5a, 0x60, 0x8a, 0x52, 0xad, 0xaa, 0x5a, 0xe2, 0x0b, 0x5b, 0xf9, 0x4d, 0x4b, 0xff, 0x55, 0x6d, 0xff, 0x7a, 0x6e, 0xff, 0x3c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x99, 0x56, 0xff, 0xb6, 0x5d, 0xff, 0xae, 0x53, 0xff, 0x69, 0x4a, 0xf4, 0x91, 0x94, 0x3e, 0xf7, 0xb5, 0x8c, 0x39, 0xbe, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xe7, 0xff, 0xdf, 0xef, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xff, 0xbf, 0xef, 0xff, 0xdf, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xdf, 0xef, 0xff, 0x9e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x9a, 0xc6, 0xff, 0x96, 0xad, 0xed, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xad, 0x06, 0xad, 0x7b, 0x26, 0x8d, 0x73, 0x6a, 0x0c, 0x5b, 0xeb, 0xd0, 0x5b, 0xff, 0xf8, 0x75, 0xff, 0xba, 0x66, 0xff, 0x3c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3b, 0x67, 0xff, 0x3b, 0x67, 0xff, 0x1b, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0xdb, 0x5e, 0xff, 0x38, 0x56, 0xff, 0x55, 0x6d, 0xff, 0xeb, 0x4a, 0xff, 0x69, 0x52, 0xcf, 0xb5, 0xbd, 0x18, 0xd7, 0xb5, 0xa3, 0x59, 0xbe, 0xff, 0x9f, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xff, 0xbf, 0xe7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x5e, 0xd7, 0xff, 0x5e, 0xd7, 0xff, 0x5e, 0xdf, 0xff, 0x5e, 0xdf, 0xff, 0xf8, 0xb5, 0xfa, 0xd7, 0xb5, 0x8c, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x04, 0x2c, 0x63, 0x8e, 0x2c, 0x53, 0xfc, 0x14, 0x6d, 0xff, 0x58, 0x66, 0xff, 0xfb, 0x5e, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5b, 0x67, 0xff, 0x3b, 0x6f, 0xff, 0x3b, 0x7f, 0xff, 0x7c, 0x8f, 0xff, 0x9c, 0x97, 0xff, 0xbc, 0x97, 0xff, 0xbd, 0x97, 0xff, 0x9c, 0x97, 0xff, 0x3b, 0x87, 0xff, 0x3b, 0x6f, 0xff, 0x5b, 0x67, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x99, 0x5e, 0xff, 0xf7, 0x5d, 0xff, 0xf4, 0x6c, 0xff, 0xaa, 0x4a, 0xfc, 0xeb, 0x62, 0x83, 0x18, 0xc6, 0x04, 0xf7, 0xb5, 0x8c, 0x39, 0xb6, 0xff, 0x7e, 0xdf, 0xff, 0x9e, 0xdf, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xdf, 0xff, 0x9e, 0xe7, 0xff, 0x9e, 0xdf, 0xff, 0x7e, 0xdf, 0xff, 0x5e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x5e, 0xd7, 0xff, 0x5e, 0xd7, 0xff, 0x3d, 0xd7, 0xff, 0x39, 0xb6, 0xfd, 0xb7, 0xad, 0xc2, 0x38, 0xbe, 0x22, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x73, 0x34, 0xeb, 0x5a, 0xe8, 0xef, 0x53, 0xff, 0xd6, 0x65, 0xff, 0x79, 0x56, 0xff, 0x1b, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5b, 0x5f, 0xff, 0x3b, 0x67, 0xff, 0x3b, 0x77, 0xff, 0x5c, 0x8f, 0xff, 0xbd, 0xa7, 0xff, 0xfe, 0xbf, 0xff, 0xfd, 0xc7, 0xff, 0xfd, 0xc7, 0xff, 0xfd, 0xc7, 0xff, 0xfd, 0xc7, 0xff, 0xfd, 0xc7, 0xff, 0xfe, 0xbf, 0xff, 0xde, 0xa7, 0xff, 0x7c, 0x8f, 0xff, 0x1b, 0x77, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0xba, 0x5e, 0xff, 0x18, 0x56, 0xff, 0xd6, 0x65, 0xff, 0x30, 0x5c, 0xff, 0xaa, 0x52, 0xee, 0x8e, 0x7b, 0x3d, 0x00, 0x00, 0x00, 0xf7, 0xb5, 0x44, 0xf8, 0xad, 0xf1, 0x1d, 0xcf, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xd7, 0xff, 0x7e, 0xdf, 0xff, 0x7e, 0xdf, 0xff, 0xbb, 0xc6, 0xff, 0x7a, 0xbe, 0xff, 0xfc, 0xce, 0xff, 0x1d, 0xcf, 0xff, 0xbb, 0xbe, 0xff, 0xf8, 0xad, 0xf8, 0x97, 0xad, 0xb8, 0xf7, 0xb5, 0x34, 0xff, 0xff, 0x01, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x08, 0xaa, 0x5a, 0xab, 0x0b, 0x53, 0xfe, 0x14, 0x65, 0xff, 0xf7, 0x55, 0xff, 0x9a, 0x56, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5b, 0x67, 0xff, 0x1a, 0x6f, 0xff, 0x5b, 0x87, 0xff, 0xdd, 0xaf, 0xff, 0xfe, 0xbf, 0xff, 0xfd, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdd, 0xbf, 0xff, 0xfe, 0xb7, 0xff, 0xbd, 0xa7, 0xff, 0x1b, 0x77, 0xff, 0x5b, 0x67, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x57, 0xff, 0x5d, 0x5f, 0xff, 0x1b, 0x5f, 0xff, 0x39, 0x56, 0xff, 0xf7, 0x55, 0xff, 0x95, 0x6d, 0xff, 0x4c, 0x53, 0xff, 0xca, 0x5a, 0xc2, 0x75, 0xad, 0x0f, 0x00, 0x00, 0x00, 0xbb, 0xc6, 0x0c, 0xb7, 0xad, 0x9d, 0x18, 0xb6, 0xfb, 0x1d, 0xd7, 0xff, 0x9e, 0xdf, 0xff, 0x7e, 0xdf, 0xff, 0x7e, 0xdf, 0xff, 0x7e, 0xdf, 0xff, 0xbb, 0xce, 0xff, 0xd8, 0xad, 0xee, 0xf8, 0xb5, 0xb4, 0xd7, 0xb5, 0xd6, 0xd7, 0xad, 0xe3, 0xb7, 0xad, 0xc0, 0x96, 0xad, 0x6c, 0xf7, 0xb5, 0x1a, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x6b, 0x4b, 0x8a, 0x52, 0xf1, 0x10, 0x54, 0xff, 0xb6, 0x5d, 0xff, 0x38, 0x56, 0xff, 0x9a, 0x56, 0xff, 0x3c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x67, 0xff, 0x3a, 0x77, 0xff, 0xbc, 0xa7, 0xff, 0xfd, 0xbf, 0xff, 0xfd, 0xc7, 0xff, 0xdd, 0xc7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xd7, 0xff, 0xfc, 0xd7, 0xff, 0xfc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xd7, 0xff, 0xdb, 0xd7, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xc7, 0xff, 0xfd, 0xbf, 0xff, 0xbd, 0x9f, 0xff, 0x3b, 0x6f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1b, 0x5f, 0xff, 0x59, 0x56, 0xff, 0xd7, 0x55, 0xff, 0xb7, 0x5d, 0xff, 0xf3, 0x64, 0xff, 0xca, 0x52, 0xfc, 0x0c, 0x6b, 0x7d, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xc6, 0x19, 0xb7, 0xad, 0x9a, 0xb7, 0xad, 0xf2, 0x19, 0xb6, 0xfe, 0x7a, 0xc6, 0xff, 0x7a, 0xc6, 0xff, 0xf8, 0xb5, 0xfd, 0xb7, 0xad, 0xdf, 0xd7, 0xb5, 0x64, 0x7d, 0xdf, 0x0d, 0x9a, 0xce, 0x16, 0x59, 0xc6, 0x1c, 0xfb, 0xce, 0x0e, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xad, 0x0c, 0x28, 0x42, 0xc3, 0xcb, 0x42, 0xff, 0x55, 0x6d, 0xff, 0xd7, 0x55, 0xff, 0x59, 0x56, 0xff, 0x9a, 0x56, 0xff, 0x1c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x1b, 0x67, 0xff, 0x5b, 0x7f, 0xff, 0xfd, 0xaf, 0xff, 0xfd, 0xc7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xd7, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xd7, 0xff, 0xdb, 0xd7, 0xff, 0xbb, 0xd7, 0xff, 0xdb, 0xd7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xfd, 0xbf, 0xff, 0x7c, 0x8f, 0xff, 0x1b, 0x67, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0xfb, 0x56, 0xff, 0x99, 0x56, 0xff, 0xd8, 0x55, 0xff, 0xb7, 0x55, 0xff, 0x96, 0x65, 0xff, 0xcf, 0x53, 0xff, 0xaa, 0x5a, 0xe9, 0x6e, 0x7b, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xce, 0x0d, 0xb7, 0xb5, 0x4e, 0x97, 0xad, 0x97, 0xb7, 0xad, 0xba, 0x96, 0xad, 0xb4, 0xb6, 0xad, 0x83, 0xb7, 0xb5, 0x33, 0xff, 0xc7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x63, 0x50, 0x69, 0x42, 0xf2, 0x51, 0x5c, 0xff, 0xb6, 0x65, 0xff, 0xf8, 0x55, 0xff, 0x39, 0x56, 0xff, 0xba, 0x5e, 0xff, 0x1c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x5c, 0x8f, 0xff, 0xfd, 0xb7, 0xff, 0xfd, 0xc7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xd7, 0xff, 0xbc, 0xd7, 0xff, 0xbc, 0xd7, 0xff, 0xbc, 0xd7, 0xff, 0xfd, 0xc7, 0xff, 0xdd, 0xaf, 0xff, 0xfb, 0x6e, 0xff, 0x3c, 0x67, 0xff, 0xfb, 0x5e, 0xff, 0x59, 0x56, 0xff, 0x18, 0x4e, 0xff, 0xb7, 0x55, 0xff, 0xb6, 0x5d, 0xff, 0x13, 0x65, 0xff, 0xcb, 0x4a, 0xfe, 0xab, 0x62, 0xa0, 0xbb, 0xde, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x7a, 0xd6, 0x05, 0xdb, 0xce, 0x0d, 0x59, 0xce, 0x09, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xb5, 0x0d, 0xaa, 0x52, 0xad, 0xeb, 0x4a, 0xfe, 0x14, 0x75, 0xff, 0xb7, 0x65, 0xff, 0xf8, 0x55, 0xff, 0x58, 0x56, 0xff, 0xba, 0x5e, 0xff, 0x1c, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x3b, 0x67, 0xff, 0x7c, 0x87, 0xff, 0xfe, 0xb7, 0xff, 0xfd, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xd7, 0xff, 0xbc, 0xd7, 0xff, 0xbc, 0xd7, 0xff, 0xdc, 0xcf, 0xff, 0xfd, 0xbf, 0xff, 0x3b, 0x87, 0xff, 0xfa, 0x66, 0xff, 0x59, 0x56, 0xff, 0x18, 0x56, 0xff, 0xd7, 0x55, 0xff, 0x96, 0x55, 0xff, 0x95, 0x65, 0xff, 0xad, 0x4b, 0xff, 0x8a, 0x52, 0xea, 0xf0, 0x8b, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x73, 0x3b, 0xaa, 0x52, 0xe4, 0x8e, 0x5b, 0xff, 0x76, 0x75, 0xff, 0xd7, 0x65, 0xff, 0xf7, 0x55, 0xff, 0x38, 0x56, 0xff, 0xba, 0x5e, 0xff, 0x1c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3b, 0x67, 0xff, 0x3b, 0x8f, 0xff, 0xfe, 0xb7, 0xff, 0xfd, 0xcf, 0xff, 0xdc, 0xd7, 0xff, 0xdb, 0xd7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xd7, 0xff, 0xdd, 0xc7, 0xff, 0x7c, 0x9f, 0xff, 0x99, 0x66, 0xff, 0x18, 0x5e, 0xff, 0xd7, 0x5d, 0xff, 0xd7, 0x55, 0xff, 0x96, 0x65, 0xff, 0xd2, 0x64, 0xff, 0xa9, 0x4a, 0xfd, 0xaa, 0x62, 0x99, 0xd7, 0xbd, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x4d, 0x73, 0x78, 0xeb, 0x52, 0xf5, 0x50, 0x64, 0xff, 0xb6, 0x75, 0xff, 0xf7, 0x5d, 0xff, 0xf8, 0x5d, 0xff, 0x39, 0x56, 0xff, 0xba, 0x56, 0xff, 0x1b, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x6f, 0xff, 0x3a, 0x7f, 0xff, 0xfd, 0xbf, 0xff, 0xfd, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xd7, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xfb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xd7, 0xff, 0x9c, 0xcf, 0xff, 0x9c, 0xbf, 0xff, 0x5b, 0x9f, 0xff, 0x37, 0x66, 0xff, 0xf7, 0x5d, 0xff, 0xd7, 0x65, 0xff, 0x96, 0x5d, 0xff, 0x34, 0x6d, 0xff, 0x0b, 0x4b, 0xff, 0x69, 0x52, 0xd8, 0x10, 0x8c, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x0c, 0x2c, 0x63, 0xa3, 0x2b, 0x53, 0xfc, 0xd2, 0x6c, 0xff, 0xb6, 0x6d, 0xff, 0xd7, 0x5d, 0xff, 0xf7, 0x55, 0xff, 0x38, 0x56, 0xff, 0x9a, 0x56, 0xff, 0x1b, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3b, 0x77, 0xff, 0xbc, 0xaf, 0xff, 0xfd, 0xc7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xbc, 0xc7, 0xff, 0x7b, 0xc7, 0xff, 0x5b, 0xbf, 0xff, 0x3a, 0xaf, 0xff, 0x1b, 0x97, 0xff, 0xf7, 0x65, 0xff, 0xf7, 0x5d, 0xff, 0xd7, 0x65, 0xff, 0x96, 0x6d, 0xff, 0xce, 0x5b, 0xff, 0x8a, 0x52, 0xf3, 0x4d, 0x6b, 0x63, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x8c, 0x26, 0xaa, 0x5a, 0xcf, 0xeb, 0x4a, 0xff, 0x14, 0x6d, 0xff, 0xb6, 0x5d, 0xff, 0xd7, 0x55, 0xff, 0xd7, 0x55, 0xff, 0x18, 0x4e, 0xff, 0x79, 0x56, 0xff, 0xfb, 0x5e, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x3b, 0x67, 0xff, 0x9c, 0x97, 0xff, 0xfd, 0xbf, 0xff, 0xdc, 0xc7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xbc, 0xc7, 0xff, 0x7b, 0xbf, 0xff, 0x3a, 0xb7, 0xff, 0x1a, 0xaf, 0xff, 0x1a, 0xaf, 0xff, 0xda, 0x96, 0xff, 0xf7, 0x65, 0xff, 0xf7, 0x5d, 0xff, 0xb6, 0x75, 0xff, 0x71, 0x64, 0xff, 0xca, 0x4a, 0xfc, 0xcb, 0x62, 0x9c, 0x75, 0xcd, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x6e, 0x7b, 0x59, 0xaa, 0x52, 0xf4, 0xef, 0x53, 0xff, 0x96, 0x65, 0xff, 0xb6, 0x5d, 0xff, 0xb7, 0x55, 0xff, 0xd7, 0x55, 0xff, 0xd7, 0x55, 0xff, 0x38, 0x56, 0xff, 0x9a, 0x56, 0xff, 0xfb, 0x5e, 0xff, 0x3c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3b, 0x7f, 0xff, 0xfd, 0xb7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xd7, 0xff, 0xdb, 0xcf, 0xff, 0xdb, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xcf, 0xff, 0xbc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xbc, 0xcf, 0xff, 0xbc, 0xcf, 0xff, 0xbc, 0xcf, 0xff, 0xbc, 0xcf, 0xff, 0xbc, 0xc7, 0xff, 0x7b, 0xbf, 0xff, 0x5a, 0xb7, 0xff, 0x1a, 0xaf, 0xff, 0xfa, 0xa6, 0xff, 0xf9, 0xa6, 0xff, 0x1a, 0xa7, 0xff, 0x9a, 0x8e, 0xff, 0xf7, 0x65, 0xff, 0xd6, 0x6d, 0xff, 0xd2, 0x6c, 0xff, 0x0b, 0x53, 0xfe, 0xeb, 0x5a, 0xbd, 0x10, 0x8c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xb5, 0x16, 0x8a, 0x52, 0xdd, 0x6d, 0x4b, 0xff, 0x75, 0x65, 0xff, 0x96, 0x5d, 0xff, 0xb6, 0x55, 0xff, 0xb7, 0x55, 0xff, 0xb7, 0x55, 0xff, 0xd7, 0x55, 0xff, 0x18, 0x56, 0xff, 0x39, 0x56, 0xff, 0x7a, 0x56, 0xff, 0xfb, 0x5e, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x1b, 0x6f, 0xff, 0xbd, 0x9f, 0xff, 0xfd, 0xc7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xbc, 0xcf, 0xff, 0xbc, 0xcf, 0xff, 0xbc, 0xcf, 0xff, 0x9c, 0xc7, 0xff, 0x7b, 0xbf, 0xff, 0x5b, 0xbf, 0xff, 0x1a, 0xaf, 0xff, 0xfa, 0xa6, 0xff, 0xf9, 0xa6, 0xff, 0xd9, 0x9e, 0xff, 0xd9, 0x9e, 0xff, 0xfa, 0x9e, 0xff, 0x58, 0x7e, 0xff, 0xb6, 0x75, 0xff, 0xd3, 0x6c, 0xff, 0x0c, 0x53, 0xff, 0xeb, 0x62, 0xf9, 0x30, 0x8c, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xee, 0x0c, 0xaa, 0x5a, 0xc9, 0x2c, 0x53, 0xff, 0x75, 0x6d, 0xff, 0x96, 0x5d, 0xff, 0xb6, 0x55, 0xff, 0xd7, 0x55, 0xff, 0xb7, 0x55, 0xff, 0xd7, 0x5d, 0xff, 0xd7, 0x5d, 0xff, 0xf8, 0x5d, 0xff, 0x18, 0x56, 0xff, 0x39, 0x56, 0xff, 0x79, 0x5e, 0xff, 0x9a, 0x66, 0xff, 0xda, 0x5e, 0xff, 0x5c, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x67, 0xff, 0x3b, 0x77, 0xff, 0xfe, 0xb7, 0xff, 0xdd, 0xcf, 0xff, 0xdc, 0xd7, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xbc, 0xc7, 0xff, 0x9c, 0xc7, 0xff, 0x7b, 0xbf, 0xff, 0x7b, 0xbf, 0xff, 0x5b, 0xb7, 0xff, 0x3a, 0xb7, 0xff, 0x1a, 0xaf, 0xff, 0xfa, 0xa6, 0xff, 0xd9, 0x9e, 0xff, 0xd9, 0x9e, 0xff, 0xd9, 0x9e, 0xff, 0xfa, 0xa6, 0xff, 0xda, 0x9e, 0xff, 0x74, 0x75, 0xff, 0x71, 0x5c, 0xff, 0x2c, 0x4b, 0xff, 0xcb, 0x5a, 0xff, 0xeb, 0x62, 0xf4, 0x50, 0x94, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0xcb, 0x62, 0xa0, 0xab, 0x52, 0xff, 0x34, 0x6d, 0xff, 0x96, 0x65, 0xff, 0xb6, 0x55, 0xff, 0xd7, 0x55, 0xff, 0xb7, 0x55, 0xff, 0xb6, 0x5d, 0xff, 0xb6, 0x5d, 0xff, 0xb6, 0x55, 0xff, 0xd7, 0x55, 0xff, 0xd7, 0x55, 0xff, 0xd7, 0x5d, 0xff, 0x55, 0x55, 0xff, 0x91, 0x3c, 0xff, 0x3b, 0x6f, 0xff, 0x5d, 0x67, 0xff, 0x5d, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0x3b, 0x87, 0xff, 0xfd, 0xbf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xdc, 0xcf, 0xff, 0xbc, 0xcf, 0xff, 0xbc, 0xcf, 0xff, 0xbc, 0xcf, 0xff, 0xbc, 0xc7, 0xff, 0xbc, 0xcf, 0xff, 0x9c, 0xc7, 0xff, 0x7b, 0xc7, 0xff, 0x7b, 0xbf, 0xff, 0x5b, 0xb7, 0xff, 0x3b, 0xb7, 0xff, 0x3a, 0xaf, 0xff, 0x1a, 0xaf, 0xff, 0x1a, 0xaf, 0xff, 0xfa, 0xa6, 0xff, 0xd9, 0x9e, 0xff, 0xd9, 0x9e, 0xff, 0xda, 0x9e, 0xff, 0xd9, 0x9e, 0xff, 0xd9, 0x9e, 0xff, 0xda, 0xa6, 0xff, 0x17, 0x96, 0xff, 0xce, 0x5b, 0xff, 0x0b, 0x43, 0xff, 0x8d, 0x5b, 0xff, 0xce, 0x73, 0xff, 0xca, 0x62, 0xf2, 0x30, 0x94, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x71, 0xaa, 0x5a, 0xfa, 0xd2, 0x6c, 0xff, 0x96, 0x65, 0xff, 0xb7, 0x55, 0xff, 0xd7, 0x55, 0xff, 0xb7, 0x5d, 0xff, 0x14, 0x55, 0xff, 0xd4, 0x54, 0xff, 0x56, 0x65, 0xff, 0x96, 0x5d, 0xff, 0x96, 0x5d, 0xff, 0x96, 0x6d, 0xff, 0xce, 0x43, 0xff, 0x50, 0x44, 0xff, 0xfb, 0x76, 0xff, 0x7d, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x5d, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0xda, 0x66, 0xff, 0xf6, 0x75, 0xff, 0xbd, 0xbf, 0xff, 0x9c, 0xbf, 0xff, 0x9c, 0xc7, 0xff, 0x7c, 0xbf, 0xff, 0x7b, 0xbf, 0xff, 0x7b, 0xbf, 0xff, 0x5b, 0xb7, 0xff, 0x5b, 0xb7, 0xff, 0x3a, 0xb7, 0xff, 0x3a, 0xb7, 0xff, 0x3a, 0xaf, 0xff, 0x1a, 0xaf, 0xff, 0x1a, 0xaf, 0xff, 0xfa, 0xae, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0xf9, 0xa6, 0xff, 0xd9, 0x9e, 0xff, 0xd9, 0xa6, 0xff, 0xb9, 0xa6, 0xff, 0xd9, 0xa6, 0xff, 0xb9, 0xa6, 0xff, 0xb9, 0xa6, 0xff, 0x95, 0x8d, 0xff, 0x6c, 0x53, 0xff, 0xeb, 0x42, 0xff, 0xae, 0x53, 0xff, 0x54, 0x7d, 0xff, 0x30, 0x6c, 0xff, 0xcb, 0x5a, 0xf1, 0x50, 0x8c, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x83, 0x33, 0x8a, 0x52, 0xeb, 0xef, 0x53, 0xff, 0x96, 0x6d, 0xff, 0xb7, 0x5d, 0xff, 0xd7, 0x55, 0xff, 0xb6, 0x5d, 0xff, 0x34, 0x5d, 0xff, 0xae, 0x33, 0xff, 0xcf, 0x43, 0xff, 0xf2, 0x64, 0xff, 0x55, 0x75, 0xff, 0x34, 0x75, 0xff, 0x0b, 0x3b, 0xff, 0xb2, 0x54, 0xff, 0xdb, 0x76, 0xff, 0x7d, 0x67, 0xff, 0x7d, 0x5f, 0xff, 0x7d, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0x3c, 0x67, 0xff, 0xba, 0x66, 0xff, 0x74, 0x55, 0xff, 0x2f, 0x54, 0xff, 0x1b, 0xb7, 0xff, 0x3b, 0xaf, 0xff, 0x1a, 0xb7, 0xff, 0x1a, 0xb7, 0xff, 0x1a, 0xaf, 0xff, 0x1a, 0xaf, 0xff, 0x1a, 0xaf, 0xff, 0x1a, 0xaf, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0xf9, 0xa6, 0xff, 0xf9, 0xa6, 0xff, 0xf9, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0xf9, 0xa6, 0xff, 0xf9, 0x9e, 0xff, 0xf9, 0x9e, 0xff, 0xda, 0xa6, 0xff, 0xb9, 0xae, 0xff, 0xb9, 0xae, 0xff, 0x17, 0xa6, 0xff, 0x50, 0x74, 0xff, 0x0b, 0x4b, 0xff, 0xeb, 0x4a, 0xff, 0x10, 0x5c, 0xff, 0x55, 0x6d, 0xff, 0x75, 0x6d, 0xff, 0x30, 0x5c, 0xff, 0xca, 0x5a, 0xee, 0x31, 0x94, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xbd, 0x0b, 0xeb, 0x62, 0xb3, 0x2c, 0x4b, 0xff, 0x55, 0x75, 0xff, 0xb6, 0x65, 0xff, 0xb6, 0x55, 0xff, 0xb6, 0x5d, 0xff, 0x95, 0x65, 0xff, 0x14, 0x65, 0xff, 0xae, 0x4b, 0xff, 0xeb, 0x42, 0xff, 0x6c, 0x53, 0xff, 0x8e, 0x63, 0xff, 0xca, 0x42, 0xff, 0x14, 0x5d, 0xff, 0xdb, 0x6e, 0xff, 0x7d, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5c, 0x5f, 0xff, 0xfb, 0x66, 0xff, 0x17, 0x66, 0xff, 0xef, 0x4b, 0xff, 0xce, 0x5b, 0xff, 0xd9, 0xae, 0xff, 0xfa, 0xa6, 0xff, 0xda, 0xa6, 0xff, 0xda, 0xa6, 0xff, 0xd9, 0xa6, 0xff, 0xd9, 0x9e, 0xff, 0xd9, 0x9e, 0xff, 0xd9, 0x9e, 0xff, 0xd9, 0x9e, 0xff, 0xd9, 0x9e, 0xff, 0xd9, 0x9e, 0xff, 0xd9, 0x9e, 0xff, 0xda, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0xd9, 0xa6, 0xff, 0xd9, 0xae, 0xff, 0xb9, 0xae, 0xff, 0xd6, 0x9d, 0xff, 0x70, 0x74, 0xff, 0xcb, 0x4a, 0xff, 0xec, 0x52, 0xff, 0xae, 0x53, 0xff, 0xd3, 0x6c, 0xff, 0x76, 0x75, 0xff, 0x96, 0x65, 0xff, 0x96, 0x65, 0xff, 0xef, 0x53, 0xff, 0x89, 0x52, 0xe7, 0x10, 0x8c, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x8e, 0x73, 0x59, 0xcb, 0x52, 0xf6, 0x92, 0x6c, 0xff, 0x75, 0x6d, 0xff, 0x96, 0x55, 0xff, 0xb6, 0x55, 0xff, 0x96, 0x5d, 0xff, 0x76, 0x65, 0xff, 0xf4, 0x74, 0xff, 0x4c, 0x5b, 0xff, 0xcb, 0x62, 0xff, 0x8a, 0x5a, 0xfe, 0xca, 0x4a, 0xff, 0x54, 0x65, 0xff, 0xba, 0x66, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x5d, 0x67, 0xff, 0x5c, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0x3c, 0x5f, 0xff, 0xba, 0x66, 0xff, 0x75, 0x65, 0xff, 0xcb, 0x42, 0xff, 0xb1, 0x84, 0xff, 0xfa, 0xae, 0xff, 0x1a, 0xa7, 0xff, 0x1b, 0xa7, 0xff, 0x1a, 0xa7, 0xff, 0x1a, 0xa7, 0xff, 0x1a, 0xa7, 0xff, 0x1a, 0xa7, 0xff, 0x1a, 0xa7, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0xa6, 0xff, 0xfa, 0xae, 0xff, 0xfa, 0xae, 0xff, 0xfa, 0xb6, 0xff, 0xfa, 0xbe, 0xff, 0xda, 0xbe, 0xff, 0x57, 0xae, 0xff, 0x33, 0x95, 0xff, 0xce, 0x6b, 0xff, 0xeb, 0x5a, 0xff, 0xaa, 0x52, 0xff, 0x6d, 0x53, 0xff, 0xb3, 0x6c, 0xff, 0x95, 0x6d, 0xff, 0xb6, 0x6d, 0xff, 0xb7, 0x65, 0xff, 0x97, 0x5d, 0xff, 0x76, 0x6d, 0xff, 0x8e, 0x4b, 0xff, 0x69, 0x4a, 0xd6, 0xd3, 0xac, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xb5, 0x13, 0xaa, 0x5a, 0xc4, 0x0c, 0x53, 0xff, 0x34, 0x75, 0xff, 0x75, 0x5d, 0xff, 0x96, 0x55, 0xff, 0x96, 0x5d, 0xff, 0x76, 0x65, 0xff, 0x14, 0x7d, 0xff, 0x2c, 0x5b, 0xff, 0x0c, 0x73, 0xd9, 0x2c, 0x73, 0xb0, 0xa9, 0x4a, 0xfe, 0x54, 0x65, 0xff, 0x79, 0x5e, 0xff, 0x3c, 0x67, 0xff, 0x3c, 0x5f, 0xff, 0x3d, 0x67, 0xff, 0x5d, 0x67, 0xff, 0x5c, 0x5f, 0xff, 0xfb, 0x66, 0xff, 0x38, 0x66, 0xff, 0x51, 0x54, 0xff, 0xaa, 0x4a, 0xff, 0xd6, 0xad, 0xff, 0xd9, 0xb6, 0xff, 0xfa, 0xae, 0xff, 0xda, 0xae, 0xff, 0xd9, 0xa6, 0xff, 0xb9, 0xa6, 0xff, 0xd9, 0xae, 0xff, 0xd9, 0xae, 0xff, 0xb9, 0xae, 0xff, 0xb9, 0xae, 0xff, 0xd9, 0xae, 0xff, 0xb9, 0xb6, 0xff, 0x99, 0xb6, 0xff, 0x58, 0xae, 0xff, 0xb5, 0xa5, 0xff, 0xd2, 0x8c, 0xff, 0xae, 0x6b, 0xff, 0xca, 0x52, 0xfe, 0xa9, 0x5a, 0xf5, 0xcb, 0x6a, 0xdd, 0xcb, 0x6a, 0xf6, 0x0c, 0x63, 0xff, 0x55, 0x8d, 0xff, 0xb6, 0x6d, 0xff, 0xb6, 0x5d, 0xff, 0xd7, 0x5d, 0xff, 0xd7, 0x55, 0xff, 0xb7, 0x5d, 0xff, 0x75, 0x75, 0xff, 0x0c, 0x4b, 0xff, 0x69, 0x52, 0xb6, 0xbb, 0xde, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x73, 0x50, 0x8a, 0x52, 0xe9, 0xae, 0x5b, 0xff, 0x14, 0x6d, 0xff, 0x55, 0x65, 0xff, 0x55, 0x6d, 0xff, 0x75, 0x75, 0xff, 0x10, 0x64, 0xff, 0xeb, 0x62, 0xf3, 0xaf, 0x83, 0x60, 0x6e, 0x7b, 0x75, 0xaa, 0x42, 0xfd, 0x54, 0x65, 0xff, 0x18, 0x5e, 0xff, 0xda, 0x5e, 0xff, 0x1c, 0x5f, 0xff, 0x3d, 0x67, 0xff, 0x1c, 0x67, 0xff, 0xfb, 0x66, 0xff, 0x39, 0x66, 0xff, 0x75, 0x6d, 0xff, 0x0b, 0x4b, 0xff, 0xcb, 0x5a, 0xff, 0x70, 0x84, 0xff, 0xf2, 0x8c, 0xff, 0x34, 0x95, 0xff, 0x75, 0x95, 0xff, 0x95, 0x9d, 0xff, 0x95, 0x9d, 0xff, 0x74, 0x9d, 0xff, 0x34, 0x95, 0xff, 0xd2, 0x84, 0xff, 0x91, 0x7c, 0xff, 0x0f, 0x74, 0xff, 0x6c, 0x63, 0xff, 0xea, 0x52, 0xff, 0x89, 0x4a, 0xfc, 0x69, 0x52, 0xf7, 0x89, 0x5a, 0xe5, 0xcb, 0x62, 0xbe, 0x0c, 0x6b, 0x91, 0x6e, 0x7b, 0x49, 0x96, 0xc5, 0x1d, 0x2c, 0x7b, 0x93, 0xeb, 0x62, 0xfd, 0x51, 0x6c, 0xff, 0xb6, 0x75, 0xff, 0x96, 0x65, 0xff, 0xb7, 0x5d, 0xff, 0xd7, 0x5d, 0xff, 0xb6, 0x65, 0xff, 0xf3, 0x6c, 0xff, 0xcb, 0x52, 0xf9, 0x2c, 0x73, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xfd, 0x03, 0x2c, 0x6b, 0x62, 0xaa, 0x52, 0xed, 0x8e, 0x53, 0xff, 0xb2, 0x6c, 0xff, 0xd3, 0x74, 0xff, 0xce, 0x5b, 0xff, 0x2c, 0x63, 0xf1, 0x4c, 0x73, 0x7c, 0x75, 0xdd, 0x06, 0x2c, 0x6b, 0x62, 0xaa, 0x42, 0xfc, 0x34, 0x65, 0xff, 0xf8, 0x5d, 0xff, 0x99, 0x5e, 0xff, 0xda, 0x5e, 0xff, 0xdb, 0x5e, 0xff, 0xba, 0x5e, 0xff, 0x59, 0x5e, 0xff, 0xd7, 0x6d, 0xff, 0x51, 0x64, 0xff, 0xca, 0x5a, 0xfb, 0x69, 0x5a, 0xea, 0x48, 0x52, 0xec, 0x48, 0x52, 0xf2, 0x48, 0x52, 0xf4, 0x48, 0x52, 0xf5, 0x69, 0x52, 0xf5, 0x69, 0x52, 0xf4, 0x8a, 0x5a, 0xf2, 0x69, 0x52, 0xf0, 0x69, 0x52, 0xea, 0x28, 0x52, 0xe3, 0x49, 0x52, 0xd6, 0x69, 0x5a, 0xbc, 0x8a, 0x5a, 0x92, 0xcb, 0x62, 0x75, 0x0d, 0x73, 0x47, 0xaf, 0x83, 0x23, 0x71, 0xa4, 0x0b, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xa4, 0x1f, 0x2c, 0x6b, 0xc3, 0x2c, 0x5b, 0xfe, 0x92, 0x6c, 0xff, 0x97, 0x75, 0xff, 0x97, 0x65, 0xff, 0x97, 0x6d, 0xff, 0x55, 0x7d, 0xff, 0xae, 0x63, 0xff, 0xcb, 0x5a, 0xd4, 0x51, 0x94, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x04, 0xec, 0x62, 0x53, 0xcb, 0x62, 0xc5, 0xcb, 0x5a, 0xe9, 0xeb, 0x62, 0xe7, 0x0c, 0x6b, 0xc2, 0x4d, 0x73, 0x56, 0x75, 0xad, 0x06, 0x00, 0x00, 0x00, 0x2d, 0x73, 0x53, 0x8a, 0x4a, 0xfa, 0xd3, 0x64, 0xff, 0xf7, 0x65, 0xff, 0x38, 0x5e, 0xff, 0x39, 0x5e, 0xff, 0x38, 0x5e, 0xff, 0x38, 0x5e, 0xff, 0xd7, 0x65, 0xff, 0x14, 0x75, 0xff, 0xeb, 0x5a, 0xfb, 0x0c, 0x6b, 0x99, 0xb2, 0xa4, 0x21, 0xf0, 0x8b, 0x21, 0xcf, 0x8b, 0x36, 0x4e, 0x83, 0x42, 0x2d, 0x73, 0x49, 0x0c, 0x73, 0x4a, 0x2d, 0x73, 0x46, 0x6e, 0x83, 0x3f, 0x8f, 0x83, 0x34, 0xcf, 0x83, 0x20, 0x51, 0xa4, 0x15, 0x14, 0xb5, 0x10, 0x59, 0xce, 0x09, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x8b, 0x2d, 0x0c, 0x63, 0xc7, 0x0b, 0x5b, 0xfe, 0x31, 0x64, 0xff, 0x14, 0x75, 0xff, 0xf3, 0x74, 0xff, 0xef, 0x6b, 0xff, 0xcb, 0x5a, 0xf3, 0x0c, 0x6b, 0x68, 0x10, 0x84, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xd1, 0x8b, 0x13, 0x4e, 0x73, 0x2f, 0x6d, 0x7b, 0x2b, 0x51, 0x8c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x8b, 0x32, 0xaa, 0x52, 0xec, 0xef, 0x53, 0xff, 0x96, 0x6d, 0xff, 0xb7, 0x65, 0xff, 0xb7, 0x5d, 0xff, 0xd7, 0x5d, 0xff, 0xd6, 0x65, 0xff, 0x14, 0x6d, 0xff, 0x4d, 0x53, 0xfe, 0xcb, 0x5a, 0xc8, 0x72, 0x9c, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x7b, 0x26, 0xcb, 0x62, 0xb1, 0xcc, 0x5a, 0xf4, 0xeb, 0x52, 0xfd, 0xcb, 0x52, 0xfc, 0xab, 0x5a, 0xe8, 0xcc, 0x6a, 0x83, 0x51, 0xa4, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x09, 0xab, 0x5a, 0xb6, 0xcb, 0x52, 0xff, 0xb2, 0x74, 0xff, 0x76, 0x75, 0xff, 0x96, 0x75, 0xff, 0x95, 0x75, 0xff, 0xd3, 0x6c, 0xff, 0x0c, 0x4b, 0xff, 0xaa, 0x52, 0xd8, 0xef, 0x83, 0x38, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x94, 0x10, 0x2d, 0x73, 0x4d, 0x0c, 0x6b, 0x74, 0xec, 0x6a, 0x6c, 0x8f, 0x7b, 0x30, 0xd7, 0xbd, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x83, 0x32, 0x8b, 0x5a, 0xd1, 0xcb, 0x52, 0xfe, 0xcf, 0x6b, 0xff, 0x50, 0x6c, 0xff, 0xae, 0x5b, 0xff, 0xcb, 0x52, 0xfc, 0x8b, 0x5a, 0xcf, 0xcf, 0x83, 0x3d, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xcf, 0x83, 0x2a, 0xec, 0x6a, 0x97, 0x8a, 0x5a, 0xd9, 0x89, 0x52, 0xe7, 0xaa, 0x5a, 0xd0, 0x0c, 0x6b, 0x80, 0x11, 0x94, 0x20, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc4, 0x04, 0xb3, 0xa4, 0x13, 0x32, 0x94, 0x19, 0x14, 0xa5, 0x10, 0x10, 0x84, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xff, 0xff, 0x02, 0x6b, 0x4d, 0x05, 0x94, 0xb2, 0x0e, 0xa5, 0x12, 0x15, 0x8c, 0x71, 0x16, 0x8c, 0x70, 0x16, 0x94, 0xb2, 0x15, 0x94, 0xb2, 0x0e, 0x84, 0x10, 0x06, 0xff, 0xf0, 0x02, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x04, 0xbd, 0x75, 0x12, 0x8c, 0x30, 0x36, 0x73, 0x6d, 0x5c, 0x5b, 0x0b, 0x8c, 0x5a, 0xeb, 0xab, 0x52, 0xca, 0xc6, 0x52, 0xea, 0xcf, 0x52, 0xea, 0xd2, 0x5a, 0xeb, 0xd3, 0x52, 0xca, 0xd0, 0x5a, 0xeb, 0xc6, 0x63, 0x0c, 0xae, 0x6b, 0x2c, 0x8e, 0x73, 0x6d, 0x68, 0x7b, 0xaf, 0x3b, 0x9c, 0x92, 0x19, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0xad, 0x74, 0x18, 0x73, 0x6d, 0x55, 0x6b, 0x2c, 0x9d, 0x5b, 0x0b, 0xcf, 0x52, 0xeb, 0xeb, 0x4b, 0x0b, 0xf8, 0x4b, 0x2c, 0xfd, 0x4b, 0x8d, 0xff, 0x4b, 0xef, 0xff, 0x5c, 0x71, 0xff, 0x64, 0xd2, 0xff, 0x64, 0xd2, 0xff, 0x5c, 0x91, 0xff, 0x5c, 0x30, 0xff, 0x53, 0xae, 0xff, 0x53, 0x4d, 0xfd, 0x5b, 0x4d, 0xf9, 0x5b, 0x2c, 0xee, 0x5b, 0x0c, 0xd5, 0x6a, 0xec, 0xa4, 0x73, 0x4d, 0x5a, 0x9c, 0xd3, 0x19, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x59, 0x09, 0x9c, 0xb2, 0x36, 0x73, 0x8e, 0x87, 0x5b, 0x0c, 0xd6, 0x5b, 0x0b, 0xf5, 0x53, 0x2c, 0xfe, 0x53, 0xce, 0xff, 0x54, 0xb1, 0xff, 0x65, 0x95, 0xff, 0x76, 0x58, 0xff, 0x76, 0xba, 0xff, 0x77, 0x1b, 0xff, 0x77, 0x1c, 0xff, 0x77, 0x3c, 0xff, 0x77, 0x3c, 0xff, 0x7f, 0x1c, 0xff, 0x7f, 0x1b, 0xff, 0x7e, 0xfb, 0xff, 0x7e, 0x99, 0xff, 0x75, 0xf7, 0xff, 0x65, 0x13, 0xff, 0x53, 0xcf, 0xff, 0x53, 0x2c, 0xfe, 0x52, 0xcb, 0xf6, 0x52, 0x8a, 0xd5, 0x6b, 0x2c, 0x7c, 0x9c, 0xd2, 0x23, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x3c, 0x09, 0x94, 0x10, 0x47, 0x6b, 0x0c, 0xaa, 0x63, 0x4d, 0xea, 0x53, 0x6d, 0xfd, 0x5c, 0x2f, 0xff, 0x75, 0x54, 0xff, 0x86, 0x58, 0xff, 0x7e, 0xda, 0xff, 0x77, 0x1b, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x6f, 0x1b, 0xff, 0x76, 0xfb, 0xff, 0x7e, 0xba, 0xff, 0x76, 0x38, 0xff, 0x6d, 0x54, 0xff, 0x4b, 0xae, 0xff, 0x4a, 0xcb, 0xfb, 0x5a, 0xcb, 0xd8, 0x63, 0x0c, 0x76, 0xad, 0x75, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0xa4, 0xf3, 0x3a, 0x73, 0x4c, 0xa9, 0x5a, 0xca, 0xef, 0x53, 0x0c, 0xfe, 0x5c, 0x51, 0xff, 0x76, 0x37, 0xff, 0x7e, 0xfa, 0xff, 0x7f, 0x3b, 0xff, 0x77, 0x3b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3b, 0xff, 0x6e, 0xfb, 0xff, 0x77, 0x1b, 0xff, 0x7e, 0xb9, 0xff, 0x75, 0xd6, 0xff, 0x4b, 0x8e, 0xff, 0x52, 0xcb, 0xf9, 0x62, 0xcb, 0xbd, 0x8c, 0x10, 0x45, 0xc6, 0x18, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x14, 0x7b, 0xae, 0x80, 0x5a, 0xaa, 0xe9, 0x4a, 0xea, 0xff, 0x54, 0x30, 0xff, 0x76, 0x17, 0xff, 0x87, 0x1b, 0xff, 0x77, 0x5c, 0xff, 0x6f, 0x7c, 0xff, 0x67, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x6f, 0x3c, 0xff, 0x7f, 0x7d, 0xff, 0x7f, 0x5d, 0xff, 0x7f, 0x3c, 0xff, 0x77, 0x1b, 0xff, 0x77, 0x3b, 0xff, 0x7e, 0xda, 0xff, 0x65, 0x13, 0xff, 0x4b, 0x0c, 0xff, 0x5a, 0xcb, 0xea, 0x6b, 0x4d, 0x77, 0xce, 0x39, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xad, 0x35, 0x2d, 0x6b, 0x2c, 0xb3, 0x52, 0xca, 0xfa, 0x43, 0x6d, 0xff, 0x6d, 0xb6, 0xff, 0x76, 0xfb, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x5c, 0xff, 0x8f, 0xbe, 0xff, 0x97, 0x9d, 0xff, 0x97, 0x9d, 0xff, 0x97, 0x9d, 0xff, 0x8f, 0x7d, 0xff, 0x77, 0x5c, 0xff, 0x6f, 0x3c, 0xff, 0x7f, 0x1b, 0xff, 0x75, 0xf7, 0xff, 0x4b, 0x8d, 0xff, 0x52, 0xca, 0xf6, 0x6b, 0x0c, 0x98, 0xbd, 0xd6, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0xa4, 0xf3, 0x41, 0x52, 0xca, 0xd8, 0x53, 0x0c, 0xfe, 0x5c, 0xb2, 0xff, 0x76, 0xda, 0xff, 0x77, 0x1c, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x7f, 0x5c, 0xff, 0x97, 0x9d, 0xff, 0x9f, 0x9d, 0xff, 0x9f, 0x9c, 0xff, 0x9f, 0x9c, 0xff, 0x9f, 0x9d, 0xff, 0x97, 0x9d, 0xff, 0x77, 0x3c, 0xff, 0x6f, 0x3c, 0xff, 0x6f, 0x1b, 0xff, 0x7e, 0xba, 0xff, 0x4b, 0xef, 0xff, 0x4a, 0xaa, 0xfa, 0x62, 0xeb, 0xad, 0xad, 0x14, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x9c, 0xb2, 0x47, 0x62, 0xeb, 0xde, 0x53, 0x2c, 0xff, 0x6d, 0x34, 0xff, 0x7e, 0xfb, 0xff, 0x6f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x77, 0x5c, 0xff, 0x97, 0x9d, 0xff, 0x9f, 0x7d, 0xff, 0xa7, 0x7c, 0xff, 0x9f, 0x9c, 0xff, 0x9f, 0x9c, 0xff, 0x9f, 0x9d, 0xff, 0x97, 0x9d, 0xff, 0x6f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x7e, 0x99, 0xff, 0x53, 0xef, 0xff, 0x4a, 0x89, 0xfb, 0x6b, 0x0b, 0xaa, 0xbd, 0x96, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xb5, 0x75, 0x39, 0x62, 0xca, 0xdc, 0x53, 0x0b, 0xff, 0x6d, 0x74, 0xff, 0x7f, 0x3b, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x8f, 0x9d, 0xff, 0x9f, 0x9d, 0xff, 0xa7, 0x7c, 0xff, 0xa7, 0x7c, 0xff, 0xa7, 0x7c, 0xff, 0xa7, 0x7c, 0xff, 0x97, 0x9d, 0xff, 0x77, 0x9d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x77, 0x3b, 0xff, 0x7e, 0x99, 0xff, 0x4b, 0xce, 0xff, 0x52, 0xaa, 0xfb, 0x62, 0xcb, 0x99, 0xc6, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x95, 0x23, 0x62, 0xeb, 0xcc, 0x52, 0xeb, 0xff, 0x6d, 0x34, 0xff, 0x7f, 0x1b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x5c, 0xff, 0x8f, 0x9d, 0xff, 0x97, 0x9d, 0xff, 0x9f, 0x9c, 0xff, 0x9f, 0x7c, 0xff, 0x9f, 0x7c, 0xff, 0x97, 0xbd, 0xff, 0x77, 0x9d, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x7c, 0xff, 0x6f, 0x3b, 0xff, 0x7e, 0x79, 0xff, 0x4b, 0x8e, 0xff, 0x4a, 0x8a, 0xf7, 0x6b, 0x2c, 0x7f, 0xde, 0xb5, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x7a, 0x0a, 0x6b, 0x2b, 0x9f, 0x4a, 0xaa, 0xfd, 0x5c, 0x71, 0xff, 0x7e, 0xfb, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x5c, 0xff, 0x7f, 0x7c, 0xff, 0x87, 0x9d, 0xff, 0x8f, 0xbd, 0xff, 0x8f, 0xbd, 0xff, 0x87, 0x9d, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x7e, 0x79, 0xff, 0x4b, 0x6d, 0xff, 0x52, 0x8a, 0xee, 0x8b, 0xef, 0x59, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x91, 0x54, 0x52, 0xaa, 0xf3, 0x4b, 0xae, 0xff, 0x7e, 0xda, 0xff, 0x6f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x5c, 0xff, 0x6f, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x77, 0x3c, 0xff, 0x76, 0x38, 0xff, 0x43, 0x0b, 0xff, 0x52, 0x89, 0xd8, 0x9c, 0x72, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x58, 0x17, 0x5a, 0xeb, 0xc7, 0x4b, 0x0b, 0xff, 0x76, 0x17, 0xff, 0x6f, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x7f, 0x1b, 0xff, 0x6d, 0x54, 0xff, 0x4a, 0xca, 0xfc, 0x62, 0xca, 0x98, 0xcd, 0x75, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x73, 0xae, 0x72, 0x5a, 0xcb, 0xfa, 0x5c, 0xb2, 0xff, 0x7f, 0x1b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x57, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x5c, 0xff, 0x86, 0xfb, 0xff, 0x54, 0x50, 0xff, 0x52, 0x8a, 0xf0, 0x73, 0x4d, 0x57, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf6, 0x1a, 0x5b, 0x2c, 0xd1, 0x53, 0x4c, 0xff, 0x7e, 0x79, 0xff, 0x77, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x77, 0x3b, 0xff, 0x86, 0x79, 0xff, 0x4a, 0xcb, 0xfe, 0x52, 0x8a, 0xc4, 0xad, 0x53, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x8c, 0x10, 0x66, 0x53, 0x0b, 0xf9, 0x6d, 0x33, 0xff, 0x7f, 0x3b, 0xff, 0x67, 0x9c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x5c, 0xff, 0x7f, 0x1b, 0xff, 0x6d, 0x13, 0xff, 0x52, 0xca, 0xf7, 0x6b, 0x4c, 0x64, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xd7, 0x0e, 0x62, 0xeb, 0xc7, 0x53, 0x2c, 0xff, 0x86, 0x99, 0xff, 0x6f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x6f, 0x3c, 0xff, 0x7e, 0x99, 0xff, 0x4b, 0x4c, 0xff, 0x62, 0xcb, 0xc7, 0xa4, 0xd3, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x30, 0x47, 0x5a, 0xcb, 0xf5, 0x6c, 0xb2, 0xff, 0x7f, 0x1b, 0xff, 0x6f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x77, 0x1b, 0xff, 0x64, 0xf3, 0xff, 0x52, 0xca, 0xf5, 0x6b, 0x2c, 0x64, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x04, 0x6b, 0x4c, 0x99, 0x52, 0xeb, 0xff, 0x7e, 0x18, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x76, 0x98, 0xff, 0x42, 0xca, 0xfe, 0x62, 0xca, 0xb6, 0xbd, 0x34, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x96, 0x17, 0x5a, 0xca, 0xd8, 0x4b, 0xad, 0xff, 0x7e, 0xda, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x57, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3b, 0xff, 0x6f, 0x3b, 0xff, 0x6f, 0x3b, 0xff, 0x67, 0x3b, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x77, 0x1a, 0xff, 0x5c, 0x50, 0xff, 0x5a, 0xaa, 0xe9, 0x94, 0x30, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xae, 0x4f, 0x52, 0x8a, 0xf5, 0x5c, 0xf3, 0xff, 0x6f, 0x1b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x57, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x1a, 0xff, 0x76, 0x37, 0xff, 0x5c, 0xf3, 0xff, 0x6d, 0x75, 0xff, 0x76, 0xb9, 0xff, 0x67, 0x3b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x6f, 0x3b, 0xff, 0x7e, 0x17, 0xff, 0x4a, 0xcb, 0xfb, 0x6b, 0x2c, 0x83, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x62, 0xeb, 0x95, 0x4a, 0xaa, 0xfd, 0x6d, 0xf7, 0xff, 0x67, 0x3b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x76, 0xda, 0xff, 0x76, 0x59, 0xff, 0x76, 0xba, 0xff, 0x77, 0x3b, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x6e, 0x17, 0xff, 0x42, 0xeb, 0xff, 0x52, 0xaa, 0xff, 0x4a, 0xaa, 0xff, 0x4b, 0xae, 0xff, 0x7e, 0xba, 0xff, 0x6f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x86, 0xfa, 0xff, 0x53, 0xae, 0xff, 0x52, 0x89, 0xd2, 0xb5, 0x94, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x14, 0x10, 0x5a, 0x8a, 0xcb, 0x42, 0xeb, 0xff, 0x7e, 0x99, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x1b, 0xff, 0x6e, 0x37, 0xff, 0x43, 0x8d, 0xff, 0x4b, 0x2c, 0xff, 0x43, 0x4d, 0xff, 0x5d, 0x13, 0xff, 0x77, 0x1b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x5c, 0xff, 0x7e, 0xfb, 0xff, 0x54, 0x30, 0xff, 0x62, 0x8a, 0xff, 0x62, 0x69, 0xff, 0x62, 0x89, 0xff, 0x52, 0xaa, 0xff, 0x75, 0x75, 0xff, 0x7f, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x77, 0x3b, 0xff, 0x6d, 0x13, 0xff, 0x52, 0xca, 0xf4, 0x73, 0x4d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf3, 0x2b, 0x52, 0x69, 0xf0, 0x4b, 0xcf, 0xff, 0x7e, 0xfb, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x7e, 0xda, 0xff, 0x43, 0x4c, 0xff, 0x52, 0x89, 0xff, 0x5a, 0x68, 0xff, 0x52, 0x69, 0xff, 0x42, 0xca, 0xff, 0x6d, 0xd6, 0xff, 0x6f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x57, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x5c, 0xff, 0x7e, 0xdb, 0xff, 0x4b, 0x4c, 0xff, 0x6a, 0x89, 0xff, 0x6a, 0x67, 0xff, 0x62, 0x87, 0xff, 0x5a, 0xa9, 0xff, 0x54, 0x30, 0xff, 0x7f, 0x1b, 0xff, 0x6f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x6f, 0x5c, 0xff, 0x7e, 0x37, 0xff, 0x4a, 0xcb, 0xfd, 0x6b, 0x0c, 0x88, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x72, 0x4c, 0x52, 0xab, 0xfa, 0x64, 0xf3, 0xff, 0x77, 0x1b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x7d, 0xff, 0x6f, 0x5c, 0xff, 0x76, 0x37, 0xff, 0x42, 0xa9, 0xff, 0x6a, 0x89, 0xff, 0x6a, 0x68, 0xff, 0x62, 0x89, 0xff, 0x62, 0xcb, 0xff, 0x54, 0x91, 0xff, 0x77, 0x5b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x3c, 0xff, 0x76, 0xfb, 0xff, 0x76, 0x99, 0xff, 0x76, 0x79, 0xff, 0x76, 0x79, 0xff, 0x76, 0xba, 0xff, 0x77, 0x1b, 0xff, 0x6f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x76, 0xfb, 0xff, 0x4b, 0xce, 0xff, 0x62, 0xaa, 0xff, 0x6a, 0x88, 0xff, 0x6a, 0x88, 0xff, 0x62, 0xca, 0xff, 0x54, 0x71, 0xff, 0x77, 0x3b, 0xff, 0x6f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x7e, 0xda, 0xff, 0x53, 0x6d, 0xff, 0x5a, 0xaa, 0xc8, 0xd6, 0x16, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x94, 0x51, 0x81, 0x52, 0xab, 0xfe, 0x75, 0xf7, 0xff, 0x67, 0x1b, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x77, 0x5c, 0xff, 0x6d, 0xd6, 0xff, 0x4a, 0xcb, 0xff, 0x6a, 0x89, 0xff, 0x6a, 0x68, 0xff, 0x62, 0x69, 0xff, 0x5a, 0xaa, 0xff, 0x54, 0x71, 0xff, 0x6f, 0x3b, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x77, 0x1b, 0xff, 0x76, 0xfb, 0xff, 0x77, 0x1b, 0xff, 0x7e, 0xda, 0xff, 0x76, 0x17, 0xff, 0x43, 0xce, 0xff, 0x3b, 0x0b, 0xff, 0x42, 0xeb, 0xff, 0x42, 0xca, 0xff, 0x3b, 0x2b, 0xff, 0x6d, 0x74, 0xff, 0x86, 0xb9, 0xff, 0x76, 0xfb, 0xff, 0x6f, 0x1b, 0xff, 0x7f, 0x1b, 0xff, 0x65, 0x33, 0xff, 0x4a, 0xeb, 0xff, 0x5a, 0xca, 0xff, 0x62, 0xca, 0xff, 0x53, 0x2c, 0xff, 0x76, 0x38, 0xff, 0x77, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x76, 0xfa, 0xff, 0x5c, 0x70, 0xff, 0x52, 0xaa, 0xf0, 0x94, 0x30, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xf8, 0x17, 0x73, 0x6d, 0xc8, 0x53, 0x2c, 0xff, 0x7e, 0x79, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x6f, 0x3c, 0xff, 0x76, 0x79, 0xff, 0x3a, 0xeb, 0xff, 0x5a, 0x89, 0xff, 0x62, 0x69, 0xff, 0x5a, 0x89, 0xff, 0x4a, 0xca, 0xff, 0x65, 0x55, 0xff, 0x67, 0x3b, 0xff, 0x67, 0x5c, 0xff, 0x77, 0x1c, 0xff, 0x7e, 0xfb, 0xff, 0x76, 0x17, 0xff, 0x64, 0xf3, 0xff, 0x54, 0x10, 0xff, 0x4b, 0x8e, 0xff, 0x53, 0x2c, 0xff, 0x52, 0xaa, 0xff, 0x5a, 0x69, 0xff, 0x5a, 0x68, 0xff, 0x62, 0x48, 0xff, 0x5a, 0x89, 0xff, 0x3a, 0x68, 0xff, 0x32, 0xea, 0xff, 0x4c, 0x0f, 0xff, 0x65, 0x54, 0xff, 0x86, 0x99, 0xff, 0x96, 0xb9, 0xff, 0x75, 0x54, 0xff, 0x54, 0x2f, 0xff, 0x54, 0x10, 0xff, 0x6d, 0xb6, 0xff, 0x7f, 0x3c, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x1b, 0xff, 0x75, 0x95, 0xff, 0x4a, 0x89, 0xfd, 0x7b, 0x6d, 0x7d, 0xff, 0xff, 0x03, 0xff, 0xfb, 0x07, 0xb5, 0x96, 0x13, 0xac, 0xf4, 0x22, 0xb5, 0x94, 0x13, 0xfd, 0x75, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xfb, 0x07, 0x6a, 0xeb, 0x91, 0x5a, 0xca, 0xfc, 0x54, 0x0e, 0xff, 0x7e, 0xfb, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x77, 0x1b, 0xff, 0x5d, 0x13, 0xff, 0x43, 0x0b, 0xff, 0x4a, 0xaa, 0xff, 0x42, 0xcb, 0xff, 0x54, 0x50, 0xff, 0x7e, 0xdb, 0xff, 0x67, 0x1b, 0xff, 0x7e, 0xda, 0xff, 0x75, 0xb6, 0xff, 0x4c, 0x0f, 0xff, 0x4b, 0x2b, 0xff, 0x6b, 0x8d, 0xff, 0x84, 0x50, 0xff, 0xa5, 0x33, 0xff, 0x9c, 0xd2, 0xff, 0x62, 0xaa, 0xff, 0x62, 0x89, 0xff, 0x6a, 0x69, 0xff, 0x62, 0x48, 0xff, 0x52, 0x48, 0xff, 0xa5, 0x13, 0xff, 0xb5, 0xd6, 0xff, 0x8c, 0xb2, 0xff, 0x53, 0x2c, 0xff, 0x43, 0x6c, 0xff, 0x7d, 0x74, 0xff, 0x96, 0xda, 0xff, 0x86, 0xfa, 0xff, 0x7e, 0xfb, 0xff, 0x77, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x7e, 0x78, 0xff, 0x4a, 0xca, 0xff, 0x62, 0x89, 0xd5, 0x7b, 0x8d, 0x74, 0x6b, 0x0b, 0xa2, 0x5a, 0xaa, 0xbb, 0x62, 0xaa, 0xb3, 0x63, 0x0b, 0x7f, 0x9c, 0xd3, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x8b, 0xcf, 0x63, 0x5a, 0x69, 0xf3, 0x62, 0xea, 0xff, 0x64, 0x70, 0xff, 0x87, 0x1b, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x5c, 0xff, 0x7f, 0x1b, 0xff, 0x76, 0x38, 0xff, 0x65, 0x75, 0xff, 0x6d, 0xf7, 0xff, 0x7e, 0xfa, 0xff, 0x7f, 0x1b, 0xff, 0x76, 0xb9, 0xff, 0x5c, 0x91, 0xff, 0x3a, 0xca, 0xff, 0x84, 0x90, 0xff, 0xce, 0xb9, 0xff, 0xe7, 0x7c, 0xff, 0xe7, 0x9c, 0xff, 0xef, 0x9c, 0xff, 0xef, 0x9c, 0xff, 0xb5, 0x94, 0xff, 0x62, 0xea, 0xff, 0x62, 0x89, 0xff, 0x5a, 0x88, 0xff, 0xad, 0x74, 0xff, 0xe7, 0x7b, 0xff, 0xe7, 0x9c, 0xff, 0xef, 0x9c, 0xff, 0xdf, 0x3b, 0xff, 0x9d, 0x53, 0xff, 0x3a, 0xea, 0xff, 0x5c, 0xf2, 0xff, 0x7f, 0x1b, 0xff, 0x6f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x5c, 0xff, 0x76, 0x78, 0xff, 0x4b, 0x0b, 0xff, 0x5a, 0x69, 0xfa, 0x83, 0x6d, 0x90, 0x94, 0x50, 0x4a, 0xad, 0x54, 0x23, 0xbd, 0x75, 0x12, 0xe7, 0x18, 0x08, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0xd6, 0x9a, 0x0b, 0xbd, 0x75, 0x12, 0xe7, 0x3c, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x30, 0x39, 0x62, 0xaa, 0xe0, 0x62, 0xcb, 0xff, 0x5a, 0xca, 0xff, 0x6c, 0xd2, 0xff, 0x87, 0x3c, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x3c, 0xff, 0x77, 0x1b, 0xff, 0x76, 0xfb, 0xff, 0x76, 0xfb, 0xff, 0x77, 0x1b, 0xff, 0x6f, 0x1b, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x6f, 0x3c, 0xff, 0x77, 0x3c, 0xff, 0x6f, 0x3c, 0xff, 0x6f, 0x1b, 0xff, 0x7e, 0xb9, 0xff, 0x54, 0x70, 0xff, 0x4a, 0xca, 0xff, 0xb5, 0xd5, 0xff, 0xdf, 0x5a, 0xff, 0xe7, 0x5b, 0xff, 0xdf, 0x7b, 0xff, 0xdf, 0x9b, 0xff, 0xdf, 0x9b, 0xff, 0xe7, 0x7b, 0xff, 0xef, 0x9c, 0xff, 0xde, 0xf9, 0xff, 0xad, 0x74, 0xff, 0xce, 0x77, 0xff, 0xe7, 0x7b, 0xff, 0xdf, 0x7a, 0xff, 0xdf, 0x7a, 0xff, 0xdf, 0x7b, 0xff, 0xdf, 0x5a, 0xff, 0xe7, 0x7b, 0xff, 0xb5, 0xd6, 0xff, 0x4a, 0xeb, 0xff, 0x65, 0x55, 0xff, 0x77, 0x1b, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x76, 0x99, 0xff, 0x53, 0xcf, 0xff, 0x5a, 0x69, 0xf7, 0xa4, 0x92, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x75, 0x03, 0x6b, 0x4c, 0x56, 0x5a, 0x8a, 0xc3, 0x5a, 0x8a, 0xd7, 0x62, 0xea, 0xb5, 0x84, 0x10, 0x47, 0xd6, 0x7a, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x14, 0x5a, 0xeb, 0xbf, 0x52, 0xeb, 0xff, 0x84, 0x92, 0xff, 0x53, 0x2b, 0xff, 0x75, 0x54, 0xff, 0x7f, 0x3c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x9d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x7c, 0xff, 0x6f, 0x3b, 0xff, 0x4d, 0x13, 0xff, 0x44, 0x71, 0xff, 0x44, 0x30, 0xff, 0x44, 0x50, 0xff, 0x4c, 0x91, 0xff, 0x54, 0xf2, 0xff, 0x65, 0xf7, 0xff, 0x6f, 0x1c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x6f, 0x3b, 0xff, 0x7f, 0x1b, 0xff, 0x64, 0xf3, 0xff, 0x4a, 0xaa, 0xff, 0xbe, 0x16, 0xff, 0xdf, 0x7b, 0xff, 0xdf, 0x5a, 0xff, 0xdf, 0x7a, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x9a, 0xff, 0xdf, 0x9a, 0xff, 0xdf, 0x9a, 0xff, 0xdf, 0x7b, 0xff, 0xdf, 0x7b, 0xff, 0xe7, 0x7b, 0xff, 0xdf, 0x5b, 0xff, 0xdf, 0x7b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9a, 0xff, 0xd7, 0x7a, 0xff, 0xdf, 0x7a, 0xff, 0xdf, 0x7a, 0xff, 0xe7, 0x7b, 0xff, 0x9c, 0xf2, 0xff, 0x43, 0x0c, 0xff, 0x7e, 0x38, 0xff, 0x7e, 0xdb, 0xff, 0x77, 0x1b, 0xff, 0x6f, 0x3b, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x77, 0x1b, 0xff, 0x75, 0x75, 0xff, 0x5a, 0xaa, 0xfa, 0x8b, 0xee, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xad, 0x3d, 0x52, 0x89, 0xe8, 0x52, 0xeb, 0xff, 0x53, 0x6d, 0xff, 0x4a, 0xea, 0xff, 0x4a, 0x89, 0xec, 0x63, 0x0c, 0x76, 0xad, 0x75, 0x06, 0xff, 0xff, 0x03, 0x6b, 0x4d, 0x7e, 0x52, 0xcb, 0xf9, 0x6c, 0xb2, 0xff, 0x7d, 0x14, 0xff, 0x43, 0x2b, 0xff, 0x6d, 0x75, 0xff, 0x77, 0x3c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x3c, 0xff, 0x4d, 0x34, 0xff, 0x4c, 0xb2, 0xff, 0x54, 0x91, 0xff, 0x54, 0x91, 0xff, 0x54, 0x70, 0xff, 0x44, 0x0f, 0xff, 0x2b, 0xce, 0xff, 0x56, 0x18, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x5c, 0xff, 0x77, 0x3c, 0xff, 0x86, 0xda, 0xff, 0x86, 0x38, 0xff, 0x4a, 0xeb, 0xff, 0xad, 0x54, 0xff, 0xe7, 0x7b, 0xff, 0xd7, 0x9a, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x7a, 0xff, 0xdf, 0x9a, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9b, 0xff, 0xdf, 0x9c, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x9a, 0xff, 0xdf, 0x7a, 0xff, 0xd6, 0xf8, 0xff, 0xa5, 0x13, 0xff, 0x52, 0xaa, 0xff, 0x42, 0xeb, 0xff, 0x33, 0x6d, 0xff, 0x3c, 0x30, 0xff, 0x55, 0xb6, 0xff, 0x67, 0x1b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x3c, 0xff, 0x77, 0x5c, 0xff, 0x75, 0xb6, 0xff, 0x4a, 0x8a, 0xfe, 0x73, 0x4c, 0x9b, 0xb5, 0x74, 0x19, 0xde, 0xbb, 0x06, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x04, 0x62, 0xaa, 0x99, 0x42, 0x89, 0xfe, 0x75, 0x74, 0xff, 0x86, 0x99, 0xff, 0x75, 0xd6, 0xff, 0x43, 0x0c, 0xff, 0x4a, 0x69, 0xee, 0x7b, 0x8d, 0x5a, 0x94, 0x71, 0x2f, 0x4a, 0x89, 0xe3, 0x53, 0xae, 0xff, 0x86, 0x58, 0xff, 0x6d, 0x34, 0xff, 0x33, 0x0b, 0xff, 0x75, 0x75, 0xff, 0x77, 0x1c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x5c, 0xff, 0x77, 0x5c, 0xff, 0x77, 0x1b, 0xff, 0x77, 0x1b, 0xff, 0x77, 0x1b, 0xff, 0x7f, 0x1b, 0xff, 0x76, 0xda, 0xff, 0x6e, 0xfb, 0xff, 0x6f, 0x1c, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5d, 0xff, 0x6f, 0x3c, 0xff, 0x66, 0x79, 0xff, 0x4c, 0xf3, 0xff, 0x54, 0x30, 0xff, 0x53, 0x6d, 0xff, 0x5a, 0xca, 0xff, 0x7b, 0xce, 0xff, 0xae, 0x15, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x7a, 0xff, 0xcf, 0x9a, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0xbc, 0xff, 0xd7, 0x9c, 0xff, 0xd7, 0xbc, 0xff, 0xdf, 0xbc, 0xff, 0xd7, 0x9b, 0xff, 0xdf, 0x7b, 0xff, 0xd7, 0x7b, 0xff, 0xdf, 0x9a, 0xff, 0xdf, 0x9a, 0xff, 0xd6, 0xd9, 0xff, 0xb5, 0x95, 0xff, 0x73, 0xae, 0xff, 0x5b, 0x6d, 0xff, 0x85, 0xf6, 0xff, 0x65, 0xd6, 0xff, 0x4d, 0x55, 0xff, 0x66, 0xfb, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x5c, 0xff, 0x65, 0xb5, 0xff, 0x4a, 0xca, 0xff, 0x5a, 0x68, 0xee, 0x5a, 0x89, 0xab, 0x6b, 0x2c, 0x94, 0x83, 0xae, 0x69, 0xbd, 0x76, 0x1c, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x57, 0x12, 0x52, 0x68, 0xd7, 0x4b, 0x2c, 0xff, 0x7e, 0x99, 0xff, 0x6f, 0x1b, 0xff, 0x6f, 0x1b, 0xff, 0x75, 0xf7, 0xff, 0x42, 0xcb, 0xff, 0x52, 0x89, 0xde, 0x6b, 0x0b, 0xba, 0x42, 0xca, 0xfc, 0x7e, 0x17, 0xff, 0x76, 0xba, 0xff, 0x65, 0x75, 0xff, 0x33, 0x0c, 0xff, 0x6d, 0x55, 0xff, 0x77, 0x1c, 0xff, 0x67, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x6f, 0x3b, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x55, 0xd6, 0xff, 0x5d, 0x34, 0xff, 0x7d, 0x54, 0xff, 0x63, 0x8d, 0xff, 0x83, 0xce, 0xff, 0xb5, 0xb5, 0xff, 0xc6, 0xb8, 0xff, 0xdf, 0x7b, 0xff, 0xd7, 0x5a, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x9a, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x7a, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x9c, 0xff, 0xc7, 0x5b, 0xff, 0xbf, 0x1a, 0xff, 0xbf, 0x1a, 0xff, 0xc7, 0x7c, 0xff, 0xd7, 0x9c, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x7b, 0xff, 0xdf, 0x9b, 0xff, 0xe7, 0x7b, 0xff, 0xe7, 0x7b, 0xff, 0x9d, 0x13, 0xff, 0x53, 0x8d, 0xff, 0x86, 0xda, 0xff, 0x6f, 0x3b, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x7e, 0xb9, 0xff, 0x5b, 0xce, 0xff, 0x6b, 0x2b, 0xd4, 0xbd, 0x75, 0x28, 0x7b, 0x8d, 0x43, 0x6a, 0xeb, 0x97, 0x62, 0xaa, 0xab, 0x83, 0xef, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x54, 0x1a, 0x4a, 0x69, 0xe6, 0x4b, 0xae, 0xff, 0x7e, 0xdb, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x7e, 0xfb, 0xff, 0x5c, 0xb2, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xfe, 0x54, 0x30, 0xff, 0x7e, 0xfb, 0xff, 0x6e, 0xfa, 0xff, 0x5d, 0x95, 0xff, 0x3b, 0x4d, 0xff, 0x65, 0x34, 0xff, 0x6f, 0x3b, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x5c, 0xff, 0x7f, 0x3c, 0xff, 0x7e, 0xda, 0xff, 0x6e, 0x17, 0xff, 0x4d, 0x75, 0xff, 0x66, 0xda, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x5c, 0xff, 0x77, 0x3b, 0xff, 0x8e, 0xd9, 0xff, 0x63, 0xce, 0xff, 0xa5, 0x33, 0xff, 0xe7, 0x7b, 0xff, 0xdf, 0x7b, 0xff, 0xdf, 0x7b, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x7a, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x7a, 0xff, 0xcf, 0x7a, 0xff, 0xc7, 0x7b, 0xff, 0xb6, 0xf9, 0xff, 0xa6, 0x98, 0xff, 0xa6, 0x99, 0xff, 0xa6, 0x98, 0xff, 0xa6, 0x99, 0xff, 0xb7, 0x1a, 0xff, 0xc7, 0x7c, 0xff, 0xd7, 0x9c, 0xff, 0xd7, 0x7b, 0xff, 0xd7, 0x7b, 0xff, 0xcf, 0x39, 0xff, 0x9d, 0x32, 0xff, 0x94, 0x91, 0xff, 0x5b, 0xae, 0xff, 0x8e, 0xfb, 0xff, 0x6f, 0x3b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5c, 0xff, 0x76, 0xfa, 0xff, 0x5c, 0x50, 0xff, 0x63, 0x2b, 0xd9, 0xd6, 0x38, 0x11, 0x00, 0x00, 0x00, 0xd6, 0x7a, 0x05, 0x7b, 0x8e, 0x29, 0x8c, 0x31, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xde, 0x57, 0x12, 0xa5, 0x13, 0x2b, 0x8c, 0x71, 0x46, 0x9c, 0x91, 0x2e, 0xde, 0x18, 0x0c, 0xb5, 0x74, 0x21, 0x52, 0x69, 0xea, 0x53, 0xae, 0xff, 0x7e, 0xdb, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x5d, 0xff, 0x6f, 0x3c, 0xff, 0x76, 0x38, 0xff, 0x42, 0xeb, 0xff, 0x42, 0xeb, 0xff, 0x6d, 0xb6, 0xff, 0x77, 0x3c, 0xff, 0x66, 0xfb, 0xff, 0x5d, 0xb6, 0xff, 0x4c, 0x10, 0xff, 0x55, 0x13, 0xff, 0x6f, 0x1b, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x7c, 0xff, 0x67, 0x5b, 0xff, 0x7f, 0x3b, 0xff, 0x7e, 0x79, 0xff, 0x65, 0x14, 0xff, 0x43, 0xf0, 0xff, 0x33, 0x8e, 0xff, 0x54, 0xf4, 0xff, 0x6e, 0xdb, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x5b, 0xff, 0x7e, 0xd9, 0xff, 0x5b, 0xee, 0xff, 0xa5, 0x33, 0xff, 0xc6, 0x57, 0xff, 0xce, 0xf9, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9a, 0xff, 0xd7, 0x9b, 0xff, 0xd7, 0x9b, 0xff, 0xc7, 0x5b, 0xff, 0xb6, 0xd9, 0xff, 0x9e, 0x57, 0xff, 0x95, 0xf6, 0xff, 0x7d, 0x33, 0xff, 0x9e, 0x37, 0xff, 0x9e, 0x78, 0xff, 0x9e, 0x78, 0xff, 0xa6, 0xb9, 0xff, 0xbf, 0x3a, 0xff, 0xcf, 0x7c, 0xff, 0xd7, 0x5b, 0xff, 0xcf, 0x19, 0xff, 0xad, 0x94, 0xff, 0x5a, 0xca, 0xff, 0x5b, 0x8d, 0xff, 0x8e, 0x58, 0xff, 0x7f, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x7c, 0xff, 0x77, 0x1a, 0xff, 0x5c, 0xf2, 0xff, 0x5b, 0x0b, 0xe0, 0xa4, 0xb3, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x94, 0x91, 0x1b, 0x73, 0x4c, 0x7e, 0x62, 0xcb, 0xd0, 0x5a, 0xeb, 0xea, 0x52, 0xeb, 0xf3, 0x5a, 0xca, 0xeb, 0x62, 0xeb, 0xc2, 0x83, 0xae, 0x93, 0x5a, 0x89, 0xf5, 0x53, 0x8d, 0xff, 0x7e, 0xda, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x7d, 0xff, 0x67, 0x5c, 0xff, 0x76, 0x79, 0xff, 0x43, 0x0c, 0xff, 0x43, 0x8e, 0xff, 0x76, 0xda, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x5d, 0xf6, 0xff, 0x4c, 0x91, 0xff, 0x4d, 0x13, 0xff, 0x6f, 0x1b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5c, 0xff, 0x76, 0xfa, 0xff, 0x54, 0xf3, 0xff, 0x3b, 0x8e, 0xff, 0x44, 0x30, 0xff, 0x65, 0xb6, 0xff, 0x7e, 0xfb, 0xff, 0x77, 0x3c, 0xff, 0x6f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x6f, 0x1b, 0xff, 0x7e, 0xb8, 0xff, 0x63, 0xee, 0xff, 0x63, 0x2b, 0xff, 0x7c, 0x0e, 0xff, 0xc6, 0xb9, 0xff, 0xd7, 0x9c, 0xff, 0xcf, 0x9b, 0xff, 0xcf, 0x9b, 0xff, 0xcf, 0x9b, 0xff, 0xbf, 0x5b, 0xff, 0xa6, 0xb8, 0xff, 0x96, 0x36, 0xff, 0x8d, 0xd5, 0xff, 0x53, 0x4c, 0xff, 0x5b, 0x0b, 0xff, 0x6b, 0xae, 0xff, 0x9d, 0xb5, 0xff, 0xa6, 0x37, 0xff, 0x9e, 0x37, 0xff, 0x96, 0x37, 0xff, 0xa6, 0x78, 0xff, 0xb6, 0x98, 0xff, 0xbe, 0x98, 0xff, 0xa5, 0x74, 0xff, 0x53, 0x0b, 0xff, 0x5c, 0x2f, 0xff, 0x43, 0xef, 0xff, 0x6d, 0xf7, 0xff, 0x77, 0x3c, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x9c, 0xff, 0x6f, 0x3b, 0xff, 0x65, 0x54, 0xff, 0x5b, 0x0b, 0xea, 0x8c, 0x0f, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x3c, 0x09, 0xbe, 0x18, 0x2d, 0xb5, 0xd7, 0x5b, 0xb5, 0xb7, 0x61, 0xbd, 0xf7, 0x3c, 0xde, 0xbb, 0x12, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x5a, 0xaa, 0xc0, 0x52, 0xcb, 0xfa, 0x4b, 0x0c, 0xff, 0x5c, 0x71, 0xff, 0x6d, 0x13, 0xff, 0x64, 0xd2, 0xff, 0x4b, 0x6d, 0xff, 0x52, 0xca, 0xfe, 0x5a, 0xca, 0xff, 0x4b, 0x4c, 0xff, 0x7e, 0xba, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x9d, 0xff, 0x6f, 0x5c, 0xff, 0x6d, 0xd6, 0xff, 0x42, 0xeb, 0xff, 0x54, 0xb1, 0xff, 0x77, 0x3b, 0xff, 0x67, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x66, 0x79, 0xff, 0x4c, 0xf3, 0xff, 0x44, 0xd2, 0xff, 0x6e, 0xdb, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5c, 0xff, 0x55, 0xb6, 0xff, 0x2b, 0xaf, 0xff, 0x65, 0x96, 0xff, 0x7e, 0xfb, 0xff, 0x77, 0x3c, 0xff, 0x6f, 0x5c, 0xff, 0x67, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x57, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3c, 0xff, 0x76, 0x59, 0xff, 0x44, 0x0f, 0xff, 0x42, 0xeb, 0xff, 0x52, 0xea, 0xff, 0xb5, 0xf6, 0xff, 0xce, 0xda, 0xff, 0xbe, 0xfa, 0xff, 0xb7, 0x1a, 0xff, 0xae, 0xf9, 0xff, 0xae, 0xb8, 0xff, 0xa6, 0x57, 0xff, 0xa6, 0x57, 0xff, 0x85, 0x33, 0xff, 0x4b, 0x4c, 0xff, 0x4b, 0x2c, 0xff, 0x6c, 0x30, 0xff, 0x53, 0x6c, 0xff, 0x53, 0x2c, 0xff, 0x7c, 0x71, 0xff, 0x95, 0x74, 0xff, 0x9d, 0xd5, 0xff, 0x9d, 0xd5, 0xff, 0x9d, 0x54, 0xff, 0x84, 0x50, 0xff, 0x53, 0x2c, 0xff, 0x5c, 0x91, 0xff, 0x8e, 0xfa, 0xff, 0x76, 0x58, 0xff, 0x44, 0x92, 0xff, 0x66, 0x5a, 0xff, 0x6f, 0x3d, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x7c, 0xff, 0x77, 0x3b, 0xff, 0x75, 0x95, 0xff, 0x5b, 0x0b, 0xef, 0x83, 0xce, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xbd, 0xf7, 0x25, 0xad, 0x76, 0x9c, 0xad, 0x76, 0xe9, 0xb5, 0xb7, 0xfb, 0xb5, 0xb7, 0xfb, 0xb5, 0xb7, 0xf2, 0xb5, 0xb6, 0xbc, 0xbe, 0x37, 0x4b, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x4a, 0xab, 0xfe, 0x54, 0x30, 0xff, 0x7e, 0x79, 0xff, 0x76, 0xfb, 0xff, 0x77, 0x1c, 0xff, 0x7f, 0x3c, 0xff, 0x7e, 0xfa, 0xff, 0x6d, 0x54, 0xff, 0x43, 0x2c, 0xff, 0x3b, 0x4c, 0xff, 0x76, 0x79, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x7c, 0xff, 0x7f, 0x5b, 0xff, 0x65, 0x34, 0xff, 0x43, 0x2c, 0xff, 0x6d, 0xd5, 0xff, 0x6f, 0x3b, 0xff, 0x67, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x66, 0xfb, 0xff, 0x55, 0x96, 0xff, 0x34, 0xf3, 0xff, 0x66, 0xda, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x66, 0xfb, 0xff, 0x6e, 0xfb, 0xff, 0x77, 0x1c, 0xff, 0x6f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5b, 0xff, 0x66, 0x79, 0xff, 0x33, 0xcf, 0xff, 0x5d, 0x54, 0xff, 0x8e, 0x58, 0xff, 0x4b, 0xad, 0xff, 0x5b, 0x4c, 0xff, 0xad, 0xb6, 0xff, 0xc6, 0x99, 0xff, 0xbe, 0x99, 0xff, 0xb6, 0xb9, 0xff, 0xae, 0x58, 0xff, 0x9d, 0x74, 0xff, 0x63, 0xce, 0xff, 0x4b, 0x0c, 0xff, 0x5b, 0xcf, 0xff, 0x75, 0x34, 0xff, 0x6d, 0x95, 0xff, 0x6d, 0x95, 0xff, 0x5c, 0x91, 0xff, 0x53, 0x6d, 0xff, 0x5b, 0x0b, 0xff, 0x63, 0x2b, 0xff, 0x63, 0x2b, 0xff, 0x6b, 0x0b, 0xff, 0x63, 0x0b, 0xff, 0x53, 0xcf, 0xff, 0x86, 0xda, 0xff, 0x77, 0x3b, 0xff, 0x77, 0x3b, 0xff, 0x77, 0x1c, 0xff, 0x6e, 0xdb, 0xff, 0x77, 0x1c, 0xff, 0x7f, 0x1c, 0xff, 0x7f, 0x1c, 0xff, 0x7f, 0x1c, 0xff, 0x77, 0x3c, 0xff, 0x7f, 0x1b, 0xff, 0x85, 0xd7, 0xff, 0x5b, 0x0c, 0xf0, 0x83, 0x8e, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x1e, 0xad, 0x75, 0xbe, 0xbe, 0x18, 0xfd, 0xef, 0x7d, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xe7, 0x5d, 0xff, 0xbe, 0x18, 0xff, 0xad, 0xb6, 0xea, 0xbd, 0xf8, 0x60, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x4a, 0xec, 0xff, 0x7e, 0x18, 0xff, 0x67, 0x1b, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x7c, 0xff, 0x7f, 0x5c, 0xff, 0x7e, 0x58, 0xff, 0x3c, 0x10, 0xff, 0x66, 0x59, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x7d, 0xff, 0x7f, 0x3b, 0xff, 0x5c, 0x91, 0xff, 0x3b, 0x4c, 0xff, 0x76, 0xb9, 0xff, 0x6f, 0x5c, 0xff, 0x67, 0x5d, 0xff, 0x57, 0x7c, 0xff, 0x67, 0x3c, 0xff, 0x66, 0x9a, 0xff, 0x4d, 0xf7, 0xff, 0x66, 0xfb, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5b, 0xff, 0x4d, 0xb6, 0xff, 0x66, 0x18, 0xff, 0x77, 0x3b, 0xff, 0x77, 0x3b, 0xff, 0x86, 0x79, 0xff, 0x53, 0xef, 0xff, 0x52, 0xeb, 0xff, 0x6b, 0x4c, 0xff, 0x7b, 0xee, 0xff, 0x73, 0xce, 0xff, 0x63, 0x0c, 0xff, 0x5a, 0xeb, 0xff, 0x53, 0x0c, 0xff, 0x64, 0x71, 0xff, 0x6d, 0x76, 0xff, 0x65, 0xb6, 0xff, 0x55, 0xd7, 0xff, 0x5d, 0xf7, 0xff, 0x75, 0xf7, 0xff, 0x7c, 0xf3, 0xff, 0x73, 0x4c, 0xff, 0xac, 0xf2, 0xff, 0xb5, 0x54, 0xff, 0xc5, 0xd7, 0xff, 0x83, 0xef, 0xff, 0x64, 0xf3, 0xff, 0x7f, 0x1c, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5d, 0xff, 0x77, 0x3c, 0xff, 0x86, 0xdb, 0xff, 0x96, 0x9a, 0xff, 0x96, 0x5a, 0xff, 0x8e, 0xba, 0xff, 0x8e, 0xfb, 0xff, 0x8d, 0xf7, 0xff, 0x5b, 0x0c, 0xf2, 0x7b, 0xcf, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x06, 0xad, 0xb6, 0x8c, 0xbe, 0x38, 0xfc, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xff, 0xc6, 0x59, 0xff, 0xad, 0x97, 0xd5, 0xd6, 0x7a, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x53, 0x2d, 0xff, 0x7e, 0x9a, 0xff, 0x5f, 0x3c, 0xff, 0x57, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x7c, 0xff, 0x6f, 0x3c, 0xff, 0x6f, 0x1c, 0xff, 0x67, 0x1c, 0xff, 0x67, 0x7d, 0xff, 0x67, 0x7d, 0xff, 0x7f, 0x3b, 0xff, 0x4c, 0x2f, 0xff, 0x43, 0xae, 0xff, 0x76, 0xfa, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x1b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x77, 0x3c, 0xff, 0x86, 0xda, 0xff, 0x53, 0x8e, 0xff, 0x6b, 0x0b, 0xff, 0x94, 0x2f, 0xff, 0x9c, 0x51, 0xff, 0xb4, 0xf4, 0xff, 0x7b, 0x8e, 0xff, 0x6c, 0x51, 0xff, 0x6d, 0x96, 0xff, 0x5d, 0xf7, 0xff, 0x56, 0x38, 0xff, 0x56, 0x58, 0xff, 0x5e, 0x99, 0xff, 0x6e, 0x99, 0xff, 0x85, 0xd6, 0xff, 0x6b, 0x2c, 0xff, 0xf7, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x8c, 0x30, 0xff, 0x6d, 0x54, 0xff, 0x6f, 0x1b, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5d, 0xff, 0x6f, 0x3c, 0xff, 0x8e, 0xdb, 0xff, 0xa6, 0x5a, 0xff, 0xae, 0x59, 0xff, 0x9e, 0x18, 0xff, 0x9e, 0x38, 0xff, 0xa5, 0xf8, 0xff, 0x94, 0xf3, 0xf9, 0xa5, 0x55, 0x8b, 0xc6, 0x59, 0x33, 0xce, 0x7a, 0x35, 0xce, 0x5a, 0x41, 0xbe, 0x39, 0x67, 0xad, 0xb7, 0xe8, 0xef, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x9e, 0xff, 0xad, 0xb7, 0xf7, 0xb5, 0xd7, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x4b, 0x2c, 0xff, 0x7e, 0x59, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x77, 0x1a, 0xff, 0x43, 0xce, 0xff, 0x4c, 0x10, 0xff, 0x77, 0x1b, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x77, 0x1b, 0xff, 0x65, 0x13, 0xff, 0x6b, 0x4d, 0xff, 0xf7, 0x5c, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0x94, 0x51, 0xff, 0x64, 0xb2, 0xff, 0x6e, 0x39, 0xff, 0x66, 0xdb, 0xff, 0x67, 0x1c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x6f, 0x3c, 0xff, 0x86, 0x79, 0xff, 0x52, 0xeb, 0xff, 0xde, 0xda, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0x5b, 0x0c, 0xff, 0x75, 0xd6, 0xff, 0x6f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x6f, 0x3c, 0xff, 0x86, 0xdb, 0xff, 0x9e, 0x7a, 0xff, 0xbe, 0xbb, 0xff, 0xdf, 0x9e, 0xff, 0xc6, 0xdc, 0xff, 0xb6, 0x18, 0xff, 0xad, 0xd7, 0xff, 0xad, 0xb7, 0xfa, 0xad, 0x97, 0xf0, 0xad, 0x96, 0xf0, 0xad, 0x97, 0xf3, 0xad, 0xb7, 0xfa, 0xad, 0xb7, 0xff, 0xef, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xb5, 0xd7, 0xfb, 0xb5, 0xd7, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x4a, 0xeb, 0xff, 0x6d, 0x96, 0xff, 0x76, 0xfb, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x76, 0xfa, 0xff, 0x33, 0x6d, 0xff, 0x4c, 0x92, 0xff, 0x77, 0x1b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x1b, 0xff, 0x76, 0x38, 0xff, 0x42, 0xeb, 0xff, 0xde, 0x99, 0xff, 0xff, 0xde, 0xff, 0xff, 0xde, 0xff, 0x7b, 0xf0, 0xff, 0x6d, 0x14, 0xff, 0x76, 0xdb, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x6f, 0x5d, 0xff, 0x86, 0xda, 0xff, 0x4b, 0x0c, 0xff, 0xd6, 0x59, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x99, 0xff, 0x3a, 0xaa, 0xff, 0x7e, 0x79, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x77, 0x1c, 0xff, 0x8e, 0xbb, 0xff, 0xa6, 0x5a, 0xff, 0xd7, 0x3d, 0xff, 0xe7, 0xbf, 0xff, 0xe7, 0xbf, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x5d, 0xff, 0xd6, 0xfc, 0xff, 0xd6, 0xdb, 0xff, 0xd6, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xe7, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xff, 0xb5, 0xd7, 0xfa, 0xb5, 0xd8, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x52, 0xaa, 0xf4, 0x54, 0x30, 0xff, 0x76, 0x9a, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x57, 0x7d, 0xff, 0x57, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x77, 0x1b, 0xff, 0x3b, 0xf0, 0xff, 0x4c, 0xf3, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x7e, 0xda, 0xff, 0x4b, 0xae, 0xff, 0xad, 0x14, 0xff, 0xff, 0xfe, 0xff, 0xf7, 0xbd, 0xff, 0x6b, 0xae, 0xff, 0x6d, 0x75, 0xff, 0x6f, 0x1c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5d, 0xff, 0x87, 0x1b, 0xff, 0x4b, 0x6d, 0xff, 0xbd, 0x96, 0xff, 0xff, 0xde, 0xff, 0xa5, 0x13, 0xff, 0x4b, 0xce, 0xff, 0x7e, 0xda, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x6f, 0x3d, 0xff, 0x7e, 0xfc, 0xff, 0x96, 0x9a, 0xff, 0xae, 0x5a, 0xff, 0xdf, 0x7e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0xbe, 0xff, 0xef, 0xdf, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xfc, 0xff, 0xad, 0x76, 0xfa, 0xc6, 0x39, 0x63, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 
-  0x62, 0xcb, 0xa9, 0x4a, 0xec, 0xfd, 0x6d, 0x75, 0xff, 0x66, 0x99, 0xff, 0x5e, 0xfb, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3c, 0xff, 0x5d, 0xb7, 0xff, 0x55, 0xd7, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x77, 0x1b, 0xff, 0x65, 0x34, 0xff, 0x63, 0x2c, 0xff, 0xf7, 0x7c, 0xff, 0xf7, 0x9d, 0xff, 0x63, 0x4d, 0xff, 0x6d, 0xd6, 0xff, 0x67, 0x3b, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x7c, 0xff, 0x7f, 0x3c, 0xff, 0x5c, 0x91, 0xff, 0x9c, 0xb2, 0xff, 0xef, 0x3c, 0xff, 0x53, 0x2c, 0xff, 0x65, 0x54, 0xff, 0x77, 0x1c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x6f, 0x3d, 0xff, 0x7e, 0xdb, 0xff, 0x96, 0x5a, 0xff, 0xae, 0x5a, 0xff, 0xd7, 0x7e, 0xff, 0xdf, 0x7e, 0xff, 0xe7, 0x9e, 0xff, 0xef, 0xdf, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x7e, 0xff, 0xc6, 0x59, 0xff, 0xb5, 0x96, 0xdf, 0xc6, 0x18, 0x5b, 0xff, 0xff, 0x03, 
-  0x6b, 0x2c, 0x2f, 0x5a, 0xab, 0xd7, 0x4b, 0x6d, 0xff, 0x6d, 0x95, 0xff, 0x66, 0x18, 0xff, 0x5e, 0x59, 0xff, 0x5e, 0xda, 0xff, 0x5f, 0x1b, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x6f, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x3b, 0xff, 0x7e, 0x99, 0xff, 0x42, 0xeb, 0xff, 0xb5, 0x95, 0xff, 0xef, 0x3c, 0xff, 0x53, 0x2c, 0xff, 0x76, 0x38, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x77, 0x3c, 0xff, 0x6d, 0x75, 0xff, 0x6b, 0xae, 0xff, 0x8c, 0x71, 0xff, 0x4b, 0xaf, 0xff, 0x7e, 0xda, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x3d, 0xff, 0x6f, 0x1c, 0xff, 0x7e, 0xbb, 0xff, 0x96, 0x39, 0xff, 0xa6, 0x19, 0xff, 0xcf, 0x1d, 0xff, 0xdf, 0x7e, 0xff, 0xdf, 0x7e, 0xff, 0xef, 0xbf, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xdb, 0xff, 0xb5, 0xd7, 0xe1, 0xc6, 0x58, 0x3b, 
-  0xff, 0xff, 0x02, 0x73, 0x2c, 0x56, 0x52, 0xaa, 0xea, 0x43, 0x2c, 0xff, 0x6d, 0x34, 0xff, 0x65, 0xd7, 0xff, 0x56, 0x38, 0xff, 0x4e, 0x79, 0xff, 0x56, 0xba, 0xff, 0x5e, 0xdb, 0xff, 0x5e, 0xfc, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x77, 0x1b, 0xff, 0x64, 0xf3, 0xff, 0x5b, 0x0c, 0xff, 0x9c, 0xd3, 0xff, 0x4b, 0x2c, 0xff, 0x76, 0x99, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x5c, 0xff, 0x7e, 0xda, 0xff, 0x54, 0x10, 0xff, 0x4b, 0xef, 0xff, 0x7e, 0x79, 0xff, 0x6f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x57, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x77, 0x1c, 0xff, 0x86, 0x59, 0xff, 0x9d, 0xf8, 0xff, 0xad, 0xd8, 0xff, 0xc6, 0x9b, 0xff, 0xdf, 0x5e, 0xff, 0xdf, 0x7e, 0xff, 0xe7, 0x9e, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x59, 0xfe, 0xbd, 0xf7, 0xb1, 
-  0x00, 0x00, 0x00, 0xc6, 0x18, 0x04, 0x5a, 0xcb, 0x70, 0x52, 0x8a, 0xeb, 0x4a, 0xcb, 0xff, 0x64, 0x71, 0xff, 0x6d, 0x75, 0xff, 0x65, 0xf7, 0xff, 0x56, 0x38, 0xff, 0x56, 0x38, 0xff, 0x56, 0x59, 0xff, 0x56, 0xba, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x57, 0x7c, 0xff, 0x57, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3c, 0xff, 0x7e, 0xda, 0xff, 0x54, 0x71, 0xff, 0x4b, 0xaf, 0xff, 0x54, 0xf3, 0xff, 0x77, 0x1b, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x6f, 0x3c, 0xff, 0x77, 0x1c, 0xff, 0x77, 0x3c, 0xff, 0x77, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3d, 0xff, 0x67, 0x3d, 0xff, 0x6f, 0x1b, 0xff, 0x6d, 0xd6, 0xff, 0x5b, 0x8e, 0xff, 0xa5, 0x34, 0xd9, 0xb5, 0xf8, 0xd3, 0xb6, 0x19, 0xfe, 0xce, 0xfc, 0xff, 0xdf, 0x5e, 0xff, 0xe7, 0x7e, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1c, 0xff, 0xb5, 0xd7, 0xf2, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x04, 0x6b, 0x4d, 0x53, 0x4a, 0x69, 0xd2, 0x42, 0xaa, 0xfa, 0x4b, 0x4c, 0xff, 0x54, 0x50, 0xff, 0x65, 0x34, 0xff, 0x6d, 0x96, 0xff, 0x6d, 0xd6, 0xff, 0x5e, 0x58, 0xff, 0x5e, 0xba, 0xff, 0x5f, 0x1b, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3c, 0xff, 0x77, 0x1b, 0xff, 0x76, 0xda, 0xff, 0x76, 0xfb, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x7c, 0xff, 0x57, 0x7c, 0xff, 0x57, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3d, 0xff, 0x67, 0x3d, 0xff, 0x66, 0xba, 0xff, 0x65, 0x54, 0xff, 0x4a, 0xaa, 0xfe, 0x73, 0x8d, 0x8f, 0xce, 0x9a, 0x41, 0xad, 0xd7, 0xf4, 0xad, 0xf8, 0xff, 0xdf, 0x5e, 0xff, 0xdf, 0x5d, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7e, 0xff, 0xb5, 0xb7, 0xfb, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x83, 0xcf, 0x1a, 0x62, 0xec, 0x6f, 0x4a, 0x89, 0xcf, 0x4a, 0xa9, 0xf7, 0x42, 0xca, 0xfe, 0x53, 0x6d, 0xff, 0x64, 0x50, 0xff, 0x6d, 0x74, 0xff, 0x6e, 0x59, 0xff, 0x66, 0xba, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x7c, 0xff, 0x57, 0x7c, 0xff, 0x57, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3d, 0xff, 0x5e, 0xfb, 0xff, 0x5e, 0x17, 0xff, 0x5c, 0x92, 0xff, 0x4a, 0x89, 0xfc, 0x7b, 0xce, 0x71, 0xbe, 0x38, 0x55, 0xb5, 0xf8, 0xfa, 0xdf, 0x5e, 0xff, 0xdf, 0x7e, 0xff, 0xe7, 0x9e, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xbf, 0xff, 0xd6, 0xfc, 0xff, 0xad, 0xb7, 0xfb, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x9c, 0xd1, 0x16, 0x5a, 0xaa, 0x60, 0x52, 0x8a, 0xad, 0x5a, 0xaa, 0xe2, 0x5b, 0x0b, 0xf9, 0x4b, 0x4d, 0xff, 0x6d, 0x55, 0xff, 0x6e, 0x7a, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x3c, 0xff, 0x56, 0x99, 0xff, 0x5d, 0xb6, 0xff, 0x53, 0xae, 0xff, 0x4a, 0x69, 0xf4, 0x94, 0x91, 0x3e, 0xb5, 0xf7, 0x8c, 0xbe, 0x39, 0xff, 0xdf, 0x9e, 0xff, 0xe7, 0x9e, 0xff, 0xef, 0xdf, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xef, 0xbf, 0xff, 0xef, 0xdf, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xdf, 0xff, 0xe7, 0x9e, 0xff, 0xe7, 0x7e, 0xff, 0xc6, 0x9a, 0xff, 0xad, 0x96, 0xed, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x75, 0x06, 0x7b, 0xad, 0x26, 0x73, 0x8d, 0x6a, 0x5b, 0x0c, 0xeb, 0x5b, 0xd0, 0xff, 0x75, 0xf8, 0xff, 0x66, 0xba, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x3b, 0xff, 0x67, 0x3b, 0xff, 0x5f, 0x1b, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5c, 0xff, 0x5e, 0xdb, 0xff, 0x56, 0x38, 0xff, 0x6d, 0x55, 0xff, 0x4a, 0xeb, 0xff, 0x52, 0x69, 0xcf, 0xbd, 0xb5, 0x18, 0xb5, 0xd7, 0xa3, 0xbe, 0x59, 0xff, 0xdf, 0x9f, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xe7, 0xbf, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x5e, 0xff, 0xd7, 0x5e, 0xff, 0xdf, 0x5e, 0xff, 0xdf, 0x5e, 0xff, 0xb5, 0xf8, 0xfa, 0xb5, 0xd7, 0x8c, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x04, 0x63, 0x2c, 0x8e, 0x53, 0x2c, 0xfc, 0x6d, 0x14, 0xff, 0x66, 0x58, 0xff, 0x5e, 0xfb, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5b, 0xff, 0x6f, 0x3b, 0xff, 0x7f, 0x3b, 0xff, 0x8f, 0x7c, 0xff, 0x97, 0x9c, 0xff, 0x97, 0xbc, 0xff, 0x97, 0xbd, 0xff, 0x97, 0x9c, 0xff, 0x87, 0x3b, 0xff, 0x6f, 0x3b, 0xff, 0x67, 0x5b, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x3c, 0xff, 0x5e, 0x99, 0xff, 0x5d, 0xf7, 0xff, 0x6c, 0xf4, 0xff, 0x4a, 0xaa, 0xfc, 0x62, 0xeb, 0x83, 0xc6, 0x18, 0x04, 0xb5, 0xf7, 0x8c, 0xb6, 0x39, 0xff, 0xdf, 0x7e, 0xff, 0xdf, 0x9e, 0xff, 0xd7, 0x7e, 0xff, 0xdf, 0x7e, 0xff, 0xe7, 0x9e, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x7e, 0xff, 0xd7, 0x5e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x5e, 0xff, 0xd7, 0x5e, 0xff, 0xd7, 0x3d, 0xff, 0xb6, 0x39, 0xfd, 0xad, 0xb7, 0xc2, 0xbe, 0x38, 0x22, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x8e, 0x34, 0x5a, 0xeb, 0xe8, 0x53, 0xef, 0xff, 0x65, 0xd6, 0xff, 0x56, 0x79, 0xff, 0x5f, 0x1b, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5b, 0xff, 0x67, 0x3b, 0xff, 0x77, 0x3b, 0xff, 0x8f, 0x5c, 0xff, 0xa7, 0xbd, 0xff, 0xbf, 0xfe, 0xff, 0xc7, 0xfd, 0xff, 0xc7, 0xfd, 0xff, 0xc7, 0xfd, 0xff, 0xc7, 0xfd, 0xff, 0xc7, 0xfd, 0xff, 0xbf, 0xfe, 0xff, 0xa7, 0xde, 0xff, 0x8f, 0x7c, 0xff, 0x77, 0x1b, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5e, 0xba, 0xff, 0x56, 0x18, 0xff, 0x65, 0xd6, 0xff, 0x5c, 0x30, 0xff, 0x52, 0xaa, 0xee, 0x7b, 0x8e, 0x3d, 0x00, 0x00, 0x00, 0xb5, 0xf7, 0x44, 0xad, 0xf8, 0xf1, 0xcf, 0x1d, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xd7, 0x7e, 0xff, 0xdf, 0x7e, 0xff, 0xdf, 0x7e, 0xff, 0xc6, 0xbb, 0xff, 0xbe, 0x7a, 0xff, 0xce, 0xfc, 0xff, 0xcf, 0x1d, 0xff, 0xbe, 0xbb, 0xff, 0xad, 0xf8, 0xf8, 0xad, 0x97, 0xb8, 0xb5, 0xf7, 0x34, 0xff, 0xff, 0x01, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x08, 0x5a, 0xaa, 0xab, 0x53, 0x0b, 0xfe, 0x65, 0x14, 0xff, 0x55, 0xf7, 0xff, 0x56, 0x9a, 0xff, 0x67, 0x3c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5b, 0xff, 0x6f, 0x1a, 0xff, 0x87, 0x5b, 0xff, 0xaf, 0xdd, 0xff, 0xbf, 0xfe, 0xff, 0xcf, 0xfd, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xbf, 0xdd, 0xff, 0xb7, 0xfe, 0xff, 0xa7, 0xbd, 0xff, 0x77, 0x1b, 0xff, 0x67, 0x5b, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x57, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x1b, 0xff, 0x56, 0x39, 0xff, 0x55, 0xf7, 0xff, 0x6d, 0x95, 0xff, 0x53, 0x4c, 0xff, 0x5a, 0xca, 0xc2, 0xad, 0x75, 0x0f, 0x00, 0x00, 0x00, 0xc6, 0xbb, 0x0c, 0xad, 0xb7, 0x9d, 0xb6, 0x18, 0xfb, 0xd7, 0x1d, 0xff, 0xdf, 0x9e, 0xff, 0xdf, 0x7e, 0xff, 0xdf, 0x7e, 0xff, 0xdf, 0x7e, 0xff, 0xce, 0xbb, 0xff, 0xad, 0xd8, 0xee, 0xb5, 0xf8, 0xb4, 0xb5, 0xd7, 0xd6, 0xad, 0xd7, 0xe3, 0xad, 0xb7, 0xc0, 0xad, 0x96, 0x6c, 0xb5, 0xf7, 0x1a, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x2c, 0x4b, 0x52, 0x8a, 0xf1, 0x54, 0x10, 0xff, 0x5d, 0xb6, 0xff, 0x56, 0x38, 0xff, 0x56, 0x9a, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3b, 0xff, 0x77, 0x3a, 0xff, 0xa7, 0xbc, 0xff, 0xbf, 0xfd, 0xff, 0xc7, 0xfd, 0xff, 0xc7, 0xdd, 0xff, 0xcf, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xd7, 0xfc, 0xff, 0xcf, 0xfc, 0xff, 0xcf, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xd7, 0xdb, 0xff, 0xd7, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xc7, 0xdc, 0xff, 0xbf, 0xfd, 0xff, 0x9f, 0xbd, 0xff, 0x6f, 0x3b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x1b, 0xff, 0x56, 0x59, 0xff, 0x55, 0xd7, 0xff, 0x5d, 0xb7, 0xff, 0x64, 0xf3, 0xff, 0x52, 0xca, 0xfc, 0x6b, 0x0c, 0x7d, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x38, 0x19, 0xad, 0xb7, 0x9a, 0xad, 0xb7, 0xf2, 0xb6, 0x19, 0xfe, 0xc6, 0x7a, 0xff, 0xc6, 0x7a, 0xff, 0xb5, 0xf8, 0xfd, 0xad, 0xb7, 0xdf, 0xb5, 0xd7, 0x64, 0xdf, 0x7d, 0x0d, 0xce, 0x9a, 0x16, 0xc6, 0x59, 0x1c, 0xce, 0xfb, 0x0e, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x75, 0x0c, 0x42, 0x28, 0xc3, 0x42, 0xcb, 0xff, 0x6d, 0x55, 0xff, 0x55, 0xd7, 0xff, 0x56, 0x59, 0xff, 0x56, 0x9a, 0xff, 0x5f, 0x1c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x1b, 0xff, 0x7f, 0x5b, 0xff, 0xaf, 0xfd, 0xff, 0xc7, 0xfd, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xd7, 0xdb, 0xff, 0xd7, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xd7, 0xdb, 0xff, 0xd7, 0xdb, 0xff, 0xd7, 0xbb, 0xff, 0xd7, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xbf, 0xfd, 0xff, 0x8f, 0x7c, 0xff, 0x67, 0x1b, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x3c, 0xff, 0x56, 0xfb, 0xff, 0x56, 0x99, 0xff, 0x55, 0xd8, 0xff, 0x55, 0xb7, 0xff, 0x65, 0x96, 0xff, 0x53, 0xcf, 0xff, 0x5a, 0xaa, 0xe9, 0x7b, 0x6e, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x39, 0x0d, 0xb5, 0xb7, 0x4e, 0xad, 0x97, 0x97, 0xad, 0xb7, 0xba, 0xad, 0x96, 0xb4, 0xad, 0xb6, 0x83, 0xb5, 0xb7, 0x33, 0xc7, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x2c, 0x50, 0x42, 0x69, 0xf2, 0x5c, 0x51, 0xff, 0x65, 0xb6, 0xff, 0x55, 0xf8, 0xff, 0x56, 0x39, 0xff, 0x5e, 0xba, 0xff, 0x5f, 0x1c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x3c, 0xff, 0x8f, 0x5c, 0xff, 0xb7, 0xfd, 0xff, 0xc7, 0xfd, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xd7, 0xbc, 0xff, 0xd7, 0xbc, 0xff, 0xd7, 0xbc, 0xff, 0xc7, 0xfd, 0xff, 0xaf, 0xdd, 0xff, 0x6e, 0xfb, 0xff, 0x67, 0x3c, 0xff, 0x5e, 0xfb, 0xff, 0x56, 0x59, 0xff, 0x4e, 0x18, 0xff, 0x55, 0xb7, 0xff, 0x5d, 0xb6, 0xff, 0x65, 0x13, 0xff, 0x4a, 0xcb, 0xfe, 0x62, 0xab, 0xa0, 0xde, 0xbb, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xd6, 0x7a, 0x05, 0xce, 0xdb, 0x0d, 0xce, 0x59, 0x09, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x94, 0x0d, 0x52, 0xaa, 0xad, 0x4a, 0xeb, 0xfe, 0x75, 0x14, 0xff, 0x65, 0xb7, 0xff, 0x55, 0xf8, 0xff, 0x56, 0x58, 0xff, 0x5e, 0xba, 0xff, 0x67, 0x1c, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x67, 0x3b, 0xff, 0x87, 0x7c, 0xff, 0xb7, 0xfe, 0xff, 0xcf, 0xfd, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xd7, 0xbc, 0xff, 0xd7, 0xbc, 0xff, 0xcf, 0xdc, 0xff, 0xbf, 0xfd, 0xff, 0x87, 0x3b, 0xff, 0x66, 0xfa, 0xff, 0x56, 0x59, 0xff, 0x56, 0x18, 0xff, 0x55, 0xd7, 0xff, 0x55, 0x96, 0xff, 0x65, 0x95, 0xff, 0x4b, 0xad, 0xff, 0x52, 0x8a, 0xea, 0x8b, 0xf0, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x8d, 0x3b, 0x52, 0xaa, 0xe4, 0x5b, 0x8e, 0xff, 0x75, 0x76, 0xff, 0x65, 0xd7, 0xff, 0x55, 0xf7, 0xff, 0x56, 0x38, 0xff, 0x5e, 0xba, 0xff, 0x5f, 0x1c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5c, 0xff, 0x67, 0x3b, 0xff, 0x8f, 0x3b, 0xff, 0xb7, 0xfe, 0xff, 0xcf, 0xfd, 0xff, 0xd7, 0xdc, 0xff, 0xd7, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xc7, 0xdd, 0xff, 0x9f, 0x7c, 0xff, 0x66, 0x99, 0xff, 0x5e, 0x18, 0xff, 0x5d, 0xd7, 0xff, 0x55, 0xd7, 0xff, 0x65, 0x96, 0xff, 0x64, 0xd2, 0xff, 0x4a, 0xa9, 0xfd, 0x62, 0xaa, 0x99, 0xbd, 0xd7, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x73, 0x4d, 0x78, 0x52, 0xeb, 0xf5, 0x64, 0x50, 0xff, 0x75, 0xb6, 0xff, 0x5d, 0xf7, 0xff, 0x5d, 0xf8, 0xff, 0x56, 0x39, 0xff, 0x56, 0xba, 0xff, 0x5f, 0x1b, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x5c, 0xff, 0x6f, 0x3b, 0xff, 0x7f, 0x3a, 0xff, 0xbf, 0xfd, 0xff, 0xcf, 0xfd, 0xff, 0xcf, 0xdc, 0xff, 0xd7, 0xdb, 0xff, 0xd7, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xfb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xd7, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xcf, 0x9c, 0xff, 0xbf, 0x9c, 0xff, 0x9f, 0x5b, 0xff, 0x66, 0x37, 0xff, 0x5d, 0xf7, 0xff, 0x65, 0xd7, 0xff, 0x5d, 0x96, 0xff, 0x6d, 0x34, 0xff, 0x4b, 0x0b, 0xff, 0x52, 0x69, 0xd8, 0x8c, 0x10, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x0c, 0x63, 0x2c, 0xa3, 0x53, 0x2b, 0xfc, 0x6c, 0xd2, 0xff, 0x6d, 0xb6, 0xff, 0x5d, 0xd7, 0xff, 0x55, 0xf7, 0xff, 0x56, 0x38, 0xff, 0x56, 0x9a, 0xff, 0x5f, 0x1b, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7c, 0xff, 0x5f, 0x3c, 0xff, 0x77, 0x3b, 0xff, 0xaf, 0xbc, 0xff, 0xc7, 0xfd, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xc7, 0xbc, 0xff, 0xc7, 0x7b, 0xff, 0xbf, 0x5b, 0xff, 0xaf, 0x3a, 0xff, 0x97, 0x1b, 0xff, 0x65, 0xf7, 0xff, 0x5d, 0xf7, 0xff, 0x65, 0xd7, 0xff, 0x6d, 0x96, 0xff, 0x5b, 0xce, 0xff, 0x52, 0x8a, 0xf3, 0x6b, 0x4d, 0x63, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x50, 0x26, 0x5a, 0xaa, 0xcf, 0x4a, 0xeb, 0xff, 0x6d, 0x14, 0xff, 0x5d, 0xb6, 0xff, 0x55, 0xd7, 0xff, 0x55, 0xd7, 0xff, 0x4e, 0x18, 0xff, 0x56, 0x79, 0xff, 0x5e, 0xfb, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x3b, 0xff, 0x97, 0x9c, 0xff, 0xbf, 0xfd, 0xff, 0xc7, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xc7, 0xbc, 0xff, 0xbf, 0x7b, 0xff, 0xb7, 0x3a, 0xff, 0xaf, 0x1a, 0xff, 0xaf, 0x1a, 0xff, 0x96, 0xda, 0xff, 0x65, 0xf7, 0xff, 0x5d, 0xf7, 0xff, 0x75, 0xb6, 0xff, 0x64, 0x71, 0xff, 0x4a, 0xca, 0xfc, 0x62, 0xcb, 0x9c, 0xcd, 0x75, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x7b, 0x6e, 0x59, 0x52, 0xaa, 0xf4, 0x53, 0xef, 0xff, 0x65, 0x96, 0xff, 0x5d, 0xb6, 0xff, 0x55, 0xb7, 0xff, 0x55, 0xd7, 0xff, 0x55, 0xd7, 0xff, 0x56, 0x38, 0xff, 0x56, 0x9a, 0xff, 0x5e, 0xfb, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x7f, 0x3b, 0xff, 0xb7, 0xfd, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdb, 0xff, 0xd7, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdb, 0xff, 0xcf, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0xbc, 0xff, 0xc7, 0xbc, 0xff, 0xbf, 0x7b, 0xff, 0xb7, 0x5a, 0xff, 0xaf, 0x1a, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xf9, 0xff, 0xa7, 0x1a, 0xff, 0x8e, 0x9a, 0xff, 0x65, 0xf7, 0xff, 0x6d, 0xd6, 0xff, 0x6c, 0xd2, 0xff, 0x53, 0x0b, 0xfe, 0x5a, 0xeb, 0xbd, 0x8c, 0x10, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x34, 0x16, 0x52, 0x8a, 0xdd, 0x4b, 0x6d, 0xff, 0x65, 0x75, 0xff, 0x5d, 0x96, 0xff, 0x55, 0xb6, 0xff, 0x55, 0xb7, 0xff, 0x55, 0xb7, 0xff, 0x55, 0xd7, 0xff, 0x56, 0x18, 0xff, 0x56, 0x39, 0xff, 0x56, 0x7a, 0xff, 0x5e, 0xfb, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x3c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x6f, 0x1b, 0xff, 0x9f, 0xbd, 0xff, 0xc7, 0xfd, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xd7, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0xbc, 0xff, 0xc7, 0x9c, 0xff, 0xbf, 0x7b, 0xff, 0xbf, 0x5b, 0xff, 0xaf, 0x1a, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xf9, 0xff, 0x9e, 0xd9, 0xff, 0x9e, 0xd9, 0xff, 0x9e, 0xfa, 0xff, 0x7e, 0x58, 0xff, 0x75, 0xb6, 0xff, 0x6c, 0xd3, 0xff, 0x53, 0x0c, 0xff, 0x62, 0xeb, 0xf9, 0x8c, 0x30, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xbb, 0x0c, 0x5a, 0xaa, 0xc9, 0x53, 0x2c, 0xff, 0x6d, 0x75, 0xff, 0x5d, 0x96, 0xff, 0x55, 0xb6, 0xff, 0x55, 0xd7, 0xff, 0x55, 0xb7, 0xff, 0x5d, 0xd7, 0xff, 0x5d, 0xd7, 0xff, 0x5d, 0xf8, 0xff, 0x56, 0x18, 0xff, 0x56, 0x39, 0xff, 0x5e, 0x79, 0xff, 0x66, 0x9a, 0xff, 0x5e, 0xda, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x77, 0x3b, 0xff, 0xb7, 0xfe, 0xff, 0xcf, 0xdd, 0xff, 0xd7, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xc7, 0xbc, 0xff, 0xc7, 0x9c, 0xff, 0xbf, 0x7b, 0xff, 0xbf, 0x7b, 0xff, 0xb7, 0x5b, 0xff, 0xb7, 0x3a, 0xff, 0xaf, 0x1a, 0xff, 0xa6, 0xfa, 0xff, 0x9e, 0xd9, 0xff, 0x9e, 0xd9, 0xff, 0x9e, 0xd9, 0xff, 0xa6, 0xfa, 0xff, 0x9e, 0xda, 0xff, 0x75, 0x74, 0xff, 0x5c, 0x71, 0xff, 0x4b, 0x2c, 0xff, 0x5a, 0xcb, 0xff, 0x62, 0xeb, 0xf4, 0x94, 0x50, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x62, 0xcb, 0xa0, 0x52, 0xab, 0xff, 0x6d, 0x34, 0xff, 0x65, 0x96, 0xff, 0x55, 0xb6, 0xff, 0x55, 0xd7, 0xff, 0x55, 0xb7, 0xff, 0x5d, 0xb6, 0xff, 0x5d, 0xb6, 0xff, 0x55, 0xb6, 0xff, 0x55, 0xd7, 0xff, 0x55, 0xd7, 0xff, 0x5d, 0xd7, 0xff, 0x55, 0x55, 0xff, 0x3c, 0x91, 0xff, 0x6f, 0x3b, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x87, 0x3b, 0xff, 0xbf, 0xfd, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xdc, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0xbc, 0xff, 0xcf, 0xbc, 0xff, 0xc7, 0xbc, 0xff, 0xcf, 0xbc, 0xff, 0xc7, 0x9c, 0xff, 0xc7, 0x7b, 0xff, 0xbf, 0x7b, 0xff, 0xb7, 0x5b, 0xff, 0xb7, 0x3b, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x1a, 0xff, 0xaf, 0x1a, 0xff, 0xa6, 0xfa, 0xff, 0x9e, 0xd9, 0xff, 0x9e, 0xd9, 0xff, 0x9e, 0xda, 0xff, 0x9e, 0xd9, 0xff, 0x9e, 0xd9, 0xff, 0xa6, 0xda, 0xff, 0x96, 0x17, 0xff, 0x5b, 0xce, 0xff, 0x43, 0x0b, 0xff, 0x5b, 0x8d, 0xff, 0x73, 0xce, 0xff, 0x62, 0xca, 0xf2, 0x94, 0x30, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x71, 0x5a, 0xaa, 0xfa, 0x6c, 0xd2, 0xff, 0x65, 0x96, 0xff, 0x55, 0xb7, 0xff, 0x55, 0xd7, 0xff, 0x5d, 0xb7, 0xff, 0x55, 0x14, 0xff, 0x54, 0xd4, 0xff, 0x65, 0x56, 0xff, 0x5d, 0x96, 0xff, 0x5d, 0x96, 0xff, 0x6d, 0x96, 0xff, 0x43, 0xce, 0xff, 0x44, 0x50, 0xff, 0x76, 0xfb, 0xff, 0x67, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x5f, 0x5d, 0xff, 0x67, 0x3c, 0xff, 0x66, 0xda, 0xff, 0x75, 0xf6, 0xff, 0xbf, 0xbd, 0xff, 0xbf, 0x9c, 0xff, 0xc7, 0x9c, 0xff, 0xbf, 0x7c, 0xff, 0xbf, 0x7b, 0xff, 0xbf, 0x7b, 0xff, 0xb7, 0x5b, 0xff, 0xb7, 0x5b, 0xff, 0xb7, 0x3a, 0xff, 0xb7, 0x3a, 0xff, 0xaf, 0x3a, 0xff, 0xaf, 0x1a, 0xff, 0xaf, 0x1a, 0xff, 0xae, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xf9, 0xff, 0x9e, 0xd9, 0xff, 0xa6, 0xd9, 0xff, 0xa6, 0xb9, 0xff, 0xa6, 0xd9, 0xff, 0xa6, 0xb9, 0xff, 0xa6, 0xb9, 0xff, 0x8d, 0x95, 0xff, 0x53, 0x6c, 0xff, 0x42, 0xeb, 0xff, 0x53, 0xae, 0xff, 0x7d, 0x54, 0xff, 0x6c, 0x30, 0xff, 0x5a, 0xcb, 0xf1, 0x8c, 0x50, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xce, 0x33, 0x52, 0x8a, 0xeb, 0x53, 0xef, 0xff, 0x6d, 0x96, 0xff, 0x5d, 0xb7, 0xff, 0x55, 0xd7, 0xff, 0x5d, 0xb6, 0xff, 0x5d, 0x34, 0xff, 0x33, 0xae, 0xff, 0x43, 0xcf, 0xff, 0x64, 0xf2, 0xff, 0x75, 0x55, 0xff, 0x75, 0x34, 0xff, 0x3b, 0x0b, 0xff, 0x54, 0xb2, 0xff, 0x76, 0xdb, 0xff, 0x67, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x5f, 0x7d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x3c, 0xff, 0x66, 0xba, 0xff, 0x55, 0x74, 0xff, 0x54, 0x2f, 0xff, 0xb7, 0x1b, 0xff, 0xaf, 0x3b, 0xff, 0xb7, 0x1a, 0xff, 0xb7, 0x1a, 0xff, 0xaf, 0x1a, 0xff, 0xaf, 0x1a, 0xff, 0xaf, 0x1a, 0xff, 0xaf, 0x1a, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xf9, 0xff, 0xa6, 0xf9, 0xff, 0xa6, 0xf9, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xf9, 0xff, 0x9e, 0xf9, 0xff, 0x9e, 0xf9, 0xff, 0xa6, 0xda, 0xff, 0xae, 0xb9, 0xff, 0xae, 0xb9, 0xff, 0xa6, 0x17, 0xff, 0x74, 0x50, 0xff, 0x4b, 0x0b, 0xff, 0x4a, 0xeb, 0xff, 0x5c, 0x10, 0xff, 0x6d, 0x55, 0xff, 0x6d, 0x75, 0xff, 0x5c, 0x30, 0xff, 0x5a, 0xca, 0xee, 0x94, 0x31, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd4, 0x0b, 0x62, 0xeb, 0xb3, 0x4b, 0x2c, 0xff, 0x75, 0x55, 0xff, 0x65, 0xb6, 0xff, 0x55, 0xb6, 0xff, 0x5d, 0xb6, 0xff, 0x65, 0x95, 0xff, 0x65, 0x14, 0xff, 0x4b, 0xae, 0xff, 0x42, 0xeb, 0xff, 0x53, 0x6c, 0xff, 0x63, 0x8e, 0xff, 0x42, 0xca, 0xff, 0x5d, 0x14, 0xff, 0x6e, 0xdb, 0xff, 0x67, 0x7d, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x66, 0xfb, 0xff, 0x66, 0x17, 0xff, 0x4b, 0xef, 0xff, 0x5b, 0xce, 0xff, 0xae, 0xd9, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xda, 0xff, 0xa6, 0xda, 0xff, 0xa6, 0xd9, 0xff, 0x9e, 0xd9, 0xff, 0x9e, 0xd9, 0xff, 0x9e, 0xd9, 0xff, 0x9e, 0xd9, 0xff, 0x9e, 0xd9, 0xff, 0x9e, 0xd9, 0xff, 0x9e, 0xd9, 0xff, 0xa6, 0xda, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xd9, 0xff, 0xae, 0xd9, 0xff, 0xae, 0xb9, 0xff, 0x9d, 0xd6, 0xff, 0x74, 0x70, 0xff, 0x4a, 0xcb, 0xff, 0x52, 0xec, 0xff, 0x53, 0xae, 0xff, 0x6c, 0xd3, 0xff, 0x75, 0x76, 0xff, 0x65, 0x96, 0xff, 0x65, 0x96, 0xff, 0x53, 0xef, 0xff, 0x52, 0x89, 0xe7, 0x8c, 0x10, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x73, 0x8e, 0x59, 0x52, 0xcb, 0xf6, 0x6c, 0x92, 0xff, 0x6d, 0x75, 0xff, 0x55, 0x96, 0xff, 0x55, 0xb6, 0xff, 0x5d, 0x96, 0xff, 0x65, 0x76, 0xff, 0x74, 0xf4, 0xff, 0x5b, 0x4c, 0xff, 0x62, 0xcb, 0xff, 0x5a, 0x8a, 0xfe, 0x4a, 0xca, 0xff, 0x65, 0x54, 0xff, 0x66, 0xba, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x67, 0x5d, 0xff, 0x67, 0x5c, 0xff, 0x5f, 0x5c, 0xff, 0x5f, 0x3c, 0xff, 0x66, 0xba, 0xff, 0x65, 0x75, 0xff, 0x42, 0xcb, 0xff, 0x84, 0xb1, 0xff, 0xae, 0xfa, 0xff, 0xa7, 0x1a, 0xff, 0xa7, 0x1b, 0xff, 0xa7, 0x1a, 0xff, 0xa7, 0x1a, 0xff, 0xa7, 0x1a, 0xff, 0xa7, 0x1a, 0xff, 0xa7, 0x1a, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xa6, 0xfa, 0xff, 0xae, 0xfa, 0xff, 0xae, 0xfa, 0xff, 0xb6, 0xfa, 0xff, 0xbe, 0xfa, 0xff, 0xbe, 0xda, 0xff, 0xae, 0x57, 0xff, 0x95, 0x33, 0xff, 0x6b, 0xce, 0xff, 0x5a, 0xeb, 0xff, 0x52, 0xaa, 0xff, 0x53, 0x6d, 0xff, 0x6c, 0xb3, 0xff, 0x6d, 0x95, 0xff, 0x6d, 0xb6, 0xff, 0x65, 0xb7, 0xff, 0x5d, 0x97, 0xff, 0x6d, 0x76, 0xff, 0x4b, 0x8e, 0xff, 0x4a, 0x69, 0xd6, 0xac, 0xd3, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x96, 0x13, 0x5a, 0xaa, 0xc4, 0x53, 0x0c, 0xff, 0x75, 0x34, 0xff, 0x5d, 0x75, 0xff, 0x55, 0x96, 0xff, 0x5d, 0x96, 0xff, 0x65, 0x76, 0xff, 0x7d, 0x14, 0xff, 0x5b, 0x2c, 0xff, 0x73, 0x0c, 0xd9, 0x73, 0x2c, 0xb0, 0x4a, 0xa9, 0xfe, 0x65, 0x54, 0xff, 0x5e, 0x79, 0xff, 0x67, 0x3c, 0xff, 0x5f, 0x3c, 0xff, 0x67, 0x3d, 0xff, 0x67, 0x5d, 0xff, 0x5f, 0x5c, 0xff, 0x66, 0xfb, 0xff, 0x66, 0x38, 0xff, 0x54, 0x51, 0xff, 0x4a, 0xaa, 0xff, 0xad, 0xd6, 0xff, 0xb6, 0xd9, 0xff, 0xae, 0xfa, 0xff, 0xae, 0xda, 0xff, 0xa6, 0xd9, 0xff, 0xa6, 0xb9, 0xff, 0xae, 0xd9, 0xff, 0xae, 0xd9, 0xff, 0xae, 0xb9, 0xff, 0xae, 0xb9, 0xff, 0xae, 0xd9, 0xff, 0xb6, 0xb9, 0xff, 0xb6, 0x99, 0xff, 0xae, 0x58, 0xff, 0xa5, 0xb5, 0xff, 0x8c, 0xd2, 0xff, 0x6b, 0xae, 0xff, 0x52, 0xca, 0xfe, 0x5a, 0xa9, 0xf5, 0x6a, 0xcb, 0xdd, 0x6a, 0xcb, 0xf6, 0x63, 0x0c, 0xff, 0x8d, 0x55, 0xff, 0x6d, 0xb6, 0xff, 0x5d, 0xb6, 0xff, 0x5d, 0xd7, 0xff, 0x55, 0xd7, 0xff, 0x5d, 0xb7, 0xff, 0x75, 0x75, 0xff, 0x4b, 0x0c, 0xff, 0x52, 0x69, 0xb6, 0xde, 0xbb, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x4d, 0x50, 0x52, 0x8a, 0xe9, 0x5b, 0xae, 0xff, 0x6d, 0x14, 0xff, 0x65, 0x55, 0xff, 0x6d, 0x55, 0xff, 0x75, 0x75, 0xff, 0x64, 0x10, 0xff, 0x62, 0xeb, 0xf3, 0x83, 0xaf, 0x60, 0x7b, 0x6e, 0x75, 0x42, 0xaa, 0xfd, 0x65, 0x54, 0xff, 0x5e, 0x18, 0xff, 0x5e, 0xda, 0xff, 0x5f, 0x1c, 0xff, 0x67, 0x3d, 0xff, 0x67, 0x1c, 0xff, 0x66, 0xfb, 0xff, 0x66, 0x39, 0xff, 0x6d, 0x75, 0xff, 0x4b, 0x0b, 0xff, 0x5a, 0xcb, 0xff, 0x84, 0x70, 0xff, 0x8c, 0xf2, 0xff, 0x95, 0x34, 0xff, 0x95, 0x75, 0xff, 0x9d, 0x95, 0xff, 0x9d, 0x95, 0xff, 0x9d, 0x74, 0xff, 0x95, 0x34, 0xff, 0x84, 0xd2, 0xff, 0x7c, 0x91, 0xff, 0x74, 0x0f, 0xff, 0x63, 0x6c, 0xff, 0x52, 0xea, 0xff, 0x4a, 0x89, 0xfc, 0x52, 0x69, 0xf7, 0x5a, 0x89, 0xe5, 0x62, 0xcb, 0xbe, 0x6b, 0x0c, 0x91, 0x7b, 0x6e, 0x49, 0xc5, 0x96, 0x1d, 0x7b, 0x2c, 0x93, 0x62, 0xeb, 0xfd, 0x6c, 0x51, 0xff, 0x75, 0xb6, 0xff, 0x65, 0x96, 0xff, 0x5d, 0xb7, 0xff, 0x5d, 0xd7, 0xff, 0x65, 0xb6, 0xff, 0x6c, 0xf3, 0xff, 0x52, 0xcb, 0xf9, 0x73, 0x2c, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x75, 0x03, 0x6b, 0x2c, 0x62, 0x52, 0xaa, 0xed, 0x53, 0x8e, 0xff, 0x6c, 0xb2, 0xff, 0x74, 0xd3, 0xff, 0x5b, 0xce, 0xff, 0x63, 0x2c, 0xf1, 0x73, 0x4c, 0x7c, 0xdd, 0x75, 0x06, 0x6b, 0x2c, 0x62, 0x42, 0xaa, 0xfc, 0x65, 0x34, 0xff, 0x5d, 0xf8, 0xff, 0x5e, 0x99, 0xff, 0x5e, 0xda, 0xff, 0x5e, 0xdb, 0xff, 0x5e, 0xba, 0xff, 0x5e, 0x59, 0xff, 0x6d, 0xd7, 0xff, 0x64, 0x51, 0xff, 0x5a, 0xca, 0xfb, 0x5a, 0x69, 0xea, 0x52, 0x48, 0xec, 0x52, 0x48, 0xf2, 0x52, 0x48, 0xf4, 0x52, 0x48, 0xf5, 0x52, 0x69, 0xf5, 0x52, 0x69, 0xf4, 0x5a, 0x8a, 0xf2, 0x52, 0x69, 0xf0, 0x52, 0x69, 0xea, 0x52, 0x28, 0xe3, 0x52, 0x49, 0xd6, 0x5a, 0x69, 0xbc, 0x5a, 0x8a, 0x92, 0x62, 0xcb, 0x75, 0x73, 0x0d, 0x47, 0x83, 0xaf, 0x23, 0xa4, 0x71, 0x0b, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x72, 0x1f, 0x6b, 0x2c, 0xc3, 0x5b, 0x2c, 0xfe, 0x6c, 0x92, 0xff, 0x75, 0x97, 0xff, 0x65, 0x97, 0xff, 0x6d, 0x97, 0xff, 0x7d, 0x55, 0xff, 0x63, 0xae, 0xff, 0x5a, 0xcb, 0xd4, 0x94, 0x51, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x04, 0x62, 0xec, 0x53, 0x62, 0xcb, 0xc5, 0x5a, 0xcb, 0xe9, 0x62, 0xeb, 0xe7, 0x6b, 0x0c, 0xc2, 0x73, 0x4d, 0x56, 0xad, 0x75, 0x06, 0x00, 0x00, 0x00, 0x73, 0x2d, 0x53, 0x4a, 0x8a, 0xfa, 0x64, 0xd3, 0xff, 0x65, 0xf7, 0xff, 0x5e, 0x38, 0xff, 0x5e, 0x39, 0xff, 0x5e, 0x38, 0xff, 0x5e, 0x38, 0xff, 0x65, 0xd7, 0xff, 0x75, 0x14, 0xff, 0x5a, 0xeb, 0xfb, 0x6b, 0x0c, 0x99, 0xa4, 0xb2, 0x21, 0x8b, 0xf0, 0x21, 0x8b, 0xcf, 0x36, 0x83, 0x4e, 0x42, 0x73, 0x2d, 0x49, 0x73, 0x0c, 0x4a, 0x73, 0x2d, 0x46, 0x83, 0x6e, 0x3f, 0x83, 0x8f, 0x34, 0x83, 0xcf, 0x20, 0xa4, 0x51, 0x15, 0xb5, 0x14, 0x10, 0xce, 0x59, 0x09, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xf0, 0x2d, 0x63, 0x0c, 0xc7, 0x5b, 0x0b, 0xfe, 0x64, 0x31, 0xff, 0x75, 0x14, 0xff, 0x74, 0xf3, 0xff, 0x6b, 0xef, 0xff, 0x5a, 0xcb, 0xf3, 0x6b, 0x0c, 0x68, 0x84, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x8b, 0xd1, 0x13, 0x73, 0x4e, 0x2f, 0x7b, 0x6d, 0x2b, 0x8c, 0x51, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xb0, 0x32, 0x52, 0xaa, 0xec, 0x53, 0xef, 0xff, 0x6d, 0x96, 0xff, 0x65, 0xb7, 0xff, 0x5d, 0xb7, 0xff, 0x5d, 0xd7, 0xff, 0x65, 0xd6, 0xff, 0x6d, 0x14, 0xff, 0x53, 0x4d, 0xfe, 0x5a, 0xcb, 0xc8, 0x9c, 0x72, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xae, 0x26, 0x62, 0xcb, 0xb1, 0x5a, 0xcc, 0xf4, 0x52, 0xeb, 0xfd, 0x52, 0xcb, 0xfc, 0x5a, 0xab, 0xe8, 0x6a, 0xcc, 0x83, 0xa4, 0x51, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x59, 0x09, 0x5a, 0xab, 0xb6, 0x52, 0xcb, 0xff, 0x74, 0xb2, 0xff, 0x75, 0x76, 0xff, 0x75, 0x96, 0xff, 0x75, 0x95, 0xff, 0x6c, 0xd3, 0xff, 0x4b, 0x0c, 0xff, 0x52, 0xaa, 0xd8, 0x83, 0xef, 0x38, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x12, 0x10, 0x73, 0x2d, 0x4d, 0x6b, 0x0c, 0x74, 0x6a, 0xec, 0x6c, 0x7b, 0x8f, 0x30, 0xbd, 0xd7, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xaf, 0x32, 0x5a, 0x8b, 0xd1, 0x52, 0xcb, 0xfe, 0x6b, 0xcf, 0xff, 0x6c, 0x50, 0xff, 0x5b, 0xae, 0xff, 0x52, 0xcb, 0xfc, 0x5a, 0x8b, 0xcf, 0x83, 0xcf, 0x3d, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x83, 0xcf, 0x2a, 0x6a, 0xec, 0x97, 0x5a, 0x8a, 0xd9, 0x52, 0x89, 0xe7, 0x5a, 0xaa, 0xd0, 0x6b, 0x0c, 0x80, 0x94, 0x11, 0x20, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x18, 0x04, 0xa4, 0xb3, 0x13, 0x94, 0x32, 0x19, 0xa5, 0x14, 0x10, 0x84, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x02, 0x66, 0x66, 0x66, 0x05, 0x92, 0x92, 0x92, 0x0e, 0x92, 0x9e, 0x9e, 0x15, 0x8b, 0x8b, 0x8b, 0x16, 0x80, 0x8b, 0x8b, 0x16, 0x92, 0x92, 0x92, 0x15, 0x92, 0x92, 0x92, 0x0e, 0x7f, 0x7f, 0x7f, 0x06, 0x7f, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x04, 0xaa, 0xaa, 0xb8, 0x12, 0x7f, 0x84, 0x89, 0x36, 0x67, 0x6c, 0x6c, 0x5c, 0x57, 0x5f, 0x5b, 0x8c, 0x54, 0x5c, 0x56, 0xab, 0x50, 0x59, 0x51, 0xc6, 0x50, 0x5a, 0x4f, 0xcf, 0x53, 0x5b, 0x51, 0xd2, 0x55, 0x5d, 0x55, 0xd3, 0x51, 0x59, 0x53, 0xd0, 0x55, 0x5d, 0x59, 0xc6, 0x5c, 0x5f, 0x5f, 0xae, 0x61, 0x65, 0x66, 0x8e, 0x67, 0x6c, 0x6e, 0x68, 0x75, 0x75, 0x75, 0x3b, 0x8f, 0x8f, 0x99, 0x19, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x9f, 0xaa, 0xaa, 0x18, 0x69, 0x6c, 0x72, 0x55, 0x60, 0x65, 0x66, 0x9d, 0x59, 0x5e, 0x5b, 0xcf, 0x58, 0x5d, 0x52, 0xeb, 0x58, 0x5e, 0x4a, 0xf8, 0x5c, 0x63, 0x48, 0xfd, 0x69, 0x70, 0x47, 0xff, 0x75, 0x7c, 0x49, 0xff, 0x87, 0x8d, 0x54, 0xff, 0x92, 0x98, 0x5c, 0xff, 0x92, 0x97, 0x5e, 0xff, 0x89, 0x8e, 0x5b, 0xff, 0x7d, 0x82, 0x54, 0xff, 0x6f, 0x75, 0x4d, 0xff, 0x66, 0x69, 0x50, 0xfd, 0x64, 0x66, 0x58, 0xf9, 0x60, 0x63, 0x57, 0xee, 0x5f, 0x61, 0x5b, 0xd5, 0x5d, 0x5d, 0x64, 0xa4, 0x66, 0x66, 0x6c, 0x5a, 0x99, 0x99, 0x99, 0x19, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0x09, 0x8e, 0x92, 0x97, 0x36, 0x6c, 0x6e, 0x6f, 0x87, 0x5c, 0x61, 0x5b, 0xd6, 0x5a, 0x60, 0x54, 0xf5, 0x5e, 0x65, 0x4d, 0xfe, 0x70, 0x78, 0x4d, 0xff, 0x8b, 0x92, 0x53, 0xff, 0xaa, 0xaf, 0x63, 0xff, 0xc3, 0xc7, 0x72, 0xff, 0xd1, 0xd5, 0x6f, 0xff, 0xda, 0xde, 0x72, 0xff, 0xdd, 0xe1, 0x70, 0xff, 0xdf, 0xe3, 0x70, 0xff, 0xdf, 0xe2, 0x72, 0xff, 0xde, 0xdf, 0x75, 0xff, 0xdb, 0xde, 0x78, 0xff, 0xd5, 0xdb, 0x78, 0xff, 0xcb, 0xd0, 0x79, 0xff, 0xb7, 0xbb, 0x72, 0xff, 0x9a, 0x9f, 0x63, 0xff, 0x74, 0x79, 0x4e, 0xff, 0x5f, 0x62, 0x4c, 0xfe, 0x55, 0x57, 0x51, 0xf6, 0x4f, 0x51, 0x53, 0xd5, 0x63, 0x65, 0x6b, 0x7c, 0x92, 0x99, 0x99, 0x23, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xe3, 0xe3, 0x09, 0x7e, 0x81, 0x8c, 0x47, 0x61, 0x61, 0x6a, 0xaa, 0x64, 0x68, 0x60, 0xea, 0x65, 0x6b, 0x50, 0xfd, 0x7b, 0x82, 0x56, 0xff, 0xa0, 0xa9, 0x70, 0xff, 0xbf, 0xc8, 0x7e, 0xff, 0xd0, 0xd9, 0x7b, 0xff, 0xd7, 0xdf, 0x6e, 0xff, 0xdf, 0xe4, 0x66, 0xff, 0xe1, 0xe4, 0x60, 0xff, 0xdf, 0xe6, 0x5d, 0xff, 0xdf, 0xe7, 0x59, 0xff, 0xe0, 0xe9, 0x57, 0xff, 0xe2, 0xea, 0x57, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe2, 0xe7, 0x5b, 0xff, 0xe3, 0xe6, 0x5d, 0xff, 0xe3, 0xe5, 0x5f, 0xff, 0xdf, 0xe3, 0x60, 0xff, 0xdb, 0xe0, 0x67, 0xff, 0xd4, 0xdc, 0x6e, 0xff, 0xcd, 0xd5, 0x76, 0xff, 0xbe, 0xc5, 0x72, 0xff, 0x9e, 0xa7, 0x64, 0xff, 0x6d, 0x73, 0x4b, 0xff, 0x54, 0x57, 0x49, 0xfb, 0x56, 0x59, 0x59, 0xd8, 0x5f, 0x61, 0x63, 0x76, 0xaa, 0xaa, 0xaa, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x95, 0x9a, 0xa3, 0x3a, 0x61, 0x68, 0x6d, 0xa9, 0x51, 0x56, 0x57, 0xef, 0x5d, 0x61, 0x51, 0xfe, 0x84, 0x89, 0x56, 0xff, 0xba, 0xc3, 0x71, 0xff, 0xd3, 0xdb, 0x7a, 0xff, 0xda, 0xe2, 0x79, 0xff, 0xdb, 0xe4, 0x6c, 0xff, 0xdd, 0xe6, 0x60, 0xff, 0xe1, 0xe9, 0x59, 0xff, 0xe3, 0xe9, 0x54, 0xff, 0xe5, 0xea, 0x55, 0xff, 0xe0, 0xe8, 0x58, 0xff, 0xdf, 0xe9, 0x58, 0xff, 0xdf, 0xea, 0x57, 0xff, 0xe1, 0xea, 0x57, 0xff, 0xe1, 0xea, 0x57, 0xff, 0xe1, 0xe9, 0x59, 0xff, 0xe3, 0xe7, 0x59, 0xff, 0xe7, 0xe7, 0x58, 0xff, 0xe4, 0xe7, 0x56, 0xff, 0xe0, 0xe6, 0x57, 0xff, 0xdd, 0xe4, 0x5c, 0xff, 0xdb, 0xe2, 0x63, 0xff, 0xd6, 0xdd, 0x65, 0xff, 0xd6, 0xde, 0x71, 0xff, 0xca, 0xd4, 0x76, 0xff, 0xae, 0xb7, 0x6c, 0xff, 0x6c, 0x71, 0x48, 0xff, 0x58, 0x59, 0x51, 0xf9, 0x5a, 0x59, 0x5e, 0xbd, 0x7e, 0x7e, 0x85, 0x45, 0xbf, 0xbf, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x14, 0x70, 0x72, 0x74, 0x80, 0x4e, 0x54, 0x54, 0xe9, 0x53, 0x5b, 0x44, 0xff, 0x7c, 0x85, 0x4d, 0xff, 0xb8, 0xbf, 0x6f, 0xff, 0xd9, 0xdf, 0x7c, 0xff, 0xdf, 0xe6, 0x70, 0xff, 0xe3, 0xea, 0x66, 0xff, 0xe6, 0xec, 0x60, 0xff, 0xe5, 0xec, 0x5a, 0xff, 0xe3, 0xeb, 0x55, 0xff, 0xe4, 0xeb, 0x54, 0xff, 0xe4, 0xea, 0x55, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe5, 0xe8, 0x58, 0xff, 0xe5, 0xe8, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe7, 0xe7, 0x57, 0xff, 0xe3, 0xe9, 0x53, 0xff, 0xe1, 0xe9, 0x54, 0xff, 0xdd, 0xe5, 0x59, 0xff, 0xdf, 0xe5, 0x67, 0xff, 0xe7, 0xeb, 0x77, 0xff, 0xe4, 0xe9, 0x79, 0xff, 0xdf, 0xe5, 0x76, 0xff, 0xd8, 0xe1, 0x6d, 0xff, 0xd7, 0xe2, 0x6d, 0xff, 0xcd, 0xd7, 0x75, 0xff, 0x9a, 0xa0, 0x61, 0xff, 0x5f, 0x60, 0x4b, 0xff, 0x55, 0x57, 0x57, 0xea, 0x67, 0x69, 0x69, 0x77, 0xc4, 0xc4, 0xc4, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xa4, 0xa4, 0xa4, 0x2d, 0x61, 0x65, 0x67, 0xb3, 0x53, 0x57, 0x4d, 0xfa, 0x68, 0x6d, 0x43, 0xff, 0xaf, 0xb4, 0x69, 0xff, 0xd4, 0xda, 0x72, 0xff, 0xdf, 0xe3, 0x68, 0xff, 0xe2, 0xe7, 0x60, 0xff, 0xe0, 0xe6, 0x5a, 0xff, 0xe3, 0xea, 0x58, 0xff, 0xe3, 0xea, 0x56, 0xff, 0xe5, 0xea, 0x55, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe7, 0xe9, 0x57, 0xff, 0xe7, 0xe9, 0x56, 0xff, 0xe2, 0xe9, 0x53, 0xff, 0xdd, 0xe6, 0x57, 0xff, 0xe1, 0xe8, 0x6a, 0xff, 0xee, 0xf4, 0x8b, 0xff, 0xea, 0xf1, 0x93, 0xff, 0xe6, 0xf1, 0x93, 0xff, 0xe8, 0xf1, 0x91, 0xff, 0xe7, 0xeb, 0x85, 0xff, 0xdf, 0xe6, 0x70, 0xff, 0xdd, 0xe4, 0x68, 0xff, 0xd9, 0xe1, 0x74, 0xff, 0xb6, 0xbd, 0x70, 0xff, 0x6b, 0x71, 0x46, 0xff, 0x52, 0x56, 0x4f, 0xf6, 0x5e, 0x61, 0x65, 0x98, 0xae, 0xb9, 0xb9, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0x95, 0x9d, 0xa1, 0x41, 0x51, 0x56, 0x51, 0xd8, 0x5d, 0x61, 0x4e, 0xfe, 0x91, 0x95, 0x57, 0xff, 0xcf, 0xd6, 0x71, 0xff, 0xdd, 0xe1, 0x6e, 0xff, 0xe1, 0xe3, 0x61, 0xff, 0xe6, 0xe7, 0x5b, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xeb, 0x57, 0xff, 0xe2, 0xe9, 0x57, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xea, 0x58, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe1, 0xe9, 0x58, 0xff, 0xe1, 0xea, 0x58, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe3, 0xe7, 0x58, 0xff, 0xdf, 0xe4, 0x5d, 0xff, 0xe3, 0xe9, 0x75, 0xff, 0xea, 0xf1, 0x92, 0xff, 0xe4, 0xef, 0x9b, 0xff, 0xe0, 0xf0, 0x98, 0xff, 0xe1, 0xf0, 0x94, 0xff, 0xe6, 0xf0, 0x95, 0xff, 0xea, 0xf1, 0x8f, 0xff, 0xdf, 0xe5, 0x72, 0xff, 0xdd, 0xe5, 0x65, 0xff, 0xd8, 0xe1, 0x6b, 0xff, 0xcd, 0xd4, 0x75, 0xff, 0x78, 0x7d, 0x4b, 0xff, 0x53, 0x55, 0x4b, 0xfa, 0x58, 0x5a, 0x60, 0xad, 0xa1, 0xa1, 0xaa, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0x90, 0x93, 0x9a, 0x47, 0x56, 0x5c, 0x5f, 0xde, 0x5e, 0x64, 0x4c, 0xff, 0x9f, 0xa5, 0x65, 0xff, 0xd6, 0xdc, 0x76, 0xff, 0xdf, 0xe6, 0x64, 0xff, 0xe0, 0xe5, 0x5d, 0xff, 0xe6, 0xe8, 0x5a, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xea, 0x59, 0xff, 0xe3, 0xe9, 0x59, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe0, 0xe6, 0x5c, 0xff, 0xe0, 0xe6, 0x6f, 0xff, 0xeb, 0xf1, 0x91, 0xff, 0xe4, 0xec, 0x9a, 0xff, 0xe0, 0xed, 0x9c, 0xff, 0xdf, 0xee, 0x99, 0xff, 0xe0, 0xee, 0x9b, 0xff, 0xe4, 0xee, 0x9b, 0xff, 0xe8, 0xf1, 0x8c, 0xff, 0xdd, 0xe6, 0x67, 0xff, 0xde, 0xe7, 0x5e, 0xff, 0xdb, 0xe4, 0x64, 0xff, 0xc9, 0xd1, 0x78, 0xff, 0x77, 0x7d, 0x4c, 0xff, 0x4b, 0x4f, 0x47, 0xfb, 0x58, 0x5e, 0x64, 0xaa, 0xae, 0xae, 0xb9, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xa6, 0xaa, 0xae, 0x39, 0x53, 0x58, 0x5c, 0xdc, 0x5a, 0x60, 0x50, 0xff, 0xa2, 0xaa, 0x69, 0xff, 0xd9, 0xe3, 0x7a, 0xff, 0xdd, 0xe5, 0x65, 0xff, 0xe1, 0xe8, 0x60, 0xff, 0xe2, 0xe8, 0x5c, 0xff, 0xe6, 0xe9, 0x59, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe6, 0xea, 0x58, 0xff, 0xe3, 0xe9, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe7, 0xeb, 0x55, 0xff, 0xe3, 0xe8, 0x58, 0xff, 0xdd, 0xe4, 0x63, 0xff, 0xe8, 0xee, 0x84, 0xff, 0xea, 0xf1, 0x9a, 0xff, 0xe1, 0xeb, 0x9c, 0xff, 0xe0, 0xed, 0x9e, 0xff, 0xdf, 0xec, 0x9f, 0xff, 0xe0, 0xea, 0x9c, 0xff, 0xe8, 0xf1, 0x90, 0xff, 0xe6, 0xef, 0x73, 0xff, 0xdd, 0xe7, 0x59, 0xff, 0xdf, 0xe9, 0x5c, 0xff, 0xd9, 0xe5, 0x6c, 0xff, 0xc8, 0xd1, 0x79, 0xff, 0x73, 0x78, 0x4b, 0xff, 0x4f, 0x52, 0x4d, 0xfb, 0x58, 0x58, 0x61, 0x99, 0xbf, 0xbf, 0xbf, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xaf, 0xaf, 0x23, 0x54, 0x5a, 0x5e, 0xcc, 0x57, 0x5a, 0x4f, 0xff, 0x9e, 0xa4, 0x69, 0xff, 0xd6, 0xdf, 0x77, 0xff, 0xde, 0xe8, 0x5d, 0xff, 0xe2, 0xeb, 0x59, 0xff, 0xe1, 0xe9, 0x5a, 0xff, 0xe4, 0xea, 0x59, 0xff, 0xe7, 0xeb, 0x59, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe6, 0xea, 0x58, 0xff, 0xe4, 0xe9, 0x59, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe7, 0xeb, 0x54, 0xff, 0xe5, 0xea, 0x56, 0xff, 0xe1, 0xe7, 0x5b, 0xff, 0xdf, 0xe7, 0x6a, 0xff, 0xe6, 0xee, 0x84, 0xff, 0xe6, 0xf0, 0x93, 0xff, 0xe2, 0xef, 0x96, 0xff, 0xdf, 0xed, 0x97, 0xff, 0xe1, 0xed, 0x98, 0xff, 0xe9, 0xf2, 0x90, 0xff, 0xe6, 0xee, 0x73, 0xff, 0xe1, 0xe9, 0x5c, 0xff, 0xe1, 0xeb, 0x58, 0xff, 0xdf, 0xea, 0x5d, 0xff, 0xd7, 0xe2, 0x68, 0xff, 0xc5, 0xcd, 0x78, 0xff, 0x6d, 0x70, 0x47, 0xff, 0x4e, 0x4f, 0x4a, 0xf7, 0x5e, 0x64, 0x68, 0x7f, 0xaa, 0xd4, 0xd4, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0x0a, 0x5a, 0x62, 0x68, 0x9f, 0x4d, 0x52, 0x4a, 0xfd, 0x88, 0x8c, 0x56, 0xff, 0xd6, 0xdc, 0x79, 0xff, 0xe0, 0xe8, 0x61, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe6, 0xea, 0x59, 0xff, 0xe4, 0xea, 0x59, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe6, 0xea, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe5, 0xea, 0x55, 0xff, 0xe5, 0xea, 0x56, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xde, 0xe7, 0x58, 0xff, 0xde, 0xe8, 0x64, 0xff, 0xe1, 0xeb, 0x74, 0xff, 0xe4, 0xf1, 0x80, 0xff, 0xe6, 0xf5, 0x88, 0xff, 0xe6, 0xf3, 0x8a, 0xff, 0xe5, 0xef, 0x7f, 0xff, 0xdf, 0xe5, 0x67, 0xff, 0xe2, 0xe7, 0x5d, 0xff, 0xe1, 0xe8, 0x58, 0xff, 0xe2, 0xea, 0x5b, 0xff, 0xdf, 0xe7, 0x5d, 0xff, 0xda, 0xe2, 0x6b, 0xff, 0xc5, 0xcb, 0x77, 0xff, 0x68, 0x6b, 0x44, 0xff, 0x4d, 0x51, 0x4d, 0xee, 0x75, 0x7b, 0x87, 0x59, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x8f, 0x8f, 0x54, 0x4f, 0x55, 0x52, 0xf3, 0x6f, 0x75, 0x49, 0xff, 0xd2, 0xd7, 0x7b, 0xff, 0xe3, 0xe7, 0x64, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe5, 0xe8, 0x58, 0xff, 0xe6, 0xe9, 0x5b, 0xff, 0xe6, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xea, 0x57, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x56, 0xff, 0xe7, 0xec, 0x55, 0xff, 0xe0, 0xe8, 0x54, 0xff, 0xdf, 0xe7, 0x5d, 0xff, 0xdd, 0xe6, 0x61, 0xff, 0xde, 0xe9, 0x67, 0xff, 0xdc, 0xe7, 0x68, 0xff, 0xdb, 0xe5, 0x64, 0xff, 0xde, 0xe4, 0x5c, 0xff, 0xe3, 0xe7, 0x5a, 0xff, 0xe2, 0xe8, 0x58, 0xff, 0xe1, 0xe7, 0x57, 0xff, 0xe1, 0xe7, 0x57, 0xff, 0xe2, 0xe7, 0x5d, 0xff, 0xdc, 0xe2, 0x6d, 0xff, 0xbd, 0xc3, 0x73, 0xff, 0x5b, 0x61, 0x43, 0xff, 0x48, 0x4e, 0x4e, 0xd8, 0x8c, 0x8c, 0x99, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xc8, 0xc8, 0x17, 0x55, 0x5c, 0x58, 0xc7, 0x59, 0x60, 0x45, 0xff, 0xb7, 0xbe, 0x73, 0xff, 0xdc, 0xe2, 0x68, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe9, 0xe9, 0x56, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x5a, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x5a, 0xff, 0xe5, 0xe9, 0x5a, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xeb, 0x58, 0xff, 0xe2, 0xeb, 0x57, 0xff, 0xe5, 0xe9, 0x59, 0xff, 0xe7, 0xe8, 0x59, 0xff, 0xe8, 0xea, 0x54, 0xff, 0xe5, 0xea, 0x54, 0xff, 0xe4, 0xe8, 0x5a, 0xff, 0xe4, 0xe7, 0x5c, 0xff, 0xe3, 0xe7, 0x5a, 0xff, 0xdf, 0xe8, 0x59, 0xff, 0xe0, 0xe9, 0x59, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe3, 0xe8, 0x56, 0xff, 0xe2, 0xea, 0x56, 0xff, 0xe3, 0xec, 0x55, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe8, 0xe9, 0x5a, 0xff, 0xe3, 0xe7, 0x60, 0xff, 0xd9, 0xe1, 0x76, 0xff, 0x9f, 0xa7, 0x69, 0xff, 0x52, 0x58, 0x47, 0xfc, 0x52, 0x59, 0x5e, 0x98, 0xaa, 0xaa, 0xc6, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x6e, 0x74, 0x72, 0x72, 0x54, 0x58, 0x55, 0xfa, 0x8e, 0x93, 0x5b, 0xff, 0xd8, 0xdf, 0x79, 0xff, 0xe0, 0xe7, 0x5e, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xe8, 0x5a, 0xff, 0xe9, 0xe9, 0x59, 0xff, 0xe8, 0xe9, 0x59, 0xff, 0xe8, 0xe9, 0x59, 0xff, 0xe6, 0xea, 0x59, 0xff, 0xe6, 0xea, 0x59, 0xff, 0xe6, 0xea, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x58, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe4, 0xeb, 0x58, 0xff, 0xe4, 0xeb, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe6, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x56, 0xff, 0xe3, 0xea, 0x56, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe3, 0xea, 0x56, 0xff, 0xe2, 0xec, 0x51, 0xff, 0xe5, 0xec, 0x56, 0xff, 0xe7, 0xe8, 0x59, 0xff, 0xe3, 0xe7, 0x59, 0xff, 0xde, 0xe7, 0x68, 0xff, 0xd4, 0xdc, 0x82, 0xff, 0x82, 0x87, 0x53, 0xff, 0x4f, 0x51, 0x4c, 0xf0, 0x64, 0x67, 0x6f, 0x57, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xba, 0xba, 0x1a, 0x5c, 0x64, 0x59, 0xd1, 0x5f, 0x66, 0x4e, 0xff, 0xc6, 0xcd, 0x7b, 0xff, 0xdf, 0xe9, 0x6c, 0xff, 0xe1, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe7, 0xe9, 0x59, 0xff, 0xe9, 0xe8, 0x5a, 0xff, 0xe9, 0xe9, 0x59, 0xff, 0xe9, 0xe9, 0x59, 0xff, 0xe9, 0xe9, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x58, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xeb, 0x57, 0xff, 0xe5, 0xeb, 0x56, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe3, 0xeb, 0x55, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe6, 0xe7, 0x5a, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe0, 0xe9, 0x5e, 0xff, 0xdb, 0xe3, 0x73, 0xff, 0xc5, 0xcb, 0x7c, 0xff, 0x54, 0x58, 0x44, 0xfe, 0x4e, 0x4f, 0x53, 0xc4, 0x99, 0xa6, 0xa6, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x7d, 0x7f, 0x84, 0x66, 0x57, 0x5e, 0x4e, 0xf9, 0x98, 0xa2, 0x67, 0xff, 0xd8, 0xe3, 0x76, 0xff, 0xe3, 0xef, 0x60, 0xff, 0xe2, 0xeb, 0x54, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe8, 0xe9, 0x5a, 0xff, 0xe9, 0xe9, 0x59, 0xff, 0xe9, 0xe9, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe5, 0xeb, 0x57, 0xff, 0xe5, 0xeb, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe7, 0x5b, 0xff, 0xe6, 0xe7, 0x5b, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe3, 0xec, 0x56, 0xff, 0xde, 0xe7, 0x62, 0xff, 0xdb, 0xe1, 0x7a, 0xff, 0x98, 0x9f, 0x6b, 0xff, 0x52, 0x56, 0x4d, 0xf7, 0x61, 0x66, 0x6b, 0x64, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb6, 0xc8, 0x0e, 0x5b, 0x5b, 0x63, 0xc7, 0x63, 0x65, 0x4d, 0xff, 0xc7, 0xd1, 0x7e, 0xff, 0xdd, 0xe7, 0x69, 0xff, 0xe3, 0xec, 0x5a, 0xff, 0xe6, 0xeb, 0x57, 0xff, 0xe4, 0xe7, 0x5a, 0xff, 0xe3, 0xea, 0x59, 0xff, 0xe4, 0xec, 0x57, 0xff, 0xe6, 0xea, 0x59, 0xff, 0xe8, 0xe9, 0x59, 0xff, 0xe7, 0xe9, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe5, 0xea, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x59, 0xff, 0xe4, 0xe9, 0x59, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe6, 0xe8, 0x5a, 0xff, 0xe5, 0xeb, 0x55, 0xff, 0xe4, 0xec, 0x54, 0xff, 0xe2, 0xea, 0x5b, 0xff, 0xde, 0xe4, 0x67, 0xff, 0xc4, 0xce, 0x7b, 0xff, 0x61, 0x67, 0x47, 0xff, 0x55, 0x56, 0x5e, 0xc7, 0x97, 0x97, 0xa2, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x85, 0x90, 0x47, 0x57, 0x57, 0x5a, 0xf5, 0x92, 0x94, 0x65, 0xff, 0xd9, 0xdf, 0x7b, 0xff, 0xe2, 0xe8, 0x65, 0xff, 0xe6, 0xeb, 0x5a, 0xff, 0xe7, 0xe8, 0x5a, 0xff, 0xe5, 0xe6, 0x5d, 0xff, 0xe3, 0xeb, 0x58, 0xff, 0xe5, 0xeb, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x5a, 0xff, 0xe3, 0xea, 0x56, 0xff, 0xe3, 0xea, 0x57, 0xff, 0xe2, 0xe8, 0x59, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe1, 0xea, 0x57, 0xff, 0xe3, 0xe9, 0x5a, 0xff, 0xe0, 0xe6, 0x5d, 0xff, 0xd7, 0xe0, 0x73, 0xff, 0x95, 0x9d, 0x5d, 0xff, 0x51, 0x56, 0x50, 0xf5, 0x5e, 0x63, 0x6b, 0x64, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x04, 0x62, 0x67, 0x6b, 0x99, 0x58, 0x5c, 0x4e, 0xff, 0xbe, 0xc1, 0x77, 0xff, 0xdf, 0xe4, 0x6b, 0xff, 0xe2, 0xe9, 0x5e, 0xff, 0xe7, 0xeb, 0x57, 0xff, 0xe8, 0xe8, 0x59, 0xff, 0xe6, 0xe6, 0x5c, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe7, 0xea, 0x57, 0xff, 0xe7, 0xe8, 0x5a, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe3, 0xe9, 0x55, 0xff, 0xe3, 0xe9, 0x54, 0xff, 0xe3, 0xe9, 0x55, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x5a, 0xff, 0xe5, 0xe8, 0x5c, 0xff, 0xe2, 0xea, 0x59, 0xff, 0xe0, 0xe9, 0x59, 0xff, 0xe0, 0xe8, 0x5d, 0xff, 0xde, 0xe7, 0x5d, 0xff, 0xe0, 0xe9, 0x5c, 0xff, 0xe1, 0xea, 0x5a, 0xff, 0xdf, 0xe7, 0x58, 0xff, 0xdd, 0xe6, 0x61, 0xff, 0xc3, 0xce, 0x73, 0xff, 0x4f, 0x58, 0x3e, 0xfe, 0x51, 0x58, 0x5e, 0xb6, 0xa2, 0xa2, 0xb9, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xb1, 0xbc, 0x17, 0x51, 0x56, 0x59, 0xd8, 0x6b, 0x73, 0x4a, 0xff, 0xcf, 0xd6, 0x74, 0xff, 0xe1, 0xe6, 0x60, 0xff, 0xe2, 0xeb, 0x57, 0xff, 0xe6, 0xed, 0x52, 0xff, 0xe7, 0xea, 0x56, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe7, 0xe9, 0x59, 0xff, 0xe8, 0xe7, 0x5b, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe2, 0xe8, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x55, 0xff, 0xe4, 0xea, 0x55, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe3, 0xe7, 0x58, 0xff, 0xe1, 0xe5, 0x59, 0xff, 0xde, 0xe5, 0x5c, 0xff, 0xdb, 0xe3, 0x62, 0xff, 0xda, 0xe2, 0x66, 0xff, 0xd8, 0xe2, 0x65, 0xff, 0xd8, 0xe4, 0x5e, 0xff, 0xdf, 0xeb, 0x5b, 0xff, 0xdf, 0xea, 0x56, 0xff, 0xdf, 0xe6, 0x57, 0xff, 0xd1, 0xde, 0x71, 0xff, 0x7d, 0x87, 0x55, 0xff, 0x4d, 0x52, 0x56, 0xe9, 0x7f, 0x85, 0x8f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x74, 0x7e, 0x4f, 0x4c, 0x4f, 0x4c, 0xf5, 0x97, 0x9c, 0x57, 0xff, 0xd9, 0xe1, 0x67, 0xff, 0xe1, 0xe7, 0x5a, 0xff, 0xe2, 0xea, 0x57, 0xff, 0xe2, 0xea, 0x56, 0xff, 0xe4, 0xeb, 0x57, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe2, 0xe8, 0x5a, 0xff, 0xe2, 0xec, 0x55, 0xff, 0xe1, 0xeb, 0x53, 0xff, 0xe1, 0xe9, 0x59, 0xff, 0xdf, 0xe5, 0x5b, 0xff, 0xe2, 0xe8, 0x61, 0xff, 0xdf, 0xe8, 0x5f, 0xff, 0xdf, 0xe9, 0x5f, 0xff, 0xe3, 0xe9, 0x5e, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe7, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x55, 0xff, 0xe2, 0xea, 0x57, 0xff, 0xe4, 0xe8, 0x5a, 0xff, 0xe5, 0xeb, 0x54, 0xff, 0xe2, 0xe8, 0x5a, 0xff, 0xe2, 0xe8, 0x5a, 0xff, 0xe3, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe6, 0xe7, 0x5c, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe2, 0xeb, 0x55, 0xff, 0xe3, 0xe8, 0x59, 0xff, 0xe6, 0xe7, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe1, 0xe6, 0x5a, 0xff, 0xd3, 0xdf, 0x6a, 0xff, 0xbb, 0xc3, 0x70, 0xff, 0x95, 0x9a, 0x5b, 0xff, 0xa4, 0xaa, 0x66, 0xff, 0xc7, 0xd2, 0x70, 0xff, 0xd9, 0xe5, 0x61, 0xff, 0xe0, 0xe8, 0x5c, 0xff, 0xe2, 0xea, 0x5b, 0xff, 0xda, 0xe4, 0x67, 0xff, 0xba, 0xc0, 0x75, 0xff, 0x56, 0x58, 0x4b, 0xfb, 0x5d, 0x63, 0x65, 0x83, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x57, 0x5c, 0x63, 0x95, 0x51, 0x54, 0x48, 0xfd, 0xb4, 0xba, 0x6b, 0xff, 0xdb, 0xe2, 0x62, 0xff, 0xe1, 0xe7, 0x58, 0xff, 0xe1, 0xe9, 0x56, 0xff, 0xe2, 0xea, 0x57, 0xff, 0xe4, 0xeb, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe1, 0xe8, 0x57, 0xff, 0xe0, 0xe6, 0x58, 0xff, 0xe1, 0xe8, 0x58, 0xff, 0xde, 0xe7, 0x59, 0xff, 0xdb, 0xe4, 0x65, 0xff, 0xd3, 0xd9, 0x71, 0xff, 0xc6, 0xc9, 0x6e, 0xff, 0xcd, 0xd2, 0x71, 0xff, 0xda, 0xe2, 0x70, 0xff, 0xe2, 0xe5, 0x62, 0xff, 0xe8, 0xeb, 0x58, 0xff, 0xe8, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x55, 0xff, 0xe1, 0xe9, 0x59, 0xff, 0xe2, 0xe6, 0x5e, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe2, 0xea, 0x55, 0xff, 0xe3, 0xea, 0x55, 0xff, 0xe4, 0xea, 0x55, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe6, 0xea, 0x58, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe3, 0xeb, 0x55, 0xff, 0xe0, 0xeb, 0x54, 0xff, 0xe0, 0xe9, 0x57, 0xff, 0xe1, 0xe9, 0x56, 0xff, 0xdf, 0xe9, 0x58, 0xff, 0xdb, 0xe4, 0x68, 0xff, 0xb7, 0xc1, 0x6b, 0xff, 0x59, 0x5d, 0x3e, 0xff, 0x51, 0x52, 0x4c, 0xff, 0x50, 0x53, 0x4a, 0xff, 0x70, 0x74, 0x49, 0xff, 0xcd, 0xd5, 0x76, 0xff, 0xdf, 0xe7, 0x67, 0xff, 0xe0, 0xe8, 0x5c, 0xff, 0xdd, 0xe8, 0x5f, 0xff, 0xd2, 0xdb, 0x7f, 0xff, 0x6f, 0x73, 0x51, 0xff, 0x4b, 0x50, 0x4e, 0xd2, 0xa1, 0xae, 0xae, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x9f, 0xaf, 0x10, 0x4d, 0x50, 0x55, 0xcb, 0x59, 0x5d, 0x42, 0xff, 0xca, 0xd0, 0x77, 0xff, 0xde, 0xe5, 0x60, 0xff, 0xdf, 0xe7, 0x55, 0xff, 0xe1, 0xe9, 0x56, 0xff, 0xe1, 0xe9, 0x56, 0xff, 0xe3, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe2, 0xe8, 0x58, 0xff, 0xe3, 0xe9, 0x5b, 0xff, 0xe1, 0xe7, 0x5f, 0xff, 0xd7, 0xe0, 0x67, 0xff, 0xb9, 0xc3, 0x67, 0xff, 0x68, 0x6e, 0x3e, 0xff, 0x60, 0x62, 0x45, 0xff, 0x64, 0x66, 0x3d, 0xff, 0x9b, 0xa0, 0x58, 0xff, 0xdb, 0xde, 0x70, 0xff, 0xe3, 0xe7, 0x5b, 0xff, 0xe7, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x56, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe2, 0xe6, 0x5d, 0xff, 0xe3, 0xe7, 0x58, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe5, 0xe8, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe1, 0xe7, 0x54, 0xff, 0xe3, 0xe9, 0x55, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe0, 0xe7, 0x56, 0xff, 0xdf, 0xe8, 0x59, 0xff, 0xdf, 0xe8, 0x5a, 0xff, 0xe0, 0xea, 0x56, 0xff, 0xde, 0xe9, 0x5e, 0xff, 0xd8, 0xdd, 0x77, 0xff, 0x7c, 0x82, 0x52, 0xff, 0x4e, 0x51, 0x5c, 0xff, 0x45, 0x4d, 0x63, 0xff, 0x44, 0x51, 0x5e, 0xff, 0x4e, 0x53, 0x52, 0xff, 0xa6, 0xab, 0x6c, 0xff, 0xdc, 0xe5, 0x74, 0xff, 0xe0, 0xe7, 0x5f, 0xff, 0xdf, 0xec, 0x5b, 0xff, 0xd6, 0xe3, 0x71, 0xff, 0x97, 0x9e, 0x64, 0xff, 0x52, 0x56, 0x50, 0xf4, 0x69, 0x69, 0x6c, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x9a, 0xa0, 0x2b, 0x4a, 0x4c, 0x4e, 0xf0, 0x74, 0x78, 0x49, 0xff, 0xd4, 0xda, 0x74, 0xff, 0xdf, 0xe6, 0x5b, 0xff, 0xe0, 0xe9, 0x54, 0xff, 0xe1, 0xe9, 0x56, 0xff, 0xe1, 0xe9, 0x56, 0xff, 0xe3, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x59, 0xff, 0xe2, 0xe9, 0x59, 0xff, 0xe1, 0xe7, 0x59, 0xff, 0xdc, 0xe4, 0x5f, 0xff, 0xcf, 0xd9, 0x76, 0xff, 0x60, 0x69, 0x3c, 0xff, 0x48, 0x51, 0x52, 0xff, 0x43, 0x4b, 0x59, 0xff, 0x48, 0x4d, 0x4f, 0xff, 0x53, 0x56, 0x43, 0xff, 0xb3, 0xb9, 0x67, 0xff, 0xdd, 0xe8, 0x68, 0xff, 0xe2, 0xe9, 0x5a, 0xff, 0xe6, 0xea, 0x57, 0xff, 0xe5, 0xea, 0x53, 0xff, 0xe6, 0xe9, 0x56, 0xff, 0xe6, 0xe8, 0x55, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe4, 0xe7, 0x5a, 0xff, 0xe2, 0xe6, 0x5c, 0xff, 0xe2, 0xe6, 0x5f, 0xff, 0xdf, 0xe5, 0x5f, 0xff, 0xe1, 0xe8, 0x62, 0xff, 0xe2, 0xe7, 0x62, 0xff, 0xe1, 0xe5, 0x60, 0xff, 0xe2, 0xe7, 0x62, 0xff, 0xe1, 0xe6, 0x5c, 0xff, 0xe3, 0xea, 0x55, 0xff, 0xe1, 0xe8, 0x5e, 0xff, 0xd7, 0xd9, 0x76, 0xff, 0x63, 0x67, 0x4a, 0xff, 0x4a, 0x4f, 0x67, 0xff, 0x3b, 0x4b, 0x66, 0xff, 0x39, 0x4f, 0x60, 0xff, 0x49, 0x54, 0x5b, 0xff, 0x7d, 0x83, 0x50, 0xff, 0xd8, 0xe1, 0x76, 0xff, 0xe2, 0xe7, 0x64, 0xff, 0xe0, 0xea, 0x5a, 0xff, 0xdc, 0xe8, 0x69, 0xff, 0xb9, 0xc2, 0x76, 0xff, 0x56, 0x58, 0x4b, 0xfd, 0x60, 0x60, 0x69, 0x88, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x8a, 0x94, 0x4c, 0x54, 0x54, 0x50, 0xfa, 0x98, 0x9c, 0x5c, 0xff, 0xda, 0xdf, 0x6c, 0xff, 0xe2, 0xe8, 0x59, 0xff, 0xe2, 0xe9, 0x54, 0xff, 0xe1, 0xe9, 0x56, 0xff, 0xe1, 0xe9, 0x56, 0xff, 0xe3, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe3, 0xe9, 0x59, 0xff, 0xe4, 0xea, 0x5c, 0xff, 0xde, 0xe8, 0x66, 0xff, 0xb8, 0xc3, 0x6d, 0xff, 0x4b, 0x52, 0x43, 0xff, 0x46, 0x4e, 0x68, 0xff, 0x42, 0x4c, 0x6b, 0xff, 0x47, 0x50, 0x63, 0xff, 0x54, 0x57, 0x5d, 0xff, 0x89, 0x91, 0x52, 0xff, 0xd8, 0xe7, 0x70, 0xff, 0xe0, 0xe9, 0x5e, 0xff, 0xe3, 0xe8, 0x59, 0xff, 0xe4, 0xea, 0x55, 0xff, 0xe3, 0xe8, 0x58, 0xff, 0xe3, 0xe8, 0x58, 0xff, 0xdf, 0xea, 0x54, 0xff, 0xde, 0xe7, 0x5c, 0xff, 0xdc, 0xe3, 0x68, 0xff, 0xd5, 0xdb, 0x70, 0xff, 0xca, 0xd0, 0x72, 0xff, 0xc4, 0xca, 0x73, 0xff, 0xc6, 0xcb, 0x70, 0xff, 0xce, 0xd5, 0x6d, 0xff, 0xd7, 0xdf, 0x6d, 0xff, 0xdd, 0xe3, 0x66, 0xff, 0xe1, 0xe8, 0x5a, 0xff, 0xe0, 0xe8, 0x5c, 0xff, 0xd9, 0xdd, 0x6f, 0xff, 0x70, 0x77, 0x47, 0xff, 0x4d, 0x53, 0x5d, 0xff, 0x43, 0x4e, 0x67, 0xff, 0x43, 0x51, 0x68, 0xff, 0x50, 0x57, 0x5e, 0xff, 0x84, 0x8a, 0x4f, 0xff, 0xda, 0xe3, 0x70, 0xff, 0xe1, 0xe7, 0x65, 0xff, 0xe2, 0xe8, 0x5d, 0xff, 0xdd, 0xe7, 0x61, 0xff, 0xcc, 0xd6, 0x7a, 0xff, 0x66, 0x6a, 0x4c, 0xff, 0x53, 0x55, 0x5b, 0xc8, 0xaf, 0xbf, 0xcf, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x88, 0x86, 0x90, 0x81, 0x57, 0x55, 0x4f, 0xfe, 0xb6, 0xba, 0x6e, 0xff, 0xda, 0xdf, 0x61, 0xff, 0xe4, 0xe7, 0x57, 0xff, 0xe2, 0xe8, 0x54, 0xff, 0xe1, 0xe9, 0x56, 0xff, 0xe1, 0xe9, 0x56, 0xff, 0xe3, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe3, 0xea, 0x5a, 0xff, 0xe3, 0xe9, 0x5b, 0xff, 0xe1, 0xe9, 0x6d, 0xff, 0xaf, 0xb6, 0x64, 0xff, 0x54, 0x58, 0x45, 0xff, 0x49, 0x4e, 0x64, 0xff, 0x43, 0x4a, 0x69, 0xff, 0x44, 0x4b, 0x5f, 0xff, 0x51, 0x55, 0x58, 0xff, 0x85, 0x8c, 0x4e, 0xff, 0xd6, 0xe5, 0x6b, 0xff, 0xdd, 0xe5, 0x5a, 0xff, 0xe1, 0xe5, 0x61, 0xff, 0xde, 0xe5, 0x63, 0xff, 0xdb, 0xe1, 0x6c, 0xff, 0xd9, 0xdd, 0x71, 0xff, 0xd5, 0xde, 0x72, 0xff, 0xcf, 0xd7, 0x7a, 0xff, 0xb8, 0xbe, 0x73, 0xff, 0x73, 0x78, 0x40, 0xff, 0x59, 0x5f, 0x3b, 0xff, 0x54, 0x5a, 0x42, 0xff, 0x52, 0x58, 0x3f, 0xff, 0x5b, 0x64, 0x38, 0xff, 0xa0, 0xab, 0x66, 0xff, 0xca, 0xd2, 0x7d, 0xff, 0xd6, 0xdc, 0x72, 0xff, 0xd8, 0xe1, 0x6a, 0xff, 0xd6, 0xdf, 0x75, 0xff, 0x97, 0xa2, 0x5e, 0xff, 0x54, 0x5c, 0x47, 0xff, 0x51, 0x59, 0x59, 0xff, 0x51, 0x57, 0x5c, 0xff, 0x5e, 0x62, 0x50, 0xff, 0xbc, 0xc2, 0x6f, 0xff, 0xdf, 0xe5, 0x6d, 0xff, 0xe1, 0xe8, 0x61, 0xff, 0xe4, 0xe7, 0x61, 0xff, 0xe1, 0xe8, 0x61, 0xff, 0xd2, 0xdd, 0x72, 0xff, 0x82, 0x8a, 0x55, 0xff, 0x4c, 0x52, 0x51, 0xf0, 0x80, 0x84, 0x8c, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xc8, 0x17, 0x6a, 0x6c, 0x73, 0xc8, 0x5e, 0x62, 0x4f, 0xff, 0xc9, 0xcd, 0x78, 0xff, 0xdf, 0xe5, 0x61, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe1, 0xe9, 0x56, 0xff, 0xe1, 0xe9, 0x56, 0xff, 0xe3, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe3, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe3, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe4, 0xe9, 0x59, 0xff, 0xe6, 0xe9, 0x5d, 0xff, 0xe1, 0xe5, 0x69, 0xff, 0xc9, 0xcd, 0x73, 0xff, 0x59, 0x5d, 0x36, 0xff, 0x4a, 0x4e, 0x55, 0xff, 0x48, 0x4b, 0x61, 0xff, 0x4b, 0x4f, 0x56, 0xff, 0x52, 0x57, 0x46, 0xff, 0xa8, 0xa9, 0x5e, 0xff, 0xd9, 0xe5, 0x63, 0xff, 0xdf, 0xe7, 0x63, 0xff, 0xdc, 0xe0, 0x72, 0xff, 0xd5, 0xdd, 0x78, 0xff, 0xb7, 0xbe, 0x6d, 0xff, 0x98, 0x9b, 0x5d, 0xff, 0x80, 0x80, 0x53, 0xff, 0x6d, 0x6e, 0x4a, 0xff, 0x63, 0x65, 0x51, 0xff, 0x51, 0x54, 0x51, 0xff, 0x46, 0x4c, 0x55, 0xff, 0x43, 0x4a, 0x5b, 0xff, 0x43, 0x49, 0x5d, 0xff, 0x45, 0x4f, 0x54, 0xff, 0x40, 0x4d, 0x38, 0xff, 0x52, 0x5a, 0x31, 0xff, 0x79, 0x7e, 0x45, 0xff, 0xa2, 0xa9, 0x5d, 0xff, 0xc4, 0xcf, 0x7f, 0xff, 0xc9, 0xd4, 0x90, 0xff, 0x9e, 0xa6, 0x71, 0xff, 0x7b, 0x83, 0x53, 0xff, 0x7c, 0x80, 0x51, 0xff, 0xaf, 0xb3, 0x6a, 0xff, 0xdd, 0xe3, 0x77, 0xff, 0xdf, 0xe4, 0x65, 0xff, 0xe1, 0xe9, 0x5c, 0xff, 0xe2, 0xe6, 0x5f, 0xff, 0xe0, 0xe6, 0x5d, 0xff, 0xd5, 0xe0, 0x69, 0xff, 0xa7, 0xb0, 0x6c, 0xff, 0x49, 0x50, 0x47, 0xfd, 0x64, 0x6a, 0x74, 0x7d, 0xff, 0xff, 0xff, 0x03, 0xdb, 0xff, 0xff, 0x07, 0xae, 0xae, 0xae, 0x13, 0x9d, 0x9d, 0xa5, 0x22, 0xa1, 0xae, 0xae, 0x13, 0xaa, 0xaa, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xdb, 0xdb, 0x07, 0x5a, 0x5b, 0x68, 0x91, 0x4d, 0x58, 0x59, 0xfc, 0x72, 0x7e, 0x53, 0xff, 0xd6, 0xdb, 0x7a, 0xff, 0xe0, 0xe6, 0x63, 0xff, 0xe1, 0xea, 0x5b, 0xff, 0xe3, 0xea, 0x56, 0xff, 0xe3, 0xea, 0x57, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xea, 0x58, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe3, 0xea, 0x56, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe5, 0xe9, 0x5a, 0xff, 0xe8, 0xe7, 0x5d, 0xff, 0xe5, 0xe8, 0x63, 0xff, 0xdb, 0xe0, 0x71, 0xff, 0x98, 0x9f, 0x58, 0xff, 0x58, 0x5f, 0x42, 0xff, 0x50, 0x55, 0x48, 0xff, 0x54, 0x59, 0x3d, 0xff, 0x82, 0x87, 0x4c, 0xff, 0xd6, 0xd6, 0x74, 0xff, 0xd6, 0xe0, 0x61, 0xff, 0xd1, 0xd7, 0x76, 0xff, 0xaf, 0xb3, 0x71, 0xff, 0x75, 0x7f, 0x47, 0xff, 0x5b, 0x63, 0x44, 0xff, 0x6a, 0x71, 0x64, 0xff, 0x82, 0x88, 0x7f, 0xff, 0x9b, 0xa2, 0x9c, 0xff, 0x92, 0x99, 0x98, 0xff, 0x4c, 0x55, 0x5e, 0xff, 0x46, 0x4f, 0x61, 0xff, 0x45, 0x4c, 0x66, 0xff, 0x41, 0x49, 0x61, 0xff, 0x3f, 0x49, 0x53, 0xff, 0x96, 0xa1, 0x9c, 0xff, 0xad, 0xb7, 0xae, 0xff, 0x8d, 0x94, 0x89, 0xff, 0x5c, 0x63, 0x4d, 0xff, 0x60, 0x6b, 0x40, 0xff, 0xa1, 0xaa, 0x74, 0xff, 0xce, 0xd9, 0x8c, 0xff, 0xd3, 0xdb, 0x7d, 0xff, 0xda, 0xdd, 0x75, 0xff, 0xe2, 0xe5, 0x6d, 0xff, 0xe1, 0xe7, 0x5f, 0xff, 0xe1, 0xe7, 0x5e, 0xff, 0xdf, 0xe9, 0x58, 0xff, 0xdf, 0xe8, 0x5c, 0xff, 0xde, 0xe6, 0x5a, 0xff, 0xdb, 0xe5, 0x65, 0xff, 0xc3, 0xcc, 0x7a, 0xff, 0x51, 0x57, 0x48, 0xff, 0x4a, 0x51, 0x62, 0xd5, 0x6a, 0x70, 0x7b, 0x74, 0x58, 0x60, 0x68, 0xa2, 0x4e, 0x55, 0x5b, 0xbb, 0x50, 0x54, 0x5d, 0xb3, 0x56, 0x5e, 0x60, 0x7f, 0x99, 0x99, 0x99, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0x79, 0x79, 0x86, 0x63, 0x4b, 0x4b, 0x5a, 0xf3, 0x4f, 0x5a, 0x5d, 0xff, 0x80, 0x8a, 0x5d, 0xff, 0xdb, 0xdf, 0x7d, 0xff, 0xe2, 0xe6, 0x62, 0xff, 0xe2, 0xe9, 0x5c, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe0, 0xeb, 0x55, 0xff, 0xe0, 0xe9, 0x57, 0xff, 0xe1, 0xe8, 0x5a, 0xff, 0xe1, 0xe7, 0x5a, 0xff, 0xe2, 0xe8, 0x59, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe3, 0xea, 0x57, 0xff, 0xe2, 0xea, 0x56, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x59, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe5, 0xe9, 0x59, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe3, 0xe8, 0x59, 0xff, 0xe2, 0xe6, 0x65, 0xff, 0xd9, 0xdf, 0x76, 0xff, 0xbd, 0xc2, 0x71, 0xff, 0xa6, 0xaa, 0x62, 0xff, 0xb5, 0xba, 0x69, 0xff, 0xd3, 0xda, 0x79, 0xff, 0xd8, 0xe0, 0x76, 0xff, 0xc9, 0xd4, 0x73, 0xff, 0x89, 0x8f, 0x54, 0xff, 0x4e, 0x56, 0x39, 0xff, 0x82, 0x90, 0x7c, 0xff, 0xc4, 0xd2, 0xc4, 0xff, 0xdd, 0xeb, 0xde, 0xff, 0xe2, 0xf1, 0xe3, 0xff, 0xe0, 0xf0, 0xe4, 0xff, 0xdf, 0xee, 0xe7, 0xff, 0xa3, 0xb1, 0xb0, 0xff, 0x50, 0x5c, 0x63, 0xff, 0x45, 0x50, 0x5f, 0xff, 0x41, 0x4e, 0x59, 0xff, 0x9d, 0xac, 0xa8, 0xff, 0xda, 0xed, 0xdf, 0xff, 0xde, 0xef, 0xdf, 0xff, 0xe2, 0xf0, 0xe4, 0xff, 0xd6, 0xe2, 0xd6, 0xff, 0x9b, 0xa7, 0x96, 0xff, 0x50, 0x5c, 0x35, 0xff, 0x91, 0x9b, 0x58, 0xff, 0xd5, 0xde, 0x7a, 0xff, 0xdc, 0xe5, 0x65, 0xff, 0xe1, 0xe8, 0x5b, 0xff, 0xe4, 0xe9, 0x5c, 0xff, 0xe1, 0xe8, 0x5b, 0xff, 0xe0, 0xea, 0x58, 0xff, 0xdf, 0xe7, 0x58, 0xff, 0xe1, 0xe8, 0x5a, 0xff, 0xde, 0xe6, 0x64, 0xff, 0xc3, 0xca, 0x71, 0xff, 0x5b, 0x5f, 0x48, 0xff, 0x46, 0x4b, 0x5b, 0xfa, 0x67, 0x6c, 0x7c, 0x90, 0x7f, 0x86, 0x91, 0x4a, 0xa0, 0xa8, 0xa8, 0x23, 0xaa, 0xaa, 0xb8, 0x12, 0xbf, 0xdf, 0xdf, 0x08, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0xd1, 0xd1, 0xd1, 0x0b, 0xaa, 0xaa, 0xb8, 0x12, 0xe3, 0xe3, 0xe3, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x82, 0x39, 0x4f, 0x52, 0x5d, 0xe0, 0x55, 0x57, 0x5f, 0xff, 0x50, 0x59, 0x56, 0xff, 0x91, 0x99, 0x68, 0xff, 0xe0, 0xe3, 0x7c, 0xff, 0xe4, 0xe9, 0x5f, 0xff, 0xe1, 0xe8, 0x59, 0xff, 0xe5, 0xea, 0x5b, 0xff, 0xe0, 0xed, 0x5a, 0xff, 0xde, 0xe7, 0x60, 0xff, 0xdc, 0xe3, 0x6a, 0xff, 0xd8, 0xde, 0x6f, 0xff, 0xd6, 0xdd, 0x6f, 0xff, 0xd6, 0xdd, 0x6d, 0xff, 0xd7, 0xe0, 0x6d, 0xff, 0xd8, 0xe1, 0x6b, 0xff, 0xdd, 0xe2, 0x65, 0xff, 0xe3, 0xe3, 0x5f, 0xff, 0xe9, 0xe8, 0x5d, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe1, 0xea, 0x56, 0xff, 0xe3, 0xea, 0x56, 0xff, 0xe6, 0xe9, 0x5b, 0xff, 0xe4, 0xe8, 0x61, 0xff, 0xe2, 0xe5, 0x68, 0xff, 0xe2, 0xe4, 0x6e, 0xff, 0xdc, 0xe2, 0x69, 0xff, 0xd9, 0xe1, 0x68, 0xff, 0xca, 0xd5, 0x76, 0xff, 0x83, 0x8a, 0x51, 0xff, 0x4f, 0x57, 0x47, 0xff, 0xa8, 0xb7, 0xad, 0xff, 0xd2, 0xe7, 0xdb, 0xff, 0xd5, 0xe9, 0xdd, 0xff, 0xd5, 0xeb, 0xd8, 0xff, 0xd5, 0xee, 0xd8, 0xff, 0xd6, 0xee, 0xda, 0xff, 0xd6, 0xeb, 0xdc, 0xff, 0xdc, 0xef, 0xe5, 0xff, 0xca, 0xdc, 0xd5, 0xff, 0x9d, 0xac, 0xa9, 0xff, 0xbb, 0xcb, 0xc7, 0xff, 0xd8, 0xec, 0xdf, 0xff, 0xd2, 0xeb, 0xd4, 0xff, 0xd3, 0xec, 0xd4, 0xff, 0xd4, 0xea, 0xd9, 0xff, 0xd3, 0xe8, 0xdb, 0xff, 0xd7, 0xeb, 0xdf, 0xff, 0xac, 0xb8, 0xb0, 0xff, 0x55, 0x5b, 0x44, 0xff, 0xa4, 0xa9, 0x63, 0xff, 0xd7, 0xde, 0x6e, 0xff, 0xdd, 0xe3, 0x61, 0xff, 0xe0, 0xe6, 0x62, 0xff, 0xde, 0xe7, 0x5d, 0xff, 0xe1, 0xe9, 0x5b, 0xff, 0xe0, 0xe7, 0x56, 0xff, 0xe4, 0xe9, 0x5a, 0xff, 0xdf, 0xe4, 0x60, 0xff, 0xcb, 0xd1, 0x6f, 0xff, 0x74, 0x78, 0x51, 0xff, 0x49, 0x4c, 0x54, 0xf7, 0x8d, 0x91, 0xa1, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0x62, 0x68, 0x6b, 0x56, 0x4d, 0x50, 0x55, 0xc3, 0x4e, 0x51, 0x58, 0xd7, 0x52, 0x5a, 0x5e, 0xb5, 0x7e, 0x81, 0x81, 0x47, 0xcc, 0xcc, 0xcc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x14, 0x58, 0x5b, 0x5b, 0xbf, 0x54, 0x5a, 0x52, 0xff, 0x8c, 0x8e, 0x81, 0xff, 0x5a, 0x62, 0x50, 0xff, 0xa0, 0xa8, 0x6d, 0xff, 0xe0, 0xe4, 0x74, 0xff, 0xe5, 0xec, 0x5a, 0xff, 0xe6, 0xee, 0x5a, 0xff, 0xe6, 0xea, 0x5b, 0xff, 0xe0, 0xea, 0x60, 0xff, 0xda, 0xe3, 0x6b, 0xff, 0x9a, 0xa0, 0x45, 0xff, 0x84, 0x8a, 0x3f, 0xff, 0x7c, 0x82, 0x3e, 0xff, 0x7e, 0x86, 0x42, 0xff, 0x84, 0x8e, 0x4a, 0xff, 0x93, 0x9c, 0x53, 0xff, 0xb6, 0xbc, 0x5d, 0xff, 0xdd, 0xdf, 0x66, 0xff, 0xe5, 0xe7, 0x5b, 0xff, 0xe6, 0xea, 0x59, 0xff, 0xe4, 0xea, 0x59, 0xff, 0xe3, 0xe9, 0x59, 0xff, 0xe5, 0xe9, 0x5a, 0xff, 0xe6, 0xe9, 0x5a, 0xff, 0xe6, 0xe8, 0x5d, 0xff, 0xe1, 0xe5, 0x61, 0xff, 0xdb, 0xe2, 0x69, 0xff, 0xd6, 0xdf, 0x74, 0xff, 0x96, 0x9d, 0x5d, 0xff, 0x51, 0x55, 0x45, 0xff, 0xb3, 0xbf, 0xb7, 0xff, 0xd4, 0xeb, 0xd9, 0xff, 0xce, 0xe9, 0xd4, 0xff, 0xd1, 0xea, 0xd5, 0xff, 0xd3, 0xed, 0xd2, 0xff, 0xcf, 0xef, 0xd3, 0xff, 0xd2, 0xef, 0xd6, 0xff, 0xd3, 0xee, 0xd7, 0xff, 0xd6, 0xed, 0xd9, 0xff, 0xd9, 0xed, 0xda, 0xff, 0xd9, 0xec, 0xdc, 0xff, 0xd6, 0xe9, 0xd9, 0xff, 0xd4, 0xeb, 0xd6, 0xff, 0xd4, 0xef, 0xd3, 0xff, 0xd2, 0xef, 0xd0, 0xff, 0xd1, 0xed, 0xd3, 0xff, 0xd0, 0xec, 0xd7, 0xff, 0xce, 0xea, 0xd7, 0xff, 0xd7, 0xec, 0xe2, 0xff, 0x90, 0x9a, 0x97, 0xff, 0x5e, 0x61, 0x42, 0xff, 0xc0, 0xc5, 0x7a, 0xff, 0xd5, 0xd9, 0x77, 0xff, 0xd8, 0xdf, 0x70, 0xff, 0xd9, 0xe3, 0x65, 0xff, 0xdf, 0xe5, 0x5c, 0xff, 0xe1, 0xe8, 0x55, 0xff, 0xe1, 0xe5, 0x55, 0xff, 0xe0, 0xe2, 0x5c, 0xff, 0xda, 0xdf, 0x73, 0xff, 0xa7, 0xac, 0x73, 0xff, 0x50, 0x52, 0x54, 0xfa, 0x72, 0x7a, 0x85, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x75, 0x75, 0x3d, 0x49, 0x50, 0x4e, 0xe8, 0x57, 0x5c, 0x4c, 0xff, 0x65, 0x6a, 0x4e, 0xff, 0x52, 0x5a, 0x49, 0xff, 0x49, 0x4e, 0x4b, 0xec, 0x5d, 0x5f, 0x61, 0x76, 0xaa, 0xaa, 0xaa, 0x06, 0xff, 0xff, 0xff, 0x03, 0x67, 0x69, 0x6b, 0x7e, 0x58, 0x59, 0x4c, 0xf9, 0x8e, 0x95, 0x6a, 0xff, 0x9d, 0xa1, 0x79, 0xff, 0x5b, 0x64, 0x41, 0xff, 0xa5, 0xab, 0x6a, 0xff, 0xe0, 0xe2, 0x70, 0xff, 0xe4, 0xec, 0x57, 0xff, 0xe2, 0xec, 0x57, 0xff, 0xe4, 0xe9, 0x5a, 0xff, 0xe1, 0xe7, 0x60, 0xff, 0xdc, 0xe2, 0x6a, 0xff, 0x9c, 0xa2, 0x47, 0xff, 0x8f, 0x94, 0x4b, 0xff, 0x8b, 0x91, 0x4f, 0xff, 0x89, 0x90, 0x4f, 0xff, 0x83, 0x8a, 0x4c, 0xff, 0x77, 0x7e, 0x3c, 0xff, 0x70, 0x77, 0x26, 0xff, 0xbd, 0xc1, 0x4e, 0xff, 0xe1, 0xe5, 0x5b, 0xff, 0xe4, 0xe7, 0x56, 0xff, 0xe3, 0xe7, 0x56, 0xff, 0xe2, 0xe8, 0x59, 0xff, 0xe3, 0xe8, 0x5d, 0xff, 0xe3, 0xe7, 0x61, 0xff, 0xe3, 0xe6, 0x67, 0xff, 0xde, 0xe3, 0x73, 0xff, 0xd1, 0xd8, 0x7f, 0xff, 0xbd, 0xc3, 0x80, 0xff, 0x55, 0x5b, 0x45, 0xff, 0xa0, 0xa6, 0xa6, 0xff, 0xda, 0xeb, 0xdc, 0xff, 0xd3, 0xee, 0xd0, 0xff, 0xcf, 0xeb, 0xce, 0xff, 0xd2, 0xed, 0xcc, 0xff, 0xd2, 0xec, 0xcd, 0xff, 0xcd, 0xed, 0xcf, 0xff, 0xcf, 0xed, 0xd1, 0xff, 0xd3, 0xee, 0xd4, 0xff, 0xd5, 0xed, 0xd3, 0xff, 0xd9, 0xef, 0xd3, 0xff, 0xda, 0xee, 0xd2, 0xff, 0xdc, 0xf0, 0xd4, 0xff, 0xd8, 0xee, 0xd3, 0xff, 0xd7, 0xef, 0xd2, 0xff, 0xd4, 0xef, 0xcf, 0xff, 0xd1, 0xed, 0xcf, 0xff, 0xd1, 0xef, 0xd3, 0xff, 0xcf, 0xed, 0xd4, 0xff, 0xc2, 0xda, 0xcc, 0xff, 0x95, 0xa1, 0x9e, 0xff, 0x50, 0x55, 0x4f, 0xff, 0x5a, 0x5d, 0x3f, 0xff, 0x6a, 0x6d, 0x31, 0xff, 0x81, 0x84, 0x34, 0xff, 0xaf, 0xb2, 0x53, 0xff, 0xda, 0xdf, 0x5d, 0xff, 0xdf, 0xe7, 0x54, 0xff, 0xe6, 0xea, 0x59, 0xff, 0xe3, 0xe5, 0x5c, 0xff, 0xdf, 0xe6, 0x6c, 0xff, 0xad, 0xb4, 0x6f, 0xff, 0x4d, 0x51, 0x4b, 0xfe, 0x5f, 0x68, 0x70, 0x9b, 0xa3, 0xad, 0xad, 0x19, 0xd4, 0xd4, 0xd4, 0x06, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x04, 0x4d, 0x55, 0x5c, 0x99, 0x45, 0x4f, 0x42, 0xfe, 0xa2, 0xaa, 0x6c, 0xff, 0xc8, 0xce, 0x7c, 0xff, 0xb3, 0xb6, 0x6f, 0xff, 0x5e, 0x61, 0x43, 0xff, 0x49, 0x4d, 0x4b, 0xee, 0x69, 0x71, 0x74, 0x5a, 0x88, 0x8d, 0x92, 0x2f, 0x4b, 0x51, 0x4a, 0xe3, 0x70, 0x75, 0x4c, 0xff, 0xc2, 0xc8, 0x80, 0xff, 0x9f, 0xa2, 0x65, 0xff, 0x5a, 0x61, 0x33, 0xff, 0xaa, 0xad, 0x6c, 0xff, 0xdf, 0xdf, 0x6f, 0xff, 0xe5, 0xeb, 0x59, 0xff, 0xe0, 0xeb, 0x57, 0xff, 0xe2, 0xe9, 0x5b, 0xff, 0xe3, 0xea, 0x5b, 0xff, 0xe0, 0xe7, 0x61, 0xff, 0xdf, 0xe6, 0x6e, 0xff, 0xdb, 0xe1, 0x73, 0xff, 0xd9, 0xde, 0x73, 0xff, 0xda, 0xde, 0x71, 0xff, 0xda, 0xde, 0x74, 0xff, 0xd2, 0xd9, 0x6f, 0xff, 0xd7, 0xdc, 0x6a, 0xff, 0xde, 0xe1, 0x64, 0xff, 0xe2, 0xe5, 0x5d, 0xff, 0xe2, 0xe6, 0x56, 0xff, 0xe4, 0xe9, 0x55, 0xff, 0xe3, 0xe9, 0x55, 0xff, 0xe5, 0xe9, 0x5e, 0xff, 0xe0, 0xe3, 0x67, 0xff, 0xca, 0xcd, 0x63, 0xff, 0x98, 0x9c, 0x4b, 0xff, 0x7e, 0x83, 0x4e, 0xff, 0x69, 0x6d, 0x53, 0xff, 0x4e, 0x58, 0x5a, 0xff, 0x6c, 0x77, 0x7a, 0xff, 0xaa, 0xbf, 0xab, 0xff, 0xd5, 0xee, 0xd3, 0xff, 0xd1, 0xea, 0xd1, 0xff, 0xd2, 0xee, 0xcb, 0xff, 0xd0, 0xec, 0xcd, 0xff, 0xcf, 0xec, 0xd0, 0xff, 0xd1, 0xec, 0xd0, 0xff, 0xd4, 0xed, 0xd1, 0xff, 0xd8, 0xee, 0xd1, 0xff, 0xdd, 0xf2, 0xd1, 0xff, 0xde, 0xf1, 0xce, 0xff, 0xdf, 0xf3, 0xd0, 0xff, 0xe0, 0xf5, 0xd4, 0xff, 0xda, 0xee, 0xd3, 0xff, 0xd7, 0xed, 0xd4, 0xff, 0xd4, 0xed, 0xd2, 0xff, 0xd3, 0xee, 0xd5, 0xff, 0xd3, 0xee, 0xd7, 0xff, 0xc8, 0xd8, 0xcf, 0xff, 0xa7, 0xb1, 0xaf, 0xff, 0x6e, 0x74, 0x73, 0xff, 0x67, 0x6c, 0x57, 0xff, 0xb3, 0xba, 0x7f, 0xff, 0xaf, 0xb6, 0x5d, 0xff, 0xa5, 0xa6, 0x49, 0xff, 0xd9, 0xdd, 0x60, 0xff, 0xde, 0xe7, 0x54, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe3, 0xe6, 0x5b, 0xff, 0xde, 0xe7, 0x65, 0xff, 0xa9, 0xb3, 0x61, 0xff, 0x52, 0x58, 0x47, 0xff, 0x42, 0x4b, 0x55, 0xee, 0x45, 0x4e, 0x55, 0xab, 0x5d, 0x62, 0x69, 0x94, 0x72, 0x72, 0x7c, 0x69, 0xad, 0xad, 0xb6, 0x1c, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xc6, 0xc6, 0x12, 0x42, 0x4a, 0x4c, 0xd7, 0x5d, 0x63, 0x44, 0xff, 0xc9, 0xcf, 0x76, 0xff, 0xda, 0xe0, 0x64, 0xff, 0xda, 0xde, 0x6a, 0xff, 0xb8, 0xbb, 0x71, 0xff, 0x55, 0x59, 0x41, 0xff, 0x47, 0x4f, 0x53, 0xde, 0x55, 0x5f, 0x65, 0xba, 0x50, 0x58, 0x40, 0xfc, 0xb7, 0xbe, 0x75, 0xff, 0xcc, 0xd3, 0x73, 0xff, 0xa7, 0xac, 0x5f, 0xff, 0x60, 0x61, 0x33, 0xff, 0xa6, 0xa8, 0x66, 0xff, 0xdd, 0xe1, 0x6d, 0xff, 0xe7, 0xeb, 0x5c, 0xff, 0xe3, 0xea, 0x59, 0xff, 0xe1, 0xe9, 0x5c, 0xff, 0xe2, 0xeb, 0x55, 0xff, 0xe4, 0xea, 0x5a, 0xff, 0xe5, 0xe9, 0x5f, 0xff, 0xe4, 0xe9, 0x5e, 0xff, 0xe3, 0xe8, 0x5c, 0xff, 0xe3, 0xe8, 0x5d, 0xff, 0xdc, 0xe3, 0x5f, 0xff, 0xda, 0xe3, 0x66, 0xff, 0xdc, 0xe3, 0x65, 0xff, 0xe0, 0xe5, 0x60, 0xff, 0xe2, 0xe8, 0x59, 0xff, 0xe2, 0xe8, 0x54, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe2, 0xe7, 0x59, 0xff, 0xe2, 0xe7, 0x5d, 0xff, 0xe0, 0xe8, 0x63, 0xff, 0xb2, 0xb9, 0x4c, 0xff, 0x9d, 0xa3, 0x54, 0xff, 0x9f, 0xa7, 0x75, 0xff, 0x69, 0x6e, 0x5f, 0xff, 0x6d, 0x79, 0x7c, 0xff, 0xa4, 0xb5, 0xb2, 0xff, 0xbe, 0xd4, 0xc2, 0xff, 0xd6, 0xec, 0xd8, 0xff, 0xd1, 0xe7, 0xd2, 0xff, 0xd3, 0xec, 0xcd, 0xff, 0xd3, 0xee, 0xce, 0xff, 0xcf, 0xed, 0xcf, 0xff, 0xd2, 0xed, 0xce, 0xff, 0xd5, 0xed, 0xcb, 0xff, 0xdc, 0xf0, 0xcb, 0xff, 0xd7, 0xe7, 0xc1, 0xff, 0xd1, 0xdf, 0xb6, 0xff, 0xd2, 0xe0, 0xb7, 0xff, 0xdc, 0xeb, 0xc3, 0xff, 0xe0, 0xf0, 0xcf, 0xff, 0xda, 0xed, 0xd0, 0xff, 0xd5, 0xeb, 0xd1, 0xff, 0xd5, 0xed, 0xd3, 0xff, 0xd5, 0xee, 0xd5, 0xff, 0xd8, 0xec, 0xdd, 0xff, 0xdb, 0xec, 0xe3, 0xff, 0x96, 0xa0, 0x9b, 0xff, 0x6b, 0x71, 0x51, 0xff, 0xce, 0xd9, 0x83, 0xff, 0xd8, 0xe3, 0x67, 0xff, 0xde, 0xe3, 0x64, 0xff, 0xdf, 0xe5, 0x5e, 0xff, 0xe2, 0xeb, 0x57, 0xff, 0xe6, 0xea, 0x55, 0xff, 0xe5, 0xe7, 0x57, 0xff, 0xe0, 0xe9, 0x62, 0xff, 0xcb, 0xd5, 0x78, 0xff, 0x6f, 0x76, 0x55, 0xff, 0x5b, 0x64, 0x69, 0xd4, 0xa6, 0xac, 0xb9, 0x28, 0x6b, 0x6e, 0x76, 0x43, 0x54, 0x5a, 0x64, 0x97, 0x4f, 0x52, 0x5c, 0xab, 0x77, 0x7d, 0x7d, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0xa7, 0xa7, 0x1a, 0x44, 0x4a, 0x47, 0xe6, 0x72, 0x74, 0x4b, 0xff, 0xd4, 0xd7, 0x74, 0xff, 0xe1, 0xe5, 0x5a, 0xff, 0xe2, 0xe8, 0x5e, 0xff, 0xda, 0xdd, 0x74, 0xff, 0x91, 0x94, 0x5a, 0xff, 0x4e, 0x55, 0x4e, 0xff, 0x4e, 0x55, 0x50, 0xfe, 0x7c, 0x82, 0x4d, 0xff, 0xd4, 0xdb, 0x7a, 0xff, 0xd3, 0xda, 0x68, 0xff, 0xa9, 0xb0, 0x58, 0xff, 0x6a, 0x69, 0x39, 0xff, 0xa1, 0xa4, 0x5c, 0xff, 0xda, 0xe2, 0x67, 0xff, 0xe6, 0xea, 0x59, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe1, 0xe9, 0x5b, 0xff, 0xe2, 0xeb, 0x5a, 0xff, 0xe3, 0xea, 0x59, 0xff, 0xe4, 0xea, 0x5b, 0xff, 0xe2, 0xe8, 0x5e, 0xff, 0xe1, 0xe6, 0x68, 0xff, 0xde, 0xe3, 0x74, 0xff, 0xd3, 0xd8, 0x76, 0xff, 0xb9, 0xbe, 0x65, 0xff, 0xa8, 0xac, 0x4b, 0xff, 0xd2, 0xd6, 0x5e, 0xff, 0xdf, 0xe8, 0x59, 0xff, 0xdf, 0xea, 0x52, 0xff, 0xe0, 0xe9, 0x56, 0xff, 0xe0, 0xe6, 0x58, 0xff, 0xe1, 0xe6, 0x5c, 0xff, 0xe0, 0xe9, 0x5c, 0xff, 0xdf, 0xe9, 0x66, 0xff, 0xd7, 0xe2, 0x73, 0xff, 0xc8, 0xd7, 0x87, 0xff, 0x6e, 0x78, 0x5c, 0xff, 0x97, 0xa4, 0xa1, 0xff, 0xdb, 0xed, 0xe3, 0xff, 0xd8, 0xed, 0xdb, 0xff, 0xd6, 0xec, 0xd6, 0xff, 0xd3, 0xeb, 0xd2, 0xff, 0xd3, 0xeb, 0xcf, 0xff, 0xd5, 0xee, 0xcf, 0xff, 0xd3, 0xed, 0xce, 0xff, 0xd3, 0xec, 0xc9, 0xff, 0xd4, 0xea, 0xc3, 0xff, 0xca, 0xdc, 0xb0, 0xff, 0xc3, 0xd1, 0xa1, 0xff, 0xc5, 0xd1, 0x9e, 0xff, 0xc3, 0xd0, 0x9c, 0xff, 0xc4, 0xd1, 0x9d, 0xff, 0xd0, 0xe0, 0xae, 0xff, 0xdc, 0xed, 0xc2, 0xff, 0xdf, 0xf1, 0xd0, 0xff, 0xda, 0xed, 0xd2, 0xff, 0xd8, 0xed, 0xd3, 0xff, 0xca, 0xe2, 0xc9, 0xff, 0x91, 0xa3, 0x99, 0xff, 0x88, 0x91, 0x91, 0xff, 0x72, 0x74, 0x57, 0xff, 0xd4, 0xdb, 0x86, 0xff, 0xdb, 0xe5, 0x64, 0xff, 0xdf, 0xe7, 0x5d, 0xff, 0xde, 0xe7, 0x56, 0xff, 0xe2, 0xe8, 0x57, 0xff, 0xe6, 0xea, 0x54, 0xff, 0xe9, 0xeb, 0x5a, 0xff, 0xe0, 0xe8, 0x5f, 0xff, 0xcf, 0xdc, 0x73, 0xff, 0x7f, 0x89, 0x57, 0xff, 0x58, 0x62, 0x5d, 0xd9, 0xc3, 0xc3, 0xd2, 0x11, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0x05, 0x70, 0x70, 0x76, 0x29, 0x84, 0x84, 0x84, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xb8, 0xc6, 0xd4, 0x12, 0x9a, 0xa0, 0xa0, 0x2b, 0x87, 0x8a, 0x8a, 0x46, 0x8b, 0x90, 0x96, 0x2e, 0xbf, 0xbf, 0xd4, 0x0c, 0xa2, 0xaa, 0xb2, 0x21, 0x48, 0x4d, 0x4e, 0xea, 0x71, 0x74, 0x4c, 0xff, 0xd5, 0xd9, 0x74, 0xff, 0xe0, 0xe5, 0x57, 0xff, 0xe6, 0xe9, 0x5c, 0xff, 0xde, 0xe3, 0x64, 0xff, 0xbf, 0xc5, 0x72, 0xff, 0x56, 0x5b, 0x41, 0xff, 0x58, 0x5d, 0x43, 0xff, 0xb0, 0xb5, 0x66, 0xff, 0xdf, 0xe5, 0x70, 0xff, 0xd8, 0xdd, 0x62, 0xff, 0xac, 0xb4, 0x56, 0xff, 0x7c, 0x7e, 0x44, 0xff, 0x9a, 0xa0, 0x52, 0xff, 0xd9, 0xe1, 0x67, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe6, 0xea, 0x55, 0xff, 0xe1, 0xe8, 0x5a, 0xff, 0xdf, 0xe7, 0x5c, 0xff, 0xde, 0xea, 0x5c, 0xff, 0xda, 0xe7, 0x62, 0xff, 0xd8, 0xe2, 0x74, 0xff, 0xc7, 0xcb, 0x77, 0xff, 0xa0, 0x9f, 0x5e, 0xff, 0x7c, 0x7a, 0x3e, 0xff, 0x73, 0x70, 0x31, 0xff, 0x9e, 0x9d, 0x50, 0xff, 0xd5, 0xd6, 0x69, 0xff, 0xdf, 0xe6, 0x5e, 0xff, 0xde, 0xe8, 0x54, 0xff, 0xdf, 0xe9, 0x55, 0xff, 0xe1, 0xe9, 0x52, 0xff, 0xe3, 0xe7, 0x59, 0xff, 0xe2, 0xe6, 0x5b, 0xff, 0xde, 0xe5, 0x58, 0xff, 0xda, 0xe8, 0x60, 0xff, 0xc6, 0xd9, 0x74, 0xff, 0x71, 0x7d, 0x59, 0xff, 0x96, 0xa3, 0xa0, 0xff, 0xb6, 0xc6, 0xbd, 0xff, 0xc7, 0xda, 0xc5, 0xff, 0xd7, 0xee, 0xd0, 0xff, 0xd6, 0xef, 0xd1, 0xff, 0xd2, 0xee, 0xd2, 0xff, 0xd4, 0xef, 0xd2, 0xff, 0xdb, 0xee, 0xcc, 0xff, 0xd7, 0xe9, 0xc2, 0xff, 0xc6, 0xd8, 0xac, 0xff, 0xb5, 0xc6, 0x97, 0xff, 0xae, 0xbd, 0x90, 0xff, 0x98, 0xa3, 0x7a, 0xff, 0xb8, 0xc5, 0x99, 0xff, 0xbe, 0xcb, 0x9a, 0xff, 0xbd, 0xcb, 0x94, 0xff, 0xc4, 0xd2, 0x9c, 0xff, 0xd3, 0xe2, 0xb4, 0xff, 0xdd, 0xeb, 0xc9, 0xff, 0xdb, 0xe9, 0xd1, 0xff, 0xca, 0xdf, 0xc4, 0xff, 0xa2, 0xb1, 0xa7, 0xff, 0x52, 0x59, 0x5b, 0xff, 0x69, 0x6e, 0x56, 0xff, 0xc1, 0xc7, 0x85, 0xff, 0xdc, 0xe2, 0x79, 0xff, 0xdd, 0xe4, 0x62, 0xff, 0xe0, 0xe8, 0x5a, 0xff, 0xe2, 0xe7, 0x5b, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe7, 0x59, 0xff, 0xe0, 0xea, 0x5d, 0xff, 0xd1, 0xe1, 0x6e, 0xff, 0x90, 0x9a, 0x5a, 0xff, 0x5a, 0x5e, 0x59, 0xe0, 0x95, 0x95, 0x9e, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x84, 0x8e, 0x8e, 0x1b, 0x63, 0x67, 0x6f, 0x7e, 0x59, 0x59, 0x60, 0xd0, 0x58, 0x5a, 0x58, 0xea, 0x56, 0x5b, 0x53, 0xf3, 0x52, 0x57, 0x55, 0xeb, 0x57, 0x5b, 0x60, 0xc2, 0x6f, 0x74, 0x80, 0x93, 0x4a, 0x50, 0x58, 0xf5, 0x6b, 0x70, 0x4e, 0xff, 0xd2, 0xd8, 0x77, 0xff, 0xe3, 0xe9, 0x5c, 0xff, 0xe8, 0xec, 0x5c, 0xff, 0xe0, 0xe7, 0x60, 0xff, 0xc4, 0xcb, 0x71, 0xff, 0x5c, 0x5e, 0x3f, 0xff, 0x6c, 0x70, 0x43, 0xff, 0xcf, 0xd6, 0x72, 0xff, 0xe0, 0xe7, 0x62, 0xff, 0xdd, 0xe5, 0x5e, 0xff, 0xb3, 0xbc, 0x54, 0xff, 0x8b, 0x8f, 0x4b, 0xff, 0x97, 0x9f, 0x4b, 0xff, 0xd7, 0xdf, 0x67, 0xff, 0xe2, 0xe6, 0x5a, 0xff, 0xe5, 0xea, 0x56, 0xff, 0xe2, 0xe8, 0x59, 0xff, 0xe4, 0xeb, 0x5a, 0xff, 0xde, 0xe9, 0x60, 0xff, 0xd2, 0xdd, 0x6f, 0xff, 0x95, 0x9b, 0x50, 0xff, 0x71, 0x70, 0x37, 0xff, 0x81, 0x82, 0x41, 0xff, 0xae, 0xb2, 0x60, 0xff, 0xd6, 0xdb, 0x79, 0xff, 0xdd, 0xe2, 0x71, 0xff, 0xe2, 0xe9, 0x64, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe0, 0xe8, 0x55, 0xff, 0xe1, 0xe8, 0x58, 0xff, 0xe1, 0xea, 0x52, 0xff, 0xe2, 0xe7, 0x57, 0xff, 0xe2, 0xe6, 0x5a, 0xff, 0xe0, 0xe5, 0x5d, 0xff, 0xd8, 0xe1, 0x64, 0xff, 0xc3, 0xd2, 0x77, 0xff, 0x73, 0x7c, 0x5e, 0xff, 0x56, 0x62, 0x62, 0xff, 0x72, 0x7e, 0x78, 0xff, 0xc4, 0xd3, 0xbe, 0xff, 0xdd, 0xf0, 0xcc, 0xff, 0xda, 0xf1, 0xc6, 0xff, 0xd9, 0xf1, 0xc8, 0xff, 0xd7, 0xee, 0xc7, 0xff, 0xd4, 0xe6, 0xba, 0xff, 0xc1, 0xd3, 0xa2, 0xff, 0xb3, 0xc5, 0x92, 0xff, 0xa8, 0xb6, 0x8b, 0xff, 0x5f, 0x69, 0x4d, 0xff, 0x5b, 0x60, 0x54, 0xff, 0x6d, 0x74, 0x64, 0xff, 0xaa, 0xb3, 0x98, 0xff, 0xb9, 0xc2, 0x9d, 0xff, 0xb9, 0xc5, 0x96, 0xff, 0xb6, 0xc4, 0x91, 0xff, 0xbd, 0xcb, 0xa1, 0xff, 0xc2, 0xd1, 0xb1, 0xff, 0xbd, 0xcf, 0xb8, 0xff, 0xa1, 0xac, 0xa3, 0xff, 0x5a, 0x60, 0x52, 0xff, 0x7a, 0x84, 0x59, 0xff, 0x74, 0x7c, 0x3c, 0xff, 0xb8, 0xba, 0x65, 0xff, 0xe2, 0xe3, 0x71, 0xff, 0xe5, 0xe7, 0x61, 0xff, 0xe3, 0xe5, 0x5d, 0xff, 0xe6, 0xea, 0x59, 0xff, 0xe4, 0xe9, 0x56, 0xff, 0xe3, 0xee, 0x59, 0xff, 0xd6, 0xe4, 0x68, 0xff, 0x9f, 0xa7, 0x61, 0xff, 0x5a, 0x5e, 0x57, 0xea, 0x7b, 0x7f, 0x84, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xe3, 0xc6, 0x09, 0xc1, 0xc1, 0xbb, 0x2d, 0xb6, 0xb6, 0xb3, 0x5b, 0xb5, 0xb5, 0xb0, 0x61, 0xbb, 0xbb, 0xb7, 0x3c, 0xd4, 0xd4, 0xd4, 0x12, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x52, 0x52, 0x5a, 0xc0, 0x55, 0x56, 0x51, 0xfa, 0x62, 0x61, 0x46, 0xff, 0x89, 0x8b, 0x59, 0xff, 0x9a, 0x9e, 0x65, 0xff, 0x8f, 0x96, 0x60, 0xff, 0x64, 0x6c, 0x47, 0xff, 0x51, 0x56, 0x52, 0xfe, 0x52, 0x57, 0x58, 0xff, 0x63, 0x68, 0x49, 0xff, 0xcc, 0xd3, 0x76, 0xff, 0xdf, 0xe8, 0x5f, 0xff, 0xe5, 0xee, 0x5e, 0xff, 0xde, 0xe8, 0x69, 0xff, 0xb0, 0xb6, 0x6a, 0xff, 0x5b, 0x5d, 0x41, 0xff, 0x8a, 0x92, 0x53, 0xff, 0xda, 0xe4, 0x70, 0xff, 0xe2, 0xeb, 0x5c, 0xff, 0xdf, 0xeb, 0x5b, 0xff, 0xc5, 0xcc, 0x5c, 0xff, 0x98, 0x9c, 0x4b, 0xff, 0x92, 0x99, 0x3e, 0xff, 0xd5, 0xd9, 0x65, 0xff, 0xe3, 0xe5, 0x5d, 0xff, 0xe5, 0xe9, 0x56, 0xff, 0xe4, 0xe9, 0x5c, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe2, 0xe8, 0x63, 0xff, 0xad, 0xb2, 0x4f, 0xff, 0x74, 0x75, 0x29, 0xff, 0xad, 0xaf, 0x63, 0xff, 0xd4, 0xda, 0x76, 0xff, 0xdd, 0xe4, 0x6d, 0xff, 0xe0, 0xe8, 0x65, 0xff, 0xe4, 0xec, 0x5d, 0xff, 0xe6, 0xeb, 0x55, 0xff, 0xe5, 0xea, 0x53, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe1, 0xe8, 0x56, 0xff, 0xdf, 0xe8, 0x57, 0xff, 0xdd, 0xe6, 0x58, 0xff, 0xdf, 0xe2, 0x6b, 0xff, 0xc7, 0xc7, 0x6d, 0xff, 0x7b, 0x81, 0x3f, 0xff, 0x57, 0x5c, 0x42, 0xff, 0x50, 0x5a, 0x52, 0xff, 0xb0, 0xba, 0xb2, 0xff, 0xcf, 0xd9, 0xc8, 0xff, 0xcf, 0xdc, 0xbb, 0xff, 0xce, 0xde, 0xaf, 0xff, 0xcb, 0xdb, 0xaa, 0xff, 0xc3, 0xd4, 0xa5, 0xff, 0xb6, 0xc9, 0x9e, 0xff, 0xb8, 0xc6, 0xa0, 0xff, 0x96, 0xa2, 0x7f, 0xff, 0x60, 0x67, 0x4a, 0xff, 0x5c, 0x62, 0x47, 0xff, 0x7d, 0x84, 0x67, 0xff, 0x63, 0x6b, 0x50, 0xff, 0x5d, 0x64, 0x4d, 0xff, 0x84, 0x8b, 0x75, 0xff, 0xa1, 0xaa, 0x8e, 0xff, 0xaa, 0xb8, 0x98, 0xff, 0xa9, 0xb7, 0x9b, 0xff, 0x9c, 0xa8, 0x95, 0xff, 0x7c, 0x87, 0x7d, 0xff, 0x5c, 0x62, 0x52, 0xff, 0x89, 0x90, 0x5b, 0xff, 0xcd, 0xda, 0x8a, 0xff, 0xbe, 0xc8, 0x73, 0xff, 0x8e, 0x8f, 0x3f, 0xff, 0xcc, 0xc9, 0x62, 0xff, 0xe6, 0xe3, 0x68, 0xff, 0xe1, 0xe2, 0x63, 0xff, 0xe3, 0xe8, 0x5e, 0xff, 0xe2, 0xe9, 0x5b, 0xff, 0xe3, 0xed, 0x5d, 0xff, 0xdb, 0xe4, 0x6c, 0xff, 0xab, 0xaf, 0x6c, 0xff, 0x5b, 0x5f, 0x57, 0xef, 0x72, 0x76, 0x7e, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xba, 0xba, 0xba, 0x25, 0xad, 0xad, 0xa8, 0x9c, 0xae, 0xad, 0xa9, 0xe9, 0xb5, 0xb4, 0xaf, 0xfb, 0xb4, 0xb3, 0xae, 0xfb, 0xb4, 0xb2, 0xad, 0xf2, 0xb3, 0xb4, 0xae, 0xbc, 0xbb, 0xc2, 0xb8, 0x4b, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x55, 0x54, 0x4a, 0xfe, 0x82, 0x84, 0x53, 0xff, 0xc7, 0xcb, 0x74, 0xff, 0xd8, 0xdb, 0x6f, 0xff, 0xdc, 0xe0, 0x72, 0xff, 0xdc, 0xe4, 0x79, 0xff, 0xd0, 0xdb, 0x7b, 0xff, 0xa2, 0xa8, 0x6b, 0xff, 0x61, 0x65, 0x41, 0xff, 0x63, 0x67, 0x39, 0xff, 0xc6, 0xcc, 0x6c, 0xff, 0xde, 0xe6, 0x60, 0xff, 0xe2, 0xeb, 0x5e, 0xff, 0xdb, 0xe6, 0x74, 0xff, 0x9d, 0xa2, 0x62, 0xff, 0x61, 0x64, 0x42, 0xff, 0xab, 0xb6, 0x68, 0xff, 0xdb, 0xe5, 0x68, 0xff, 0xe5, 0xed, 0x5d, 0xff, 0xdf, 0xeb, 0x56, 0xff, 0xd6, 0xdc, 0x60, 0xff, 0xad, 0xb0, 0x4d, 0xff, 0x94, 0x9b, 0x33, 0xff, 0xd3, 0xd8, 0x61, 0xff, 0xe5, 0xe6, 0x5d, 0xff, 0xe5, 0xea, 0x54, 0xff, 0xe1, 0xe7, 0x5a, 0xff, 0xe4, 0xe6, 0x5a, 0xff, 0xe3, 0xe7, 0x61, 0xff, 0xd7, 0xdc, 0x63, 0xff, 0xd7, 0xdb, 0x6b, 0xff, 0xdc, 0xe1, 0x6e, 0xff, 0xdf, 0xe7, 0x67, 0xff, 0xe1, 0xe7, 0x61, 0xff, 0xe2, 0xe7, 0x5f, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe7, 0xea, 0x56, 0xff, 0xe6, 0xe8, 0x57, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe1, 0xea, 0x58, 0xff, 0xe0, 0xe7, 0x56, 0xff, 0xde, 0xe7, 0x57, 0xff, 0xda, 0xe6, 0x5a, 0xff, 0xc9, 0xcd, 0x62, 0xff, 0x7b, 0x78, 0x2d, 0xff, 0xa1, 0xa6, 0x5b, 0xff, 0xc0, 0xc7, 0x87, 0xff, 0x6a, 0x72, 0x49, 0xff, 0x62, 0x68, 0x54, 0xff, 0xac, 0xb4, 0xa7, 0xff, 0xc6, 0xd1, 0xbf, 0xff, 0xc5, 0xd1, 0xb4, 0xff, 0xc9, 0xd2, 0xb1, 0xff, 0xbf, 0xc8, 0xaa, 0xff, 0x9f, 0xad, 0x95, 0xff, 0x6f, 0x76, 0x63, 0xff, 0x5f, 0x60, 0x4b, 0xff, 0x79, 0x78, 0x55, 0xff, 0xa0, 0xa3, 0x6d, 0xff, 0xa5, 0xae, 0x66, 0xff, 0xa6, 0xb1, 0x67, 0xff, 0x87, 0x8f, 0x59, 0xff, 0x65, 0x6b, 0x51, 0xff, 0x58, 0x60, 0x58, 0xff, 0x57, 0x62, 0x5e, 0xff, 0x5a, 0x62, 0x61, 0xff, 0x58, 0x5e, 0x64, 0xff, 0x58, 0x5e, 0x62, 0xff, 0x74, 0x78, 0x53, 0xff, 0xd1, 0xd7, 0x82, 0xff, 0xd9, 0xe2, 0x71, 0xff, 0xda, 0xe3, 0x71, 0xff, 0xdd, 0xe0, 0x72, 0xff, 0xd8, 0xd6, 0x65, 0xff, 0xe1, 0xe1, 0x6c, 0xff, 0xe0, 0xe0, 0x74, 0xff, 0xdc, 0xde, 0x75, 0xff, 0xdc, 0xde, 0x75, 0xff, 0xde, 0xe4, 0x71, 0xff, 0xd8, 0xdf, 0x77, 0xff, 0xb5, 0xb8, 0x7c, 0xff, 0x5d, 0x61, 0x59, 0xf0, 0x71, 0x71, 0x7c, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xbb, 0xbb, 0x1e, 0xaa, 0xaa, 0xa5, 0xbe, 0xc0, 0xc0, 0xba, 0xfd, 0xea, 0xea, 0xe5, 0xff, 0xf8, 0xf8, 0xf2, 0xff, 0xf8, 0xf7, 0xf3, 0xff, 0xe9, 0xe6, 0xe1, 0xff, 0xc2, 0xc1, 0xb9, 0xff, 0xb3, 0xb3, 0xaa, 0xea, 0xbd, 0xbd, 0xb7, 0x60, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x5e, 0x5a, 0x47, 0xff, 0xbd, 0xc0, 0x77, 0xff, 0xda, 0xe0, 0x63, 0xff, 0xe5, 0xe7, 0x58, 0xff, 0xe7, 0xe8, 0x5d, 0xff, 0xe1, 0xe7, 0x5d, 0xff, 0xe1, 0xeb, 0x63, 0xff, 0xde, 0xe6, 0x77, 0xff, 0xc2, 0xc6, 0x76, 0xff, 0x7e, 0x80, 0x3a, 0xff, 0xc6, 0xc9, 0x61, 0xff, 0xe4, 0xe9, 0x63, 0xff, 0xe4, 0xeb, 0x61, 0xff, 0xdb, 0xe3, 0x77, 0xff, 0x8a, 0x90, 0x54, 0xff, 0x63, 0x69, 0x3b, 0xff, 0xc5, 0xd2, 0x73, 0xff, 0xe1, 0xe9, 0x65, 0xff, 0xe8, 0xe9, 0x5c, 0xff, 0xe2, 0xea, 0x53, 0xff, 0xe1, 0xe5, 0x5f, 0xff, 0xcd, 0xd0, 0x5c, 0xff, 0xb5, 0xbc, 0x48, 0xff, 0xd7, 0xdb, 0x5f, 0xff, 0xe4, 0xe6, 0x59, 0xff, 0xe5, 0xeb, 0x51, 0xff, 0xe2, 0xea, 0x58, 0xff, 0xe1, 0xeb, 0x57, 0xff, 0xe0, 0xe7, 0x5b, 0xff, 0xe1, 0xe6, 0x60, 0xff, 0xe0, 0xe6, 0x5e, 0xff, 0xe1, 0xe8, 0x5c, 0xff, 0xdf, 0xe8, 0x5a, 0xff, 0xe1, 0xe7, 0x5b, 0xff, 0xe3, 0xe9, 0x59, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe4, 0xe7, 0x5b, 0xff, 0xe1, 0xe8, 0x5a, 0xff, 0xdf, 0xec, 0x56, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe2, 0xe7, 0x59, 0xff, 0xdb, 0xe6, 0x5c, 0xff, 0xac, 0xb2, 0x47, 0xff, 0xbe, 0xc0, 0x62, 0xff, 0xd8, 0xe2, 0x70, 0xff, 0xd4, 0xe2, 0x70, 0xff, 0xc4, 0xcc, 0x7c, 0xff, 0x78, 0x7c, 0x4e, 0xff, 0x55, 0x5c, 0x4f, 0xff, 0x5c, 0x67, 0x65, 0xff, 0x71, 0x7c, 0x77, 0xff, 0x6f, 0x77, 0x71, 0xff, 0x5c, 0x60, 0x60, 0xff, 0x54, 0x5a, 0x5b, 0xff, 0x5d, 0x60, 0x50, 0xff, 0x89, 0x8a, 0x5e, 0xff, 0xac, 0xac, 0x69, 0xff, 0xb3, 0xb5, 0x5d, 0xff, 0xb5, 0xb9, 0x53, 0xff, 0xb5, 0xbb, 0x55, 0xff, 0xb5, 0xba, 0x6e, 0xff, 0x98, 0x9a, 0x79, 0xff, 0x63, 0x68, 0x6c, 0xff, 0x93, 0x9b, 0xa7, 0xff, 0xa0, 0xa7, 0xaf, 0xff, 0xb5, 0xb9, 0xc2, 0xff, 0x78, 0x7d, 0x81, 0xff, 0x94, 0x9a, 0x62, 0xff, 0xdc, 0xdf, 0x74, 0xff, 0xe3, 0xe5, 0x64, 0xff, 0xe1, 0xe7, 0x62, 0xff, 0xe1, 0xe7, 0x60, 0xff, 0xe4, 0xe6, 0x62, 0xff, 0xdc, 0xe2, 0x6e, 0xff, 0xd6, 0xd8, 0x80, 0xff, 0xcf, 0xcf, 0x8e, 0xff, 0xcc, 0xc9, 0x90, 0xff, 0xd1, 0xd3, 0x87, 0xff, 0xd6, 0xdd, 0x88, 0xff, 0xb8, 0xbc, 0x86, 0xff, 0x5f, 0x61, 0x55, 0xf2, 0x77, 0x77, 0x7b, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x06, 0xaf, 0xb2, 0xa8, 0x8c, 0xbf, 0xc2, 0xb8, 0xfc, 0xf8, 0xf9, 0xf1, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xfe, 0xfe, 0xf9, 0xff, 0xfe, 0xfe, 0xf8, 0xff, 0xfe, 0xfd, 0xf8, 0xff, 0xf9, 0xf8, 0xef, 0xff, 0xc9, 0xc6, 0xbd, 0xff, 0xb4, 0xb1, 0xaa, 0xd5, 0xcc, 0xcc, 0xcc, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x68, 0x63, 0x4c, 0xff, 0xcd, 0xce, 0x78, 0xff, 0xdf, 0xe4, 0x59, 0xff, 0xe3, 0xea, 0x53, 0xff, 0xe1, 0xea, 0x54, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe6, 0xea, 0x5b, 0xff, 0xe0, 0xea, 0x5d, 0xff, 0xde, 0xe3, 0x64, 0xff, 0xdd, 0xe0, 0x68, 0xff, 0xde, 0xe1, 0x62, 0xff, 0xe5, 0xea, 0x63, 0xff, 0xe4, 0xeb, 0x62, 0xff, 0xd6, 0xe3, 0x75, 0xff, 0x7a, 0x84, 0x48, 0xff, 0x6f, 0x72, 0x3c, 0xff, 0xd2, 0xdc, 0x73, 0xff, 0xe2, 0xe9, 0x60, 0xff, 0xe7, 0xeb, 0x5a, 0xff, 0xe3, 0xeb, 0x56, 0xff, 0xe4, 0xe6, 0x5c, 0xff, 0xe2, 0xe3, 0x5e, 0xff, 0xdb, 0xde, 0x58, 0xff, 0xe3, 0xe6, 0x5d, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe4, 0xe7, 0x54, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe2, 0xea, 0x56, 0xff, 0xe3, 0xe9, 0x59, 0xff, 0xe4, 0xe8, 0x5b, 0xff, 0xe3, 0xe8, 0x59, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe2, 0xe8, 0x59, 0xff, 0xe2, 0xea, 0x57, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe1, 0xe8, 0x59, 0xff, 0xde, 0xe7, 0x5a, 0xff, 0xde, 0xe5, 0x60, 0xff, 0xdd, 0xe3, 0x62, 0xff, 0xdf, 0xe8, 0x5f, 0xff, 0xdf, 0xe8, 0x60, 0xff, 0xdc, 0xe4, 0x70, 0xff, 0xd0, 0xd7, 0x82, 0xff, 0x6d, 0x71, 0x4e, 0xff, 0x58, 0x5e, 0x64, 0xff, 0x7a, 0x83, 0x8c, 0xff, 0x84, 0x89, 0x94, 0xff, 0x9e, 0x9d, 0xb2, 0xff, 0x6d, 0x6f, 0x7b, 0xff, 0x84, 0x86, 0x64, 0xff, 0xb0, 0xb1, 0x67, 0xff, 0xba, 0xbd, 0x54, 0xff, 0xc0, 0xc5, 0x50, 0xff, 0xc3, 0xc8, 0x51, 0xff, 0xca, 0xce, 0x57, 0xff, 0xcb, 0xd1, 0x6a, 0xff, 0xb1, 0xb9, 0x80, 0xff, 0x5f, 0x62, 0x67, 0xff, 0xdd, 0xe1, 0xed, 0xff, 0xf6, 0xfd, 0xfb, 0xff, 0xf4, 0xf5, 0xfa, 0xff, 0x80, 0x83, 0x85, 0xff, 0xa1, 0xa7, 0x67, 0xff, 0xdb, 0xe0, 0x69, 0xff, 0xe5, 0xe7, 0x5f, 0xff, 0xe2, 0xe8, 0x5d, 0xff, 0xe1, 0xe9, 0x5b, 0xff, 0xe4, 0xe8, 0x5d, 0xff, 0xdc, 0xe3, 0x69, 0xff, 0xd5, 0xd6, 0x85, 0xff, 0xcc, 0xc9, 0x9d, 0xff, 0xca, 0xc6, 0xa9, 0xff, 0xbf, 0xbf, 0x99, 0xff, 0xc2, 0xc2, 0x98, 0xff, 0xbd, 0xbd, 0xa0, 0xff, 0x9a, 0x9c, 0x90, 0xf9, 0xa9, 0xa9, 0xa1, 0x8b, 0xc8, 0xc8, 0xc3, 0x33, 0xcf, 0xca, 0xca, 0x35, 0xd0, 0xc8, 0xc4, 0x41, 0xcb, 0xc4, 0xba, 0x67, 0xb4, 0xb3, 0xa8, 0xe8, 0xed, 0xed, 0xe5, 0xff, 0xfe, 0xfe, 0xf7, 0xff, 0xfe, 0xfd, 0xf6, 0xff, 0xff, 0xfd, 0xf8, 0xff, 0xfe, 0xfb, 0xf7, 0xff, 0xff, 0xfc, 0xf8, 0xff, 0xfd, 0xfc, 0xf4, 0xff, 0xf2, 0xf0, 0xe8, 0xff, 0xb4, 0xb2, 0xa8, 0xf7, 0xba, 0xb7, 0xb0, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x63, 0x64, 0x49, 0xff, 0xc5, 0xc9, 0x74, 0xff, 0xe0, 0xe4, 0x62, 0xff, 0xe0, 0xe6, 0x57, 0xff, 0xdf, 0xea, 0x57, 0xff, 0xe2, 0xeb, 0x58, 0xff, 0xe5, 0xe9, 0x59, 0xff, 0xe0, 0xea, 0x58, 0xff, 0xe3, 0xeb, 0x5a, 0xff, 0xe3, 0xe9, 0x5b, 0xff, 0xe3, 0xe9, 0x5d, 0xff, 0xe2, 0xe8, 0x5e, 0xff, 0xe1, 0xe8, 0x5f, 0xff, 0xd2, 0xdf, 0x72, 0xff, 0x6f, 0x77, 0x3d, 0xff, 0x7e, 0x80, 0x45, 0xff, 0xd9, 0xe0, 0x73, 0xff, 0xe2, 0xe9, 0x5e, 0xff, 0xe6, 0xec, 0x59, 0xff, 0xe3, 0xea, 0x58, 0xff, 0xe4, 0xe7, 0x5a, 0xff, 0xe7, 0xe8, 0x5c, 0xff, 0xe8, 0xe9, 0x5c, 0xff, 0xe5, 0xe7, 0x58, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xe8, 0x59, 0xff, 0xe1, 0xe7, 0x58, 0xff, 0xe1, 0xe7, 0x58, 0xff, 0xe2, 0xe9, 0x5a, 0xff, 0xe5, 0xeb, 0x5c, 0xff, 0xe3, 0xe9, 0x5b, 0xff, 0xe2, 0xe8, 0x5b, 0xff, 0xde, 0xe5, 0x5e, 0xff, 0xd7, 0xde, 0x70, 0xff, 0x9b, 0x9e, 0x63, 0xff, 0x66, 0x69, 0x67, 0xff, 0xe0, 0xe8, 0xef, 0xff, 0xed, 0xf3, 0xf8, 0xff, 0xf2, 0xf3, 0xfd, 0xff, 0x86, 0x87, 0x8c, 0xff, 0x92, 0x92, 0x63, 0xff, 0xc7, 0xc5, 0x68, 0xff, 0xd7, 0xd8, 0x5f, 0xff, 0xdc, 0xdf, 0x5e, 0xff, 0xdf, 0xe4, 0x60, 0xff, 0xe1, 0xe5, 0x5d, 0xff, 0xdc, 0xe4, 0x65, 0xff, 0xc4, 0xcd, 0x7d, 0xff, 0x59, 0x5d, 0x51, 0xff, 0xd3, 0xd7, 0xda, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0xec, 0xef, 0xed, 0xff, 0x5d, 0x5f, 0x57, 0xff, 0xb1, 0xb8, 0x6f, 0xff, 0xdc, 0xe3, 0x65, 0xff, 0xe3, 0xe8, 0x5a, 0xff, 0xe1, 0xe9, 0x59, 0xff, 0xe2, 0xe9, 0x59, 0xff, 0xe4, 0xe9, 0x5b, 0xff, 0xe0, 0xe4, 0x65, 0xff, 0xd9, 0xd8, 0x7e, 0xff, 0xd0, 0xcb, 0x98, 0xff, 0xd9, 0xd5, 0xb8, 0xff, 0xf0, 0xee, 0xd5, 0xff, 0xde, 0xd9, 0xc3, 0xff, 0xc3, 0xc1, 0xae, 0xff, 0xb6, 0xb9, 0xaa, 0xff, 0xb5, 0xb4, 0xab, 0xfa, 0xb4, 0xb1, 0xab, 0xf0, 0xb2, 0xae, 0xa9, 0xf0, 0xb4, 0xb0, 0xa9, 0xf3, 0xb7, 0xb3, 0xaa, 0xfa, 0xb6, 0xb4, 0xab, 0xff, 0xf5, 0xf3, 0xeb, 0xff, 0xfe, 0xfd, 0xf5, 0xff, 0xfe, 0xfd, 0xf6, 0xff, 0xff, 0xfc, 0xf7, 0xff, 0xfe, 0xfb, 0xf6, 0xff, 0xff, 0xfc, 0xf7, 0xff, 0xfe, 0xfd, 0xf5, 0xff, 0xfb, 0xfa, 0xf2, 0xff, 0xba, 0xb9, 0xaf, 0xfb, 0xb9, 0xb6, 0xac, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x57, 0x5d, 0x49, 0xff, 0xad, 0xb1, 0x69, 0xff, 0xdb, 0xdd, 0x6c, 0xff, 0xe1, 0xe4, 0x5f, 0xff, 0xdf, 0xe8, 0x59, 0xff, 0xdf, 0xe9, 0x56, 0xff, 0xe2, 0xe9, 0x57, 0xff, 0xe0, 0xe7, 0x55, 0xff, 0xe4, 0xec, 0x57, 0xff, 0xe4, 0xeb, 0x55, 0xff, 0xe1, 0xe9, 0x55, 0xff, 0xe0, 0xe9, 0x59, 0xff, 0xdd, 0xe6, 0x5b, 0xff, 0xd1, 0xda, 0x70, 0xff, 0x6a, 0x6d, 0x32, 0xff, 0x8c, 0x8e, 0x4b, 0xff, 0xda, 0xe1, 0x6f, 0xff, 0xe1, 0xe7, 0x5b, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe3, 0xe7, 0x57, 0xff, 0xe7, 0xe9, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe3, 0xe8, 0x59, 0xff, 0xdb, 0xe1, 0x62, 0xff, 0xbe, 0xc3, 0x70, 0xff, 0x58, 0x5a, 0x43, 0xff, 0xcb, 0xd0, 0xd4, 0xff, 0xf2, 0xf8, 0xf9, 0xff, 0xf1, 0xf6, 0xf5, 0xff, 0x7d, 0x7d, 0x7b, 0xff, 0xa1, 0xa1, 0x66, 0xff, 0xd9, 0xd8, 0x6d, 0xff, 0xe7, 0xe6, 0x61, 0xff, 0xe5, 0xe7, 0x5c, 0xff, 0xe6, 0xea, 0x5c, 0xff, 0xe7, 0xe9, 0x5b, 0xff, 0xe4, 0xe8, 0x65, 0xff, 0xd3, 0xd8, 0x82, 0xff, 0x5e, 0x5f, 0x4a, 0xff, 0xc4, 0xc8, 0xcf, 0xff, 0xf6, 0xfd, 0xfe, 0xff, 0xca, 0xce, 0xd1, 0xff, 0x4f, 0x52, 0x3a, 0xff, 0xc6, 0xcd, 0x78, 0xff, 0xdf, 0xe6, 0x60, 0xff, 0xe3, 0xeb, 0x55, 0xff, 0xe1, 0xeb, 0x54, 0xff, 0xe1, 0xeb, 0x55, 0xff, 0xe5, 0xe9, 0x5a, 0xff, 0xe5, 0xe6, 0x61, 0xff, 0xdf, 0xdf, 0x71, 0xff, 0xd5, 0xd3, 0x87, 0xff, 0xcc, 0xc8, 0x9c, 0xff, 0xe8, 0xe4, 0xcc, 0xff, 0xf8, 0xf5, 0xe2, 0xff, 0xf4, 0xf3, 0xdf, 0xff, 0xec, 0xee, 0xdb, 0xff, 0xe7, 0xe7, 0xda, 0xff, 0xdd, 0xdc, 0xd2, 0xff, 0xda, 0xd7, 0xd1, 0xff, 0xdb, 0xd8, 0xd3, 0xff, 0xdb, 0xd9, 0xd4, 0xff, 0xe4, 0xe2, 0xdd, 0xff, 0xfc, 0xfa, 0xf6, 0xff, 0xfd, 0xfa, 0xf5, 0xff, 0xff, 0xfe, 0xf6, 0xff, 0xff, 0xfd, 0xf5, 0xff, 0xfe, 0xfd, 0xf4, 0xff, 0xfe, 0xfc, 0xf3, 0xff, 0xfe, 0xfd, 0xf5, 0xff, 0xf8, 0xf7, 0xef, 0xff, 0xba, 0xb7, 0xae, 0xfa, 0xbd, 0xb8, 0xb2, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x52, 0x55, 0x52, 0xf4, 0x80, 0x82, 0x53, 0xff, 0xd1, 0xd1, 0x73, 0xff, 0xe0, 0xe3, 0x64, 0xff, 0xe3, 0xe8, 0x5c, 0xff, 0xe1, 0xe8, 0x56, 0xff, 0xe2, 0xe8, 0x56, 0xff, 0xe1, 0xe8, 0x56, 0xff, 0xe4, 0xea, 0x54, 0xff, 0xe4, 0xec, 0x51, 0xff, 0xe2, 0xeb, 0x52, 0xff, 0xdf, 0xe9, 0x55, 0xff, 0xde, 0xe8, 0x59, 0xff, 0xda, 0xdf, 0x71, 0xff, 0x7d, 0x7c, 0x39, 0xff, 0x9b, 0x9d, 0x4b, 0xff, 0xdc, 0xe3, 0x69, 0xff, 0xe2, 0xe7, 0x5c, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe3, 0xe9, 0x59, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe5, 0xea, 0x56, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe4, 0xe7, 0x58, 0xff, 0xde, 0xe5, 0x5e, 0xff, 0xd2, 0xd9, 0x74, 0xff, 0x70, 0x75, 0x46, 0xff, 0x9e, 0xa1, 0xa5, 0xff, 0xf3, 0xfa, 0xfb, 0xff, 0xeb, 0xf2, 0xef, 0xff, 0x71, 0x73, 0x6a, 0xff, 0xaa, 0xab, 0x66, 0xff, 0xdd, 0xe0, 0x69, 0xff, 0xe6, 0xe8, 0x5b, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe6, 0xea, 0x57, 0xff, 0xe7, 0xeb, 0x5a, 0xff, 0xe4, 0xe7, 0x62, 0xff, 0xdb, 0xe1, 0x82, 0xff, 0x67, 0x6a, 0x46, 0xff, 0xac, 0xb0, 0xb7, 0xff, 0xf0, 0xf9, 0xfd, 0xff, 0x98, 0x9e, 0x9f, 0xff, 0x72, 0x76, 0x49, 0xff, 0xd2, 0xd7, 0x77, 0xff, 0xdf, 0xe6, 0x5b, 0xff, 0xe4, 0xea, 0x54, 0xff, 0xe1, 0xeb, 0x54, 0xff, 0xe1, 0xeb, 0x55, 0xff, 0xe6, 0xe9, 0x5a, 0xff, 0xe8, 0xe7, 0x5d, 0xff, 0xe4, 0xe4, 0x64, 0xff, 0xdc, 0xdb, 0x75, 0xff, 0xd1, 0xce, 0x8c, 0xff, 0xcc, 0xc7, 0xa4, 0xff, 0xee, 0xea, 0xd5, 0xff, 0xf0, 0xee, 0xd9, 0xff, 0xf3, 0xf2, 0xdb, 0xff, 0xf9, 0xf9, 0xe6, 0xff, 0xfd, 0xfc, 0xef, 0xff, 0xfe, 0xfd, 0xf4, 0xff, 0xfe, 0xfe, 0xf7, 0xff, 0xfe, 0xfd, 0xf9, 0xff, 0xfe, 0xfc, 0xf8, 0xff, 0xff, 0xfd, 0xf8, 0xff, 0xfe, 0xfd, 0xf7, 0xff, 0xff, 0xfd, 0xf5, 0xff, 0xff, 0xfd, 0xf4, 0xff, 0xff, 0xfe, 0xf4, 0xff, 0xfe, 0xfe, 0xf4, 0xff, 0xfd, 0xfc, 0xf4, 0xff, 0xdf, 0xdd, 0xd6, 0xff, 0xaf, 0xac, 0xa4, 0xfa, 0xc4, 0xc4, 0xbc, 0x63, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 
-  0x59, 0x58, 0x61, 0xa9, 0x5d, 0x5a, 0x4b, 0xfd, 0xa8, 0xaa, 0x64, 0xff, 0xca, 0xcf, 0x60, 0xff, 0xd7, 0xda, 0x59, 0xff, 0xe0, 0xe2, 0x5b, 0xff, 0xe3, 0xe6, 0x5a, 0xff, 0xe2, 0xe7, 0x5a, 0xff, 0xe3, 0xe8, 0x56, 0xff, 0xe3, 0xea, 0x54, 0xff, 0xe2, 0xe9, 0x53, 0xff, 0xe1, 0xe8, 0x55, 0xff, 0xdf, 0xe7, 0x57, 0xff, 0xde, 0xe2, 0x68, 0xff, 0xb4, 0xb3, 0x55, 0xff, 0xb4, 0xb8, 0x4d, 0xff, 0xe0, 0xe7, 0x63, 0xff, 0xe5, 0xe8, 0x5d, 0xff, 0xe5, 0xe9, 0x56, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe5, 0xea, 0x56, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe3, 0xe6, 0x5b, 0xff, 0xdf, 0xe4, 0x5d, 0xff, 0xd8, 0xe0, 0x6f, 0xff, 0x9d, 0xa3, 0x61, 0xff, 0x5e, 0x62, 0x5f, 0xff, 0xe2, 0xea, 0xf1, 0xff, 0xe4, 0xee, 0xee, 0xff, 0x65, 0x69, 0x5d, 0xff, 0xb0, 0xb7, 0x69, 0xff, 0xdb, 0xe2, 0x63, 0xff, 0xe5, 0xe9, 0x59, 0xff, 0xe3, 0xe7, 0x59, 0xff, 0xe4, 0xea, 0x59, 0xff, 0xe4, 0xeb, 0x5a, 0xff, 0xe3, 0xea, 0x60, 0xff, 0xdd, 0xe5, 0x79, 0xff, 0x88, 0x8e, 0x58, 0xff, 0x8f, 0x95, 0x94, 0xff, 0xdc, 0xe4, 0xe4, 0xff, 0x5e, 0x65, 0x53, 0xff, 0xa2, 0xa6, 0x5f, 0xff, 0xdc, 0xe0, 0x6f, 0xff, 0xe5, 0xe8, 0x5b, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe1, 0xea, 0x57, 0xff, 0xe2, 0xeb, 0x56, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe8, 0xe8, 0x58, 0xff, 0xe6, 0xe7, 0x5c, 0xff, 0xe4, 0xe4, 0x68, 0xff, 0xd9, 0xd7, 0x79, 0xff, 0xcc, 0xc9, 0x8c, 0xff, 0xcc, 0xc9, 0xa6, 0xff, 0xed, 0xea, 0xd1, 0xff, 0xf0, 0xec, 0xd6, 0xff, 0xf3, 0xf0, 0xdd, 0xff, 0xf8, 0xf7, 0xe7, 0xff, 0xfd, 0xfb, 0xf0, 0xff, 0xfe, 0xfc, 0xf3, 0xff, 0xfc, 0xfa, 0xf4, 0xff, 0xfe, 0xfd, 0xf7, 0xff, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xfe, 0xf6, 0xff, 0xff, 0xfd, 0xf5, 0xff, 0xff, 0xfe, 0xf4, 0xff, 0xfe, 0xfd, 0xf3, 0xff, 0xfe, 0xfd, 0xf3, 0xff, 0xfd, 0xfd, 0xf5, 0xff, 0xed, 0xeb, 0xe3, 0xff, 0xc8, 0xc6, 0xbe, 0xff, 0xb2, 0xb1, 0xac, 0xdf, 0xc1, 0xc1, 0xbf, 0x5b, 0xff, 0xff, 0xff, 0x03, 
-  0x62, 0x62, 0x67, 0x2f, 0x57, 0x54, 0x54, 0xd7, 0x67, 0x6a, 0x49, 0xff, 0xaa, 0xaf, 0x65, 0xff, 0xc0, 0xc1, 0x62, 0xff, 0xc9, 0xc9, 0x57, 0xff, 0xd3, 0xd7, 0x55, 0xff, 0xda, 0xe0, 0x57, 0xff, 0xdf, 0xe5, 0x5a, 0xff, 0xe2, 0xe6, 0x59, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe2, 0xe6, 0x56, 0xff, 0xe2, 0xe7, 0x56, 0xff, 0xe3, 0xe7, 0x5d, 0xff, 0xe2, 0xe4, 0x65, 0xff, 0xdd, 0xe5, 0x5f, 0xff, 0xe2, 0xe9, 0x5d, 0xff, 0xe5, 0xe7, 0x5f, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe3, 0xea, 0x58, 0xff, 0xe6, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xe9, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xe9, 0x59, 0xff, 0xe7, 0xe9, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe6, 0xe9, 0x5a, 0xff, 0xe2, 0xe5, 0x5a, 0xff, 0xdb, 0xe2, 0x62, 0xff, 0xc8, 0xd0, 0x77, 0xff, 0x55, 0x5b, 0x40, 0xff, 0xaa, 0xaf, 0xb3, 0xff, 0xdd, 0xe3, 0xe6, 0xff, 0x5d, 0x62, 0x51, 0xff, 0xbe, 0xc5, 0x71, 0xff, 0xdc, 0xe4, 0x5e, 0xff, 0xe4, 0xe9, 0x56, 0xff, 0xe5, 0xe6, 0x59, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe1, 0xe7, 0x5a, 0xff, 0xe1, 0xe8, 0x61, 0xff, 0xdd, 0xe3, 0x6e, 0xff, 0xaa, 0xad, 0x69, 0xff, 0x72, 0x74, 0x6a, 0xff, 0x8b, 0x8c, 0x85, 0xff, 0x74, 0x75, 0x47, 0xff, 0xd0, 0xd6, 0x74, 0xff, 0xdf, 0xe6, 0x61, 0xff, 0xe7, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x59, 0xff, 0xe1, 0xea, 0x58, 0xff, 0xe2, 0xeb, 0x54, 0xff, 0xe6, 0xe9, 0x56, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe6, 0xe7, 0x59, 0xff, 0xe4, 0xe4, 0x5d, 0xff, 0xdf, 0xe0, 0x67, 0xff, 0xd4, 0xd5, 0x79, 0xff, 0xc8, 0xc5, 0x8e, 0xff, 0xc5, 0xc0, 0xa2, 0xff, 0xe4, 0xde, 0xc9, 0xff, 0xf1, 0xec, 0xd9, 0xff, 0xf0, 0xec, 0xda, 0xff, 0xf7, 0xf3, 0xe5, 0xff, 0xfc, 0xfa, 0xee, 0xff, 0xfd, 0xfb, 0xf2, 0xff, 0xfe, 0xfe, 0xf4, 0xff, 0xff, 0xfe, 0xf5, 0xff, 0xff, 0xfe, 0xf4, 0xff, 0xff, 0xfe, 0xf4, 0xff, 0xff, 0xfe, 0xf4, 0xff, 0xfe, 0xfd, 0xf4, 0xff, 0xfd, 0xfc, 0xf3, 0xff, 0xfd, 0xfd, 0xf5, 0xff, 0xfe, 0xfd, 0xf6, 0xff, 0xfd, 0xfb, 0xf6, 0xff, 0xd9, 0xd7, 0xd3, 0xff, 0xb6, 0xb6, 0xb3, 0xe1, 0xc2, 0xc7, 0xc2, 0x3b, 
-  0xff, 0xff, 0xff, 0x02, 0x62, 0x65, 0x6e, 0x56, 0x4e, 0x54, 0x50, 0xea, 0x5e, 0x64, 0x42, 0xff, 0xa1, 0xa2, 0x64, 0xff, 0xb9, 0xb9, 0x60, 0xff, 0xc0, 0xc4, 0x50, 0xff, 0xc6, 0xcc, 0x4b, 0xff, 0xcf, 0xd3, 0x50, 0xff, 0xd6, 0xd8, 0x54, 0xff, 0xdc, 0xdd, 0x56, 0xff, 0xe2, 0xe3, 0x56, 0xff, 0xe4, 0xe7, 0x56, 0xff, 0xe6, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe1, 0xea, 0x55, 0xff, 0xe4, 0xea, 0x5a, 0xff, 0xe7, 0xe7, 0x5e, 0xff, 0xe7, 0xea, 0x57, 0xff, 0xe5, 0xeb, 0x57, 0xff, 0xe7, 0xe9, 0x5a, 0xff, 0xe7, 0xe9, 0x5a, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe9, 0xe8, 0x5a, 0xff, 0xe9, 0xe9, 0x59, 0xff, 0xe9, 0xea, 0x58, 0xff, 0xe9, 0xea, 0x58, 0xff, 0xe9, 0xe9, 0x59, 0xff, 0xe9, 0xe9, 0x59, 0xff, 0xe9, 0xe9, 0x5a, 0xff, 0xe9, 0xe9, 0x59, 0xff, 0xe8, 0xe8, 0x58, 0xff, 0xe8, 0xe8, 0x58, 0xff, 0xe8, 0xe8, 0x58, 0xff, 0xe8, 0xe8, 0x58, 0xff, 0xe8, 0xe8, 0x58, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe8, 0xea, 0x56, 0xff, 0xe8, 0xe8, 0x58, 0xff, 0xe1, 0xe6, 0x5b, 0xff, 0xd8, 0xe1, 0x73, 0xff, 0x94, 0x9a, 0x61, 0xff, 0x60, 0x61, 0x5b, 0xff, 0x95, 0x97, 0x98, 0xff, 0x60, 0x62, 0x44, 0xff, 0xc8, 0xcf, 0x73, 0xff, 0xde, 0xe6, 0x5a, 0xff, 0xe6, 0xe8, 0x53, 0xff, 0xe8, 0xe6, 0x59, 0xff, 0xe7, 0xe7, 0x59, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe1, 0xeb, 0x56, 0xff, 0xe0, 0xe8, 0x5f, 0xff, 0xd2, 0xd7, 0x77, 0xff, 0x80, 0x81, 0x4d, 0xff, 0x7b, 0x7b, 0x49, 0xff, 0xc9, 0xca, 0x76, 0xff, 0xdf, 0xe6, 0x6b, 0xff, 0xe3, 0xea, 0x58, 0xff, 0xe8, 0xeb, 0x54, 0xff, 0xe6, 0xea, 0x59, 0xff, 0xe1, 0xeb, 0x58, 0xff, 0xe2, 0xec, 0x53, 0xff, 0xe6, 0xeb, 0x54, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe5, 0xe7, 0x58, 0xff, 0xe7, 0xe6, 0x5a, 0xff, 0xe2, 0xe5, 0x5c, 0xff, 0xdc, 0xe0, 0x6e, 0xff, 0xc9, 0xc9, 0x83, 0xff, 0xbf, 0xba, 0x99, 0xff, 0xbf, 0xb9, 0xa8, 0xff, 0xd6, 0xd0, 0xbf, 0xff, 0xee, 0xe8, 0xd7, 0xff, 0xf0, 0xeb, 0xda, 0xff, 0xf2, 0xee, 0xdf, 0xff, 0xfc, 0xf9, 0xec, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xfe, 0xf4, 0xff, 0xff, 0xfe, 0xf4, 0xff, 0xff, 0xfe, 0xf4, 0xff, 0xff, 0xfe, 0xf4, 0xff, 0xff, 0xfe, 0xf5, 0xff, 0xfe, 0xfd, 0xf5, 0xff, 0xfd, 0xfe, 0xf5, 0xff, 0xfe, 0xfd, 0xf6, 0xff, 0xfe, 0xfd, 0xf8, 0xff, 0xfb, 0xfa, 0xf5, 0xff, 0xca, 0xc9, 0xc5, 0xfe, 0xbb, 0xbb, 0xb8, 0xb1, 
-  0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x04, 0x54, 0x59, 0x59, 0x70, 0x4c, 0x51, 0x4e, 0xeb, 0x55, 0x59, 0x46, 0xff, 0x87, 0x8c, 0x5d, 0xff, 0xa6, 0xad, 0x67, 0xff, 0xb4, 0xba, 0x5e, 0xff, 0xbd, 0xc2, 0x52, 0xff, 0xc3, 0xc2, 0x52, 0xff, 0xc6, 0xc6, 0x52, 0xff, 0xd1, 0xd5, 0x4f, 0xff, 0xde, 0xe2, 0x55, 0xff, 0xe1, 0xe6, 0x58, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe4, 0xe9, 0x55, 0xff, 0xe5, 0xe7, 0x5d, 0xff, 0xe3, 0xe9, 0x5c, 0xff, 0xe4, 0xec, 0x56, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe2, 0xeb, 0x53, 0xff, 0xe2, 0xeb, 0x52, 0xff, 0xe1, 0xe9, 0x57, 0xff, 0xde, 0xe4, 0x65, 0xff, 0xd3, 0xd6, 0x79, 0xff, 0x8b, 0x8b, 0x4e, 0xff, 0x74, 0x72, 0x44, 0xff, 0x97, 0x9a, 0x53, 0xff, 0xd8, 0xe0, 0x72, 0xff, 0xdf, 0xe8, 0x57, 0xff, 0xe6, 0xea, 0x51, 0xff, 0xe7, 0xe8, 0x56, 0xff, 0xe7, 0xe6, 0x59, 0xff, 0xe4, 0xe8, 0x56, 0xff, 0xe3, 0xea, 0x55, 0xff, 0xe4, 0xea, 0x5a, 0xff, 0xe0, 0xe5, 0x66, 0xff, 0xdd, 0xdf, 0x71, 0xff, 0xdf, 0xe2, 0x72, 0xff, 0xe1, 0xe9, 0x6c, 0xff, 0xe1, 0xe9, 0x5d, 0xff, 0xe4, 0xec, 0x5a, 0xff, 0xe3, 0xea, 0x58, 0xff, 0xe4, 0xeb, 0x5a, 0xff, 0xe3, 0xea, 0x59, 0xff, 0xe3, 0xea, 0x58, 0xff, 0xe2, 0xe9, 0x57, 0xff, 0xe2, 0xe9, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe8, 0xe5, 0x5b, 0xff, 0xe4, 0xe2, 0x5c, 0xff, 0xda, 0xde, 0x64, 0xff, 0xb1, 0xb7, 0x69, 0xff, 0x6e, 0x70, 0x57, 0xff, 0xa3, 0xa3, 0x9d, 0xd9, 0xbd, 0xba, 0xaf, 0xd3, 0xc6, 0xc1, 0xb1, 0xfe, 0xe2, 0xdb, 0xc8, 0xff, 0xed, 0xe8, 0xd6, 0xff, 0xef, 0xeb, 0xdd, 0xff, 0xfc, 0xfb, 0xf1, 0xff, 0xff, 0xfd, 0xf4, 0xff, 0xfd, 0xfc, 0xf2, 0xff, 0xfd, 0xfe, 0xf4, 0xff, 0xfd, 0xfe, 0xf4, 0xff, 0xfe, 0xff, 0xf4, 0xff, 0xfd, 0xff, 0xf4, 0xff, 0xfb, 0xfd, 0xf7, 0xff, 0xfb, 0xfe, 0xf9, 0xff, 0xfd, 0xfd, 0xf9, 0xff, 0xfe, 0xfe, 0xfa, 0xff, 0xe2, 0xe1, 0xdd, 0xff, 0xb7, 0xb7, 0xb2, 0xf2, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x04, 0x65, 0x68, 0x68, 0x53, 0x49, 0x4c, 0x46, 0xd2, 0x53, 0x55, 0x43, 0xfa, 0x63, 0x68, 0x45, 0xff, 0x83, 0x89, 0x53, 0xff, 0x9e, 0xa5, 0x5f, 0xff, 0xad, 0xb1, 0x68, 0xff, 0xb3, 0xb7, 0x65, 0xff, 0xbf, 0xc6, 0x5b, 0xff, 0xcf, 0xd5, 0x58, 0xff, 0xdb, 0xe0, 0x59, 0xff, 0xe6, 0xeb, 0x58, 0xff, 0xe9, 0xec, 0x57, 0xff, 0xe7, 0xe8, 0x5c, 0xff, 0xe3, 0xe9, 0x5a, 0xff, 0xe4, 0xeb, 0x56, 0xff, 0xe7, 0xe9, 0x59, 0xff, 0xe7, 0xe9, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe2, 0xe8, 0x5a, 0xff, 0xe2, 0xe8, 0x58, 0xff, 0xe2, 0xe8, 0x56, 0xff, 0xe0, 0xe7, 0x5b, 0xff, 0xdd, 0xe5, 0x67, 0xff, 0xd9, 0xe0, 0x73, 0xff, 0xd1, 0xd6, 0x72, 0xff, 0xd8, 0xdc, 0x6f, 0xff, 0xdf, 0xe6, 0x63, 0xff, 0xe2, 0xe8, 0x55, 0xff, 0xe4, 0xe9, 0x53, 0xff, 0xe3, 0xe9, 0x54, 0xff, 0xe1, 0xea, 0x52, 0xff, 0xdf, 0xeb, 0x52, 0xff, 0xdf, 0xeb, 0x53, 0xff, 0xe0, 0xeb, 0x54, 0xff, 0xe1, 0xea, 0x5a, 0xff, 0xe1, 0xe7, 0x5f, 0xff, 0xe3, 0xe8, 0x5f, 0xff, 0xe4, 0xeb, 0x5b, 0xff, 0xe3, 0xea, 0x59, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe1, 0xe8, 0x57, 0xff, 0xe4, 0xeb, 0x5a, 0xff, 0xe3, 0xea, 0x59, 0xff, 0xe3, 0xea, 0x59, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe3, 0xe8, 0x56, 0xff, 0xe6, 0xe8, 0x56, 0xff, 0xe7, 0xe5, 0x59, 0xff, 0xe4, 0xe2, 0x5d, 0xff, 0xce, 0xd2, 0x5d, 0xff, 0xa2, 0xa9, 0x63, 0xff, 0x50, 0x54, 0x44, 0xfe, 0x6b, 0x6f, 0x6d, 0x8f, 0xd0, 0xd0, 0xc8, 0x41, 0xbb, 0xb8, 0xa8, 0xf4, 0xc1, 0xbb, 0xa8, 0xff, 0xec, 0xe8, 0xd6, 0xff, 0xea, 0xe6, 0xd8, 0xff, 0xfb, 0xfa, 0xee, 0xff, 0xfd, 0xfe, 0xf4, 0xff, 0xfa, 0xfb, 0xf1, 0xff, 0xfd, 0xfe, 0xf5, 0xff, 0xfd, 0xfd, 0xf6, 0xff, 0xfe, 0xfd, 0xf7, 0xff, 0xfe, 0xfd, 0xf8, 0xff, 0xfc, 0xfe, 0xf6, 0xff, 0xfd, 0xfe, 0xf7, 0xff, 0xfe, 0xfd, 0xf6, 0xff, 0xff, 0xfe, 0xf7, 0xff, 0xed, 0xeb, 0xe5, 0xff, 0xb5, 0xb5, 0xad, 0xfb, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x76, 0x76, 0x7f, 0x1a, 0x5c, 0x5c, 0x5c, 0x6f, 0x4b, 0x4f, 0x47, 0xcf, 0x4b, 0x53, 0x45, 0xf7, 0x50, 0x57, 0x41, 0xfe, 0x65, 0x6b, 0x4f, 0xff, 0x81, 0x87, 0x5f, 0xff, 0xa3, 0xaa, 0x65, 0xff, 0xc4, 0xc9, 0x68, 0xff, 0xd2, 0xd5, 0x5e, 0xff, 0xe3, 0xe6, 0x59, 0xff, 0xe9, 0xeb, 0x56, 0xff, 0xe7, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe3, 0xea, 0x56, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe1, 0xe8, 0x58, 0xff, 0xe2, 0xe8, 0x57, 0xff, 0xe3, 0xe9, 0x55, 0xff, 0xe4, 0xe9, 0x55, 0xff, 0xe1, 0xe9, 0x58, 0xff, 0xde, 0xe7, 0x5b, 0xff, 0xdd, 0xe5, 0x5d, 0xff, 0xe0, 0xe5, 0x5c, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe6, 0xe8, 0x57, 0xff, 0xe5, 0xe7, 0x58, 0xff, 0xe3, 0xe8, 0x59, 0xff, 0xe1, 0xec, 0x53, 0xff, 0xde, 0xeb, 0x52, 0xff, 0xdd, 0xe8, 0x53, 0xff, 0xde, 0xe9, 0x52, 0xff, 0xdf, 0xe8, 0x52, 0xff, 0xe3, 0xe7, 0x56, 0xff, 0xe5, 0xe7, 0x55, 0xff, 0xe6, 0xe9, 0x55, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe3, 0xea, 0x59, 0xff, 0xe3, 0xea, 0x59, 0xff, 0xe3, 0xea, 0x59, 0xff, 0xe3, 0xea, 0x59, 0xff, 0xe3, 0xea, 0x59, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe4, 0xe7, 0x56, 0xff, 0xe6, 0xe8, 0x57, 0xff, 0xe4, 0xe4, 0x57, 0xff, 0xdb, 0xdd, 0x59, 0xff, 0xba, 0xbf, 0x57, 0xff, 0x8c, 0x91, 0x5a, 0xff, 0x47, 0x4e, 0x45, 0xfc, 0x71, 0x78, 0x78, 0x71, 0xc3, 0xc3, 0xba, 0x55, 0xbf, 0xbc, 0xad, 0xfa, 0xed, 0xe8, 0xd6, 0xff, 0xef, 0xec, 0xd9, 0xff, 0xf0, 0xee, 0xde, 0xff, 0xfd, 0xfd, 0xf1, 0xff, 0xfd, 0xfe, 0xf3, 0xff, 0xfd, 0xfd, 0xf3, 0xff, 0xfd, 0xfd, 0xf3, 0xff, 0xfe, 0xfd, 0xf6, 0xff, 0xfd, 0xfb, 0xf4, 0xff, 0xfe, 0xfb, 0xf5, 0xff, 0xfd, 0xfd, 0xf2, 0xff, 0xfe, 0xfe, 0xf2, 0xff, 0xff, 0xfe, 0xf4, 0xff, 0xf6, 0xf4, 0xe9, 0xff, 0xde, 0xdc, 0xd2, 0xff, 0xb6, 0xb4, 0xa9, 0xfb, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x8b, 0x97, 0x97, 0x16, 0x50, 0x55, 0x55, 0x60, 0x4d, 0x51, 0x53, 0xad, 0x50, 0x55, 0x56, 0xe2, 0x59, 0x5e, 0x57, 0xf9, 0x64, 0x67, 0x49, 0xff, 0xa7, 0xa6, 0x67, 0xff, 0xcc, 0xcc, 0x6a, 0xff, 0xde, 0xe2, 0x5f, 0xff, 0xe7, 0xea, 0x57, 0xff, 0xe7, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xea, 0x57, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe5, 0xe7, 0x56, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe5, 0xea, 0x58, 0xff, 0xe5, 0xe9, 0x55, 0xff, 0xe6, 0xe9, 0x55, 0xff, 0xe4, 0xe8, 0x56, 0xff, 0xe3, 0xe7, 0x57, 0xff, 0xe2, 0xe8, 0x57, 0xff, 0xe0, 0xe7, 0x55, 0xff, 0xe1, 0xe7, 0x55, 0xff, 0xe3, 0xe7, 0x55, 0xff, 0xe4, 0xe9, 0x55, 0xff, 0xe4, 0xea, 0x54, 0xff, 0xe5, 0xea, 0x56, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe1, 0xe8, 0x57, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe3, 0xea, 0x59, 0xff, 0xe3, 0xea, 0x59, 0xff, 0xe3, 0xea, 0x59, 0xff, 0xe2, 0xe9, 0x57, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe5, 0xe7, 0x5a, 0xff, 0xe0, 0xe2, 0x58, 0xff, 0xcb, 0xcf, 0x51, 0xff, 0xac, 0xb2, 0x5b, 0xff, 0x70, 0x74, 0x4e, 0xff, 0x47, 0x4d, 0x4a, 0xf4, 0x88, 0x90, 0x90, 0x3e, 0xb8, 0xba, 0xb1, 0x8c, 0xc6, 0xc4, 0xb5, 0xff, 0xf2, 0xef, 0xdb, 0xff, 0xf3, 0xf0, 0xdc, 0xff, 0xf8, 0xf7, 0xe5, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xfe, 0xfd, 0xf3, 0xff, 0xff, 0xfe, 0xf3, 0xff, 0xfa, 0xfa, 0xec, 0xff, 0xf4, 0xf4, 0xe4, 0xff, 0xf7, 0xf7, 0xe5, 0xff, 0xfb, 0xfb, 0xe8, 0xff, 0xfb, 0xfb, 0xea, 0xff, 0xf9, 0xf7, 0xe6, 0xff, 0xf3, 0xef, 0xe0, 0xff, 0xef, 0xea, 0xdd, 0xff, 0xd3, 0xce, 0xc3, 0xff, 0xb2, 0xb0, 0xa5, 0xed, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x06, 0x6b, 0x72, 0x79, 0x26, 0x6a, 0x6f, 0x73, 0x6a, 0x61, 0x61, 0x59, 0xeb, 0x7c, 0x79, 0x57, 0xff, 0xbd, 0xbc, 0x73, 0xff, 0xd1, 0xd4, 0x61, 0xff, 0xe0, 0xe5, 0x59, 0xff, 0xe5, 0xe7, 0x5a, 0xff, 0xe3, 0xe7, 0x5a, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xea, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe7, 0x5c, 0xff, 0xe5, 0xe6, 0x5d, 0xff, 0xe6, 0xe6, 0x5b, 0xff, 0xe5, 0xe6, 0x58, 0xff, 0xe4, 0xe8, 0x57, 0xff, 0xe4, 0xe9, 0x55, 0xff, 0xe3, 0xea, 0x55, 0xff, 0xe1, 0xea, 0x55, 0xff, 0xe1, 0xea, 0x55, 0xff, 0xe0, 0xeb, 0x55, 0xff, 0xde, 0xe9, 0x58, 0xff, 0xdc, 0xe4, 0x5a, 0xff, 0xdb, 0xe2, 0x5e, 0xff, 0xdb, 0xe2, 0x5d, 0xff, 0xd9, 0xe1, 0x5a, 0xff, 0xdd, 0xe4, 0x5d, 0xff, 0xdd, 0xe5, 0x5b, 0xff, 0xde, 0xe8, 0x56, 0xff, 0xdf, 0xea, 0x54, 0xff, 0xe0, 0xea, 0x55, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe3, 0xea, 0x59, 0xff, 0xe3, 0xea, 0x59, 0xff, 0xe3, 0xea, 0x59, 0xff, 0xe1, 0xe8, 0x56, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe2, 0xe6, 0x5e, 0xff, 0xd5, 0xd9, 0x57, 0xff, 0xbe, 0xc2, 0x51, 0xff, 0xa6, 0xa8, 0x65, 0xff, 0x59, 0x5c, 0x47, 0xff, 0x45, 0x4b, 0x4c, 0xcf, 0xaa, 0xb5, 0xb5, 0x18, 0xb5, 0xb7, 0xb1, 0xa3, 0xcb, 0xc9, 0xb9, 0xff, 0xf4, 0xef, 0xda, 0xff, 0xf2, 0xee, 0xd8, 0xff, 0xf1, 0xef, 0xda, 0xff, 0xfd, 0xfc, 0xee, 0xff, 0xff, 0xfe, 0xf1, 0xff, 0xfe, 0xfd, 0xee, 0xff, 0xf6, 0xf4, 0xe1, 0xff, 0xec, 0xeb, 0xd3, 0xff, 0xed, 0xec, 0xd0, 0xff, 0xed, 0xeb, 0xcf, 0xff, 0xed, 0xe9, 0xd1, 0xff, 0xed, 0xe8, 0xd2, 0xff, 0xee, 0xe8, 0xd6, 0xff, 0xec, 0xe6, 0xd7, 0xff, 0xbf, 0xbc, 0xb0, 0xfa, 0xba, 0xb6, 0xad, 0x8c, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x04, 0x5f, 0x63, 0x63, 0x8e, 0x5f, 0x62, 0x51, 0xfc, 0x9f, 0xa1, 0x68, 0xff, 0xc1, 0xc6, 0x62, 0xff, 0xd4, 0xdb, 0x56, 0xff, 0xe4, 0xe7, 0x5d, 0xff, 0xe4, 0xe7, 0x5c, 0xff, 0xe5, 0xe8, 0x58, 0xff, 0xe7, 0xe8, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe6, 0xe7, 0x5b, 0xff, 0xe5, 0xe7, 0x5b, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe2, 0xe9, 0x57, 0xff, 0xe2, 0xea, 0x56, 0xff, 0xe1, 0xea, 0x56, 0xff, 0xe0, 0xe9, 0x56, 0xff, 0xdd, 0xe6, 0x58, 0xff, 0xdb, 0xe6, 0x62, 0xff, 0xd8, 0xe5, 0x6b, 0xff, 0xd5, 0xe4, 0x74, 0xff, 0xdc, 0xec, 0x84, 0xff, 0xe1, 0xee, 0x8f, 0xff, 0xe3, 0xf2, 0x93, 0xff, 0xe4, 0xf5, 0x92, 0xff, 0xe3, 0xef, 0x91, 0xff, 0xd9, 0xe4, 0x7d, 0xff, 0xd7, 0xe2, 0x69, 0xff, 0xda, 0xe6, 0x5f, 0xff, 0xdd, 0xe5, 0x5a, 0xff, 0xe1, 0xe8, 0x58, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe1, 0xe8, 0x57, 0xff, 0xe3, 0xea, 0x59, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xdf, 0xe7, 0x55, 0xff, 0xe2, 0xea, 0x57, 0xff, 0xdd, 0xe2, 0x5f, 0xff, 0xca, 0xce, 0x55, 0xff, 0xb8, 0xba, 0x57, 0xff, 0x9d, 0x9c, 0x67, 0xff, 0x52, 0x54, 0x4a, 0xfc, 0x56, 0x5b, 0x5d, 0x83, 0xbf, 0xbf, 0xbf, 0x04, 0xb8, 0xba, 0xaf, 0x8c, 0xc8, 0xc5, 0xb3, 0xff, 0xf2, 0xed, 0xd6, 0xff, 0xf2, 0xee, 0xd5, 0xff, 0xee, 0xeb, 0xd3, 0xff, 0xed, 0xea, 0xd5, 0xff, 0xf3, 0xf0, 0xdc, 0xff, 0xf1, 0xee, 0xd9, 0xff, 0xf0, 0xeb, 0xd5, 0xff, 0xee, 0xe9, 0xd2, 0xff, 0xf0, 0xea, 0xd2, 0xff, 0xf0, 0xea, 0xd1, 0xff, 0xef, 0xe9, 0xce, 0xff, 0xed, 0xe6, 0xcc, 0xff, 0xea, 0xe3, 0xcf, 0xff, 0xc8, 0xc2, 0xb3, 0xfd, 0xb7, 0xb4, 0xab, 0xc2, 0xc3, 0xc3, 0xbb, 0x22, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x71, 0x71, 0x34, 0x55, 0x5d, 0x54, 0xe8, 0x76, 0x7a, 0x51, 0xff, 0xb2, 0xb6, 0x62, 0xff, 0xc4, 0xcb, 0x51, 0xff, 0xdb, 0xdf, 0x59, 0xff, 0xe1, 0xe5, 0x5e, 0xff, 0xe3, 0xe7, 0x59, 0xff, 0xe7, 0xe9, 0x55, 0xff, 0xe7, 0xe9, 0x57, 0xff, 0xe7, 0xe9, 0x58, 0xff, 0xe7, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe8, 0xeb, 0x59, 0xff, 0xe8, 0xeb, 0x5a, 0xff, 0xe8, 0xeb, 0x5a, 0xff, 0xe8, 0xeb, 0x5a, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe7, 0xeb, 0x54, 0xff, 0xe6, 0xea, 0x54, 0xff, 0xe4, 0xea, 0x54, 0xff, 0xe1, 0xe9, 0x54, 0xff, 0xdd, 0xe6, 0x56, 0xff, 0xdb, 0xe6, 0x5b, 0xff, 0xd9, 0xe4, 0x60, 0xff, 0xd9, 0xe2, 0x6c, 0xff, 0xdf, 0xe9, 0x85, 0xff, 0xe8, 0xf4, 0xa3, 0xff, 0xec, 0xfb, 0xb6, 0xff, 0xea, 0xfd, 0xbc, 0xff, 0xea, 0xfe, 0xbf, 0xff, 0xe7, 0xfd, 0xbe, 0xff, 0xe8, 0xfc, 0xbf, 0xff, 0xea, 0xfa, 0xbf, 0xff, 0xee, 0xfb, 0xb7, 0xff, 0xee, 0xf9, 0xa3, 0xff, 0xe1, 0xec, 0x84, 0xff, 0xd9, 0xe1, 0x6e, 0xff, 0xdd, 0xe4, 0x60, 0xff, 0xdf, 0xe8, 0x57, 0xff, 0xe0, 0xe8, 0x55, 0xff, 0xe2, 0xe8, 0x58, 0xff, 0xe1, 0xe8, 0x57, 0xff, 0xe2, 0xe9, 0x56, 0xff, 0xe2, 0xe7, 0x56, 0xff, 0xdd, 0xe6, 0x55, 0xff, 0xd1, 0xd4, 0x56, 0xff, 0xbe, 0xc1, 0x4f, 0xff, 0xb2, 0xb7, 0x5e, 0xff, 0x83, 0x84, 0x59, 0xff, 0x51, 0x53, 0x4e, 0xee, 0x6d, 0x71, 0x75, 0x3d, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xbb, 0xb0, 0x44, 0xbc, 0xba, 0xaa, 0xf1, 0xe6, 0xe1, 0xcb, 0xff, 0xf0, 0xeb, 0xd3, 0xff, 0xef, 0xeb, 0xd2, 0xff, 0xef, 0xeb, 0xd3, 0xff, 0xee, 0xea, 0xd2, 0xff, 0xf0, 0xeb, 0xd5, 0xff, 0xf1, 0xeb, 0xd7, 0xff, 0xda, 0xd3, 0xc0, 0xff, 0xd2, 0xca, 0xba, 0xff, 0xe3, 0xda, 0xcb, 0xff, 0xe7, 0xdf, 0xc7, 0xff, 0xd9, 0xd2, 0xbb, 0xff, 0xbf, 0xba, 0xa8, 0xf8, 0xb4, 0xb1, 0xa4, 0xb8, 0xba, 0xba, 0xb1, 0x34, 0xff, 0xff, 0xff, 0x01, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x08, 0x51, 0x54, 0x56, 0xab, 0x5b, 0x5f, 0x4e, 0xfe, 0x9c, 0x9f, 0x5f, 0xff, 0xb8, 0xbc, 0x53, 0xff, 0xcc, 0xd0, 0x50, 0xff, 0xdd, 0xe3, 0x5e, 0xff, 0xe1, 0xe6, 0x5d, 0xff, 0xe7, 0xea, 0x55, 0xff, 0xe7, 0xe9, 0x55, 0xff, 0xe7, 0xe9, 0x57, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xea, 0x57, 0xff, 0xe7, 0xea, 0x57, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe2, 0xea, 0x57, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe7, 0xea, 0x57, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe1, 0xe8, 0x59, 0xff, 0xda, 0xe6, 0x60, 0xff, 0xd1, 0xe0, 0x69, 0xff, 0xd7, 0xe6, 0x81, 0xff, 0xea, 0xf7, 0xa4, 0xff, 0xef, 0xfe, 0xb9, 0xff, 0xe9, 0xfb, 0xc4, 0xff, 0xe2, 0xf7, 0xc9, 0xff, 0xe0, 0xf8, 0xca, 0xff, 0xe0, 0xf9, 0xc8, 0xff, 0xe0, 0xf9, 0xc9, 0xff, 0xe0, 0xf7, 0xca, 0xff, 0xdf, 0xf6, 0xc9, 0xff, 0xe2, 0xf9, 0xc6, 0xff, 0xe5, 0xf9, 0xbb, 0xff, 0xec, 0xfc, 0xb2, 0xff, 0xe5, 0xf3, 0x9d, 0xff, 0xd4, 0xdf, 0x71, 0xff, 0xda, 0xe6, 0x5c, 0xff, 0xe1, 0xea, 0x54, 0xff, 0xe3, 0xe8, 0x58, 0xff, 0xe2, 0xe8, 0x56, 0xff, 0xe2, 0xe7, 0x52, 0xff, 0xe5, 0xe7, 0x5a, 0xff, 0xd7, 0xde, 0x57, 0xff, 0xc4, 0xc4, 0x4e, 0xff, 0xb9, 0xba, 0x51, 0xff, 0xa8, 0xb0, 0x65, 0xff, 0x61, 0x69, 0x4c, 0xff, 0x53, 0x58, 0x58, 0xc2, 0xaa, 0xaa, 0xaa, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xd4, 0xbf, 0x0c, 0xb4, 0xb4, 0xab, 0x9d, 0xc0, 0xbf, 0xb0, 0xfb, 0xe4, 0xe0, 0xce, 0xff, 0xf2, 0xee, 0xd7, 0xff, 0xf0, 0xea, 0xd6, 0xff, 0xf0, 0xea, 0xd7, 0xff, 0xf2, 0xed, 0xdb, 0xff, 0xd9, 0xd5, 0xc5, 0xff, 0xbc, 0xb8, 0xaa, 0xee, 0xbc, 0xba, 0xae, 0xb4, 0xb9, 0xb8, 0xad, 0xd6, 0xb9, 0xb6, 0xa7, 0xe3, 0xb6, 0xb5, 0xa5, 0xc0, 0xb1, 0xb1, 0xa5, 0x6c, 0xba, 0xba, 0xb1, 0x1a, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x63, 0x69, 0x4b, 0x4f, 0x51, 0x4c, 0xf1, 0x7c, 0x7f, 0x50, 0xff, 0xb1, 0xb2, 0x5b, 0xff, 0xc1, 0xc2, 0x4c, 0xff, 0xd1, 0xd1, 0x52, 0xff, 0xe0, 0xe2, 0x5c, 0xff, 0xe6, 0xe9, 0x5b, 0xff, 0xe6, 0xea, 0x58, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x56, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe3, 0xe8, 0x5a, 0xff, 0xe3, 0xe8, 0x5a, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xde, 0xe7, 0x58, 0xff, 0xd5, 0xe4, 0x5e, 0xff, 0xce, 0xe2, 0x70, 0xff, 0xe1, 0xf4, 0x9d, 0xff, 0xeb, 0xfc, 0xb7, 0xff, 0xe7, 0xfa, 0xbd, 0xff, 0xe4, 0xf9, 0xc3, 0xff, 0xdf, 0xf8, 0xc8, 0xff, 0xde, 0xf8, 0xcc, 0xff, 0xde, 0xfa, 0xcd, 0xff, 0xdd, 0xfa, 0xca, 0xff, 0xdd, 0xf9, 0xca, 0xff, 0xdc, 0xf7, 0xcd, 0xff, 0xdb, 0xf6, 0xcd, 0xff, 0xdc, 0xf7, 0xcc, 0xff, 0xde, 0xf8, 0xc5, 0xff, 0xe3, 0xf9, 0xbe, 0xff, 0xe9, 0xfc, 0xb8, 0xff, 0xe6, 0xf4, 0x9a, 0xff, 0xd5, 0xe2, 0x67, 0xff, 0xde, 0xe6, 0x58, 0xff, 0xe3, 0xe6, 0x56, 0xff, 0xe2, 0xe7, 0x55, 0xff, 0xe0, 0xe7, 0x55, 0xff, 0xda, 0xde, 0x57, 0xff, 0xc7, 0xc8, 0x51, 0xff, 0xbb, 0xb9, 0x4c, 0xff, 0xb5, 0xb5, 0x59, 0xff, 0x97, 0x9a, 0x60, 0xff, 0x53, 0x57, 0x4d, 0xfc, 0x5c, 0x60, 0x64, 0x7d, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0xc2, 0xc2, 0x19, 0xb6, 0xb4, 0xa9, 0x9a, 0xb7, 0xb4, 0xa6, 0xf2, 0xc5, 0xc1, 0xb2, 0xfe, 0xd0, 0xcc, 0xbc, 0xff, 0xcf, 0xcb, 0xbc, 0xff, 0xc0, 0xbd, 0xae, 0xfd, 0xb5, 0xb4, 0xa7, 0xdf, 0xba, 0xb8, 0xad, 0x64, 0xeb, 0xeb, 0xd8, 0x0d, 0xd1, 0xd1, 0xc5, 0x16, 0xc8, 0xc8, 0xbf, 0x1c, 0xdb, 0xdb, 0xc8, 0x0e, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x0c, 0x40, 0x43, 0x43, 0xc3, 0x56, 0x59, 0x41, 0xff, 0xa6, 0xa6, 0x64, 0xff, 0xb9, 0xb8, 0x52, 0xff, 0xc7, 0xc6, 0x4d, 0xff, 0xd1, 0xd1, 0x51, 0xff, 0xdd, 0xe0, 0x5a, 0xff, 0xe4, 0xe9, 0x5a, 0xff, 0xe5, 0xea, 0x57, 0xff, 0xe5, 0xea, 0x56, 0xff, 0xe6, 0xea, 0x57, 0xff, 0xe7, 0xea, 0x59, 0xff, 0xe7, 0xe9, 0x5a, 0xff, 0xe7, 0xe9, 0x5a, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xeb, 0x58, 0xff, 0xe5, 0xeb, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe5, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe6, 0xea, 0x56, 0xff, 0xe2, 0xe8, 0x5a, 0xff, 0xd5, 0xe0, 0x60, 0xff, 0xd5, 0xe7, 0x7a, 0xff, 0xe7, 0xfc, 0xa7, 0xff, 0xe4, 0xfc, 0xbd, 0xff, 0xe1, 0xf7, 0xc8, 0xff, 0xdf, 0xf6, 0xc9, 0xff, 0xde, 0xf7, 0xca, 0xff, 0xdb, 0xf7, 0xca, 0xff, 0xdb, 0xf8, 0xcc, 0xff, 0xdc, 0xf9, 0xcc, 0xff, 0xdd, 0xf8, 0xcb, 0xff, 0xdc, 0xf8, 0xca, 0xff, 0xdb, 0xf7, 0xcc, 0xff, 0xd9, 0xf6, 0xcf, 0xff, 0xd9, 0xf5, 0xcf, 0xff, 0xdb, 0xf6, 0xcd, 0xff, 0xdd, 0xf6, 0xc9, 0xff, 0xe1, 0xf8, 0xc5, 0xff, 0xeb, 0xfd, 0xb6, 0xff, 0xdd, 0xea, 0x86, 0xff, 0xda, 0xe1, 0x5f, 0xff, 0xe2, 0xe5, 0x57, 0xff, 0xe1, 0xe5, 0x58, 0xff, 0xd5, 0xdc, 0x53, 0xff, 0xc8, 0xce, 0x4e, 0xff, 0xbc, 0xb9, 0x4f, 0xff, 0xb5, 0xb4, 0x4f, 0xff, 0xaf, 0xb1, 0x62, 0xff, 0x75, 0x77, 0x50, 0xff, 0x53, 0x53, 0x56, 0xe9, 0x6d, 0x6d, 0x76, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xc4, 0xc4, 0x0d, 0xb7, 0xb4, 0xad, 0x4e, 0xb5, 0xb1, 0xa7, 0x97, 0xb4, 0xb4, 0xa9, 0xba, 0xb1, 0xb0, 0xa4, 0xb4, 0xb1, 0xb3, 0xa7, 0x83, 0xb4, 0xb4, 0xaf, 0x33, 0xff, 0xff, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x63, 0x63, 0x50, 0x47, 0x4b, 0x41, 0xf2, 0x84, 0x87, 0x58, 0xff, 0xb2, 0xb2, 0x62, 0xff, 0xbd, 0xbb, 0x50, 0xff, 0xc4, 0xc4, 0x4c, 0xff, 0xce, 0xd2, 0x54, 0xff, 0xdd, 0xe1, 0x5a, 0xff, 0xe2, 0xe8, 0x5b, 0xff, 0xe3, 0xea, 0x58, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe7, 0xe9, 0x5a, 0xff, 0xe6, 0xe8, 0x5a, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe4, 0xe9, 0x5b, 0xff, 0xe2, 0xe8, 0x5a, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x55, 0xff, 0xe5, 0xeb, 0x57, 0xff, 0xe2, 0xe9, 0x55, 0xff, 0xe4, 0xeb, 0x55, 0xff, 0xdd, 0xe5, 0x62, 0xff, 0xdf, 0xe9, 0x85, 0xff, 0xeb, 0xfb, 0xad, 0xff, 0xe5, 0xfb, 0xbd, 0xff, 0xe0, 0xf8, 0xc6, 0xff, 0xdd, 0xf8, 0xca, 0xff, 0xdd, 0xf8, 0xc9, 0xff, 0xdb, 0xf8, 0xc8, 0xff, 0xdc, 0xf8, 0xc8, 0xff, 0xdc, 0xf8, 0xc9, 0xff, 0xde, 0xf8, 0xcb, 0xff, 0xdf, 0xf6, 0xcc, 0xff, 0xdf, 0xf7, 0xcb, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xdc, 0xf7, 0xcc, 0xff, 0xdc, 0xf6, 0xce, 0xff, 0xdc, 0xf5, 0xcf, 0xff, 0xde, 0xf5, 0xce, 0xff, 0xdf, 0xf5, 0xcd, 0xff, 0xe5, 0xfa, 0xc2, 0xff, 0xe8, 0xf8, 0xa7, 0xff, 0xd4, 0xdd, 0x69, 0xff, 0xde, 0xe3, 0x5c, 0xff, 0xd7, 0xda, 0x56, 0xff, 0xc5, 0xc9, 0x4e, 0xff, 0xbc, 0xc0, 0x4a, 0xff, 0xb4, 0xb4, 0x4d, 0xff, 0xad, 0xb3, 0x54, 0xff, 0x9b, 0xa1, 0x60, 0xff, 0x55, 0x56, 0x45, 0xfe, 0x56, 0x54, 0x5c, 0xa0, 0xd4, 0xd4, 0xd4, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xcc, 0xcc, 0xcc, 0x05, 0xd8, 0xd8, 0xc4, 0x0d, 0xc6, 0xc6, 0xc6, 0x09, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0xb1, 0xb1, 0x0d, 0x4e, 0x55, 0x50, 0xad, 0x58, 0x5d, 0x47, 0xfe, 0xa0, 0xa1, 0x6c, 0xff, 0xb4, 0xb4, 0x5f, 0xff, 0xbc, 0xbd, 0x51, 0xff, 0xc1, 0xc6, 0x50, 0xff, 0xd0, 0xd4, 0x57, 0xff, 0xdc, 0xe1, 0x5d, 0xff, 0xe3, 0xe8, 0x5c, 0xff, 0xe4, 0xea, 0x59, 0xff, 0xe5, 0xeb, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe6, 0xe8, 0x5a, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x59, 0xff, 0xe3, 0xe8, 0x5c, 0xff, 0xe2, 0xe8, 0x5b, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe4, 0xe9, 0x57, 0xff, 0xe1, 0xea, 0x58, 0xff, 0xdf, 0xea, 0x5b, 0xff, 0xd9, 0xe4, 0x62, 0xff, 0xdf, 0xea, 0x83, 0xff, 0xef, 0xfb, 0xb3, 0xff, 0xe8, 0xfa, 0xc5, 0xff, 0xdf, 0xf6, 0xc8, 0xff, 0xdf, 0xf9, 0xc9, 0xff, 0xde, 0xf9, 0xc6, 0xff, 0xde, 0xf9, 0xc5, 0xff, 0xdd, 0xf9, 0xc5, 0xff, 0xde, 0xf9, 0xc7, 0xff, 0xdf, 0xf8, 0xc8, 0xff, 0xe0, 0xf8, 0xca, 0xff, 0xe0, 0xf7, 0xcb, 0xff, 0xe0, 0xf8, 0xcb, 0xff, 0xe0, 0xf9, 0xc9, 0xff, 0xe0, 0xf8, 0xcb, 0xff, 0xdf, 0xf8, 0xcc, 0xff, 0xdf, 0xf6, 0xcd, 0xff, 0xdf, 0xf4, 0xcd, 0xff, 0xe0, 0xf5, 0xce, 0xff, 0xe2, 0xf9, 0xc9, 0xff, 0xe9, 0xfb, 0xb8, 0xff, 0xda, 0xe5, 0x82, 0xff, 0xd2, 0xda, 0x5d, 0xff, 0xc5, 0xc9, 0x52, 0xff, 0xbc, 0xbe, 0x52, 0xff, 0xb6, 0xb9, 0x4c, 0xff, 0xad, 0xaf, 0x51, 0xff, 0xa5, 0xae, 0x60, 0xff, 0x6a, 0x74, 0x48, 0xff, 0x4d, 0x50, 0x4d, 0xea, 0x7d, 0x7d, 0x86, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x70, 0x70, 0x3b, 0x4d, 0x54, 0x51, 0xe4, 0x6d, 0x70, 0x55, 0xff, 0xad, 0xad, 0x6f, 0xff, 0xb8, 0xb9, 0x5c, 0xff, 0xb9, 0xbd, 0x50, 0xff, 0xc3, 0xc5, 0x52, 0xff, 0xd1, 0xd3, 0x58, 0xff, 0xdc, 0xe1, 0x5b, 0xff, 0xe1, 0xe8, 0x59, 0xff, 0xe3, 0xea, 0x57, 0xff, 0xe5, 0xea, 0x58, 0xff, 0xe4, 0xe9, 0x59, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x59, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x59, 0xff, 0xe3, 0xe9, 0x59, 0xff, 0xe2, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe5, 0xea, 0x58, 0xff, 0xe2, 0xe9, 0x5a, 0xff, 0xdd, 0xe7, 0x5c, 0xff, 0xd8, 0xe5, 0x61, 0xff, 0xd7, 0xe5, 0x84, 0xff, 0xed, 0xfc, 0xb1, 0xff, 0xe7, 0xfb, 0xc4, 0xff, 0xdf, 0xf8, 0xce, 0xff, 0xdb, 0xf7, 0xcc, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xdf, 0xf8, 0xc7, 0xff, 0xde, 0xf8, 0xc7, 0xff, 0xde, 0xf8, 0xc7, 0xff, 0xde, 0xf8, 0xc8, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xdc, 0xf8, 0xc7, 0xff, 0xdc, 0xf8, 0xc6, 0xff, 0xdb, 0xf8, 0xc8, 0xff, 0xdd, 0xf7, 0xca, 0xff, 0xdd, 0xf8, 0xca, 0xff, 0xde, 0xf7, 0xcb, 0xff, 0xdd, 0xf6, 0xcb, 0xff, 0xdd, 0xf6, 0xcc, 0xff, 0xdf, 0xf8, 0xcf, 0xff, 0xdf, 0xf7, 0xcc, 0xff, 0xe6, 0xf7, 0xbe, 0xff, 0xdf, 0xec, 0x95, 0xff, 0xc4, 0xcf, 0x5c, 0xff, 0xbc, 0xc0, 0x55, 0xff, 0xbb, 0xb9, 0x5a, 0xff, 0xb7, 0xb6, 0x53, 0xff, 0xad, 0xae, 0x5f, 0xff, 0x8d, 0x97, 0x5e, 0xff, 0x47, 0x52, 0x44, 0xfd, 0x4e, 0x53, 0x5c, 0x99, 0xb6, 0xb6, 0xb6, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x66, 0x68, 0x6c, 0x78, 0x55, 0x5a, 0x51, 0xf5, 0x82, 0x86, 0x5d, 0xff, 0xb0, 0xb3, 0x6c, 0xff, 0xb8, 0xbb, 0x59, 0xff, 0xbd, 0xbd, 0x54, 0xff, 0xc4, 0xc5, 0x53, 0xff, 0xcd, 0xd2, 0x52, 0xff, 0xd9, 0xe0, 0x55, 0xff, 0xe2, 0xe8, 0x58, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x57, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe7, 0xe8, 0x59, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe7, 0xe9, 0x58, 0xff, 0xe6, 0xe9, 0x56, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe3, 0xea, 0x58, 0xff, 0xe3, 0xea, 0x57, 0xff, 0xe5, 0xea, 0x56, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe3, 0xea, 0x57, 0xff, 0xe1, 0xe8, 0x5a, 0xff, 0xd7, 0xe2, 0x64, 0xff, 0xd3, 0xe2, 0x7b, 0xff, 0xe8, 0xfa, 0xb4, 0xff, 0xea, 0xfd, 0xc6, 0xff, 0xe1, 0xf9, 0xcb, 0xff, 0xdb, 0xf7, 0xcc, 0xff, 0xdc, 0xf9, 0xcc, 0xff, 0xde, 0xf7, 0xca, 0xff, 0xe0, 0xf7, 0xcb, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xdd, 0xf7, 0xc9, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xdd, 0xf8, 0xca, 0xff, 0xdc, 0xf9, 0xc8, 0xff, 0xdb, 0xfa, 0xc6, 0xff, 0xdb, 0xf8, 0xc7, 0xff, 0xdb, 0xf6, 0xc9, 0xff, 0xdb, 0xf6, 0xca, 0xff, 0xdb, 0xf6, 0xca, 0xff, 0xdd, 0xf7, 0xcc, 0xff, 0xe0, 0xf7, 0xcc, 0xff, 0xe1, 0xf7, 0xcc, 0xff, 0xdc, 0xf1, 0xc7, 0xff, 0xdc, 0xee, 0xb6, 0xff, 0xda, 0xe8, 0x96, 0xff, 0xbb, 0xc5, 0x5d, 0xff, 0xba, 0xbc, 0x5a, 0xff, 0xb8, 0xb6, 0x5d, 0xff, 0xb3, 0xb1, 0x5b, 0xff, 0x9e, 0xa2, 0x6a, 0xff, 0x5b, 0x60, 0x46, 0xff, 0x48, 0x4d, 0x4c, 0xd8, 0x80, 0x80, 0x86, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x0c, 0x5c, 0x63, 0x5f, 0xa3, 0x5b, 0x62, 0x52, 0xfc, 0x92, 0x96, 0x68, 0xff, 0xb3, 0xb5, 0x65, 0xff, 0xb7, 0xb6, 0x57, 0xff, 0xb9, 0xba, 0x50, 0xff, 0xc0, 0xc3, 0x4c, 0xff, 0xcd, 0xd1, 0x51, 0xff, 0xdb, 0xdf, 0x59, 0xff, 0xe4, 0xe7, 0x5a, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe6, 0xe8, 0x57, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe7, 0xe8, 0x58, 0xff, 0xe6, 0xe9, 0x56, 0xff, 0xe5, 0xea, 0x56, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe7, 0xe9, 0x57, 0xff, 0xe5, 0xe8, 0x58, 0xff, 0xe3, 0xe8, 0x5a, 0xff, 0xe3, 0xea, 0x57, 0xff, 0xdc, 0xe5, 0x59, 0xff, 0xd5, 0xe2, 0x72, 0xff, 0xe3, 0xf5, 0xa8, 0xff, 0xe5, 0xfc, 0xc3, 0xff, 0xe3, 0xf9, 0xc9, 0xff, 0xdd, 0xf7, 0xca, 0xff, 0xde, 0xf9, 0xcc, 0xff, 0xdd, 0xf8, 0xc9, 0xff, 0xe0, 0xf7, 0xca, 0xff, 0xe1, 0xf7, 0xcc, 0xff, 0xde, 0xf7, 0xcb, 0xff, 0xde, 0xf7, 0xca, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xde, 0xf8, 0xca, 0xff, 0xdc, 0xf8, 0xc9, 0xff, 0xdc, 0xf7, 0xc8, 0xff, 0xdc, 0xf7, 0xc9, 0xff, 0xdb, 0xf6, 0xca, 0xff, 0xdc, 0xf6, 0xc9, 0xff, 0xdf, 0xf6, 0xc9, 0xff, 0xdd, 0xf2, 0xc3, 0xff, 0xda, 0xec, 0xbc, 0xff, 0xd4, 0xe7, 0xb9, 0xff, 0xd3, 0xe3, 0xa9, 0xff, 0xd4, 0xdf, 0x91, 0xff, 0xb9, 0xbd, 0x5e, 0xff, 0xba, 0xbc, 0x5a, 0xff, 0xb6, 0xb6, 0x62, 0xff, 0xac, 0xae, 0x6b, 0xff, 0x70, 0x76, 0x55, 0xff, 0x4f, 0x51, 0x4e, 0xf3, 0x64, 0x67, 0x6a, 0x63, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x86, 0x86, 0x26, 0x4f, 0x53, 0x55, 0xcf, 0x5b, 0x5b, 0x4b, 0xff, 0x9e, 0x9f, 0x66, 0xff, 0xb2, 0xb2, 0x5b, 0xff, 0xb6, 0xb6, 0x52, 0xff, 0xb7, 0xb9, 0x4c, 0xff, 0xbe, 0xc0, 0x4b, 0xff, 0xc9, 0xca, 0x50, 0xff, 0xd7, 0xda, 0x57, 0xff, 0xdf, 0xe3, 0x5b, 0xff, 0xe2, 0xe7, 0x5a, 0xff, 0xe3, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x56, 0xff, 0xe4, 0xea, 0x55, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe7, 0x5a, 0xff, 0xe4, 0xe8, 0x5a, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe2, 0xe7, 0x59, 0xff, 0xd9, 0xe2, 0x62, 0xff, 0xde, 0xee, 0x91, 0xff, 0xe7, 0xfc, 0xbb, 0xff, 0xe0, 0xf9, 0xc3, 0xff, 0xde, 0xf7, 0xc8, 0xff, 0xdc, 0xf7, 0xcb, 0xff, 0xdb, 0xf8, 0xcb, 0xff, 0xdc, 0xf8, 0xca, 0xff, 0xde, 0xf7, 0xcb, 0xff, 0xdf, 0xf7, 0xcd, 0xff, 0xdf, 0xf8, 0xcc, 0xff, 0xde, 0xf7, 0xcb, 0xff, 0xdd, 0xf6, 0xca, 0xff, 0xdd, 0xf6, 0xca, 0xff, 0xde, 0xf7, 0xca, 0xff, 0xdd, 0xf6, 0xca, 0xff, 0xdd, 0xf6, 0xca, 0xff, 0xdd, 0xf6, 0xca, 0xff, 0xdf, 0xf8, 0xcb, 0xff, 0xdf, 0xf6, 0xc8, 0xff, 0xdd, 0xf2, 0xc1, 0xff, 0xd8, 0xec, 0xb7, 0xff, 0xd2, 0xe3, 0xad, 0xff, 0xce, 0xdf, 0xa9, 0xff, 0xd3, 0xde, 0xa4, 0xff, 0xd3, 0xd7, 0x8e, 0xff, 0xb9, 0xbd, 0x5d, 0xff, 0xb7, 0xbc, 0x5a, 0xff, 0xb1, 0xb5, 0x6e, 0xff, 0x89, 0x8b, 0x61, 0xff, 0x53, 0x58, 0x4b, 0xfc, 0x58, 0x58, 0x5d, 0x9c, 0xaa, 0xaa, 0xc6, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x6d, 0x6d, 0x7b, 0x59, 0x53, 0x52, 0x53, 0xf4, 0x78, 0x7c, 0x51, 0xff, 0xae, 0xb0, 0x60, 0xff, 0xb2, 0xb2, 0x54, 0xff, 0xb4, 0xb4, 0x4f, 0xff, 0xb9, 0xb8, 0x4e, 0xff, 0xbb, 0xb9, 0x4c, 0xff, 0xc3, 0xc5, 0x4f, 0xff, 0xcd, 0xd0, 0x53, 0xff, 0xd9, 0xdb, 0x5a, 0xff, 0xde, 0xe3, 0x58, 0xff, 0xe3, 0xe9, 0x57, 0xff, 0xe4, 0xea, 0x56, 0xff, 0xe6, 0xe9, 0x58, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe3, 0xe9, 0x56, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe3, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe6, 0xe8, 0x59, 0xff, 0xe1, 0xe6, 0x60, 0xff, 0xd9, 0xe4, 0x77, 0xff, 0xe9, 0xfc, 0xb0, 0xff, 0xdf, 0xf9, 0xc4, 0xff, 0xdd, 0xf7, 0xc7, 0xff, 0xdb, 0xf6, 0xc9, 0xff, 0xdb, 0xf7, 0xcc, 0xff, 0xdb, 0xf8, 0xcb, 0xff, 0xdb, 0xf8, 0xca, 0xff, 0xdc, 0xf6, 0xca, 0xff, 0xde, 0xf6, 0xcc, 0xff, 0xdd, 0xf6, 0xca, 0xff, 0xdd, 0xf5, 0xc9, 0xff, 0xde, 0xf7, 0xca, 0xff, 0xde, 0xf6, 0xca, 0xff, 0xdf, 0xf5, 0xcb, 0xff, 0xde, 0xf4, 0xca, 0xff, 0xdd, 0xf4, 0xc8, 0xff, 0xdc, 0xf2, 0xc5, 0xff, 0xdc, 0xf2, 0xc2, 0xff, 0xd8, 0xec, 0xba, 0xff, 0xd2, 0xe6, 0xaf, 0xff, 0xd0, 0xe1, 0xa7, 0xff, 0xce, 0xdd, 0xa1, 0xff, 0xcb, 0xdc, 0xa0, 0xff, 0xd3, 0xde, 0x9c, 0xff, 0xcd, 0xd1, 0x84, 0xff, 0xb8, 0xbb, 0x63, 0xff, 0xb2, 0xb6, 0x68, 0xff, 0x93, 0x98, 0x68, 0xff, 0x5b, 0x5f, 0x51, 0xfe, 0x56, 0x5a, 0x59, 0xbd, 0x7f, 0x7f, 0x89, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xa2, 0xae, 0x16, 0x4c, 0x4e, 0x4e, 0xdd, 0x65, 0x6b, 0x48, 0xff, 0xaa, 0xac, 0x62, 0xff, 0xb1, 0xb1, 0x58, 0xff, 0xb2, 0xb2, 0x52, 0xff, 0xb6, 0xb5, 0x51, 0xff, 0xb6, 0xb5, 0x4f, 0xff, 0xb9, 0xb9, 0x50, 0xff, 0xbe, 0xbf, 0x52, 0xff, 0xc5, 0xc3, 0x51, 0xff, 0xcd, 0xcd, 0x50, 0xff, 0xd9, 0xdb, 0x54, 0xff, 0xe0, 0xe2, 0x59, 0xff, 0xe2, 0xe4, 0x5a, 0xff, 0xe4, 0xe6, 0x59, 0xff, 0xe5, 0xe9, 0x58, 0xff, 0xe4, 0xea, 0x58, 0xff, 0xe4, 0xea, 0x57, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x58, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe2, 0xe8, 0x59, 0xff, 0xe5, 0xe9, 0x59, 0xff, 0xe4, 0xe8, 0x5b, 0xff, 0xdb, 0xe1, 0x66, 0xff, 0xe7, 0xf4, 0x9a, 0xff, 0xe7, 0xfc, 0xbe, 0xff, 0xdc, 0xf7, 0xca, 0xff, 0xdc, 0xf7, 0xc9, 0xff, 0xdc, 0xf6, 0xca, 0xff, 0xdc, 0xf6, 0xcb, 0xff, 0xdc, 0xf8, 0xca, 0xff, 0xdd, 0xf8, 0xc9, 0xff, 0xde, 0xf8, 0xcb, 0xff, 0xdf, 0xf6, 0xcc, 0xff, 0xe1, 0xf7, 0xca, 0xff, 0xe1, 0xf7, 0xca, 0xff, 0xe1, 0xf7, 0xca, 0xff, 0xe0, 0xf5, 0xc8, 0xff, 0xdf, 0xf3, 0xc6, 0xff, 0xde, 0xf2, 0xc5, 0xff, 0xdc, 0xf0, 0xc2, 0xff, 0xd7, 0xec, 0xba, 0xff, 0xd5, 0xe8, 0xb4, 0xff, 0xcf, 0xe1, 0xa9, 0xff, 0xcc, 0xdd, 0xa1, 0xff, 0xcb, 0xdb, 0x9d, 0xff, 0xc9, 0xd9, 0x9a, 0xff, 0xc9, 0xd7, 0x9a, 0xff, 0xd1, 0xdd, 0x97, 0xff, 0xbe, 0xc6, 0x77, 0xff, 0xb0, 0xb3, 0x6c, 0xff, 0x95, 0x97, 0x67, 0xff, 0x5d, 0x60, 0x50, 0xff, 0x54, 0x5a, 0x5d, 0xf9, 0x7e, 0x84, 0x87, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xd4, 0xea, 0x0c, 0x51, 0x55, 0x54, 0xc9, 0x5f, 0x64, 0x4c, 0xff, 0xa9, 0xaa, 0x68, 0xff, 0xaf, 0xb1, 0x5a, 0xff, 0xb3, 0xb5, 0x53, 0xff, 0xb5, 0xb6, 0x51, 0xff, 0xb5, 0xb5, 0x53, 0xff, 0xb5, 0xb6, 0x56, 0xff, 0xb6, 0xb6, 0x56, 0xff, 0xbe, 0xba, 0x54, 0xff, 0xbf, 0xbe, 0x4e, 0xff, 0xc4, 0xc5, 0x4f, 0xff, 0xca, 0xca, 0x58, 0xff, 0xd0, 0xd0, 0x5d, 0xff, 0xd2, 0xd6, 0x5a, 0xff, 0xe2, 0xe7, 0x5e, 0xff, 0xe5, 0xe9, 0x59, 0xff, 0xe4, 0xe8, 0x58, 0xff, 0xe3, 0xe8, 0x58, 0xff, 0xe3, 0xe7, 0x58, 0xff, 0xe3, 0xe7, 0x58, 0xff, 0xe3, 0xe7, 0x57, 0xff, 0xe3, 0xe7, 0x59, 0xff, 0xe7, 0xe9, 0x5a, 0xff, 0xe2, 0xe6, 0x5d, 0xff, 0xd8, 0xe2, 0x73, 0xff, 0xed, 0xfc, 0xb1, 0xff, 0xe4, 0xf9, 0xc6, 0xff, 0xe0, 0xf7, 0xcc, 0xff, 0xdf, 0xf8, 0xca, 0xff, 0xdf, 0xf7, 0xcb, 0xff, 0xde, 0xf6, 0xca, 0xff, 0xde, 0xf6, 0xc8, 0xff, 0xe0, 0xf7, 0xc7, 0xff, 0xe0, 0xf7, 0xc9, 0xff, 0xe1, 0xf6, 0xcb, 0xff, 0xe2, 0xf7, 0xc9, 0xff, 0xe1, 0xf7, 0xc7, 0xff, 0xdf, 0xf3, 0xc3, 0xff, 0xdd, 0xf0, 0xbe, 0xff, 0xdb, 0xed, 0xba, 0xff, 0xd9, 0xeb, 0xb7, 0xff, 0xd6, 0xe9, 0xb3, 0xff, 0xd2, 0xe3, 0xac, 0xff, 0xcf, 0xdf, 0xa5, 0xff, 0xcd, 0xdb, 0x9f, 0xff, 0xca, 0xd8, 0x9a, 0xff, 0xca, 0xd9, 0x9a, 0xff, 0xc7, 0xd7, 0x98, 0xff, 0xcf, 0xdb, 0x9f, 0xff, 0xcc, 0xd6, 0x98, 0xff, 0xa2, 0xab, 0x6e, 0xff, 0x86, 0x8c, 0x5a, 0xff, 0x5e, 0x62, 0x49, 0xff, 0x54, 0x59, 0x56, 0xff, 0x54, 0x5a, 0x62, 0xf4, 0x83, 0x87, 0x8e, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x58, 0x59, 0x5c, 0xa0, 0x54, 0x55, 0x4d, 0xff, 0xa3, 0xa5, 0x69, 0xff, 0xae, 0xb0, 0x5c, 0xff, 0xb2, 0xb5, 0x51, 0xff, 0xb4, 0xb6, 0x4d, 0xff, 0xb4, 0xb4, 0x52, 0xff, 0xb3, 0xb3, 0x59, 0xff, 0xb2, 0xb3, 0x5b, 0xff, 0xb2, 0xb3, 0x53, 0xff, 0xb4, 0xb7, 0x50, 0xff, 0xb5, 0xb8, 0x51, 0xff, 0xb6, 0xb7, 0x5b, 0xff, 0xa8, 0xa8, 0x51, 0xff, 0x8b, 0x8f, 0x34, 0xff, 0xdb, 0xe2, 0x67, 0xff, 0xe5, 0xe9, 0x5c, 0xff, 0xe4, 0xe8, 0x59, 0xff, 0xe3, 0xe7, 0x58, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe3, 0xe8, 0x57, 0xff, 0xe4, 0xe6, 0x58, 0xff, 0xe7, 0xe8, 0x59, 0xff, 0xdf, 0xe4, 0x5e, 0xff, 0xd9, 0xe5, 0x81, 0xff, 0xeb, 0xfd, 0xbb, 0xff, 0xe3, 0xf8, 0xc9, 0xff, 0xe3, 0xf7, 0xca, 0xff, 0xe1, 0xf7, 0xc7, 0xff, 0xe0, 0xf5, 0xc8, 0xff, 0xdf, 0xf4, 0xc7, 0xff, 0xe0, 0xf5, 0xc4, 0xff, 0xe0, 0xf5, 0xc3, 0xff, 0xde, 0xf3, 0xc4, 0xff, 0xdc, 0xef, 0xc2, 0xff, 0xd9, 0xec, 0xbc, 0xff, 0xd6, 0xea, 0xb8, 0xff, 0xd4, 0xe7, 0xb3, 0xff, 0xd4, 0xe5, 0xb0, 0xff, 0xd1, 0xe2, 0xab, 0xff, 0xd1, 0xe0, 0xa8, 0xff, 0xce, 0xde, 0xa4, 0xff, 0xcd, 0xdc, 0x9f, 0xff, 0xcb, 0xd9, 0x9b, 0xff, 0xcb, 0xd8, 0x99, 0xff, 0xcc, 0xd9, 0x9a, 0xff, 0xc8, 0xd6, 0x98, 0xff, 0xc7, 0xd6, 0x99, 0xff, 0xcd, 0xd7, 0x9f, 0xff, 0xb6, 0xbe, 0x90, 0xff, 0x72, 0x78, 0x56, 0xff, 0x57, 0x5f, 0x42, 0xff, 0x64, 0x6e, 0x57, 0xff, 0x6e, 0x77, 0x6d, 0xff, 0x53, 0x59, 0x60, 0xf2, 0x81, 0x85, 0x8d, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x61, 0x63, 0x71, 0x50, 0x53, 0x56, 0xfa, 0x92, 0x98, 0x64, 0xff, 0xad, 0xb0, 0x60, 0xff, 0xb5, 0xb3, 0x51, 0xff, 0xb9, 0xb8, 0x51, 0xff, 0xb4, 0xb5, 0x59, 0xff, 0xa1, 0xa1, 0x52, 0xff, 0x9d, 0x99, 0x51, 0xff, 0xad, 0xa9, 0x5c, 0xff, 0xac, 0xb0, 0x5a, 0xff, 0xad, 0xb0, 0x58, 0xff, 0xaf, 0xb0, 0x65, 0xff, 0x73, 0x78, 0x3c, 0xff, 0x80, 0x87, 0x3e, 0xff, 0xd6, 0xda, 0x6c, 0xff, 0xe8, 0xea, 0x5f, 0xff, 0xe5, 0xea, 0x54, 0xff, 0xe6, 0xe9, 0x57, 0xff, 0xe7, 0xe7, 0x5a, 0xff, 0xe5, 0xe8, 0x57, 0xff, 0xe6, 0xe8, 0x5a, 0xff, 0xe6, 0xe6, 0x5b, 0xff, 0xe0, 0xe5, 0x5c, 0xff, 0xcc, 0xd7, 0x62, 0xff, 0xb3, 0xbd, 0x72, 0xff, 0xe5, 0xf2, 0xb9, 0xff, 0xdf, 0xf0, 0xbb, 0xff, 0xdd, 0xee, 0xbc, 0xff, 0xdc, 0xed, 0xbb, 0xff, 0xda, 0xeb, 0xb9, 0xff, 0xd9, 0xea, 0xb7, 0xff, 0xd7, 0xe9, 0xb3, 0xff, 0xd4, 0xe7, 0xb0, 0xff, 0xd3, 0xe5, 0xae, 0xff, 0xd1, 0xe3, 0xac, 0xff, 0xcf, 0xe2, 0xab, 0xff, 0xcd, 0xdf, 0xa8, 0xff, 0xcc, 0xde, 0xa6, 0xff, 0xcd, 0xdd, 0xa5, 0xff, 0xcc, 0xdb, 0xa2, 0xff, 0xcc, 0xdb, 0xa1, 0xff, 0xca, 0xda, 0x9d, 0xff, 0xc9, 0xd9, 0x9a, 0xff, 0xcb, 0xd6, 0x9c, 0xff, 0xca, 0xd5, 0x9d, 0xff, 0xc8, 0xd6, 0xa0, 0xff, 0xc8, 0xd5, 0xa1, 0xff, 0xc7, 0xd2, 0xa3, 0xff, 0xa6, 0xb1, 0x8a, 0xff, 0x63, 0x6b, 0x50, 0xff, 0x55, 0x5a, 0x43, 0xff, 0x71, 0x73, 0x4c, 0xff, 0xa3, 0xa6, 0x78, 0xff, 0x80, 0x85, 0x67, 0xff, 0x54, 0x59, 0x58, 0xf1, 0x83, 0x87, 0x8b, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x78, 0x7d, 0x33, 0x4c, 0x4f, 0x52, 0xeb, 0x77, 0x7c, 0x53, 0xff, 0xaf, 0xaf, 0x6a, 0xff, 0xb7, 0xb4, 0x58, 0xff, 0xb5, 0xb6, 0x52, 0xff, 0xaf, 0xb2, 0x59, 0xff, 0x9f, 0xa3, 0x59, 0xff, 0x73, 0x72, 0x33, 0xff, 0x7a, 0x78, 0x40, 0xff, 0x93, 0x9a, 0x5d, 0xff, 0xa4, 0xa9, 0x6d, 0xff, 0xa2, 0xa4, 0x73, 0xff, 0x5a, 0x61, 0x35, 0xff, 0x91, 0x95, 0x50, 0xff, 0xd6, 0xd8, 0x6c, 0xff, 0xe7, 0xec, 0x62, 0xff, 0xe4, 0xec, 0x55, 0xff, 0xe5, 0xea, 0x5a, 0xff, 0xe5, 0xe6, 0x5d, 0xff, 0xe1, 0xe6, 0x57, 0xff, 0xe0, 0xe5, 0x58, 0xff, 0xe2, 0xe4, 0x60, 0xff, 0xce, 0xd3, 0x5c, 0xff, 0xa2, 0xac, 0x53, 0xff, 0x79, 0x83, 0x50, 0xff, 0xd5, 0xe1, 0xb0, 0xff, 0xd4, 0xe3, 0xab, 0xff, 0xd3, 0xe1, 0xae, 0xff, 0xd3, 0xe0, 0xac, 0xff, 0xd2, 0xdf, 0xaa, 0xff, 0xd1, 0xdf, 0xa9, 0xff, 0xd1, 0xdf, 0xa7, 0xff, 0xce, 0xde, 0xa4, 0xff, 0xce, 0xdd, 0xa2, 0xff, 0xcd, 0xdc, 0xa1, 0xff, 0xcb, 0xda, 0xa0, 0xff, 0xca, 0xda, 0x9e, 0xff, 0xca, 0xda, 0x9d, 0xff, 0xcc, 0xda, 0x9e, 0xff, 0xcc, 0xda, 0x9d, 0xff, 0xcb, 0xda, 0x9d, 0xff, 0xc9, 0xda, 0x9a, 0xff, 0xc9, 0xda, 0x9b, 0xff, 0xcc, 0xd6, 0x9f, 0xff, 0xcb, 0xd5, 0xa5, 0xff, 0xc7, 0xd4, 0xab, 0xff, 0xb5, 0xbf, 0xa0, 0xff, 0x83, 0x89, 0x72, 0xff, 0x5a, 0x60, 0x4b, 0xff, 0x57, 0x5c, 0x45, 0xff, 0x7d, 0x7f, 0x56, 0xff, 0xa6, 0xa7, 0x67, 0xff, 0xa9, 0xab, 0x67, 0xff, 0x81, 0x84, 0x5b, 0xff, 0x53, 0x56, 0x57, 0xee, 0x84, 0x84, 0x8d, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xb9, 0xb9, 0x0b, 0x55, 0x5b, 0x5d, 0xb3, 0x62, 0x64, 0x4b, 0xff, 0xa8, 0xa8, 0x72, 0xff, 0xb2, 0xb2, 0x60, 0xff, 0xb3, 0xb5, 0x53, 0xff, 0xac, 0xb3, 0x55, 0xff, 0xa8, 0xae, 0x5e, 0xff, 0x9e, 0xa1, 0x60, 0xff, 0x72, 0x74, 0x49, 0xff, 0x54, 0x5d, 0x3f, 0xff, 0x63, 0x6a, 0x53, 0xff, 0x6e, 0x70, 0x60, 0xff, 0x51, 0x58, 0x3e, 0xff, 0x9d, 0xa1, 0x5a, 0xff, 0xd4, 0xd7, 0x65, 0xff, 0xe4, 0xeb, 0x62, 0xff, 0xe0, 0xe9, 0x58, 0xff, 0xe4, 0xe9, 0x5f, 0xff, 0xe1, 0xe6, 0x5e, 0xff, 0xde, 0xe8, 0x57, 0xff, 0xdd, 0xe7, 0x59, 0xff, 0xd9, 0xdd, 0x61, 0xff, 0xbb, 0xbf, 0x61, 0xff, 0x76, 0x7c, 0x45, 0xff, 0x6f, 0x79, 0x59, 0xff, 0xc9, 0xd7, 0xa8, 0xff, 0xce, 0xdc, 0xa1, 0xff, 0xce, 0xd9, 0xa1, 0xff, 0xcc, 0xd9, 0x9f, 0xff, 0xca, 0xd8, 0x9c, 0xff, 0xc9, 0xd7, 0x9b, 0xff, 0xc9, 0xd7, 0x9b, 0xff, 0xca, 0xd9, 0x9b, 0xff, 0xc9, 0xd8, 0x9a, 0xff, 0xc9, 0xd7, 0x99, 0xff, 0xca, 0xd7, 0x9a, 0xff, 0xc9, 0xd6, 0x99, 0xff, 0xcc, 0xd8, 0x9c, 0xff, 0xce, 0xdb, 0x9f, 0xff, 0xce, 0xdc, 0xa1, 0xff, 0xcd, 0xdb, 0xa1, 0xff, 0xc8, 0xd7, 0xa0, 0xff, 0xc8, 0xd7, 0xa6, 0xff, 0xc9, 0xd4, 0xab, 0xff, 0xb2, 0xb9, 0x99, 0xff, 0x83, 0x8b, 0x73, 0xff, 0x54, 0x58, 0x48, 0xff, 0x5e, 0x5c, 0x50, 0xff, 0x71, 0x72, 0x50, 0xff, 0x96, 0x97, 0x68, 0xff, 0xad, 0xab, 0x6c, 0xff, 0xb3, 0xb1, 0x5e, 0xff, 0xad, 0xae, 0x61, 0xff, 0x79, 0x7c, 0x52, 0xff, 0x4a, 0x4f, 0x4f, 0xe7, 0x7f, 0x7f, 0x87, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x6d, 0x70, 0x73, 0x59, 0x58, 0x59, 0x4e, 0xf6, 0x8e, 0x8f, 0x6a, 0xff, 0xa9, 0xac, 0x67, 0xff, 0xae, 0xb1, 0x53, 0xff, 0xb2, 0xb5, 0x50, 0xff, 0xaf, 0xb0, 0x55, 0xff, 0xad, 0xad, 0x62, 0xff, 0x9d, 0x9d, 0x73, 0xff, 0x63, 0x69, 0x57, 0xff, 0x54, 0x58, 0x5c, 0xff, 0x4e, 0x50, 0x58, 0xfe, 0x4e, 0x56, 0x47, 0xff, 0xa2, 0xa9, 0x61, 0xff, 0xd0, 0xd3, 0x5e, 0xff, 0xe1, 0xe8, 0x5f, 0xff, 0xe2, 0xe8, 0x59, 0xff, 0xe7, 0xe8, 0x60, 0xff, 0xe3, 0xe6, 0x5d, 0xff, 0xe0, 0xe8, 0x57, 0xff, 0xdc, 0xe5, 0x5b, 0xff, 0xcd, 0xd3, 0x5e, 0xff, 0xaa, 0xab, 0x61, 0xff, 0x56, 0x59, 0x3c, 0xff, 0x8a, 0x94, 0x7c, 0xff, 0xcc, 0xdb, 0xab, 0xff, 0xd3, 0xe0, 0x9f, 0xff, 0xd5, 0xde, 0xa0, 0xff, 0xd2, 0xdf, 0xa1, 0xff, 0xd1, 0xdf, 0xa0, 0xff, 0xd0, 0xde, 0xa0, 0xff, 0xd0, 0xde, 0x9f, 0xff, 0xd0, 0xde, 0x9f, 0xff, 0xcf, 0xdd, 0x9f, 0xff, 0xcf, 0xdd, 0xa0, 0xff, 0xcf, 0xdd, 0xa3, 0xff, 0xcf, 0xdd, 0xa7, 0xff, 0xcf, 0xdb, 0xaa, 0xff, 0xcf, 0xdb, 0xaf, 0xff, 0xd0, 0xdb, 0xb4, 0xff, 0xcf, 0xd9, 0xb5, 0xff, 0xba, 0xc8, 0xa9, 0xff, 0x98, 0xa5, 0x8e, 0xff, 0x6f, 0x78, 0x69, 0xff, 0x55, 0x5a, 0x55, 0xff, 0x51, 0x54, 0x4d, 0xff, 0x6a, 0x6b, 0x52, 0xff, 0x95, 0x94, 0x66, 0xff, 0xab, 0xae, 0x6a, 0xff, 0xb2, 0xb3, 0x64, 0xff, 0xb8, 0xb4, 0x5d, 0xff, 0xb6, 0xb1, 0x56, 0xff, 0xad, 0xac, 0x64, 0xff, 0x6d, 0x70, 0x4b, 0xff, 0x44, 0x4a, 0x47, 0xd6, 0x96, 0x96, 0xa5, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xae, 0xae, 0x13, 0x53, 0x55, 0x55, 0xc4, 0x5d, 0x61, 0x4e, 0xff, 0x9e, 0xa2, 0x70, 0xff, 0xa8, 0xab, 0x5b, 0xff, 0xaf, 0xaf, 0x50, 0xff, 0xb3, 0xb1, 0x55, 0xff, 0xb0, 0xad, 0x60, 0xff, 0xa3, 0xa1, 0x77, 0xff, 0x61, 0x63, 0x57, 0xff, 0x5f, 0x60, 0x6c, 0xd9, 0x63, 0x64, 0x72, 0xb0, 0x4b, 0x54, 0x46, 0xfe, 0x9e, 0xa6, 0x5f, 0xff, 0xc7, 0xca, 0x57, 0xff, 0xde, 0xe3, 0x5c, 0xff, 0xe1, 0xe4, 0x58, 0xff, 0xe6, 0xe4, 0x5d, 0xff, 0xe6, 0xe7, 0x5e, 0xff, 0xe1, 0xe6, 0x5b, 0xff, 0xd6, 0xdb, 0x5e, 0xff, 0xbf, 0xc4, 0x63, 0xff, 0x84, 0x86, 0x4f, 0xff, 0x52, 0x54, 0x47, 0xff, 0xaf, 0xb9, 0xa5, 0xff, 0xc9, 0xd6, 0xac, 0xff, 0xcf, 0xda, 0xa4, 0xff, 0xd1, 0xd8, 0xa4, 0xff, 0xc9, 0xd7, 0xa3, 0xff, 0xc7, 0xd5, 0xa2, 0xff, 0xca, 0xd7, 0xa5, 0xff, 0xc9, 0xd6, 0xa4, 0xff, 0xc8, 0xd5, 0xa4, 0xff, 0xc8, 0xd5, 0xa5, 0xff, 0xc9, 0xd6, 0xa8, 0xff, 0xc5, 0xd3, 0xac, 0xff, 0xc4, 0xd1, 0xae, 0xff, 0xbc, 0xc7, 0xab, 0xff, 0xa8, 0xb3, 0x9d, 0xff, 0x8e, 0x97, 0x87, 0xff, 0x6c, 0x73, 0x6a, 0xff, 0x4e, 0x56, 0x53, 0xfe, 0x4b, 0x54, 0x57, 0xf5, 0x54, 0x58, 0x64, 0xdd, 0x58, 0x59, 0x6a, 0xf6, 0x5f, 0x5f, 0x60, 0xff, 0xa8, 0xa8, 0x84, 0xff, 0xb3, 0xb3, 0x69, 0xff, 0xb2, 0xb4, 0x5b, 0xff, 0xb7, 0xb7, 0x57, 0xff, 0xbb, 0xb8, 0x51, 0xff, 0xb6, 0xb5, 0x55, 0xff, 0xaa, 0xac, 0x6c, 0xff, 0x5f, 0x61, 0x4b, 0xff, 0x49, 0x4a, 0x53, 0xb6, 0xd4, 0xd4, 0xd4, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x69, 0x70, 0x50, 0x4e, 0x51, 0x4f, 0xe9, 0x6f, 0x73, 0x58, 0xff, 0x9e, 0x9f, 0x6a, 0xff, 0xa7, 0xa6, 0x60, 0xff, 0xa9, 0xa9, 0x64, 0xff, 0xa9, 0xaa, 0x71, 0xff, 0x7d, 0x7e, 0x60, 0xff, 0x58, 0x5c, 0x5d, 0xf3, 0x75, 0x75, 0x82, 0x60, 0x6d, 0x6d, 0x76, 0x75, 0x4d, 0x55, 0x43, 0xfd, 0xa1, 0xa7, 0x63, 0xff, 0xc1, 0xc1, 0x55, 0xff, 0xd2, 0xd6, 0x56, 0xff, 0xdf, 0xe1, 0x5a, 0xff, 0xe4, 0xe3, 0x5e, 0xff, 0xe1, 0xe1, 0x5e, 0xff, 0xd7, 0xdb, 0x5c, 0xff, 0xc5, 0xc5, 0x5f, 0xff, 0xa8, 0xab, 0x69, 0xff, 0x5b, 0x60, 0x47, 0xff, 0x54, 0x57, 0x59, 0xff, 0x82, 0x8a, 0x82, 0xff, 0x93, 0x9d, 0x86, 0xff, 0x9e, 0xa5, 0x8c, 0xff, 0xa4, 0xab, 0x92, 0xff, 0xa5, 0xaf, 0x95, 0xff, 0xa5, 0xae, 0x95, 0xff, 0xa3, 0xac, 0x94, 0xff, 0x9c, 0xa5, 0x8e, 0xff, 0x8f, 0x98, 0x81, 0xff, 0x86, 0x8f, 0x7a, 0xff, 0x76, 0x7e, 0x6c, 0xff, 0x63, 0x6c, 0x60, 0xff, 0x53, 0x5b, 0x53, 0xff, 0x47, 0x4e, 0x4b, 0xfc, 0x46, 0x4b, 0x4c, 0xf7, 0x4b, 0x4e, 0x54, 0xe5, 0x56, 0x59, 0x61, 0xbe, 0x5f, 0x5f, 0x68, 0x91, 0x70, 0x6c, 0x77, 0x49, 0xb0, 0xb0, 0xc1, 0x1d, 0x61, 0x65, 0x74, 0x93, 0x58, 0x5a, 0x60, 0xfd, 0x86, 0x88, 0x66, 0xff, 0xb2, 0xb2, 0x6d, 0xff, 0xb3, 0xb0, 0x5f, 0xff, 0xb8, 0xb3, 0x59, 0xff, 0xbb, 0xb7, 0x56, 0xff, 0xb0, 0xb2, 0x60, 0xff, 0x96, 0x9b, 0x6a, 0xff, 0x56, 0x59, 0x53, 0xf9, 0x62, 0x62, 0x6e, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xff, 0x03, 0x63, 0x63, 0x6b, 0x62, 0x50, 0x55, 0x4d, 0xed, 0x6e, 0x70, 0x53, 0xff, 0x92, 0x93, 0x6b, 0xff, 0x94, 0x98, 0x70, 0xff, 0x71, 0x79, 0x5b, 0xff, 0x5d, 0x63, 0x5c, 0xf1, 0x5f, 0x67, 0x71, 0x7c, 0xaa, 0xaa, 0xd4, 0x06, 0x63, 0x63, 0x68, 0x62, 0x4f, 0x53, 0x41, 0xfc, 0xa1, 0xa3, 0x62, 0xff, 0xbc, 0xbc, 0x57, 0xff, 0xca, 0xce, 0x57, 0xff, 0xd3, 0xd6, 0x59, 0xff, 0xd7, 0xd8, 0x5a, 0xff, 0xd3, 0xd5, 0x59, 0xff, 0xc4, 0xc8, 0x58, 0xff, 0xb8, 0xb8, 0x68, 0xff, 0x84, 0x87, 0x60, 0xff, 0x53, 0x59, 0x5a, 0xfb, 0x46, 0x4a, 0x5a, 0xea, 0x40, 0x47, 0x4e, 0xec, 0x42, 0x47, 0x4c, 0xf2, 0x42, 0x46, 0x50, 0xf4, 0x42, 0x49, 0x51, 0xf5, 0x47, 0x4b, 0x50, 0xf5, 0x48, 0x4d, 0x50, 0xf4, 0x4c, 0x50, 0x55, 0xf2, 0x4a, 0x4c, 0x53, 0xf0, 0x48, 0x4b, 0x52, 0xea, 0x42, 0x45, 0x4e, 0xe3, 0x45, 0x47, 0x4f, 0xd6, 0x4b, 0x4b, 0x57, 0xbc, 0x4d, 0x4f, 0x5b, 0x92, 0x57, 0x57, 0x62, 0x75, 0x65, 0x61, 0x6f, 0x47, 0x75, 0x75, 0x83, 0x23, 0x8b, 0x8b, 0xa2, 0x0b, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x8c, 0x9c, 0x1f, 0x5e, 0x62, 0x67, 0xc3, 0x5f, 0x62, 0x55, 0xfe, 0x90, 0x90, 0x65, 0xff, 0xb4, 0xb0, 0x6e, 0xff, 0xb6, 0xae, 0x63, 0xff, 0xb4, 0xae, 0x67, 0xff, 0xa9, 0xa9, 0x77, 0xff, 0x71, 0x75, 0x5e, 0xff, 0x55, 0x59, 0x59, 0xd4, 0x87, 0x87, 0x8f, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x04, 0x5f, 0x5c, 0x5f, 0x53, 0x57, 0x59, 0x5c, 0xc5, 0x55, 0x59, 0x5a, 0xe9, 0x59, 0x5c, 0x5e, 0xe7, 0x5c, 0x5f, 0x64, 0xc2, 0x65, 0x68, 0x6e, 0x56, 0xaa, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x68, 0x62, 0x6f, 0x53, 0x4f, 0x50, 0x45, 0xfa, 0x95, 0x99, 0x60, 0xff, 0xb7, 0xba, 0x5d, 0xff, 0xbe, 0xc2, 0x56, 0xff, 0xc4, 0xc3, 0x59, 0xff, 0xc2, 0xc4, 0x54, 0xff, 0xbe, 0xc3, 0x54, 0xff, 0xb4, 0xb8, 0x63, 0xff, 0xa2, 0xa0, 0x73, 0xff, 0x5b, 0x5c, 0x54, 0xfb, 0x5d, 0x61, 0x66, 0x99, 0x93, 0x93, 0xa2, 0x21, 0x7c, 0x7c, 0x8b, 0x21, 0x7b, 0x76, 0x84, 0x36, 0x6c, 0x68, 0x7c, 0x42, 0x65, 0x62, 0x73, 0x49, 0x60, 0x60, 0x6e, 0x4a, 0x66, 0x62, 0x71, 0x46, 0x6d, 0x6d, 0x7d, 0x3f, 0x76, 0x71, 0x7f, 0x34, 0x78, 0x78, 0x7f, 0x20, 0x86, 0x86, 0x9e, 0x15, 0x9f, 0x9f, 0xaf, 0x10, 0xc6, 0xc6, 0xc6, 0x09, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x7d, 0x88, 0x2d, 0x5e, 0x60, 0x60, 0xc7, 0x59, 0x5e, 0x56, 0xfe, 0x85, 0x84, 0x60, 0xff, 0x9d, 0x9e, 0x71, 0xff, 0x96, 0x9a, 0x71, 0xff, 0x78, 0x7b, 0x65, 0xff, 0x58, 0x57, 0x5a, 0xf3, 0x62, 0x60, 0x69, 0x68, 0x7f, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x86, 0x79, 0x86, 0x13, 0x6d, 0x67, 0x72, 0x2f, 0x6b, 0x6b, 0x77, 0x2b, 0x88, 0x88, 0x88, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x75, 0x85, 0x32, 0x52, 0x52, 0x4e, 0xec, 0x78, 0x7b, 0x53, 0xff, 0xad, 0xae, 0x68, 0xff, 0xb6, 0xb5, 0x5c, 0xff, 0xb5, 0xb4, 0x58, 0xff, 0xb5, 0xb6, 0x59, 0xff, 0xb2, 0xb6, 0x63, 0xff, 0x9d, 0x9f, 0x67, 0xff, 0x66, 0x66, 0x4f, 0xfe, 0x5b, 0x59, 0x59, 0xc8, 0x8d, 0x8d, 0x95, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x72, 0x79, 0x26, 0x5b, 0x59, 0x5c, 0xb1, 0x5d, 0x59, 0x59, 0xf4, 0x5b, 0x5a, 0x53, 0xfd, 0x57, 0x58, 0x52, 0xfc, 0x56, 0x54, 0x59, 0xe8, 0x5f, 0x58, 0x69, 0x83, 0x89, 0x89, 0x9d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0x09, 0x54, 0x53, 0x57, 0xb6, 0x59, 0x59, 0x4c, 0xff, 0x93, 0x92, 0x6c, 0xff, 0xac, 0xab, 0x73, 0xff, 0xb0, 0xb1, 0x72, 0xff, 0xab, 0xae, 0x71, 0xff, 0x94, 0x97, 0x6a, 0xff, 0x5d, 0x5e, 0x4b, 0xff, 0x51, 0x53, 0x50, 0xd8, 0x7b, 0x7b, 0x7f, 0x38, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x7f, 0x8f, 0x10, 0x67, 0x63, 0x71, 0x4d, 0x63, 0x5f, 0x6a, 0x74, 0x63, 0x5c, 0x66, 0x6c, 0x75, 0x70, 0x7a, 0x30, 0xb6, 0xb6, 0xb6, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x75, 0x7f, 0x32, 0x54, 0x51, 0x55, 0xd1, 0x58, 0x56, 0x53, 0xfe, 0x76, 0x79, 0x67, 0xff, 0x80, 0x86, 0x68, 0xff, 0x6f, 0x74, 0x59, 0xff, 0x59, 0x58, 0x52, 0xfc, 0x55, 0x51, 0x57, 0xcf, 0x79, 0x79, 0x7d, 0x3d, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x79, 0x79, 0x7f, 0x2a, 0x5d, 0x5a, 0x65, 0x97, 0x4e, 0x4f, 0x59, 0xd9, 0x49, 0x4e, 0x4e, 0xe7, 0x53, 0x55, 0x55, 0xd0, 0x62, 0x5e, 0x68, 0x80, 0x87, 0x7f, 0x8f, 0x20, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x7f, 0xbf, 0x04, 0x94, 0x94, 0xa1, 0x13, 0x8f, 0x85, 0x8f, 0x19, 0x9f, 0x9f, 0x9f, 0x10, 0x7f, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-};
-
-const lv_img_dsc_t pet_idle_frame3 = {
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 100,
-  .header.h = 89,
-  .data_size = 8900 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .data = pet_idle_frame3_map,
-};
@@ -1,62 +1,39 @@
 /**
  * Pet Sprite Images
- * Animation frames for virtual pet
+ * Animation frames for virtual pet, by their names in the asset pack
+ * (assets/pack.txt). The pixels live in the assets partition, not in
+ * the firmware; PetAnimator resolves these once through AssetStore.
  */
 
 #ifndef PET_SPRITES_H
 #define PET_SPRITES_H
 
-#include <lvgl.h>
-
-// Forward declarations - actual definitions in .c files
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-// Pet idle animation frames (generated from assets/idle/*.png)
-extern const lv_img_dsc_t pet_idle_frame1;  // 2.png
-extern const lv_img_dsc_t pet_idle_frame2;  // 3.png
-extern const lv_img_dsc_t pet_idle_frame3;  // 4.png
-
-// Pet eat animation frames (generated from assets/eat/*.png)
-extern const lv_img_dsc_t eat_frame1;
-extern const lv_img_dsc_t eat_frame2;
-extern const lv_img_dsc_t eat_frame3;
-extern const lv_img_dsc_t eat_frame4;
-
-// Pet play animation frames (generated from assets/play/*.png)
-extern const lv_img_dsc_t play_frame1;
-extern const lv_img_dsc_t play_frame2;
-extern const lv_img_dsc_t play_frame3;
-extern const lv_img_dsc_t play_frame4;
-
-#ifdef __cplusplus
-}
-#endif
-
-// Animation frame arrays
-static const lv_img_dsc_t* PET_IDLE_FRAMES[] = {
-    &pet_idle_frame1,
-    &pet_idle_frame2,
-    &pet_idle_frame3
-};
-
-static const lv_img_dsc_t* PET_EAT_FRAMES[] = {
-    &eat_frame1,
-    &eat_frame2,
-    &eat_frame3,
-    &eat_frame4
+enum PetSprite {
+    // Idle (assets/idle/)
+    PET_SPRITE_IDLE1,
+    PET_SPRITE_IDLE2,
+    PET_SPRITE_IDLE3,
+
+    // Eat (assets/eat/)
+    PET_SPRITE_EAT1,
+    PET_SPRITE_EAT2,
+    PET_SPRITE_EAT3,
+    PET_SPRITE_EAT4,
+
+    // Play (assets/play/)
+    PET_SPRITE_PLAY1,
+    PET_SPRITE_PLAY2,
+    PET_SPRITE_PLAY3,
+    PET_SPRITE_PLAY4,
+
+    PET_SPRITE_COUNT
 };
 
-static const lv_img_dsc_t* PET_PLAY_FRAMES[] = {
-    &play_frame1,
-    &play_frame2,
-    &play_frame3,
-    &play_frame4
+// Indexed by PetSprite
+static const char* const PET_SPRITE_ASSETS[PET_SPRITE_COUNT] = {
+    "idle1", "idle2", "idle3",
+    "eat1", "eat2", "eat3", "eat4",
+    "play1", "play2", "play3", "play4",
 };
 
-#define PET_IDLE_FRAME_COUNT 3
-#define PET_EAT_FRAME_COUNT 4
-#define PET_PLAY_FRAME_COUNT 4
-
 #endif // PET_SPRITES_H
@@ -21,6 +21,18 @@
 #include <esp_timer.h>
 #include "QMI8658.h"
 #include "TrustOracleClient.h"
+#include "SuiRpcWorker.h"
+#include "ConnectivityManager.h"
+#include "BootSequencer.h"
+#include "SplashScreen.h"
+#include "AppState.h"
+#include "Clock.h"
+#include "TaskMonitor.h"
+#include "Profiler.h"
+#include "Tracer.h"
+#include "DeferredLog.h"
+#include "StateJournal.h"
+#include "AssetStore.h"
 #include "VirtualPet.h"
 #include "ui.h"  // SquareLine Studio UI
 
@@ -32,10 +44,13 @@ extern WiFiMulti WiFiMulti;
 // WiFi Configuration
 char WIFI_SSID[33] = "";
 char WIFI_PASSWORD[65] = "";
+ConnectivityManager connectivity;  // Cached AP fast connect, async reconnect
 
 // Trust Oracle Backend Configuration
 const char* ORACLE_HOST = "";  // Your backend server IP
 const uint16_t ORACLE_PORT = 8080;
+// Optional failover list "host:port,host:port" (saved to flash, overrides host/port above)
+const char* ORACLE_ENDPOINTS = "";
 const char* DEVICE_ID = "";  // Unique device ID
 
 // Device Private Key - KEEP THIS SECRET!
@@ -49,13 +64,14 @@ const char* DEVICE_WALLET_ADDRESS = "";
 const char* SUI_RPC_URL = "https://fullnode.testnet.sui.io";  // Testnet
 // const char* SUI_RPC_URL = "https://fullnode.mainnet.sui.io";  // Mainnet
 
-// Balance tracking
-String suiBalance = "0.00";
-unsigned long lastBalanceFetch = 0;
-const unsigned long BALANCE_FETCH_INTERVAL = 30000;  // Fetch every 30 seconds
+// Balance tracking (fetched by the RPC worker task, shown from its cache)
+SuiRpcWorker suiRpc;
+uint32_t lastBalanceSequence = 0;
+char rpcPetObjectId[APP_PET_ID_LEN] = "";  // Last ID handed to the worker
 
-// Pet blockchain info
-String petObjectId = "";  // NFT Pet Object ID on Sui blockchain
+// Step count, pet object ID, balance and link status shared between tasks
+AppState appState;
+TaskMonitor taskMonitor;
 
 // Display config
 static const uint16_t screenWidth = 240;
@@ -72,11 +88,10 @@ TrustOracleClient* oracleClient = nullptr;
 
 // Virtual Pet
 VirtualPet virtualPet;
+StateJournal journal;  // Pet + steps in flash, restored before the UI is drawn
 unsigned long lastPetUpdate = 0;
-const unsigned long PET_UPDATE_INTERVAL = 5000;  // Update pet every 5 seconds
 
-// Step counter variables
-int stepCount = 0;
+// Step counter variables (sensor task)
 float lastAccMagnitude = 0;
 float lastVerticalAcc = 0;
 bool stepDetected = false;
@@ -95,17 +110,37 @@ int currentScreen = 1;  // Start with Screen1 (pet screen)
 
 // Data submission variables
 unsigned long lastSubmissionTime = 0;
-const unsigned long submissionInterval = 60000;  // Submit every 60 seconds
-const int minStepsForSubmission = 10;  // Minimum steps before submitting
+unsigned long lastBatchAttempt = 0;
+
+// Why the last flush attempt left the batch waiting (logged on change)
+enum BatchHold { BATCH_HOLD_NONE, BATCH_HOLD_NOT_READY, BATCH_HOLD_REFUSED };
+BatchHold batchHold = BATCH_HOLD_NONE;
 
 // Accelerometer sample buffer
-float accSampleBuffer[30][3];  // Store last 30 samples
+float accSampleBuffer[APP_WINDOW_SAMPLES][3];  // Store last 30 samples
+StepBatch stepBatch;  // Windows waiting for one signed batch submission (net task)
 int accSampleIndex = 0;
 
-// IMU reading throttle
-unsigned long lastIMUReadTime = 0;
+// IMU sampling period of the sensor task
 const unsigned long IMU_READ_INTERVAL = 50;  // Read IMU every 50ms (20Hz)
 
+// Boot stages (ids are run order within a pass and dependency bits)
+enum BootStageId {
+    BOOT_BUS,       // PSRAM, frame buffer, SPI/I2C
+    BOOT_WIFI,      // Association starts, finishes on its own
+    BOOT_IMU,       // QMI8658 over I2C (task)
+    BOOT_ORACLE,    // Keypair + endpoint list from NVS, key expansion (task)
+    BOOT_RPC,       // Sui RPC worker, waits for WiFi on its own
+    BOOT_DISPLAY,   // LCD reset/init, touch
+    BOOT_UI,        // LVGL, splash, SquareLine screens
+    BOOT_SPLASH     // Ends when the pet screen is interactive
+};
+#define BOOT_BIT(id) (1UL << (id))
+const uint32_t BOOT_SPLASH_MS = 400;
+
+BootSequencer boot;
+SplashScreen splash;
+
 // ============================================
 // Forward Declarations
 // ============================================
@@ -116,12 +151,15 @@ void updateScreen1PetUI();
 void updateScreen2ResourcesUI();
 void updateScreen3StepsUI();
 void updateScreen4WalletUI();
+void handleUiEvents();
 
 // ============================================
 // LVGL Display Driver
 // ============================================
 
 void my_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p) {
+    PROFILE_SPAN(PROF_FLUSH);
+    TRACE_SCOPE("flush");
     uint32_t w = (area->x2 - area->x1 + 1);
     uint32_t h = (area->y2 - area->y1 + 1);
 
@@ -195,36 +233,12 @@ void setupUI() {
     esp_timer_create(&lvgl_tick_timer_args, &lvgl_tick_timer);
     esp_timer_start_periodic(lvgl_tick_timer, EXAMPLE_LVGL_TICK_PERIOD_MS * 1000);
 
-    // Show splash screen with "Walmagotchi" - blinking animation
-    Serial.println("Showing splash screen...");
-    lv_obj_t * splash_screen = lv_obj_create(NULL);
-    lv_obj_set_style_bg_color(splash_screen, lv_color_black(), 0);
-    lv_obj_clear_flag(splash_screen, LV_OBJ_FLAG_SCROLLABLE);
-
-    lv_obj_t * splash_label = lv_label_create(splash_screen);
-    lv_label_set_text(splash_label, "Walmagotchi");
-    lv_obj_set_style_text_font(splash_label, &lv_font_montserrat_32, 0);
-    lv_obj_set_style_text_color(splash_label, lv_color_hex(0x00ADB5), 0);
-    lv_obj_center(splash_label);
-
-    lv_scr_load(splash_screen);
-
-    // Blink effect - show/hide every 0.5 seconds for 3 seconds
-    for(int blink = 0; blink < 6; blink++) {
-        if (blink % 2 == 0) {
-            lv_obj_add_flag(splash_label, LV_OBJ_FLAG_HIDDEN);
-        } else {
-            lv_obj_clear_flag(splash_label, LV_OBJ_FLAG_HIDDEN);
-        }
-
-        // Update screen for 0.5 seconds
-        for(int i = 0; i < 17; i++) {  // 17 * 30ms ≈ 500ms
-            lv_timer_handler();
-            delay(30);
-        }
-    }
+    // Splash blinks from an LVGL timer while the rest of boot continues
+    splash.show(BOOT_SPLASH_MS);
+    lv_timer_handler();
 
-    Serial.println("Splash screen shown");
+    // Images are read in place from the assets partition (sprites, icons)
+    assetStore.begin();
 
     // Initialize SquareLine Studio UI
     ui_init();
@@ -232,115 +246,47 @@ void setupUI() {
     // Setup event handlers for new UI
     setupUIHandlers();
 
-    // Load first screen (Pet Screen) after splash
-    lv_scr_load(ui_Screen1);
+    // The UI task swaps in the pet screen when the splash time is up
 }
 
 // ============================================
 // Sui Balance Fetch
 // ============================================
 
+// Non-blocking: wake the RPC worker for an immediate refresh
 void fetchSuiBalance() {
-    if (WiFi.status() != WL_CONNECTED) {
-        Serial.println("[BALANCE] WiFi not connected");
-        return;
-    }
-
-    unsigned long now = millis();
-    if (now - lastBalanceFetch < BALANCE_FETCH_INTERVAL) {
-        return;  // Don't fetch too often
-    }
-    lastBalanceFetch = now;
-
-    Serial.println("[BALANCE] Fetching balance from Sui RPC...");
-
-    HTTPClient http;
-    http.begin(SUI_RPC_URL);
-    http.addHeader("Content-Type", "application/json");
-
-    // Build JSON-RPC request to get balance
-    JsonDocument doc;
-    doc["jsonrpc"] = "2.0";
-    doc["id"] = 1;
-    doc["method"] = "suix_getBalance";
-    JsonArray params = doc.createNestedArray("params");
-    params.add(DEVICE_WALLET_ADDRESS);
-
-    String requestBody;
-    serializeJson(doc, requestBody);
-
-    Serial.printf("[BALANCE] Request: %s\n", requestBody.c_str());
-
-    int httpCode = http.POST(requestBody);
-
-    if (httpCode > 0) {
-        if (httpCode == HTTP_CODE_OK) {
-            String payload = http.getString();
-            Serial.printf("[BALANCE] Response: %s\n", payload.c_str());
-
-            // Parse response
-            JsonDocument response;
-            DeserializationError error = deserializeJson(response, payload);
-
-            if (!error) {
-                if (response.containsKey("result")) {
-                    // Balance is in MIST (1 SUI = 1,000,000,000 MIST)
-                    long long totalBalance = response["result"]["totalBalance"];
-                    double suiAmount = totalBalance / 1000000000.0;
-
-                    // Format balance string
-                    char balanceBuf[32];
-                    snprintf(balanceBuf, sizeof(balanceBuf), "%.4f", suiAmount);
-                    suiBalance = String(balanceBuf);
-
-                    Serial.printf("[BALANCE] ✓ Balance: %s SUI (%lld MIST)\n",
-                                  suiBalance.c_str(), totalBalance);
-                } else if (response.containsKey("error")) {
-                    Serial.printf("[BALANCE] RPC Error: %s\n",
-                                  response["error"]["message"].as<const char*>());
-                    suiBalance = "Error";
-                }
-            } else {
-                Serial.printf("[BALANCE] JSON parse error: %s\n", error.c_str());
-                suiBalance = "Parse error";
-            }
-        } else {
-            Serial.printf("[BALANCE] HTTP error: %d\n", httpCode);
-            suiBalance = "HTTP error";
-        }
-    } else {
-        Serial.printf("[BALANCE] Connection failed: %s\n", http.errorToString(httpCode).c_str());
-        suiBalance = "No connection";
-    }
-
-    http.end();
+    suiRpc.requestRefresh();
 }
 
-// ============================================
-// WiFi Setup
-// ============================================
-
-void setupWiFi() {
-    Serial.println("\n=== Connecting to WiFi ===");
-    Serial.print("SSID: ");
-    Serial.println(WIFI_SSID);
-
-    WiFi.mode(WIFI_STA);
-    WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
-
-    int attempts = 0;
-    while (WiFi.status() != WL_CONNECTED && attempts < 20) {
-        delay(500);
-        Serial.print(".");
-        attempts++;
+// Publish a new pet object ID to the worker and pick up new results
+void updateSuiBalance() {
+    char petObjectId[APP_PET_ID_LEN];
+    appState.getPetObjectId(petObjectId, sizeof(petObjectId));
+    if (strcmp(petObjectId, rpcPetObjectId) != 0) {
+        strcpy(rpcPetObjectId, petObjectId);
+        suiRpc.setPetObjectId(petObjectId);
     }
 
-    if (WiFi.status() == WL_CONNECTED) {
-        Serial.println("\n✓ WiFi Connected!");
-        Serial.print("IP: ");
-        Serial.println(WiFi.localIP());
-    } else {
-        Serial.println("\n✗ WiFi Connection Failed");
+    SuiRpcSnapshot snapshot;
+    suiRpc.getSnapshot(snapshot);
+    if (snapshot.sequence == lastBalanceSequence) {
+        return;  // Nothing new
+    }
+    lastBalanceSequence = snapshot.sequence;
+
+    if (snapshot.balanceValid) {
+        // Keep showing the last good balance while retries back off
+        double suiAmount = snapshot.balanceMist / 1000000000.0;
+        char balanceBuf[APP_BALANCE_LEN];
+        snprintf(balanceBuf, sizeof(balanceBuf), "%.4f", suiAmount);
+        appState.setBalance(balanceBuf);
+
+        Serial.printf("[BALANCE] %s SUI (age %lu ms%s%s)\n",
+                      balanceBuf,
+                      (unsigned long)SuiRpcWorker::ageMs(snapshot.balanceUpdatedAt),
+                      snapshot.error[0] ? ", last error: " : "", snapshot.error);
+    } else if (snapshot.error[0]) {
+        appState.setBalance(snapshot.error);
     }
 }
 
@@ -360,16 +306,13 @@ void setupIMU() {
     }
 }
 
+// Called by the sensor task every IMU_READ_INTERVAL
 void detectSteps() {
     if (!imuInitialized) return;
+    PROFILE_SPAN(PROF_STEPS);
+    TRACE_SCOPE("steps");
 
-    // Throttle IMU reading to reduce CPU load and prevent screen flicker
-    unsigned long currentTime = millis();
-    if (currentTime - lastIMUReadTime < IMU_READ_INTERVAL) {
-        return;
-    }
-    lastIMUReadTime = currentTime;
-
+    unsigned long currentTime = appClock->millis();
     float acc[3];
     QMI8658_read_acc_xyz(acc);
 
@@ -377,7 +320,7 @@ void detectSteps() {
     accSampleBuffer[accSampleIndex][0] = acc[0];
     accSampleBuffer[accSampleIndex][1] = acc[1];
     accSampleBuffer[accSampleIndex][2] = acc[2];
-    accSampleIndex = (accSampleIndex + 1) % 30;
+    accSampleIndex = (accSampleIndex + 1) % APP_WINDOW_SAMPLES;
 
     // Calculate magnitude
     float magnitude = sqrt(acc[0]*acc[0] + acc[1]*acc[1] + acc[2]*acc[2]);
@@ -397,20 +340,17 @@ void detectSteps() {
 
         if (!stepPeakDetected) {
             stepPeakDetected = true;
-            stepCount++;
+            int stepCount = appState.addStep();
             lastStepTime = currentTime;
 
-            // Every 100 steps = 1 food
-            if (stepCount % 100 == 0) {
-                virtualPet.addFood(1);
-            }
-
-            // Every 150 steps = 2 energy
-            if (stepCount % 150 == 0) {
-                virtualPet.addEnergy(2);
+            // Rates in PetRules.h (the UI task owns the pet and applies the reward)
+            int food = petStepFood(stepCount);
+            int energy = petStepEnergy(stepCount);
+            if (food || energy) {
+                appState.postUiEvent(UI_EVENT_STEP_REWARD, food, energy);
             }
 
-            Serial.printf("✓ Step detected! Total: %d\n", stepCount);
+            DLOG_DEBUG("✓ Step detected! Total: %d", stepCount);
         }
     } else {
         if ((currentTime - lastStepTime) > 300) {
@@ -426,52 +366,79 @@ void detectSteps() {
 // Oracle Data Submission
 // ============================================
 
-void submitStepsToOracle() {
-    if (!oracleClient || !oracleClient->isAuthenticated()) {
-        Serial.println("Oracle not ready");
+// Sensor task: hand the current window to the net task once per interval
+void recordStepWindow() {
+    unsigned long now = appClock->millis();
+    if (now - lastSubmissionTime < APP_STEP_WINDOW_MS) {
+        return;  // Not time yet
+    }
+
+    int stepCount = appState.getSteps();
+    if (stepCount < APP_STEP_WINDOW_MIN) {
         return;
     }
 
-    if (stepCount < minStepsForSubmission) {
-        Serial.printf("Not enough steps (%d < %d)\n", stepCount, minStepsForSubmission);
+    // The server checks window times against its own clock: until SNTP
+    // has set ours the steps keep counting and go into the first window after
+    if (!appClock->isSynced()) {
         return;
     }
+    lastSubmissionTime = now;
 
-    unsigned long now = millis();
-    if (now - lastSubmissionTime < submissionInterval) {
-        return;  // Not time yet
+    SensorWindow window;
+    window.stepCount = stepCount;
+    window.timestamp = (uint64_t)appClock->epoch() * 1000;
+    window.batteryPercent = 85;  // Get battery level (mock for now)
+    memcpy(window.samples, accSampleBuffer, sizeof(window.samples));
+
+    if (!appState.postSensorWindow(window)) {
+        Serial.println("[SENSOR] ⚠️ Net task behind - window dropped");
     }
+}
 
-    Serial.println("\n=== Submitting to Oracle ===");
+// Net task
+void submitStepsToOracle() {
+    // Record windows locally - they accumulate even while offline
+    SensorWindow window;
+    while (appState.takeSensorWindow(window)) {
+        stepBatch.addWindow(window.stepCount, window.timestamp, window.batteryPercent,
+                            window.samples, APP_WINDOW_SAMPLES);
+    }
 
-    // Get battery level (mock for now)
-    int batteryPercent = 85;
+    unsigned long now = appClock->millis();
+    if (!stepBatch.shouldFlush(now)) {
+        return;
+    }
+    if (batchHold != BATCH_HOLD_NONE && now - lastBatchAttempt < APP_BATCH_RETRY_MS) {
+        return;  // Backing off after the last attempt
+    }
+    lastBatchAttempt = now;
 
-    // Submit with current accelerometer samples
-    bool success = oracleClient->submitStepData(
-        stepCount,
-        now,
-        batteryPercent,
-        accSampleBuffer,
-        30
-    );
+    // One signed Merkle root for the whole batch
+    bool ready = oracleClient && oracleClient->isAuthenticated();
+    if (ready && oracleClient->submitStepBatch(stepBatch)) {
+        DLOG_INFO("[ORACLE] Step batch queued for signing");
+        batchHold = BATCH_HOLD_NONE;
+        return;
+    }
 
-    if (success) {
-        lastSubmissionTime = now;
-        Serial.println("[ORACLE] Data submitted successfully");
-    } else {
-        Serial.println("[ORACLE] Submit failed");
+    // Windows stay in the batch until a later attempt
+    BatchHold hold = ready ? BATCH_HOLD_REFUSED : BATCH_HOLD_NOT_READY;
+    if (hold != batchHold) {
+        if (hold == BATCH_HOLD_REFUSED) {
+            DLOG_WARN("[ORACLE] Batch submit failed - retrying every %d ms", APP_BATCH_RETRY_MS);
+        } else {
+            DLOG_INFO("[ORACLE] Oracle not ready - batch kept");
+        }
+        batchHold = hold;
     }
 }
 
 // ============================================
-// Setup & Loop
+// Boot Stages
 // ============================================
 
-void setup() {
-    Serial.begin(115200);
-    Serial.println("\n\n=== SUI Watch - Trust Oracle ===");
-
+void bootBus() {
     // Initialize PSRAM
     if (psramInit()) {
         Serial.println("PSRAM initialized");
@@ -487,95 +454,431 @@ void setup() {
     }
     Serial.println("BlackImage allocated");
 
-    // Initialize hardware
+#if TRACER_ENABLED
+    // Trace ring in PSRAM too (NULL leaves tracing off)
+    tracer.begin((TraceEvent*)ps_malloc(TRACER_EVENTS * sizeof(TraceEvent)), TRACER_EVENTS);
+#endif
+
     DEV_Module_Init();
+}
+
+void bootWiFi() {
+    // WiFi connects in the background (cached AP first, then a full scan)
+    connectivity.begin(WIFI_SSID, WIFI_PASSWORD);
+}
+
+void bootOracle() {
+    Serial.println("\n=== Initializing Trust Oracle ===");
+
+    // Pass private key if configured (supports both hex and bech32)
+    const char* privKey = (strlen(DEVICE_PRIVATE_KEY) > 0) ? DEVICE_PRIVATE_KEY : nullptr;
+    if (strlen(ORACLE_ENDPOINTS) > 0) {
+        OracleEndpoints::store(ORACLE_ENDPOINTS);
+    }
+    TrustOracleClient* client = new TrustOracleClient(ORACLE_HOST, ORACLE_PORT, DEVICE_ID, privKey);
+    client->begin();
+
+    // Published only once fully set up; the net task starts driving it from here
+    oracleClient = client;
+    Serial.println("[ORACLE] Waiting for WiFi...");
+}
+
+void bootRpc() {
+    // Sui RPC worker (balance + pet object, waits for WiFi on its own)
+    suiRpc.begin(SUI_RPC_URL, DEVICE_WALLET_ADDRESS);
+}
+
+void bootDisplay() {
     LCD_1IN28_Init(HORIZONTAL);
     LCD_1IN28_Clear(0x0000);  // Clear to black
 
     // Setup touch
     touch.begin();
+}
 
-    // Setup UI
-    setupUI();
+// ============================================
+// Deferred Log Drain
+// ============================================
 
-    // Initialize Virtual Pet
-    virtualPet.init("Tamagotchi");
-    Serial.println("[PET] Virtual Pet initialized!");
+#define LOG_DRAIN_STACK     3072
+#define LOG_DRAIN_PRIORITY  1       // Idle-time only: the UART wait lands here
+
+static void logWriteSerial(const uint8_t* data, size_t len, void* context) {
+    Serial.write(data, len);
+}
+
+// DLOG_* records from every task, printed (or framed) off the hot paths
+void logDrainTask(void* arg) {
+    for (;;) {
+        deferredLog.drain(logWriteSerial, nullptr);
+        vTaskDelay(pdMS_TO_TICKS(DLOG_DRAIN_MS));
+    }
+}
+
+// ============================================
+// Serial Commands
+// ============================================
+
+#if TRACER_ENABLED
+#define TRACE_DUMP_STACK    3072
+#define TRACE_DUMP_PRIORITY 1       // Below every app task: dumping never stalls one
+
+static volatile bool traceDumping = false;  // Set by the net task, cleared by the dump
 
-    // Setup WiFi
-    setupWiFi();
+static const void* traceCurrentTask() {
+    return xTaskGetCurrentTaskHandle();
+}
 
-    // Setup IMU
-    setupIMU();
+static const char* traceTaskName(const void* task) {
+    return pcTaskGetName((TaskHandle_t)task);
+}
 
-    // Initialize Trust Oracle Client
-    if (WiFi.status() == WL_CONNECTED) {
-        Serial.println("\n=== Initializing Trust Oracle ===");
+static void traceWriteSerial(const char* text, size_t len, void* context) {
+    Serial.write((const uint8_t*)text, len);
+}
 
-        // Pass private key if configured (supports both hex and bech32)
-        const char* privKey = (strlen(DEVICE_PRIVATE_KEY) > 0) ? DEVICE_PRIVATE_KEY : nullptr;
-        oracleClient = new TrustOracleClient(ORACLE_HOST, ORACLE_PORT, DEVICE_ID, privKey);
-        oracleClient->begin();
-        Serial.println("[ORACLE] Connecting...");
+// One-shot task: a full ring takes ~30 s at 115200 baud
+static void traceDumpTask(void* arg) {
+    uint32_t maxEvents = (uint32_t)(uintptr_t)arg;
+    Serial.println("\n[TRACE] begin");
+    uint32_t written = tracer.dump(traceWriteSerial, nullptr, maxEvents);
+    Serial.printf("[TRACE] end %lu events\n", (unsigned long)written);
+    traceDumping = false;
+    vTaskDelete(NULL);
+}
+#endif
+
+// "trace [N]" dumps the newest N (default all) trace events as Chrome
+// Trace JSON between [TRACE] begin/end lines (sui_watch/trace_capture.py)
+void handleSerialCommand(char* line) {
+#if TRACER_ENABLED
+    if (strncmp(line, "trace", 5) == 0 && (line[5] == '\0' || line[5] == ' ')) {
+        if (traceDumping) {
+            Serial.println("[TRACE] ⚠️ Dump already running");
+            return;
+        }
+        uint32_t maxEvents = strtoul(line + 5, nullptr, 10);
+        traceDumping = true;
+        if (xTaskCreatePinnedToCore(traceDumpTask, "trace", TRACE_DUMP_STACK,
+                                    (void*)(uintptr_t)maxEvents, TRACE_DUMP_PRIORITY,
+                                    nullptr, APP_NET_CORE) != pdPASS) {
+            traceDumping = false;
+            Serial.println("[TRACE] ✗ Failed to start dump task");
+        }
+        return;
     }
+#endif
+    Serial.printf("[APP] ⚠️ Unknown command '%s'\n", line);
+}
+
+void pollSerialCommands() {
+    static char line[32];
+    static size_t len = 0;
 
-    Serial.println("\n✓ Setup Complete!\n");
+    while (Serial.available() > 0) {
+        char c = (char)Serial.read();
+        if (c == '\r') continue;
+        if (c != '\n') {
+            if (len < sizeof(line) - 1) line[len++] = c;
+            continue;
+        }
+        line[len] = '\0';
+        len = 0;
+        if (line[0]) handleSerialCommand(line);
+    }
 }
 
-void loop() {
-    // LVGL timer
-    lv_timer_handler();
+// ============================================
+// Net Task (core 0)
+// ============================================
+
+// UI requests; the answer comes back as a UiEvent
+void handleNetCommands() {
+    NetCommand cmd;
+    while (appState.takeNetCommand(cmd)) {
+        bool sent = false;
+
+        switch (cmd.type) {
+            case NET_CMD_FEED:
+                sent = oracleClient && oracleClient->feedPet();
+                break;
+            case NET_CMD_PLAY:
+                sent = oracleClient && oracleClient->playWithPet();
+                break;
+            case NET_CMD_CLAIM:
+                sent = oracleClient && oracleClient->claimResources(cmd.value);
+                break;
+            case NET_CMD_SYNC_PET: {
+                // Upload changed pet fields (no-op when already in sync)
+                PetLock lock(appState);
+                if (oracleClient && oracleClient->syncPet(virtualPet)) {
+                    Serial.println("[SYNC] ✓ Pet data synced to blockchain!");
+                } else {
+                    Serial.println("[SYNC] ✗ Pet sync failed!");
+                }
+                continue;
+            }
+            case NET_CMD_REFRESH_BALANCE:
+                fetchSuiBalance();  // Shows up on a later UI update
+                continue;
+        }
+
+        if (!sent) {
+            Serial.printf("[NET] ✗ Command %u not sent\n", cmd.type);
+            appState.postUiEvent(UI_EVENT_ACTION_FAILED);
+        }
+    }
+}
+
+// Delta sync with the blockchain every minute - nothing is sent while the pet is unchanged
+void syncPetPeriodically(unsigned long now) {
+    static unsigned long lastPetSync = 0;
+    if (now - lastPetSync <= APP_PET_SYNC_MS) return;
+    lastPetSync = now;
+
+    if (!oracleClient || !oracleClient->isAuthenticated()) return;
+
+    PetLock lock(appState);
+    if (virtualPet.isDirty() && oracleClient->syncPet(virtualPet)) {
+        Serial.println("🔄 Pet changes sent to server");
+    }
+}
 
-    // IMU & Step detection (throttled internally)
-    detectSteps();
+// Link status for the UI (copied, the UI never touches the client)
+void publishNetStatus() {
+    NetStatus status;
+    memset(&status, 0, sizeof(status));
 
-    // Oracle client loop
     if (oracleClient) {
-        oracleClient->loop();
+        const LinkMonitor& monitor = oracleClient->getLink();
+        const LinkStats& link = monitor.stats();
+        status.clientReady = true;
+        status.connected = oracleClient->isConnected();
+        status.authenticated = oracleClient->isAuthenticated();
+        status.pongs = link.pongs;
+        status.rttLastMs = link.rttLastMs;
+        status.rttP95Ms = monitor.rttPercentile(95);
+        status.disconnects = link.disconnects;
+        status.keepaliveMs = link.keepaliveMs;
+    }
+    appState.setNetStatus(status);
+}
+
+// Pet and step count to flash when they changed (rate-limited by the journal)
+void journalState(unsigned long now) {
+    static unsigned long lastCheck = 0;
+    if (now - lastCheck < APP_JOURNAL_CHECK_MS) return;
+    lastCheck = now;
+
+    int steps = appState.getSteps();
+    uint32_t changes;
+    PetState pet;
+    {
+        PetLock lock(appState);
+        changes = virtualPet.getChangeCount();
+        if (!journal.isDue(now, changes, steps)) return;
+        virtualPet.snapshot(pet);
+    }
+    journal.save(now, changes, pet, steps);
+}
+
+void netTask(void* arg) {
+    unsigned long lastStatus = 0;
+    unsigned long lastReport = 0;
+
+    for (;;) {
+        taskMonitor.begin(APP_TASK_NET);
+        unsigned long now = appClock->millis();
+
+        // WiFi timeouts and reconnects (link events arrive asynchronously)
+        connectivity.loop(now);
+
+        // Published by the oracle boot stage once set up
+        if (oracleClient) {
+            oracleClient->loop();
+            submitStepsToOracle();
+            syncPetPeriodically(now);
+        }
+        handleNetCommands();
+
+        // Pick up SUI balance from the RPC worker cache (never blocks)
+        updateSuiBalance();
+
+        journalState(now);
+        pollSerialCommands();
+
+        // Same rate the UI refreshes at
+        if (now - lastStatus >= 100) {
+            lastStatus = now;
+            publishNetStatus();
+        }
+
+        taskMonitor.end(APP_TASK_NET);
 
-        // Submit data periodically
-        submitStepsToOracle();
+        if (now - lastReport >= TASK_MONITOR_REPORT_MS) {
+            lastReport = now;
+            taskMonitor.report();
+#if PROFILER_ENABLED
+            profiler.report();
+#endif
+        }
+
+        vTaskDelay(pdMS_TO_TICKS(APP_NET_PERIOD_MS));
+    }
+}
+
+// ============================================
+// Sensor Task (core 1, above the UI)
+// ============================================
+
+void sensorTask(void* arg) {
+    // The IMU comes up in its own boot stage
+    while (!boot.isDone(BOOT_IMU)) {
+        vTaskDelay(pdMS_TO_TICKS(IMU_READ_INTERVAL));
+    }
+    if (!imuInitialized) {
+        Serial.println("[SENSOR] No IMU - step counting disabled");
+        vTaskDelete(NULL);
     }
 
-    // Update Virtual Pet
-    unsigned long currentTime = millis();
-    if (currentTime - lastPetUpdate > PET_UPDATE_INTERVAL) {
-        lastPetUpdate = currentTime;
-        virtualPet.update(currentTime);
+    // Fixed-rate sampling regardless of how long LVGL takes
+    TickType_t wake = xTaskGetTickCount();
+    for (;;) {
+        vTaskDelayUntil(&wake, pdMS_TO_TICKS(IMU_READ_INTERVAL));
+
+        taskMonitor.begin(APP_TASK_SENSOR);
+        detectSteps();
+        recordStepWindow();
+        taskMonitor.end(APP_TASK_SENSOR);
+    }
+}
 
-        // Check if pet needs attention
-        if (virtualPet.needsAttention()) {
-            Serial.println("[PET] Your pet needs attention!");
+// ============================================
+// UI Task (core 1)
+// ============================================
+
+void uiTask(void* arg) {
+    unsigned long lastUIUpdate = 0;
+
+    for (;;) {
+        taskMonitor.begin(APP_TASK_UI);
+
+        // Answers from the net task, step rewards from the sensor task.
+        // Handlers and screens take PetLock only around pet access: the
+        // net task must not wait on LVGL rendering.
+        handleUiEvents();
+
+        // LVGL timer
+        {
+            PROFILE_SPAN(PROF_LVGL);
+            TRACE_SCOPE("lvgl");
+            lv_timer_handler();
+        }
+
+        // Pet screen replaces the splash as soon as its time is up
+        if (splash.shouldTransition()) {
+            lv_scr_load(ui_Screen1);
+            splash.hide();
+            boot.finish(BOOT_SPLASH);
+            Serial.printf("[BOOT] Pet screen interactive at %lu ms\n", millis());
         }
 
-        // Sync pet with blockchain every minute
-        static unsigned long lastPetSync = 0;
-        if (currentTime - lastPetSync > 60000) {  // 60 seconds
-            lastPetSync = currentTime;
-            if (oracleClient && oracleClient->isAuthenticated()) {
-                String petJson = virtualPet.toJSON();
-                oracleClient->syncPet(petJson);
-                Serial.println("🔄 Pet synced to blockchain");
+        // Fold pet decay in for sync and the RTC copy (stats are
+        // computed from the clock, not from how often this runs)
+        unsigned long currentTime = appClock->millis();
+        if (currentTime - lastPetUpdate > APP_PET_SETTLE_MS) {
+            lastPetUpdate = currentTime;
+            PetLock lock(appState);
+            virtualPet.update(currentTime);
+
+            // Check if pet needs attention
+            if (virtualPet.needsAttention()) {
+                Serial.println("[PET] Your pet needs attention!");
             }
         }
+
+        // Update UI screens periodically (100ms interval)
+        if (currentTime - lastUIUpdate > 100) {
+            lastUIUpdate = currentTime;
+            TRACE_SCOPE("screens");
+
+            // Update all screens (they check internally if they're visible)
+            updateScreen1PetUI();    // Pet display - always update for animation
+            updateScreen2ResourcesUI();  // Food/Energy counts
+            updateScreen3StepsUI();  // Step counter
+            updateScreen4WalletUI(); // Wallet info
+        }
+
+        // Finished background stages unblock the next ones
+        boot.poll();
+
+        taskMonitor.end(APP_TASK_UI);
+        vTaskDelay(pdMS_TO_TICKS(APP_UI_PERIOD_MS));
     }
+}
 
-    // Fetch SUI balance periodically (30s interval, throttled internally)
-    fetchSuiBalance();
+void startTask(TaskFunction_t fn, uint8_t id, const char* name, uint32_t stack,
+               uint8_t priority, uint8_t core) {
+    taskMonitor.add(id, name, core, priority, stack);
+    if (xTaskCreatePinnedToCore(fn, name, stack, nullptr, priority, nullptr, core) != pdPASS) {
+        Serial.printf("[APP] ✗ Failed to start %s task\n", name);
+    }
+}
 
-    // Update UI screens periodically (100ms interval)
-    static unsigned long lastUIUpdate = 0;
-    unsigned long uiTime = millis();
-    if (uiTime - lastUIUpdate > 100) {
-        lastUIUpdate = uiTime;
+// ============================================
+// Setup & Loop
+// ============================================
 
-        // Update all screens (they check internally if they're visible)
-        updateScreen1PetUI();    // Pet display - always update for animation
-        updateScreen2ResourcesUI();  // Food/Energy counts
-        updateScreen3StepsUI();  // Step counter
-        updateScreen4WalletUI(); // Wallet info
+void setup() {
+    Serial.begin(115200);
+    Serial.println("\n\n=== SUI Watch - Trust Oracle ===");
+
+    if (xTaskCreatePinnedToCore(logDrainTask, "log", LOG_DRAIN_STACK, nullptr,
+                                LOG_DRAIN_PRIORITY, nullptr, APP_NET_CORE) != pdPASS) {
+        Serial.println("[LOG] ✗ Failed to start drain task");
+    }
+
+#if PROFILER_ENABLED
+    profiler.begin();
+#endif
+#if TRACER_ENABLED
+    tracer.setTaskHooks(traceCurrentTask, traceTaskName);
+#endif
+
+    appState.begin();
+
+    // Last saved pet and steps, so the first frame already shows them
+    JournalRecord saved;
+    bool haveSaved = journal.begin(saved);
+    if (haveSaved) {
+        appState.setSteps(saved.steps);
     }
 
-    // Increase delay to reduce CPU load and prevent screen flicker
-    delay(10);  // 10ms delay (was 2ms)
+    // Initialize Virtual Pet
+    virtualPet.init("Tamagotchi", haveSaved ? &saved.pet : nullptr);
+    Serial.println("[PET] Virtual Pet initialized!");
+
+    // Network, IMU and NVS work overlaps the display bring-up and splash
+    boot.add(BOOT_BUS, "bus", 0, bootBus);
+    boot.add(BOOT_WIFI, "wifi", 0, bootWiFi);
+    boot.add(BOOT_IMU, "imu", BOOT_BIT(BOOT_BUS), setupIMU, BOOT_BACKGROUND, 3072);
+    boot.add(BOOT_ORACLE, "oracle", 0, bootOracle, BOOT_BACKGROUND, 8192);
+    boot.add(BOOT_RPC, "rpc", 0, bootRpc);
+    boot.add(BOOT_DISPLAY, "display", BOOT_BIT(BOOT_BUS), bootDisplay);
+    boot.add(BOOT_UI, "ui", BOOT_BIT(BOOT_DISPLAY), setupUI);
+    boot.add(BOOT_SPLASH, "splash", BOOT_BIT(BOOT_UI), nullptr, BOOT_EXTERNAL);
+    boot.start();
+
+    // Foreground stages (LVGL included) are done; the tasks take over from here
+    startTask(uiTask, APP_TASK_UI, "ui", APP_UI_STACK, APP_UI_PRIORITY, APP_UI_CORE);
+    startTask(netTask, APP_TASK_NET, "net", APP_NET_STACK, APP_NET_PRIORITY, APP_NET_CORE);
+    startTask(sensorTask, APP_TASK_SENSOR, "sensor", APP_SENSOR_STACK,
+              APP_SENSOR_PRIORITY, APP_SENSOR_CORE);
+
+    Serial.printf("\n✓ Setup done at %lu ms, boot continues in the UI task\n\n", millis());
+}
+
+void loop() {
+    // Everything runs in the pinned tasks started by setup()
+    vTaskDelete(NULL);
 }
@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+"""
+Capture a trace from the watch for Perfetto
+
+  trace_capture.py LOG [OUT]                 From a saved serial log
+  trace_capture.py --port PORT [N] [OUT]     Send "trace [N]" and read the answer (pyserial)
+
+The watch answers "trace" on the serial console with its event ring as
+Chrome Trace Event JSON between "[TRACE] begin" and "[TRACE] end" lines
+(Tracer.h). Other tasks keep logging meanwhile, so their lines can land
+inside the dump: only the event objects are kept, one per line. The
+result (trace.json by default) opens in ui.perfetto.dev or
+chrome://tracing.
+"""
+import json
+import re
+import sys
+
+BEGIN = "[TRACE] begin"
+END = "[TRACE] end"
+EVENT = re.compile(r'\{"ph":.*\}')
+BAUD = 115200
+PORT_TIMEOUT_S = 120   # A full ring takes ~30 s at 115200 baud
+
+
+def extract(lines):
+    """Event objects of the last complete dump, or None"""
+    events = None
+    current = None
+    for line in lines:
+        if BEGIN in line:
+            current = []
+        elif END in line and current is not None:
+            events = current
+            current = None
+        elif current is not None:
+            match = EVENT.search(line)
+            if match:
+                try:
+                    current.append(json.loads(match.group(0)))
+                except ValueError:
+                    pass   # Cut by another task's output
+    return events
+
+
+def read_port(port, count):
+    try:
+        import serial
+    except ImportError:
+        sys.exit("pyserial is needed for --port (pip install pyserial)")
+
+    lines = []
+    with serial.Serial(port, BAUD, timeout=PORT_TIMEOUT_S) as link:
+        link.reset_input_buffer()
+        link.write(("trace %d\n" % count if count else "trace\n").encode())
+        while True:
+            raw = link.readline()
+            if not raw:
+                sys.exit("✗ No complete dump within %d s" % PORT_TIMEOUT_S)
+            line = raw.decode("utf-8", "replace")
+            lines.append(line)
+            if END in line:
+                return lines
+
+
+def main(argv):
+    if not argv or argv[0] in ("-h", "--help"):
+        print(__doc__.strip())
+        return 1
+
+    if argv[0] == "--port":
+        if len(argv) < 2:
+            print(__doc__.strip())
+            return 1
+        rest = argv[2:]
+        count = int(rest.pop(0)) if rest and rest[0].isdigit() else 0
+        lines = read_port(argv[1], count)
+    else:
+        rest = argv[1:]
+        with open(argv[0], encoding="utf-8", errors="replace") as f:
+            lines = f.readlines()
+    output = rest[0] if rest else "trace.json"
+
+    events = extract(lines)
+    if events is None:
+        print("✗ No complete [TRACE] dump found")
+        return 1
+
+    with open(output, "w") as f:
+        json.dump({"traceEvents": events, "displayTimeUnit": "ms"}, f)
+    spans = sum(1 for e in events if e.get("ph") != "M")
+    print("✓ %d events -> %s (open in ui.perfetto.dev)" % (spans, output))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
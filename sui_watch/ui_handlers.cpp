@@ -1,22 +1,27 @@
 /**
  * UI Event Handlers for SquareLine Studio Screens
+ * Runs on the UI task: blockchain actions are handed to the net task as
+ * NetCommands, shared values are read from AppState. The pet is touched
+ * under PetLock only: screens copy a PetView and draw after releasing it,
+ * so the net task never waits on LVGL.
  */
 
 #include <Arduino.h>
 #include <lvgl.h>
 #include "ui.h"
 #include "VirtualPet.h"
-#include "TrustOracleClient.h"
+#include "AppState.h"
 #include "LoadingOverlay.h"
+#include "PetAnimator.h"
+#include "Profiler.h"
+#include "Tracer.h"
+#include "DeferredLog.h"
+#include "DiagnosticsScreen.h"
 
 // External references
 extern VirtualPet virtualPet;
-extern int stepCount;
-extern TrustOracleClient* oracleClient;
+extern AppState appState;
 extern const char* DEVICE_WALLET_ADDRESS;
-extern String suiBalance;
-extern String petObjectId;  // Pet NFT Object ID
-extern void fetchSuiBalance();  // Function to manually trigger balance fetch
 
 // Pending steps for claim
 int pendingSteps = 0;
@@ -24,48 +29,60 @@ int pendingSteps = 0;
 // Loading overlay instance (accessible from other files via extern)
 LoadingOverlay loadingOverlay;
 
+// Drives the pet image on Screen 1 from its own lv_timer
+PetAnimator petAnimator;
+
+// Screen 4 link counters (created in setupUIHandlers, not in the SquareLine export)
+static lv_obj_t* linkStatsLabel = nullptr;
+
 // ============================================
 // Screen 1: Pet Display
 // ============================================
 
+// Pet values for the screens (short lock, nothing drawn while held)
+static void viewPet(PetView& pet) {
+    PetLock lock(appState);
+    virtualPet.view(pet);
+}
+
 void updateScreen1PetUI() {
-    // Update pet image animation (handled by VirtualPet)
-    virtualPet.updateAnimation();
-    const lv_img_dsc_t* petImg = virtualPet.getPetImage();
-    if (petImg) {
-        lv_img_set_src(ui_Image2, petImg);
-    }
+    PROFILE_SPAN(PROF_SCREEN1);
+    // Pet image frames are pushed by petAnimator's timer, not from here
+    PetView pet;
+    viewPet(pet);
 
     // Update pet level/maturity
     char levelBuf[32];
     const char* levelNames[] = {"Egg", "Baby", "Teen", "Adult", "Master"};
-    snprintf(levelBuf, sizeof(levelBuf), "Walrus %s", levelNames[virtualPet.getLevel()]);
+    snprintf(levelBuf, sizeof(levelBuf), "Walrus %s", levelNames[pet.level]);
     lv_label_set_text(ui_Label6, levelBuf);
 
     // Update pet NFT address (shortened format)
-    if (petObjectId.length() > 10) {
+    char petObjectId[APP_PET_ID_LEN];
+    appState.getPetObjectId(petObjectId, sizeof(petObjectId));
+    size_t idLen = strlen(petObjectId);
+    if (idLen > 10) {
         char shortAddr[20];
         // Show first 6 and last 4 characters: 0x1234...5678
         snprintf(shortAddr, sizeof(shortAddr), "%.6s...%.4s",
-                 petObjectId.c_str(),
-                 petObjectId.c_str() + petObjectId.length() - 4);
+                 petObjectId, petObjectId + idLen - 4);
         lv_label_set_text(ui_txtPetAddress, shortAddr);
     } else {
         lv_label_set_text(ui_txtPetAddress, "Not registered");
     }
 
     // Update status label dynamically
-    if (virtualPet.isEating()) {
+    if (petAnimator.isPlaying(ANIM_EAT)) {
         lv_label_set_text(ui_status, "Eating...");
-    } else if (virtualPet.isPlaying()) {
+    } else if (petAnimator.isPlaying(ANIM_PLAY)) {
         lv_label_set_text(ui_status, "Playing...");
     } else {
         // Show mood when not busy
-        if (virtualPet.getHappiness() > 70) {
+        if (pet.happiness > 70) {
             lv_label_set_text(ui_status, "Happy");
-        } else if (virtualPet.getHappiness() < 30) {
+        } else if (pet.happiness < 30) {
             lv_label_set_text(ui_status, "Sad");
-        } else if (virtualPet.getHunger() < 30) {
+        } else if (pet.hunger < 30) {
             lv_label_set_text(ui_status, "Hungry");
         } else {
             lv_label_set_text(ui_status, "Normal");
@@ -73,10 +90,10 @@ void updateScreen1PetUI() {
     }
 
     // Update happiness bar
-    lv_bar_set_value(ui_Bar1, virtualPet.getHappiness(), LV_ANIM_OFF);
+    lv_bar_set_value(ui_Bar1, pet.happiness, LV_ANIM_OFF);
 
     // Update hunger bar
-    lv_bar_set_value(ui_Bar2, virtualPet.getHunger(), LV_ANIM_OFF);
+    lv_bar_set_value(ui_Bar2, pet.hunger, LV_ANIM_OFF);
 }
 
 // ============================================
@@ -84,32 +101,36 @@ void updateScreen1PetUI() {
 // ============================================
 
 void updateScreen2ResourcesUI() {
+    PROFILE_SPAN(PROF_SCREEN2);
+    PetView pet;
+    viewPet(pet);
+
     // Update food count
     char foodBuf[16];
-    snprintf(foodBuf, sizeof(foodBuf), "%d", virtualPet.getFood());
+    snprintf(foodBuf, sizeof(foodBuf), "%d", pet.food);
     lv_label_set_text(ui_txtFood, foodBuf);
 
     // Update energy count
     char energyBuf[16];
-    snprintf(energyBuf, sizeof(energyBuf), "%d", virtualPet.getEnergy());
+    snprintf(energyBuf, sizeof(energyBuf), "%d", pet.energy);
     lv_label_set_text(ui_txtEnery, energyBuf);
 
     // Disable ALL buttons when pet is busy (eating or playing)
-    if (virtualPet.isBusy()) {
+    if (petAnimator.isBusy()) {
         lv_obj_add_state(ui_btnFeed, LV_STATE_DISABLED);
         lv_obj_add_state(ui_btnPlay, LV_STATE_DISABLED);
         return;  // Don't check other conditions
     }
 
     // Enable/disable feed button based on resources and cooldown
-    if (virtualPet.canFeed()) {
+    if (pet.canFeed) {
         lv_obj_clear_state(ui_btnFeed, LV_STATE_DISABLED);
     } else {
         lv_obj_add_state(ui_btnFeed, LV_STATE_DISABLED);
     }
 
     // Enable/disable play button based on resources and cooldown
-    if (virtualPet.canPlay()) {
+    if (pet.canPlay) {
         lv_obj_clear_state(ui_btnPlay, LV_STATE_DISABLED);
     } else {
         lv_obj_add_state(ui_btnPlay, LV_STATE_DISABLED);
@@ -117,112 +138,126 @@ void updateScreen2ResourcesUI() {
 }
 
 void onFeedButtonClicked(lv_event_t* e) {
-    Serial.println("[FEED] Feed button clicked!");
+    TRACE_INSTANT("feed tap");
 
-    // Debug: Check oracle client status
-    Serial.printf("[FEED] Oracle client: %s\n", oracleClient ? "exists" : "NULL");
-    if (oracleClient) {
-        Serial.printf("[FEED] Connected: %s\n", oracleClient->isConnected() ? "YES" : "NO");
-        Serial.printf("[FEED] Authenticated: %s\n", oracleClient->isAuthenticated() ? "YES" : "NO");
-    }
+    // Oracle client status as last published by the net task (logged
+    // deferred: a synchronous print here delays the overlay's first frame)
+    NetStatus net;
+    appState.getNetStatus(net);
+    DLOG_DEBUG("[FEED] Tapped: client %s, connected %s, authenticated %s",
+               net.clientReady ? "exists" : "NULL", net.connected ? "YES" : "NO",
+               net.authenticated ? "YES" : "NO");
 
     // Block if pet is busy with another action
-    if (virtualPet.isBusy()) {
-        Serial.println("[FEED] Pet is busy! Wait for current action to finish.");
+    if (petAnimator.isBusy()) {
+        DLOG_INFO("[FEED] Pet is busy! Wait for current action to finish.");
         return;
     }
 
     // Block if loading is showing
     if (loadingOverlay.isVisible()) {
-        Serial.println("[FEED] Loading overlay is showing! Please wait.");
+        DLOG_INFO("[FEED] Loading overlay is showing! Please wait.");
         return;
     }
 
-    // Debug: Check pet status
-    Serial.printf("[FEED] Pet food: %d\n", virtualPet.getFood());
-    Serial.printf("[FEED] Can feed: %s\n", virtualPet.canFeed() ? "YES" : "NO");
+    bool fed;
+    {
+        PetLock lock(appState);
+        DLOG_DEBUG("[FEED] Pet food: %d, can feed: %s", virtualPet.getFood(),
+                   virtualPet.canFeed() ? "YES" : "NO");
+        fed = virtualPet.canFeed();
+        if (fed) {
+            DLOG_INFO("[FEED] Feeding pet locally...");
+            virtualPet.feed();
+        }
+    }
 
-    if (virtualPet.canFeed()) {
+    if (fed) {
         // Show loading overlay
-        if (oracleClient && oracleClient->isAuthenticated()) {
+        if (net.authenticated) {
             loadingOverlay.show("Feeding on blockchain...");
         }
 
-        Serial.println("[FEED] Feeding pet locally...");
-        virtualPet.feed();
         updateScreen2ResourcesUI();
         updateScreen1PetUI();
 
         // Sync with blockchain if connected
-        if (oracleClient && oracleClient->isAuthenticated()) {
-            Serial.println("[FEED] Syncing feed action with blockchain...");
-            bool sent = oracleClient->feedPet();
-            Serial.printf("[FEED] Message sent: %s\n", sent ? "SUCCESS" : "FAILED");
+        if (net.authenticated) {
+            bool sent = appState.postNetCommand(NET_CMD_FEED);
+            DLOG_INFO("[FEED] Syncing with blockchain, handed to network task: %s",
+                      sent ? "SUCCESS" : "FAILED");
 
             if (!sent) {
                 loadingOverlay.hide();
             }
-            // Loading will be hidden when response is received in TrustOracleClient
+            // Loading will be hidden when the net task reports the response
         } else {
-            Serial.println("[FEED] ⚠️ Not connected to blockchain");
+            DLOG_WARN("[FEED] ⚠️ Not connected to blockchain");
         }
     } else {
-        Serial.println("[FEED] Cannot feed: no food or cooldown active");
+        DLOG_INFO("[FEED] Cannot feed: no food or cooldown active");
     }
 }
 
 void onPlayButtonClicked(lv_event_t* e) {
-    Serial.println("[PLAY] Play button clicked!");
+    TRACE_INSTANT("play tap");
 
-    // Debug: Check oracle client status
-    Serial.printf("[PLAY] Oracle client: %s\n", oracleClient ? "exists" : "NULL");
-    if (oracleClient) {
-        Serial.printf("[PLAY] Connected: %s\n", oracleClient->isConnected() ? "YES" : "NO");
-        Serial.printf("[PLAY] Authenticated: %s\n", oracleClient->isAuthenticated() ? "YES" : "NO");
-    }
+    // Oracle client status as last published by the net task (logged
+    // deferred: a synchronous print here delays the overlay's first frame)
+    NetStatus net;
+    appState.getNetStatus(net);
+    DLOG_DEBUG("[PLAY] Tapped: client %s, connected %s, authenticated %s",
+               net.clientReady ? "exists" : "NULL", net.connected ? "YES" : "NO",
+               net.authenticated ? "YES" : "NO");
 
     // Block if pet is busy with another action
-    if (virtualPet.isBusy()) {
-        Serial.println("[PLAY] Pet is busy! Wait for current action to finish.");
+    if (petAnimator.isBusy()) {
+        DLOG_INFO("[PLAY] Pet is busy! Wait for current action to finish.");
         return;
     }
 
     // Block if loading is showing
     if (loadingOverlay.isVisible()) {
-        Serial.println("[PLAY] Loading overlay is showing! Please wait.");
+        DLOG_INFO("[PLAY] Loading overlay is showing! Please wait.");
         return;
     }
 
-    // Debug: Check pet status
-    Serial.printf("[PLAY] Pet energy: %d\n", virtualPet.getEnergy());
-    Serial.printf("[PLAY] Can play: %s\n", virtualPet.canPlay() ? "YES" : "NO");
+    bool played;
+    {
+        PetLock lock(appState);
+        DLOG_DEBUG("[PLAY] Pet energy: %d, can play: %s", virtualPet.getEnergy(),
+                   virtualPet.canPlay() ? "YES" : "NO");
+        played = virtualPet.canPlay();
+        if (played) {
+            DLOG_INFO("[PLAY] Playing with pet locally...");
+            virtualPet.play();
+        }
+    }
 
-    if (virtualPet.canPlay()) {
+    if (played) {
         // Show loading overlay
-        if (oracleClient && oracleClient->isAuthenticated()) {
+        if (net.authenticated) {
             loadingOverlay.show("Playing on blockchain...");
         }
 
-        Serial.println("[PLAY] Playing with pet locally...");
-        virtualPet.play();
         updateScreen2ResourcesUI();
         updateScreen1PetUI();
 
         // Sync with blockchain if connected
-        if (oracleClient && oracleClient->isAuthenticated()) {
-            Serial.println("[PLAY] Syncing play action with blockchain...");
-            bool sent = oracleClient->playWithPet();
-            Serial.printf("[PLAY] Message sent: %s\n", sent ? "SUCCESS" : "FAILED");
+        if (net.authenticated) {
+            bool sent = appState.postNetCommand(NET_CMD_PLAY);
+            DLOG_INFO("[PLAY] Syncing with blockchain, handed to network task: %s",
+                      sent ? "SUCCESS" : "FAILED");
 
             if (!sent) {
                 loadingOverlay.hide();
             }
-            // Loading will be hidden when response is received in TrustOracleClient
+            // Loading will be hidden when the net task reports the response
         } else {
-            Serial.println("[PLAY] ⚠️ Not connected to blockchain");
+            DLOG_WARN("[PLAY] ⚠️ Not connected to blockchain");
         }
     } else {
-        Serial.println("[PLAY] Cannot play: no energy or cooldown active");
+        DLOG_INFO("[PLAY] Cannot play: no energy or cooldown active");
     }
 }
 
@@ -231,6 +266,9 @@ void onPlayButtonClicked(lv_event_t* e) {
 // ============================================
 
 void updateScreen3StepsUI() {
+    PROFILE_SPAN(PROF_SCREEN3);
+    int stepCount = appState.getSteps();
+
     // Update step arc (0-1000 range)
     int displaySteps = min(stepCount, 1000);
     lv_arc_set_value(ui_arcStep, displaySteps / 10);  // Arc is 0-100, so divide by 10
@@ -241,7 +279,7 @@ void updateScreen3StepsUI() {
     lv_label_set_text(ui_txtStep, stepBuf);
 
     // Enable/disable claim button
-    if (stepCount >= 100) {
+    if (stepCount >= PET_RULES.claimMinSteps) {
         lv_obj_clear_state(ui_btnClaimCount, LV_STATE_DISABLED);
     } else {
         lv_obj_add_state(ui_btnClaimCount, LV_STATE_DISABLED);
@@ -249,63 +287,68 @@ void updateScreen3StepsUI() {
 }
 
 void onClaimButtonClicked(lv_event_t* e) {
-    Serial.println("[CLAIM] Claim button clicked!");
+    TRACE_INSTANT("claim tap");
 
-    // Debug: Check oracle client status
-    Serial.printf("[CLAIM] Oracle client: %s\n", oracleClient ? "exists" : "NULL");
-    if (oracleClient) {
-        Serial.printf("[CLAIM] Connected: %s\n", oracleClient->isConnected() ? "YES" : "NO");
-        Serial.printf("[CLAIM] Authenticated: %s\n", oracleClient->isAuthenticated() ? "YES" : "NO");
-    }
+    // Oracle client status as last published by the net task (logged
+    // deferred: a synchronous print here delays the overlay's first frame)
+    NetStatus net;
+    appState.getNetStatus(net);
+    DLOG_DEBUG("[CLAIM] Tapped: client %s, connected %s, authenticated %s",
+               net.clientReady ? "exists" : "NULL", net.connected ? "YES" : "NO",
+               net.authenticated ? "YES" : "NO");
 
     // Block if loading is showing
     if (loadingOverlay.isVisible()) {
-        Serial.println("[CLAIM] Loading overlay is showing! Please wait.");
+        DLOG_INFO("[CLAIM] Loading overlay is showing! Please wait.");
         return;
     }
 
-    Serial.printf("[CLAIM] Current steps: %d\n", stepCount);
+    // Take the steps now; the sensor task keeps counting from zero
+    int stepCount = appState.claimSteps(PET_RULES.claimMinSteps);
+    DLOG_DEBUG("[CLAIM] Current steps: %d", stepCount > 0 ? stepCount : appState.getSteps());
 
-    if (stepCount >= 100) {
+    if (stepCount > 0) {
         // Show loading overlay
-        if (oracleClient && oracleClient->isAuthenticated()) {
+        if (net.authenticated) {
             loadingOverlay.show("Claiming resources...");
         }
 
         // Calculate resources
-        int foodToAdd = stepCount / 100;      // Every 100 steps = 1 food
-        int energyToAdd = (stepCount / 150) * 2;  // Every 150 steps = 2 energy
+        int foodToAdd = petClaimFood(stepCount);
+        int energyToAdd = petClaimEnergy(stepCount);
 
         // Add resources to pet locally
-        virtualPet.addFood(foodToAdd);
-        virtualPet.addEnergy(energyToAdd);
+        {
+            PetLock lock(appState);
+            virtualPet.addFood(foodToAdd);
+            virtualPet.addEnergy(energyToAdd);
+        }
 
-        Serial.printf("[CLAIM] Claimed locally: %d food, %d energy from %d steps\n",
-                      foodToAdd, energyToAdd, stepCount);
+        DLOG_INFO("[CLAIM] Claimed locally: %d food, %d energy from %d steps",
+                  foodToAdd, energyToAdd, stepCount);
 
         // Sync with blockchain if connected
-        if (oracleClient && oracleClient->isAuthenticated()) {
-            Serial.println("[CLAIM] Syncing claim with blockchain...");
-            bool sent = oracleClient->claimResources(stepCount);
-            Serial.printf("[CLAIM] Message sent: %s\n", sent ? "SUCCESS" : "FAILED");
+        if (net.authenticated) {
+            bool sent = appState.postNetCommand(NET_CMD_CLAIM, stepCount);
+            DLOG_INFO("[CLAIM] Syncing with blockchain, handed to network task: %s",
+                      sent ? "SUCCESS" : "FAILED");
 
             if (!sent) {
                 loadingOverlay.hide();
             }
-            // Loading will be hidden when response is received in TrustOracleClient
+            // Loading will be hidden when the net task reports the response
         } else {
-            Serial.println("[CLAIM] ⚠️ Not connected to blockchain");
+            DLOG_WARN("[CLAIM] ⚠️ Not connected to blockchain");
         }
 
-        // Reset step count after claiming
-        stepCount = 0;
+        // Step count was reset by claimSteps()
         pendingSteps = 0;
 
         // Update all UIs
         updateScreen3StepsUI();
         updateScreen2ResourcesUI();
     } else {
-        Serial.println("[CLAIM] Need at least 100 steps to claim");
+        DLOG_INFO("[CLAIM] Need at least %u steps to claim", PET_RULES.claimMinSteps);
     }
 }
 
@@ -314,6 +357,7 @@ void onClaimButtonClicked(lv_event_t* e) {
 // ============================================
 
 void updateScreen4WalletUI() {
+    PROFILE_SPAN(PROF_SCREEN4);
     // Update wallet address - show shortened format
     if (DEVICE_WALLET_ADDRESS && strlen(DEVICE_WALLET_ADDRESS) > 10) {
         char shortAddr[20];
@@ -327,41 +371,67 @@ void updateScreen4WalletUI() {
     }
 
     // Update SUI balance (from periodic fetch)
-    String balanceText = suiBalance + " SUI";
-    lv_label_set_text(ui_txtBalance, balanceText.c_str());
+    char balance[APP_BALANCE_LEN];
+    char balanceText[APP_BALANCE_LEN + 8];
+    appState.getBalance(balance, sizeof(balance));
+    snprintf(balanceText, sizeof(balanceText), "%s SUI", balance);
+    lv_label_set_text(ui_txtBalance, balanceText);
 
     // Update connection status
-    if (oracleClient && oracleClient->isAuthenticated()) {
-        lv_label_set_text(ui_txtConnect, "Connected");
+    NetStatus net;
+    appState.getNetStatus(net);
+    if (net.authenticated) {
+        char connectBuf[32];
+        if (net.pongs > 0) {
+            snprintf(connectBuf, sizeof(connectBuf), "Connected %lu ms", (unsigned long)net.rttLastMs);
+        } else {
+            snprintf(connectBuf, sizeof(connectBuf), "Connected");
+        }
+        lv_label_set_text(ui_txtConnect, connectBuf);
     } else {
         lv_label_set_text(ui_txtConnect, "Disconnected");
     }
+
+    // Link counters: RTT p95, drops, current keepalive
+    if (linkStatsLabel) {
+        if (net.clientReady) {
+            char statsBuf[48];
+            snprintf(statsBuf, sizeof(statsBuf), "p95 %lums  drop %lu  ka %lus",
+                     (unsigned long)net.rttP95Ms,
+                     (unsigned long)net.disconnects,
+                     (unsigned long)(net.keepaliveMs / 1000));
+            lv_label_set_text(linkStatsLabel, statsBuf);
+        } else {
+            lv_label_set_text(linkStatsLabel, "");
+        }
+    }
 }
 
 void onSyncButtonClicked(lv_event_t* e) {
     Serial.println("[SYNC] Sync button clicked!");
 
-    if (oracleClient && oracleClient->isAuthenticated()) {
-        // 1. Upload current pet state to blockchain
-        String petJson = virtualPet.toJSON();
-        bool success = oracleClient->syncPet(petJson);
+    NetStatus net;
+    appState.getNetStatus(net);
+    if (net.authenticated) {
+        // 1. Upload changed pet fields (net task, no-op when already in sync)
+        bool success = appState.postNetCommand(NET_CMD_SYNC_PET);
 
         if (success) {
-            Serial.println("[SYNC] ✓ Pet data synced to blockchain!");
+            PetLock lock(appState);
             Serial.println("[SYNC] Pet state:");
-            Serial.printf("  - Name: %s\n", virtualPet.getName().c_str());
+            Serial.printf("  - Name: %s\n", virtualPet.getName());
             Serial.printf("  - Level: %d\n", virtualPet.getLevel());
             Serial.printf("  - Happiness: %d\n", virtualPet.getHappiness());
             Serial.printf("  - Hunger: %d\n", virtualPet.getHunger());
             Serial.printf("  - Health: %d\n", virtualPet.getHealth());
             Serial.printf("  - XP: %d\n", virtualPet.getExperience());
         } else {
-            Serial.println("[SYNC] ✗ Pet sync failed!");
+            Serial.println("[SYNC] ✗ Network task busy - sync not queued");
         }
 
-        // 2. Fetch latest balance from Sui blockchain
-        Serial.println("[SYNC] Fetching latest balance...");
-        fetchSuiBalance();
+        // 2. Ask the RPC worker for a fresh balance (shows up on a later UI update)
+        Serial.println("[SYNC] Requesting balance refresh...");
+        appState.postNetCommand(NET_CMD_REFRESH_BALANCE);
 
         // 3. Update UI
         updateScreen4WalletUI();
@@ -371,11 +441,52 @@ void onSyncButtonClicked(lv_event_t* e) {
     }
 }
 
+// Hidden: long-press the wallet screen for the profiler and task load
+void onDiagnosticsRequested(lv_event_t* e) {
+    diagnosticsScreen.open(ui_Screen4);
+}
+
+// ============================================
+// Events from the Net and Sensor Tasks
+// ============================================
+
+void handleUiEvents() {
+    UiEvent event;
+    while (appState.takeUiEvent(event)) {
+        switch (event.type) {
+            case UI_EVENT_ACTION_DONE:
+                TRACE_INSTANT("action done");
+                loadingOverlay.hide();
+                break;
+            case UI_EVENT_ACTION_FAILED:
+                Serial.println("[UI] ✗ Blockchain action failed");
+                TRACE_INSTANT("action failed");
+                loadingOverlay.hide();
+                break;
+            case UI_EVENT_STEP_REWARD: {
+                PetLock lock(appState);
+                if (event.food > 0) virtualPet.addFood(event.food);
+                if (event.energy > 0) virtualPet.addEnergy(event.energy);
+                virtualPet.animate(ANIM_WALK);
+                break;
+            }
+        }
+    }
+}
+
 // ============================================
 // Setup Event Handlers
 // ============================================
 
+static void onPetAnimation(PetAnimation anim) {
+    petAnimator.play(anim);
+}
+
 void setupUIHandlers() {
+    // Screen 1 pet image: clips requested by the pet, stepped by one lv_timer
+    petAnimator.begin(ui_Image2);
+    virtualPet.setAnimationHook(onPetAnimation);
+
     // Screen 2 button handlers
     lv_obj_add_event_cb(ui_btnFeed, onFeedButtonClicked, LV_EVENT_CLICKED, NULL);
     lv_obj_add_event_cb(ui_btnPlay, onPlayButtonClicked, LV_EVENT_CLICKED, NULL);
@@ -385,6 +496,17 @@ void setupUIHandlers() {
 
     // Screen 4 button handler
     lv_obj_add_event_cb(ui_Button5, onSyncButtonClicked, LV_EVENT_CLICKED, NULL);
+    lv_obj_add_event_cb(ui_Screen4, onDiagnosticsRequested, LV_EVENT_LONG_PRESSED, NULL);
+
+    // Screen 4 link counters, between the status line and the Sync button
+    linkStatsLabel = lv_label_create(ui_Screen4);
+    lv_obj_set_width(linkStatsLabel, LV_SIZE_CONTENT);
+    lv_obj_set_height(linkStatsLabel, LV_SIZE_CONTENT);
+    lv_obj_set_x(linkStatsLabel, 0);
+    lv_obj_set_y(linkStatsLabel, 40);
+    lv_obj_set_align(linkStatsLabel, LV_ALIGN_CENTER);
+    lv_obj_set_style_text_color(linkStatsLabel, lv_color_hex(0x808080), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_label_set_text(linkStatsLabel, "");
 
     Serial.println("[UI] Event handlers setup complete");
 }
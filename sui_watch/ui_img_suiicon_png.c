@@ -1,63 +0,0 @@
-// This file was generated by SquareLine Studio
-// SquareLine Studio version: SquareLine Studio 1.5.3
-// LVGL version: 8.3.11
-// Project name: SquareLine_Project
-
-#include "ui.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-    #define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-// IMAGE DATA: assets/suiicon.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_suiicon_png_data[] = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x72,0x94,0x04,0x49,0x4A,0x32,0x65,0x29,0x65,0xE3,0x18,0x86,0x82,0x10,0x98,0xA3,0x10,0xA5,0x62,0x10,0xAF,0x61,0x08,0xB0,0xA3,0x10,0xAE,0xC3,0x18,0xA8,0xE3,0x18,0x94,0x45,0x29,0x78,0xA7,0x31,0x4A,0xEC,0x5A,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x10,0x84,0x05,0xE7,0x39,0x52,0x24,0x21,0xAD,0xC3,0x18,0xEF,0x63,0x00,0xFF,0xCA,0x21,0xFF,0xCE,0x3A,0xFF,0x51,0x43,0xFF,0x93,0x4B,0xFF,0xD4,0x4B,0xFF,0xD4,0x4B,0xFF,0xB3,0x4B,0xFF,0x72,0x43,0xFF,0x10,0x3B,0xFF,0x4C,0x32,0xFF,0xE5,0x10,0xFF,0x42,0x08,0xFB,0x04,0x21,0xC6,0xA7,0x31,0x77,0xCB,0x5A,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0x0A,0x86,0x31,0x70,0xE3,0x18,0xE1,0xC5,0x08,0xFF,0xCE,0x3A,0xFF,0xD4,0x4B,0xFF,0x78,0x5C,0xFF,0xB9,0x5C,0xFF,0x98,0x5C,0xFF,0x57,0x54,0xFF,0x16,0x54,0xFF,0xF5,0x53,0xFF,0xF5,0x4B,0xFF,0x16,0x54,0xFF,0x36,0x54,0xFF,
-    0x78,0x5C,0xFF,0xB9,0x5C,0xFF,0xB9,0x5C,0xFF,0x36,0x54,0xFF,0x51,0x43,0xFF,0xA8,0x21,0xFF,0x82,0x10,0xF8,0x45,0x29,0x9D,0x08,0x42,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x55,0xA2,0x18,0xE1,0x88,0x19,0xFF,0x92,0x43,0xFF,0x98,0x5C,0xFF,0xB9,0x5C,0xFF,0xF5,0x53,0xFF,0x10,0x3B,0xFF,0xEA,0x29,0xFF,0xA4,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x42,0x00,0xFF,0x67,0x19,0xFF,0xAE,0x3A,0xFF,0xB3,0x4B,0xFF,0x77,0x5C,0xFF,0xB9,0x5C,0xFF,0x14,0x54,0xFF,0x6D,0x32,0xFF,0x82,0x08,0xF8,0x25,0x29,0x8C,0x8A,0x52,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x18,0x04,0x21,0xB0,0x05,0x11,0xFF,0x72,0x43,0xFF,0xB8,0x5C,0xFF,0x78,0x54,0xFF,0x31,0x43,0xFF,0x46,0x19,0xFF,0x01,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x63,0x00,0xFF,0x6D,0x32,0xFF,0xF5,0x53,0xFF,0xB9,0x5C,0xFF,0x15,0x54,0xFF,0x0B,0x2A,0xFF,0xC3,0x18,0xE3,0xC7,0x39,0x4B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x43,0xA3,0x10,0xE8,0x6C,0x32,0xFF,0x77,0x5C,0xFF,0x98,0x5C,0xFF,0x10,0x3B,0xFF,0xA3,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x01,0x00,0xFF,0x0B,0x2A,0xFF,0x15,0x54,0xFF,0xB9,0x5C,0xFF,0x72,0x4B,0xFF,0xA4,0x10,0xFE,0x45,0x29,0x8E,0x4D,0x6B,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0x64,0x62,0x08,0xFA,0x51,0x43,0xFF,0xB8,0x5C,0xFF,0xD4,0x4B,0xFF,0x47,0x19,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0x00,0xFF,0xCF,0x3A,0xFF,0x98,0x5C,0xFF,0x36,0x54,0xFF,0x88,0x21,0xFF,0xE3,0x18,0xB9,0x08,0x42,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x6E,0xA4,0x08,0xFE,0xD4,0x4B,0xFF,0x98,0x5C,0xFF,0xEF,0x3A,0xFF,0x21,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xC9,0x21,0xFF,0x56,0x54,0xFF,0x77,0x5C,0xFF,0x0A,0x2A,0xFF,0xC3,0x10,0xC8,0xC7,0x39,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x5D,0xA4,0x08,0xFE,0xF5,0x4B,0xFF,0x98,0x5C,0xFF,0x4C,0x2A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE5,0x10,0xFF,0xF5,0x53,0xFF,0x98,0x5C,0xFF,0x0B,0x2A,0xFF,0xC3,0x18,0xC3,0x8A,0x52,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x3F,0x62,0x08,0xF9,0xD4,0x4B,0xFF,0x98,0x5C,0xFF,0x0B,0x2A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA4,0x08,0xFF,0xF5,0x53,0xFF,0x98,0x5C,0xFF,0xA8,0x21,0xFF,0x25,0x29,0xA7,0x30,0x8C,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x41,0x14,0x82,0x10,0xE6,0x51,0x43,0xFF,0xB9,0x5C,0xFF,0x6C,0x32,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA9,0x21,0xFF,0xAD,0x3A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xE5,0x10,0xFF,0x36,0x54,0xFF,0x57,0x54,0xFF,0xE5,0x10,0xFF,0xC7,0x39,0x6E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xA6,0x2C,0x32,0xFF,0xB8,0x5C,0xFF,0x10,0x43,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x06,0x11,0xFF,0x57,0x54,0xFF,0xB9,0x5C,0xFF,
-    0x8D,0x32,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x68,0x19,0xFF,0x77,0x5C,0xFF,0xB3,0x4B,0xFF,0xA2,0x10,0xF6,0x28,0x42,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x42,0xC4,0x08,0xFE,0x57,0x5C,0xFF,0xF4,0x4B,0xFF,0x22,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x42,0x00,0xFF,0xF4,0x53,0xFF,0xDA,0x54,0xFF,0xDA,0x54,0xFF,0x98,0x54,0xFF,0xEA,0x21,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x8D,0x32,0xFF,0xB9,0x5C,0xFF,0x8D,0x32,0xFF,0x24,0x21,0xBA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x03,0x62,0x10,0xCD,0x31,0x43,0xFF,0x98,0x5C,0xFF,0x67,0x19,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x51,0x4B,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0xDA,0x5C,0xFF,0x57,0x54,0xFF,0x26,0x19,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xB4,0x4B,0xFF,0x57,0x5C,0xFF,0xA3,0x08,0xFF,0xA6,0x31,0x4B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x5B,0x26,0x11,0xFF,
-    0x98,0x5C,0xFF,0x30,0x43,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xAE,0x3A,0xFF,0xB9,0x5C,0xFF,0xBA,0x5C,0xFF,0x98,0x5C,0xFF,0x36,0x54,0xFF,0xD9,0x5C,0xFF,0xBA,0x5C,0xFF,0x15,0x4C,0xFF,0x62,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x68,0x19,0xFF,0x98,0x5C,0xFF,0x10,0x3B,0xFF,0xA3,0x18,0xC8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0xCF,0x51,0x43,0xFF,0x78,0x5C,0xFF,0xE5,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x0A,0x2A,0xFF,0x98,0x5C,0xFF,0xBA,0x5C,0xFF,0xB9,0x5C,0xFF,0x2B,0x2A,0xFF,0xC4,0x10,0xFF,0x36,0x54,0xFF,0xB9,0x5C,0xFF,0xBA,0x5C,0xFF,0x72,0x43,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x72,0x4B,0xFF,0x77,0x5C,0xFF,0x83,0x08,0xFF,0x45,0x29,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x29,0x34,0x83,0x08,0xFF,0x77,0x5C,0xFF,0x72,0x43,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x47,0x19,0xFF,0x77,0x54,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0x10,0x43,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x68,0x19,0xFF,0x78,0x54,0xFF,0xB9,0x5C,0xFF,0xBA,0x54,0xFF,0xCE,0x3A,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x88,0x21,0xFF,0xB8,0x5C,0xFF,0x8E,0x3A,0xFF,0xC3,0x18,0x9A,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x90,0x6D,0x32,0xFF,0xB9,0x5C,0xFF,0xA9,0x21,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x63,0x00,0xFF,0x15,0x54,0xFF,0xBA,0x5C,0xFF,0xDA,0x54,0xFF,0x16,0x54,0xFF,0x42,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x0B,0x2A,0xFF,0xB9,0x5C,0xFF,0xBA,0x5C,0xFF,0x99,0x5C,0xFF,0x2B,0x2A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0xF5,0x53,0xFF,0xF4,0x4B,0xFF,0x62,0x08,0xEC,0x28,0x42,0x04,0x96,0xB5,0x01,0xC3,0x18,0xE0,0xB3,0x4B,0xFF,0x36,0x54,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0x00,0xFF,0x92,0x4B,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0x8D,0x32,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xAE,0x3A,0xFF,0xB9,0x5C,0xFF,0xDA,0x54,0xFF,0x78,0x5C,0xFF,0x67,0x19,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xEF,0x3A,0xFF,0x98,0x5C,0xFF,0xC4,0x10,0xFF,0xE4,0x20,0x35,0x8A,0x52,0x28,0x21,0x00,0xFF,0x57,0x54,0xFF,0x51,0x43,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xEF,0x3A,0xFF,0xB9,0x5C,0xFF,0xDA,0x54,0xFF,0xBA,0x54,0xFF,0xB8,0x5C,0xFF,0xE5,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0x00,0xFF,0x52,0x4B,0xFF,0xBA,0x5C,0xFF,0xB9,0x5C,0xFF,0x36,0x54,0xFF,0xA4,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x47,0x19,0xFF,0xB9,0x5C,0xFF,0x6C,0x32,0xFF,0x62,0x10,0x72,0x66,0x31,0x5E,0x47,0x19,0xFF,0xB9,0x5C,0xFF,0x6C,0x32,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x4C,0x2A,0xFF,0xB9,0x5C,0xFF,0xB9,0x5C,0xFF,0xDA,0x54,0xFF,0xBA,0x54,0xFF,0x78,0x54,0xFF,0x22,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x42,0x00,0xFF,0xF4,0x53,0xFF,0xDA,0x54,0xFF,0xD9,0x54,0xFF,0xB3,0x4B,0xFF,0x21,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x01,0x00,0xFF,0x57,0x54,0xFF,0x51,0x43,0xFF,0x21,0x08,0xA7,0x45,0x29,0x88,0x6C,0x32,0xFF,0xB9,0x5C,0xFF,0x26,0x11,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x47,0x19,0xFF,0x78,0x5C,0xFF,0xDA,0x54,0xFF,0xBA,0x5C,0xFF,0xB9,0x54,0xFF,0xDA,0x54,0xFF,0x98,0x5C,0xFF,0xA4,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x05,0x11,0xFF,0x56,0x5C,0xFF,0xDA,0x54,0xFF,0xB9,0x5C,0xFF,0xEF,0x3A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xD4,0x4B,0xFF,0xD4,0x4B,0xFF,0x41,0x08,0xD3,0x25,0x29,0xAC,0xEF,0x3A,0xFF,0x78,0x5C,0xFF,0x21,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0x00,0xFF,0xD3,0x4B,0xFF,0xDA,0x54,0xFF,0xBA,0x5C,0xFF,0x72,0x43,0xFF,0x36,0x54,0xFF,0xBA,0x5C,0xFF,0xB9,0x5C,0xFF,0x0B,0x2A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xCA,0x21,0xFF,0x98,0x5C,0xFF,0xDA,0x54,0xFF,0x98,0x5C,0xFF,0xA9,0x21,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x72,0x43,0xFF,0x36,0x54,0xFF,0x21,0x00,0xF7,0x67,0x31,0xBB,0x51,0x43,0xFF,
-    0x57,0x54,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2B,0x2A,0xFF,0xDA,0x54,0xFF,0xD9,0x5C,0xFF,0xF5,0x53,0xFF,0x42,0x00,0xFF,0x72,0x43,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0xB4,0x4B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xCE,0x3A,0xFF,0xD9,0x5C,0xFF,0xBA,0x5C,0xFF,0xB3,0x4B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x10,0x3B,0xFF,0x77,0x5C,0xFF,0x01,0x00,0xFF,0xA8,0x39,0xBD,0x72,0x43,0xFF,0x16,0x54,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xB3,0x4B,0xFF,0xDA,0x5C,0xFF,
-    0xB9,0x5C,0xFF,0xEA,0x21,0xFF,0x00,0x00,0xFF,0xA8,0x21,0xFF,0xB9,0x5C,0xFF,0xBA,0x5C,0xFF,0xB9,0x5C,0xFF,0xAE,0x3A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0x00,0xFF,0x36,0x54,0xFF,0xBA,0x54,0xFF,0x98,0x5C,0xFF,0x05,0x11,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xCF,0x3A,0xFF,0x98,0x5C,0xFF,0x22,0x00,0xFF,0xA7,0x39,0xB9,0x92,0x4B,0xFF,0x16,0x54,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x41,0x00,0xFF,0x77,0x5C,0xFF,0xDA,0x54,0xFF,0x36,0x54,0xFF,0x01,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x52,0x43,0xFF,0xBA,0x5C,0xFF,0xDA,0x54,0xFF,0xB9,0x5C,0xFF,0x10,0x43,0xFF,0x42,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xEF,0x3A,0xFF,0xBA,0x5C,0xFF,0xDA,0x5C,0xFF,0xAE,0x3A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xAE,0x3A,0xFF,0x98,0x5C,0xFF,0x42,0x00,0xFF,0x66,0x31,0xB1,0x72,0x43,0xFF,0x36,0x54,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA9,0x21,0xFF,0xB9,0x5C,0xFF,0xDA,0x54,0xFF,0x52,0x43,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x63,0x08,0xFF,0xF5,0x53,0xFF,0xB9,0x5C,0xFF,0xDA,0x54,0xFF,0xB9,0x5C,0xFF,0x15,0x54,0xFF,0xC9,0x21,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA9,0x21,0xFF,0xB9,0x5C,0xFF,0xDA,0x54,0xFF,0x93,0x4B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xCF,0x3A,0xFF,0x98,0x5C,0xFF,0x22,0x00,0xFF,0xE4,0x20,0xA5,0x30,0x43,0xFF,0x57,0x54,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x8E,0x32,0xFF,0xD9,0x54,0xFF,0xBA,0x5C,0xFF,0xAF,0x32,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA4,0x08,0xFF,0xD4,0x4B,0xFF,0xBA,0x5C,0xFF,0xBA,0x54,0xFF,0xBA,0x54,0xFF,0xB9,0x5C,0xFF,0x30,0x43,0xFF,0x42,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x63,0x00,0xFF,0x98,0x54,0xFF,0xBA,0x5C,0xFF,0x16,0x4C,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x31,0x43,0xFF,0x57,0x5C,0xFF,0x21,0x00,0xFB,0xE3,0x20,0x92,0xCE,0x3A,0xFF,0x98,0x5C,0xFF,0x62,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xCF,0x3A,0xFF,0xD9,0x54,0xFF,0xBA,0x5C,0xFF,0x8D,0x32,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0x00,0xFF,0xCF,0x3A,0xFF,0x98,0x5C,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0xB9,0x5C,0xFF,0xF4,0x53,0xFF,0xC4,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0x00,0xFF,0x77,0x5C,0xFF,0xBA,0x5C,0xFF,0x16,0x54,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x92,0x4B,0xFF,0x16,0x54,0xFF,0x21,0x00,0xE4,0x25,0x29,0x74,0x0B,0x2A,0xFF,0xB9,0x5C,0xFF,0xA8,0x21,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xAE,0x3A,0xFF,0xDA,0x54,0xFF,0xD9,0x5C,0xFF,0xEF,0x3A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x27,0x19,0xFF,0xB4,0x4B,0xFF,0xBA,0x5C,0xFF,0xBA,0x54,0xFF,0xDA,0x54,0xFF,0xF5,0x53,0xFF,0x63,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA4,0x08,0xFF,0x98,0x5C,0xFF,0xDA,0x54,0xFF,0xF5,0x4B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x15,0x4C,0xFF,0xB3,0x4B,0xFF,0x41,0x08,0xBE,0xA6,0x31,0x44,0xA4,0x08,0xFF,0x98,0x5C,0xFF,0xCE,0x3A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x0A,0x2A,0xFF,0xB9,0x5C,0xFF,0xD9,0x54,0xFF,0x93,0x43,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0x00,0xFF,0xF0,0x3A,0xFF,0xB9,0x5C,0xFF,0xDA,0x5C,0xFF,0xDA,0x54,0xFF,0x72,0x43,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xEA,0x21,0xFF,0xB9,0x5C,0xFF,0xBA,0x5C,0xFF,
-    0x93,0x4B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x42,0x00,0xFF,0x98,0x5C,0xFF,0xEF,0x42,0xFF,0x61,0x08,0x8F,0xEB,0x5A,0x0F,0x62,0x08,0xF9,0x16,0x54,0xFF,0xB3,0x4B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA4,0x08,0xFF,0x98,0x5C,0xFF,0xBA,0x5C,0xFF,0x57,0x54,0xFF,0x62,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xCF,0x3A,0xFF,0xB9,0x5C,0xFF,0xDA,0x54,0xFF,0xB9,0x5C,0xFF,0xA9,0x21,0xFF,0x00,0x00,0xFF,0x30,0x43,0xFF,0xDA,0x54,0xFF,0xB9,0x5C,0xFF,0xEF,0x3A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x0A,0x2A,0xFF,0xB9,0x5C,0xFF,0xC9,0x21,0xFF,0x82,0x10,0x55,
-    0x00,0x00,0x00,0xA3,0x18,0xBA,0x31,0x43,0xFF,0x78,0x5C,0xFF,0x63,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xD4,0x4B,0xFF,0xDA,0x54,0xFF,0xBA,0x5C,0xFF,0xAE,0x32,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x20,0x00,0xFF,0xD4,0x4B,0xFF,0xBA,0x5C,0xFF,0xDA,0x54,0xFF,0x93,0x4B,0xFF,0xA4,0x08,0xFF,0x77,0x54,0xFF,0xDA,0x54,0xFF,0xB9,0x5C,0xFF,0x47,0x19,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x72,0x43,0xFF,0x77,0x54,0xFF,0x42,0x00,0xFC,0x45,0x29,0x17,0x00,0x00,0x00,0xC3,0x18,0x64,0xA9,0x21,0xFF,0xB9,0x5C,0xFF,0x6D,0x32,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x2B,0x2A,0xFF,0xB9,0x5C,0xFF,0xDA,0x54,0xFF,0x77,0x54,0xFF,0x26,0x11,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xEA,0x29,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0x37,0x4C,0xFF,0x72,0x43,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0xD4,0x4B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x42,0x00,0xFF,0x57,0x54,0xFF,0x72,0x43,0xFF,0x61,0x10,0xC4,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x39,0x13,0x42,0x08,0xF8,0x15,0x54,0xFF,0xF4,0x4B,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0x00,0xFF,0xD4,0x4B,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0x15,0x54,0xFF,0xE5,0x10,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x21,0x00,0xFF,0x78,0x54,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0xDA,0x54,0xFF,0x99,0x5C,0xFF,0xA9,0x21,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x6C,0x32,0xFF,0xB9,0x5C,0xFF,0xCA,0x21,0xFF,0xA2,0x10,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xA2,0x8D,0x32,0xFF,0xB9,0x5C,0xFF,0xEA,0x29,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x67,0x19,0xFF,0x77,0x5C,0xFF,0xDA,0x54,0xFF,0xDA,0x54,0xFF,0x36,0x54,0xFF,0xA9,0x21,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x01,0x00,0xFF,0x57,0x54,0xFF,0xBA,0x5C,0xFF,0xDA,0x5C,0xFF,0xBA,0x5C,0xFF,0xB9,0x5C,0xFF,0xF0,0x3A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0x00,0xFF,0x15,0x54,0xFF,0xF4,0x53,0xFF,0x41,0x08,0xF1,0x66,0x29,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0x2A,0x62,0x00,0xFB,0x36,0x54,0xFF,0xF4,0x53,0xFF,0x21,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2B,0x2A,0xFF,0x98,0x5C,0xFF,0xBA,0x5C,0xFF,0xB9,0x5C,0xFF,0x98,0x5C,0xFF,0x72,0x4B,0xFF,0xA9,0x21,0xFF,0x22,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x21,0x00,0xFF,0x26,0x11,0xFF,0xEF,0x3A,0xFF,0x98,0x5C,0xFF,0xDA,0x54,0xFF,0xDA,0x54,0xFF,0xD9,0x5C,0xFF,0x93,0x4B,0xFF,0x21,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x6D,0x32,0xFF,0xB9,0x5C,0xFF,0x2B,0x2A,0xFF,0x82,0x10,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x9A,0x4C,0x2A,0xFF,0xB9,0x5C,0xFF,
-    0x8D,0x32,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2C,0x2A,0xFF,0x77,0x5C,0xFF,0xBA,0x5C,0xFF,0xDA,0x54,0xFF,0xDA,0x54,0xFF,0xB9,0x5C,0xFF,0x77,0x5C,0xFF,0x15,0x54,0xFF,0x15,0x54,0xFF,0x57,0x54,0xFF,0xB9,0x5C,0xFF,0xB9,0x5C,0xFF,0xDA,0x54,0xFF,0xBA,0x5C,0xFF,0xB9,0x5C,0xFF,0x52,0x43,0xFF,0x22,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA4,0x08,0xFF,0x57,0x54,0xFF,0xD4,0x4B,0xFF,0x41,0x08,0xEF,0x65,0x29,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x29,0x17,0x42,0x08,0xEC,0xB3,0x4B,0xFF,0x77,0x5C,0xFF,0x46,0x19,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x47,0x19,0xFF,0xB3,0x4B,0xFF,
-    0xB9,0x5C,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0xBA,0x54,0xFF,0xDA,0x54,0xFF,0xDA,0x54,0xFF,0xDA,0x54,0xFF,0xDA,0x54,0xFF,0xBA,0x5C,0xFF,0xBA,0x5C,0xFF,0x57,0x54,0xFF,0x4D,0x2A,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x01,0x00,0xFF,0x92,0x4B,0xFF,0x98,0x5C,0xFF,0x67,0x19,0xFF,0xE3,0x18,0x6D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x58,0x06,0x11,0xFF,0x57,0x5C,0xFF,0xF5,0x4B,0xFF,0x63,0x08,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x88,0x21,0xFF,0x51,0x43,0xFF,0x16,0x54,0xFF,0x98,0x5C,0xFF,0xD9,0x5C,0xFF,0xBA,0x5C,0xFF,0xB9,0x5C,0xFF,0x77,0x5C,0xFF,0xB4,0x4B,0xFF,0x6D,0x32,0xFF,0x42,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xAE,0x3A,0xFF,0xB9,0x5C,0xFF,0xAE,0x3A,0xFF,0x82,0x10,0xBF,0xAA,0x52,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x9C,0x0A,0x2A,0xFF,0x98,0x5C,0xFF,0x93,0x4B,0xFF,0x21,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x63,0x00,0xFF,0x26,0x11,0xFF,0x88,0x19,0xFF,0x06,0x11,0xFF,0x42,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2B,0x2A,0xFF,0x98,0x5C,0xFF,0x72,0x4B,0xFF,0x41,0x08,0xEA,0x25,0x29,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x39,0x08,0x62,0x10,0xC3,0x8D,0x32,0xFF,0xB8,0x5C,0xFF,0x72,0x4B,0xFF,0x22,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x2B,0x2A,0xFF,0x98,0x5C,0xFF,0xF5,0x53,0xFF,0x83,0x08,0xF7,0xE4,0x20,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x21,0x13,0x62,0x08,0xD2,0xCE,0x3A,0xFF,0xB9,0x5C,0xFF,0xB3,0x4B,0xFF,0x83,0x08,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x6D,0x32,0xFF,0x98,0x5C,0xFF,0xF5,0x53,0xFF,0xC4,0x08,0xFB,0xA2,0x10,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x15,0x62,0x08,0xCC,0x6D,0x32,0xFF,0x98,0x5C,0xFF,0x16,0x54,0xFF,0x88,0x21,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,
-    0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x62,0x00,0xFF,0x51,0x43,0xFF,0xB9,0x5C,0xFF,0xB3,0x4B,0xFF,0x83,0x08,0xF8,0xA2,0x18,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x0D,0x62,0x08,0xB1,0xEA,0x21,0xFF,0x36,0x54,0xFF,0x98,0x5C,0xFF,0xF0,0x3A,0xFF,0x42,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xEA,0x29,0xFF,0x36,0x54,0xFF,0xB8,0x5C,0xFF,0x10,0x43,0xFF,
-    0x42,0x00,0xEC,0xA3,0x18,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x31,0x03,0x82,0x10,0x7D,0xC4,0x08,0xFA,0x72,0x43,0xFF,0x98,0x5C,0xFF,0x36,0x54,0xFF,0x8D,0x3A,0xFF,0x42,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xA8,0x21,0xFF,0xB3,0x4B,0xFF,0xB9,0x5C,0xFF,0x16,0x54,0xFF,0xEA,0x29,0xFF,0x41,0x08,0xC3,0xC3,0x18,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x35,0x41,0x08,0xCF,0xCA,0x21,0xFF,0xD4,0x53,0xFF,0xB9,0x5C,0xFF,0x57,0x54,0xFF,0x31,0x43,0xFF,0x88,0x19,0xFF,0x01,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xC4,0x08,0xFF,0x8E,0x32,0xFF,0xF5,0x4B,0xFF,0xB9,0x5C,0xFF,0x57,0x54,0xFF,0xCE,0x3A,0xFF,0x62,0x08,0xF0,0x62,0x10,0x6F,0x86,0x31,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x04,0x82,0x10,0x65,0x41,0x08,0xE1,0xC9,0x21,0xFF,0x93,0x4B,0xFF,0x98,0x54,0xFF,
-    0xB9,0x5C,0xFF,0x57,0x54,0xFF,0x93,0x43,0xFF,0xEF,0x3A,0xFF,0x4C,0x32,0xFF,0xA9,0x21,0xFF,0x47,0x19,0xFF,0x47,0x19,0xFF,0x88,0x21,0xFF,0x0B,0x2A,0xFF,0xAE,0x3A,0xFF,0x51,0x43,0xFF,0xF5,0x53,0xFF,0x98,0x5C,0xFF,0xB9,0x5C,0xFF,0xF5,0x53,0xFF,0xAE,0x3A,0xFF,0x63,0x08,0xF8,0x41,0x08,0x96,0xA3,0x10,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0x06,0x61,0x08,0x5B,0x21,0x08,0xC1,0x83,0x08,0xFD,0x4C,0x32,0xFF,0x71,0x4B,0xFF,0x15,0x54,0xFF,0x98,0x5C,0xFF,0xB9,0x5C,0xFF,0xD9,0x5C,0xFF,0xD9,0x5C,0xFF,0xB9,0x5C,0xFF,0xD9,0x5C,0xFF,0xD9,0x5C,0xFF,0xB9,0x5C,0xFF,0x57,0x54,0xFF,0xB3,0x4B,0xFF,0xEF,0x3A,0xFF,
-    0x47,0x19,0xFF,0x21,0x00,0xE3,0x21,0x08,0x85,0xA3,0x10,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x1F,0x41,0x08,0x69,0x21,0x00,0xAE,0x21,0x00,0xE8,0x42,0x00,0xFE,0x06,0x11,0xFF,0xC9,0x29,0xFF,0x2B,0x32,0xFF,0x2B,0x32,0xFF,0xEA,0x29,0xFF,0x68,0x19,0xFF,0x84,0x08,0xFF,0x21,0x00,0xF6,0x21,0x00,0xC6,0x21,0x00,0x86,0x61,0x08,0x3C,0x45,0x29,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0x01,0xC3,0x18,0x17,0x41,0x08,0x3B,0x61,0x08,0x54,0x41,0x08,0x66,0x20,0x00,0x66,0x41,0x08,0x57,0x41,0x08,0x41,0x82,0x10,0x23,0xE3,0x18,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-};
-const lv_img_dsc_t ui_img_suiicon_png = {
-    .header.always_zero = 0,
-    .header.w = 50,
-    .header.h = 51,
-    .data_size = sizeof(ui_img_suiicon_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-    .data = ui_img_suiicon_png_data
-};
-
@@ -1,66 +0,0 @@
-// This file was generated by SquareLine Studio
-// SquareLine Studio version: SquareLine Studio 1.5.3
-// LVGL version: 8.3.11
-// Project name: SquareLine_Project
-
-#include "ui.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-    #define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-// IMAGE DATA: assets/unlock.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_unlock_png_data[] = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x35,0x0C,0xA3,0x1D,0x52,0xC2,0x15,0x8E,0xC2,0x15,0xB8,0xC1,0x0D,0xC9,0xA1,0x0D,0xCB,0xC2,0x15,0xBE,0xC3,0x1D,0x9A,0xA3,0x1D,0x60,0x65,0x2D,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x25,0x18,0xA2,0x15,0x8E,0xC1,0x0D,0xEF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xE1,0x0D,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xF9,0xA1,0x0D,0xAB,0x62,0x15,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4D,0x01,0xA3,0x1D,0x62,0xC0,0x0D,0xEF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xE1,0x0D,0xFF,0xC0,0x05,0xFF,0xE1,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFB,0xA2,0x15,0x8D,0x25,0x2D,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x35,0x04,0xA2,0x15,0x98,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,
-    0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE1,0x0D,0xFF,0xE1,0x0D,0xFF,0xC1,0x0D,0xFF,0xE1,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xA1,0x0D,0xC6,0x24,0x25,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x35,0x02,0xA2,0x1D,0x9F,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFB,0xA0,0x0D,0xEE,0xC1,0x0D,0xEA,0xC0,0x05,0xF8,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,
-    0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC1,0x0D,0xD0,0x63,0x25,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x15,0x76,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xA1,0x0D,0xBF,0xA3,0x1D,0x55,0x44,0x2D,0x17,0x2C,0x66,0x01,0x00,0x00,0x00,0x65,0x2D,0x0C,0x82,0x15,0x3E,0xA1,0x15,0x9A,0xC0,0x05,0xF7,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xA1,0x0D,0xB1,0x25,0x3D,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x1D,0x2C,0xC0,0x05,0xF7,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC1,0x0D,0xED,0x82,0x15,0x56,0x65,0x3D,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x1D,0x28,0xC1,0x0D,0xC9,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0x82,0x15,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x15,0xB3,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x0D,0xED,0x63,0x25,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x25,0x0C,0xA1,0x0D,0xBC,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC1,0x0D,0xE6,0x65,0x2D,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x25,0x28,0xC0,0x05,0xFC,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFD,0x82,0x1D,0x4B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x25,0x12,0xC1,0x0D,0xE1,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xA2,0x15,0x66,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xC2,0x15,0x81,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xC2,0x15,0xAA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x1D,0x56,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC1,0x0D,0xC3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0x0D,0xC6,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0x84,0x2D,0x39,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x3D,0x05,0xC1,0x0D,0xE0,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFA,0x64,0x25,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x2D,0x05,0xC0,0x0D,0xEC,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE1,0x0D,0xFF,0xA1,0x0D,0xE9,0x86,0x3D,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x15,0x9C,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0x43,0x1D,0x3A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x2D,0x10,0xC0,0x05,0xFD,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE1,0x0D,0xFF,0xC2,0x15,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x0D,0x73,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,
-    0x61,0x15,0x57,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x2D,0x16,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xC1,0x15,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x15,0x6C,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xA1,0x15,0x5E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x35,0x17,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xA1,0x0D,0xB8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x15,0x6C,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xE1,0x0D,0xFF,0xA1,0x15,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x2D,0x17,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC1,0x0D,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x15,0x6C,0xC0,0x05,0xFF,0xE1,0x0D,0xFF,0xE1,0x0D,0xFF,0xC1,0x05,0xFF,0xA2,0x15,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x25,0x2D,0x17,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC1,0x0D,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x15,0x6C,0xC0,0x05,0xFF,0xE1,0x0D,0xFF,0xE1,0x0D,0xFF,0xC0,0x05,0xFF,0x81,0x15,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x2D,0x17,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xA1,0x0D,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x1D,0x6B,0xE0,0x05,0xFF,0xE1,0x0D,0xFF,0xE0,0x0D,0xFF,0xC0,0x05,0xFF,0x81,0x15,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x2D,0x18,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xA1,0x0D,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x1D,0x6A,0xE1,0x0D,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0x80,0x0D,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x17,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC1,0x0D,0xBA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x25,0x43,0xE1,0x0D,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,
-    0xE0,0x05,0xFF,0x62,0x15,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x25,0x15,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xA1,0x0D,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x3C,0x02,0x81,0x15,0x92,0xC0,0x05,0xFA,0xC0,0x05,0xF9,0x81,0x15,0x8A,0xC7,0x3C,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x25,0x0C,0xA2,0x15,0x8C,0xC1,0x0D,0xC9,0xC1,0x05,0xCF,0xC0,0x0D,0xD0,
-    0xC1,0x0D,0xD2,0xC1,0x0D,0xD3,0xC1,0x0D,0xD3,0xC1,0x0D,0xD1,0xC1,0x0D,0xD0,0xC0,0x0D,0xCF,0xC1,0x0D,0xD0,0xC1,0x0D,0xD1,0xC1,0x0D,0xD2,0xC1,0x0D,0xD2,0xC1,0x0D,0xD2,0xC0,0x0D,0xD1,0xC0,0x0D,0xD1,0xA1,0x0D,0xD2,0xC1,0x0D,0xD1,0xE2,0x15,0xD1,0xE2,0x15,0xD2,0xC1,0x0D,0xD3,0xC1,0x0D,0xD2,0xC1,0x0D,0xD1,0xC1,0x0D,0xD4,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xF4,0xC1,0x0D,0xD3,0xC1,0x0D,0xCF,0x82,0x15,0x8A,0x05,0x2D,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x24,0x10,0xE4,0x24,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x0D,0x9F,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,
-    0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0x82,0x15,0x97,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x34,0x03,0xC0,0x05,0xEA,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE1,0x0D,0xFF,0xE1,0x0D,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,
-    0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x0D,0xE2,0x47,0x45,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x34,0x05,0xC0,0x0D,0xEE,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xE1,0x0D,0xFF,0xC0,0x0D,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,
-    0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x0D,0xE6,0xC4,0x2C,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x2C,0x06,0xC0,0x05,0xEF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE1,0x0D,0xFF,0xE1,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xE7,0x84,0x24,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x2C,0x06,0xC0,0x05,0xEF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE1,0x0D,0xFF,0xE1,0x0D,0xFF,0xE1,0x0D,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xE7,0x84,0x2C,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x2C,0x05,0xC0,0x05,0xEF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xC1,0x0D,0xF5,0xC2,0x15,0xA2,0xA1,0x15,0x85,0xA1,0x0D,0xA7,0xC0,0x05,0xF7,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xE6,0xA4,0x2C,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x2C,0x05,0xC0,0x05,0xEF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,
-    0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xE1,0x0D,0xFF,0xA1,0x0D,0xE7,0x61,0x15,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x1D,0x33,0xC0,0x05,0xEC,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xE6,0x84,0x2C,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x2C,0x05,0xC0,0x05,0xEF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE1,0x05,0xFF,
-    0xE1,0x0D,0xFF,0x82,0x1D,0x57,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x0D,0x69,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xA0,0x05,0xE5,0x85,0x2C,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x23,0x05,0xC0,0x05,0xEF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xE1,0x0D,0xFF,0xE1,0x05,0xFF,0xA0,0x05,0xFB,0x24,0x1D,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x1D,0x22,0xE0,0x05,0xFD,
-    0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xC1,0x0D,0xE4,0x65,0x2C,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x23,0x05,0xC0,0x05,0xEF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE1,0x0D,0xFF,0xC1,0x0D,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFC,0x43,0x25,0x1A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x1D,0x27,0xC0,0x05,0xFE,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,
-    0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC1,0x0D,0xE3,0x66,0x34,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0x23,0x05,0xC0,0x05,0xEE,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xE1,0x0D,0xFF,0xE1,0x05,0xFF,0xE1,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0x81,0x15,0x6D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x15,0x7C,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE1,0x0D,0xFF,0xC1,0x0D,0xE3,0x86,0x34,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC5,0x23,0x05,0xC0,0x05,0xEE,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x0D,0xFF,0xE1,0x0D,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xF2,0x82,0x15,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x0D,0x51,0xC0,0x05,0xF5,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xC1,0x0D,0xE4,0x85,0x34,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0x23,0x05,0xC0,0x05,0xEE,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE1,0x0D,0xFF,0xC0,0x0D,0xFF,0xE1,0x0D,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x0D,0xEC,0xCE,0x7E,0x01,0x00,0x00,0x00,0xA6,0x3C,0x05,0xC0,0x05,0xF5,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xE1,0x0D,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xA0,0x05,0xE4,0x64,0x34,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC5,0x23,0x05,0xC0,0x05,0xEE,0xE0,0x05,0xFF,0xE0,0x05,0xFF,
-    0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE1,0x0D,0xFF,0xE1,0x0D,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xEF,0xE9,0x55,0x02,0x00,0x00,0x00,0x86,0x34,0x07,0xC0,0x05,0xF8,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE1,0x0D,0xFF,0xE1,0x0D,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xE4,0x64,0x24,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0x23,0x05,0xC0,0x05,0xEE,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,
-    0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xF0,0xA6,0x45,0x02,0x00,0x00,0x00,0x85,0x2C,0x08,0xC0,0x05,0xF8,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xE1,0x0D,0xFF,0xC1,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xE5,0xA4,0x24,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0x23,0x05,0xC0,0x05,0xEE,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xEF,0x88,0x4D,0x02,0x00,0x00,0x00,0x85,0x2C,0x08,0xC0,0x05,0xF8,0xE0,0x05,0xFF,
-    0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE1,0x05,0xFF,0xE1,0x05,0xFF,0xE1,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xE5,0x64,0x2C,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x23,0x05,0xC0,0x05,0xEF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xEF,0xE8,0x4D,0x02,0x00,0x00,0x00,0xC6,0x34,0x07,0xC0,0x05,0xF8,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE1,0x0D,0xFF,0xE1,0x0D,0xFF,0xE1,0x0D,0xFF,0xE0,0x05,0xFF,
-    0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xE5,0x84,0x2C,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x24,0x05,0xC0,0x05,0xEF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xF4,0x65,0x35,0x09,0x00,0x00,0x00,0x04,0x25,0x10,0xC0,0x05,0xFA,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xE1,0x05,0xFF,0xE1,0x0D,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xE6,0xC5,0x34,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x2C,0x06,0xC0,0x05,0xF0,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xA2,0x0D,0x9F,0x42,0x15,0x41,0xA1,0x0D,0xA8,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE1,0x0D,0xFF,0xC1,0x0D,0xFF,0xE1,0x0D,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xE6,0xA5,0x34,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x2C,0x06,0xC0,0x05,0xF0,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x0D,0xFF,0xE1,0x0D,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xE7,0xE4,0x2C,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x2C,0x06,0xC0,0x05,0xF0,0xE0,0x05,0xFF,
-    0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xE7,0xC4,0x2C,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x2C,0x06,0xC0,0x05,0xEF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,
-    0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xFF,0xC0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xE6,0xC4,0x34,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x2C,0x04,0xC0,0x05,0xEE,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,
-    0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xC0,0x05,0xE5,0x26,0x3D,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x0D,0xC0,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,
-    0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xE0,0x05,0xFF,0xA1,0x0D,0xB3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x15,0x28,0xC1,0x05,0xCA,0xC0,0x05,0xFC,0xC0,0x05,0xFC,0xC0,0x05,0xFD,0xC0,0x05,0xFD,0xC0,0x05,0xFD,0xC0,0x05,0xFD,0xC0,0x05,0xFD,0xC0,0x05,0xFD,0xC0,0x05,0xFC,0xC0,0x05,0xFC,0xC0,0x05,0xFC,0xC0,0x05,0xFC,0xC0,0x05,0xFC,0xC0,0x05,0xFC,0xC0,0x05,0xFC,0xC0,0x05,0xFC,0xC0,0x05,0xFC,0xC0,0x05,0xFC,0xC0,0x05,0xFC,0xC0,0x05,0xFC,0xC0,0x05,0xFD,0xC0,0x05,0xFD,0xC0,0x05,0xFD,0xC0,0x05,0xFD,0xC0,0x05,0xFD,0xC0,0x05,0xFD,0xC0,0x05,0xFD,0xC0,0x05,0xFD,0xC0,0x05,0xFD,0xC0,0x05,0xFC,0xC0,0x05,0xFA,0xA1,0x0D,0xC0,0x43,0x1D,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x25,0x01,0x25,0x2D,0x0B,0x04,0x2D,0x0C,0xE4,0x24,0x0C,0xE4,0x24,0x0D,0x04,0x25,0x0D,0x04,0x25,0x0D,0x04,0x25,0x0D,0x04,0x25,0x0C,0x04,0x25,0x0C,0x04,0x25,0x0C,0x25,0x35,0x0C,0x05,0x35,0x0C,0x25,0x2D,0x0C,0x05,0x2D,0x0C,0x05,0x2D,0x0C,0x05,0x2D,0x0C,0xE5,0x2C,0x0C,0xE5,0x2C,0x0C,0x05,0x2D,0x0C,0x04,0x2D,0x0C,0xE4,0x24,0x0C,0x04,0x25,0x0C,0x04,0x25,0x0C,0x04,0x25,0x0D,0x04,0x25,0x0C,0x04,0x25,0x0C,0x04,0x25,0x0C,0x04,0x2D,0x0C,0x25,0x35,0x0C,0x25,0x35,0x0C,0x65,0x35,0x09,0xC4,0x24,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-};
-const lv_img_dsc_t ui_img_unlock_png = {
-    .header.always_zero = 0,
-    .header.w = 55,
-    .header.h = 50,
-    .data_size = sizeof(ui_img_unlock_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-    .data = ui_img_unlock_png_data
-};
-
@@ -53,6 +53,26 @@ export class CryptoManager {
         }
     }
 
+    /**
+     * Verify Ed25519 signature over raw bytes (binary wire format)
+     * @param {Uint8Array} data - Signed bytes (hashed with SHA-256 before verification)
+     * @param {string} signatureHex - Signature in hex format
+     * @param {string} publicKeyHex - Public key in hex format
+     * @returns {boolean} True if signature is valid
+     */
+    verifyBytesSignature(data, signatureHex, publicKeyHex) {
+        try {
+            const hash = crypto.createHash('sha256').update(data).digest();
+            const signature = this.hexToBytes(signatureHex);
+            const publicKey = this.hexToBytes(publicKeyHex);
+
+            return nacl.sign.detached.verify(hash, signature, publicKey);
+        } catch (error) {
+            console.error('✗ Signature verification error:', error.message);
+            return false;
+        }
+    }
+
     /**
      * Build canonical JSON for signing
      * Ensures deterministic serialization
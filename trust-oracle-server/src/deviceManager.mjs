@@ -91,6 +91,28 @@ export class DeviceManager {
             )
         `);
 
+        // Step batches (one signed Merkle root per batch of windows)
+        await this.db.exec(`
+            CREATE TABLE IF NOT EXISTS step_batches (
+                root TEXT PRIMARY KEY,
+                device_id TEXT NOT NULL,
+                window_count INTEGER NOT NULL,
+                total_steps INTEGER NOT NULL,
+                signature TEXT NOT NULL,
+                received_at INTEGER NOT NULL,
+                FOREIGN KEY (device_id) REFERENCES devices(device_id)
+            )
+        `);
+
+        // Migration: batch membership + inclusion proof per step_data row
+        for (const column of ['batch_root TEXT', 'leaf_index INTEGER', 'proof TEXT']) {
+            try {
+                await this.db.exec(`ALTER TABLE step_data ADD COLUMN ${column}`);
+            } catch (error) {
+                // Column already exists
+            }
+        }
+
         // Create indexes
         await this.db.exec(`
             CREATE INDEX IF NOT EXISTS idx_step_data_device ON step_data(device_id);
@@ -204,22 +226,91 @@ export class DeviceManager {
         return result.lastID;
     }
 
+    /**
+     * Store a verified step batch: one row per window, each with its
+     * inclusion proof against the batch root
+     */
+    async storeStepBatch(deviceId, batch) {
+        const { root, signature, windows } = batch;
+        const now = Date.now();
+        const totalSteps = windows.reduce((sum, w) => sum + w.stepCount, 0);
+
+        await this.db.run(
+            `INSERT INTO step_batches (root, device_id, window_count, total_steps, signature, received_at)
+             VALUES (?, ?, ?, ?, ?, ?)`,
+            [root, deviceId, windows.length, totalSteps, signature, now]
+        );
+
+        for (let i = 0; i < windows.length; i++) {
+            const w = windows[i];
+            await this.db.run(
+                `INSERT INTO step_data (
+                    device_id, step_count, timestamp, raw_samples,
+                    battery_percent, signature, verified, received_at,
+                    batch_root, leaf_index, proof
+                ) VALUES (?, ?, ?, ?, ?, ?, 1, ?, ?, ?, ?)`,
+                [
+                    deviceId,
+                    w.stepCount,
+                    w.timestamp,
+                    JSON.stringify(w.rawAccSamples || []),
+                    w.batteryPercent ?? 100,
+                    signature,
+                    now,
+                    root,
+                    i,
+                    JSON.stringify(w.proof)
+                ]
+            );
+        }
+
+        await this.db.run(
+            `UPDATE devices
+             SET total_steps = total_steps + ?,
+                 last_seen = ?
+             WHERE device_id = ?`,
+            [totalSteps, now, deviceId]
+        );
+
+        console.log(`✓ Step batch stored: ${deviceId} (${windows.length} windows, ${totalSteps} steps)`);
+        return totalSteps;
+    }
+
+    /**
+     * Get one batched window with everything needed to verify it alone
+     */
+    async getBatchWindow(root, leafIndex) {
+        const batch = await this.db.get(`SELECT * FROM step_batches WHERE root = ?`, [root]);
+        if (!batch) return null;
+
+        const window = await this.db.get(
+            `SELECT * FROM step_data WHERE batch_root = ? AND leaf_index = ?`,
+            [root, leafIndex]
+        );
+        if (!window) return null;
+
+        return { batch, window };
+    }
+
     /**
      * Get pending step data (not submitted to blockchain)
      */
     async getPendingStepData(deviceId = null) {
+        // Batched windows carry their batch's window count (part of the signed bytes)
         let sql = `
-            SELECT * FROM step_data
-            WHERE submitted_to_chain = 0 AND verified = 1
+            SELECT step_data.*, step_batches.window_count AS batch_window_count
+            FROM step_data
+            LEFT JOIN step_batches ON step_batches.root = step_data.batch_root
+            WHERE step_data.submitted_to_chain = 0 AND step_data.verified = 1
         `;
         const params = [];
 
         if (deviceId) {
-            sql += ` AND device_id = ?`;
+            sql += ` AND step_data.device_id = ?`;
             params.push(deviceId);
         }
 
-        sql += ` ORDER BY received_at ASC`;
+        sql += ` ORDER BY step_data.received_at ASC`;
 
         return await this.db.all(sql, params);
     }
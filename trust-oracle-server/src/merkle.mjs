@@ -0,0 +1,116 @@
+/**
+ * Step Batch Merkle Commitments
+ * Mirrors the ESP32 StepBatch encoding so a batch root signed once on the
+ * device can be recomputed here, and each window proven on its own.
+ *
+ * Leaf bytes (little-endian):
+ *   stepCount u32 | timestamp u64 | batteryPercent u8 | sampleCount u8 | samples (int16 x3 each)
+ * leaf = SHA-256(0x00 | leaf bytes), node = SHA-256(0x01 | left | right)
+ * An unpaired node is promoted to the next level unchanged.
+ */
+
+import crypto from 'crypto';
+
+const LEAF_PREFIX = Buffer.from([0x00]);
+const NODE_PREFIX = Buffer.from([0x01]);
+
+function sha256(...parts) {
+    const hash = crypto.createHash('sha256');
+    for (const part of parts) hash.update(part);
+    return hash.digest();
+}
+
+/**
+ * Serialize one window exactly like the firmware
+ * @param {object} window - { stepCount, timestamp, batteryPercent, samples: Buffer }
+ * @returns {Buffer} Leaf bytes
+ */
+export function encodeLeaf(window) {
+    const samples = Buffer.from(window.samples || []);
+    const header = Buffer.alloc(14);
+    header.writeUInt32LE(window.stepCount >>> 0, 0);
+    header.writeBigUInt64LE(BigInt(window.timestamp), 4);
+    header.writeUInt8(window.batteryPercent ?? 100, 12);
+    header.writeUInt8(Math.floor(samples.length / 6), 13);
+    return Buffer.concat([header, samples]);
+}
+
+export function leafHash(window) {
+    return sha256(LEAF_PREFIX, encodeLeaf(window));
+}
+
+function nodeHash(left, right) {
+    return sha256(NODE_PREFIX, left, right);
+}
+
+/**
+ * Build every level of the tree (levels[0] = leaf hashes)
+ */
+function buildLevels(leaves) {
+    const levels = [leaves];
+    while (levels[levels.length - 1].length > 1) {
+        const level = levels[levels.length - 1];
+        const next = [];
+        for (let i = 0; i < level.length; i += 2) {
+            next.push(i + 1 < level.length ? nodeHash(level[i], level[i + 1]) : level[i]);
+        }
+        levels.push(next);
+    }
+    return levels;
+}
+
+/**
+ * Merkle root of a list of windows
+ * @returns {Buffer} 32-byte root
+ */
+export function merkleRoot(windows) {
+    if (windows.length === 0) return Buffer.alloc(32);
+    const levels = buildLevels(windows.map(leafHash));
+    return levels[levels.length - 1][0];
+}
+
+/**
+ * Inclusion proof for one window
+ * @returns {Array} [{ hash: hex, left: bool }] from leaf level upwards
+ */
+export function inclusionProof(windows, index) {
+    const levels = buildLevels(windows.map(leafHash));
+    const proof = [];
+
+    for (let depth = 0; depth < levels.length - 1; depth++) {
+        const level = levels[depth];
+        const sibling = index ^ 1;
+        if (sibling < level.length) {
+            proof.push({ hash: level[sibling].toString('hex'), left: sibling < index });
+        }
+        // Unpaired nodes are promoted without a proof step
+        index = Math.floor(index / 2);
+    }
+
+    return proof;
+}
+
+/**
+ * Verify a window against a root
+ * @param {object} window - Window record
+ * @param {Array} proof - From inclusionProof()
+ * @param {Buffer|string} root - Expected root (Buffer or hex)
+ */
+export function verifyInclusion(window, proof, root) {
+    let hash = leafHash(window);
+    for (const step of proof) {
+        const sibling = Buffer.from(step.hash, 'hex');
+        hash = step.left ? nodeHash(sibling, hash) : nodeHash(hash, sibling);
+    }
+    const expected = Buffer.isBuffer(root) ? root : Buffer.from(root.replace(/^0x/, ''), 'hex');
+    return hash.equals(expected);
+}
+
+/**
+ * Bytes the device signs for a batch: root | windowCount u16 LE | deviceId
+ */
+export function batchCommitment(root, windowCount, deviceId) {
+    const count = Buffer.alloc(2);
+    count.writeUInt16LE(windowCount, 0);
+    return Buffer.concat([root, count, Buffer.from(deviceId, 'utf8')]);
+}
@@ -9,6 +9,12 @@ import Database from 'better-sqlite3';
 import path from 'path';
 import { fileURLToPath } from 'url';
 
+// Stat columns the device may sync as a delta
+export const SYNC_FIELDS = [
+    'happiness', 'hunger', 'health', 'experience',
+    'total_steps_fed', 'level', 'food', 'energy'
+];
+
 const __filename = fileURLToPath(import.meta.url);
 const __dirname = path.dirname(__filename);
 
@@ -88,6 +94,18 @@ export class PetManager {
             console.log('✓ Food and energy columns added');
         }
 
+        // Migration: Add sync version columns for delta pet sync
+        try {
+            this.db.prepare('SELECT version, field_versions FROM pets LIMIT 1').get();
+        } catch (error) {
+            console.log('🔄 Adding sync version columns...');
+            this.db.exec(`
+                ALTER TABLE pets ADD COLUMN version INTEGER DEFAULT 0;
+                ALTER TABLE pets ADD COLUMN field_versions TEXT DEFAULT '{}';
+            `);
+            console.log('✓ Sync version columns added');
+        }
+
         // Migration: Fix NULL values in food and energy columns
         const nullResourcePets = this.db.prepare(
             'SELECT COUNT(*) as count FROM pets WHERE food IS NULL OR energy IS NULL'
@@ -134,11 +152,72 @@ export class PetManager {
         return this.db.prepare('SELECT * FROM pets WHERE device_id = ?').get(deviceId);
     }
 
+    // Bump the pet version and stamp the changed fields with it, so a
+    // device delta based on an older version can detect the conflict
+    bumpFieldVersions(petId, fields) {
+        const pet = this.db.prepare('SELECT version, field_versions FROM pets WHERE pet_id = ?').get(petId);
+        if (!pet) return 0;
+
+        const version = (pet.version || 0) + 1;
+        const fieldVersions = JSON.parse(pet.field_versions || '{}');
+        for (const field of fields) {
+            fieldVersions[field] = version;
+        }
+
+        this.db.prepare(`
+            UPDATE pets SET version = ?, field_versions = ? WHERE pet_id = ?
+        `).run(version, JSON.stringify(fieldVersions), petId);
+
+        return version;
+    }
+
+    // Apply a device delta against the version it was based on
+    // Returns { version, conflicts, changed } - conflicts maps field -> server value
+    applyPetDelta(petId, baseVersion, delta) {
+        const apply = this.db.transaction(() => {
+            const pet = this.db.prepare('SELECT * FROM pets WHERE pet_id = ?').get(petId);
+            if (!pet) return null;
+
+            const fieldVersions = JSON.parse(pet.field_versions || '{}');
+            const conflicts = {};
+            const accepted = {};
+
+            for (const field of SYNC_FIELDS) {
+                if (delta[field] === undefined || delta[field] === pet[field]) continue;
+
+                // Changed on the server after the device's base version: server wins
+                if ((fieldVersions[field] || 0) > baseVersion) {
+                    conflicts[field] = pet[field];
+                } else {
+                    accepted[field] = delta[field];
+                }
+            }
+
+            const fields = Object.keys(accepted);
+            if (fields.length === 0) {
+                return { version: pet.version || 0, conflicts, changed: [] };
+            }
+
+            const assignments = fields.map(field => `${field} = ?`).join(', ');
+            this.db.prepare(`
+                UPDATE pets
+                SET ${assignments},
+                    last_updated_at = CURRENT_TIMESTAMP
+                WHERE pet_id = ?
+            `).run(...fields.map(field => accepted[field]), petId);
+
+            const version = this.bumpFieldVersions(petId, fields);
+            return { version, conflicts, changed: fields };
+        });
+
+        return apply();
+    }
+
     // Update pet stats
     updatePetStats(petId, stats) {
         const { happiness, hunger, health, experience, total_steps_fed, level, food, energy } = stats;
 
-        return this.db.prepare(`
+        const result = this.db.prepare(`
             UPDATE pets
             SET happiness = ?, hunger = ?, health = ?,
                 experience = ?, total_steps_fed = ?, level = ?,
@@ -146,16 +225,22 @@ export class PetManager {
                 last_updated_at = CURRENT_TIMESTAMP
             WHERE pet_id = ?
         `).run(happiness, hunger, health, experience, total_steps_fed, level, food, energy, petId);
+
+        this.bumpFieldVersions(petId, SYNC_FIELDS);
+        return result;
     }
 
     // Update pet resources (absolute values)
     updatePetResources(petId, food, energy) {
-        return this.db.prepare(`
+        const result = this.db.prepare(`
             UPDATE pets
             SET food = ?, energy = ?,
                 last_updated_at = CURRENT_TIMESTAMP
             WHERE pet_id = ?
         `).run(food, energy, petId);
+
+        this.bumpFieldVersions(petId, ['food', 'energy']);
+        return result;
     }
 
     // Add pet resources (relative values)
@@ -166,12 +251,15 @@ export class PetManager {
         const newFood = pet.food + foodToAdd;
         const newEnergy = pet.energy + energyToAdd;
 
-        return this.db.prepare(`
+        const result = this.db.prepare(`
             UPDATE pets
             SET food = ?, energy = ?,
                 last_updated_at = CURRENT_TIMESTAMP
             WHERE pet_id = ?
         `).run(newFood, newEnergy, petId);
+
+        this.bumpFieldVersions(petId, ['food', 'energy']);
+        return result;
     }
 
     // Feed pet (old version with steps - kept for backwards compatibility)
@@ -203,6 +291,7 @@ export class PetManager {
                 last_updated_at = CURRENT_TIMESTAMP
             WHERE pet_id = ?
         `).run(newHunger, newHappiness, newTotalSteps, newExperience, newLevel, petId);
+        this.bumpFieldVersions(petId, ['hunger', 'happiness', 'total_steps_fed', 'experience', 'level']);
 
         // Log event
         this.logPetEvent(petId, 'fed', { steps, nutrition, newLevel });
@@ -244,6 +333,7 @@ export class PetManager {
                 last_updated_at = CURRENT_TIMESTAMP
             WHERE pet_id = ?
         `).run(newFood, newHunger, newHappiness, newExperience, newLevel, petId);
+        this.bumpFieldVersions(petId, ['food', 'hunger', 'happiness', 'experience', 'level']);
 
         // Log event
         this.logPetEvent(petId, 'fed', { foodUsed: 1, xpGained: 10, newLevel });
@@ -270,6 +360,7 @@ export class PetManager {
                 last_updated_at = CURRENT_TIMESTAMP
             WHERE pet_id = ?
         `).run(newHappiness, petId);
+        this.bumpFieldVersions(petId, ['happiness']);
 
         this.logPetEvent(petId, 'played', { newHappiness });
 
@@ -298,6 +389,7 @@ export class PetManager {
                 last_updated_at = CURRENT_TIMESTAMP
             WHERE pet_id = ?
         `).run(newEnergy, newHappiness, newHealth, newExperience, petId);
+        this.bumpFieldVersions(petId, ['energy', 'happiness', 'health', 'experience']);
 
         this.logPetEvent(petId, 'played', { energyUsed: 1, xpGained: 5, hpGained: 3 });
 
@@ -349,7 +441,8 @@ export class PetManager {
             newHealth = Math.min(100, pet.health + 1);
         }
 
-        // Update if changed
+        // Update if changed (decay is derived, so it does not bump the sync
+        // version - the device runs the same decay and stays authoritative)
         if (newHunger !== pet.hunger || newHappiness !== pet.happiness || newHealth !== pet.health) {
             this.db.prepare(`
                 UPDATE pets
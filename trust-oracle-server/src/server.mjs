@@ -16,7 +16,18 @@ import cron from 'node-cron';
 import { DeviceManager } from './deviceManager.mjs';
 import { cryptoManager } from './cryptoManager.mjs';
 import { SuiClient } from './suiClient.mjs';
-import { PetManager } from './petManager.mjs';
+import { PetManager, SYNC_FIELDS } from './petManager.mjs';
+import { SubscriptionManager } from './subscriptionManager.mjs';
+import { merkleRoot, inclusionProof, verifyInclusion, batchCommitment } from './merkle.mjs';
+import {
+    CODEC_JSON,
+    CODEC_MSGPACK,
+    SUPPORTED_CODECS,
+    decodeMessage,
+    decodeMsgPack,
+    encodeMessage,
+    unpackAccSamples
+} from './wireCodec.mjs';
 
 // Load environment variables
 dotenv.config();
@@ -35,6 +46,10 @@ const SUI_PRIVATE_KEY = process.env.SUI_PRIVATE_KEY;
 let deviceManager;
 let petManager;
 let suiClient;
+let subscriptionManager;
+
+// Latest link-quality report per device (metrics message), in memory only
+const linkMetrics = new Map();
 
 // Initialize services
 async function initializeServices() {
@@ -64,6 +79,9 @@ async function initializeServices() {
         if (!SUI_PRIVATE_KEY) console.warn('   Missing: SUI_PRIVATE_KEY');
         console.warn('   Backend will work in LOCAL MODE (no blockchain submissions)');
     }
+
+    // Push subscriptions (pet object + wallet) need the Sui client
+    subscriptionManager = new SubscriptionManager(suiClient, send);
 }
 
 // Middleware
@@ -82,17 +100,42 @@ console.log(`\n🌐 WebSocket server listening on port ${WS_PORT}`);
 // WebSocket Handler
 // =======================
 
+/**
+ * Send a message using the codec negotiated for this connection
+ */
+function send(ws, message) {
+    if (ws.codec === CODEC_MSGPACK) {
+        ws.send(encodeMessage(CODEC_MSGPACK, message), { binary: true });
+    } else {
+        ws.send(encodeMessage(CODEC_JSON, message));
+    }
+}
+
+/**
+ * Convert raw byte fields from binary frames to the hex strings used by the JSON protocol
+ */
+function normalizeBinaryMessage(message) {
+    if (message.publicKey instanceof Uint8Array) {
+        message.publicKey = '0x' + Buffer.from(message.publicKey).toString('hex');
+    }
+    return message;
+}
+
 wss.on('connection', (ws, req) => {
     const clientIp = req.socket.remoteAddress;
     console.log(`\n📡 New WebSocket connection from ${clientIp}`);
 
     let deviceId = null;
     let authenticated = false;
+    ws.codec = CODEC_JSON;
 
-    ws.on('message', async (data) => {
+    ws.on('message', async (data, isBinary) => {
         let message = null;
         try {
-            message = JSON.parse(data.toString());
+            message = decodeMessage(data, isBinary);
+            if (isBinary) {
+                normalizeBinaryMessage(message);
+            }
             console.log(`📨 Received message type: ${message.type} from deviceId: ${deviceId || 'not set yet'}`);
 
             // Handle different message types
@@ -111,29 +154,64 @@ wss.on('connection', (ws, req) => {
 
                 case 'step_data':
                     if (!authenticated) {
-                        ws.send(JSON.stringify({
+                        send(ws, {
                             type: 'error',
                             error: 'Not authenticated'
-                        }));
+                        });
                         return;
                     }
                     await handleStepData(ws, message, deviceId);
                     break;
 
+                case 'subscribe':
+                    if (!authenticated) {
+                        send(ws, {
+                            type: 'error',
+                            error: 'Not authenticated'
+                        });
+                        return;
+                    }
+                    await handleSubscribe(ws, message, deviceId);
+                    break;
+
+                case 'step_batch':
+                    if (!authenticated) {
+                        send(ws, {
+                            type: 'error',
+                            error: 'Not authenticated'
+                        });
+                        return;
+                    }
+                    await handleStepBatch(ws, message, deviceId);
+                    break;
+
                 case 'ping':
-                    ws.send(JSON.stringify({
+                    // Echo seq so the device can match the reply and measure RTT
+                    send(ws, {
                         type: 'pong',
+                        seq: message.seq,
                         timestamp: Date.now()
-                    }));
+                    });
+                    break;
+
+                case 'metrics':
+                    if (!authenticated) {
+                        send(ws, {
+                            type: 'error',
+                            error: 'Not authenticated'
+                        });
+                        return;
+                    }
+                    handleMetrics(message, deviceId);
                     break;
 
                 // Virtual Pet messages - require authentication
                 case 'getPet':
                     if (!authenticated) {
-                        ws.send(JSON.stringify({
+                        send(ws, {
                             type: 'error',
                             error: 'Not authenticated'
-                        }));
+                        });
                         return;
                     }
                     await handleGetPet(ws, message, deviceId);
@@ -141,10 +219,10 @@ wss.on('connection', (ws, req) => {
 
                 case 'updatePet':
                     if (!authenticated) {
-                        ws.send(JSON.stringify({
+                        send(ws, {
                             type: 'error',
                             error: 'Not authenticated'
-                        }));
+                        });
                         return;
                     }
                     await handleUpdatePet(ws, message, deviceId);
@@ -152,10 +230,10 @@ wss.on('connection', (ws, req) => {
 
                 case 'claimResources':
                     if (!authenticated) {
-                        ws.send(JSON.stringify({
+                        send(ws, {
                             type: 'error',
                             error: 'Not authenticated'
-                        }));
+                        });
                         return;
                     }
                     await handleClaimResources(ws, message, deviceId);
@@ -163,10 +241,10 @@ wss.on('connection', (ws, req) => {
 
                 case 'feedPet':
                     if (!authenticated) {
-                        ws.send(JSON.stringify({
+                        send(ws, {
                             type: 'error',
                             error: 'Not authenticated'
-                        }));
+                        });
                         return;
                     }
                     await handleFeedPet(ws, message, deviceId);
@@ -174,35 +252,36 @@ wss.on('connection', (ws, req) => {
 
                 case 'playWithPet':
                     if (!authenticated) {
-                        ws.send(JSON.stringify({
+                        send(ws, {
                             type: 'error',
                             error: 'Not authenticated'
-                        }));
+                        });
                         return;
                     }
                     await handlePlayWithPet(ws, message, deviceId);
                     break;
 
                 default:
-                    ws.send(JSON.stringify({
+                    send(ws, {
                         type: 'error',
                         error: 'Unknown message type'
-                    }));
+                    });
             }
 
         } catch (error) {
-            console.error(`❌ WebSocket message error (type: ${message.type || 'unknown'}):`, error.message);
+            console.error(`❌ WebSocket message error (type: ${message?.type || 'unknown'}):`, error.message);
             console.error(`   Stack trace:`, error.stack);
-            ws.send(JSON.stringify({
+            send(ws, {
                 type: 'error',
                 error: error.message
-            }));
+            });
         }
     });
 
     ws.on('close', () => {
         if (deviceId) {
             deviceManager.unregisterConnection(deviceId);
+            subscriptionManager.unsubscribe(deviceId, ws);
         }
         console.log(`📡 WebSocket closed: ${deviceId || 'unknown'}`);
     });
@@ -212,13 +291,102 @@ wss.on('connection', (ws, req) => {
     });
 
     // Send welcome message
-    ws.send(JSON.stringify({
+    send(ws, {
         type: 'welcome',
         message: 'Connected to Trust Oracle Server',
+        codecs: SUPPORTED_CODECS,
         timestamp: Date.now()
-    }));
+    });
 });
 
+/**
+ * Handle a device link-quality report (RTT, reconnects, keepalive)
+ * No reply - the device sends these on its own schedule.
+ */
+const LINK_METRIC_FIELDS = [
+    'connects', 'disconnects', 'txBytes', 'rxBytes', 'pings', 'pongsMissed',
+    'rttLastMs', 'rttP50Ms', 'rttP95Ms', 'keepaliveMs', 'natTimeoutMs',
+    'authMs', 'outageMs', 'signAvgUs', 'signMaxUs', 'failovers',
+    'txQueueMax', 'txQueueMaxBytes', 'txCoalesced', 'txRejected', 'txHeapAllocs',
+    'txWaitInteractiveMs', 'txWaitTelemetryMs', 'txWaitBulkMs', 'txWaitMaxMs',
+    'wifiTimeToIpMs', 'wifiFastConnects', 'wifiConnects', 'wifiDrops',
+    'loopUiPct', 'loopNetPct', 'loopSensorPct', 'stackUiFree', 'stackNetFree', 'stackSensorFree',
+    'profilerPpm', 'uptimeMs'
+];
+
+// Server the device is connected to: host as stored on the watch (up to 63
+// characters, hostname or IPv4) and its port
+const ENDPOINT_HOST = /^[A-Za-z0-9.-]{1,63}$/;
+
+function readEndpoint(message, metrics) {
+    if (typeof message.endpoint === 'string' && ENDPOINT_HOST.test(message.endpoint)) {
+        metrics.endpoint = message.endpoint;
+    }
+    const port = message.endpointPort;
+    if (Number.isInteger(port) && port >= 1 && port <= 65535) {
+        metrics.endpointPort = port;
+    }
+}
+
+// spans: { name: [count, p50Us, p99Us, maxUs] } from the firmware profiler
+function readSpans(spans) {
+    if (!spans || typeof spans !== 'object' || Array.isArray(spans)) return undefined;
+    const out = {};
+    for (const [name, values] of Object.entries(spans)) {
+        if (Array.isArray(values) && values.length === 4 && values.every(Number.isFinite)) {
+            out[name] = values;
+        }
+    }
+    return out;
+}
+
+function handleMetrics(message, deviceId) {
+    const metrics = { receivedAt: Date.now() };
+    for (const field of LINK_METRIC_FIELDS) {
+        if (Number.isFinite(message[field])) {
+            metrics[field] = message[field];
+        }
+    }
+    readEndpoint(message, metrics);
+    const spans = readSpans(message.spans);
+    if (spans) {
+        metrics.spans = spans;
+    }
+    linkMetrics.set(deviceId, metrics);
+
+    console.log(`📶 Link ${deviceId}: rtt p50 ${metrics.rttP50Ms}ms p95 ${metrics.rttP95Ms}ms, ` +
+                `${metrics.disconnects} drops, keepalive ${Math.round((metrics.keepaliveMs || 0) / 1000)}s`);
+}
+
+/**
+ * Handle push subscription to the device's pet object and wallet
+ * Replies with the current snapshot; later changes arrive as
+ * pet_changed / balance_changed. push=false means keep polling (local mode).
+ */
+async function handleSubscribe(ws, message, deviceId) {
+    try {
+        const snapshot = await subscriptionManager.subscribe(deviceId, ws, {
+            petObjectId: message.petObjectId,
+            wallet: message.wallet
+        });
+
+        send(ws, {
+            type: 'subscribed',
+            success: true,
+            push: subscriptionManager.enabled,
+            pet: snapshot.pet,
+            balanceMist: snapshot.balanceMist
+        });
+    } catch (error) {
+        send(ws, {
+            type: 'subscribed',
+            success: false,
+            push: false,
+            error: error.message
+        });
+    }
+}
+
 /**
  * Handle device registration
  */
@@ -243,21 +411,27 @@ async function handleRegister(ws, message) {
             }
         }
 
-        ws.send(JSON.stringify({
+        // Binary wire format is opt-in; the response itself still uses the old codec
+        const codec = SUPPORTED_CODECS.includes(message.codec) ? message.codec : CODEC_JSON;
+
+        send(ws, {
             type: 'register_response',
             success: true,
             device,
-            blockchainResult
-        }));
+            blockchainResult,
+            codec
+        });
+
+        ws.codec = codec;
 
-        console.log(`✅ Device registered: ${deviceId}`);
+        console.log(`✅ Device registered: ${deviceId} (wire: ${codec})`);
 
     } catch (error) {
-        ws.send(JSON.stringify({
+        send(ws, {
             type: 'register_response',
             success: false,
             error: error.message
-        }));
+        });
     }
 }
 
@@ -286,22 +460,22 @@ async function handleAuthenticate(ws, message) {
             authenticatedAt: Date.now()
         });
 
-        ws.send(JSON.stringify({
+        send(ws, {
             type: 'auth_response',
             success: true,
             deviceId
-        }));
+        });
 
         console.log(`✅ Device authenticated: ${deviceId}`);
 
         return { success: true, deviceId };
 
     } catch (error) {
-        ws.send(JSON.stringify({
+        send(ws, {
             type: 'auth_response',
             success: false,
             error: error.message
-        }));
+        });
 
         return { success: false, error: error.message };
     }
@@ -312,6 +486,11 @@ async function handleAuthenticate(ws, message) {
  */
 async function handleStepData(ws, message, authenticatedDeviceId) {
     try {
+        // Binary frames carry the signed MessagePack body as raw bytes
+        if (message.body instanceof Uint8Array) {
+            return await handleBinaryStepData(ws, message, authenticatedDeviceId);
+        }
+
         const { deviceId, stepCount, timestamp, batteryPercent, rawAccSamples, firmwareVersion, signature } = message;
 
         // Verify deviceId matches authenticated session
@@ -353,41 +532,186 @@ async function handleStepData(ws, message, authenticatedDeviceId) {
             throw new Error('Invalid signature');
         }
 
-        // Store step data
-        const dataId = deviceManager.storeStepData(deviceId, {
+        await acceptStepData(ws, deviceId, {
             stepCount,
             timestamp,
             rawAccSamples,
             batteryPercent,
-            signature,
-            verified: true
+            firmwareVersion,
+            signature
         });
 
-        // Update firmware version
-        if (firmwareVersion) {
-            deviceManager.updateFirmwareVersion(deviceId, `v${Math.floor(firmwareVersion / 100)}.${firmwareVersion % 100}`);
+    } catch (error) {
+        send(ws, {
+            type: 'step_data_response',
+            success: false,
+            error: error.message
+        });
+
+        console.error(`❌ Step data error (${authenticatedDeviceId || 'unknown'}):`, error.message);
+    }
+}
+
+/**
+ * Handle step data sent as a MessagePack envelope
+ * { type, body: bin(MessagePack payload), signature: bin(64) }
+ * The signature covers SHA-256 of the body bytes exactly as received.
+ */
+async function handleBinaryStepData(ws, message, authenticatedDeviceId) {
+    const signatureHex = '0x' + Buffer.from(message.signature || []).toString('hex');
+    const body = decodeMsgPack(message.body);
+    const { deviceId, stepCount, timestamp, batteryPercent, firmwareVersion } = body;
+
+    if (deviceId !== authenticatedDeviceId) {
+        throw new Error('Device ID mismatch');
+    }
+
+    const device = await deviceManager.getDevice(deviceId);
+    if (!device) {
+        throw new Error('Device not found');
+    }
+
+    const validation = cryptoManager.validatePayload({ ...body, signature: signatureHex });
+    if (!validation.valid) {
+        throw new Error(`Validation failed: ${validation.errors.join(', ')}`);
+    }
+
+    if (!cryptoManager.verifyBytesSignature(message.body, signatureHex, device.public_key)) {
+        throw new Error('Invalid signature');
+    }
+
+    const rawAccSamples = body.rawAccSamples instanceof Uint8Array
+        ? unpackAccSamples(body.rawAccSamples)
+        : (body.rawAccSamples || []);
+
+    await acceptStepData(ws, deviceId, {
+        stepCount,
+        timestamp,
+        rawAccSamples,
+        batteryPercent,
+        firmwareVersion,
+        signature: signatureHex
+    });
+}
+
+/**
+ * Bytes from a binary frame (bin) or a JSON hex string
+ */
+function toBytes(value) {
+    if (value instanceof Uint8Array) return Buffer.from(value);
+    if (typeof value === 'string') return Buffer.from(value.replace(/^0x/, ''), 'hex');
+    return Buffer.alloc(0);
+}
+
+/**
+ * Handle a batch of step windows committed by one signed Merkle root
+ * One signature check per batch; each window gets an inclusion proof.
+ */
+async function handleStepBatch(ws, message, authenticatedDeviceId) {
+    try {
+        const { deviceId } = message;
+
+        if (deviceId !== authenticatedDeviceId) {
+            throw new Error('Device ID mismatch');
         }
 
-        // Send success response
-        ws.send(JSON.stringify({
-            type: 'step_data_response',
-            success: true,
-            dataId,
-            stepCount,
-            verified: true
+        const device = await deviceManager.getDevice(deviceId);
+        if (!device) {
+            throw new Error('Device not found');
+        }
+
+        const windows = (message.windows || []).map(w => ({
+            stepCount: w.stepCount,
+            timestamp: w.timestamp,
+            batteryPercent: w.batteryPercent,
+            samples: toBytes(w.samples)
         }));
+        if (windows.length === 0 || windows.length > 0xffff) {
+            throw new Error('Invalid window count');
+        }
+
+        const signatureHex = '0x' + toBytes(message.signature).toString('hex');
 
-        console.log(`✅ Step data received: ${deviceId} - ${stepCount} steps`);
+        // Same range checks as single submissions, per window
+        for (const w of windows) {
+            const validation = cryptoManager.validatePayload({ deviceId, ...w, signature: signatureHex });
+            if (!validation.valid) {
+                throw new Error(`Validation failed: ${validation.errors.join(', ')}`);
+            }
+        }
+
+        // Recompute the root from the windows and check the single signature
+        const root = merkleRoot(windows);
+        if (!root.equals(toBytes(message.root))) {
+            throw new Error('Merkle root mismatch');
+        }
+
+        const commitment = batchCommitment(root, windows.length, deviceId);
+        if (!cryptoManager.verifyBytesSignature(commitment, signatureHex, device.public_key)) {
+            throw new Error('Invalid signature');
+        }
 
+        const rootHex = root.toString('hex');
+        const totalSteps = await deviceManager.storeStepBatch(deviceId, {
+            root: rootHex,
+            signature: signatureHex,
+            windows: windows.map((w, i) => ({
+                ...w,
+                rawAccSamples: unpackAccSamples(w.samples),
+                proof: inclusionProof(windows, i)
+            }))
+        });
+
+        send(ws, {
+            type: 'step_batch_response',
+            success: true,
+            root: rootHex,
+            windows: windows.length,
+            totalSteps
+        });
+
+        console.log(`✅ Step batch received: ${deviceId} - ${windows.length} windows, ${totalSteps} steps`);
     } catch (error) {
-        ws.send(JSON.stringify({
-            type: 'step_data_response',
+        console.error('❌ Step batch error:', error.message);
+        send(ws, {
+            type: 'step_batch_response',
             success: false,
             error: error.message
-        }));
+        });
+    }
+}
 
-        console.error(`❌ Step data error (${authenticatedDeviceId || 'unknown'}):`, error.message);
+/**
+ * Store verified step data and acknowledge it
+ */
+async function acceptStepData(ws, deviceId, data) {
+    const { stepCount, timestamp, rawAccSamples, batteryPercent, firmwareVersion, signature } = data;
+
+    // Store step data
+    const dataId = await deviceManager.storeStepData(deviceId, {
+        stepCount,
+        timestamp,
+        rawAccSamples,
+        batteryPercent,
+        signature,
+        verified: true
+    });
+
+    // Update firmware version
+    if (firmwareVersion) {
+        deviceManager.updateFirmwareVersion(deviceId, `v${Math.floor(firmwareVersion / 100)}.${firmwareVersion % 100}`);
     }
+
+    // Send success response
+    send(ws, {
+        type: 'step_data_response',
+        success: true,
+        dataId,
+        stepCount,
+        verified: true
+    });
+
+    console.log(`✅ Step data received: ${deviceId} - ${stepCount} steps`);
 }
 
 // =======================
@@ -457,6 +781,18 @@ app.get('/api/devices/:deviceId', (req, res) => {
     }
 });
 
+// Latest link-quality report from a device
+app.get('/api/devices/:deviceId/link', (req, res) => {
+    const metrics = linkMetrics.get(req.params.deviceId);
+    if (!metrics) {
+        return res.status(404).json({
+            success: false,
+            error: 'No link metrics reported'
+        });
+    }
+    res.json({ success: true, metrics });
+});
+
 // Get pending step data
 app.get('/api/step-data/pending', (req, res) => {
     try {
@@ -476,6 +812,55 @@ app.get('/api/step-data/pending', (req, res) => {
     }
 });
 
+// Inclusion proof for one window of a step batch
+app.get('/api/step-batches/:root/windows/:index', async (req, res) => {
+    try {
+        const result = await deviceManager.getBatchWindow(req.params.root, parseInt(req.params.index, 10));
+        if (!result) {
+            return res.status(404).json({
+                success: false,
+                error: 'Window not found'
+            });
+        }
+
+        const { batch, window } = result;
+        const proof = JSON.parse(window.proof || '[]');
+
+        // Re-pack the stored samples to the exact leaf bytes
+        const samples = JSON.parse(window.raw_samples || '[]');
+        const packed = Buffer.alloc(samples.length * 6);
+        samples.forEach((s, i) => {
+            packed.writeInt16LE(Math.round(s[0] * 1000), i * 6);
+            packed.writeInt16LE(Math.round(s[1] * 1000), i * 6 + 2);
+            packed.writeInt16LE(Math.round(s[2] * 1000), i * 6 + 4);
+        });
+
+        const leaf = {
+            stepCount: window.step_count,
+            timestamp: window.timestamp,
+            batteryPercent: window.battery_percent,
+            samples: packed
+        };
+
+        res.json({
+            success: true,
+            root: batch.root,
+            deviceId: batch.device_id,
+            windowCount: batch.window_count,
+            signature: batch.signature,
+            leafIndex: window.leaf_index,
+            window: { ...leaf, samples: packed.toString('hex') },
+            proof,
+            verified: verifyInclusion(leaf, proof, batch.root)
+        });
+    } catch (error) {
+        res.status(500).json({
+            success: false,
+            error: error.message
+        });
+    }
+});
+
 // Manual batch submission to blockchain
 app.post('/api/oracle/submit-batch', async (req, res) => {
     if (!suiClient) {
@@ -567,7 +952,7 @@ async function submitBatchToBlockchain() {
 
     try {
         // Get all pending data grouped by device
-        const pending = deviceManager.getPendingStepData();
+        const pending = await deviceManager.getPendingStepData();
 
         if (pending.length === 0) {
             console.log('  No pending data to submit');
@@ -591,16 +976,40 @@ async function submitBatchToBlockchain() {
         for (const [deviceId, dataList] of Object.entries(byDevice)) {
             try {
                 // Get device to find object ID (assume stored during registration)
-                const device = deviceManager.getDevice(deviceId);
-                if (!device.sui_device_object_id) {
+                const device = await deviceManager.getDevice(deviceId);
+                if (!device?.sui_device_object_id) {
                     console.warn(`  ⚠️  Device ${deviceId} has no blockchain object ID, skipping`);
                     continue;
                 }
 
                 // Aggregate data
                 const totalSteps = dataList.reduce((sum, d) => sum + d.step_count, 0);
-                const timestamps = dataList.map(d => d.timestamp);
-                const signatures = dataList.map(d => d.signature);
+
+                // Batched windows commit only their signed Merkle root: one
+                // (root | windowCount u16 LE | signature) entry per batch instead of
+                // one per window. With the device ID that is everything the
+                // signature covers, so it verifies from chain data alone.
+                const timestamps = [];
+                const signatures = [];
+                const batchLatest = {};
+                for (const d of dataList) {
+                    if (d.batch_root) {
+                        batchLatest[d.batch_root] = Math.max(batchLatest[d.batch_root] || 0, d.timestamp);
+                    } else {
+                        timestamps.push(d.timestamp);
+                        signatures.push(d.signature);
+                    }
+                }
+                for (const d of dataList) {
+                    if (d.batch_root && batchLatest[d.batch_root] !== undefined) {
+                        timestamps.push(batchLatest[d.batch_root]);
+                        const windowCount = Buffer.alloc(2);
+                        windowCount.writeUInt16LE(d.batch_window_count);
+                        signatures.push('0x' + d.batch_root + windowCount.toString('hex') +
+                                        d.signature.replace(/^0x/, ''));
+                        delete batchLatest[d.batch_root];
+                    }
+                }
 
                 // Submit to blockchain
                 const result = await suiClient.submitStepData(
@@ -613,13 +1022,14 @@ async function submitBatchToBlockchain() {
                 if (result.success) {
                     // Mark as submitted
                     const dataIds = dataList.map(d => d.id);
-                    deviceManager.markAsSubmitted(dataIds, result.txDigest);
+                    await deviceManager.markAsSubmitted(dataIds, result.txDigest);
 
                     results.push({
                         deviceId,
                         success: true,
                         totalSteps,
                         recordCount: dataList.length,
+                        commitments: signatures.length,
                         txDigest: result.txDigest
                     });
 
@@ -698,6 +1108,7 @@ server.listen(PORT, '0.0.0.0', async () => {
     console.log('  GET    /');
     console.log('  GET    /api/devices');
     console.log('  GET    /api/devices/:deviceId');
+    console.log('  GET    /api/devices/:deviceId/link');
     console.log('  GET    /api/step-data/pending');
     console.log('  POST   /api/oracle/submit-batch');
     console.log('  GET    /api/oracle/stats');
@@ -707,7 +1118,9 @@ server.listen(PORT, '0.0.0.0', async () => {
     console.log('  register        - Register new device');
     console.log('  authenticate    - Authenticate device');
     console.log('  step_data       - Submit step data');
-    console.log('  ping/pong       - Keep-alive');
+    console.log('  subscribe       - Push pet/wallet changes');
+    console.log('  ping/pong       - Keep-alive (seq echoed for RTT)');
+    console.log('  metrics         - Device link-quality report');
     console.log('');
 
     const stats = deviceManager.getStats();
@@ -771,11 +1184,11 @@ async function handleGetPet(ws, message, deviceId) {
             }
 
             console.log(`  Sending pet_data response to ESP32...`);
-            ws.send(JSON.stringify({
+            send(ws, {
                 type: 'pet_data',
                 success: true,
                 pet: newPet
-            }));
+            });
             console.log(`  ✓ pet_data sent`);
         } else {
             // Update time-based stats locally
@@ -799,18 +1212,18 @@ async function handleGetPet(ws, message, deviceId) {
                 }
             }
 
-            ws.send(JSON.stringify({
+            send(ws, {
                 type: 'pet_data',
                 success: true,
                 pet: updatedPet
-            }));
+            });
         }
     } catch (error) {
-        ws.send(JSON.stringify({
+        send(ws, {
             type: 'pet_error',
             success: false,
             error: error.message
-        }));
+        });
     }
 }
 
@@ -821,24 +1234,47 @@ async function handleUpdatePet(ws, message, deviceId) {
         const pet = await petManager.getPetByDeviceId(deviceId);
         if (!pet) throw new Error('Pet not found');
 
+        // Delta sync: only changed fields, based on a known version
+        if (message.baseVersion !== undefined) {
+            const delta = {};
+            for (const field of SYNC_FIELDS) {
+                if (message[field] !== undefined) delta[field] = message[field];
+            }
+
+            const result = petManager.applyPetDelta(pet.pet_id, Number(message.baseVersion), delta);
+
+            send(ws, {
+                type: 'pet_updated',
+                success: true,
+                pet_id: pet.pet_id,
+                version: result.version,
+                conflicts: result.conflicts
+            });
+
+            const conflictCount = Object.keys(result.conflicts).length;
+            console.log(`🐾 Pet delta: ${pet.pet_name} v${message.baseVersion} -> v${result.version} ` +
+                `(${result.changed.length} changed, ${conflictCount} conflicts)`);
+            return;
+        }
+
         const { happiness, hunger, health, experience, total_steps_fed, level } = message;
         await petManager.updatePetStats(pet.pet_id, {
             happiness, hunger, health, experience, total_steps_fed, level
         });
 
-        ws.send(JSON.stringify({
+        send(ws, {
             type: 'pet_updated',
             success: true,
             pet_id: pet.pet_id
-        }));
+        });
 
         console.log(`🐾 Pet updated: ${pet.pet_name} (Device: ${deviceId})`);
     } catch (error) {
-        ws.send(JSON.stringify({
+        send(ws, {
             type: 'pet_error',
             success: false,
             error: error.message
-        }));
+        });
     }
 }
 
@@ -883,21 +1319,21 @@ async function handleClaimResources(ws, message, deviceId) {
         // Get updated pet
         const updatedPet = await petManager.getPetByDeviceId(deviceId);
 
-        ws.send(JSON.stringify({
+        send(ws, {
             type: 'resources_claimed',
             success: true,
             foodGained,
             energyGained,
             pet: updatedPet
-        }));
+        });
 
         console.log(`💰 Resources claimed for ${pet.pet_name}`);
     } catch (error) {
-        ws.send(JSON.stringify({
+        send(ws, {
             type: 'pet_error',
             success: false,
             error: error.message
-        }));
+        });
     }
 }
 
@@ -957,20 +1393,20 @@ async function handleFeedPet(ws, message, deviceId) {
         // Get updated pet
         const updatedPet = await petManager.getPetByDeviceId(deviceId);
 
-        ws.send(JSON.stringify({
+        send(ws, {
             type: 'pet_fed',
             success: true,
             pet: updatedPet,
             evolved: updatedPet.level > pet.level
-        }));
+        });
 
         console.log(`🍔 Pet fed: ${pet.pet_name}`);
     } catch (error) {
-        ws.send(JSON.stringify({
+        send(ws, {
             type: 'pet_error',
             success: false,
             error: error.message
-        }));
+        });
     }
 }
 
@@ -1021,19 +1457,19 @@ async function handlePlayWithPet(ws, message, deviceId) {
         // Get updated pet
         const updatedPet = await petManager.getPetByDeviceId(deviceId);
 
-        ws.send(JSON.stringify({
+        send(ws, {
             type: 'pet_played',
             success: true,
             pet: updatedPet
-        }));
+        });
 
         console.log(`🎮 Played with pet: ${pet.pet_name}`);
     } catch (error) {
-        ws.send(JSON.stringify({
+        send(ws, {
             type: 'pet_error',
             success: false,
             error: error.message
-        }));
+        });
     }
 }
 
@@ -0,0 +1,217 @@
+/**
+ * Subscription Manager
+ * Pushes pet object and wallet changes to subscribed devices
+ * - One shared virtual_pet event cursor for all pets (no per-device polling)
+ * - Wallet balances checked server-side, pushed only when they change
+ * - Notifications are compact: only what the device displays
+ */
+
+const EVENT_POLL_INTERVAL = 5000;     // virtual_pet events (one query for all pets)
+const BALANCE_POLL_INTERVAL = 15000;  // Wallet balances of subscribed devices
+
+// Event type suffix -> short name sent to the device
+const EVENT_NAMES = {
+    PetCreated: 'created',
+    PetFed: 'fed',
+    PetEvolved: 'evolved',
+    PetPlayed: 'played',
+    ResourcesClaimed: 'claimed'
+};
+
+export class SubscriptionManager {
+    /**
+     * @param {SuiClient} suiClient - Blockchain client (null in local mode)
+     * @param {function} send - send(ws, message) using the connection's codec
+     */
+    constructor(suiClient, send) {
+        this.suiClient = suiClient;
+        this.send = send;
+
+        // deviceId -> { ws, petObjectId, wallet, balance }
+        this.subscriptions = new Map();
+
+        this.eventCursor = null;
+        this.eventTimer = null;
+        this.balanceTimer = null;
+        this.polling = false;
+        this.balancePolling = false;
+
+        this.stats = {
+            eventPolls: 0,
+            balancePolls: 0,
+            petPushes: 0,
+            balancePushes: 0
+        };
+    }
+
+    get enabled() {
+        return !!this.suiClient;
+    }
+
+    /**
+     * Subscribe a device to its pet object and wallet
+     * @returns {object} Current snapshot { pet, balanceMist }
+     */
+    async subscribe(deviceId, ws, { petObjectId, wallet }) {
+        const subscription = {
+            ws,
+            petObjectId: petObjectId || null,
+            wallet: wallet || null,
+            balance: null
+        };
+        this.subscriptions.set(deviceId, subscription);
+
+        const snapshot = { pet: null, balanceMist: null };
+        if (!this.enabled) return snapshot;
+
+        // Initial state so the device doesn't need a separate fetch
+        if (subscription.petObjectId) {
+            snapshot.pet = this.compactPet(await this.suiClient.getPet(subscription.petObjectId));
+        }
+        if (subscription.wallet) {
+            subscription.balance = await this.suiClient.getAddressBalance(subscription.wallet);
+            snapshot.balanceMist = subscription.balance;
+        }
+
+        this.start();
+        console.log(`🔔 Subscribed: ${deviceId} (pet: ${subscription.petObjectId ? 'yes' : 'no'}, wallet: ${subscription.wallet ? 'yes' : 'no'})`);
+        return snapshot;
+    }
+
+    /**
+     * Drop a device's subscription when its socket closes. A watch that
+     * reconnects before the server sees the old socket close has already
+     * subscribed on the new one, so only the closing socket's entry goes.
+     */
+    unsubscribe(deviceId, ws) {
+        const subscription = this.subscriptions.get(deviceId);
+        if (!subscription || subscription.ws !== ws) return;
+        this.subscriptions.delete(deviceId);
+        console.log(`🔕 Unsubscribed: ${deviceId}`);
+        if (this.subscriptions.size === 0) this.stop();
+    }
+
+    start() {
+        if (this.eventTimer) return;
+        this.eventTimer = setInterval(() => this.pollEvents(), EVENT_POLL_INTERVAL);
+        this.balanceTimer = setInterval(() => this.pollBalances(), BALANCE_POLL_INTERVAL);
+    }
+
+    stop() {
+        clearInterval(this.eventTimer);
+        clearInterval(this.balanceTimer);
+        this.eventTimer = null;
+        this.balanceTimer = null;
+        this.eventCursor = null;
+    }
+
+    /**
+     * Only the fields the watch shows, plus the object version (u64 as a
+     * decimal string) so it can drop a snapshot older than one it has
+     */
+    compactPet(pet) {
+        if (!pet) return null;
+        return {
+            objectVersion: pet.version != null ? String(pet.version) : undefined,
+            level: pet.level,
+            experience: pet.experience,
+            total_steps_fed: pet.total_steps_fed,
+            happiness: pet.happiness,
+            hunger: pet.hunger,
+            health: pet.health,
+            food: pet.food,
+            energy: pet.energy
+        };
+    }
+
+    findByPet(petObjectId) {
+        const matches = [];
+        for (const [deviceId, subscription] of this.subscriptions) {
+            if (subscription.petObjectId === petObjectId) matches.push([deviceId, subscription]);
+        }
+        return matches;
+    }
+
+    /**
+     * One event query covers every subscribed pet
+     */
+    async pollEvents() {
+        if (this.polling) return;
+        this.polling = true;
+
+        try {
+            this.stats.eventPolls++;
+            const { events, nextCursor } = await this.suiClient.getPetEventsSince(this.eventCursor);
+            this.eventCursor = nextCursor;
+
+            // Coalesce: one object read per changed pet, whatever the event count
+            const changed = new Map();
+            for (const event of events) {
+                const petObjectId = event.parsedJson?.pet_id;
+                if (!petObjectId || this.findByPet(petObjectId).length === 0) continue;
+                const name = EVENT_NAMES[event.type.split('::').pop()] || 'updated';
+                changed.set(petObjectId, name);
+            }
+
+            for (const [petObjectId, eventName] of changed) {
+                const pet = this.compactPet(await this.suiClient.getPet(petObjectId));
+                if (!pet) continue;
+
+                for (const [deviceId, subscription] of this.findByPet(petObjectId)) {
+                    this.send(subscription.ws, {
+                        type: 'pet_changed',
+                        event: eventName,
+                        pet
+                    });
+                    this.stats.petPushes++;
+                    console.log(`🔔 pet_changed (${eventName}) -> ${deviceId}`);
+                }
+            }
+        } catch (error) {
+            console.error('❌ Subscription event poll failed:', error.message);
+        } finally {
+            this.polling = false;
+        }
+    }
+
+    /**
+     * Reads every subscribed wallet in turn; a pass still running when the
+     * timer fires again (slow RPC, many wallets) is not overlapped
+     */
+    async pollBalances() {
+        if (this.balancePolling) return;
+        this.balancePolling = true;
+
+        try {
+            this.stats.balancePolls++;
+
+            for (const [deviceId, subscription] of this.subscriptions) {
+                if (!subscription.wallet) continue;
+
+                try {
+                    const balance = await this.suiClient.getAddressBalance(subscription.wallet);
+                    if (balance === subscription.balance) continue;
+
+                    subscription.balance = balance;
+                    this.send(subscription.ws, {
+                        type: 'balance_changed',
+                        balanceMist: balance
+                    });
+                    this.stats.balancePushes++;
+                    console.log(`🔔 balance_changed -> ${deviceId}`);
+                } catch (error) {
+                    console.error(`❌ Balance poll failed for ${deviceId}:`, error.message);
+                }
+            }
+        } finally {
+            this.balancePolling = false;
+        }
+    }
+
+    getStats() {
+        return {
+            ...this.stats,
+            subscribers: this.subscriptions.size
+        };
+    }
+}
@@ -8,6 +8,9 @@ import { Transaction } from '@mysten/sui/transactions';
 import { Ed25519Keypair } from '@mysten/sui/keypairs/ed25519';
 import { decodeSuiPrivateKey } from '@mysten/sui/cryptography';
 
+// Cursor for "the module had no events yet": the next call reads from the first one
+export const EVENTS_FROM_START = 'start';
+
 export class SuiClient {
     constructor(network, packageId, registryId, privateKey) {
         this.network = network || 'testnet';
@@ -290,6 +293,21 @@ export class SuiClient {
         }
     }
 
+    /**
+     * Get SUI balance of any address
+     * @param {string} owner - Sui address
+     * @returns {string} Total balance in MIST (u64 as string)
+     */
+    async getAddressBalance(owner) {
+        try {
+            const balance = await this.client.getBalance({ owner });
+            return balance.totalBalance;
+        } catch (error) {
+            console.error('✗ Failed to get address balance:', error.message);
+            throw error;
+        }
+    }
+
     // ============================================
     // Virtual Pet Functions
     // ============================================
@@ -648,6 +666,7 @@ export class SuiClient {
             // Parse pet data from on-chain fields
             return {
                 id: petObjectId,
+                version: object.data.version,
                 name: fields.name,
                 device_id: fields.device_id,
                 level: parseInt(fields.level),
@@ -696,4 +715,48 @@ export class SuiClient {
             throw error;
         }
     }
+
+    /**
+     * Get virtual_pet events after a cursor (oldest first)
+     * @param {object|string|null} cursor - Event cursor from a previous call, null for latest only
+     * @returns {object} { events, nextCursor }
+     */
+    async getPetEventsSince(cursor) {
+        try {
+            if (!cursor) {
+                // No cursor yet: start from the newest event, don't replay history
+                const latest = await this.client.queryEvents({
+                    query: {
+                        MoveModule: {
+                            package: this.packageId,
+                            module: 'virtual_pet',
+                        },
+                    },
+                    limit: 1,
+                    order: 'descending',
+                });
+                return { events: [], nextCursor: latest.data[0]?.id || EVENTS_FROM_START };
+            }
+
+            const events = await this.client.queryEvents({
+                query: {
+                    MoveModule: {
+                        package: this.packageId,
+                        module: 'virtual_pet',
+                    },
+                },
+                cursor: cursor === EVENTS_FROM_START ? null : cursor,
+                limit: 50,
+                order: 'ascending',
+            });
+
+            return {
+                events: events.data,
+                nextCursor: events.nextCursor || cursor
+            };
+        } catch (error) {
+            console.error('✗ Failed to get pet events:', error.message);
+            throw error;
+        }
+    }
 }
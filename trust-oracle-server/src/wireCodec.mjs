@@ -0,0 +1,292 @@
+/**
+ * Wire Codec
+ * Encodes/decodes WebSocket messages for the negotiated wire format
+ * - json:    text frames (default, all legacy clients)
+ * - msgpack: MessagePack binary frames (ESP32 firmware with binary wire enabled)
+ *
+ * Self-contained MessagePack subset: nil, bool, int, float, str, bin, array, map.
+ */
+
+export const CODEC_JSON = 'json';
+export const CODEC_MSGPACK = 'msgpack';
+export const SUPPORTED_CODECS = [CODEC_JSON, CODEC_MSGPACK];
+
+const textEncoder = new TextEncoder();
+const textDecoder = new TextDecoder();
+
+// =======================
+// Encoder
+// =======================
+
+class Writer {
+    constructor(size = 256) {
+        this.buf = Buffer.allocUnsafe(size);
+        this.pos = 0;
+    }
+
+    ensure(n) {
+        if (this.pos + n <= this.buf.length) return;
+        let size = this.buf.length * 2;
+        while (size < this.pos + n) size *= 2;
+        const next = Buffer.allocUnsafe(size);
+        this.buf.copy(next, 0, 0, this.pos);
+        this.buf = next;
+    }
+
+    u8(v) { this.ensure(1); this.buf[this.pos++] = v; }
+    u16(v) { this.ensure(2); this.buf.writeUInt16BE(v, this.pos); this.pos += 2; }
+    u32(v) { this.ensure(4); this.buf.writeUInt32BE(v, this.pos); this.pos += 4; }
+    bytes(b) { this.ensure(b.length); this.buf.set(b, this.pos); this.pos += b.length; }
+
+    result() {
+        return this.buf.subarray(0, this.pos);
+    }
+}
+
+function writeInt(w, v) {
+    if (v >= 0) {
+        if (v < 0x80) return w.u8(v);
+        if (v <= 0xff) { w.u8(0xcc); return w.u8(v); }
+        if (v <= 0xffff) { w.u8(0xcd); return w.u16(v); }
+        if (v <= 0xffffffff) { w.u8(0xce); return w.u32(v); }
+        w.u8(0xcf);
+        w.ensure(8);
+        w.buf.writeBigUInt64BE(BigInt(v), w.pos);
+        w.pos += 8;
+        return;
+    }
+    if (v >= -32) return w.u8(v & 0xff);
+    if (v >= -0x80) { w.u8(0xd0); w.ensure(1); w.buf.writeInt8(v, w.pos); w.pos += 1; return; }
+    if (v >= -0x8000) { w.u8(0xd1); w.ensure(2); w.buf.writeInt16BE(v, w.pos); w.pos += 2; return; }
+    if (v >= -0x80000000) { w.u8(0xd2); w.ensure(4); w.buf.writeInt32BE(v, w.pos); w.pos += 4; return; }
+    w.u8(0xd3);
+    w.ensure(8);
+    w.buf.writeBigInt64BE(BigInt(v), w.pos);
+    w.pos += 8;
+}
+
+function writeStr(w, s) {
+    const b = textEncoder.encode(s);
+    if (b.length < 32) w.u8(0xa0 | b.length);
+    else if (b.length <= 0xff) { w.u8(0xd9); w.u8(b.length); }
+    else if (b.length <= 0xffff) { w.u8(0xda); w.u16(b.length); }
+    else { w.u8(0xdb); w.u32(b.length); }
+    w.bytes(b);
+}
+
+function writeBin(w, b) {
+    if (b.length <= 0xff) { w.u8(0xc4); w.u8(b.length); }
+    else if (b.length <= 0xffff) { w.u8(0xc5); w.u16(b.length); }
+    else { w.u8(0xc6); w.u32(b.length); }
+    w.bytes(b);
+}
+
+function writeValue(w, v) {
+    if (v === null || v === undefined) return w.u8(0xc0);
+    if (v === false) return w.u8(0xc2);
+    if (v === true) return w.u8(0xc3);
+
+    switch (typeof v) {
+        case 'number':
+            if (Number.isSafeInteger(v)) return writeInt(w, v);
+            w.u8(0xcb);
+            w.ensure(8);
+            w.buf.writeDoubleBE(v, w.pos);
+            w.pos += 8;
+            return;
+        case 'bigint':
+            return writeStr(w, v.toString());
+        case 'string':
+            return writeStr(w, v);
+        case 'object':
+            break;
+        default:
+            return w.u8(0xc0);
+    }
+
+    if (v instanceof Uint8Array) return writeBin(w, v);
+    if (typeof v.toJSON === 'function') return writeValue(w, v.toJSON());
+
+    if (Array.isArray(v)) {
+        if (v.length < 16) w.u8(0x90 | v.length);
+        else if (v.length <= 0xffff) { w.u8(0xdc); w.u16(v.length); }
+        else { w.u8(0xdd); w.u32(v.length); }
+        for (const item of v) writeValue(w, item);
+        return;
+    }
+
+    // Skip undefined/function members like JSON.stringify does
+    const keys = Object.keys(v).filter(k => v[k] !== undefined && typeof v[k] !== 'function');
+    if (keys.length < 16) w.u8(0x80 | keys.length);
+    else if (keys.length <= 0xffff) { w.u8(0xde); w.u16(keys.length); }
+    else { w.u8(0xdf); w.u32(keys.length); }
+    for (const k of keys) {
+        writeStr(w, k);
+        writeValue(w, v[k]);
+    }
+}
+
+/**
+ * Encode a value as MessagePack
+ * @param {*} value - Value to encode
+ * @returns {Buffer} Encoded bytes
+ */
+export function encodeMsgPack(value) {
+    const w = new Writer();
+    writeValue(w, value);
+    return w.result();
+}
+
+// =======================
+// Decoder
+// =======================
+
+class Reader {
+    constructor(buf) {
+        this.buf = Buffer.isBuffer(buf) ? buf : Buffer.from(buf.buffer, buf.byteOffset, buf.byteLength);
+        this.pos = 0;
+    }
+
+    need(n) {
+        if (this.pos + n > this.buf.length) {
+            throw new Error('MessagePack: unexpected end of data');
+        }
+    }
+
+    u8() { this.need(1); return this.buf[this.pos++]; }
+    u16() { this.need(2); const v = this.buf.readUInt16BE(this.pos); this.pos += 2; return v; }
+    u32() { this.need(4); const v = this.buf.readUInt32BE(this.pos); this.pos += 4; return v; }
+
+    slice(n) {
+        this.need(n);
+        const b = this.buf.subarray(this.pos, this.pos + n);
+        this.pos += n;
+        return b;
+    }
+}
+
+function readStr(r, n) {
+    return textDecoder.decode(r.slice(n));
+}
+
+function readArray(r, n) {
+    const out = new Array(n);
+    for (let i = 0; i < n; i++) out[i] = readValue(r);
+    return out;
+}
+
+function readMap(r, n) {
+    const out = {};
+    for (let i = 0; i < n; i++) {
+        const key = String(readValue(r));
+        // Own property even for "__proto__", as JSON.parse does (keys are untrusted)
+        Object.defineProperty(out, key, {
+            value: readValue(r),
+            enumerable: true,
+            writable: true,
+            configurable: true
+        });
+    }
+    return out;
+}
+
+function readValue(r) {
+    const t = r.u8();
+
+    if (t < 0x80) return t;
+    if (t >= 0xe0) return t - 0x100;
+    if ((t & 0xf0) === 0x80) return readMap(r, t & 0x0f);
+    if ((t & 0xf0) === 0x90) return readArray(r, t & 0x0f);
+    if ((t & 0xe0) === 0xa0) return readStr(r, t & 0x1f);
+
+    let v;
+    switch (t) {
+        case 0xc0: return null;
+        case 0xc2: return false;
+        case 0xc3: return true;
+        case 0xc4: return r.slice(r.u8());
+        case 0xc5: return r.slice(r.u16());
+        case 0xc6: return r.slice(r.u32());
+        case 0xca: r.need(4); v = r.buf.readFloatBE(r.pos); r.pos += 4; return v;
+        case 0xcb: r.need(8); v = r.buf.readDoubleBE(r.pos); r.pos += 8; return v;
+        case 0xcc: return r.u8();
+        case 0xcd: return r.u16();
+        case 0xce: return r.u32();
+        case 0xcf: r.need(8); v = r.buf.readBigUInt64BE(r.pos); r.pos += 8; return Number(v);
+        case 0xd0: r.need(1); v = r.buf.readInt8(r.pos); r.pos += 1; return v;
+        case 0xd1: r.need(2); v = r.buf.readInt16BE(r.pos); r.pos += 2; return v;
+        case 0xd2: r.need(4); v = r.buf.readInt32BE(r.pos); r.pos += 4; return v;
+        case 0xd3: r.need(8); v = r.buf.readBigInt64BE(r.pos); r.pos += 8; return Number(v);
+        case 0xd9: return readStr(r, r.u8());
+        case 0xda: return readStr(r, r.u16());
+        case 0xdb: return readStr(r, r.u32());
+        case 0xdc: return readArray(r, r.u16());
+        case 0xdd: return readArray(r, r.u32());
+        case 0xde: return readMap(r, r.u16());
+        case 0xdf: return readMap(r, r.u32());
+        default:
+            throw new Error(`MessagePack: unsupported type 0x${t.toString(16)}`);
+    }
+}
+
+/**
+ * Decode MessagePack bytes
+ * @param {Buffer|Uint8Array} data - Encoded bytes
+ * @returns {*} Decoded value (bin fields become Buffers)
+ */
+export function decodeMsgPack(data) {
+    const r = new Reader(data);
+    const value = readValue(r);
+    if (r.pos !== r.buf.length) {
+        throw new Error('MessagePack: trailing bytes');
+    }
+    return value;
+}
+
+// =======================
+// Message helpers
+// =======================
+
+/**
+ * Decode an incoming WebSocket frame
+ * @param {Buffer} data - Frame payload
+ * @param {boolean} isBinary - True for binary frames (MessagePack)
+ * @returns {object} Message object
+ */
+export function decodeMessage(data, isBinary) {
+    if (isBinary) {
+        return decodeMsgPack(data);
+    }
+    return JSON.parse(data.toString());
+}
+
+/**
+ * Encode an outgoing message for a codec
+ * @param {string} codec - CODEC_JSON or CODEC_MSGPACK
+ * @param {object} message - Message object
+ * @returns {Buffer|string} Frame payload
+ */
+export function encodeMessage(codec, message) {
+    if (codec === CODEC_MSGPACK) {
+        return encodeMsgPack(message);
+    }
+    return JSON.stringify(message);
+}
+
+/**
+ * Decode packed little-endian int16 accelerometer samples (milli-g)
+ * @param {Uint8Array} bytes - Packed [x, y, z] triples
+ * @returns {Array} Samples as [[x, y, z], ...] in g
+ */
+export function unpackAccSamples(bytes) {
+    const samples = [];
+    const view = Buffer.from(bytes.buffer, bytes.byteOffset, bytes.byteLength);
+    for (let i = 0; i + 6 <= view.length; i += 6) {
+        samples.push([
+            view.readInt16LE(i) / 1000,
+            view.readInt16LE(i + 2) / 1000,
+            view.readInt16LE(i + 4) / 1000
+        ]);
+    }
+    return samples;
+}
@@ -0,0 +1,254 @@
+#!/usr/bin/env node
+/**
+ * Multi-Server Failover Test
+ * Starts two local trust-oracle-server instances on different ports and keeps
+ * a device session on them. Which server to connect to, when to retry and when
+ * to fail over is decided by the firmware's own OracleEndpoints and LinkMonitor,
+ * built for the host as pet-simulator/failover_client (`make` there first);
+ * this script only runs the WebSocket session and reports to it. The active
+ * server is killed each round and the time until the device is authenticated
+ * on the other one is reported.
+ *
+ * Usage: node test-failover.mjs [rounds]
+ */
+
+import WebSocket from 'ws';
+import nacl from 'tweetnacl';
+import readline from 'readline';
+import { existsSync } from 'fs';
+import { spawn } from 'child_process';
+import { fileURLToPath } from 'url';
+import { dirname, join } from 'path';
+
+const __dirname = dirname(fileURLToPath(import.meta.url));
+const ROUNDS = parseInt(process.argv[2] || '4', 10);
+const CLIENT = join(__dirname, '../pet-simulator/failover_client');
+const LOOP_TICK_MS = 20;  // How often the offline client polls, like loop()
+
+const SERVERS = [
+    { name: 'A', httpPort: 3101, wsPort: 8181 },
+    { name: 'B', httpPort: 3102, wsPort: 8182 }
+];
+
+const sleep = (ms) => new Promise((resolve) => setTimeout(resolve, ms));
+const elapsedMs = (start) => Number(process.hrtime.bigint() - start) / 1e6;
+
+// =======================
+// Server Instances
+// =======================
+
+function startServer(server) {
+    return new Promise((resolve, reject) => {
+        // No Sui credentials: both instances run in local mode on the shared database
+        const child = spawn(process.execPath, [join(__dirname, 'src/server.mjs')], {
+            cwd: __dirname,
+            env: {
+                ...process.env,
+                PORT: String(server.httpPort),
+                WS_PORT: String(server.wsPort),
+                SUI_PRIVATE_KEY: ''
+            },
+            stdio: ['ignore', 'pipe', 'pipe']
+        });
+
+        const timer = setTimeout(() => reject(new Error(`Server ${server.name} did not start`)), 15000);
+        child.stdout.on('data', (data) => {
+            if (data.toString().includes('Trust Oracle Backend Server')) {
+                clearTimeout(timer);
+                resolve();
+            }
+        });
+        child.on('exit', () => {
+            server.child = null;
+        });
+        server.child = child;
+    });
+}
+
+function stopServer(server) {
+    if (!server.child) return Promise.resolve();
+    return new Promise((resolve) => {
+        server.child.once('exit', resolve);
+        server.child.kill('SIGKILL');  // Crash, not a graceful shutdown
+    });
+}
+
+function serverAt(port) {
+    return SERVERS.find((s) => s.wsPort === port);
+}
+
+// =======================
+// Firmware Endpoint Logic
+// =======================
+
+/**
+ * failover_client: one command in, one reply line out
+ */
+function startClient() {
+    const endpoints = SERVERS.map((s) => `127.0.0.1:${s.wsPort}`).join(',');
+    const child = spawn(CLIENT, [endpoints], { stdio: ['pipe', 'pipe', 'inherit'] });
+    const lines = readline.createInterface({ input: child.stdout });
+    const received = [];
+    const waiting = [];
+    lines.on('line', (line) => (waiting.length ? waiting.shift()(line) : received.push(line)));
+
+    const next = () => new Promise((resolve) => {
+        if (received.length) resolve(received.shift());
+        else waiting.push(resolve);
+    });
+    return {
+        next,
+        ask(command) {
+            const reply = next();
+            child.stdin.write(command + '\n');
+            return reply;
+        },
+        stop() {
+            child.stdin.end('quit\n');
+        }
+    };
+}
+
+// =======================
+// Device Session
+// =======================
+
+/**
+ * Connect, register and authenticate; resolves with the open socket
+ */
+function authenticate(port, device) {
+    return new Promise((resolve, reject) => {
+        const ws = new WebSocket(`ws://127.0.0.1:${port}`);
+
+        ws.on('message', (data) => {
+            const message = JSON.parse(data.toString());
+            switch (message.type) {
+                case 'welcome':
+                    ws.send(JSON.stringify({
+                        type: 'register',
+                        deviceId: device.deviceId,
+                        publicKey: '0x' + Buffer.from(device.keypair.publicKey).toString('hex')
+                    }));
+                    break;
+
+                case 'register_response':
+                    ws.send(JSON.stringify({ type: 'authenticate', deviceId: device.deviceId }));
+                    break;
+
+                case 'auth_response':
+                    if (message.success) {
+                        resolve(ws);
+                    } else {
+                        ws.close();
+                        reject(new Error(message.error));
+                    }
+                    break;
+            }
+        });
+
+        ws.once('error', reject);
+        ws.once('close', () => reject(new Error('Closed before authentication')));
+    });
+}
+
+/**
+ * Follow the client's replies until a session is authenticated.
+ * Returns the socket, the server and when the client chose it.
+ */
+async function connectSession(client, device, reply, port) {
+    let switchedAt = null;
+    let failedAt = null;
+
+    for (;;) {
+        const fields = reply.split(' ');
+        if (fields[0] === 'connect') {
+            port = Number(fields[2]);
+            switchedAt = process.hrtime.bigint();
+        } else if (fields[0] === 'retry') {
+            await sleep(Number(fields[1]));
+        } else {
+            throw new Error(`Unexpected reply from failover_client: ${reply}`);
+        }
+
+        try {
+            const ws = await authenticate(port, device);
+            await client.ask('connected');
+            const [, outageMs] = (await client.ask('authenticated')).split(' ');
+            return { ws, port, outageMs: Number(outageMs), failedAt, switchedAt };
+        } catch (error) {
+            // Offline: loop() polls until the retry window has run out
+            failedAt = failedAt || process.hrtime.bigint();
+            do {
+                await sleep(LOOP_TICK_MS);
+                reply = await client.ask('poll');
+            } while (reply === 'wait');
+        }
+    }
+}
+
+async function run() {
+    if (!existsSync(CLIENT)) {
+        throw new Error('pet-simulator/failover_client not built (run make in pet-simulator)');
+    }
+
+    const device = {
+        deviceId: `failover_test_${Date.now()}`,
+        keypair: nacl.sign.keyPair()
+    };
+    const rounds = [];
+
+    console.log('🧪 Starting Failover Test...\n');
+    await Promise.all(SERVERS.map(startServer));
+    console.log(`✓ Servers up: ${SERVERS.map((s) => `${s.name}=ws://localhost:${s.wsPort}`).join(', ')}`);
+
+    const client = startClient();
+    try {
+        // Probes both servers, then names the faster one
+        let session = await connectSession(client, device, await client.next(), 0);
+        console.log(`✓ Authenticated on ${serverAt(session.port).name}\n`);
+
+        for (let round = 1; round <= ROUNDS; round++) {
+            const killed = serverAt(session.port);
+            const closed = new Promise((resolve) => session.ws.once('close', resolve));
+
+            const start = process.hrtime.bigint();
+            await stopServer(killed);
+            await closed;
+            console.log(`📝 Round ${round}: killed ${killed.name}`);
+
+            session = await connectSession(client, device, await client.ask('disconnected'), session.port);
+            const totalMs = elapsedMs(start);
+            const decisionMs = session.failedAt && session.switchedAt
+                ? Number(session.switchedAt - session.failedAt) / 1e6 : NaN;
+            rounds.push({ totalMs, decisionMs, outageMs: session.outageMs });
+            console.log(`   ⇄ Failover decided ${decisionMs.toFixed(0)} ms after the failed reconnect`);
+            console.log(`   ✓ Authenticated on ${serverAt(session.port).name} after ${totalMs.toFixed(0)} ms ` +
+                        `(watch outage ${session.outageMs} ms)`);
+
+            // Bring the killed server back for the next round
+            await startServer(killed);
+        }
+
+        session.ws.close();
+    } finally {
+        client.stop();
+        await Promise.all(SERVERS.map(stopServer));
+    }
+
+    const summary = (values) => {
+        const avg = values.reduce((a, b) => a + b, 0) / Math.max(1, values.length);
+        return `${avg.toFixed(0)}/${Math.min(...values).toFixed(0)}/${Math.max(...values).toFixed(0)} ms`;
+    };
+    console.log('\n📊 Failover summary');
+    console.log(`   Rounds: ${rounds.length}`);
+    console.log(`   Kill -> authenticated avg/min/max: ${summary(rounds.map((r) => r.totalMs))}`);
+    console.log(`   Failed reconnect -> switch avg/min/max: ${summary(rounds.map((r) => r.decisionMs))}`);
+    console.log(`   Watch outage (LinkMonitor) avg/min/max: ${summary(rounds.map((r) => r.outageMs))}`);
+}
+
+try {
+    await run();
+} catch (error) {
+    console.error('❌ Failover test failed:', error.message);
+    process.exit(1);
+}
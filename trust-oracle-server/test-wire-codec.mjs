@@ -0,0 +1,218 @@
+#!/usr/bin/env node
+/**
+ * Wire Codec Comparison
+ * Runs the same device session over JSON text frames and MessagePack binary
+ * frames against a local server and reports bytes on the wire and latency.
+ *
+ * Usage: node test-wire-codec.mjs [ws://localhost:8080] [iterations]
+ */
+
+import WebSocket from 'ws';
+import nacl from 'tweetnacl';
+import crypto from 'crypto';
+import { encodeMsgPack, decodeMessage, CODEC_JSON, CODEC_MSGPACK } from './src/wireCodec.mjs';
+
+const WS_URL = process.argv[2] || 'ws://localhost:8080';
+const ITERATIONS = parseInt(process.argv[3] || '50', 10);
+
+// Helper: Build canonical JSON (sorted keys)
+function buildCanonicalJSON(obj) {
+    const sorted = {};
+    for (const key of Object.keys(obj).sort()) {
+        sorted[key] = obj[key];
+    }
+    return JSON.stringify(sorted);
+}
+
+// Helper: Simulated IMU samples (g, 4 decimals like the firmware)
+function makeSamples() {
+    const samples = [];
+    for (let i = 0; i < 10; i++) {
+        samples.push([
+            Math.round((Math.random() * 2 - 1) * 10000) / 10000,
+            Math.round((Math.random() * 2 - 1) * 10000) / 10000,
+            Math.round((0.5 + Math.random()) * 10000) / 10000
+        ]);
+    }
+    return samples;
+}
+
+function packSamples(samples) {
+    const buf = Buffer.alloc(samples.length * 6);
+    samples.forEach((s, i) => {
+        buf.writeInt16LE(Math.round(s[0] * 1000), i * 6);
+        buf.writeInt16LE(Math.round(s[1] * 1000), i * 6 + 2);
+        buf.writeInt16LE(Math.round(s[2] * 1000), i * 6 + 4);
+    });
+    return buf;
+}
+
+function percentile(values, p) {
+    if (values.length === 0) return 0;
+    const sorted = [...values].sort((a, b) => a - b);
+    return sorted[Math.min(sorted.length - 1, Math.floor(p / 100 * sorted.length))];
+}
+
+/**
+ * Run one device session with the given codec
+ */
+function runSession(codec) {
+    return new Promise((resolve, reject) => {
+        const keypair = nacl.sign.keyPair();
+        const deviceId = `wire_bench_${codec}_${Date.now()}`;
+        const ws = new WebSocket(WS_URL);
+
+        const stats = {
+            codec,
+            bytesSent: 0,
+            bytesReceived: 0,
+            stepBytes: [],
+            stepRtt: [],
+            pingRtt: [],
+            accepted: 0
+        };
+
+        let binary = false;
+        let pending = null;  // { type, start }
+        let remaining = ITERATIONS;
+
+        function send(message) {
+            const frame = binary ? encodeMsgPack(message) : JSON.stringify(message);
+            stats.bytesSent += Buffer.byteLength(frame);
+            ws.send(frame, { binary });
+            return Buffer.byteLength(frame);
+        }
+
+        function sendStepData() {
+            const samples = makeSamples();
+            const base = {
+                batteryPercent: 85,
+                deviceId,
+                firmwareVersion: 100,
+                stepCount: 100 + Math.floor(Math.random() * 500),
+                timestamp: Date.now()
+            };
+
+            let size;
+            if (binary) {
+                const body = encodeMsgPack({ ...base, rawAccSamples: packSamples(samples) });
+                const hash = crypto.createHash('sha256').update(body).digest();
+                const signature = Buffer.from(nacl.sign.detached(hash, keypair.secretKey));
+                size = send({ type: 'step_data', body, signature });
+            } else {
+                const payload = { ...base, rawAccSamples: samples };
+                const hash = crypto.createHash('sha256').update(buildCanonicalJSON(payload), 'utf8').digest();
+                const signature = Buffer.from(nacl.sign.detached(hash, keypair.secretKey)).toString('hex');
+                size = send({ type: 'step_data', ...payload, signature });
+            }
+
+            stats.stepBytes.push(size);
+            pending = { type: 'step', start: process.hrtime.bigint() };
+        }
+
+        function sendPing() {
+            send({ type: 'ping' });
+            pending = { type: 'ping', start: process.hrtime.bigint() };
+        }
+
+        function next() {
+            if (remaining <= 0) {
+                ws.close();
+                return;
+            }
+            remaining--;
+            sendStepData();
+        }
+
+        ws.on('open', () => {
+            console.log(`📡 [${codec}] Connected`);
+        });
+
+        ws.on('message', (data, isBinary) => {
+            stats.bytesReceived += data.length;
+            const message = decodeMessage(data, isBinary);
+            const elapsedMs = pending ? Number(process.hrtime.bigint() - pending.start) / 1e6 : 0;
+
+            switch (message.type) {
+                case 'welcome':
+                    send({
+                        type: 'register',
+                        deviceId,
+                        publicKey: '0x' + Buffer.from(keypair.publicKey).toString('hex'),
+                        codec
+                    });
+                    break;
+
+                case 'register_response':
+                    if (!message.success) {
+                        reject(new Error(`Registration failed: ${message.error}`));
+                        return;
+                    }
+                    binary = message.codec === CODEC_MSGPACK;
+                    send({ type: 'authenticate', deviceId });
+                    break;
+
+                case 'auth_response':
+                    if (!message.success) {
+                        reject(new Error(`Authentication failed: ${message.error}`));
+                        return;
+                    }
+                    next();
+                    break;
+
+                case 'step_data_response':
+                    stats.stepRtt.push(elapsedMs);
+                    if (message.success) stats.accepted++;
+                    sendPing();
+                    break;
+
+                case 'pong':
+                    stats.pingRtt.push(elapsedMs);
+                    next();
+                    break;
+
+                case 'error':
+                    console.log(`   ❌ [${codec}] Error:`, message.error);
+                    break;
+            }
+        });
+
+        ws.on('error', reject);
+        ws.on('close', () => resolve(stats));
+    });
+}
+
+function report(results) {
+    console.log('\n📊 Wire codec comparison');
+    console.log(`   Server: ${WS_URL}, iterations: ${ITERATIONS}\n`);
+    console.log('codec     step bytes  sent total  recv total  step p50/p99 ms  ping p50/p99 ms  accepted');
+
+    for (const s of results) {
+        const avgStep = s.stepBytes.reduce((a, b) => a + b, 0) / Math.max(1, s.stepBytes.length);
+        console.log(
+            s.codec.padEnd(10) +
+            avgStep.toFixed(0).padStart(10) + '  ' +
+            String(s.bytesSent).padStart(10) + '  ' +
+            String(s.bytesReceived).padStart(10) + '  ' +
+            `${percentile(s.stepRtt, 50).toFixed(2)}/${percentile(s.stepRtt, 99).toFixed(2)}`.padStart(15) + '  ' +
+            `${percentile(s.pingRtt, 50).toFixed(2)}/${percentile(s.pingRtt, 99).toFixed(2)}`.padStart(15) + '  ' +
+            `${s.accepted}/${s.stepRtt.length}`.padStart(8)
+        );
+    }
+
+    const [json, msgpack] = results;
+    if (json && msgpack && json.bytesSent > 0) {
+        const saved = 100 * (1 - msgpack.bytesSent / json.bytesSent);
+        console.log(`\n   Uplink bytes saved with MessagePack: ${saved.toFixed(1)}%`);
+    }
+}
+
+try {
+    const results = [];
+    results.push(await runSession(CODEC_JSON));
+    results.push(await runSession(CODEC_MSGPACK));
+    report(results);
+} catch (error) {
+    console.error('❌ Benchmark failed:', error.message);
+    process.exit(1);
+}
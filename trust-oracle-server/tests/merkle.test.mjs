@@ -0,0 +1,62 @@
+/**
+ * Step Batch Merkle Tests
+ * Recomputes every root in step-batch-merkle.txt, the vector the firmware's
+ * host tests check too, so the server and StepBatch cannot drift apart.
+ *
+ * Usage: npm test
+ */
+
+import { test } from 'node:test';
+import assert from 'node:assert/strict';
+import { readFileSync } from 'fs';
+import { fileURLToPath } from 'url';
+import { dirname, join } from 'path';
+import { merkleRoot, inclusionProof, verifyInclusion, encodeLeaf } from '../src/merkle.mjs';
+
+const __dirname = dirname(fileURLToPath(import.meta.url));
+
+function loadVector() {
+    const windows = [];
+    const roots = [];
+    const text = readFileSync(join(__dirname, 'step-batch-merkle.txt'), 'utf8');
+
+    for (const line of text.split('\n')) {
+        const fields = line.trim().split(/\s+/);
+        if (fields[0] === 'window') {
+            windows.push({
+                stepCount: Number(fields[1]),
+                timestamp: BigInt(fields[2]),     // Full u64, beyond Number precision
+                batteryPercent: Number(fields[3]),
+                samples: fields[4] === '-' ? Buffer.alloc(0) : Buffer.from(fields[4], 'hex')
+            });
+        } else if (fields[0] === 'root') {
+            roots.push({ count: Number(fields[1]), hex: fields[2] });
+        }
+    }
+    return { windows, roots };
+}
+
+const { windows, roots } = loadVector();
+
+test('vector has a root for every prefix', () => {
+    assert.ok(windows.length > 0);
+    assert.deepEqual(roots.map(r => r.count), windows.map((_, i) => i + 1));
+});
+
+test('roots match the vector', () => {
+    for (const { count, hex } of roots) {
+        assert.equal(merkleRoot(windows.slice(0, count)).toString('hex'), hex, `first ${count} windows`);
+    }
+});
+
+test('timestamp is hashed as u64', () => {
+    const leaf = encodeLeaf(windows.find(w => w.timestamp > 0xffffffffn));
+    assert.equal(leaf.readBigUInt64LE(4) > 0xffffffffn, true);
+});
+
+test('every window proves against the full root', () => {
+    const root = merkleRoot(windows);
+    windows.forEach((window, index) => {
+        assert.ok(verifyInclusion(window, inclusionProof(windows, index), root), `window ${index}`);
+    });
+});
@@ -0,0 +1,24 @@
+/**
+ * Subscription Manager Tests
+ * Socket bookkeeping only (local mode: no Sui client, nothing is polled).
+ *
+ * Usage: npm test
+ */
+
+import { test } from 'node:test';
+import assert from 'node:assert/strict';
+import { SubscriptionManager } from '../src/subscriptionManager.mjs';
+
+test('late close of a replaced socket keeps the new subscription', async () => {
+    const manager = new SubscriptionManager(null, () => {});
+    const oldWs = {};
+    const newWs = {};
+
+    await manager.subscribe('watch', oldWs, { petObjectId: '0x1' });
+    await manager.subscribe('watch', newWs, { petObjectId: '0x1' });
+    manager.unsubscribe('watch', oldWs);
+    assert.equal(manager.subscriptions.get('watch')?.ws, newWs);
+
+    manager.unsubscribe('watch', newWs);
+    assert.equal(manager.subscriptions.has('watch'), false);
+});
@@ -0,0 +1,104 @@
+/**
+ * Wire Codec Tests
+ * MessagePack round trips through encodeMsgPack/decodeMsgPack, with the
+ * type byte chosen at each size boundary, and the decoder's checks on
+ * malformed and hostile input (device frames are decoded before auth).
+ *
+ * Usage: npm test
+ */
+
+import { test } from 'node:test';
+import assert from 'node:assert/strict';
+import { encodeMsgPack, decodeMsgPack, unpackAccSamples } from '../src/wireCodec.mjs';
+
+// Encode, check that it decodes back unchanged, return the bytes
+function roundTrip(value) {
+    const bytes = encodeMsgPack(value);
+    assert.deepEqual(decodeMsgPack(bytes), value);
+    return bytes;
+}
+
+test('integer boundaries', () => {
+    const cases = [
+        [0, 0x00], [127, 0x7f],                            // positive fixint
+        [128, 0xcc], [255, 0xcc],                          // uint8
+        [256, 0xcd], [0xffff, 0xcd],                       // uint16
+        [0x10000, 0xce], [0xffffffff, 0xce],               // uint32
+        [0x100000000, 0xcf], [Number.MAX_SAFE_INTEGER, 0xcf],  // uint64
+        [-1, 0xff], [-32, 0xe0],                           // negative fixint
+        [-33, 0xd0], [-0x80, 0xd0],                        // int8
+        [-0x81, 0xd1], [-0x8000, 0xd1],                    // int16
+        [-0x8001, 0xd2], [-0x80000000, 0xd2],              // int32
+        [-0x80000001, 0xd3]                                // int64
+    ];
+    for (const [value, type] of cases) {
+        const bytes = roundTrip(value);
+        assert.equal(bytes[0], type, `type of ${value}`);
+    }
+});
+
+test('str8 and str16', () => {
+    assert.equal(roundTrip('x'.repeat(31))[0], 0xbf);
+    assert.equal(roundTrip('x'.repeat(32))[0], 0xd9);
+    assert.equal(roundTrip('x'.repeat(255))[0], 0xd9);
+    assert.equal(roundTrip('x'.repeat(256))[0], 0xda);
+    assert.equal(roundTrip('é✓'.repeat(40))[0], 0xd9);    // Length counts UTF-8 bytes
+});
+
+test('bin8 and bin16', () => {
+    for (const [length, type] of [[0, 0xc4], [255, 0xc4], [256, 0xc5], [0xffff, 0xc5]]) {
+        const bin = Buffer.alloc(length, 0xab);
+        const bytes = encodeMsgPack(bin);
+        assert.equal(bytes[0], type, `bin of ${length}`);
+        assert.ok(bin.equals(decodeMsgPack(bytes)));
+    }
+});
+
+test('array16 and map16', () => {
+    assert.equal(roundTrip(Array.from({ length: 15 }, (_, i) => i))[0], 0x9f);
+    assert.equal(roundTrip(Array.from({ length: 16 }, (_, i) => i))[0], 0xdc);
+
+    const map = (n) => Object.fromEntries(Array.from({ length: n }, (_, i) => [`k${i}`, i]));
+    assert.equal(roundTrip(map(15))[0], 0x8f);
+    assert.equal(roundTrip(map(16))[0], 0xde);
+
+    // Nested, as in a signed step envelope
+    roundTrip({ type: 'step_batch', ok: true, none: null, ratio: 0.25,
+                windows: [{ stepCount: 12, timestamp: 1735492800000 }] });
+});
+
+test('unpackAccSamples', () => {
+    const packed = Buffer.alloc(12);
+    [1000, -1000, 32767, -32768, 0, 981].forEach((v, i) => packed.writeInt16LE(v, i * 2));
+    assert.deepEqual(unpackAccSamples(packed), [[1, -1, 32.767], [-32.768, 0, 0.981]]);
+
+    // A partial triple at the end is ignored; offsets into a larger buffer hold
+    assert.deepEqual(unpackAccSamples(packed.subarray(6, 12)), [[-32.768, 0, 0.981]]);
+    assert.deepEqual(unpackAccSamples(packed.subarray(0, 10)), [[1, -1, 32.767]]);
+});
+
+test('truncated input throws', () => {
+    const bytes = encodeMsgPack({ deviceId: 'watch', samples: Buffer.alloc(40) });
+    for (let length = 0; length < bytes.length; length++) {
+        assert.throws(() => decodeMsgPack(bytes.subarray(0, length)), /unexpected end of data/,
+                      `first ${length} bytes`);
+    }
+});
+
+test('trailing bytes throw', () => {
+    const bytes = Buffer.concat([encodeMsgPack({ a: 1 }), Buffer.from([0xc0])]);
+    assert.throws(() => decodeMsgPack(bytes), /trailing bytes/);
+});
+
+test('__proto__ key becomes an own property', () => {
+    // { "__proto__": { "admin": true } } written by hand
+    const bytes = Buffer.concat([
+        Buffer.from([0x81, 0xa9]), Buffer.from('__proto__'),
+        Buffer.from([0x81, 0xa5]), Buffer.from('admin'), Buffer.from([0xc3])
+    ]);
+    const decoded = decodeMsgPack(bytes);
+    assert.equal(Object.getPrototypeOf(decoded), Object.prototype);
+    assert.equal(decoded.admin, undefined);
+    assert.deepEqual(Object.keys(decoded), ['__proto__']);
+    assert.deepEqual(decoded, JSON.parse('{"__proto__":{"admin":true}}'));
+});